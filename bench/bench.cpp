@@ -0,0 +1,380 @@
+// Micro-benchmarks for the render core's hot paths, on a headless EGL context:
+// Shader construction and uniform updates (shader_s.h), glBufferData uploads, texture decode
+// through stbi_load and whole frames of the triangle scene.
+//
+//   bench --json=results.json                 write Google Benchmark style JSON
+//   bench --baseline=bench/baseline.json      fail (exit 1) if anything got slower than --threshold (10%)
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/bench.cpp glad.c dependencies/include/stb_image.cpp -o bench -lEGL -ldl
+#include <glad/glad.h>
+#include <render/headless_context.h>
+#include <shaders/shader_s.h>
+#include <stb_image.h>
+
+#include "harness.h"
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const unsigned int SCR_WIDTH = 800;
+    const unsigned int SCR_HEIGHT = 600;
+    const int UNIFORMS = 16;
+    const int TEXTURE_SIZE = 512;
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos, 1.0);\n"
+    "   ourColor = aColor;\n"
+    "}\n";
+
+    // UNIFORMS floats, all live so the linker keeps them
+    const char *fragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "in vec3 ourColor;\n"
+    "uniform float u0, u1, u2, u3, u4, u5, u6, u7, u8, u9, u10, u11, u12, u13, u14, u15;\n"
+    "void main()\n"
+    "{\n"
+    "   float scale = u0 + u1 + u2 + u3 + u4 + u5 + u6 + u7 + u8 + u9 + u10 + u11 + u12 + u13 + u14 + u15;\n"
+    "   FragColor = vec4(ourColor * scale, 1.0);\n"
+    "}\n";
+
+    float thirdTriangle[] = {
+        -0.9f, -0.5, 0.0f, 1.0f, 0.0f, 0.0f, // left
+        -0.0f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // right
+        -0.45, 0.5f, 0.0f, 0.0f, 0.0f, 1.0f // top
+    };
+
+struct Fixture
+{
+    HeadlessContext context;
+    std::string vertexPath;
+    std::string fragmentPath;
+    std::string pngPath;
+};
+
+Fixture &fixture()
+{
+    static Fixture f;
+    return f;
+}
+
+// PNG writer just good enough for stbi_load: Sub-filtered rows, one fixed-Huffman deflate block
+// of literals, so decode runs stb's real inflate and unfilter paths
+// ------------------------------------------------------------------------
+struct BitWriter
+{
+    std::vector<unsigned char> bytes;
+    uint32_t buffer = 0;
+    int count = 0;
+
+    void put(uint32_t value, int bits)
+    {
+        buffer |= value << count;
+        count += bits;
+        while (count >= 8)
+        {
+            bytes.push_back((unsigned char)buffer);
+            buffer >>= 8;
+            count -= 8;
+        }
+    }
+    // Huffman codes go most significant bit first
+    void putCode(uint32_t code, int bits)
+    {
+        uint32_t reversed = 0;
+        for (int i = 0; i < bits; i++)
+            reversed |= ((code >> i) & 1) << (bits - 1 - i);
+        put(reversed, bits);
+    }
+    void flush()
+    {
+        if (count > 0)
+            bytes.push_back((unsigned char)buffer);
+        buffer = 0;
+        count = 0;
+    }
+};
+
+uint32_t crc32(const unsigned char *data, size_t length, uint32_t crc = 0)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+void putBigEndian(std::vector<unsigned char> &out, uint32_t value)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+        out.push_back((unsigned char)(value >> shift));
+}
+
+void putChunk(std::vector<unsigned char> &png, const char *type, const std::vector<unsigned char> &data)
+{
+    putBigEndian(png, (uint32_t)data.size());
+    size_t start = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+    putBigEndian(png, crc32(&png[start], png.size() - start));
+}
+
+std::vector<unsigned char> makePng(int width, int height)
+{
+    std::vector<unsigned char> raw;
+    unsigned int seed = 12345;
+    for (int y = 0; y < height; y++)
+    {
+        raw.push_back(1); // Sub filter
+        unsigned char previous[4] = { 0, 0, 0, 0 };
+        for (int x = 0; x < width; x++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            unsigned char pixel[4] = {
+                (unsigned char)(x * 255 / width), (unsigned char)(y * 255 / height),
+                (unsigned char)(128 + ((seed >> 24) & 31)), 255
+            };
+            for (int c = 0; c < 4; c++)
+            {
+                raw.push_back((unsigned char)(pixel[c] - previous[c]));
+                previous[c] = pixel[c];
+            }
+        }
+    }
+    BitWriter deflate;
+    deflate.put(1, 1); // final block
+    deflate.put(1, 2); // fixed Huffman codes
+    for (unsigned char v : raw)
+    {
+        if (v < 144)
+            deflate.putCode(0x30 + v, 8);
+        else
+            deflate.putCode(0x190 + (v - 144), 9);
+    }
+    deflate.putCode(0, 7); // end of block
+    deflate.flush();
+    uint32_t a = 1, b = 0;
+    for (unsigned char v : raw)
+    {
+        a = (a + v) % 65521;
+        b = (b + a) % 65521;
+    }
+    std::vector<unsigned char> zlib = { 0x78, 0x01 };
+    zlib.insert(zlib.end(), deflate.bytes.begin(), deflate.bytes.end());
+    putBigEndian(zlib, (b << 16) | a);
+
+    std::vector<unsigned char> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<unsigned char> header;
+    putBigEndian(header, (uint32_t)width);
+    putBigEndian(header, (uint32_t)height);
+    header.insert(header.end(), { 8, 6, 0, 0, 0 }); // 8 bit RGBA
+    putChunk(png, "IHDR", header);
+    putChunk(png, "IDAT", zlib);
+    putChunk(png, "IEND", std::vector<unsigned char>());
+    return png;
+}
+
+// Shader
+// _________________________________________________________________________________________________________________________________
+void BM_shader_construct(bench::State &state)
+{
+    while (state.keepRunning())
+    {
+        Shader shader(fixture().vertexPath.c_str(), fixture().fragmentPath.c_str());
+        glDeleteProgram(shader.ID);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_shader_construct);
+
+// Shader::setFloat looks the location up by name on every call
+void BM_shader_set_uniforms(bench::State &state)
+{
+    Shader shader(fixture().vertexPath.c_str(), fixture().fragmentPath.c_str());
+    shader.use();
+    std::vector<std::string> names;
+    for (int i = 0; i < UNIFORMS; i++)
+        names.push_back("u" + std::to_string(i));
+    float value = 0.0f;
+    while (state.keepRunning())
+    {
+        for (int i = 0; i < UNIFORMS; i++)
+            shader.setFloat(names[i], value);
+        value += 0.001f;
+    }
+    state.setItemsProcessed(state.iterations() * UNIFORMS);
+    glDeleteProgram(shader.ID);
+}
+BENCHMARK(BM_shader_set_uniforms);
+
+// the same updates with the locations looked up once, for comparison
+void BM_shader_set_uniforms_cached(bench::State &state)
+{
+    Shader shader(fixture().vertexPath.c_str(), fixture().fragmentPath.c_str());
+    shader.use();
+    int locations[UNIFORMS];
+    for (int i = 0; i < UNIFORMS; i++)
+        locations[i] = glGetUniformLocation(shader.ID, ("u" + std::to_string(i)).c_str());
+    float value = 0.0f;
+    while (state.keepRunning())
+    {
+        for (int i = 0; i < UNIFORMS; i++)
+            glUniform1f(locations[i], value);
+        value += 0.001f;
+    }
+    state.setItemsProcessed(state.iterations() * UNIFORMS);
+    glDeleteProgram(shader.ID);
+}
+BENCHMARK(BM_shader_set_uniforms_cached);
+
+// Vertex buffer upload
+// _________________________________________________________________________________________________________________________________
+void BM_buffer_data(bench::State &state)
+{
+    std::vector<unsigned char> data((size_t)state.arg(), 0x5A);
+    unsigned int VBO;
+    glGenBuffers(1, &VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    while (state.keepRunning())
+        glBufferData(GL_ARRAY_BUFFER, data.size(), data.data(), GL_STREAM_DRAW);
+    glFinish();
+    state.setBytesProcessed(state.iterations() * (long long)data.size());
+    glDeleteBuffers(1, &VBO);
+}
+BENCHMARK_ARG(BM_buffer_data, 4 << 10);
+BENCHMARK_ARG(BM_buffer_data, 256 << 10);
+BENCHMARK_ARG(BM_buffer_data, 4 << 20);
+
+// Texture decode
+// _________________________________________________________________________________________________________________________________
+void BM_stbi_load_png(bench::State &state)
+{
+    long long bytes = 0;
+    while (state.keepRunning())
+    {
+        int width, height, channels;
+        unsigned char *pixels = stbi_load(fixture().pngPath.c_str(), &width, &height, &channels, 0);
+        if (pixels == NULL)
+        {
+            state.skipWithError(std::string("stbi_load failed: ") + stbi_failure_reason());
+            return;
+        }
+        bytes += (long long)width * height * channels;
+        stbi_image_free(pixels);
+    }
+    state.setBytesProcessed(bytes); // decoded bytes
+}
+BENCHMARK(BM_stbi_load_png);
+
+// Frames
+// _________________________________________________________________________________________________________________________________
+// one iteration of main.cpp's render loop plus the third triangle, waited on with glFinish
+void BM_frame_triangle(bench::State &state)
+{
+    Shader shader(fixture().vertexPath.c_str(), fixture().fragmentPath.c_str());
+    shader.use();
+    for (int i = 0; i < UNIFORMS; i++)
+        shader.setFloat("u" + std::to_string(i), 1.0f / UNIFORMS);
+    unsigned int VBO, VAO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(thirdTriangle), thirdTriangle, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    while (state.keepRunning())
+    {
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        shader.use();
+        glBindVertexArray(VAO);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        fixture().context.swapBuffers();
+        glFinish();
+    }
+    state.setItemsProcessed(state.iterations()); // frames
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteProgram(shader.ID);
+}
+BENCHMARK(BM_frame_triangle);
+
+bool writeFile(const std::string &path, const void *data, size_t size)
+{
+    std::ofstream out(path, std::ios::binary);
+    out.write((const char*)data, size);
+    return (bool)out;
+}
+
+int main(int argc, char **argv)
+{
+    bench::Options options;
+    if (!bench::parseOptions(argc, argv, options))
+        return 2;
+
+    Fixture &f = fixture();
+    if (!f.context.create(SCR_WIDTH, SCR_HEIGHT))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    // Shader and stbi_load read from disk, so their inputs are written to a scratch directory
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("render_bench_" + std::to_string(getpid()));
+    std::filesystem::create_directories(directory);
+    f.vertexPath = (directory / "bench.vs").string();
+    f.fragmentPath = (directory / "bench.fs").string();
+    f.pngPath = (directory / "bench.png").string();
+    std::vector<unsigned char> png = makePng(TEXTURE_SIZE, TEXTURE_SIZE);
+    if (!writeFile(f.vertexPath, vertexShaderSource, std::strlen(vertexShaderSource))
+        || !writeFile(f.fragmentPath, fragmentShaderSource, std::strlen(fragmentShaderSource))
+        || !writeFile(f.pngPath, png.data(), png.size()))
+    {
+        std::cout << "ERROR::BENCH::CANNOT_WRITE_INPUTS " << directory << std::endl;
+        return -1;
+    }
+
+    std::map<std::string, std::string> context;
+    context["renderer"] = (const char*)glGetString(GL_RENDERER);
+    context["gl_version"] = (const char*)glGetString(GL_VERSION);
+    context["num_cpus"] = std::to_string(sysconf(_SC_NPROCESSORS_ONLN));
+    char host[256] = "";
+    gethostname(host, sizeof(host) - 1);
+    context["host_name"] = host;
+    time_t now = time(NULL);
+    char date[64];
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+    context["date"] = date;
+    #ifdef NDEBUG
+    context["library_build_type"] = "release";
+    #else
+    context["library_build_type"] = "debug";
+    #endif
+    std::cout << "renderer: " << context["renderer"] << "\n";
+
+    int status = bench::runAll(options, context);
+    std::filesystem::remove_all(directory);
+    return status;
+}
@@ -0,0 +1,209 @@
+// Tile-binned, multithreaded software rasteriser (raster/binned_rasterizer.h) scaling from 1
+// to N threads on the oldmain.cpp coloured triangle, copied TRIANGLES times at random
+// positions, sizes and depths (depth test on), next to the single-threaded Rasterizer and the
+// binned one without AVX2.
+//
+// Before timing, the binned output is checked against Rasterizer on the oldmain.cpp scenes
+// and on the workload: both interpolate with RasterPipeline's planes in the same order of
+// operations, so every pixel must be identical, from the AVX2 path and from the scalar one.
+// Exits non-zero if not. --quick (what ctest runs) draws QUICK_TRIANGLES and times one frame.
+//
+// g++ -std=c++17 -O2 -Iinclude bench/binned_raster.cpp -o bench_binned_raster -lpthread
+// ./bench_binned_raster [--threads=<max>] [--quick]
+#include <core/job_system.h>
+#include <raster/binned_rasterizer.h>
+#include <raster/framebuffer.h>
+#include <raster/rasterizer.h>
+#include <raster/triangle_scenes.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int WIDTH = 1280;
+    const int HEIGHT = 720;
+    const int TRIANGLES = 1000000;
+    const int FRAMES = 5;
+    const int QUICK_TRIANGLES = 20000;
+    const float MIN_SCALE = 0.01f;  // of the oldmain.cpp triangle, which is 0.9 x 1.0 in NDC
+    const float MAX_SCALE = 0.05f;
+    const float CLEAR_COLOR[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+// thirdTriangle (position + colour, 6 floats per vertex) scaled and moved, each copy at its own depth
+// ------------------------------------------------------------------------
+std::vector<float> workload(int triangles)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<float> vertices;
+    vertices.reserve((size_t)triangles * 3 * 6);
+    for (int t = 0; t < triangles; t++)
+    {
+        float scale = MIN_SCALE + (MAX_SCALE - MIN_SCALE) * unit(random);
+        float x = unit(random) * 2.2f - 1.1f, y = unit(random) * 2.2f - 1.1f, z = unit(random) * 1.8f - 0.9f;
+        for (int v = 0; v < 3; v++)
+        {
+            const float *source = thirdTriangle + v * 6;
+            float vertex[] = { x + source[0] * scale, y + source[1] * scale, z, source[3], source[4], source[5] };
+            vertices.insert(vertices.end(), vertex, vertex + 6);
+        }
+    }
+    return vertices;
+}
+
+template <typename Raster>
+void drawWorkload(Framebuffer &target, Raster &raster, const std::vector<float> &vertices)
+{
+    target.clearColor(CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]);
+    target.clearDepth(1.0f);
+    RasterPipeline::Program program;
+    program.vertex = &TriangleScene::colorVertex;
+    program.fragment = &TriangleScene::colorFragment;
+    program.fragment8 = &TriangleScene::colorFragment8;
+    program.varyings = 3;
+    raster.enableDepthTest(true);
+    raster.vertexAttribPointer(0, 3, 6 * sizeof(float), vertices.data());
+    raster.vertexAttribPointer(1, 3, 6 * sizeof(float), vertices.data() + 3);
+    raster.useProgram(program);
+    raster.drawArrays(0, vertices.size() / 6);
+}
+
+// largest per-channel difference over all pixels, and how many pixels differ at all
+// ------------------------------------------------------------------------
+int compare(const char *name, const Framebuffer &expected, const Framebuffer &actual)
+{
+    size_t different = 0;
+    int maxDifference = 0;
+    for (size_t i = 0; i < (size_t)expected.width() * expected.height(); i++)
+    {
+        int worst = 0;
+        for (int c = 0; c < 4; c++)
+            worst = std::max(worst, std::abs((int)(expected.pixels()[i] >> (8 * c) & 0xFF) - (int)(actual.pixels()[i] >> (8 * c) & 0xFF)));
+        different += worst != 0;
+        maxDifference = std::max(maxDifference, worst);
+    }
+    char line[200];
+    std::snprintf(line, sizeof(line), "%-28s %8zu pixels differ, max difference %d", name, different, maxDifference);
+    std::cout << line << "\n";
+    return maxDifference;
+}
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    unsigned maxThreads = hardware;
+    int triangles = TRIANGLES, frames = FRAMES;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--quick") == 0)
+        {
+            triangles = QUICK_TRIANGLES;
+            frames = 1;
+        }
+        else if (std::sscanf(argv[i], "--threads=%u", &maxThreads) != 1 || maxThreads == 0)
+        {
+            std::cout << "usage: bench_binned_raster [--threads=<max>] [--quick]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<float> vertices = workload(triangles);
+    Framebuffer expected(WIDTH, HEIGHT), binned(WIDTH, HEIGHT), scalar(WIDTH, HEIGHT);
+    Rasterizer reference(expected);
+    JobSystem checkJobs(std::min(maxThreads, 4u));
+    BinnedRasterizer simdRaster(binned, checkJobs), scalarRaster(scalar, checkJobs);
+    scalarRaster.setSimd(false);
+    std::cout << WIDTH << "x" << HEIGHT << ", " << triangles << " triangles, " << hardware << " hardware threads, AVX2 "
+              << (simdRaster.simdSupported() ? "on" : "not supported") << "\n\n";
+
+    // correctness
+    bool ok = true;
+    for (int s = 0; s < TRIANGLE_SCENE_COUNT; s++)
+    {
+        Framebuffer *targets[] = { &expected, &binned, &scalar };
+        for (Framebuffer *target : targets)
+        {
+            target->clearColor(CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]);
+            target->clearDepth(1.0f);
+        }
+        triangleScenes[s].draw(reference);
+        triangleScenes[s].draw(simdRaster);
+        triangleScenes[s].draw(scalarRaster);
+        ok = compare(triangleScenes[s].name, expected, binned) == 0 && ok;
+        ok = compare("  scalar path", binned, scalar) == 0 && ok;
+    }
+    drawWorkload(expected, reference, vertices);
+    drawWorkload(binned, simdRaster, vertices);
+    drawWorkload(scalar, scalarRaster, vertices);
+    ok = compare("workload", expected, binned) == 0 && ok;
+    ok = compare("  scalar path", binned, scalar) == 0 && ok;
+    if (reference.stats().fragments != simdRaster.stats().fragments)
+    {
+        std::cout << "fragments: Rasterizer " << reference.stats().fragments << ", BinnedRasterizer " << simdRaster.stats().fragments << "\n";
+        ok = false;
+    }
+    std::cout << (ok ? "\n" : "\nERROR::BENCH::BINNED_OUTPUT_MISMATCH\n\n");
+
+    // throughput
+    std::cout << std::fixed << std::setprecision(2)
+              << std::setw(28) << "" << std::setw(12) << "ms/frame" << std::setw(12) << "Mtris/s" << std::setw(12) << "Mpixels/s" << std::setw(10) << "speedup" << "\n";
+    double single = 0.0;
+    auto report = [&](const char *name, unsigned threads, int frames, double seconds, const RasterPipeline::Stats &stats) {
+        std::cout << std::setw(20) << name << std::setw(8) << threads << std::setw(12) << seconds * 1000.0 / frames
+                  << std::setw(12) << stats.triangles / seconds * 1e-6 << std::setw(12) << stats.pixels / seconds * 1e-6;
+        if (single > 0.0)
+            std::cout << std::setw(9) << single / (seconds / frames) << "x";
+        std::cout << "\n";
+    };
+
+    // one frame of the single-threaded Rasterizer, the others are too slow to repeat
+    reference.resetStats();
+    Clock::time_point start = Clock::now();
+    drawWorkload(expected, reference, vertices);
+    report("Rasterizer", 1, 1, secondsSince(start), reference.stats());
+
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+    for (int simd = 0; simd < 2; simd++)
+    {
+        if (simd && !simdRaster.simdSupported())
+            break;
+        single = 0.0;
+        for (unsigned threads : threadCounts)
+        {
+            JobSystem jobs(threads);
+            BinnedRasterizer raster(binned, jobs);
+            raster.setSimd(simd != 0);
+            drawWorkload(binned, raster, vertices); // grows the setup and bin storage
+            raster.resetStats();
+            start = Clock::now();
+            for (int f = 0; f < frames; f++)
+                drawWorkload(binned, raster, vertices);
+            double seconds = secondsSince(start);
+            report(simd ? "binned AVX2" : "binned scalar", threads, frames, seconds, raster.stats());
+            if (threads == 1)
+                single = seconds / frames;
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+// Streaming vertex upload: glBufferSubData vs. orphaning vs. BufferRing.
+// Every frame rewrites the vertex data (as the glfwGetTime animation in oldBuilds/oldmain.cpp would)
+// and draws from it, so the GPU really reads each upload before it can be overwritten.
+//
+// Stalls: the ring's are its fence waits. glBufferSubData and orphaning block inside the driver
+// instead, so theirs is the time the upload calls took beyond a plain memcpy of the same bytes
+// (timed every frame next to them), which is what the driver spent waiting or copying twice.
+// A ring map that fails aborts the run and the bench exits non-zero.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/buffer_upload.cpp glad.c -o bench_buffer_upload -lEGL -ldl
+#include <glad/glad.h>
+#include <render/headless_context.h>
+#include <render/buffer_ring.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int FRAMES = 300;
+    const int VERTEX_FLOATS = 3;
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos, 1.0);\n"
+    "}\0";
+
+    const char *fragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(1.0);\n"
+    "}\0";
+
+enum Method { SUB_DATA, ORPHAN, RING };
+
+struct Result
+{
+    double seconds;      // wall time for all frames, including the final glFinish
+    double uploadSeconds; // CPU time inside the upload calls (map/copy/unmap or BufferData/SubData)
+    double stallSeconds; // CPU time blocked waiting for the GPU (ring: fence waits, others: upload beyond a memcpy)
+    bool failed;
+};
+
+// animate the vertex data a little so every frame really is different
+// ------------------------------------------------------------------------
+void animate(std::vector<float> &data, int frame)
+{
+    float offset = std::sin(frame * 0.05f) * 0.01f;
+    for (size_t i = 0; i < data.size(); i += VERTEX_FLOATS)
+        data[i] = data[i] * 0.5f + offset;
+}
+
+Result run(Method method, size_t bytes, unsigned int program)
+{
+    std::vector<float> data(bytes / sizeof(float), 0.25f), copy(data.size());
+    GLsizei vertexCount = (GLsizei)(bytes / (VERTEX_FLOATS * sizeof(float)));
+
+    unsigned int VAO, VBO = 0;
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    BufferRing *ring = NULL;
+    if (method == RING)
+    {
+        ring = new BufferRing(GL_ARRAY_BUFFER, (GLsizeiptr)bytes);
+        VBO = ring->ID;
+    }
+    else
+    {
+        glGenBuffers(1, &VBO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, bytes, NULL, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VERTEX_FLOATS * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glUseProgram(program);
+    glFinish();
+
+    Result result = { 0.0, 0.0, 0.0, false };
+    double copySeconds = 0.0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        animate(data, frame);
+        std::chrono::steady_clock::time_point uploadStart = std::chrono::steady_clock::now();
+        if (method != RING)
+        {
+            std::memcpy(copy.data(), data.data(), bytes);
+            std::chrono::steady_clock::time_point copyEnd = std::chrono::steady_clock::now();
+            copySeconds += std::chrono::duration<double>(copyEnd - uploadStart).count();
+            uploadStart = copyEnd;
+        }
+        GLint first = 0;
+        if (method == SUB_DATA)
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, data.data());
+        }
+        else if (method == ORPHAN)
+        {
+            glBufferData(GL_ARRAY_BUFFER, bytes, NULL, GL_STREAM_DRAW); // hand the old storage back to the driver
+            glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, data.data());
+        }
+        else
+        {
+            void *dst = ring->map();
+            if (!dst)
+            {
+                ring->unmap();
+                result.failed = true;
+                break;
+            }
+            std::memcpy(dst, data.data(), bytes);
+            first = (GLint)(ring->unmap() / (VERTEX_FLOATS * sizeof(float)));
+        }
+        result.uploadSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - uploadStart).count();
+        glDrawArrays(GL_POINTS, first, vertexCount);
+        if (ring)
+            ring->fence();
+        glFlush();
+    }
+    glFinish();
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (ring)
+    {
+        result.stallSeconds = ring->stallSeconds();
+        delete ring;
+    }
+    else
+    {
+        result.stallSeconds = result.uploadSeconds > copySeconds ? result.uploadSeconds - copySeconds : 0.0;
+        glDeleteBuffers(1, &VBO);
+    }
+    glDeleteVertexArrays(1, &VAO);
+    return result;
+}
+
+unsigned int buildProgram()
+{
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    return program;
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(64, 64))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << "\n";
+    unsigned int program = buildProgram();
+    glEnable(GL_RASTERIZER_DISCARD); // we only care about the vertex fetch reading the buffer
+
+    const char *names[] = { "glBufferSubData", "orphan+SubData", "ring (unsync map)" };
+    const size_t sizes[] = { 64 * 1024, 1024 * 1024, 8 * 1024 * 1024 };
+    std::cout << std::left << std::setw(20) << "method" << std::right << std::setw(10) << "bytes"
+              << std::setw(14) << "MB/s" << std::setw(16) << "upload ms/fr" << std::setw(16) << "stall ms/fr" << "\n";
+    bool ok = true;
+    for (size_t bytes : sizes)
+    {
+        for (int m = SUB_DATA; m <= RING; m++)
+        {
+            Result r = run((Method)m, bytes, program);
+            if (r.failed)
+            {
+                std::cout << std::left << std::setw(20) << names[m] << std::right << std::setw(10) << bytes << "  ERROR::BENCH::MAP_FAILED\n";
+                ok = false;
+                continue;
+            }
+            double megabytes = (double)bytes * FRAMES / (1024.0 * 1024.0);
+            std::cout << std::left << std::setw(20) << names[m] << std::right << std::setw(10) << bytes
+                      << std::setw(14) << std::fixed << std::setprecision(1) << megabytes / r.seconds
+                      << std::setw(16) << std::setprecision(3) << r.uploadSeconds * 1000.0 / FRAMES
+                      << std::setw(16) << r.stallSeconds * 1000.0 / FRAMES << "\n";
+        }
+    }
+    glDeleteProgram(program);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+// Bounding volume hierarchy (scene/bvh.h) at SIZES objects: boxes of 1 to 10 units scattered
+// through a cube WORLD_SIZE wide. For each size:
+//   build     one thread, and in parallel on the JobSystem
+//   refit     after MOVING_FRACTION of the objects moved a little (incremental), after all of
+//             them did (full pass), and the SAH cost that leaves next to a rebuild's
+//   rebuild   on the background thread, and how long finishRebuild() then takes
+//   queries   frustum (against FrustumCuller's linear scan), ray and box overlap per second
+//
+// Checks: before timing and again after the moves, every query must give what a linear scan over
+// all boxes gives: the same frustum list as FrustumCuller, the same nearest hit, the same overlap
+// set. Exits non-zero if not. --quick (what ctest runs) does all of it at QUICK_SIZE objects only.
+//
+// g++ -std=c++17 -O2 -Iinclude bench/bvh.cpp -o bench_bvh -lpthread
+// ./bench_bvh [--quick]
+#include <core/job_system.h>
+#include <scene/bvh.h>
+#include <scene/camera.h>
+#include <scene/frustum_culler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const size_t SIZES[] = { 100000, 1000000 };
+    const size_t QUICK_SIZE = 20000;
+    const float WORLD_SIZE = 2000.0f;
+    const float MOVING_FRACTION = 0.01f;
+    const float MOVE_DISTANCE = 2.0f;
+    const int VIEWS = 32;
+    const int RAYS = 100000;
+    const int OVERLAPS = 100000;
+    const float OVERLAP_SIZE = 40.0f;   // query boxes are this wide
+    const int CHECK_QUERIES = 64;       // of each kind, against linear scans
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+struct Object
+{
+    float min[3];
+    float max[3];
+};
+
+struct Ray
+{
+    float origin[3];
+    float direction[3];
+};
+
+// camera at the middle of the world, turned a step further each view
+// ------------------------------------------------------------------------
+void viewProjection(int view, float out[16])
+{
+    Camera camera;
+    camera.aspect = 16.0f / 9.0f;
+    camera.nearPlane = 0.5f;
+    camera.farPlane = WORLD_SIZE * 0.5f;
+    camera.yaw = 6.2831853f * view / VIEWS;
+    camera.pitch = 0.6f * std::sin(3.0f * view / VIEWS);
+    camera.viewProjection(out);
+}
+
+// linear scans the queries must agree with
+// ------------------------------------------------------------------------
+bool nearestHit(const std::vector<Object> &objects, const Ray &ray, Bvh::Hit &hit)
+{
+    float inverse[3] = { 1.0f / ray.direction[0], 1.0f / ray.direction[1], 1.0f / ray.direction[2] };
+    bool found = false;
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        float enter = 0.0f, exit = WORLD_SIZE * 2.0f;
+        for (int a = 0; a < 3; a++)
+        {
+            float t0 = (objects[i].min[a] - ray.origin[a]) * inverse[a], t1 = (objects[i].max[a] - ray.origin[a]) * inverse[a];
+            enter = std::max(enter, std::min(t0, t1));
+            exit = std::min(exit, std::max(t0, t1));
+        }
+        if (enter <= exit && (!found || enter < hit.distance))
+        {
+            hit = { (uint32_t)i, enter };
+            found = true;
+        }
+    }
+    return found;
+}
+
+size_t overlapping(const std::vector<Object> &objects, const Object &query)
+{
+    size_t count = 0;
+    for (const Object &o : objects)
+        count += o.min[0] <= query.max[0] && query.min[0] <= o.max[0] && o.min[1] <= query.max[1] && query.min[1] <= o.max[1] && o.min[2] <= query.max[2] && query.min[2] <= o.max[2];
+    return count;
+}
+
+// every query kind against the linear scans; the number of disagreements
+// ------------------------------------------------------------------------
+size_t check(const Bvh &bvh, FrustumCuller &linear, const std::vector<Object> &objects, const std::vector<Ray> &rays, const std::vector<Object> &queries)
+{
+    size_t mismatches = 0;
+    std::vector<uint32_t> expected(objects.size()), actual(objects.size());
+    for (int v = 0; v < VIEWS; v += VIEWS / 4)
+    {
+        float vp[16];
+        viewProjection(v, vp);
+        size_t count = linear.cull(vp, expected.data());
+        size_t found = bvh.frustum(vp, actual.data());
+        std::sort(actual.begin(), actual.begin() + found);
+        mismatches += count != found || !std::equal(expected.begin(), expected.begin() + count, actual.begin());
+    }
+    for (int q = 0; q < CHECK_QUERIES; q++)
+    {
+        Bvh::Hit hit = { 0, 0.0f }, expectedHit = { 0, 0.0f };
+        bool found = bvh.raycast(rays[q].origin, rays[q].direction, WORLD_SIZE * 2.0f, hit);
+        bool expectedFound = nearestHit(objects, rays[q], expectedHit);
+        mismatches += found != expectedFound || (found && hit.distance != expectedHit.distance);
+        mismatches += bvh.overlap(queries[q].min, queries[q].max, actual.data()) != overlapping(objects, queries[q]);
+    }
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<size_t> sizes(SIZES, SIZES + sizeof(SIZES) / sizeof(SIZES[0]));
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--quick") != 0)
+        {
+            std::cout << "usage: bench_bvh [--quick]" << std::endl;
+            return 1;
+        }
+        sizes.assign(1, QUICK_SIZE);
+    }
+
+    JobSystem jobs;
+    std::cout << jobs.threadCount() << " threads\n\n";
+    bool ok = true;
+    char line[300];
+    for (size_t size : sizes)
+    {
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::vector<Object> objects(size);
+        FrustumCuller linear;
+        for (Object &o : objects)
+        {
+            float extent = 1.0f + 9.0f * unit(random);
+            for (int a = 0; a < 3; a++)
+            {
+                o.min[a] = (unit(random) - 0.5f) * WORLD_SIZE;
+                o.max[a] = o.min[a] + extent * (0.5f + unit(random));
+            }
+            linear.add(o.min, o.max);
+        }
+        std::vector<Ray> rays(RAYS);
+        for (Ray &ray : rays)
+        {
+            float length = 0.0f;
+            for (int a = 0; a < 3; a++)
+            {
+                ray.origin[a] = (unit(random) - 0.5f) * WORLD_SIZE;
+                ray.direction[a] = unit(random) * 2.0f - 1.0f;
+                length += ray.direction[a] * ray.direction[a];
+            }
+            for (int a = 0; a < 3; a++)
+                ray.direction[a] /= std::sqrt(length);
+        }
+        std::vector<Object> queries(OVERLAPS);
+        for (Object &q : queries)
+            for (int a = 0; a < 3; a++)
+            {
+                q.min[a] = (unit(random) - 0.5f) * WORLD_SIZE;
+                q.max[a] = q.min[a] + OVERLAP_SIZE;
+            }
+
+        // build
+        Bvh single, bvh(&jobs);
+        Clock::time_point start = Clock::now();
+        single.build(objects[0].min, objects[0].max, sizeof(Object), size);
+        double singleMs = millisecondsSince(start);
+        start = Clock::now();
+        bvh.build(objects[0].min, objects[0].max, sizeof(Object), size);
+        double parallelMs = millisecondsSince(start);
+        std::snprintf(line, sizeof(line), "%zu objects: %zu nodes, depth %d, SAH cost %.1f\n%-32s %10.2f ms\n%-32s %10.2f ms (%u threads)\n",
+                      size, bvh.nodeCount(), bvh.depth(), bvh.cost(), "build", singleMs, "build, parallel", parallelMs, jobs.threadCount());
+        std::cout << line;
+        size_t mismatches = check(bvh, linear, objects, rays, queries);
+
+        // refit and rebuild
+        size_t movingCount = (size_t)(size * MOVING_FRACTION);
+        auto move = [&](size_t count) {
+            for (size_t m = 0; m < count; m++)
+            {
+                size_t i = count == size ? m : random() % size;
+                float offset[3];
+                for (int a = 0; a < 3; a++)
+                    offset[a] = (unit(random) * 2.0f - 1.0f) * MOVE_DISTANCE;
+                for (int a = 0; a < 3; a++)
+                {
+                    objects[i].min[a] += offset[a];
+                    objects[i].max[a] += offset[a];
+                }
+                bvh.update(i, objects[i].min, objects[i].max);
+                linear.set(i, objects[i].min, objects[i].max);
+            }
+        };
+        move(movingCount);
+        start = Clock::now();
+        bvh.refit();
+        double refitMs = millisecondsSince(start);
+        for (int step = 0; step < 8; step++)
+            move(size);
+        start = Clock::now();
+        bvh.refit();
+        double fullRefitMs = millisecondsSince(start);
+        double refitCost = bvh.cost();
+        mismatches += check(bvh, linear, objects, rays, queries);
+
+        start = Clock::now();
+        bvh.startRebuild();
+        double startMs = millisecondsSince(start);
+        move(movingCount); // meanwhile
+        while (!bvh.finishRebuild())
+            std::this_thread::yield();
+        double readyMs = millisecondsSince(start);
+        mismatches += check(bvh, linear, objects, rays, queries);
+        std::snprintf(line, sizeof(line), "%-32s %10.2f ms\n%-32s %10.2f ms (SAH cost %.1f)\n%-32s %10.2f ms (start %.2f ms, SAH cost %.1f)\n",
+                      "refit, 1% moved", refitMs, "refit, all moved 8 times", fullRefitMs, refitCost,
+                      "background rebuild until ready", readyMs, startMs, bvh.cost());
+        std::cout << line;
+
+        // queries
+        std::vector<uint32_t> out(size);
+        size_t kept = 0;
+        start = Clock::now();
+        for (int v = 0; v < VIEWS; v++)
+        {
+            float vp[16];
+            viewProjection(v, vp);
+            kept += linear.cull(vp, out.data());
+        }
+        double linearMs = millisecondsSince(start) / VIEWS;
+        start = Clock::now();
+        for (int v = 0; v < VIEWS; v++)
+        {
+            float vp[16];
+            viewProjection(v, vp);
+            bvh.frustum(vp, out.data());
+        }
+        double frustumMs = millisecondsSince(start) / VIEWS;
+        size_t hits = 0;
+        start = Clock::now();
+        for (const Ray &ray : rays)
+        {
+            Bvh::Hit hit;
+            hits += bvh.raycast(ray.origin, ray.direction, WORLD_SIZE * 2.0f, hit);
+        }
+        double raySeconds = millisecondsSince(start) * 1e-3;
+        size_t overlaps = 0;
+        start = Clock::now();
+        for (const Object &q : queries)
+            overlaps += bvh.overlap(q.min, q.max, out.data());
+        double overlapSeconds = millisecondsSince(start) * 1e-3;
+        std::snprintf(line, sizeof(line), "%-32s %10.3f ms (%.1f%% kept; linear FrustumCuller %.3f ms)\n%-32s %10.2f Mrays/s (%.0f%% hit)\n%-32s %10.2f M/s (%.1f boxes each)\n",
+                      "frustum query", frustumMs, 100.0 * kept / ((double)size * VIEWS), linearMs,
+                      "ray query", RAYS / raySeconds * 1e-6, 100.0 * hits / RAYS, "overlap query", OVERLAPS / overlapSeconds * 1e-6, (double)overlaps / OVERLAPS);
+        std::cout << line;
+        std::cout << "queries differing from linear scans: " << mismatches << "\n\n";
+        ok = ok && mismatches == 0;
+    }
+    if (!ok)
+        std::cout << "ERROR::BENCH::BVH_QUERY_MISMATCH\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,320 @@
+// Parallel draw preparation: OBJECTS objects per frame recorded into per-thread CommandBuffers
+// by 1..N worker threads, then replayed on the GL thread by GLCommandReplay. Compared with the
+// single-threaded baseline that computes each object and calls GL directly, and recorded
+// through JobSystem::parallelFor into per-chunk buffers.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/command_recording.cpp glad.c -o bench_command_recording -lEGL -ldl -lpthread
+#include <glad/glad.h>
+#include <core/job_system.h>
+#include <render/command_buffer.h>
+#include <render/gl_command_replay.h>
+#include <render/headless_context.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int OBJECTS = 100000;
+    const int FRAMES = 20;
+    const int REPLAY_FRAMES = 2; // GL replay is far slower than recording on software rasterisers
+    const int OBJECTS_PER_MATERIAL = 64;
+    const int CHUNKS = 64;       // command buffers per frame on the JobSystem path
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "uniform mat4 model;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = model * vec4(aPos, 1.0);\n"
+    "}\0";
+
+    const char *fragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "uniform vec4 color;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = color;\n"
+    "}\0";
+
+typedef std::chrono::steady_clock Clock;
+
+struct Scene
+{
+    unsigned int programs[2] = { 0, 0 };
+    int modelSlot[2] = { -1, -1 };
+    int colorSlot[2] = { -1, -1 };
+    unsigned int VAO = 0, VBO = 0;
+};
+
+// the per-object "draw preparation": a model matrix and a colour from the object's index and the time
+// ------------------------------------------------------------------------
+inline void prepare(int object, float time, float *model, float *color)
+{
+    float x = -1.0f + 2.0f * (object % 316) / 316.0f, y = -1.0f + 2.0f * (object / 316) / 316.0f;
+    float angle = time + object * 0.01f, s = std::sin(angle) * 0.005f, c = std::cos(angle) * 0.005f;
+    float m[16] = { c, s, 0, 0, -s, c, 0, 0, 0, 0, 0.005f, 0, x, y, 0, 1 };
+    std::memcpy(model, m, sizeof(m));
+    color[0] = 0.5f + 0.5f * std::sin(angle);
+    color[1] = 0.5f + 0.5f * std::cos(angle);
+    color[2] = (object & 255) / 255.0f;
+    color[3] = 1.0f;
+}
+
+void record(CommandBuffer &buffer, const Scene &scene, int begin, int end, float time)
+{
+    buffer.bindVertexArray(scene.VAO);
+    int material = -1;
+    for (int i = begin; i < end; i++)
+    {
+        int m = (i / OBJECTS_PER_MATERIAL) & 1;
+        if (m != material)
+        {
+            material = m;
+            buffer.bindProgram(scene.programs[m]);
+        }
+        float model[16], color[4];
+        prepare(i, time, model, color);
+        buffer.uniformMatrix4f(scene.modelSlot[m], model);
+        buffer.uniform4f(scene.colorSlot[m], color[0], color[1], color[2], color[3]);
+        buffer.drawArrays(CommandBuffer::TRIANGLES, 0, 3);
+    }
+}
+
+void submitDirect(const Scene &scene, float time)
+{
+    glBindVertexArray(scene.VAO);
+    int material = -1;
+    for (int i = 0; i < OBJECTS; i++)
+    {
+        int m = (i / OBJECTS_PER_MATERIAL) & 1;
+        if (m != material)
+        {
+            material = m;
+            glUseProgram(scene.programs[m]);
+        }
+        float model[16], color[4];
+        prepare(i, time, model, color);
+        glUniformMatrix4fv(scene.modelSlot[m], 1, GL_FALSE, model);
+        glUniform4fv(scene.colorSlot[m], 1, color);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+}
+
+// workers record frame after frame; the main thread starts each frame and waits for all of them
+// ------------------------------------------------------------------------
+class RecordingPool
+{
+public:
+    std::vector<std::unique_ptr<CommandBuffer>> buffers;
+
+    RecordingPool(int threads, const Scene &scene)
+        : scene(scene)
+    {
+        for (int t = 0; t < threads; t++)
+            buffers.emplace_back(new CommandBuffer());
+        for (int t = 0; t < threads; t++)
+            workers.emplace_back(&RecordingPool::work, this, t);
+    }
+    ~RecordingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        start.notify_all();
+        for (std::thread &worker : workers)
+            worker.join();
+    }
+    void recordFrame(float time)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        frameTime = time;
+        pending = (int)workers.size();
+        generation++;
+        start.notify_all();
+        done.wait(lock, [this] { return pending == 0; });
+    }
+
+private:
+    void work(int index)
+    {
+        unsigned long long seen = 0;
+        int threads = (int)buffers.size();
+        int begin = (int)((long long)OBJECTS * index / threads), end = (int)((long long)OBJECTS * (index + 1) / threads);
+        for (;;)
+        {
+            float time;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                start.wait(lock, [this, seen] { return quit || generation != seen; });
+                if (quit)
+                    return;
+                seen = generation;
+                time = frameTime;
+            }
+            buffers[index]->reset();
+            record(*buffers[index], scene, begin, end, time);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0)
+                done.notify_one();
+        }
+    }
+
+    const Scene &scene;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    unsigned long long generation = 0;
+    int pending = 0;
+    float frameTime = 0.0f;
+    bool quit = false;
+};
+
+unsigned int buildProgram()
+{
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    return program;
+}
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(512, 512))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    Scene scene;
+    for (int m = 0; m < 2; m++)
+    {
+        scene.programs[m] = buildProgram();
+        scene.modelSlot[m] = glGetUniformLocation(scene.programs[m], "model");
+        scene.colorSlot[m] = glGetUniformLocation(scene.programs[m], "color");
+    }
+    float triangle[] = { -1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+    glGenVertexArrays(1, &scene.VAO);
+    glGenBuffers(1, &scene.VBO);
+    glBindVertexArray(scene.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, scene.VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    int maxThreads = std::max(4, (int)std::thread::hardware_concurrency());
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << ", " << std::thread::hardware_concurrency() << " hardware threads, "
+              << OBJECTS << " objects (" << OBJECTS * 3 << " commands + binds) per frame\n\n";
+
+    // single-threaded baseline: prepare and call GL object by object
+    Clock::time_point start = Clock::now();
+    for (int f = 0; f < REPLAY_FRAMES; f++)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        submitDirect(scene, f * 0.016f);
+        glFinish();
+    }
+    double direct = secondsSince(start) / REPLAY_FRAMES;
+    std::cout << std::fixed << std::setprecision(2) << "direct GL (prepare + submit, 1 thread): " << direct * 1000.0 << " ms/frame\n\n";
+
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "record ms" << std::setw(10) << "speedup" << std::setw(16)
+              << "Mcommands/s" << std::setw(14) << "replay ms" << std::setw(12) << "KiB" << "\n";
+    double single = 0.0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        RecordingPool pool(threads, scene);
+        pool.recordFrame(0.0f); // warm up: grows the arenas to their steady-state size
+        double recordSeconds = 0.0, replaySeconds = 0.0;
+        size_t commands = 0, bytes = 0;
+        for (int f = 0; f < FRAMES; f++)
+        {
+            Clock::time_point recordStart = Clock::now();
+            pool.recordFrame(f * 0.016f);
+            recordSeconds += secondsSince(recordStart);
+            if (f >= REPLAY_FRAMES)
+                continue;
+
+            Clock::time_point replayStart = Clock::now();
+            glClear(GL_COLOR_BUFFER_BIT);
+            for (const std::unique_ptr<CommandBuffer> &buffer : pool.buffers)
+                GLCommandReplay::replay(*buffer);
+            glFinish();
+            replaySeconds += secondsSince(replayStart);
+        }
+        for (const std::unique_ptr<CommandBuffer> &buffer : pool.buffers)
+        {
+            commands += buffer->commandCount();
+            bytes += buffer->bytes();
+        }
+        double record = recordSeconds / FRAMES;
+        if (threads == 1)
+            single = record;
+        std::cout << std::setw(8) << threads << std::setw(14) << record * 1000.0 << std::setw(9) << single / record << "x"
+                  << std::setw(16) << commands / record / 1e6 << std::setw(14) << replaySeconds / REPLAY_FRAMES * 1000.0
+                  << std::setw(12) << bytes / 1024 << "\n";
+    }
+
+    // the same recording through the JobSystem: one CommandBuffer per fixed chunk of objects,
+    // so the replay order (and the image) does not depend on which thread recorded what
+    std::cout << "\nJobSystem parallelFor, " << CHUNKS << " chunks\n" << std::setw(8) << "threads" << std::setw(14) << "record ms"
+              << std::setw(10) << "speedup" << "\n";
+    std::vector<std::unique_ptr<CommandBuffer>> chunks;
+    for (int c = 0; c < CHUNKS; c++)
+        chunks.emplace_back(new CommandBuffer());
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        JobSystem jobs(threads);
+        double recordSeconds = 0.0;
+        for (int f = -1; f < FRAMES; f++) // frame -1 warms the arenas up
+        {
+            float time = f * 0.016f;
+            Clock::time_point recordStart = Clock::now();
+            jobs.parallelFor(0, CHUNKS, 1, [&](size_t begin, size_t end) {
+                for (size_t c = begin; c < end; c++)
+                {
+                    chunks[c]->reset();
+                    record(*chunks[c], scene, (int)(OBJECTS * c / CHUNKS), (int)(OBJECTS * (c + 1) / CHUNKS), time);
+                }
+            });
+            if (f >= 0)
+                recordSeconds += secondsSince(recordStart);
+        }
+        double record = recordSeconds / FRAMES;
+        std::cout << std::setw(8) << threads << std::setw(14) << record * 1000.0 << std::setw(9) << single / record << "x\n";
+    }
+
+    glDeleteProgram(scene.programs[0]);
+    glDeleteProgram(scene.programs[1]);
+    glDeleteBuffers(1, &scene.VBO);
+    glDeleteVertexArrays(1, &scene.VAO);
+    return 0;
+}
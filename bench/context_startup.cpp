@@ -0,0 +1,166 @@
+// Context creation to first frame: eager gladLoadGLLoader vs. gladLoadGLLoaderLazy.
+// Each sample runs in a fresh forked process so neither loader benefits from the other's
+// already-resolved pointers. The first frame is the coloured triangle from oldBuilds/oldmain.cpp.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/context_startup.cpp glad.c -o bench_context_startup -lEGL -ldl
+#include <glad/glad.h>
+#include <render/headless_context.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int SAMPLES = 15;
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderTriangleWithColorSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos, 1.0);\n"
+    "   ourColor = aColor;\n"
+    "}\0";
+
+    const char *fragmentShaderTriangleWColorSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "in vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0);\n"
+    "}\0";
+
+struct Sample
+{
+    double context; // eglInitialize .. eglMakeCurrent
+    double load;    // glad
+    double frame;   // shader build, upload, first draw and glFinish
+};
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// runs in the child process
+// ------------------------------------------------------------------------
+bool measure(bool lazy, Sample &sample)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    HeadlessContext context;
+    if (!context.create(800, 600))
+        return false;
+    sample.context = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    int loaded = lazy ? gladLoadGLLoaderLazy((GLADloadproc)eglGetProcAddress) : gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+    if (!loaded)
+        return false;
+    sample.load = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexShaderTriangleWithColorSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentShaderTriangleWColorSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    float thirdTriangle[] = {
+        -0.9f, -0.5, 0.0f, 1.0f, 0.0f, 0.0f, // left
+        -0.0f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // right
+        -0.45, 0.5f, 0.0f, 0.0f, 0.0f, 1.0f // top
+    };
+    unsigned int VBO, VAO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(thirdTriangle), thirdTriangle, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(program);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    context.swapBuffers();
+    glFinish();
+    sample.frame = secondsSince(start);
+    return true;
+}
+
+bool sampleInChild(bool lazy, Sample &sample)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        return false;
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        Sample result;
+        bool ok = measure(lazy, result);
+        if (ok && write(fds[1], &result, sizeof(result)) != (ssize_t)sizeof(result))
+            ok = false;
+        close(fds[1]);
+        _exit(ok ? 0 : 1);
+    }
+    close(fds[1]);
+    bool ok = read(fds[0], &sample, sizeof(sample)) == (ssize_t)sizeof(sample);
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+int main()
+{
+    const char *names[] = { "eager gladLoadGLLoader", "gladLoadGLLoaderLazy" };
+    std::vector<double> context[2], load[2], frame[2], total[2];
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        for (int mode = 0; mode < 2; mode++) // interleave so drift affects both equally
+        {
+            Sample sample;
+            if (!sampleInChild(mode == 1, sample))
+            {
+                std::cout << "ERROR::BENCH::SAMPLE_FAILED (" << names[mode] << ")" << std::endl;
+                return -1;
+            }
+            context[mode].push_back(sample.context);
+            load[mode].push_back(sample.load);
+            frame[mode].push_back(sample.frame);
+            total[mode].push_back(sample.context + sample.load + sample.frame);
+        }
+    }
+    std::cout << "median of " << SAMPLES << " fresh processes, ms\n"
+              << std::left << std::setw(26) << "loader" << std::right << std::setw(10) << "context" << std::setw(10) << "load"
+              << std::setw(14) << "first frame" << std::setw(10) << "total" << "\n";
+    for (int mode = 0; mode < 2; mode++)
+    {
+        std::cout << std::left << std::setw(26) << names[mode] << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(10) << median(context[mode]) * 1000.0 << std::setw(10) << median(load[mode]) * 1000.0
+                  << std::setw(14) << median(frame[mode]) * 1000.0 << std::setw(10) << median(total[mode]) * 1000.0 << "\n";
+    }
+    return 0;
+}
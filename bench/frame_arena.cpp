@@ -0,0 +1,375 @@
+// Per-frame transient data through the general heap vs. a FrameArena, and proof that the
+// steady-state render loop makes no heap allocations.
+//
+// Every frame builds a draw list (one item per object, sorted back to front) and sets the
+// per-object and per-light uniforms through Shader::setFloat by name. "heap" does it the
+// usual way: a std::vector grown by push_back and std::string names ("lights[" + i + ...),
+// as every setFloat call with a literal did before the const char* overloads. "frame arena"
+// reserves the list in a FrameArena, formats names into it and passes literals as const char*.
+// "render thread" is the arena loop split the way main.cpp runs: the main thread builds the
+// list, the render thread draws it and formats its own names into a second arena it advances
+// right after each swap.
+//
+// Allocations are counted by the operator new hook in core/alloc_counter.h over the frames
+// after WARMUP (driver mallocs aren't seen).
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/frame_arena.cpp glad.c -o bench_frame_arena -lEGL -ldl -lpthread
+#define ALLOC_COUNTER_IMPLEMENTATION
+#include <core/alloc_counter.h>
+
+#include <glad/glad.h>
+#include <core/frame_arena.h>
+#include <render/headless_context.h>
+#include <render/render_thread.h>
+#include <shaders/shader_s.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int FRAMES = 600;
+    const int WARMUP = 60;       // frames before counting: arenas and driver caches reach their peak
+    const int OBJECTS = 512;     // draw items per frame
+    const int LIGHTS = 4;
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "struct Instance { float offsetX; float offsetY; float scale; };\n"
+    "uniform Instance instance;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos.xy * instance.scale + vec2(instance.offsetX, instance.offsetY), aPos.z, 1.0);\n"
+    "}\0";
+
+    const char *fragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "struct Light { float intensity; };\n"
+    "uniform Light lights[4];\n"
+    "void main()\n"
+    "{\n"
+    "   float sum = 0.0;\n"
+    "   for (int i = 0; i < 4; i++)\n"
+    "       sum += lights[i].intensity;\n"
+    "   FragColor = vec4(vec3(sum * 0.25), 1.0);\n"
+    "}\0";
+
+typedef std::chrono::steady_clock Clock;
+
+struct DrawItem
+{
+    float depth;
+    float x, y;
+    float scale;
+};
+
+struct FrameData
+{
+    const DrawItem *items = nullptr; // in the main thread's frame arena
+    size_t count = 0;
+    float lights[LIGHTS] = {};
+};
+
+struct Result
+{
+    unsigned long long allocations = 0;
+    unsigned long long bytes = 0;
+    double frameMs = 0.0;
+    double buildMs = 0.0;
+};
+
+// the simulation: object positions and light levels for frame index
+// ------------------------------------------------------------------------
+void objectAt(int frame, int i, DrawItem &item)
+{
+    item.depth = (float)((i * 7919 + frame * 31) % 1000) / 1000.0f;
+    item.x = -0.9f + 1.8f * (float)(i % 32) / 32.0f;
+    item.y = -0.9f + 1.8f * (float)(i / 32) / (OBJECTS / 32.0f);
+    item.scale = 0.05f;
+}
+float lightAt(int frame, int light)
+{
+    return 0.5f + 0.5f * (float)((frame + light * 17) % 60) / 60.0f;
+}
+
+struct Scene
+{
+    Shader *shader = nullptr;
+    unsigned int VAO = 0, VBO = 0;
+
+    bool create(const std::string &vertexPath, const std::string &fragmentPath)
+    {
+        shader = new Shader(vertexPath.c_str(), fragmentPath.c_str());
+        float vertices[] = {
+            -0.5f, -0.5f, 0.0f,
+             0.5f, -0.5f, 0.0f,
+             0.0f,  0.5f, 0.0f
+        };
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        return shader->ID != 0;
+    }
+    void destroy()
+    {
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteProgram(shader->ID);
+        delete shader;
+        shader = nullptr;
+    }
+    void begin()
+    {
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        shader->use();
+        glBindVertexArray(VAO);
+    }
+    // names as const char*: literals and names formatted into the arena
+    // ------------------------------------------------------------------------
+    void draw(const DrawItem *items, size_t count, const float *lights, FrameArena &names)
+    {
+        begin();
+        for (int l = 0; l < LIGHTS; l++)
+            shader->setFloat(names.format("lights[%d].intensity", l), lights[l]);
+        for (size_t i = 0; i < count; i++)
+        {
+            shader->setFloat("instance.offsetX", items[i].x);
+            shader->setFloat("instance.offsetY", items[i].y);
+            shader->setFloat("instance.scale", items[i].scale);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+    }
+};
+
+bool backToFront(const DrawItem &a, const DrawItem &b)
+{
+    return a.depth > b.depth;
+}
+
+double msSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// heap: vector growth and a std::string per uniform name
+// ------------------------------------------------------------------------
+Result runHeap(Scene &scene, HeadlessContext &context)
+{
+    Result result;
+    unsigned long long allocations = 0, bytes = 0;
+    Clock::time_point start;
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        if (frame == WARMUP)
+        {
+            allocations = AllocCounter::allocations();
+            bytes = AllocCounter::bytes();
+            start = Clock::now();
+        }
+        Clock::time_point buildStart = Clock::now();
+        std::vector<DrawItem> items;
+        for (int i = 0; i < OBJECTS; i++)
+        {
+            DrawItem item;
+            objectAt(frame, i, item);
+            items.push_back(item);
+        }
+        std::sort(items.begin(), items.end(), backToFront);
+        if (frame >= WARMUP)
+            result.buildMs += msSince(buildStart);
+
+        scene.begin();
+        for (int l = 0; l < LIGHTS; l++)
+            scene.shader->setFloat("lights[" + std::to_string(l) + "].intensity", lightAt(frame, l));
+        for (const DrawItem &item : items)
+        {
+            scene.shader->setFloat(std::string("instance.offsetX"), item.x);
+            scene.shader->setFloat(std::string("instance.offsetY"), item.y);
+            scene.shader->setFloat(std::string("instance.scale"), item.scale);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+        context.swapBuffers();
+        glFinish();
+    }
+    result.frameMs = msSince(start) / (FRAMES - WARMUP);
+    result.buildMs /= FRAMES - WARMUP;
+    result.allocations = AllocCounter::allocations() - allocations;
+    result.bytes = AllocCounter::bytes() - bytes;
+    return result;
+}
+
+// frame arena: the list and the names live in the arena, rewound after each swap
+// ------------------------------------------------------------------------
+Result runArena(Scene &scene, HeadlessContext &context)
+{
+    Result result;
+    FrameArena frameArena;
+    unsigned long long allocations = 0, bytes = 0;
+    Clock::time_point start;
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        if (frame == WARMUP)
+        {
+            allocations = AllocCounter::allocations();
+            bytes = AllocCounter::bytes();
+            start = Clock::now();
+        }
+        Clock::time_point buildStart = Clock::now();
+        ArenaVector<DrawItem> items = frameArena.vector<DrawItem>(OBJECTS);
+        for (int i = 0; i < OBJECTS; i++)
+        {
+            DrawItem item;
+            objectAt(frame, i, item);
+            items.push_back(item);
+        }
+        std::sort(items.begin(), items.end(), backToFront);
+        float lights[LIGHTS];
+        for (int l = 0; l < LIGHTS; l++)
+            lights[l] = lightAt(frame, l);
+        if (frame >= WARMUP)
+            result.buildMs += msSince(buildStart);
+
+        scene.draw(items.data(), items.size(), lights, frameArena);
+        context.swapBuffers();
+        glFinish();
+        frameArena.nextFrame();
+    }
+    result.frameMs = msSince(start) / (FRAMES - WARMUP);
+    result.buildMs /= FRAMES - WARMUP;
+    result.allocations = AllocCounter::allocations() - allocations;
+    result.bytes = AllocCounter::bytes() - bytes;
+    return result;
+}
+
+// main thread builds into its arena (advanced after beginFrame, the render thread is done with
+// the frame before last by then); the render thread draws and formats names into its own arena
+// ------------------------------------------------------------------------
+Result runRenderThread(Scene &scene, HeadlessContext &context)
+{
+    Result result;
+    FrameArena frameArena, renderArena;
+    context.release();
+    RenderThread<FrameData> renderer;
+    RenderThread<FrameData>::Hooks hooks;
+    hooks.init = [&] { return context.makeCurrent(); };
+    hooks.render = [&](const FrameData &frame) { scene.draw(frame.items, frame.count, frame.lights, renderArena); };
+    hooks.present = [&] {
+        context.swapBuffers();
+        glFinish();
+        renderArena.nextFrame();
+    };
+    hooks.shutdown = [&] { context.release(); };
+    if (!renderer.start(hooks))
+    {
+        std::cout << "ERROR::BENCH::RENDER_THREAD_START_FAILED" << std::endl;
+        return result;
+    }
+    unsigned long long allocations = 0, bytes = 0;
+    Clock::time_point start;
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        if (frame == WARMUP)
+        {
+            allocations = AllocCounter::allocations();
+            bytes = AllocCounter::bytes();
+            start = Clock::now();
+        }
+        FrameData &data = renderer.beginFrame();
+        frameArena.nextFrame();
+        Clock::time_point buildStart = Clock::now();
+        DrawItem *items = frameArena.allocateArray<DrawItem>(OBJECTS);
+        for (int i = 0; i < OBJECTS; i++)
+            objectAt(frame, i, items[i]);
+        std::sort(items, items + OBJECTS, backToFront);
+        data.items = items;
+        data.count = OBJECTS;
+        for (int l = 0; l < LIGHTS; l++)
+            data.lights[l] = lightAt(frame, l);
+        if (frame >= WARMUP)
+            result.buildMs += msSince(buildStart);
+        renderer.submitFrame();
+    }
+    // the last frame may not be drawn yet: queue an empty one behind it and wait until that can start
+    FrameData &empty = renderer.beginFrame();
+    empty.count = 0;
+    renderer.submitFrame();
+    renderer.beginFrame();
+    result.frameMs = msSince(start) / (FRAMES - WARMUP);
+    result.buildMs /= FRAMES - WARMUP;
+    result.allocations = AllocCounter::allocations() - allocations;
+    result.bytes = AllocCounter::bytes() - bytes;
+    renderer.stop();
+    context.makeCurrent();
+    return result;
+}
+
+void printResult(const char *name, const Result &result)
+{
+    int frames = FRAMES - WARMUP;
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-14s %10.2f %12.0f %10.3f %10.3f",
+                  name, (double)result.allocations / frames, (double)result.bytes / frames, result.buildMs, result.frameMs);
+    std::cout << line << "\n";
+}
+
+bool writeFile(const std::string &path, const char *text)
+{
+    std::ofstream file(path, std::ios::binary);
+    file << text;
+    return (bool)file;
+}
+
+int main()
+{
+    if (!AllocCounter::installed())
+        return -1;
+    HeadlessContext context;
+    if (!context.create(256, 256))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("frame_arena_" + std::to_string(getpid()));
+    std::filesystem::create_directories(directory);
+    std::string vertexPath = (directory / "shader.vs").string(), fragmentPath = (directory / "shader.fs").string();
+    Scene scene;
+    bool ok = writeFile(vertexPath, vertexShaderSource) && writeFile(fragmentPath, fragmentShaderSource)
+              && scene.create(vertexPath, fragmentPath);
+    std::filesystem::remove_all(directory);
+    if (!ok)
+    {
+        std::cout << "ERROR::BENCH::SHADER_SETUP_FAILED" << std::endl;
+        return -1;
+    }
+
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << ", " << OBJECTS << " draw items and "
+              << OBJECTS * 3 + LIGHTS << " uniform updates per frame, " << FRAMES - WARMUP << " frames after " << WARMUP << " warm-up\n\n";
+    std::cout << "loop           allocs/frame  bytes/frame   build ms   frame ms\n";
+    Result heap = runHeap(scene, context);
+    printResult("heap", heap);
+    Result arena = runArena(scene, context);
+    printResult("frame arena", arena);
+    Result threaded = runRenderThread(scene, context);
+    printResult("render thread", threaded);
+    scene.destroy();
+
+    bool steady = arena.allocations == 0 && threaded.allocations == 0;
+    std::cout << "\nsteady state: " << (steady ? "no heap allocations" : "ERROR::BENCH::STEADY_STATE_ALLOCATES") << "\n";
+    return steady ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+// Frame pacing modes (render/frame_pacer.h) on the RenderThread loop from main.cpp:
+// uncapped, vsync, a LIMIT_FPS limiter and low-latency input sampling.
+//
+// The display is simulated as in bench/render_thread.cpp: with swap interval 1, present()
+// waits for the next vblank of a REFRESH_HZ display after glFinish. GPU time comes from
+// GpuTimer queries around the draw; llvmpipe rasterises on glFinish rather than when the draw
+// is issued, so the render time given to the pacer runs up to glFinish returning. Latency is
+// input sample -> present, pacing the interval between presents.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/frame_pacing.cpp glad.c -o bench_frame_pacing -lEGL -ldl -lpthread
+#include <glad/glad.h>
+#include <render/frame_pacer.h>
+#include <render/gpu_timer.h>
+#include <render/headless_context.h>
+#include <render/render_thread.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int FRAMES = 240;
+    const double REFRESH_HZ = 60.0;
+    const double LIMIT_FPS = 50.0;
+    const double EVENTS_MS = 0.3;
+    const double UPDATE_MS = 1.0;  // simulation, busy
+    const int TRIANGLES = 500;     // render work per frame
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "uniform float offset;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos.x + offset, aPos.yz, 1.0);\n"
+    "   ourColor = aColor;\n"
+    "}\0";
+
+    const char *fragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "in vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0);\n"
+    "}\0";
+
+typedef std::chrono::steady_clock Clock;
+
+struct FrameData
+{
+    float offset = 0.0f;
+};
+
+struct Scene
+{
+    unsigned int program = 0, VAO = 0, VBO = 0;
+    int offsetLocation = -1;
+    GpuTimer timer;
+    Clock::time_point epoch = Clock::now();
+
+    void create()
+    {
+        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+        glCompileShader(vertexShader);
+        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+        glCompileShader(fragmentShader);
+        program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        offsetLocation = glGetUniformLocation(program, "offset");
+
+        std::vector<float> vertices;
+        for (int i = 0; i < TRIANGLES; i++)
+        {
+            float x = -1.0f + 2.0f * (i % 50) / 50.0f, y = -1.0f + 2.0f * (i / 50) / (TRIANGLES / 50.0f);
+            float triangle[] = {
+                x, y, 0.0f, 1.0f, 0.0f, 0.0f,
+                x + 0.1f, y, 0.0f, 0.0f, 1.0f, 0.0f,
+                x + 0.05f, y + 0.1f, 0.0f, 0.0f, 0.0f, 1.0f
+            };
+            vertices.insert(vertices.end(), triangle, triangle + 18);
+        }
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        timer.create();
+    }
+    void destroy()
+    {
+        timer.destroy();
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteProgram(program);
+    }
+    void render(const FrameData &frame)
+    {
+        timer.begin();
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(program);
+        glUniform1f(offsetLocation, frame.offset);
+        glBindVertexArray(VAO);
+        glDrawArrays(GL_TRIANGLES, 0, TRIANGLES * 3);
+        timer.end();
+    }
+    // swap and wait for the GPU
+    // ------------------------------------------------------------------------
+    void finish(HeadlessContext &context)
+    {
+        context.swapBuffers();
+        glFinish();
+    }
+    // swap interval 1: the swap returns at the next simulated vblank
+    // ------------------------------------------------------------------------
+    void waitForVblank()
+    {
+        double period = 1.0 / REFRESH_HZ;
+        double since = std::chrono::duration<double>(Clock::now() - epoch).count();
+        double next = std::ceil(since / period) * period;
+        std::this_thread::sleep_until(epoch + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(next)));
+    }
+};
+
+void pollEvents()
+{
+    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(EVENTS_MS));
+}
+
+void update(FrameData &frame, int index)
+{
+    Clock::time_point end = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(UPDATE_MS));
+    while (Clock::now() < end)
+        ;
+    frame.offset = 0.01f * (index % 50);
+}
+
+bool run(HeadlessContext &context, FramePacer &pacer)
+{
+    Scene scene;
+    Clock::time_point renderStart;
+    double gpuSeconds = 0.0;
+    RenderThread<FrameData> renderer;
+    RenderThread<FrameData>::Hooks hooks;
+    hooks.init = [&] {
+        if (!context.makeCurrent())
+            return false;
+        scene.create();
+        return true;
+    };
+    hooks.render = [&](const FrameData &frame) {
+        renderStart = Clock::now();
+        scene.render(frame);
+    };
+    hooks.present = [&] {
+        scene.finish(context);
+        double renderSeconds = std::chrono::duration<double>(Clock::now() - renderStart).count();
+        if (pacer.swapInterval())
+            scene.waitForVblank();
+        scene.timer.poll(gpuSeconds);
+        pacer.framePresented(renderSeconds, gpuSeconds);
+    };
+    hooks.shutdown = [&] {
+        scene.destroy();
+        context.release();
+    };
+    if (!renderer.start(hooks))
+    {
+        std::cout << "ERROR::BENCH::RENDER_THREAD_START_FAILED" << std::endl;
+        return false;
+    }
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < FRAMES; i++)
+    {
+        FrameData &frame = renderer.beginFrame();
+        pacer.waitForInput();
+        pollEvents();
+        Clock::time_point inputTime = Clock::now();
+        update(frame, i);
+        renderer.submitFrame(inputTime);
+        pacer.frameSubmitted();
+    }
+    renderer.stop();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout << FramePacer::modeName(pacer.mode()) << ": " << std::fixed << std::setprecision(1)
+              << FRAMES / seconds << " fps\n" << std::defaultfloat;
+    renderer.latency().print(std::cout, "  input -> present");
+    renderer.pacing().print(std::cout, "  present interval");
+    pacer.inputDelay().print(std::cout, "  input delay");
+    pacer.renderTime().print(std::cout, "  render (CPU)");
+    pacer.gpuTime().print(std::cout, "  render (GPU)");
+    if (pacer.swapInterval())
+        std::cout << "  missed vblanks: " << renderer.pacing().countAbove(1.5 / REFRESH_HZ) << " of " << renderer.pacing().count() << " frames\n";
+    std::cout << "\n";
+    return true;
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(400, 300))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << ", " << FRAMES << " frames per mode, display at "
+              << REFRESH_HZ << " Hz, limiter at " << LIMIT_FPS << " fps\n\n";
+    context.release();
+
+    FramePacer uncapped(FramePacer::UNCAPPED), vsync(FramePacer::VSYNC, REFRESH_HZ),
+               limited(FramePacer::LIMITED, LIMIT_FPS), lowLatency(FramePacer::LOW_LATENCY, REFRESH_HZ);
+    for (FramePacer *pacer : { &uncapped, &vsync, &limited, &lowLatency })
+        if (!run(context, *pacer))
+            return -1;
+    return 0;
+}
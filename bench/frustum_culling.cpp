@@ -0,0 +1,250 @@
+// View-frustum culling (scene/frustum_culler.h) in two parts.
+//
+// Throughput: OBJECTS boxes scattered through a cube around the camera, culled as boxes and as
+// spheres for VIEWS camera directions, scalar, AVX2 and AVX2 on every thread, in objects tested
+// per millisecond. The AVX2 lists must equal the scalar ones, and no box with a corner inside
+// the view volume may be culled.
+//
+// Frame time: SCENE_OBJECTS boxes in a shell around the camera, drawn instanced (CityRenderer),
+// so that about 90% of them are off screen whichever way it looks. Each of FRAMES frames is
+// drawn with every object submitted and again with only the ones the culler kept, to glFinish.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/frustum_culling.cpp glad.c -o bench_frustum_culling -lEGL -ldl -lpthread
+#include <glad/glad.h>
+#include <core/job_system.h>
+#include <math/matrix.h>
+#include <render/city_renderer.h>
+#include <render/headless_context.h>
+#include <scene/camera.h>
+#include <scene/city_scene.h>
+#include <scene/frustum_culler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int WIDTH = 1280;
+    const int HEIGHT = 720;
+    const int OBJECTS = 1000000;
+    const float WORLD_SIZE = 2000.0f;   // the throughput objects fill a cube this wide
+    const int VIEWS = 16;
+    const int REPEATS = 5;              // culls of each view per timing
+    const int SCENE_OBJECTS = 10000;
+    const float SHELL_INNER = 30.0f;    // the frame-time objects are this far from the camera or more
+    const float SHELL_OUTER = 300.0f;
+    const int FRAMES = 20;
+    const float CLEAR_COLOR[4] = { 0.55f, 0.7f, 0.85f, 1.0f };
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// camera at the origin, turned a step further each view
+// ------------------------------------------------------------------------
+void viewProjection(int view, int views, float out[16])
+{
+    Camera camera;
+    camera.aspect = (float)WIDTH / HEIGHT;
+    camera.nearPlane = 0.5f;
+    camera.farPlane = WORLD_SIZE;
+    camera.yaw = 6.2831853f * view / views;
+    camera.pitch = 0.6f * std::sin(3.0f * view / views);
+    camera.viewProjection(out);
+}
+
+// a box with a corner strictly inside the view volume (which the culler must keep)
+// ------------------------------------------------------------------------
+bool cornerInside(const float vp[16], const CityScene::Building &b)
+{
+    math::mat4 m = math::mat4::fromArray(vp);
+    for (int c = 0; c < 8; c++)
+    {
+        math::vec4 corner((c & 1) ? b.max[0] : b.min[0], (c & 2) ? b.max[1] : b.min[1], (c & 4) ? b.max[2] : b.min[2], 1.0f);
+        math::vec4 clip = m * corner;
+        float w = clip.w * 0.999f;
+        if (std::fabs(clip.x) < w && std::fabs(clip.y) < w && std::fabs(clip.z) < w)
+            return true;
+    }
+    return false;
+}
+
+void clear(const float *color)
+{
+    glClearColor(color[0], color[1], color[2], color[3]);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(WIDTH, HEIGHT))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    JobSystem jobs;
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    // throughput
+    // ________________________________________________________________________
+    std::vector<CityScene::Building> objects(OBJECTS);
+    FrustumCuller single, threaded(&jobs);
+    single.reserve(OBJECTS);
+    threaded.reserve(OBJECTS);
+    for (CityScene::Building &b : objects)
+    {
+        float size = 1.0f + 9.0f * unit(random);
+        for (int i = 0; i < 3; i++)
+        {
+            b.min[i] = (unit(random) - 0.5f) * WORLD_SIZE;
+            b.max[i] = b.min[i] + size * (0.5f + unit(random));
+        }
+        single.add(b.min, b.max);
+        threaded.add(b.min, b.max);
+    }
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << "\n"
+              << OBJECTS << " objects, " << VIEWS << " views, " << jobs.threadCount() << " threads, AVX2 "
+              << (single.simdSupported() ? "on" : "not supported") << "\n\n";
+
+    bool ok = true;
+    std::vector<uint32_t> expected(OBJECTS), visible(OBJECTS);
+    size_t wronglyCulled = 0, listMismatches = 0;
+    for (int v = 0; v < VIEWS; v++)
+    {
+        float vp[16];
+        viewProjection(v, VIEWS, vp);
+        for (int volume = 0; volume < 2; volume++)
+        {
+            single.setSimd(false);
+            size_t count = single.cull(vp, expected.data(), (FrustumCuller::Volume)volume);
+            single.setSimd(true);
+            size_t simdCount = single.cull(vp, visible.data(), (FrustumCuller::Volume)volume);
+            listMismatches += simdCount != count || !std::equal(expected.begin(), expected.begin() + count, visible.begin());
+            simdCount = threaded.cull(vp, visible.data(), (FrustumCuller::Volume)volume);
+            listMismatches += simdCount != count || !std::equal(expected.begin(), expected.begin() + count, visible.begin());
+            if (volume == FrustumCuller::BOXES && v == 0)
+            {
+                size_t next = 0;
+                for (size_t i = 0; i < (size_t)OBJECTS; i++)
+                {
+                    if (next < count && expected[next] == i)
+                        next++;
+                    else
+                        wronglyCulled += cornerInside(vp, objects[i]);
+                }
+            }
+        }
+    }
+    std::cout << "lists differing from the scalar path: " << listMismatches << ", boxes in view culled: " << wronglyCulled << "\n\n";
+    ok = listMismatches == 0 && wronglyCulled == 0;
+
+    char line[200];
+    std::snprintf(line, sizeof(line), "%-24s %8s %12s %12s %10s\n", "", "threads", "ms/cull", "objects/ms", "kept");
+    std::cout << line;
+    for (int volume = 0; volume < 2; volume++)
+        for (int path = 0; path < 3; path++)
+        {
+            if (path > 0 && !single.simdSupported())
+                break;
+            FrustumCuller &culler = path == 2 ? threaded : single;
+            culler.setSimd(path > 0);
+            size_t kept = 0;
+            Clock::time_point start = Clock::now();
+            for (int r = 0; r < REPEATS; r++)
+                for (int v = 0; v < VIEWS; v++)
+                {
+                    float vp[16];
+                    viewProjection(v, VIEWS, vp);
+                    kept += culler.cull(vp, visible.data(), (FrustumCuller::Volume)volume);
+                }
+            double ms = millisecondsSince(start) / (REPEATS * VIEWS);
+            const char *names[2][3] = { { "boxes, scalar", "boxes, AVX2", "boxes, AVX2 threaded" },
+                                        { "spheres, scalar", "spheres, AVX2", "spheres, AVX2 threaded" } };
+            std::snprintf(line, sizeof(line), "%-24s %8u %12.3f %12.0f %9.2f%%\n", names[volume][path], path == 2 ? jobs.threadCount() : 1u,
+                          ms, OBJECTS / ms, 100.0 * kept / ((double)OBJECTS * REPEATS * VIEWS));
+            std::cout << line;
+        }
+    std::cout << "\n";
+
+    // frame time
+    // ________________________________________________________________________
+    CityScene scene;
+    scene.buildings.resize(SCENE_OBJECTS);
+    FrustumCuller sceneCuller(&jobs);
+    for (CityScene::Building &b : scene.buildings)
+    {
+        float direction[3], length = 0.0f;
+        do
+        {
+            length = 0.0f;
+            for (int i = 0; i < 3; i++)
+            {
+                direction[i] = unit(random) * 2.0f - 1.0f;
+                length += direction[i] * direction[i];
+            }
+        } while (length > 1.0f || length < 1e-4f);
+        float distance = SHELL_INNER + (SHELL_OUTER - SHELL_INNER) * std::cbrt(unit(random)), size = 1.0f + 3.0f * unit(random);
+        for (int i = 0; i < 3; i++)
+        {
+            b.min[i] = direction[i] / std::sqrt(length) * distance - size * 0.5f;
+            b.max[i] = b.min[i] + size;
+            b.color[i] = 0.3f + 0.6f * unit(random);
+        }
+        sceneCuller.add(b.min, b.max);
+    }
+    CityRenderer renderer;
+    if (!renderer.create(scene.buildings.size()))
+        return -1;
+    glViewport(0, 0, WIDTH, HEIGHT);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+    std::vector<uint32_t> list(SCENE_OBJECTS);
+    double allMs = 0.0, culledMs = 0.0;
+    size_t kept = 0;
+    for (int frame = -1; frame < FRAMES; frame++) // frame -1 warms up the driver
+    {
+        float vp[16];
+        viewProjection(std::max(frame, 0), FRAMES, vp);
+        clear(CLEAR_COLOR);
+        glFinish();
+        Clock::time_point start = Clock::now();
+        renderer.draw(scene, vp, nullptr, 0);
+        glFinish();
+        double all = millisecondsSince(start);
+
+        clear(CLEAR_COLOR);
+        glFinish();
+        start = Clock::now();
+        size_t count = sceneCuller.cull(vp, list.data());
+        renderer.draw(scene, vp, list.data(), count);
+        glFinish();
+        double culled = millisecondsSince(start);
+        if (frame < 0)
+            continue;
+        allMs += all;
+        culledMs += culled;
+        kept += count;
+    }
+    std::snprintf(line, sizeof(line), "%d objects, %.1f%% off screen\n%-28s %10.2f ms/frame\n%-28s %10.2f ms/frame\n%-28s %10.2f ms/frame (%.0f%%)\n",
+                  SCENE_OBJECTS, 100.0 - 100.0 * kept / ((double)SCENE_OBJECTS * FRAMES), "draw all", allMs / FRAMES,
+                  "cull + draw visible", culledMs / FRAMES, "frame time change", (culledMs - allMs) / FRAMES, 100.0 * (culledMs - allMs) / allMs);
+    std::cout << line;
+    renderer.destroy();
+    if (!ok)
+        std::cout << "ERROR::BENCH::FRUSTUM_CULLING_MISMATCH\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,398 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Minimal Google Benchmark style harness for bench/bench.cpp: register functions with
+// BENCHMARK / BENCHMARK_ARG, time them with an adaptive iteration count, print a table,
+// write Google Benchmark compatible JSON and compare against a stored baseline.
+//
+//   void BM_thing(bench::State &state) { while (state.keepRunning()) { ... } }
+//   BENCHMARK(BM_thing);
+namespace bench
+{
+
+class State
+{
+public:
+    State(long long iterations, long long arg)
+        : total(iterations), remaining(iterations), argument(arg) {}
+
+    // true while iterations remain; the clock runs from the first call to the last
+    // ------------------------------------------------------------------------
+    bool keepRunning()
+    {
+        if (!started)
+        {
+            started = true;
+            resumeTiming();
+        }
+        if (remaining-- > 0)
+            return true;
+        pauseTiming();
+        return false;
+    }
+    // exclude per-iteration setup from the measurement
+    // ------------------------------------------------------------------------
+    void pauseTiming()
+    {
+        if (!running)
+            return;
+        realSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart).count();
+        cpuSeconds += cpuNow() - cpuStart;
+        running = false;
+    }
+    void resumeTiming()
+    {
+        realStart = std::chrono::steady_clock::now();
+        cpuStart = cpuNow();
+        running = true;
+    }
+
+    long long iterations() const { return total; }
+    long long arg() const { return argument; }
+    void setBytesProcessed(long long bytes) { bytesProcessed = bytes; }
+    void setItemsProcessed(long long items) { itemsProcessed = items; }
+    void skipWithError(const std::string &message) { error = message; remaining = 0; }
+
+    double realSeconds = 0.0;
+    double cpuSeconds = 0.0;
+    long long bytesProcessed = 0;
+    long long itemsProcessed = 0;
+    std::string error;
+
+private:
+    static double cpuNow()
+    {
+        timespec ts;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+    }
+
+    long long total;
+    long long remaining;
+    long long argument;
+    bool started = false;
+    bool running = false;
+    std::chrono::steady_clock::time_point realStart;
+    double cpuStart = 0.0;
+};
+
+struct Benchmark
+{
+    std::string name;
+    void (*function)(State&);
+    long long argument;
+};
+
+inline std::vector<Benchmark> &registry()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+inline int registerBenchmark(const char *name, void (*function)(State&), long long argument = -1)
+{
+    std::string fullName = name;
+    if (argument >= 0)
+        fullName += "/" + std::to_string(argument);
+    registry().push_back(Benchmark{ fullName, function, argument });
+    return 0;
+}
+
+#define BENCH_CONCAT_(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_(a, b)
+#define BENCHMARK(fn) static int BENCH_CONCAT(bench_registered_, __LINE__) = ::bench::registerBenchmark(#fn, fn)
+#define BENCHMARK_ARG(fn, a) static int BENCH_CONCAT(bench_registered_, __LINE__) = ::bench::registerBenchmark(#fn, fn, a)
+
+struct Options
+{
+    std::string filter;
+    std::string jsonPath;
+    std::string baselinePath;
+    double minTime = 0.5;    // seconds per repetition
+    int repetitions = 5;
+    double threshold = 0.10; // allowed slowdown against the baseline
+};
+
+struct Result
+{
+    std::string name;
+    long long iterations = 0;
+    double realNs = 0.0;    // median over repetitions, per iteration
+    double realNsMin = 0.0;
+    double cpuNs = 0.0;
+    double bytesPerSecond = 0.0;
+    double itemsPerSecond = 0.0;
+    std::string error;
+};
+
+// one call of the benchmark; an exception it throws becomes its error
+// ------------------------------------------------------------------------
+inline void invoke(const Benchmark &benchmark, State &state)
+{
+    try
+    {
+        benchmark.function(state);
+    }
+    catch (const std::exception &e)
+    {
+        state.skipWithError(std::string("exception: ") + e.what());
+    }
+    catch (...)
+    {
+        state.skipWithError("unknown exception");
+    }
+}
+
+// grow the iteration count until one run takes minTime, then repeat and keep the median
+// ------------------------------------------------------------------------
+inline Result run(const Benchmark &benchmark, const Options &options)
+{
+    Result result;
+    result.name = benchmark.name;
+    long long iterations = 1;
+    for (;;)
+    {
+        State state(iterations, benchmark.argument);
+        invoke(benchmark, state);
+        if (!state.error.empty())
+        {
+            result.error = state.error;
+            return result;
+        }
+        if (state.realSeconds >= options.minTime || iterations >= 1000000000)
+            break;
+        double scale = state.realSeconds > 0.0 ? options.minTime * 1.4 / state.realSeconds : 10.0;
+        iterations = (long long)(iterations * std::min(10.0, std::max(2.0, scale)));
+    }
+    std::vector<double> real, cpu, bytes, items;
+    for (int r = 0; r < options.repetitions; r++)
+    {
+        State state(iterations, benchmark.argument);
+        invoke(benchmark, state);
+        if (!state.error.empty())
+        {
+            result.error = state.error;
+            return result;
+        }
+        real.push_back(state.realSeconds / iterations);
+        cpu.push_back(state.cpuSeconds / iterations);
+        bytes.push_back(state.realSeconds > 0.0 ? state.bytesProcessed / state.realSeconds : 0.0);
+        items.push_back(state.realSeconds > 0.0 ? state.itemsProcessed / state.realSeconds : 0.0);
+    }
+    std::vector<double> sorted = real;
+    std::sort(sorted.begin(), sorted.end());
+    size_t median = std::find(real.begin(), real.end(), sorted[sorted.size() / 2]) - real.begin();
+    result.iterations = iterations;
+    result.realNs = real[median] * 1e9;
+    result.realNsMin = sorted[0] * 1e9;
+    result.cpuNs = cpu[median] * 1e9;
+    result.bytesPerSecond = bytes[median];
+    result.itemsPerSecond = items[median];
+    return result;
+}
+
+inline std::string humanRate(double perSecond, const char *unit)
+{
+    const char *prefixes[] = { "", "k", "M", "G", "T" };
+    int p = 0;
+    while (perSecond >= 1000.0 && p < 4)
+    {
+        perSecond /= 1000.0;
+        p++;
+    }
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2) << perSecond << " " << prefixes[p] << unit << "/s";
+    return out.str();
+}
+
+inline std::string escape(const std::string &text)
+{
+    std::string out;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        if ((unsigned char)c >= 0x20)
+            out += c;
+    }
+    return out;
+}
+
+// same layout as Google Benchmark's --benchmark_out, so its tools/compare.py can read it too
+// ------------------------------------------------------------------------
+inline bool writeJson(const std::string &path, const std::vector<Result> &results, const std::map<std::string, std::string> &context)
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+    out << "{\n  \"context\": {\n";
+    for (std::map<std::string, std::string>::const_iterator it = context.begin(); it != context.end(); ++it)
+        out << "    \"" << escape(it->first) << "\": \"" << escape(it->second) << "\",\n";
+    out << "    \"time_unit\": \"ns\"\n  },\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result &r = results[i];
+        out << "    {\n      \"name\": \"" << escape(r.name) << "\",\n      \"run_name\": \"" << escape(r.name) << "\",\n"
+            << "      \"run_type\": \"iteration\",\n";
+        if (!r.error.empty())
+            out << "      \"error_occurred\": true,\n      \"error_message\": \"" << escape(r.error) << "\",\n";
+        out << std::setprecision(10)
+            << "      \"iterations\": " << r.iterations << ",\n"
+            << "      \"real_time\": " << r.realNs << ",\n"
+            << "      \"real_time_min\": " << r.realNsMin << ",\n"
+            << "      \"cpu_time\": " << r.cpuNs << ",\n"
+            << "      \"time_unit\": \"ns\"";
+        if (r.bytesPerSecond > 0.0)
+            out << ",\n      \"bytes_per_second\": " << r.bytesPerSecond;
+        if (r.itemsPerSecond > 0.0)
+            out << ",\n      \"items_per_second\": " << r.itemsPerSecond;
+        out << "\n    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+    return (bool)out;
+}
+
+// name -> real_time from a file written by writeJson (or by Google Benchmark, in ns)
+// ------------------------------------------------------------------------
+inline bool readBaseline(const std::string &path, std::map<std::string, double> &baseline)
+{
+    std::ifstream in(path);
+    if (!in)
+        return false;
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+    size_t position = 0;
+    while ((position = text.find("\"name\":", position)) != std::string::npos)
+    {
+        size_t open = text.find('"', position + 7);
+        size_t close = text.find('"', open + 1);
+        size_t next = text.find("\"name\":", close);
+        size_t time = text.find("\"real_time\":", close);
+        if (open == std::string::npos || close == std::string::npos)
+            break;
+        if (time != std::string::npos && time < next)
+            baseline[text.substr(open + 1, close - open - 1)] = std::strtod(text.c_str() + time + 12, NULL);
+        position = close;
+    }
+    return true;
+}
+
+// prints one line per benchmark present in both; returns the number of regressions
+// ------------------------------------------------------------------------
+inline int compare(const std::vector<Result> &results, const std::map<std::string, double> &baseline, double threshold, std::ostream &out)
+{
+    int regressions = 0;
+    out << "\n" << std::left << std::setw(40) << "benchmark (vs baseline)" << std::right << std::setw(14) << "baseline ns"
+        << std::setw(14) << "current ns" << std::setw(10) << "change" << "\n";
+    for (const Result &r : results)
+    {
+        std::map<std::string, double>::const_iterator it = baseline.find(r.name);
+        if (it == baseline.end() || it->second <= 0.0 || !r.error.empty())
+            continue;
+        double change = r.realNs / it->second - 1.0;
+        bool regressed = change > threshold;
+        regressions += regressed;
+        out << std::left << std::setw(40) << r.name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(14) << it->second << std::setw(14) << r.realNs << std::setw(9) << std::showpos << change * 100.0
+            << std::noshowpos << "%" << (regressed ? "  REGRESSION" : "") << "\n";
+    }
+    out << std::defaultfloat;
+    if (regressions)
+        out << "ERROR::BENCH::" << regressions << " benchmark(s) slower than the baseline by more than "
+            << std::fixed << std::setprecision(1) << threshold * 100.0 << "%\n" << std::defaultfloat;
+    return regressions;
+}
+
+inline bool parseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        size_t equals = arg.find('=');
+        std::string key = arg.substr(0, equals);
+        std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+        if (key == "--filter")
+            options.filter = value;
+        else if (key == "--json")
+            options.jsonPath = value;
+        else if (key == "--baseline")
+            options.baselinePath = value;
+        else if (key == "--min-time")
+            options.minTime = std::atof(value.c_str());
+        else if (key == "--repetitions")
+            options.repetitions = std::max(1, std::atoi(value.c_str()));
+        else if (key == "--threshold")
+            options.threshold = std::atof(value.c_str());
+        else
+        {
+            std::cout << "usage: " << argv[0] << " [--filter=substring] [--json=out.json] [--baseline=baseline.json]\n"
+                      << "       [--threshold=0.10] [--min-time=0.5] [--repetitions=5]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// run everything registered that matches the filter; exit status is non-zero when a benchmark
+// errored or threw, when --baseline names a file that can't be read and on regressions
+// ------------------------------------------------------------------------
+inline int runAll(const Options &options, const std::map<std::string, std::string> &context)
+{
+    std::vector<Result> results;
+    int errors = 0;
+    std::cout << std::left << std::setw(40) << "benchmark" << std::right << std::setw(14) << "time ns" << std::setw(14)
+              << "cpu ns" << std::setw(12) << "iterations" << "  rate\n";
+    for (const Benchmark &benchmark : registry())
+    {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+            continue;
+        Result r = run(benchmark, options);
+        results.push_back(r);
+        std::cout << std::left << std::setw(40) << r.name << std::right;
+        if (!r.error.empty())
+        {
+            std::cout << "  ERROR: " << r.error << "\n";
+            errors++;
+            continue;
+        }
+        std::cout << std::fixed << std::setprecision(1) << std::setw(14) << r.realNs << std::setw(14) << r.cpuNs
+                  << std::setw(12) << r.iterations << "  "
+                  << (r.bytesPerSecond > 0.0 ? humanRate(r.bytesPerSecond, "B") + " " : "")
+                  << (r.itemsPerSecond > 0.0 ? humanRate(r.itemsPerSecond, "items") : "") << "\n" << std::defaultfloat;
+    }
+    if (!options.jsonPath.empty() && !writeJson(options.jsonPath, results, context))
+    {
+        std::cout << "ERROR::BENCH::CANNOT_WRITE " << options.jsonPath << std::endl;
+        return 2;
+    }
+    if (errors)
+        std::cout << "ERROR::BENCH::" << errors << " benchmark(s) failed" << std::endl;
+    if (options.baselinePath.empty())
+        return errors ? 1 : 0;
+    std::map<std::string, double> baseline;
+    if (!readBaseline(options.baselinePath, baseline))
+    {
+        std::cout << "ERROR::BENCH::NO_BASELINE " << options.baselinePath << " (record one with --json)" << std::endl;
+        return 1;
+    }
+    return compare(results, baseline, options.threshold, std::cout) || errors ? 1 : 0;
+}
+
+} // namespace bench
+#endif
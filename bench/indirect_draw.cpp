@@ -0,0 +1,139 @@
+// CPU submission cost of 10k small indexed draws per frame:
+// one glDrawElementsInstancedBaseVertex per draw vs. glMultiDrawElementsBaseVertex vs.
+// glMultiDrawElementsIndirect from a CPU-built command buffer (IndirectDrawList).
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/indirect_draw.cpp glad.c -o bench_indirect_draw -lEGL -ldl
+#include <glad/glad.h>
+#include <render/headless_context.h>
+#include <render/indirect_draw.h>
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int DRAWS = 10000;
+    const int FRAMES = 100;
+    const int GRID = 100; // DRAWS quads laid out GRID x GRID
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos, 1.0);\n"
+    "   ourColor = aColor;\n"
+    "}\0";
+
+    const char *fragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "in vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0);\n"
+    "}\0";
+
+unsigned int buildProgram()
+{
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    return program;
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(256, 256))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << ", ARB_multi_draw_indirect: "
+              << (IndirectDrawList::indirectSupported() ? "yes" : "no") << "\n";
+
+    // one small coloured quad per object, all in one VBO/EBO; each draw uses baseVertex to pick its quad
+    std::vector<float> vertices;
+    std::vector<unsigned short> indices = { 0, 1, 2, 0, 2, 3 };
+    float size = 2.0f / GRID;
+    for (int i = 0; i < DRAWS; i++)
+    {
+        float x = -1.0f + (i % GRID) * size, y = -1.0f + (i / GRID) * size;
+        float quad[] = {
+            x,               y,               0.0f, 1.0f, 0.0f, 0.0f,
+            x + size * 0.8f, y,               0.0f, 0.0f, 1.0f, 0.0f,
+            x + size * 0.8f, y + size * 0.8f, 0.0f, 0.0f, 0.0f, 1.0f,
+            x,               y + size * 0.8f, 0.0f, 1.0f, 1.0f, 0.0f
+        };
+        vertices.insert(vertices.end(), quad, quad + 24);
+    }
+    unsigned int VAO, VBO, EBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned short), indices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    unsigned int program = buildProgram();
+    glUseProgram(program);
+
+    const char *names[] = { "glMultiDrawElementsIndirect", "glMultiDrawElementsBaseVertex", "separate draws" };
+    std::cout << std::left << std::setw(32) << "path" << std::right << std::setw(18) << "submit ms/10k" << std::setw(16) << "frame ms" << "\n";
+    for (int p = IndirectDrawList::MULTI_DRAW_INDIRECT; p < IndirectDrawList::PATH_COUNT; p++)
+    {
+        IndirectDrawList list;
+        list.setPath((IndirectDrawList::Path)p);
+        if (list.currentPath() != p)
+        {
+            std::cout << std::left << std::setw(32) << names[p] << "unsupported\n";
+            continue;
+        }
+        double submitSeconds = 0.0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < FRAMES; frame++)
+        {
+            glClear(GL_COLOR_BUFFER_BIT);
+            // the scene is rebuilt every frame, as culling would
+            list.clear();
+            for (int i = 0; i < DRAWS; i++)
+                list.add(6, 0, i * 4);
+            std::chrono::steady_clock::time_point submitStart = std::chrono::steady_clock::now();
+            list.submit(GL_TRIANGLES, GL_UNSIGNED_SHORT);
+            submitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - submitStart).count();
+            context.swapBuffers();
+        }
+        glFinish();
+        double total = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << std::left << std::setw(32) << names[p] << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(18) << submitSeconds * 1000.0 / FRAMES * (10000.0 / DRAWS)
+                  << std::setw(16) << total * 1000.0 / FRAMES << "\n";
+    }
+
+    glDeleteProgram(program);
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(1, &EBO);
+    glDeleteVertexArrays(1, &VAO);
+    return 0;
+}
@@ -0,0 +1,143 @@
+// Work-stealing JobSystem scaling on a synthetic frame of JOBS independent jobs (each a
+// small, fixed amount of ALU work) vs. a plain serial loop: one job per item under a frame
+// root, and the same work through parallelFor. Also reports the per-job scheduling overhead
+// with empty jobs.
+//
+// Checks: both ways must leave the serial loop's results, and the JobSystems must shut down
+// cleanly. Exits non-zero if not. --quick (what ctest runs) does QUICK_JOBS jobs for QUICK_FRAMES
+// frames.
+//
+// g++ -std=c++17 -O2 -Iinclude bench/job_system.cpp -o bench_job_system -lpthread
+// ./bench_job_system [--quick]
+#include <core/job_system.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int JOBS = 100000;
+    const int FRAMES = 20;
+    const int WORK = 200;      // inner iterations per job (about a microsecond)
+    const size_t GRAIN = 64;   // parallelFor piece size
+    const int QUICK_JOBS = 10000;
+    const int QUICK_FRAMES = 2;
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+std::vector<float> results(JOBS);
+
+inline void work(int item)
+{
+    float x = item * 0.001f, sum = 0.0f;
+    for (int i = 0; i < WORK; i++)
+    {
+        x = x * 1.0001f + 0.5f;
+        sum += x - std::floor(x);
+    }
+    results[item] = sum;
+}
+
+void workJob(JobSystem&, JobSystem::Job *job)
+{
+    work(job->dataAs<int>());
+}
+
+double checksum()
+{
+    double sum = 0.0;
+    for (float r : results)
+        sum += r;
+    return sum;
+}
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int jobCount = JOBS, frames = FRAMES;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--quick") != 0)
+        {
+            std::cout << "usage: bench_job_system [--quick]" << std::endl;
+            return 1;
+        }
+        jobCount = QUICK_JOBS;
+        frames = QUICK_FRAMES;
+    }
+
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << hardware << " hardware threads, " << jobCount << " jobs per frame, " << frames << " frames\n\n";
+
+    Clock::time_point start = Clock::now();
+    for (int f = 0; f < frames; f++)
+        for (int i = 0; i < jobCount; i++)
+            work(i);
+    double serial = secondsSince(start) / frames;
+    double expected = checksum();
+    std::cout << std::fixed << std::setprecision(3) << "serial loop: " << serial * 1000.0 << " ms/frame\n\n"
+              << std::setw(8) << "threads" << std::setw(16) << "jobs ms" << std::setw(10) << "speedup" << std::setw(10) << "stolen"
+              << std::setw(18) << "parallelFor ms" << std::setw(10) << "speedup" << std::setw(18) << "empty job ns" << "\n";
+
+    bool allOk = true;
+    for (unsigned threads = 1; threads <= std::max(2u, hardware); threads *= 2)
+    {
+        JobSystem jobs(threads, 1 << 17); // the frame root holds all JOBS pending at once
+
+        // one job per item, all children of the frame's root
+        std::fill(results.begin(), results.end(), 0.0f);
+        jobs.resetStats();
+        start = Clock::now();
+        for (int f = 0; f < frames; f++)
+        {
+            JobSystem::Job *frame = jobs.create(nullptr);
+            for (int i = 0; i < jobCount; i++)
+                jobs.run(jobs.createChild(frame, &workJob, &i, sizeof(i)));
+            jobs.runAndWait(frame);
+        }
+        double individual = secondsSince(start) / frames;
+        JobSystem::Stats stats = jobs.stats();
+        bool ok = checksum() == expected;
+
+        std::fill(results.begin(), results.end(), 0.0f);
+        start = Clock::now();
+        for (int f = 0; f < frames; f++)
+            jobs.parallelFor(0, jobCount, GRAIN, [](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                    work((int)i);
+            });
+        double ranged = secondsSince(start) / frames;
+        ok = ok && checksum() == expected;
+
+        // scheduling overhead alone
+        start = Clock::now();
+        for (int f = 0; f < frames; f++)
+        {
+            JobSystem::Job *frame = jobs.create(nullptr);
+            for (int i = 0; i < jobCount; i++)
+                jobs.run(jobs.createChild(frame, nullptr));
+            jobs.runAndWait(frame);
+        }
+        double empty = secondsSince(start) / frames / jobCount;
+
+        std::cout << std::setw(8) << threads << std::setw(16) << individual * 1000.0 << std::setw(9) << serial / individual << "x"
+                  << std::setw(9) << std::setprecision(1) << 100.0 * stats.stolen / std::max(1ull, stats.executed) << "%"
+                  << std::setprecision(3) << std::setw(18) << ranged * 1000.0 << std::setw(9) << serial / ranged << "x"
+                  << std::setw(18) << std::setprecision(1) << empty * 1e9 << std::setprecision(3)
+                  << (ok ? "" : "  ERROR::BENCH::RESULTS_DIFFER") << "\n";
+        allOk = allOk && ok;
+    }
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+// Level of detail (mesh/simplifier.h, scene/lod_selector.h, render/lod_renderer.h).
+//
+// Chain: a generated boulder of 20 * 4^ROCK_DETAIL triangles simplified into up to LEVELS
+// levels, each about half the one before, with each level's error and the build time.
+//
+// Frames: a field of GRID x GRID boulders, looked at from DISTANCES metres away. Each of FRAMES
+// frames at each distance is drawn at full detail (every instance at level 0) and with the
+// levels LodSelector picks for a 1 pixel error, to glFinish. Reports the triangles submitted
+// per frame, the instances cross-fading (drawn at two levels), the frame times and how many
+// pixels the levels changed (by more than a few shades: the fades' screen-door masks count).
+//
+// Checks: every level is a valid closed index list over the original vertices with fewer
+// triangles and no smaller error than the one before, and the full detail selection keeps
+// every instance in view at level 0. Exits non-zero if not.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/lod.cpp glad.c -o bench_lod -lEGL -ldl
+#include <glad/glad.h>
+#include <math/matrix.h>
+#include <math/quaternion.h>
+#include <mesh/rock_mesh.h>
+#include <mesh/simplifier.h>
+#include <render/headless_context.h>
+#include <render/lod_renderer.h>
+#include <scene/camera.h>
+#include <scene/lod_selector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int WIDTH = 1280;
+    const int HEIGHT = 720;
+    const int ROCK_DETAIL = 5;          // 20480 triangles
+    const int LEVELS = 10;
+    const int GRID = 24;                // boulders in the field
+    const float SPACING = 6.0f;         // metres between them
+    const float DISTANCES[] = { 10.0f, 50.0f, 200.0f, 800.0f };
+    const int FRAMES = 3;
+    const float ERROR_PIXELS = 1.0f;
+    const int CHANGED_SHADES = 24;      // a pixel counts as changed when a channel moved by more
+    const float CLEAR_COLOR[4] = { 0.55f, 0.7f, 0.85f, 1.0f };
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// every level indexes existing vertices with no degenerate triangles, and each edge is used
+// once in each direction (a closed, consistently wound surface, like the boulder)
+// ------------------------------------------------------------------------
+bool validLevel(const MeshData &mesh, const MeshLod &level)
+{
+    std::vector<uint64_t> directed, reversed;
+    for (uint32_t i = level.indexOffset; i < level.indexOffset + level.indexCount; i += 3)
+    {
+        const uint32_t *t = &mesh.indices[i];
+        if (t[0] >= mesh.vertexCount() || t[1] >= mesh.vertexCount() || t[2] >= mesh.vertexCount() || t[0] == t[1] || t[1] == t[2] || t[2] == t[0])
+            return false;
+        for (int c = 0; c < 3; c++)
+        {
+            directed.push_back((uint64_t)t[c] << 32 | t[(c + 1) % 3]);
+            reversed.push_back((uint64_t)t[(c + 1) % 3] << 32 | t[c]);
+        }
+    }
+    std::sort(directed.begin(), directed.end());
+    std::sort(reversed.begin(), reversed.end());
+    return std::adjacent_find(directed.begin(), directed.end()) == directed.end() && directed == reversed;
+}
+
+void clear()
+{
+    glClearColor(CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(WIDTH, HEIGHT))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << "\n\n";
+
+    // chain
+    // ________________________________________________________________________
+    MeshData rock;
+    generateRockMesh(rock, ROCK_DETAIL);
+    Clock::time_point start = Clock::now();
+    std::vector<MeshLod> levels = buildLodChain(rock, LEVELS);
+    double buildMs = millisecondsSince(start);
+    bool ok = true;
+    char line[200];
+    std::snprintf(line, sizeof(line), "%zu levels built in %.1f ms\n%-8s %10s %12s\n", levels.size(), buildMs, "level", "triangles", "error (m)");
+    std::cout << line;
+    for (size_t l = 0; l < levels.size(); l++)
+    {
+        bool valid = validLevel(rock, levels[l]) && (l == 0 || (levels[l].indexCount < levels[l - 1].indexCount && levels[l].error >= levels[l - 1].error));
+        std::snprintf(line, sizeof(line), "%-8zu %10u %12.4f%s\n", l, levels[l].indexCount / 3, levels[l].error, valid ? "" : "  INVALID");
+        std::cout << line;
+        ok = ok && valid;
+    }
+    std::cout << "\n";
+
+    // frames
+    // ________________________________________________________________________
+    std::vector<math::mat4> models;
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (int z = 0; z < GRID; z++)
+        for (int x = 0; x < GRID; x++)
+        {
+            float size = 1.0f + unit(random);
+            math::quat turn = math::angleAxis(6.2831853f * unit(random), math::normalize(math::vec3(unit(random) - 0.5f, 2.0f, unit(random) - 0.5f)));
+            math::vec3 position((x - (GRID - 1) * 0.5f) * SPACING, 0.4f * size, (z - (GRID - 1) * 0.5f) * SPACING);
+            models.push_back(math::compose(position, turn, math::vec3(size)));
+        }
+    LodSelector selector(levels, rock);
+    LodRenderer renderer;
+    if (!renderer.create(rock, levels, models.size() * 2))
+        return -1;
+    glViewport(0, 0, WIDTH, HEIGHT);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+    Camera camera;
+    camera.aspect = (float)WIDTH / HEIGHT;
+    camera.nearPlane = 0.5f;
+    camera.farPlane = 5000.0f;
+    LodSelector::Selection selection;
+    std::vector<unsigned char> full((size_t)WIDTH * HEIGHT * 4), lod(full.size());
+
+    std::snprintf(line, sizeof(line), "%d boulders of %u triangles, %.0f pixel error\n%-10s %8s %14s %14s %8s %12s %12s %10s %10s\n",
+                  GRID * GRID, levels[0].indexCount / 3, ERROR_PIXELS, "distance", "in view", "full tris", "lod tris", "fading",
+                  "full ms", "lod ms", "select ms", "changed");
+    std::cout << line;
+    for (float distance : DISTANCES)
+    {
+        // from the south, 25 degrees above the field's centre
+        camera.yaw = 0.0f;
+        camera.pitch = -0.44f;
+        camera.position[0] = 0.0f;
+        camera.position[1] = distance * std::sin(0.44f) + 1.5f;
+        camera.position[2] = distance * std::cos(0.44f);
+        float vp[16];
+        camera.viewProjection(vp);
+        double fullMs = 0.0, lodMs = 0.0, selectMs = 0.0;
+        size_t inView = 0, fullTriangles = 0, lodTriangles = 0, fading = 0, changed = 0;
+        for (int frame = -1; frame < FRAMES; frame++) // frame -1 warms up the driver
+        {
+            selector.thresholdPixels = 0.0f;
+            size_t count = selector.select(camera, (float)HEIGHT, models.data(), models.size(), selection);
+            ok = ok && selection.ranges[0].solid == count && selection.instances.size() == count;
+            clear();
+            glFinish();
+            start = Clock::now();
+            renderer.upload(selection);
+            renderer.draw(vp, selection);
+            glFinish();
+            double fullFrame = millisecondsSince(start);
+            size_t fullCount = selection.triangles;
+            glReadPixels(0, 0, WIDTH, HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, full.data());
+
+            selector.thresholdPixels = ERROR_PIXELS;
+            clear();
+            glFinish();
+            start = Clock::now();
+            selector.select(camera, (float)HEIGHT, models.data(), models.size(), selection);
+            double select = millisecondsSince(start);
+            renderer.upload(selection);
+            renderer.draw(vp, selection);
+            glFinish();
+            double lodFrame = millisecondsSince(start);
+            glReadPixels(0, 0, WIDTH, HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, lod.data());
+            if (frame < 0)
+                continue;
+            fullMs += fullFrame;
+            lodMs += lodFrame;
+            selectMs += select;
+            inView += count;
+            fullTriangles += fullCount;
+            lodTriangles += selection.triangles;
+            for (const LodSelector::Range &range : selection.ranges)
+                fading += range.fading; // each fading instance is in two ranges
+            for (size_t p = 0; p < full.size(); p += 4)
+                for (int c = 0; c < 3; c++)
+                    if (std::abs(full[p + c] - lod[p + c]) > CHANGED_SHADES)
+                    {
+                        changed++;
+                        break;
+                    }
+        }
+        std::snprintf(line, sizeof(line), "%-10.0f %8zu %14zu %14zu %8zu %12.2f %12.2f %10.3f %9.3f%%\n", distance, inView / FRAMES,
+                      fullTriangles / FRAMES, lodTriangles / FRAMES, fading / 2 / FRAMES, fullMs / FRAMES, lodMs / FRAMES, selectMs / FRAMES,
+                      100.0 * changed / ((double)WIDTH * HEIGHT * FRAMES));
+        std::cout << line;
+    }
+    renderer.destroy();
+    if (!ok)
+        std::cout << "ERROR::BENCH::LOD_MISMATCH\n";
+    return ok ? 0 : 1;
+}
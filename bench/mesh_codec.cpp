@@ -0,0 +1,191 @@
+// Mesh compression: ratio, precision and decode throughput of MeshCodec.
+// Decodes into plain memory and into a glMapBufferRange pointer on a headless context.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/mesh_codec.cpp glad.c -o bench_mesh_codec -lEGL -ldl
+// ./bench_mesh_codec [grid size, default 1024]
+//
+// Checks: indices round-trip exactly, positions and texcoords stay within one quantisation step of their bounds,
+// normals within NORMAL_TOLERANCE degrees; any failure (or a failed map) exits non-zero.
+#include <glad/glad.h>
+#include <render/headless_context.h>
+#include <mesh/mesh_format.h>
+#include <mesh/mesh_codec.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int RUNS = 10;
+    const float NORMAL_TOLERANCE = 0.1f;   // degrees; octahedral snorm16 plus float acos noise near 1
+
+// _________________________________________________________________________________________________________________________________
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// n x n UV sphere with normals and texcoords
+// ------------------------------------------------------------------------
+MeshData makeSphere(int n)
+{
+    MeshData mesh;
+    mesh.vertexStride = 8 * sizeof(float);
+    mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_POSITION, 3, MESH_TYPE_FLOAT, 0, 0 });
+    mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_NORMAL, 3, MESH_TYPE_FLOAT, 0, 3 * sizeof(float) });
+    mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_TEXCOORD, 2, MESH_TYPE_FLOAT, 0, 6 * sizeof(float) });
+    std::vector<float> vertices;
+    vertices.reserve((size_t)n * n * 8);
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            float u = i / (float)(n - 1), v = j / (float)(n - 1);
+            float theta = u * 6.2831853f, phi = v * 3.1415926f;
+            float nx = std::sin(phi) * std::cos(theta), ny = std::cos(phi), nz = std::sin(phi) * std::sin(theta);
+            float r = 10.0f + 0.1f * std::sin(theta * 8.0f);
+            float vertex[8] = { nx * r, ny * r, nz * r, nx, ny, nz, u, v };
+            vertices.insert(vertices.end(), vertex, vertex + 8);
+        }
+    }
+    mesh.vertices.resize(vertices.size() * sizeof(float));
+    std::memcpy(mesh.vertices.data(), vertices.data(), mesh.vertices.size());
+    for (int j = 0; j + 1 < n; j++)
+    {
+        for (int i = 0; i + 1 < n; i++)
+        {
+            uint32_t a = j * n + i, b = a + 1, c = a + n, d = c + 1;
+            uint32_t quad[6] = { a, c, b, b, c, d };
+            mesh.indices.insert(mesh.indices.end(), quad, quad + 6);
+        }
+    }
+    return mesh;
+}
+
+int main(int argc, char **argv)
+{
+    int grid = argc > 1 ? std::atoi(argv[1]) : 1024;
+    MeshData mesh = makeSphere(grid);
+    std::vector<unsigned char> encoded;
+    EncodedMeshHeader header;
+    if (!MeshCodec::encode(mesh, encoded) || !MeshCodec::readHeader(encoded.data(), encoded.size(), header))
+    {
+        std::cout << "ERROR::BENCH::ENCODE_FAILED" << std::endl;
+        return 1;
+    }
+
+    size_t rawBytes = mesh.vertices.size() + mesh.indices.size() * sizeof(uint32_t);
+    size_t vertexBytes = MeshCodec::decodedVertexBytes(header);
+    size_t indexBytes = (size_t)header.indexCount * sizeof(uint32_t);
+    std::cout << mesh.vertexCount() << " vertices, " << mesh.indices.size() / 3 << " triangles\n"
+              << std::fixed << std::setprecision(2)
+              << "raw:     " << rawBytes / (1024.0 * 1024.0) << " MB\n"
+              << "encoded: " << encoded.size() / (1024.0 * 1024.0) << " MB (vertices "
+              << (encoded.size() - header.indexStreamSize) / (1024.0 * 1024.0) << ", indices " << header.indexStreamSize / (1024.0 * 1024.0) << ")\n"
+              << "ratio:   " << (double)rawBytes / encoded.size() << ":1\n";
+
+    // precision check
+    std::vector<float> decoded(vertexBytes / sizeof(float));
+    std::vector<uint32_t> indices(header.indexCount);
+    if (!MeshCodec::decodeVertices(encoded.data(), encoded.size(), decoded.data()) ||
+        !MeshCodec::decodeIndices(encoded.data(), encoded.size(), indices.data()))
+    {
+        std::cout << "ERROR::BENCH::DECODE_FAILED" << std::endl;
+        return 1;
+    }
+    const float *original = (const float*)mesh.vertices.data();
+    float extent = 0.0f, uvMin[2] = { 1e30f, 1e30f }, uvMax[2] = { -1e30f, -1e30f };
+    for (int c = 0; c < 3; c++)
+        extent = std::max(extent, header.boundsMax[c] - header.boundsMin[c]);
+    for (size_t v = 0; v < mesh.vertexCount(); v++)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            uvMin[c] = std::min(uvMin[c], original[v * 8 + 6 + c]);
+            uvMax[c] = std::max(uvMax[c], original[v * 8 + 6 + c]);
+        }
+    }
+    float positionStep = extent / 65535.0f, texcoordStep = std::max(uvMax[0] - uvMin[0], uvMax[1] - uvMin[1]) / 65535.0f;
+    float positionError = 0.0f, normalError = 0.0f, texcoordError = 0.0f;
+    for (size_t v = 0; v < mesh.vertexCount(); v++)
+    {
+        for (int c = 0; c < 3; c++)
+            positionError = std::max(positionError, std::fabs(decoded[v * 8 + c] - original[v * 8 + c]));
+        for (int c = 6; c < 8; c++)
+            texcoordError = std::max(texcoordError, std::fabs(decoded[v * 8 + c] - original[v * 8 + c]));
+        float dot = 0.0f;
+        for (int c = 3; c < 6; c++)
+            dot += decoded[v * 8 + c] * original[v * 8 + c];
+        normalError = std::max(normalError, std::acos(std::min(1.0f, dot)) * 57.29578f);
+    }
+    bool indicesOk = indices == mesh.indices;
+    std::cout << std::setprecision(5) << "max position error: " << positionError << " (step " << positionStep
+              << "), max texcoord error: " << texcoordError << " (step " << texcoordStep << "), max normal error: "
+              << normalError << " deg, indices " << (indicesOk ? "exact" : "MISMATCH") << "\n";
+    bool ok = true;
+    if (!indicesOk)
+    {
+        std::cout << "ERROR::BENCH::INDEX_MISMATCH" << std::endl;
+        ok = false;
+    }
+    if (positionError > positionStep || texcoordError > texcoordStep || normalError > NORMAL_TOLERANCE)
+    {
+        std::cout << "ERROR::BENCH::PRECISION" << std::endl;
+        ok = false;
+    }
+
+    double vertexBest = 1e9, indexBest = 1e9;
+    for (int run = 0; run < RUNS; run++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        MeshCodec::decodeVertices(encoded.data(), encoded.size(), decoded.data());
+        vertexBest = std::min(vertexBest, secondsSince(start));
+        start = std::chrono::steady_clock::now();
+        MeshCodec::decodeIndices(encoded.data(), encoded.size(), indices.data());
+        indexBest = std::min(indexBest, secondsSince(start));
+    }
+    std::cout << std::setprecision(2)
+              << "vertex decode (memory):     " << vertexBytes / vertexBest / 1e9 << " GB/s out\n"
+              << "index decode (memory):      " << indexBytes / indexBest / 1e9 << " GB/s out\n";
+
+    HeadlessContext context;
+    if (!context.create(64, 64) || !gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "no GL context, skipping mapped-buffer decode" << std::endl;
+        return ok ? 0 : 1;
+    }
+    unsigned int VBO;
+    glGenBuffers(1, &VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertexBytes, NULL, GL_STATIC_DRAW);
+    double mappedBest = 1e9;
+    for (int run = 0; run < RUNS; run++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        void *dst = glMapBufferRange(GL_ARRAY_BUFFER, 0, vertexBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (!dst)
+        {
+            std::cout << "ERROR::BENCH::MAP_FAILED" << std::endl;
+            ok = false;
+            break;
+        }
+        bool written = MeshCodec::decodeVertices(encoded.data(), encoded.size(), dst);
+        if (glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE || !written)
+        {
+            std::cout << "ERROR::BENCH::MAPPED_DECODE_FAILED" << std::endl;
+            ok = false;
+            break;
+        }
+        mappedBest = std::min(mappedBest, secondsSince(start));
+    }
+    if (mappedBest < 1e9)
+        std::cout << "vertex decode (mapped VBO): " << vertexBytes / mappedBest / 1e9 << " GB/s out\n";
+    glDeleteBuffers(1, &VBO);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+// Mesh load time: text OBJ parsing vs. the memory-mapped binary .mesh format.
+// Generates a ~50 MB OBJ grid (positions + texcoords), converts it once, then times
+// file -> GPU buffers for both paths on a headless context.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/mesh_load.cpp glad.c -o bench_mesh_load -lEGL -ldl
+// ./bench_mesh_load [grid size, default 640]
+#include <glad/glad.h>
+#include <render/headless_context.h>
+#include <mesh/mesh_format.h>
+#include <mesh/mapped_mesh.h>
+#include <mesh/obj_loader.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <iomanip>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int RUNS = 5;
+
+// _________________________________________________________________________________________________________________________________
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// n x n vertex grid in the XZ plane with texcoords, two triangles per cell
+// ------------------------------------------------------------------------
+bool writeGridObj(const std::string &path, int n)
+{
+    FILE *file = std::fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+    for (int z = 0; z < n; z++)
+        for (int x = 0; x < n; x++)
+            std::fprintf(file, "v %.6f %.6f %.6f\n", x / (float)(n - 1) - 0.5f, 0.05f * ((x * 7 + z * 13) % 17) / 17.0f, z / (float)(n - 1) - 0.5f);
+    for (int z = 0; z < n; z++)
+        for (int x = 0; x < n; x++)
+            std::fprintf(file, "vt %.6f %.6f\n", x / (float)(n - 1), z / (float)(n - 1));
+    for (int z = 0; z + 1 < n; z++)
+    {
+        for (int x = 0; x + 1 < n; x++)
+        {
+            int a = z * n + x + 1, b = a + 1, c = a + n, d = c + 1;
+            std::fprintf(file, "f %d/%d %d/%d %d/%d\nf %d/%d %d/%d %d/%d\n", a, a, c, c, b, b, b, b, c, c, d, d);
+        }
+    }
+    std::fclose(file);
+    return true;
+}
+
+void uploadMeshData(const MeshData &mesh, unsigned int buffers[2])
+{
+    glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+    glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size(), mesh.vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint32_t), mesh.indices.data(), GL_STATIC_DRAW);
+}
+
+int main(int argc, char **argv)
+{
+    int grid = argc > 1 ? std::atoi(argv[1]) : 640;
+    HeadlessContext context;
+    if (!context.create(64, 64))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path();
+    std::string objPath = (directory / "bench_mesh_load.obj").string();
+    std::string meshPath = (directory / "bench_mesh_load.mesh").string();
+    if (!writeGridObj(objPath, grid))
+    {
+        std::cout << "ERROR::BENCH::CANNOT_WRITE " << objPath << std::endl;
+        return -1;
+    }
+    MeshData converted;
+    if (!ObjLoader::load(objPath, converted) || !writeMesh(converted, meshPath))
+        return -1;
+    std::cout << "obj:  " << std::filesystem::file_size(objPath) / (1024.0 * 1024.0) << " MB\n";
+    std::cout << "mesh: " << std::filesystem::file_size(meshPath) / (1024.0 * 1024.0) << " MB, "
+              << converted.vertexCount() << " vertices, " << converted.indices.size() / 3 << " triangles\n";
+
+    unsigned int VAO, buffers[2];
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glGenBuffers(2, buffers);
+
+    double objBest = 1e9, meshBest = 1e9;
+    for (int run = 0; run < RUNS; run++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        MeshData mesh;
+        ObjLoader::load(objPath, mesh);
+        uploadMeshData(mesh, buffers);
+        glFinish();
+        objBest = std::min(objBest, secondsSince(start));
+
+        start = std::chrono::steady_clock::now();
+        MappedMesh mapped;
+        mapped.open(meshPath);
+        mapped.upload();
+        mapped.close();
+        glFinish();
+        meshBest = std::min(meshBest, secondsSince(start));
+    }
+    std::cout << std::fixed << std::setprecision(2)
+              << "OBJ parse + upload:   " << objBest * 1000.0 << " ms\n"
+              << "mmap .mesh + upload:  " << meshBest * 1000.0 << " ms\n"
+              << "speedup:              " << objBest / meshBest << "x\n"
+              << "(best of " << RUNS << ", page cache warm)\n";
+
+    glDeleteBuffers(2, buffers);
+    glDeleteVertexArrays(1, &VAO);
+    std::remove(objPath.c_str());
+    std::remove(meshPath.c_str());
+    return 0;
+}
@@ -0,0 +1,192 @@
+// Hierarchical-Z occlusion culling (scene/occlusion_culler.h) on a generated city
+// (scene/city_scene.h): BLOCKS x BLOCKS blocks of LOTS x LOTS buildings, drawn instanced, seen
+// from street level at FRAMES points along CityScene::cameraPath. Every building is an occluder
+// and every building's box is tested. Per frame:
+//   all       every building drawn with GL (the render loop without culling), to glFinish
+//   cull      the occluders rasterised at CULL_WIDTH x CULL_HEIGHT and all boxes tested
+//   culled    only the buildings that passed drawn with GL
+// and the net saving is all - (cull + culled). For scale, the buildings left by the frustum
+// test alone are drawn too ("in frustum"), which is what the occlusion test saves on.
+//
+// Checks: each frame the buildings are also drawn with their index as colour and read back;
+// a building with a pixel on screen that the culler rejected is counted as wrongly culled (the
+// culler is conservative, so this must be zero), and the scalar raster path must produce the
+// same depth buffer as the AVX2 one. Exits non-zero if not.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/occlusion_culling.cpp glad.c -o bench_occlusion_culling -lEGL -ldl -lpthread
+#include <glad/glad.h>
+#include <core/job_system.h>
+#include <render/city_renderer.h>
+#include <render/headless_context.h>
+#include <scene/camera.h>
+#include <scene/city_scene.h>
+#include <scene/occlusion_culler.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int WIDTH = 1280;
+    const int HEIGHT = 720;
+    const int CULL_WIDTH = 320;
+    const int CULL_HEIGHT = 180;
+    const int BLOCKS = 16;
+    const int LOTS = 4;             // BLOCKS^2 * LOTS^2 buildings
+    const int FRAMES = 40;
+    const float CLEAR_COLOR[4] = { 0.55f, 0.7f, 0.85f, 1.0f };
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void clear(const float *color)
+{
+    glClearColor(color[0], color[1], color[2], color[3]);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(WIDTH, HEIGHT))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    CityScene city;
+    city.generate(BLOCKS, LOTS);
+    CityRenderer renderer;
+    if (!renderer.create(city.buildings.size()))
+        return -1;
+    glViewport(0, 0, WIDTH, HEIGHT);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+
+    JobSystem jobs;
+    OcclusionCuller culler(jobs, CULL_WIDTH, CULL_HEIGHT), scalarCuller(jobs, CULL_WIDTH, CULL_HEIGHT);
+    scalarCuller.setSimd(false);
+    for (const CityScene::Building &b : city.buildings)
+    {
+        culler.addOccluderBox(b.min, b.max);
+        scalarCuller.addOccluderBox(b.min, b.max);
+    }
+    const size_t count = city.buildings.size();
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << "\n"
+              << count << " buildings (" << culler.occluderTriangles() << " occluder triangles), " << WIDTH << "x" << HEIGHT
+              << ", depth buffer " << CULL_WIDTH << "x" << CULL_HEIGHT << ", " << jobs.threadCount() << " threads, AVX2 "
+              << (culler.simdSupported() ? "on" : "not supported") << "\n\n";
+
+    std::vector<uint8_t> visible(count);
+    std::vector<uint32_t> list, inFrustum;
+    std::vector<unsigned char> pixels((size_t)WIDTH * HEIGHT * 4);
+    std::vector<uint8_t> seen(count);
+    Camera camera;
+    camera.aspect = (float)WIDTH / HEIGHT;
+    camera.nearPlane = 0.5f;
+    camera.farPlane = 3000.0f;
+    float viewProjection[16];
+
+    double allMs = 0.0, cullMs = 0.0, culledMs = 0.0, frustumMs = 0.0;
+    size_t wronglyCulled = 0, seenTotal = 0, depthMismatches = 0;
+    for (int frame = -1; frame < FRAMES; frame++) // frame -1 warms up the driver and the culler
+    {
+        city.cameraPath((float)std::max(frame, 0) / FRAMES, camera);
+        camera.viewProjection(viewProjection);
+
+        clear(CLEAR_COLOR);
+        glFinish();
+        Clock::time_point start = Clock::now();
+        renderer.draw(city, viewProjection, nullptr, 0);
+        glFinish();
+        double all = millisecondsSince(start);
+
+        start = Clock::now();
+        culler.render(viewProjection);
+        culler.testBoxes(city.buildings[0].min, city.buildings[0].max, sizeof(CityScene::Building), count, visible.data());
+        list.clear();
+        for (size_t i = 0; i < count; i++)
+            if (visible[i])
+                list.push_back((uint32_t)i);
+        double cull = millisecondsSince(start);
+
+        clear(CLEAR_COLOR);
+        glFinish();
+        start = Clock::now();
+        renderer.draw(city, viewProjection, list.data(), list.size());
+        glFinish();
+        double culled = millisecondsSince(start);
+        inFrustum.clear();
+        for (size_t i = 0; i < count; i++)
+            if (culler.test(city.buildings[i].min, city.buildings[i].max) != OcclusionCuller::OUTSIDE)
+                inFrustum.push_back((uint32_t)i);
+        clear(CLEAR_COLOR);
+        glFinish();
+        start = Clock::now();
+        renderer.draw(city, viewProjection, inFrustum.data(), inFrustum.size());
+        glFinish();
+        double frustum = millisecondsSince(start);
+        if (frame < 0)
+        {
+            culler.resetStats();
+            continue;
+        }
+        allMs += all;
+        cullMs += cull;
+        culledMs += culled;
+        frustumMs += frustum;
+
+        // which buildings really are visible
+        const float black[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        clear(black);
+        renderer.draw(city, viewProjection, nullptr, 0, true);
+        glReadPixels(0, 0, WIDTH, HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        std::fill(seen.begin(), seen.end(), 0);
+        for (size_t p = 0; p < (size_t)WIDTH * HEIGHT; p++)
+        {
+            int64_t index = CityRenderer::index(&pixels[p * 4]);
+            if (index >= 0 && index < (int64_t)count)
+                seen[index] = 1;
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            seenTotal += seen[i];
+            wronglyCulled += seen[i] && !visible[i];
+        }
+
+        scalarCuller.render(viewProjection);
+        for (int y = 0; y < CULL_HEIGHT; y++)
+            depthMismatches += std::memcmp(culler.depth() + (size_t)y * culler.rowStride(), scalarCuller.depth() + (size_t)y * scalarCuller.rowStride(), CULL_WIDTH * sizeof(float)) != 0;
+    }
+
+    const OcclusionCuller::Stats &stats = culler.stats();
+    double tested = (double)stats.tested;
+    char line[400];
+    std::snprintf(line, sizeof(line), "per frame: %.0f of %zu buildings drawn (%.1f%% outside the view, %.1f%% occluded, %.1f%% culled), %.1f actually visible",
+                  (tested - stats.outside - stats.occluded) / FRAMES, count, 100.0 * stats.outside / tested, 100.0 * stats.occluded / tested,
+                  100.0 * (stats.outside + stats.occluded) / tested, (double)seenTotal / FRAMES);
+    std::cout << line << "\n";
+    std::snprintf(line, sizeof(line), "occluder triangles rasterised: %.0f of %.0f per frame", (double)stats.rasterized / FRAMES, (double)stats.occluderTriangles / FRAMES);
+    std::cout << line << "\n\n";
+    std::snprintf(line, sizeof(line), "%-28s %10.2f ms/frame\n%-28s %10.2f ms/frame\n%-28s %10.2f ms/frame\n%-28s %10.2f ms/frame\n%-28s %10.2f ms/frame (%.0f%%)\n",
+                  "draw all", allMs / FRAMES, "draw in frustum", frustumMs / FRAMES, "cull", cullMs / FRAMES, "draw culled", culledMs / FRAMES,
+                  "net saving", (allMs - cullMs - culledMs) / FRAMES, 100.0 * (allMs - cullMs - culledMs) / allMs);
+    std::cout << line << "\n";
+
+    std::cout << "wrongly culled: " << wronglyCulled << ", scalar/AVX2 depth rows differing: " << depthMismatches << "\n";
+    bool ok = wronglyCulled == 0 && depthMismatches == 0;
+    if (!ok)
+        std::cout << "ERROR::BENCH::OCCLUSION_CULLING_MISMATCH\n";
+    renderer.destroy();
+    return ok ? 0 : 1;
+}
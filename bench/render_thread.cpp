@@ -0,0 +1,227 @@
+// Input-to-present latency and frame pacing: the single-threaded loop from main.cpp vs.
+// RenderThread (events on the main thread, GL on a render thread).
+//
+// The window system is simulated: event handling usually takes EVENTS_MS but every
+// SLOW_EVERY-th frame it blocks for SLOW_EVENTS_MS (a slow callback, a compositor hiccup),
+// and present() waits for the next vblank of a REFRESH_HZ display after glFinish.
+// Latency is input sample -> present; pacing is the interval between presents.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/render_thread.cpp glad.c -o bench_render_thread -lEGL -ldl -lpthread
+#include <glad/glad.h>
+#include <render/headless_context.h>
+#include <render/render_thread.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int FRAMES = 300;
+    const double REFRESH_HZ = 60.0;
+    const double EVENTS_MS = 0.3;
+    const double SLOW_EVENTS_MS = 12.0;
+    const int SLOW_EVERY = 7;
+    const double UPDATE_MS = 1.0;  // simulation, busy
+    const int TRIANGLES = 500;     // render work per frame
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "uniform float offset;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = vec4(aPos.x + offset, aPos.yz, 1.0);\n"
+    "   ourColor = aColor;\n"
+    "}\0";
+
+    const char *fragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "in vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0);\n"
+    "}\0";
+
+typedef std::chrono::steady_clock Clock;
+
+struct FrameData
+{
+    float offset = 0.0f; // "simulation" output: the scene scrolls with the input
+    float clearColor[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+};
+
+struct Scene
+{
+    unsigned int program = 0, VAO = 0, VBO = 0;
+    int offsetLocation = -1;
+    Clock::time_point epoch = Clock::now();
+
+    void create()
+    {
+        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+        glCompileShader(vertexShader);
+        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+        glCompileShader(fragmentShader);
+        program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        offsetLocation = glGetUniformLocation(program, "offset");
+
+        std::vector<float> vertices;
+        for (int i = 0; i < TRIANGLES; i++)
+        {
+            float x = -1.0f + 2.0f * (i % 50) / 50.0f, y = -1.0f + 2.0f * (i / 50) / (TRIANGLES / 50.0f);
+            float triangle[] = {
+                x, y, 0.0f, 1.0f, 0.0f, 0.0f,
+                x + 0.1f, y, 0.0f, 0.0f, 1.0f, 0.0f,
+                x + 0.05f, y + 0.1f, 0.0f, 0.0f, 0.0f, 1.0f
+            };
+            vertices.insert(vertices.end(), triangle, triangle + 18);
+        }
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+    }
+    void destroy()
+    {
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteProgram(program);
+    }
+    void render(const FrameData &frame)
+    {
+        glClearColor(frame.clearColor[0], frame.clearColor[1], frame.clearColor[2], frame.clearColor[3]);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(program);
+        glUniform1f(offsetLocation, frame.offset);
+        glBindVertexArray(VAO);
+        glDrawArrays(GL_TRIANGLES, 0, TRIANGLES * 3);
+    }
+    // swap, wait for the GPU, then for the next simulated vblank
+    // ------------------------------------------------------------------------
+    void present(HeadlessContext &context)
+    {
+        context.swapBuffers();
+        glFinish();
+        double period = 1.0 / REFRESH_HZ;
+        double since = std::chrono::duration<double>(Clock::now() - epoch).count();
+        double next = std::ceil(since / period) * period;
+        std::this_thread::sleep_until(epoch + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(next)));
+    }
+};
+
+void pollEvents(int frame)
+{
+    double ms = (frame % SLOW_EVERY == SLOW_EVERY - 1) ? SLOW_EVENTS_MS : EVENTS_MS;
+    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(ms));
+}
+
+void update(FrameData &frame, int index)
+{
+    Clock::time_point end = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(UPDATE_MS));
+    while (Clock::now() < end)
+        ;
+    frame.offset = 0.01f * (index % 50);
+}
+
+void printResults(const char *name, const FrameStats &latency, const FrameStats &pacing)
+{
+    double period = 1.0 / REFRESH_HZ;
+    std::cout << name << "\n";
+    latency.print(std::cout, "  input -> present");
+    pacing.print(std::cout, "  present interval");
+    std::cout << "  missed vblanks: " << pacing.countAbove(period * 1.5) << " of " << pacing.count() << " frames\n";
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(800, 600))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << ", " << FRAMES << " frames at " << REFRESH_HZ
+              << " Hz, events " << EVENTS_MS << " ms (" << SLOW_EVENTS_MS << " ms every " << SLOW_EVERY << " frames)\n\n";
+
+    // single-threaded, as main.cpp was: events, input, update, render, present
+    {
+        Scene scene;
+        scene.create();
+        FrameStats latency, pacing;
+        Clock::time_point lastPresent;
+        for (int i = 0; i < FRAMES; i++)
+        {
+            pollEvents(i);
+            Clock::time_point inputTime = Clock::now();
+            FrameData frame;
+            update(frame, i);
+            scene.render(frame);
+            scene.present(context);
+            Clock::time_point now = Clock::now();
+            latency.add(std::chrono::duration<double>(now - inputTime).count());
+            if (i > 0)
+                pacing.add(std::chrono::duration<double>(now - lastPresent).count());
+            lastPresent = now;
+        }
+        scene.destroy();
+        printResults("single thread", latency, pacing);
+    }
+
+    // main thread: events, input, update; render thread: render, present
+    {
+        Scene scene;
+        context.release();
+        RenderThread<FrameData> renderer;
+        RenderThread<FrameData>::Hooks hooks;
+        hooks.init = [&] {
+            if (!context.makeCurrent())
+                return false;
+            scene.create();
+            return true;
+        };
+        hooks.render = [&](const FrameData &frame) { scene.render(frame); };
+        hooks.present = [&] { scene.present(context); };
+        hooks.shutdown = [&] {
+            scene.destroy();
+            context.release();
+        };
+        if (!renderer.start(hooks))
+        {
+            std::cout << "ERROR::BENCH::RENDER_THREAD_START_FAILED" << std::endl;
+            return -1;
+        }
+        for (int i = 0; i < FRAMES; i++)
+        {
+            // wait for a free buffer before polling, so the input is as fresh as possible when it is drawn
+            FrameData &frame = renderer.beginFrame();
+            pollEvents(i);
+            Clock::time_point inputTime = Clock::now();
+            update(frame, i);
+            renderer.submitFrame(inputTime);
+        }
+        renderer.stop();
+        context.makeCurrent();
+        printResults("render thread", renderer.latency(), renderer.pacing());
+    }
+    return 0;
+}
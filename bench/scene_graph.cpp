@@ -0,0 +1,217 @@
+// Transform hierarchy update (scene/scene_graph.h) against the pointer tree it replaces: nodes
+// allocated one by one with their children in std::vectors, updated by recursion with the same
+// dirty flags. NODES nodes, in two shapes:
+//   forest    FOREST_TREES random trees (each node under a random earlier node of its tree)
+//   one tree  a single random recursive tree, whose top the scene graph splits into islands
+//
+// Each is updated with every node dirty (the roots set), with DIRTY_FRACTION of the nodes set,
+// and with nothing set, in ms per update: the pointer tree, then the scene graph scalar, AVX2,
+// AVX2 on every thread, and that writing every matrix to an instance buffer as well.
+//
+// Checks: after the partial and the clean updates every world matrix (and with the output, every
+// instance) must equal the pointer tree's bit for bit, as math::mat4's product (which the pointer
+// tree uses) and the batch kernels sum in the same order. Exits non-zero if not. --quick (what
+// ctest runs) builds QUICK_NODES nodes, the forest's trees as large as ever, and updates once.
+//
+// g++ -std=c++17 -O2 -Iinclude bench/scene_graph.cpp -o bench_scene_graph -lpthread
+// ./bench_scene_graph [--quick]
+#include <core/job_system.h>
+#include <math/matrix.h>
+#include <scene/scene_graph.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const size_t NODES = 1000000;
+    const size_t FOREST_TREES = 10000;
+    const float DIRTY_FRACTION = 0.01f;
+    const int REPEATS = 5;
+    const size_t QUICK_NODES = 50000;
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+struct PointerNode
+{
+    math::mat4 local;
+    math::mat4 world;
+    bool dirty = true;
+    std::vector<PointerNode*> children;
+};
+
+void updatePointerTree(PointerNode *node, const math::mat4 *parentWorld, bool parentDirty)
+{
+    bool dirty = node->dirty || parentDirty;
+    if (dirty)
+        node->world = parentWorld ? *parentWorld * node->local : node->local;
+    node->dirty = false;
+    for (PointerNode *child : node->children)
+        updatePointerTree(child, &node->world, dirty);
+}
+
+math::mat4 randomLocal(std::mt19937 &random)
+{
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    math::vec3 translation, axis;
+    float length = 0.0f;
+    for (int i = 0; i < 3; i++)
+    {
+        translation[i] = unit(random) * 4.0f - 2.0f;
+        axis[i] = unit(random) * 2.0f - 1.0f + 1e-3f;
+        length += axis[i] * axis[i];
+    }
+    for (int i = 0; i < 3; i++)
+        axis[i] /= std::sqrt(length);
+    float s = 0.9f + 0.2f * unit(random);
+    float angle = unit(random) * 6.2831853f;
+    return math::compose(translation, math::rotate3(axis, angle), math::vec3(s));
+}
+
+int main(int argc, char **argv)
+{
+    size_t nodes = NODES;
+    int repeats = REPEATS;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--quick") != 0)
+        {
+            std::cout << "usage: bench_scene_graph [--quick]" << std::endl;
+            return 1;
+        }
+        nodes = QUICK_NODES;
+        repeats = 1;
+    }
+
+    JobSystem jobs;
+    std::cout << nodes << " nodes, " << jobs.threadCount() << " threads\n\n";
+    bool ok = true;
+    char line[200];
+    for (int shape = 0; shape < 2; shape++)
+    {
+        std::mt19937 random(5);
+        std::vector<uint32_t> parents(nodes);
+        size_t treeSize = shape == 0 ? NODES / FOREST_TREES : nodes;
+        for (size_t i = 0; i < nodes; i++)
+        {
+            size_t first = i / treeSize * treeSize;
+            parents[i] = i == first ? SceneGraph::NONE : (uint32_t)(first + random() % (i - first));
+        }
+        std::vector<math::mat4> locals(nodes);
+        for (size_t i = 0; i < nodes; i++)
+            locals[i] = randomLocal(random);
+        std::vector<uint32_t> dirtyNodes((size_t)(nodes * DIRTY_FRACTION));
+        std::vector<math::mat4> moved(dirtyNodes.size());
+        for (size_t d = 0; d < dirtyNodes.size(); d++)
+        {
+            dirtyNodes[d] = (uint32_t)(random() % nodes);
+            moved[d] = randomLocal(random);
+        }
+
+        std::vector<PointerNode*> pointerNodes(nodes);
+        std::vector<PointerNode*> roots;
+        for (size_t i = 0; i < nodes; i++)
+        {
+            pointerNodes[i] = new PointerNode;
+            pointerNodes[i]->local = locals[i];
+            if (parents[i] == SceneGraph::NONE)
+                roots.push_back(pointerNodes[i]);
+            else
+                pointerNodes[parents[i]]->children.push_back(pointerNodes[i]);
+        }
+        std::vector<math::mat4> instances(nodes);
+
+        // cases: 0 all dirty (the roots set), 1 some set (to moved and back, ending moved), 2 none
+        size_t mismatches = 0, topSize = 0, islandCount = 0;
+        double firstMs = 0.0;
+        std::snprintf(line, sizeof(line), "%s: %zu roots\n%-36s %12s %12s %12s\n", shape == 0 ? "forest" : "one tree", roots.size(),
+                      "ms per update", "all dirty", "1% dirty", "none dirty");
+        std::cout << line;
+        for (int path = 0; path < 5; path++)
+        {
+            SceneGraph graph(path >= 3 ? &jobs : nullptr);
+            if (path > 0)
+            {
+                if (path >= 2 && !graph.simdSupported())
+                    break;
+                graph.setSimd(path >= 2);
+                graph.reserve(nodes);
+                for (size_t i = 0; i < nodes; i++)
+                    graph.create(parents[i], locals[i]);
+                Clock::time_point start = Clock::now();
+                graph.update();
+                double layoutMs = millisecondsSince(start);
+                if (path == 1)
+                {
+                    topSize = graph.topSize();
+                    islandCount = graph.islandCount();
+                    firstMs = layoutMs;
+                }
+            }
+            double ms[3] = {};
+            for (int c = 0; c < 3; c++)
+            {
+                for (int r = 0; r < repeats; r++)
+                {
+                    if (c == 0)
+                        for (PointerNode *root : roots)
+                            root->dirty = true;
+                    if (c == 0 && path > 0)
+                        for (size_t i = 0; i < nodes; i++)
+                            if (parents[i] == SceneGraph::NONE)
+                                graph.setLocal((uint32_t)i, locals[i]);
+                    for (size_t d = 0; c == 1 && d < dirtyNodes.size(); d++)
+                    {
+                        const math::mat4 &local = r % 2 == 0 ? moved[d] : locals[dirtyNodes[d]];
+                        if (path > 0)
+                            graph.setLocal(dirtyNodes[d], local);
+                        else
+                        {
+                            pointerNodes[dirtyNodes[d]]->local = local;
+                            pointerNodes[dirtyNodes[d]]->dirty = true;
+                        }
+                    }
+                    Clock::time_point start = Clock::now();
+                    if (path > 0)
+                        graph.update(path == 4 ? instances.data() : nullptr);
+                    else
+                        for (PointerNode *root : roots)
+                            updatePointerTree(root, nullptr, false);
+                    ms[c] += millisecondsSince(start);
+                }
+                // the pointer tree is in its final state, which the graphs reach after the moves
+                for (size_t i = 0; path > 0 && c > 0 && i < nodes; i++)
+                {
+                    const math::mat4 &expected = pointerNodes[i]->world;
+                    bool same = std::memcmp(&graph.world((uint32_t)i), &expected, sizeof(math::mat4)) == 0;
+                    if (path == 4)
+                        same = same && std::memcmp(&instances[graph.slot((uint32_t)i)], &expected, sizeof(math::mat4)) == 0;
+                    mismatches += !same;
+                }
+            }
+            const char *names[5] = { "pointer tree", "scene graph, scalar", "scene graph, AVX2", "scene graph, AVX2 threaded", "  + instance buffer output" };
+            std::snprintf(line, sizeof(line), "%-36s %12.3f %12.3f %12.3f\n", names[path], ms[0] / repeats, ms[1] / repeats, ms[2] / repeats);
+            std::cout << line;
+        }
+        std::snprintf(line, sizeof(line), "layout: %zu top nodes, %zu islands (first update, laying them out, %.1f ms)\n", topSize, islandCount, firstMs);
+        std::cout << line << "world matrices differing from the pointer tree: " << mismatches << "\n\n";
+        ok = ok && mismatches == 0;
+        for (PointerNode *node : pointerNodes)
+            delete node;
+    }
+    if (!ok)
+        std::cout << "ERROR::BENCH::SCENE_GRAPH_MISMATCH\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,258 @@
+// Fragment shaders compiled from GLSL by tools/glslc.py (raster/glsl_runtime.h) against the
+// hand-written software shaders, in fragments per second. Each is run on BLOCKS blocks of 8
+// fragments with random varyings, small enough to stay in cache, so this measures the shader
+// and not memory:
+//   triangle_with_color  FragColor = vec4(ourColor, 1.0), against TriangleScene::colorFragment(8)
+//   lit_color            resources/shaders/lit_color.frag (normalize, dot, max, clamp, mix),
+//                        against a scalar C++ and an AVX2 intrinsics version written out below
+// one fragment per call (fragment) and 8 per call (fragment8).
+// resources/shaders/swizzle_assign.frag (c.xy = c.yx; c += c.zxy; ...) is only checked: the
+// right-hand sides read the components being assigned, which glslc must read before writing.
+//
+// Before timing, the oldmain.cpp triangles are drawn with BinnedRasterizer using the
+// hand-written and the generated programs, and the images compared: they must be identical,
+// as must the scalar and 8-wide generated shaders on every block, and swizzle_assign must
+// match its hand-written version. Exits non-zero if not.
+//
+// built by CMake, which runs glslc.py first; by hand:
+// python3 tools/glslc.py --name LitColor resources/shaders/triangle_with_color.vert resources/shaders/lit_color.frag -o generated/glsl/lit_color.h
+// (the same for triangle.vert + uniform_color.frag, triangle_with_color.vert + .frag and
+// triangle_with_color.vert + swizzle_assign.frag), then
+// g++ -std=c++17 -O2 -Iinclude -Igenerated bench/shader_compiler.cpp -o bench_shader_compiler -lpthread
+#include <core/job_system.h>
+#include <raster/binned_rasterizer.h>
+#include <raster/framebuffer.h>
+#include <raster/triangle_scenes.h>
+
+#include <glsl/lit_color.h>
+#include <glsl/swizzle_assign.h>
+#include <glsl/triangle.h>
+#include <glsl/triangle_with_color.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define SHADER_BENCH_AVX2
+#endif
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int WIDTH = 1280;
+    const int HEIGHT = 720;
+    const int BLOCKS = 512;         // of 8 fragments
+    const int PASSES = 2000;        // over all blocks, per measurement
+    const int REPETITIONS = 3;      // best of
+    const float CLEAR_COLOR[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+    const GlslLitColor::Uniforms LIT_UNIFORMS = { { 0.3f, 0.5f, 1.0f }, 0.2f };
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+const int LANES = RasterPipeline::SIMD_WIDTH;
+
+// lit_color.frag by hand, in the same order of operations as the generated code
+// ------------------------------------------------------------------------
+void litFragment(const float *varyings, const void *uniformData, float *color)
+{
+    const GlslLitColor::Uniforms &u = *(const GlslLitColor::Uniforms*)uniformData;
+    float nx = varyings[0] * 2.0f - 1.0f, ny = varyings[1] * 2.0f - 1.0f;
+    float scale = 1.0f / std::sqrt(nx * nx + ny * ny + 1.0f);
+    const float *l = u.lightDirection;
+    float lightScale = 1.0f / std::sqrt(l[0] * l[0] + l[1] * l[1] + l[2] * l[2]);
+    float diffuse = std::max(nx * scale * (l[0] * lightScale) + ny * scale * (l[1] * lightScale) + scale * (l[2] * lightScale), 0.0f);
+    float light = std::min(std::max(u.ambient + diffuse, 0.0f), 1.0f);
+    for (int c = 0; c < 3; c++)
+        color[c] = varyings[c] * light * (1.0f - 0.1f) + 0.1f;
+    color[3] = 1.0f;
+}
+// swizzle_assign.frag by hand: (g, r, b), plus (b, g, r), then y and z swapped
+// ------------------------------------------------------------------------
+void swizzleFragment(const float *varyings, const void*, float *color)
+{
+    float r = varyings[0], g = varyings[1], b = varyings[2];
+    color[0] = g + b;
+    color[1] = b + r;
+    color[2] = r + g;
+    color[3] = 1.0f;
+}
+
+#ifdef SHADER_BENCH_AVX2
+__attribute__((target("avx2")))
+void litFragment8Avx2(const float *varyings, const void *uniformData, float *color)
+{
+    const GlslLitColor::Uniforms &u = *(const GlslLitColor::Uniforms*)uniformData;
+    const float *l = u.lightDirection;
+    float lightScale = 1.0f / std::sqrt(l[0] * l[0] + l[1] * l[1] + l[2] * l[2]);
+    __m256 one = _mm256_set1_ps(1.0f), zero = _mm256_setzero_ps();
+    __m256 r = _mm256_loadu_ps(varyings), g = _mm256_loadu_ps(varyings + LANES), b = _mm256_loadu_ps(varyings + 2 * LANES);
+    __m256 nx = _mm256_sub_ps(_mm256_mul_ps(r, _mm256_set1_ps(2.0f)), one);
+    __m256 ny = _mm256_sub_ps(_mm256_mul_ps(g, _mm256_set1_ps(2.0f)), one);
+    __m256 length2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, nx), _mm256_mul_ps(ny, ny)), one);
+    __m256 scale = _mm256_div_ps(one, _mm256_sqrt_ps(length2));
+    __m256 diffuse = _mm256_mul_ps(_mm256_mul_ps(nx, scale), _mm256_set1_ps(l[0] * lightScale));
+    diffuse = _mm256_add_ps(diffuse, _mm256_mul_ps(_mm256_mul_ps(ny, scale), _mm256_set1_ps(l[1] * lightScale)));
+    diffuse = _mm256_add_ps(diffuse, _mm256_mul_ps(scale, _mm256_set1_ps(l[2] * lightScale)));
+    diffuse = _mm256_max_ps(diffuse, zero);
+    __m256 light = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(_mm256_set1_ps(u.ambient), diffuse), zero), one);
+    __m256 keep = _mm256_set1_ps(1.0f - 0.1f), add = _mm256_set1_ps(0.1f);
+    _mm256_storeu_ps(color, _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(r, light), keep), add));
+    _mm256_storeu_ps(color + LANES, _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(g, light), keep), add));
+    _mm256_storeu_ps(color + 2 * LANES, _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(b, light), keep), add));
+    _mm256_storeu_ps(color + 3 * LANES, one);
+}
+#endif
+
+// best of REPETITIONS, in fragments per second; one call per fragment, or per block with blocks
+// ------------------------------------------------------------------------
+double measure(RasterPipeline::FragmentShader shader, bool blocks, const void *uniforms, const std::vector<float> &varyings, int inputs, std::vector<float> &colors)
+{
+    double best = 1e30;
+    for (int r = 0; r < REPETITIONS; r++)
+    {
+        Clock::time_point start = Clock::now();
+        for (int pass = 0; pass < PASSES; pass++)
+            for (int block = 0; block < BLOCKS; block++)
+            {
+                const float *in = varyings.data() + (size_t)block * inputs * LANES;
+                float *out = colors.data() + (size_t)block * 4 * LANES;
+                if (blocks)
+                    shader(in, uniforms, out);
+                else
+                    for (int lane = 0; lane < LANES; lane++)
+                        shader(in + lane * inputs, uniforms, out + lane * 4);
+            }
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    return (double)PASSES * BLOCKS * LANES / best;
+}
+
+// largest difference between fragment (on AoS fragments) and fragment8 (on the same values as SoA blocks)
+// ------------------------------------------------------------------------
+float difference(RasterPipeline::FragmentShader fragment, RasterPipeline::FragmentShader8 fragment8, const void *uniforms,
+                 const std::vector<float> &varyings, int inputs)
+{
+    float worst = 0.0f;
+    std::vector<float> soa(inputs * LANES + 1);
+    for (int block = 0; block < BLOCKS; block++)
+    {
+        const float *in = varyings.data() + (size_t)block * inputs * LANES;
+        float wide[4 * LANES], one[4];
+        for (int k = 0; k < inputs; k++)
+            for (int lane = 0; lane < LANES; lane++)
+                soa[k * LANES + lane] = in[lane * inputs + k];
+        fragment8(soa.data(), uniforms, wide);
+        for (int lane = 0; lane < LANES; lane++)
+        {
+            fragment(in + lane * inputs, uniforms, one);
+            for (int c = 0; c < 4; c++)
+                worst = std::max(worst, std::fabs(one[c] - wide[c * LANES + lane]));
+        }
+    }
+    return worst;
+}
+
+// the oldmain.cpp scene with its hand-written programs (TriangleScene::draw) or the generated ones
+// ------------------------------------------------------------------------
+void drawScene(Framebuffer &target, BinnedRasterizer &raster, const TriangleScene &scene, bool generated)
+{
+    target.clearColor(CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]);
+    target.clearDepth(1.0f);
+    if (!generated)
+    {
+        scene.draw(raster);
+        return;
+    }
+    raster.vertexAttribPointer(0, 3, scene.stride * sizeof(float), scene.vertices);
+    if (scene.colorOffset >= 0)
+    {
+        raster.vertexAttribPointer(1, 3, scene.stride * sizeof(float), scene.vertices + scene.colorOffset);
+        raster.useProgram(GlslTriangleWithColor::program());
+    }
+    else
+    {
+        raster.disableVertexAttribArray(1);
+        raster.useProgram(GlslTriangle::program((const GlslTriangle::Uniforms*)scene.color));
+    }
+    raster.drawArrays(0, scene.vertexCount);
+}
+
+int main()
+{
+    JobSystem jobs(1);
+    Framebuffer handWritten(WIDTH, HEIGHT), generated(WIDTH, HEIGHT);
+    BinnedRasterizer handRaster(handWritten, jobs), generatedRaster(generated, jobs);
+    std::cout << "AVX2 " << (glslAvx2() ? "on" : "not supported") << "\n\n";
+
+    // correctness
+    bool ok = true;
+    for (int s = 0; s < TRIANGLE_SCENE_COUNT; s++)
+        for (int simd = 0; simd < 2; simd++)
+        {
+            handRaster.setSimd(simd != 0);
+            generatedRaster.setSimd(simd != 0);
+            drawScene(handWritten, handRaster, triangleScenes[s], false);
+            drawScene(generated, generatedRaster, triangleScenes[s], true);
+            size_t different = 0;
+            for (size_t i = 0; i < (size_t)WIDTH * HEIGHT; i++)
+                different += handWritten.pixels()[i] != generated.pixels()[i];
+            std::cout << std::left << std::setw(8) << triangleScenes[s].name << std::setw(10) << (simd ? "fragment8" : "fragment")
+                      << std::right << std::setw(10) << different << " pixels differ\n";
+            ok = different == 0 && ok;
+        }
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<float> varyings((size_t)BLOCKS * LANES * 3), colors((size_t)BLOCKS * LANES * 4);
+    for (float &v : varyings)
+        v = unit(random);
+    float worst = std::max(difference(&GlslTriangleWithColor::fragment, &GlslTriangleWithColor::fragment8, nullptr, varyings, 3),
+                           difference(&GlslLitColor::fragment, &GlslLitColor::fragment8, &LIT_UNIFORMS, varyings, 3));
+    std::cout << "generated fragment against fragment8: max difference " << worst << "\n";
+    ok = worst == 0.0f && ok;
+    std::cout << "generated lit_color against the hand-written one: max difference "
+              << difference(&litFragment, &GlslLitColor::fragment8, &LIT_UNIFORMS, varyings, 3) << "\n";
+    float swizzle = std::max(difference(&swizzleFragment, &GlslSwizzleAssign::fragment8, nullptr, varyings, 3),
+                             difference(&GlslSwizzleAssign::fragment, &GlslSwizzleAssign::fragment8, nullptr, varyings, 3));
+    std::cout << "generated swizzle_assign against the hand-written one: max difference " << swizzle << "\n";
+    ok = swizzle == 0.0f && ok;
+    std::cout << (ok ? "\n" : "\nERROR::BENCH::GENERATED_SHADER_MISMATCH\n\n");
+
+    // throughput
+    struct Case
+    {
+        const char *name;
+        RasterPipeline::FragmentShader shader;
+        bool blocks;
+        const void *uniforms;
+    };
+    std::vector<Case> cases = {
+        { "triangle_with_color  hand-written fragment", &TriangleScene::colorFragment, false, nullptr },
+        { "                     generated fragment", &GlslTriangleWithColor::fragment, false, nullptr },
+        { "                     hand-written fragment8", &TriangleScene::colorFragment8, true, nullptr },
+        { "                     generated fragment8", &GlslTriangleWithColor::fragment8, true, nullptr },
+        { "lit_color            hand-written fragment", &litFragment, false, &LIT_UNIFORMS },
+        { "                     generated fragment", &GlslLitColor::fragment, false, &LIT_UNIFORMS },
+#ifdef SHADER_BENCH_AVX2
+        { "                     hand-written AVX2", glslAvx2() ? &litFragment8Avx2 : nullptr, true, &LIT_UNIFORMS },
+#endif
+        { "                     generated fragment8", &GlslLitColor::fragment8, true, &LIT_UNIFORMS },
+    };
+    std::cout << std::setw(48) << "" << std::setw(14) << "Mfragments/s" << "\n";
+    for (const Case &c : cases)
+    {
+        if (!c.shader)
+            continue;
+        char line[200];
+        std::snprintf(line, sizeof(line), "%-46s %12.1f", c.name, measure(c.shader, c.blocks, c.uniforms, varyings, 3, colors) * 1e-6);
+        std::cout << line << "\n";
+    }
+    return ok ? 0 : 1;
+}
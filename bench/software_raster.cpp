@@ -0,0 +1,281 @@
+// Software rasteriser (raster/rasterizer.h) against GL: pixel comparison and throughput.
+//
+// Comparison: the oldmain.cpp triangles (raster/triangle_scenes.h) and a stress scene of
+// RANDOM_TRIANGLES overlapping triangles with per-vertex colour, clip-space w between 0.5 and
+// 3 (perspective-correct interpolation) and the depth test on, rendered by both backends at
+// 800x600 and compared per channel. Throughput: the stress scene for FRAMES frames, as
+// triangles/s and fill rate (pixels written/s), next to the GL driver's time for the same.
+//
+// Checks: the oldmain.cpp scenes may only be off by one (colour rounding). Coverage, clipping
+// and the fill rule match GL, but the stress scene still has a few pixels that really differ:
+// GL drivers interpolate depth and varyings from the vertices before they are snapped to the
+// subpixel grid, the rasteriser from the snapped ones, which moves the values of sub-pixel
+// slivers enough to flip a depth test or a colour by a few shades. Up to MAX_DIFFERENT of the
+// stress scene's pixels may do so. Exits non-zero past either limit.
+//
+// g++ -std=c++17 -O2 -Idependencies/include -Iinclude bench/software_raster.cpp glad.c -o bench_software_raster -lEGL -ldl
+#include <glad/glad.h>
+#include <raster/framebuffer.h>
+#include <raster/rasterizer.h>
+#include <raster/triangle_scenes.h>
+#include <render/headless_context.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int WIDTH = 800;
+    const int HEIGHT = 600;
+    const int RANDOM_TRIANGLES = 2000;
+    const int FRAMES = 20;
+    const double MAX_DIFFERENT = 0.00005;   // fraction of the stress scene's pixels that may differ by more than one
+    const float CLEAR_COLOR[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+
+// _________________________________________________________________________________________________________________________________
+
+    const char *perspectiveVertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec4 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_Position = aPos;\n"
+    "   ourColor = aColor;\n"
+    "}\0";
+
+typedef std::chrono::steady_clock Clock;
+
+// software shaders for the stress scene
+// ------------------------------------------------------------------------
+void perspectiveVertex(const float *const *attributes, const void*, float *position, float *varyings)
+{
+    for (int i = 0; i < 4; i++)
+        position[i] = attributes[0][i];
+    for (int i = 0; i < 3; i++)
+        varyings[i] = attributes[1][i];
+}
+
+// 7 floats per vertex: clip-space position (x, y, z, w) and colour; overlapping, mostly small
+// ------------------------------------------------------------------------
+std::vector<float> stressScene()
+{
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<float> vertices;
+    for (int t = 0; t < RANDOM_TRIANGLES; t++)
+    {
+        float cx = unit(random) * 2.0f - 1.0f, cy = unit(random) * 2.0f - 1.0f;
+        float size = t % 50 == 0 ? 0.6f : 0.08f;
+        for (int v = 0; v < 3; v++)
+        {
+            float w = 0.5f + 2.5f * unit(random);
+            float x = cx + (unit(random) - 0.5f) * size, y = cy + (unit(random) - 0.5f) * size;
+            float z = unit(random) * 1.8f - 0.9f;
+            float vertex[] = { x * w, y * w, z * w, w, unit(random), unit(random), unit(random) };
+            vertices.insert(vertices.end(), vertex, vertex + 7);
+        }
+    }
+    return vertices;
+}
+
+unsigned int compileProgram(const char *vertexSource, const char *fragmentSource)
+{
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+        std::cout << "ERROR::BENCH::PROGRAM_LINKING_ERROR" << std::endl;
+    return program;
+}
+
+// a VAO over vertices with a position of positionSize floats and, if colorOffset >= 0, a colour
+// ------------------------------------------------------------------------
+void createVertexArray(const float *vertices, size_t floats, int stride, int positionSize, int colorOffset, unsigned int &VAO, unsigned int &VBO)
+{
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, floats * sizeof(float), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, positionSize, GL_FLOAT, GL_FALSE, stride * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    if (colorOffset >= 0)
+    {
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride * sizeof(float), (void*)(colorOffset * sizeof(float)));
+        glEnableVertexAttribArray(1);
+    }
+}
+
+void beginGL(bool depth)
+{
+    glClearColor(CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]);
+    glClearDepth(1.0);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    if (depth)
+    {
+        glEnable(GL_DEPTH_TEST);
+        glDepthFunc(GL_LESS);
+    }
+    else
+        glDisable(GL_DEPTH_TEST);
+}
+
+std::vector<uint32_t> readPixels()
+{
+    std::vector<uint32_t> pixels((size_t)WIDTH * HEIGHT);
+    glReadPixels(0, 0, WIDTH, HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    return pixels;
+}
+
+void beginSoftware(Framebuffer &target, Rasterizer &raster, bool depth)
+{
+    target.clearColor(CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]);
+    target.clearDepth(1.0f);
+    raster.enableDepthTest(depth);
+}
+
+// pixels identical, off by one (rounding), or different (coverage or depth order); true when
+// at most maxDifferent of them are different
+// ------------------------------------------------------------------------
+bool compare(const char *name, const std::vector<uint32_t> &gl, const Framebuffer &software, double maxDifferent)
+{
+    size_t exact = 0, nearly = 0, different = 0;
+    int maxDifference = 0;
+    for (size_t i = 0; i < gl.size(); i++)
+    {
+        int worst = 0;
+        for (int c = 0; c < 4; c++)
+            worst = std::max(worst, std::abs((int)(gl[i] >> (8 * c) & 0xFF) - (int)(software.pixels()[i] >> (8 * c) & 0xFF)));
+        if (worst == 0)
+            exact++;
+        else if (worst <= 1)
+            nearly++;
+        else
+            different++;
+        maxDifference = std::max(maxDifference, worst);
+    }
+    char line[200];
+    std::snprintf(line, sizeof(line), "%-8s %9zu exact %7zu off by 1 %7zu different (%.4f%%)  max difference %d",
+                  name, exact, nearly, different, 100.0 * different / gl.size(), maxDifference);
+    bool ok = different <= maxDifferent * gl.size();
+    std::cout << line << (ok ? "" : "  MISMATCH") << "\n";
+    return ok;
+}
+
+double seconds(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main()
+{
+    HeadlessContext context;
+    if (!context.create(WIDTH, HEIGHT))
+        return -1;
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+    glViewport(0, 0, WIDTH, HEIGHT);
+    std::cout << "GL: " << glGetString(GL_RENDERER) << ", " << WIDTH << "x" << HEIGHT << "\n\n";
+
+    Framebuffer target(WIDTH, HEIGHT);
+    Rasterizer raster(target);
+    bool ok = true;
+
+    // the oldmain.cpp triangles
+    for (int s = 0; s < TRIANGLE_SCENE_COUNT; s++)
+    {
+        const TriangleScene &scene = triangleScenes[s];
+        unsigned int program = compileProgram(scene.vertexShaderSource, scene.fragmentShaderSource);
+        unsigned int VAO, VBO;
+        createVertexArray(scene.vertices, (size_t)scene.vertexCount * scene.stride, scene.stride, 3, scene.colorOffset, VAO, VBO);
+        beginGL(false);
+        glUseProgram(program);
+        glUniform4fv(glGetUniformLocation(program, "ourColor"), 1, scene.color);
+        glDrawArrays(GL_TRIANGLES, 0, scene.vertexCount);
+        std::vector<uint32_t> gl = readPixels();
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteProgram(program);
+
+        beginSoftware(target, raster, false);
+        scene.draw(raster);
+        ok = compare(scene.name, gl, target, 0.0) && ok;
+    }
+
+    // stress scene: perspective and depth
+    std::vector<float> stress = stressScene();
+    unsigned int program = compileProgram(perspectiveVertexShaderSource, triangleWithColorFragmentSource);
+    unsigned int VAO, VBO;
+    createVertexArray(stress.data(), stress.size(), 7, 4, 4, VAO, VBO);
+    glUseProgram(program);
+    beginGL(true);
+    glDrawArrays(GL_TRIANGLES, 0, RANDOM_TRIANGLES * 3);
+    std::vector<uint32_t> gl = readPixels();
+
+    Rasterizer::Program stressProgram;
+    stressProgram.vertex = &perspectiveVertex;
+    stressProgram.fragment = &TriangleScene::colorFragment;
+    stressProgram.varyings = 3;
+    raster.vertexAttribPointer(0, 4, 7 * sizeof(float), stress.data());
+    raster.vertexAttribPointer(1, 3, 7 * sizeof(float), stress.data() + 4);
+    raster.useProgram(stressProgram);
+    beginSoftware(target, raster, true);
+    raster.drawArrays(0, RANDOM_TRIANGLES * 3);
+    ok = compare("stress", gl, target, MAX_DIFFERENT) && ok;
+
+    // throughput
+    Clock::time_point start = Clock::now();
+    for (int f = 0; f < FRAMES; f++)
+    {
+        beginGL(true);
+        glDrawArrays(GL_TRIANGLES, 0, RANDOM_TRIANGLES * 3);
+        glFinish();
+    }
+    double glSeconds = seconds(start);
+
+    raster.resetStats();
+    start = Clock::now();
+    for (int f = 0; f < FRAMES; f++)
+    {
+        beginSoftware(target, raster, true);
+        raster.drawArrays(0, RANDOM_TRIANGLES * 3);
+    }
+    double softwareSeconds = seconds(start);
+    const Rasterizer::Stats &stats = raster.stats();
+
+    char line[200];
+    std::cout << "\nstress scene, " << RANDOM_TRIANGLES << " triangles x " << FRAMES << " frames\n";
+    std::snprintf(line, sizeof(line), "software  %8.2f ms/frame  %8.2f Mtris/s  %8.1f Mpixels/s written  (%.1f Mfragments/s covered)",
+                  softwareSeconds * 1000.0 / FRAMES, stats.triangles / softwareSeconds * 1e-6,
+                  stats.pixels / softwareSeconds * 1e-6, stats.fragments / softwareSeconds * 1e-6);
+    std::cout << line << "\n";
+    std::snprintf(line, sizeof(line), "GL        %8.2f ms/frame  %8.2f Mtris/s",
+                  glSeconds * 1000.0 / FRAMES, (double)RANDOM_TRIANGLES * FRAMES / glSeconds * 1e-6);
+    std::cout << line << "\n";
+
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteProgram(program);
+    if (!ok)
+        std::cout << "ERROR::BENCH::SOFTWARE_RASTER_MISMATCH" << std::endl;
+    return ok ? 0 : 1;
+}
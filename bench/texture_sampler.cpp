@@ -0,0 +1,323 @@
+// Software texture sampling (raster/texture.h) against a naive row-major sampler, in samples
+// and filtered texels per second (4 texel reads per LINEAR sample, 8 per LINEAR_MIPMAP_LINEAR).
+//
+// A TEXTURE_SIZE^2 procedural texture with mipmaps is sampled at WIDTH x HEIGHT points in two
+// patterns: "screen" walks the pixels of a rotated plane that recedes from magnified at the
+// bottom to minified at the top (per-pixel lod from its UV derivatives, pixels in row order
+// as a rasteriser visits them), "random" takes random coordinates and lods, which defeats
+// any layout. Each is run with:
+//   naive              scalar, row-major, one texel address computation per read (below)
+//   sample             Texture::sample, one fragment at a time
+//   sample8            Texture::sample8, 8 fragments per call (AVX2 when available)
+// on ROW_MAJOR and SWIZZLED storage. All Texture variants must return identical values.
+//
+// Then the textured rectangle from oldBuilds/main.cpp is drawn with Rasterizer and with
+// BinnedRasterizer (whose fragment8 shader uses sample8) and the two images compared. Exits
+// non-zero if the variants differ or the images by more than 1. --quick (what ctest runs)
+// times one repetition instead of the best of REPETITIONS.
+//
+// g++ -std=c++17 -O2 -Iinclude bench/texture_sampler.cpp -o bench_texture_sampler -lpthread
+// ./bench_texture_sampler [--quick]
+#include <core/job_system.h>
+#include <raster/binned_rasterizer.h>
+#include <raster/framebuffer.h>
+#include <raster/rasterizer.h>
+#include <raster/texture.h>
+#include <raster/textured_rectangle.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Settings
+// _________________________________________________________________________________________________________________________________
+    const int TEXTURE_SIZE = 2048;
+    const int WIDTH = 1280;
+    const int HEIGHT = 720;
+    const int REPETITIONS = 3;      // best of
+    const float CLEAR_COLOR[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+
+// _________________________________________________________________________________________________________________________________
+
+typedef std::chrono::steady_clock Clock;
+
+// the obvious sampler: row-major levels, REPEAT, floor/modulo per read
+// ------------------------------------------------------------------------
+struct NaiveTexture
+{
+    std::vector<std::vector<uint32_t>> levels;
+    std::vector<int> widths, heights;
+
+    explicit NaiveTexture(const Texture &source)
+    {
+        for (int level = 0; level < source.levels(); level++)
+        {
+            int w = source.width(level), h = source.height(level);
+            std::vector<uint32_t> texels((size_t)w * h);
+            for (int y = 0; y < h; y++)
+                for (int x = 0; x < w; x++)
+                    texels[(size_t)y * w + x] = source.texel(level, x, y);
+            levels.push_back(texels);
+            widths.push_back(w);
+            heights.push_back(h);
+        }
+    }
+
+    void bilinear(int level, float u, float v, float *rgba) const
+    {
+        int w = widths[level], h = heights[level];
+        float tx = u * w - 0.5f, ty = v * h - 0.5f;
+        float fx = std::floor(tx), fy = std::floor(ty);
+        float ax = tx - fx, ay = ty - fy;
+        for (int c = 0; c < 4; c++)
+            rgba[c] = 0.0f;
+        for (int j = 0; j < 2; j++)
+            for (int i = 0; i < 2; i++)
+            {
+                int x = (((int)fx + i) % w + w) % w, y = (((int)fy + j) % h + h) % h;
+                uint32_t t = levels[level][(size_t)y * w + x];
+                float weight = (i ? ax : 1.0f - ax) * (j ? ay : 1.0f - ay);
+                for (int c = 0; c < 4; c++)
+                    rgba[c] += weight * (float)(t >> (8 * c) & 0xFF) / 255.0f;
+            }
+    }
+
+    void sample(float u, float v, float lod, bool mipmap, float *rgba) const
+    {
+        float level = mipmap ? std::min(std::max(lod, 0.0f), (float)(levels.size() - 1)) : 0.0f;
+        int base = (int)level;
+        bilinear(base, u, v, rgba);
+        if (level > base)
+        {
+            float upper[4];
+            bilinear(base + 1, u, v, upper);
+            for (int c = 0; c < 4; c++)
+                rgba[c] = rgba[c] * (1.0f - (level - base)) + upper[c] * (level - base);
+        }
+    }
+};
+
+struct Samples
+{
+    std::vector<float> u, v, lod;
+};
+
+// a plane rotated by 30 degrees, receding: texels per pixel grow from 0.5 at the bottom to 8
+// at the top; derivatives are taken along the rows and columns
+// ------------------------------------------------------------------------
+Samples screenSamples(const Texture &texture)
+{
+    Samples samples;
+    const float angle = 0.5236f, c = std::cos(angle), s = std::sin(angle);
+    auto uv = [&](float x, float y, float &u, float &v) {
+        float t = y / HEIGHT;
+        float scale = 0.5f * std::pow(16.0f, t) / TEXTURE_SIZE; // texture units per pixel
+        u = (c * x - s * y) * scale + 0.25f;
+        v = (s * x + c * y) * scale;
+    };
+    for (int y = 0; y < HEIGHT; y++)
+        for (int x = 0; x < WIDTH; x++)
+        {
+            float u, v, ux, vx, uy, vy;
+            uv(x + 0.5f, y + 0.5f, u, v);
+            uv(x + 1.5f, y + 0.5f, ux, vx);
+            uv(x + 0.5f, y + 1.5f, uy, vy);
+            samples.u.push_back(u);
+            samples.v.push_back(v);
+            samples.lod.push_back(texture.lod(ux - u, vx - v, uy - u, vy - v));
+        }
+    return samples;
+}
+
+Samples randomSamples()
+{
+    Samples samples;
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (int i = 0; i < WIDTH * HEIGHT; i++)
+    {
+        samples.u.push_back(unit(random));
+        samples.v.push_back(unit(random));
+        samples.lod.push_back(unit(random) * 6.0f - 1.0f);
+    }
+    return samples;
+}
+
+std::vector<uint32_t> proceduralImage()
+{
+    std::vector<uint32_t> image((size_t)TEXTURE_SIZE * TEXTURE_SIZE);
+    for (int y = 0; y < TEXTURE_SIZE; y++)
+        for (int x = 0; x < TEXTURE_SIZE; x++)
+        {
+            uint32_t checker = ((x >> 5) ^ (y >> 5)) & 1 ? 0xE0 : 0x30;
+            uint32_t r = checker, g = (uint32_t)(x * 255 / TEXTURE_SIZE), b = (uint32_t)((x * 7 + y * 13) & 0xFF);
+            image[(size_t)y * TEXTURE_SIZE + x] = r | g << 8 | b << 16 | 0xFFu << 24;
+        }
+    return image;
+}
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// best of repetitions runs of sampling every point into out (4 floats each, structure of
+// arrays per 8 points as sample8 writes them)
+// ------------------------------------------------------------------------
+template <typename Sampler>
+double run(const Samples &samples, std::vector<float> &out, int repetitions, const Sampler &sampler)
+{
+    double best = 1e9;
+    for (int r = 0; r < repetitions; r++)
+    {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < samples.u.size(); i += 8)
+            sampler(i, out.data() + i * 4);
+        best = std::min(best, secondsSince(start));
+    }
+    return best;
+}
+
+void report(const char *name, double seconds, double texelsPerSample, double baseline)
+{
+    double samples = (double)WIDTH * HEIGHT;
+    char line[200];
+    std::snprintf(line, sizeof(line), "  %-22s %8.2f ms %9.1f Msamples/s %9.1f Mtexels/s %7.2fx",
+                  name, seconds * 1000.0, samples / seconds * 1e-6, samples * texelsPerSample / seconds * 1e-6, baseline / seconds);
+    std::cout << line << "\n";
+}
+
+float maxDifference(const std::vector<float> &a, const std::vector<float> &b)
+{
+    float worst = 0.0f;
+    for (size_t i = 0; i < a.size(); i++)
+        worst = std::max(worst, std::fabs(a[i] - b[i]));
+    return worst;
+}
+
+int main(int argc, char **argv)
+{
+    int repetitions = REPETITIONS;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--quick") != 0)
+        {
+            std::cout << "usage: bench_texture_sampler [--quick]" << std::endl;
+            return 1;
+        }
+        repetitions = 1;
+    }
+
+    std::vector<uint32_t> image = proceduralImage();
+    Texture rowMajor(Texture::ROW_MAJOR), swizzled(Texture::SWIZZLED);
+    Texture *textures[] = { &rowMajor, &swizzled };
+    for (Texture *texture : textures)
+    {
+        texture->setImage(TEXTURE_SIZE, TEXTURE_SIZE, (const unsigned char*)image.data());
+        texture->generateMipmap();
+    }
+    NaiveTexture naive(rowMajor);
+    std::cout << TEXTURE_SIZE << "x" << TEXTURE_SIZE << " texture, " << rowMajor.levels() << " levels, "
+              << WIDTH * HEIGHT << " samples per pattern, AVX2 " << (Texture::simdSupported() ? "on" : "not supported") << "\n";
+
+    bool ok = true;
+    Samples patterns[] = { screenSamples(rowMajor), randomSamples() };
+    const char *patternNames[] = { "screen", "random" };
+    Texture::Filter filters[] = { Texture::LINEAR, Texture::LINEAR_MIPMAP_LINEAR };
+    const char *filterNames[] = { "LINEAR", "LINEAR_MIPMAP_LINEAR" };
+    std::vector<float> expected((size_t)WIDTH * HEIGHT * 4), out(expected.size()), reference(expected.size());
+    for (int p = 0; p < 2; p++)
+        for (int f = 0; f < 2; f++)
+        {
+            const Samples &samples = patterns[p];
+            bool mipmap = filters[f] == Texture::LINEAR_MIPMAP_LINEAR;
+            std::cout << "\n" << patternNames[p] << ", " << filterNames[f] << "\n";
+            double baseline = run(samples, reference, repetitions, [&](size_t i, float *rgba) {
+                float color[4];
+                for (int lane = 0; lane < 8; lane++)
+                {
+                    naive.sample(samples.u[i + lane], samples.v[i + lane], samples.lod[i + lane], mipmap, color);
+                    for (int c = 0; c < 4; c++)
+                        rgba[c * 8 + lane] = color[c];
+                }
+            });
+            report("naive row-major", baseline, mipmap ? 8.0 : 4.0, baseline);
+
+            for (int t = 0; t < 2; t++)
+            {
+                Texture &texture = *textures[t];
+                texture.setFilter(filters[f]);
+                const char *layout = t == 0 ? "row-major" : "swizzled";
+                char name[64];
+                double seconds = run(samples, out, repetitions, [&](size_t i, float *rgba) {
+                    float color[4];
+                    for (int lane = 0; lane < 8; lane++)
+                    {
+                        texture.sample(samples.u[i + lane], samples.v[i + lane], samples.lod[i + lane], color);
+                        for (int c = 0; c < 4; c++)
+                            rgba[c * 8 + lane] = color[c];
+                    }
+                });
+                std::snprintf(name, sizeof(name), "sample %s", layout);
+                report(name, seconds, mipmap ? 8.0 : 4.0, baseline);
+                if (t == 0)
+                    expected = out;
+                else if (out != expected)
+                {
+                    std::cout << "  ERROR::BENCH::LAYOUTS_DIFFER\n";
+                    ok = false;
+                }
+
+                seconds = run(samples, out, repetitions, [&](size_t i, float *rgba) {
+                    texture.sample8(&samples.u[i], &samples.v[i], &samples.lod[i], rgba);
+                });
+                std::snprintf(name, sizeof(name), "sample8 %s", layout);
+                report(name, seconds, mipmap ? 8.0 : 4.0, baseline);
+                if (out != expected)
+                {
+                    std::cout << "  ERROR::BENCH::SAMPLE8_DIFFERS: max difference " << maxDifference(out, expected) << "\n";
+                    ok = false;
+                }
+            }
+            std::cout << "  naive vs Texture: max difference " << maxDifference(reference, expected) << "\n";
+        }
+
+    // the textured rectangle
+    Framebuffer single(WIDTH, HEIGHT), binned(WIDTH, HEIGHT);
+    JobSystem jobs;
+    Rasterizer raster(single);
+    BinnedRasterizer binnedRaster(binned, jobs);
+    swizzled.setFilter(Texture::LINEAR_MIPMAP_LINEAR);
+    TexturedRectangle::Uniforms uniforms = { &swizzled, TexturedRectangle::lod(swizzled, WIDTH, HEIGHT) };
+    double seconds[2];
+    for (int r = 0; r < 2; r++)
+    {
+        Framebuffer &target = r == 0 ? single : binned;
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < repetitions; i++)
+        {
+            target.clearColor(CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]);
+            if (r == 0)
+                TexturedRectangle::draw(raster, uniforms);
+            else
+                TexturedRectangle::draw(binnedRaster, uniforms);
+        }
+        seconds[r] = secondsSince(start) / repetitions;
+    }
+    int worst = 0;
+    for (size_t i = 0; i < (size_t)WIDTH * HEIGHT; i++)
+        for (int c = 0; c < 4; c++)
+            worst = std::max(worst, std::abs((int)(single.pixels()[i] >> (8 * c) & 0xFF) - (int)(binned.pixels()[i] >> (8 * c) & 0xFF)));
+    char line[200];
+    std::snprintf(line, sizeof(line), "\ntextured rectangle, lod %.2f: Rasterizer %.2f ms, BinnedRasterizer %.2f ms, max difference %d",
+                  uniforms.lod, seconds[0] * 1000.0, seconds[1] * 1000.0, worst);
+    std::cout << line << "\n";
+    ok = ok && worst <= 1;
+    return ok ? 0 : 1;
+}
@@ -90,6 +90,23 @@ public:
     { 
         glUniform1f(glGetUniformLocation(ID, name.c_str()), value); 
     }
+    // the same for plain C strings (literals, FrameArena::format() names): no std::string
+    // temporary is built per call
+    // ------------------------------------------------------------------------
+    void setBool(const char *name, bool value) const
+    {
+        glUniform1i(glGetUniformLocation(ID, name), (int)value);
+    }
+    // ------------------------------------------------------------------------
+    void setInt(const char *name, int value) const
+    {
+        glUniform1i(glGetUniformLocation(ID, name), value);
+    }
+    // ------------------------------------------------------------------------
+    void setFloat(const char *name, float value) const
+    {
+        glUniform1f(glGetUniformLocation(ID, name), value);
+    }
 
 private:
     // utility function for checking shader compilation/linking errors.
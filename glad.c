@@ -7,16 +7,20 @@
     APIs: gl=3.3
     Profile: compatibility
     Extensions:
-        
+        GL_ARB_buffer_storage,
+        GL_ARB_draw_indirect,
+        GL_ARB_get_program_binary,
+        GL_ARB_multi_draw_indirect,
+        GL_KHR_debug
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_draw_indirect,GL_ARB_get_program_binary,GL_ARB_multi_draw_indirect,GL_KHR_debug"
     Online:
-        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_draw_indirect&extensions=GL_ARB_get_program_binary&extensions=GL_ARB_multi_draw_indirect&extensions=GL_KHR_debug
 */
 
 #include <stdio.h>
@@ -267,6 +271,11 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
+int GLAD_GL_ARB_draw_indirect = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_ARB_multi_draw_indirect = 0;
+int GLAD_GL_KHR_debug = 0;
 PFNGLACCUMPROC glad_glAccum = NULL;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
 PFNGLALPHAFUNCPROC glad_glAlphaFunc = NULL;
@@ -991,6 +1000,24 @@ PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
 PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
 PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
 PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
+PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1754,9 +1781,46 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_draw_indirect) return;
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_ARB_multi_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
+static void load_GL_KHR_debug(GLADloadproc load) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
+	GLAD_GL_ARB_draw_indirect = has_ext("GL_ARB_draw_indirect");
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_ARB_multi_draw_indirect = has_ext("GL_ARB_multi_draw_indirect");
+	GLAD_GL_KHR_debug = has_ext("GL_KHR_debug");
 	free_exts();
 	return 1;
 }
@@ -1815,6 +1879,24 @@ static void find_coreGL(void) {
 	}
 }
 
+unsigned int gladCapabilities = 0;
+
+/* extensions promoted to core count as present when the context version has them */
+static void find_capabilitiesGL(void) {
+	int version = GLVersion.major * 10 + GLVersion.minor;
+	if(version >= 40) GLAD_GL_ARB_draw_indirect = 1;
+	if(version >= 41) GLAD_GL_ARB_get_program_binary = 1;
+	if(version >= 43) GLAD_GL_ARB_multi_draw_indirect = 1;
+	if(version >= 43) GLAD_GL_KHR_debug = 1;
+	if(version >= 44) GLAD_GL_ARB_buffer_storage = 1;
+	gladCapabilities = 0;
+	if(GLAD_GL_ARB_buffer_storage) gladCapabilities |= GLAD_CAP_ARB_BUFFER_STORAGE;
+	if(GLAD_GL_ARB_draw_indirect) gladCapabilities |= GLAD_CAP_ARB_DRAW_INDIRECT;
+	if(GLAD_GL_ARB_get_program_binary) gladCapabilities |= GLAD_CAP_ARB_GET_PROGRAM_BINARY;
+	if(GLAD_GL_ARB_multi_draw_indirect) gladCapabilities |= GLAD_CAP_ARB_MULTI_DRAW_INDIRECT;
+	if(GLAD_GL_KHR_debug) gladCapabilities |= GLAD_CAP_KHR_DEBUG;
+}
+
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
@@ -1835,6 +1917,9088 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	find_capabilitiesGL();
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_draw_indirect(load);
+	load_GL_ARB_get_program_binary(load);
+	load_GL_ARB_multi_draw_indirect(load);
+	load_GL_KHR_debug(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+static GLADloadproc glad_lazy_loader = NULL;
+
+/* a trampoline only exists for a version or extension the context reported, so a NULL entry
+   point is a broken driver or loader: report it and stop rather than call through NULL */
+static void* glad_lazy_resolve(const char *name, void **slot, void *trampoline) {
+	void *proc = glad_lazy_loader != NULL ? glad_lazy_loader(name) : NULL;
+	if(proc == NULL) {
+		fprintf(stderr, "ERROR::GL::MISSING_PROC %s\n", name);
+		fflush(stderr);
+		abort();
+	}
+	/* leave the slot alone if someone (e.g. a state cache) has wrapped it in the meantime */
+	if(*slot == trampoline) *slot = proc;
+	return proc;
+}
+
+/* ---- lazy loader: generated by tools/glad_lazy.py, do not edit ---- */
+
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+	static PFNGLCULLFACEPROC fn = NULL; if(fn == NULL) fn = (PFNGLCULLFACEPROC)glad_lazy_resolve("glCullFace", (void**)&glad_glCullFace, (void*)glad_lazy_glCullFace);
+	fn(mode);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+	static PFNGLFRONTFACEPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRONTFACEPROC)glad_lazy_resolve("glFrontFace", (void**)&glad_glFrontFace, (void*)glad_lazy_glFrontFace);
+	fn(mode);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+	static PFNGLHINTPROC fn = NULL; if(fn == NULL) fn = (PFNGLHINTPROC)glad_lazy_resolve("glHint", (void**)&glad_glHint, (void*)glad_lazy_glHint);
+	fn(target, mode);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+	static PFNGLLINEWIDTHPROC fn = NULL; if(fn == NULL) fn = (PFNGLLINEWIDTHPROC)glad_lazy_resolve("glLineWidth", (void**)&glad_glLineWidth, (void*)glad_lazy_glLineWidth);
+	fn(width);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+	static PFNGLPOINTSIZEPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOINTSIZEPROC)glad_lazy_resolve("glPointSize", (void**)&glad_glPointSize, (void*)glad_lazy_glPointSize);
+	fn(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	static PFNGLPOLYGONMODEPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOLYGONMODEPROC)glad_lazy_resolve("glPolygonMode", (void**)&glad_glPolygonMode, (void*)glad_lazy_glPolygonMode);
+	fn(face, mode);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	static PFNGLSCISSORPROC fn = NULL; if(fn == NULL) fn = (PFNGLSCISSORPROC)glad_lazy_resolve("glScissor", (void**)&glad_glScissor, (void*)glad_lazy_glScissor);
+	fn(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	static PFNGLTEXPARAMETERFPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXPARAMETERFPROC)glad_lazy_resolve("glTexParameterf", (void**)&glad_glTexParameterf, (void*)glad_lazy_glTexParameterf);
+	fn(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	static PFNGLTEXPARAMETERFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve("glTexParameterfv", (void**)&glad_glTexParameterfv, (void*)glad_lazy_glTexParameterfv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	static PFNGLTEXPARAMETERIPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXPARAMETERIPROC)glad_lazy_resolve("glTexParameteri", (void**)&glad_glTexParameteri, (void*)glad_lazy_glTexParameteri);
+	fn(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	static PFNGLTEXPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve("glTexParameteriv", (void**)&glad_glTexParameteriv, (void*)glad_lazy_glTexParameteriv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	static PFNGLTEXIMAGE1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXIMAGE1DPROC)glad_lazy_resolve("glTexImage1D", (void**)&glad_glTexImage1D, (void*)glad_lazy_glTexImage1D);
+	fn(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	static PFNGLTEXIMAGE2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXIMAGE2DPROC)glad_lazy_resolve("glTexImage2D", (void**)&glad_glTexImage2D, (void*)glad_lazy_glTexImage2D);
+	fn(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+	static PFNGLDRAWBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWBUFFERPROC)glad_lazy_resolve("glDrawBuffer", (void**)&glad_glDrawBuffer, (void*)glad_lazy_glDrawBuffer);
+	fn(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+	static PFNGLCLEARPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARPROC)glad_lazy_resolve("glClear", (void**)&glad_glClear, (void*)glad_lazy_glClear);
+	fn(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	static PFNGLCLEARCOLORPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARCOLORPROC)glad_lazy_resolve("glClearColor", (void**)&glad_glClearColor, (void*)glad_lazy_glClearColor);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+	static PFNGLCLEARSTENCILPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARSTENCILPROC)glad_lazy_resolve("glClearStencil", (void**)&glad_glClearStencil, (void*)glad_lazy_glClearStencil);
+	fn(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+	static PFNGLCLEARDEPTHPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARDEPTHPROC)glad_lazy_resolve("glClearDepth", (void**)&glad_glClearDepth, (void*)glad_lazy_glClearDepth);
+	fn(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+	static PFNGLSTENCILMASKPROC fn = NULL; if(fn == NULL) fn = (PFNGLSTENCILMASKPROC)glad_lazy_resolve("glStencilMask", (void**)&glad_glStencilMask, (void*)glad_lazy_glStencilMask);
+	fn(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	static PFNGLCOLORMASKPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORMASKPROC)glad_lazy_resolve("glColorMask", (void**)&glad_glColorMask, (void*)glad_lazy_glColorMask);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+	static PFNGLDEPTHMASKPROC fn = NULL; if(fn == NULL) fn = (PFNGLDEPTHMASKPROC)glad_lazy_resolve("glDepthMask", (void**)&glad_glDepthMask, (void*)glad_lazy_glDepthMask);
+	fn(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+	static PFNGLDISABLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLDISABLEPROC)glad_lazy_resolve("glDisable", (void**)&glad_glDisable, (void*)glad_lazy_glDisable);
+	fn(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+	static PFNGLENABLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLENABLEPROC)glad_lazy_resolve("glEnable", (void**)&glad_glEnable, (void*)glad_lazy_glEnable);
+	fn(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	static PFNGLFINISHPROC fn = NULL; if(fn == NULL) fn = (PFNGLFINISHPROC)glad_lazy_resolve("glFinish", (void**)&glad_glFinish, (void*)glad_lazy_glFinish);
+	fn();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	static PFNGLFLUSHPROC fn = NULL; if(fn == NULL) fn = (PFNGLFLUSHPROC)glad_lazy_resolve("glFlush", (void**)&glad_glFlush, (void*)glad_lazy_glFlush);
+	fn();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	static PFNGLBLENDFUNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLBLENDFUNCPROC)glad_lazy_resolve("glBlendFunc", (void**)&glad_glBlendFunc, (void*)glad_lazy_glBlendFunc);
+	fn(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+	static PFNGLLOGICOPPROC fn = NULL; if(fn == NULL) fn = (PFNGLLOGICOPPROC)glad_lazy_resolve("glLogicOp", (void**)&glad_glLogicOp, (void*)glad_lazy_glLogicOp);
+	fn(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	static PFNGLSTENCILFUNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLSTENCILFUNCPROC)glad_lazy_resolve("glStencilFunc", (void**)&glad_glStencilFunc, (void*)glad_lazy_glStencilFunc);
+	fn(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	static PFNGLSTENCILOPPROC fn = NULL; if(fn == NULL) fn = (PFNGLSTENCILOPPROC)glad_lazy_resolve("glStencilOp", (void**)&glad_glStencilOp, (void*)glad_lazy_glStencilOp);
+	fn(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+	static PFNGLDEPTHFUNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLDEPTHFUNCPROC)glad_lazy_resolve("glDepthFunc", (void**)&glad_glDepthFunc, (void*)glad_lazy_glDepthFunc);
+	fn(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	static PFNGLPIXELSTOREFPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELSTOREFPROC)glad_lazy_resolve("glPixelStoref", (void**)&glad_glPixelStoref, (void*)glad_lazy_glPixelStoref);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+	static PFNGLPIXELSTOREIPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELSTOREIPROC)glad_lazy_resolve("glPixelStorei", (void**)&glad_glPixelStorei, (void*)glad_lazy_glPixelStorei);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+	static PFNGLREADBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLREADBUFFERPROC)glad_lazy_resolve("glReadBuffer", (void**)&glad_glReadBuffer, (void*)glad_lazy_glReadBuffer);
+	fn(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	static PFNGLREADPIXELSPROC fn = NULL; if(fn == NULL) fn = (PFNGLREADPIXELSPROC)glad_lazy_resolve("glReadPixels", (void**)&glad_glReadPixels, (void*)glad_lazy_glReadPixels);
+	fn(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	static PFNGLGETBOOLEANVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETBOOLEANVPROC)glad_lazy_resolve("glGetBooleanv", (void**)&glad_glGetBooleanv, (void*)glad_lazy_glGetBooleanv);
+	fn(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	static PFNGLGETDOUBLEVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETDOUBLEVPROC)glad_lazy_resolve("glGetDoublev", (void**)&glad_glGetDoublev, (void*)glad_lazy_glGetDoublev);
+	fn(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	static PFNGLGETERRORPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETERRORPROC)glad_lazy_resolve("glGetError", (void**)&glad_glGetError, (void*)glad_lazy_glGetError);
+	return fn();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	static PFNGLGETFLOATVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETFLOATVPROC)glad_lazy_resolve("glGetFloatv", (void**)&glad_glGetFloatv, (void*)glad_lazy_glGetFloatv);
+	fn(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	static PFNGLGETINTEGERVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETINTEGERVPROC)glad_lazy_resolve("glGetIntegerv", (void**)&glad_glGetIntegerv, (void*)glad_lazy_glGetIntegerv);
+	fn(pname, data);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	static PFNGLGETTEXIMAGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXIMAGEPROC)glad_lazy_resolve("glGetTexImage", (void**)&glad_glGetTexImage, (void*)glad_lazy_glGetTexImage);
+	fn(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	static PFNGLGETTEXPARAMETERFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve("glGetTexParameterfv", (void**)&glad_glGetTexParameterfv, (void*)glad_lazy_glGetTexParameterfv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	static PFNGLGETTEXPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve("glGetTexParameteriv", (void**)&glad_glGetTexParameteriv, (void*)glad_lazy_glGetTexParameteriv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	static PFNGLGETTEXLEVELPARAMETERFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTexLevelParameterfv", (void**)&glad_glGetTexLevelParameterfv, (void*)glad_lazy_glGetTexLevelParameterfv);
+	fn(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	static PFNGLGETTEXLEVELPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTexLevelParameteriv", (void**)&glad_glGetTexLevelParameteriv, (void*)glad_lazy_glGetTexLevelParameteriv);
+	fn(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+	static PFNGLISENABLEDPROC fn = NULL; if(fn == NULL) fn = (PFNGLISENABLEDPROC)glad_lazy_resolve("glIsEnabled", (void**)&glad_glIsEnabled, (void*)glad_lazy_glIsEnabled);
+	return fn(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	static PFNGLDEPTHRANGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLDEPTHRANGEPROC)glad_lazy_resolve("glDepthRange", (void**)&glad_glDepthRange, (void*)glad_lazy_glDepthRange);
+	fn(n, f);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	static PFNGLVIEWPORTPROC fn = NULL; if(fn == NULL) fn = (PFNGLVIEWPORTPROC)glad_lazy_resolve("glViewport", (void**)&glad_glViewport, (void*)glad_lazy_glViewport);
+	fn(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glNewList(GLuint list, GLenum mode) {
+	static PFNGLNEWLISTPROC fn = NULL; if(fn == NULL) fn = (PFNGLNEWLISTPROC)glad_lazy_resolve("glNewList", (void**)&glad_glNewList, (void*)glad_lazy_glNewList);
+	fn(list, mode);
+}
+static void APIENTRY glad_lazy_glEndList(void) {
+	static PFNGLENDLISTPROC fn = NULL; if(fn == NULL) fn = (PFNGLENDLISTPROC)glad_lazy_resolve("glEndList", (void**)&glad_glEndList, (void*)glad_lazy_glEndList);
+	fn();
+}
+static void APIENTRY glad_lazy_glCallList(GLuint list) {
+	static PFNGLCALLLISTPROC fn = NULL; if(fn == NULL) fn = (PFNGLCALLLISTPROC)glad_lazy_resolve("glCallList", (void**)&glad_glCallList, (void*)glad_lazy_glCallList);
+	fn(list);
+}
+static void APIENTRY glad_lazy_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	static PFNGLCALLLISTSPROC fn = NULL; if(fn == NULL) fn = (PFNGLCALLLISTSPROC)glad_lazy_resolve("glCallLists", (void**)&glad_glCallLists, (void*)glad_lazy_glCallLists);
+	fn(n, type, lists);
+}
+static void APIENTRY glad_lazy_glDeleteLists(GLuint list, GLsizei range) {
+	static PFNGLDELETELISTSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETELISTSPROC)glad_lazy_resolve("glDeleteLists", (void**)&glad_glDeleteLists, (void*)glad_lazy_glDeleteLists);
+	fn(list, range);
+}
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei range) {
+	static PFNGLGENLISTSPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENLISTSPROC)glad_lazy_resolve("glGenLists", (void**)&glad_glGenLists, (void*)glad_lazy_glGenLists);
+	return fn(range);
+}
+static void APIENTRY glad_lazy_glListBase(GLuint base) {
+	static PFNGLLISTBASEPROC fn = NULL; if(fn == NULL) fn = (PFNGLLISTBASEPROC)glad_lazy_resolve("glListBase", (void**)&glad_glListBase, (void*)glad_lazy_glListBase);
+	fn(base);
+}
+static void APIENTRY glad_lazy_glBegin(GLenum mode) {
+	static PFNGLBEGINPROC fn = NULL; if(fn == NULL) fn = (PFNGLBEGINPROC)glad_lazy_resolve("glBegin", (void**)&glad_glBegin, (void*)glad_lazy_glBegin);
+	fn(mode);
+}
+static void APIENTRY glad_lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	static PFNGLBITMAPPROC fn = NULL; if(fn == NULL) fn = (PFNGLBITMAPPROC)glad_lazy_resolve("glBitmap", (void**)&glad_glBitmap, (void*)glad_lazy_glBitmap);
+	fn(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY glad_lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	static PFNGLCOLOR3BPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3BPROC)glad_lazy_resolve("glColor3b", (void**)&glad_glColor3b, (void*)glad_lazy_glColor3b);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte *v) {
+	static PFNGLCOLOR3BVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3BVPROC)glad_lazy_resolve("glColor3bv", (void**)&glad_glColor3bv, (void*)glad_lazy_glColor3bv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	static PFNGLCOLOR3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3DPROC)glad_lazy_resolve("glColor3d", (void**)&glad_glColor3d, (void*)glad_lazy_glColor3d);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble *v) {
+	static PFNGLCOLOR3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3DVPROC)glad_lazy_resolve("glColor3dv", (void**)&glad_glColor3dv, (void*)glad_lazy_glColor3dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	static PFNGLCOLOR3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3FPROC)glad_lazy_resolve("glColor3f", (void**)&glad_glColor3f, (void*)glad_lazy_glColor3f);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat *v) {
+	static PFNGLCOLOR3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3FVPROC)glad_lazy_resolve("glColor3fv", (void**)&glad_glColor3fv, (void*)glad_lazy_glColor3fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor3i(GLint red, GLint green, GLint blue) {
+	static PFNGLCOLOR3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3IPROC)glad_lazy_resolve("glColor3i", (void**)&glad_glColor3i, (void*)glad_lazy_glColor3i);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3iv(const GLint *v) {
+	static PFNGLCOLOR3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3IVPROC)glad_lazy_resolve("glColor3iv", (void**)&glad_glColor3iv, (void*)glad_lazy_glColor3iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	static PFNGLCOLOR3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3SPROC)glad_lazy_resolve("glColor3s", (void**)&glad_glColor3s, (void*)glad_lazy_glColor3s);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3sv(const GLshort *v) {
+	static PFNGLCOLOR3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3SVPROC)glad_lazy_resolve("glColor3sv", (void**)&glad_glColor3sv, (void*)glad_lazy_glColor3sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	static PFNGLCOLOR3UBPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3UBPROC)glad_lazy_resolve("glColor3ub", (void**)&glad_glColor3ub, (void*)glad_lazy_glColor3ub);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte *v) {
+	static PFNGLCOLOR3UBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3UBVPROC)glad_lazy_resolve("glColor3ubv", (void**)&glad_glColor3ubv, (void*)glad_lazy_glColor3ubv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	static PFNGLCOLOR3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3UIPROC)glad_lazy_resolve("glColor3ui", (void**)&glad_glColor3ui, (void*)glad_lazy_glColor3ui);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint *v) {
+	static PFNGLCOLOR3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3UIVPROC)glad_lazy_resolve("glColor3uiv", (void**)&glad_glColor3uiv, (void*)glad_lazy_glColor3uiv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	static PFNGLCOLOR3USPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3USPROC)glad_lazy_resolve("glColor3us", (void**)&glad_glColor3us, (void*)glad_lazy_glColor3us);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3usv(const GLushort *v) {
+	static PFNGLCOLOR3USVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR3USVPROC)glad_lazy_resolve("glColor3usv", (void**)&glad_glColor3usv, (void*)glad_lazy_glColor3usv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	static PFNGLCOLOR4BPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4BPROC)glad_lazy_resolve("glColor4b", (void**)&glad_glColor4b, (void*)glad_lazy_glColor4b);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte *v) {
+	static PFNGLCOLOR4BVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4BVPROC)glad_lazy_resolve("glColor4bv", (void**)&glad_glColor4bv, (void*)glad_lazy_glColor4bv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	static PFNGLCOLOR4DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4DPROC)glad_lazy_resolve("glColor4d", (void**)&glad_glColor4d, (void*)glad_lazy_glColor4d);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble *v) {
+	static PFNGLCOLOR4DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4DVPROC)glad_lazy_resolve("glColor4dv", (void**)&glad_glColor4dv, (void*)glad_lazy_glColor4dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	static PFNGLCOLOR4FPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4FPROC)glad_lazy_resolve("glColor4f", (void**)&glad_glColor4f, (void*)glad_lazy_glColor4f);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat *v) {
+	static PFNGLCOLOR4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4FVPROC)glad_lazy_resolve("glColor4fv", (void**)&glad_glColor4fv, (void*)glad_lazy_glColor4fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	static PFNGLCOLOR4IPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4IPROC)glad_lazy_resolve("glColor4i", (void**)&glad_glColor4i, (void*)glad_lazy_glColor4i);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4iv(const GLint *v) {
+	static PFNGLCOLOR4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4IVPROC)glad_lazy_resolve("glColor4iv", (void**)&glad_glColor4iv, (void*)glad_lazy_glColor4iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	static PFNGLCOLOR4SPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4SPROC)glad_lazy_resolve("glColor4s", (void**)&glad_glColor4s, (void*)glad_lazy_glColor4s);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4sv(const GLshort *v) {
+	static PFNGLCOLOR4SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4SVPROC)glad_lazy_resolve("glColor4sv", (void**)&glad_glColor4sv, (void*)glad_lazy_glColor4sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	static PFNGLCOLOR4UBPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4UBPROC)glad_lazy_resolve("glColor4ub", (void**)&glad_glColor4ub, (void*)glad_lazy_glColor4ub);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte *v) {
+	static PFNGLCOLOR4UBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4UBVPROC)glad_lazy_resolve("glColor4ubv", (void**)&glad_glColor4ubv, (void*)glad_lazy_glColor4ubv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	static PFNGLCOLOR4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4UIPROC)glad_lazy_resolve("glColor4ui", (void**)&glad_glColor4ui, (void*)glad_lazy_glColor4ui);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint *v) {
+	static PFNGLCOLOR4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4UIVPROC)glad_lazy_resolve("glColor4uiv", (void**)&glad_glColor4uiv, (void*)glad_lazy_glColor4uiv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	static PFNGLCOLOR4USPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4USPROC)glad_lazy_resolve("glColor4us", (void**)&glad_glColor4us, (void*)glad_lazy_glColor4us);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4usv(const GLushort *v) {
+	static PFNGLCOLOR4USVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLOR4USVPROC)glad_lazy_resolve("glColor4usv", (void**)&glad_glColor4usv, (void*)glad_lazy_glColor4usv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean flag) {
+	static PFNGLEDGEFLAGPROC fn = NULL; if(fn == NULL) fn = (PFNGLEDGEFLAGPROC)glad_lazy_resolve("glEdgeFlag", (void**)&glad_glEdgeFlag, (void*)glad_lazy_glEdgeFlag);
+	fn(flag);
+}
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean *flag) {
+	static PFNGLEDGEFLAGVPROC fn = NULL; if(fn == NULL) fn = (PFNGLEDGEFLAGVPROC)glad_lazy_resolve("glEdgeFlagv", (void**)&glad_glEdgeFlagv, (void*)glad_lazy_glEdgeFlagv);
+	fn(flag);
+}
+static void APIENTRY glad_lazy_glEnd(void) {
+	static PFNGLENDPROC fn = NULL; if(fn == NULL) fn = (PFNGLENDPROC)glad_lazy_resolve("glEnd", (void**)&glad_glEnd, (void*)glad_lazy_glEnd);
+	fn();
+}
+static void APIENTRY glad_lazy_glIndexd(GLdouble c) {
+	static PFNGLINDEXDPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXDPROC)glad_lazy_resolve("glIndexd", (void**)&glad_glIndexd, (void*)glad_lazy_glIndexd);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble *c) {
+	static PFNGLINDEXDVPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXDVPROC)glad_lazy_resolve("glIndexdv", (void**)&glad_glIndexdv, (void*)glad_lazy_glIndexdv);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexf(GLfloat c) {
+	static PFNGLINDEXFPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXFPROC)glad_lazy_resolve("glIndexf", (void**)&glad_glIndexf, (void*)glad_lazy_glIndexf);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat *c) {
+	static PFNGLINDEXFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXFVPROC)glad_lazy_resolve("glIndexfv", (void**)&glad_glIndexfv, (void*)glad_lazy_glIndexfv);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexi(GLint c) {
+	static PFNGLINDEXIPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXIPROC)glad_lazy_resolve("glIndexi", (void**)&glad_glIndexi, (void*)glad_lazy_glIndexi);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexiv(const GLint *c) {
+	static PFNGLINDEXIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXIVPROC)glad_lazy_resolve("glIndexiv", (void**)&glad_glIndexiv, (void*)glad_lazy_glIndexiv);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexs(GLshort c) {
+	static PFNGLINDEXSPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXSPROC)glad_lazy_resolve("glIndexs", (void**)&glad_glIndexs, (void*)glad_lazy_glIndexs);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexsv(const GLshort *c) {
+	static PFNGLINDEXSVPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXSVPROC)glad_lazy_resolve("glIndexsv", (void**)&glad_glIndexsv, (void*)glad_lazy_glIndexsv);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	static PFNGLNORMAL3BPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3BPROC)glad_lazy_resolve("glNormal3b", (void**)&glad_glNormal3b, (void*)glad_lazy_glNormal3b);
+	fn(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte *v) {
+	static PFNGLNORMAL3BVPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3BVPROC)glad_lazy_resolve("glNormal3bv", (void**)&glad_glNormal3bv, (void*)glad_lazy_glNormal3bv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	static PFNGLNORMAL3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3DPROC)glad_lazy_resolve("glNormal3d", (void**)&glad_glNormal3d, (void*)glad_lazy_glNormal3d);
+	fn(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble *v) {
+	static PFNGLNORMAL3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3DVPROC)glad_lazy_resolve("glNormal3dv", (void**)&glad_glNormal3dv, (void*)glad_lazy_glNormal3dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	static PFNGLNORMAL3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3FPROC)glad_lazy_resolve("glNormal3f", (void**)&glad_glNormal3f, (void*)glad_lazy_glNormal3f);
+	fn(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat *v) {
+	static PFNGLNORMAL3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3FVPROC)glad_lazy_resolve("glNormal3fv", (void**)&glad_glNormal3fv, (void*)glad_lazy_glNormal3fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	static PFNGLNORMAL3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3IPROC)glad_lazy_resolve("glNormal3i", (void**)&glad_glNormal3i, (void*)glad_lazy_glNormal3i);
+	fn(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3iv(const GLint *v) {
+	static PFNGLNORMAL3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3IVPROC)glad_lazy_resolve("glNormal3iv", (void**)&glad_glNormal3iv, (void*)glad_lazy_glNormal3iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	static PFNGLNORMAL3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3SPROC)glad_lazy_resolve("glNormal3s", (void**)&glad_glNormal3s, (void*)glad_lazy_glNormal3s);
+	fn(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort *v) {
+	static PFNGLNORMAL3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMAL3SVPROC)glad_lazy_resolve("glNormal3sv", (void**)&glad_glNormal3sv, (void*)glad_lazy_glNormal3sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble x, GLdouble y) {
+	static PFNGLRASTERPOS2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2DPROC)glad_lazy_resolve("glRasterPos2d", (void**)&glad_glRasterPos2d, (void*)glad_lazy_glRasterPos2d);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble *v) {
+	static PFNGLRASTERPOS2DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2DVPROC)glad_lazy_resolve("glRasterPos2dv", (void**)&glad_glRasterPos2dv, (void*)glad_lazy_glRasterPos2dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat x, GLfloat y) {
+	static PFNGLRASTERPOS2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2FPROC)glad_lazy_resolve("glRasterPos2f", (void**)&glad_glRasterPos2f, (void*)glad_lazy_glRasterPos2f);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat *v) {
+	static PFNGLRASTERPOS2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2FVPROC)glad_lazy_resolve("glRasterPos2fv", (void**)&glad_glRasterPos2fv, (void*)glad_lazy_glRasterPos2fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2i(GLint x, GLint y) {
+	static PFNGLRASTERPOS2IPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2IPROC)glad_lazy_resolve("glRasterPos2i", (void**)&glad_glRasterPos2i, (void*)glad_lazy_glRasterPos2i);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint *v) {
+	static PFNGLRASTERPOS2IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2IVPROC)glad_lazy_resolve("glRasterPos2iv", (void**)&glad_glRasterPos2iv, (void*)glad_lazy_glRasterPos2iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort x, GLshort y) {
+	static PFNGLRASTERPOS2SPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2SPROC)glad_lazy_resolve("glRasterPos2s", (void**)&glad_glRasterPos2s, (void*)glad_lazy_glRasterPos2s);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort *v) {
+	static PFNGLRASTERPOS2SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS2SVPROC)glad_lazy_resolve("glRasterPos2sv", (void**)&glad_glRasterPos2sv, (void*)glad_lazy_glRasterPos2sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	static PFNGLRASTERPOS3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3DPROC)glad_lazy_resolve("glRasterPos3d", (void**)&glad_glRasterPos3d, (void*)glad_lazy_glRasterPos3d);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble *v) {
+	static PFNGLRASTERPOS3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3DVPROC)glad_lazy_resolve("glRasterPos3dv", (void**)&glad_glRasterPos3dv, (void*)glad_lazy_glRasterPos3dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	static PFNGLRASTERPOS3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3FPROC)glad_lazy_resolve("glRasterPos3f", (void**)&glad_glRasterPos3f, (void*)glad_lazy_glRasterPos3f);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat *v) {
+	static PFNGLRASTERPOS3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3FVPROC)glad_lazy_resolve("glRasterPos3fv", (void**)&glad_glRasterPos3fv, (void*)glad_lazy_glRasterPos3fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3i(GLint x, GLint y, GLint z) {
+	static PFNGLRASTERPOS3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3IPROC)glad_lazy_resolve("glRasterPos3i", (void**)&glad_glRasterPos3i, (void*)glad_lazy_glRasterPos3i);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint *v) {
+	static PFNGLRASTERPOS3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3IVPROC)glad_lazy_resolve("glRasterPos3iv", (void**)&glad_glRasterPos3iv, (void*)glad_lazy_glRasterPos3iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	static PFNGLRASTERPOS3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3SPROC)glad_lazy_resolve("glRasterPos3s", (void**)&glad_glRasterPos3s, (void*)glad_lazy_glRasterPos3s);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort *v) {
+	static PFNGLRASTERPOS3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS3SVPROC)glad_lazy_resolve("glRasterPos3sv", (void**)&glad_glRasterPos3sv, (void*)glad_lazy_glRasterPos3sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	static PFNGLRASTERPOS4DPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4DPROC)glad_lazy_resolve("glRasterPos4d", (void**)&glad_glRasterPos4d, (void*)glad_lazy_glRasterPos4d);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble *v) {
+	static PFNGLRASTERPOS4DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4DVPROC)glad_lazy_resolve("glRasterPos4dv", (void**)&glad_glRasterPos4dv, (void*)glad_lazy_glRasterPos4dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	static PFNGLRASTERPOS4FPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4FPROC)glad_lazy_resolve("glRasterPos4f", (void**)&glad_glRasterPos4f, (void*)glad_lazy_glRasterPos4f);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat *v) {
+	static PFNGLRASTERPOS4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4FVPROC)glad_lazy_resolve("glRasterPos4fv", (void**)&glad_glRasterPos4fv, (void*)glad_lazy_glRasterPos4fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	static PFNGLRASTERPOS4IPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4IPROC)glad_lazy_resolve("glRasterPos4i", (void**)&glad_glRasterPos4i, (void*)glad_lazy_glRasterPos4i);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint *v) {
+	static PFNGLRASTERPOS4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4IVPROC)glad_lazy_resolve("glRasterPos4iv", (void**)&glad_glRasterPos4iv, (void*)glad_lazy_glRasterPos4iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	static PFNGLRASTERPOS4SPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4SPROC)glad_lazy_resolve("glRasterPos4s", (void**)&glad_glRasterPos4s, (void*)glad_lazy_glRasterPos4s);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort *v) {
+	static PFNGLRASTERPOS4SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRASTERPOS4SVPROC)glad_lazy_resolve("glRasterPos4sv", (void**)&glad_glRasterPos4sv, (void*)glad_lazy_glRasterPos4sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	static PFNGLRECTDPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTDPROC)glad_lazy_resolve("glRectd", (void**)&glad_glRectd, (void*)glad_lazy_glRectd);
+	fn(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	static PFNGLRECTDVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTDVPROC)glad_lazy_resolve("glRectdv", (void**)&glad_glRectdv, (void*)glad_lazy_glRectdv);
+	fn(v1, v2);
+}
+static void APIENTRY glad_lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	static PFNGLRECTFPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTFPROC)glad_lazy_resolve("glRectf", (void**)&glad_glRectf, (void*)glad_lazy_glRectf);
+	fn(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	static PFNGLRECTFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTFVPROC)glad_lazy_resolve("glRectfv", (void**)&glad_glRectfv, (void*)glad_lazy_glRectfv);
+	fn(v1, v2);
+}
+static void APIENTRY glad_lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	static PFNGLRECTIPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTIPROC)glad_lazy_resolve("glRecti", (void**)&glad_glRecti, (void*)glad_lazy_glRecti);
+	fn(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectiv(const GLint *v1, const GLint *v2) {
+	static PFNGLRECTIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTIVPROC)glad_lazy_resolve("glRectiv", (void**)&glad_glRectiv, (void*)glad_lazy_glRectiv);
+	fn(v1, v2);
+}
+static void APIENTRY glad_lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	static PFNGLRECTSPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTSPROC)glad_lazy_resolve("glRects", (void**)&glad_glRects, (void*)glad_lazy_glRects);
+	fn(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectsv(const GLshort *v1, const GLshort *v2) {
+	static PFNGLRECTSVPROC fn = NULL; if(fn == NULL) fn = (PFNGLRECTSVPROC)glad_lazy_resolve("glRectsv", (void**)&glad_glRectsv, (void*)glad_lazy_glRectsv);
+	fn(v1, v2);
+}
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble s) {
+	static PFNGLTEXCOORD1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1DPROC)glad_lazy_resolve("glTexCoord1d", (void**)&glad_glTexCoord1d, (void*)glad_lazy_glTexCoord1d);
+	fn(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble *v) {
+	static PFNGLTEXCOORD1DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1DVPROC)glad_lazy_resolve("glTexCoord1dv", (void**)&glad_glTexCoord1dv, (void*)glad_lazy_glTexCoord1dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat s) {
+	static PFNGLTEXCOORD1FPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1FPROC)glad_lazy_resolve("glTexCoord1f", (void**)&glad_glTexCoord1f, (void*)glad_lazy_glTexCoord1f);
+	fn(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat *v) {
+	static PFNGLTEXCOORD1FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1FVPROC)glad_lazy_resolve("glTexCoord1fv", (void**)&glad_glTexCoord1fv, (void*)glad_lazy_glTexCoord1fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1i(GLint s) {
+	static PFNGLTEXCOORD1IPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1IPROC)glad_lazy_resolve("glTexCoord1i", (void**)&glad_glTexCoord1i, (void*)glad_lazy_glTexCoord1i);
+	fn(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint *v) {
+	static PFNGLTEXCOORD1IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1IVPROC)glad_lazy_resolve("glTexCoord1iv", (void**)&glad_glTexCoord1iv, (void*)glad_lazy_glTexCoord1iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort s) {
+	static PFNGLTEXCOORD1SPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1SPROC)glad_lazy_resolve("glTexCoord1s", (void**)&glad_glTexCoord1s, (void*)glad_lazy_glTexCoord1s);
+	fn(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort *v) {
+	static PFNGLTEXCOORD1SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD1SVPROC)glad_lazy_resolve("glTexCoord1sv", (void**)&glad_glTexCoord1sv, (void*)glad_lazy_glTexCoord1sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble s, GLdouble t) {
+	static PFNGLTEXCOORD2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2DPROC)glad_lazy_resolve("glTexCoord2d", (void**)&glad_glTexCoord2d, (void*)glad_lazy_glTexCoord2d);
+	fn(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble *v) {
+	static PFNGLTEXCOORD2DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2DVPROC)glad_lazy_resolve("glTexCoord2dv", (void**)&glad_glTexCoord2dv, (void*)glad_lazy_glTexCoord2dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat s, GLfloat t) {
+	static PFNGLTEXCOORD2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2FPROC)glad_lazy_resolve("glTexCoord2f", (void**)&glad_glTexCoord2f, (void*)glad_lazy_glTexCoord2f);
+	fn(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat *v) {
+	static PFNGLTEXCOORD2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2FVPROC)glad_lazy_resolve("glTexCoord2fv", (void**)&glad_glTexCoord2fv, (void*)glad_lazy_glTexCoord2fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2i(GLint s, GLint t) {
+	static PFNGLTEXCOORD2IPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2IPROC)glad_lazy_resolve("glTexCoord2i", (void**)&glad_glTexCoord2i, (void*)glad_lazy_glTexCoord2i);
+	fn(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint *v) {
+	static PFNGLTEXCOORD2IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2IVPROC)glad_lazy_resolve("glTexCoord2iv", (void**)&glad_glTexCoord2iv, (void*)glad_lazy_glTexCoord2iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort s, GLshort t) {
+	static PFNGLTEXCOORD2SPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2SPROC)glad_lazy_resolve("glTexCoord2s", (void**)&glad_glTexCoord2s, (void*)glad_lazy_glTexCoord2s);
+	fn(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort *v) {
+	static PFNGLTEXCOORD2SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD2SVPROC)glad_lazy_resolve("glTexCoord2sv", (void**)&glad_glTexCoord2sv, (void*)glad_lazy_glTexCoord2sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	static PFNGLTEXCOORD3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3DPROC)glad_lazy_resolve("glTexCoord3d", (void**)&glad_glTexCoord3d, (void*)glad_lazy_glTexCoord3d);
+	fn(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble *v) {
+	static PFNGLTEXCOORD3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3DVPROC)glad_lazy_resolve("glTexCoord3dv", (void**)&glad_glTexCoord3dv, (void*)glad_lazy_glTexCoord3dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	static PFNGLTEXCOORD3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3FPROC)glad_lazy_resolve("glTexCoord3f", (void**)&glad_glTexCoord3f, (void*)glad_lazy_glTexCoord3f);
+	fn(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat *v) {
+	static PFNGLTEXCOORD3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3FVPROC)glad_lazy_resolve("glTexCoord3fv", (void**)&glad_glTexCoord3fv, (void*)glad_lazy_glTexCoord3fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3i(GLint s, GLint t, GLint r) {
+	static PFNGLTEXCOORD3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3IPROC)glad_lazy_resolve("glTexCoord3i", (void**)&glad_glTexCoord3i, (void*)glad_lazy_glTexCoord3i);
+	fn(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint *v) {
+	static PFNGLTEXCOORD3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3IVPROC)glad_lazy_resolve("glTexCoord3iv", (void**)&glad_glTexCoord3iv, (void*)glad_lazy_glTexCoord3iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	static PFNGLTEXCOORD3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3SPROC)glad_lazy_resolve("glTexCoord3s", (void**)&glad_glTexCoord3s, (void*)glad_lazy_glTexCoord3s);
+	fn(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort *v) {
+	static PFNGLTEXCOORD3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD3SVPROC)glad_lazy_resolve("glTexCoord3sv", (void**)&glad_glTexCoord3sv, (void*)glad_lazy_glTexCoord3sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	static PFNGLTEXCOORD4DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4DPROC)glad_lazy_resolve("glTexCoord4d", (void**)&glad_glTexCoord4d, (void*)glad_lazy_glTexCoord4d);
+	fn(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble *v) {
+	static PFNGLTEXCOORD4DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4DVPROC)glad_lazy_resolve("glTexCoord4dv", (void**)&glad_glTexCoord4dv, (void*)glad_lazy_glTexCoord4dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	static PFNGLTEXCOORD4FPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4FPROC)glad_lazy_resolve("glTexCoord4f", (void**)&glad_glTexCoord4f, (void*)glad_lazy_glTexCoord4f);
+	fn(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat *v) {
+	static PFNGLTEXCOORD4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4FVPROC)glad_lazy_resolve("glTexCoord4fv", (void**)&glad_glTexCoord4fv, (void*)glad_lazy_glTexCoord4fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	static PFNGLTEXCOORD4IPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4IPROC)glad_lazy_resolve("glTexCoord4i", (void**)&glad_glTexCoord4i, (void*)glad_lazy_glTexCoord4i);
+	fn(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint *v) {
+	static PFNGLTEXCOORD4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4IVPROC)glad_lazy_resolve("glTexCoord4iv", (void**)&glad_glTexCoord4iv, (void*)glad_lazy_glTexCoord4iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	static PFNGLTEXCOORD4SPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4SPROC)glad_lazy_resolve("glTexCoord4s", (void**)&glad_glTexCoord4s, (void*)glad_lazy_glTexCoord4s);
+	fn(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort *v) {
+	static PFNGLTEXCOORD4SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORD4SVPROC)glad_lazy_resolve("glTexCoord4sv", (void**)&glad_glTexCoord4sv, (void*)glad_lazy_glTexCoord4sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex2d(GLdouble x, GLdouble y) {
+	static PFNGLVERTEX2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2DPROC)glad_lazy_resolve("glVertex2d", (void**)&glad_glVertex2d, (void*)glad_lazy_glVertex2d);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble *v) {
+	static PFNGLVERTEX2DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2DVPROC)glad_lazy_resolve("glVertex2dv", (void**)&glad_glVertex2dv, (void*)glad_lazy_glVertex2dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex2f(GLfloat x, GLfloat y) {
+	static PFNGLVERTEX2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2FPROC)glad_lazy_resolve("glVertex2f", (void**)&glad_glVertex2f, (void*)glad_lazy_glVertex2f);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat *v) {
+	static PFNGLVERTEX2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2FVPROC)glad_lazy_resolve("glVertex2fv", (void**)&glad_glVertex2fv, (void*)glad_lazy_glVertex2fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex2i(GLint x, GLint y) {
+	static PFNGLVERTEX2IPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2IPROC)glad_lazy_resolve("glVertex2i", (void**)&glad_glVertex2i, (void*)glad_lazy_glVertex2i);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2iv(const GLint *v) {
+	static PFNGLVERTEX2IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2IVPROC)glad_lazy_resolve("glVertex2iv", (void**)&glad_glVertex2iv, (void*)glad_lazy_glVertex2iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex2s(GLshort x, GLshort y) {
+	static PFNGLVERTEX2SPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2SPROC)glad_lazy_resolve("glVertex2s", (void**)&glad_glVertex2s, (void*)glad_lazy_glVertex2s);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort *v) {
+	static PFNGLVERTEX2SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX2SVPROC)glad_lazy_resolve("glVertex2sv", (void**)&glad_glVertex2sv, (void*)glad_lazy_glVertex2sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	static PFNGLVERTEX3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3DPROC)glad_lazy_resolve("glVertex3d", (void**)&glad_glVertex3d, (void*)glad_lazy_glVertex3d);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble *v) {
+	static PFNGLVERTEX3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3DVPROC)glad_lazy_resolve("glVertex3dv", (void**)&glad_glVertex3dv, (void*)glad_lazy_glVertex3dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	static PFNGLVERTEX3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3FPROC)glad_lazy_resolve("glVertex3f", (void**)&glad_glVertex3f, (void*)glad_lazy_glVertex3f);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat *v) {
+	static PFNGLVERTEX3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3FVPROC)glad_lazy_resolve("glVertex3fv", (void**)&glad_glVertex3fv, (void*)glad_lazy_glVertex3fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex3i(GLint x, GLint y, GLint z) {
+	static PFNGLVERTEX3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3IPROC)glad_lazy_resolve("glVertex3i", (void**)&glad_glVertex3i, (void*)glad_lazy_glVertex3i);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3iv(const GLint *v) {
+	static PFNGLVERTEX3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3IVPROC)glad_lazy_resolve("glVertex3iv", (void**)&glad_glVertex3iv, (void*)glad_lazy_glVertex3iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	static PFNGLVERTEX3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3SPROC)glad_lazy_resolve("glVertex3s", (void**)&glad_glVertex3s, (void*)glad_lazy_glVertex3s);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort *v) {
+	static PFNGLVERTEX3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX3SVPROC)glad_lazy_resolve("glVertex3sv", (void**)&glad_glVertex3sv, (void*)glad_lazy_glVertex3sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	static PFNGLVERTEX4DPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4DPROC)glad_lazy_resolve("glVertex4d", (void**)&glad_glVertex4d, (void*)glad_lazy_glVertex4d);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble *v) {
+	static PFNGLVERTEX4DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4DVPROC)glad_lazy_resolve("glVertex4dv", (void**)&glad_glVertex4dv, (void*)glad_lazy_glVertex4dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	static PFNGLVERTEX4FPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4FPROC)glad_lazy_resolve("glVertex4f", (void**)&glad_glVertex4f, (void*)glad_lazy_glVertex4f);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat *v) {
+	static PFNGLVERTEX4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4FVPROC)glad_lazy_resolve("glVertex4fv", (void**)&glad_glVertex4fv, (void*)glad_lazy_glVertex4fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	static PFNGLVERTEX4IPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4IPROC)glad_lazy_resolve("glVertex4i", (void**)&glad_glVertex4i, (void*)glad_lazy_glVertex4i);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4iv(const GLint *v) {
+	static PFNGLVERTEX4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4IVPROC)glad_lazy_resolve("glVertex4iv", (void**)&glad_glVertex4iv, (void*)glad_lazy_glVertex4iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	static PFNGLVERTEX4SPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4SPROC)glad_lazy_resolve("glVertex4s", (void**)&glad_glVertex4s, (void*)glad_lazy_glVertex4s);
+	fn(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort *v) {
+	static PFNGLVERTEX4SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEX4SVPROC)glad_lazy_resolve("glVertex4sv", (void**)&glad_glVertex4sv, (void*)glad_lazy_glVertex4sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glClipPlane(GLenum plane, const GLdouble *equation) {
+	static PFNGLCLIPPLANEPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLIPPLANEPROC)glad_lazy_resolve("glClipPlane", (void**)&glad_glClipPlane, (void*)glad_lazy_glClipPlane);
+	fn(plane, equation);
+}
+static void APIENTRY glad_lazy_glColorMaterial(GLenum face, GLenum mode) {
+	static PFNGLCOLORMATERIALPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORMATERIALPROC)glad_lazy_resolve("glColorMaterial", (void**)&glad_glColorMaterial, (void*)glad_lazy_glColorMaterial);
+	fn(face, mode);
+}
+static void APIENTRY glad_lazy_glFogf(GLenum pname, GLfloat param) {
+	static PFNGLFOGFPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGFPROC)glad_lazy_resolve("glFogf", (void**)&glad_glFogf, (void*)glad_lazy_glFogf);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glFogfv(GLenum pname, const GLfloat *params) {
+	static PFNGLFOGFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGFVPROC)glad_lazy_resolve("glFogfv", (void**)&glad_glFogfv, (void*)glad_lazy_glFogfv);
+	fn(pname, params);
+}
+static void APIENTRY glad_lazy_glFogi(GLenum pname, GLint param) {
+	static PFNGLFOGIPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGIPROC)glad_lazy_resolve("glFogi", (void**)&glad_glFogi, (void*)glad_lazy_glFogi);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glFogiv(GLenum pname, const GLint *params) {
+	static PFNGLFOGIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGIVPROC)glad_lazy_resolve("glFogiv", (void**)&glad_glFogiv, (void*)glad_lazy_glFogiv);
+	fn(pname, params);
+}
+static void APIENTRY glad_lazy_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	static PFNGLLIGHTFPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTFPROC)glad_lazy_resolve("glLightf", (void**)&glad_glLightf, (void*)glad_lazy_glLightf);
+	fn(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	static PFNGLLIGHTFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTFVPROC)glad_lazy_resolve("glLightfv", (void**)&glad_glLightfv, (void*)glad_lazy_glLightfv);
+	fn(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLighti(GLenum light, GLenum pname, GLint param) {
+	static PFNGLLIGHTIPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTIPROC)glad_lazy_resolve("glLighti", (void**)&glad_glLighti, (void*)glad_lazy_glLighti);
+	fn(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	static PFNGLLIGHTIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTIVPROC)glad_lazy_resolve("glLightiv", (void**)&glad_glLightiv, (void*)glad_lazy_glLightiv);
+	fn(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLightModelf(GLenum pname, GLfloat param) {
+	static PFNGLLIGHTMODELFPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTMODELFPROC)glad_lazy_resolve("glLightModelf", (void**)&glad_glLightModelf, (void*)glad_lazy_glLightModelf);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModelfv(GLenum pname, const GLfloat *params) {
+	static PFNGLLIGHTMODELFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTMODELFVPROC)glad_lazy_resolve("glLightModelfv", (void**)&glad_glLightModelfv, (void*)glad_lazy_glLightModelfv);
+	fn(pname, params);
+}
+static void APIENTRY glad_lazy_glLightModeli(GLenum pname, GLint param) {
+	static PFNGLLIGHTMODELIPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTMODELIPROC)glad_lazy_resolve("glLightModeli", (void**)&glad_glLightModeli, (void*)glad_lazy_glLightModeli);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModeliv(GLenum pname, const GLint *params) {
+	static PFNGLLIGHTMODELIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLLIGHTMODELIVPROC)glad_lazy_resolve("glLightModeliv", (void**)&glad_glLightModeliv, (void*)glad_lazy_glLightModeliv);
+	fn(pname, params);
+}
+static void APIENTRY glad_lazy_glLineStipple(GLint factor, GLushort pattern) {
+	static PFNGLLINESTIPPLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLLINESTIPPLEPROC)glad_lazy_resolve("glLineStipple", (void**)&glad_glLineStipple, (void*)glad_lazy_glLineStipple);
+	fn(factor, pattern);
+}
+static void APIENTRY glad_lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	static PFNGLMATERIALFPROC fn = NULL; if(fn == NULL) fn = (PFNGLMATERIALFPROC)glad_lazy_resolve("glMaterialf", (void**)&glad_glMaterialf, (void*)glad_lazy_glMaterialf);
+	fn(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	static PFNGLMATERIALFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMATERIALFVPROC)glad_lazy_resolve("glMaterialfv", (void**)&glad_glMaterialfv, (void*)glad_lazy_glMaterialfv);
+	fn(face, pname, params);
+}
+static void APIENTRY glad_lazy_glMateriali(GLenum face, GLenum pname, GLint param) {
+	static PFNGLMATERIALIPROC fn = NULL; if(fn == NULL) fn = (PFNGLMATERIALIPROC)glad_lazy_resolve("glMateriali", (void**)&glad_glMateriali, (void*)glad_lazy_glMateriali);
+	fn(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	static PFNGLMATERIALIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMATERIALIVPROC)glad_lazy_resolve("glMaterialiv", (void**)&glad_glMaterialiv, (void*)glad_lazy_glMaterialiv);
+	fn(face, pname, params);
+}
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte *mask) {
+	static PFNGLPOLYGONSTIPPLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOLYGONSTIPPLEPROC)glad_lazy_resolve("glPolygonStipple", (void**)&glad_glPolygonStipple, (void*)glad_lazy_glPolygonStipple);
+	fn(mask);
+}
+static void APIENTRY glad_lazy_glShadeModel(GLenum mode) {
+	static PFNGLSHADEMODELPROC fn = NULL; if(fn == NULL) fn = (PFNGLSHADEMODELPROC)glad_lazy_resolve("glShadeModel", (void**)&glad_glShadeModel, (void*)glad_lazy_glShadeModel);
+	fn(mode);
+}
+static void APIENTRY glad_lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	static PFNGLTEXENVFPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXENVFPROC)glad_lazy_resolve("glTexEnvf", (void**)&glad_glTexEnvf, (void*)glad_lazy_glTexEnvf);
+	fn(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	static PFNGLTEXENVFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXENVFVPROC)glad_lazy_resolve("glTexEnvfv", (void**)&glad_glTexEnvfv, (void*)glad_lazy_glTexEnvfv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	static PFNGLTEXENVIPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXENVIPROC)glad_lazy_resolve("glTexEnvi", (void**)&glad_glTexEnvi, (void*)glad_lazy_glTexEnvi);
+	fn(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	static PFNGLTEXENVIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXENVIVPROC)glad_lazy_resolve("glTexEnviv", (void**)&glad_glTexEnviv, (void*)glad_lazy_glTexEnviv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	static PFNGLTEXGENDPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXGENDPROC)glad_lazy_resolve("glTexGend", (void**)&glad_glTexGend, (void*)glad_lazy_glTexGend);
+	fn(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	static PFNGLTEXGENDVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXGENDVPROC)glad_lazy_resolve("glTexGendv", (void**)&glad_glTexGendv, (void*)glad_lazy_glTexGendv);
+	fn(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	static PFNGLTEXGENFPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXGENFPROC)glad_lazy_resolve("glTexGenf", (void**)&glad_glTexGenf, (void*)glad_lazy_glTexGenf);
+	fn(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	static PFNGLTEXGENFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXGENFVPROC)glad_lazy_resolve("glTexGenfv", (void**)&glad_glTexGenfv, (void*)glad_lazy_glTexGenfv);
+	fn(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	static PFNGLTEXGENIPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXGENIPROC)glad_lazy_resolve("glTexGeni", (void**)&glad_glTexGeni, (void*)glad_lazy_glTexGeni);
+	fn(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	static PFNGLTEXGENIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXGENIVPROC)glad_lazy_resolve("glTexGeniv", (void**)&glad_glTexGeniv, (void*)glad_lazy_glTexGeniv);
+	fn(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	static PFNGLFEEDBACKBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLFEEDBACKBUFFERPROC)glad_lazy_resolve("glFeedbackBuffer", (void**)&glad_glFeedbackBuffer, (void*)glad_lazy_glFeedbackBuffer);
+	fn(size, type, buffer);
+}
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	static PFNGLSELECTBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLSELECTBUFFERPROC)glad_lazy_resolve("glSelectBuffer", (void**)&glad_glSelectBuffer, (void*)glad_lazy_glSelectBuffer);
+	fn(size, buffer);
+}
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum mode) {
+	static PFNGLRENDERMODEPROC fn = NULL; if(fn == NULL) fn = (PFNGLRENDERMODEPROC)glad_lazy_resolve("glRenderMode", (void**)&glad_glRenderMode, (void*)glad_lazy_glRenderMode);
+	return fn(mode);
+}
+static void APIENTRY glad_lazy_glInitNames(void) {
+	static PFNGLINITNAMESPROC fn = NULL; if(fn == NULL) fn = (PFNGLINITNAMESPROC)glad_lazy_resolve("glInitNames", (void**)&glad_glInitNames, (void*)glad_lazy_glInitNames);
+	fn();
+}
+static void APIENTRY glad_lazy_glLoadName(GLuint name) {
+	static PFNGLLOADNAMEPROC fn = NULL; if(fn == NULL) fn = (PFNGLLOADNAMEPROC)glad_lazy_resolve("glLoadName", (void**)&glad_glLoadName, (void*)glad_lazy_glLoadName);
+	fn(name);
+}
+static void APIENTRY glad_lazy_glPassThrough(GLfloat token) {
+	static PFNGLPASSTHROUGHPROC fn = NULL; if(fn == NULL) fn = (PFNGLPASSTHROUGHPROC)glad_lazy_resolve("glPassThrough", (void**)&glad_glPassThrough, (void*)glad_lazy_glPassThrough);
+	fn(token);
+}
+static void APIENTRY glad_lazy_glPopName(void) {
+	static PFNGLPOPNAMEPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOPNAMEPROC)glad_lazy_resolve("glPopName", (void**)&glad_glPopName, (void*)glad_lazy_glPopName);
+	fn();
+}
+static void APIENTRY glad_lazy_glPushName(GLuint name) {
+	static PFNGLPUSHNAMEPROC fn = NULL; if(fn == NULL) fn = (PFNGLPUSHNAMEPROC)glad_lazy_resolve("glPushName", (void**)&glad_glPushName, (void*)glad_lazy_glPushName);
+	fn(name);
+}
+static void APIENTRY glad_lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	static PFNGLCLEARACCUMPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARACCUMPROC)glad_lazy_resolve("glClearAccum", (void**)&glad_glClearAccum, (void*)glad_lazy_glClearAccum);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearIndex(GLfloat c) {
+	static PFNGLCLEARINDEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARINDEXPROC)glad_lazy_resolve("glClearIndex", (void**)&glad_glClearIndex, (void*)glad_lazy_glClearIndex);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexMask(GLuint mask) {
+	static PFNGLINDEXMASKPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXMASKPROC)glad_lazy_resolve("glIndexMask", (void**)&glad_glIndexMask, (void*)glad_lazy_glIndexMask);
+	fn(mask);
+}
+static void APIENTRY glad_lazy_glAccum(GLenum op, GLfloat value) {
+	static PFNGLACCUMPROC fn = NULL; if(fn == NULL) fn = (PFNGLACCUMPROC)glad_lazy_resolve("glAccum", (void**)&glad_glAccum, (void*)glad_lazy_glAccum);
+	fn(op, value);
+}
+static void APIENTRY glad_lazy_glPopAttrib(void) {
+	static PFNGLPOPATTRIBPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOPATTRIBPROC)glad_lazy_resolve("glPopAttrib", (void**)&glad_glPopAttrib, (void*)glad_lazy_glPopAttrib);
+	fn();
+}
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield mask) {
+	static PFNGLPUSHATTRIBPROC fn = NULL; if(fn == NULL) fn = (PFNGLPUSHATTRIBPROC)glad_lazy_resolve("glPushAttrib", (void**)&glad_glPushAttrib, (void*)glad_lazy_glPushAttrib);
+	fn(mask);
+}
+static void APIENTRY glad_lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	static PFNGLMAP1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAP1DPROC)glad_lazy_resolve("glMap1d", (void**)&glad_glMap1d, (void*)glad_lazy_glMap1d);
+	fn(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	static PFNGLMAP1FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAP1FPROC)glad_lazy_resolve("glMap1f", (void**)&glad_glMap1f, (void*)glad_lazy_glMap1f);
+	fn(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	static PFNGLMAP2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAP2DPROC)glad_lazy_resolve("glMap2d", (void**)&glad_glMap2d, (void*)glad_lazy_glMap2d);
+	fn(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	static PFNGLMAP2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAP2FPROC)glad_lazy_resolve("glMap2f", (void**)&glad_glMap2f, (void*)glad_lazy_glMap2f);
+	fn(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	static PFNGLMAPGRID1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAPGRID1DPROC)glad_lazy_resolve("glMapGrid1d", (void**)&glad_glMapGrid1d, (void*)glad_lazy_glMapGrid1d);
+	fn(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	static PFNGLMAPGRID1FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAPGRID1FPROC)glad_lazy_resolve("glMapGrid1f", (void**)&glad_glMapGrid1f, (void*)glad_lazy_glMapGrid1f);
+	fn(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	static PFNGLMAPGRID2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAPGRID2DPROC)glad_lazy_resolve("glMapGrid2d", (void**)&glad_glMapGrid2d, (void*)glad_lazy_glMapGrid2d);
+	fn(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	static PFNGLMAPGRID2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAPGRID2FPROC)glad_lazy_resolve("glMapGrid2f", (void**)&glad_glMapGrid2f, (void*)glad_lazy_glMapGrid2f);
+	fn(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble u) {
+	static PFNGLEVALCOORD1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD1DPROC)glad_lazy_resolve("glEvalCoord1d", (void**)&glad_glEvalCoord1d, (void*)glad_lazy_glEvalCoord1d);
+	fn(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble *u) {
+	static PFNGLEVALCOORD1DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD1DVPROC)glad_lazy_resolve("glEvalCoord1dv", (void**)&glad_glEvalCoord1dv, (void*)glad_lazy_glEvalCoord1dv);
+	fn(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat u) {
+	static PFNGLEVALCOORD1FPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD1FPROC)glad_lazy_resolve("glEvalCoord1f", (void**)&glad_glEvalCoord1f, (void*)glad_lazy_glEvalCoord1f);
+	fn(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat *u) {
+	static PFNGLEVALCOORD1FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD1FVPROC)glad_lazy_resolve("glEvalCoord1fv", (void**)&glad_glEvalCoord1fv, (void*)glad_lazy_glEvalCoord1fv);
+	fn(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble u, GLdouble v) {
+	static PFNGLEVALCOORD2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD2DPROC)glad_lazy_resolve("glEvalCoord2d", (void**)&glad_glEvalCoord2d, (void*)glad_lazy_glEvalCoord2d);
+	fn(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble *u) {
+	static PFNGLEVALCOORD2DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD2DVPROC)glad_lazy_resolve("glEvalCoord2dv", (void**)&glad_glEvalCoord2dv, (void*)glad_lazy_glEvalCoord2dv);
+	fn(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat u, GLfloat v) {
+	static PFNGLEVALCOORD2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD2FPROC)glad_lazy_resolve("glEvalCoord2f", (void**)&glad_glEvalCoord2f, (void*)glad_lazy_glEvalCoord2f);
+	fn(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat *u) {
+	static PFNGLEVALCOORD2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALCOORD2FVPROC)glad_lazy_resolve("glEvalCoord2fv", (void**)&glad_glEvalCoord2fv, (void*)glad_lazy_glEvalCoord2fv);
+	fn(u);
+}
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	static PFNGLEVALMESH1PROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALMESH1PROC)glad_lazy_resolve("glEvalMesh1", (void**)&glad_glEvalMesh1, (void*)glad_lazy_glEvalMesh1);
+	fn(mode, i1, i2);
+}
+static void APIENTRY glad_lazy_glEvalPoint1(GLint i) {
+	static PFNGLEVALPOINT1PROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALPOINT1PROC)glad_lazy_resolve("glEvalPoint1", (void**)&glad_glEvalPoint1, (void*)glad_lazy_glEvalPoint1);
+	fn(i);
+}
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	static PFNGLEVALMESH2PROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALMESH2PROC)glad_lazy_resolve("glEvalMesh2", (void**)&glad_glEvalMesh2, (void*)glad_lazy_glEvalMesh2);
+	fn(mode, i1, i2, j1, j2);
+}
+static void APIENTRY glad_lazy_glEvalPoint2(GLint i, GLint j) {
+	static PFNGLEVALPOINT2PROC fn = NULL; if(fn == NULL) fn = (PFNGLEVALPOINT2PROC)glad_lazy_resolve("glEvalPoint2", (void**)&glad_glEvalPoint2, (void*)glad_lazy_glEvalPoint2);
+	fn(i, j);
+}
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum func, GLfloat ref) {
+	static PFNGLALPHAFUNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLALPHAFUNCPROC)glad_lazy_resolve("glAlphaFunc", (void**)&glad_glAlphaFunc, (void*)glad_lazy_glAlphaFunc);
+	fn(func, ref);
+}
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	static PFNGLPIXELZOOMPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELZOOMPROC)glad_lazy_resolve("glPixelZoom", (void**)&glad_glPixelZoom, (void*)glad_lazy_glPixelZoom);
+	fn(xfactor, yfactor);
+}
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum pname, GLfloat param) {
+	static PFNGLPIXELTRANSFERFPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELTRANSFERFPROC)glad_lazy_resolve("glPixelTransferf", (void**)&glad_glPixelTransferf, (void*)glad_lazy_glPixelTransferf);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum pname, GLint param) {
+	static PFNGLPIXELTRANSFERIPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELTRANSFERIPROC)glad_lazy_resolve("glPixelTransferi", (void**)&glad_glPixelTransferi, (void*)glad_lazy_glPixelTransferi);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	static PFNGLPIXELMAPFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELMAPFVPROC)glad_lazy_resolve("glPixelMapfv", (void**)&glad_glPixelMapfv, (void*)glad_lazy_glPixelMapfv);
+	fn(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	static PFNGLPIXELMAPUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELMAPUIVPROC)glad_lazy_resolve("glPixelMapuiv", (void**)&glad_glPixelMapuiv, (void*)glad_lazy_glPixelMapuiv);
+	fn(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	static PFNGLPIXELMAPUSVPROC fn = NULL; if(fn == NULL) fn = (PFNGLPIXELMAPUSVPROC)glad_lazy_resolve("glPixelMapusv", (void**)&glad_glPixelMapusv, (void*)glad_lazy_glPixelMapusv);
+	fn(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	static PFNGLCOPYPIXELSPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOPYPIXELSPROC)glad_lazy_resolve("glCopyPixels", (void**)&glad_glCopyPixels, (void*)glad_lazy_glCopyPixels);
+	fn(x, y, width, height, type);
+}
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	static PFNGLDRAWPIXELSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWPIXELSPROC)glad_lazy_resolve("glDrawPixels", (void**)&glad_glDrawPixels, (void*)glad_lazy_glDrawPixels);
+	fn(width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	static PFNGLGETCLIPPLANEPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETCLIPPLANEPROC)glad_lazy_resolve("glGetClipPlane", (void**)&glad_glGetClipPlane, (void*)glad_lazy_glGetClipPlane);
+	fn(plane, equation);
+}
+static void APIENTRY glad_lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	static PFNGLGETLIGHTFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETLIGHTFVPROC)glad_lazy_resolve("glGetLightfv", (void**)&glad_glGetLightfv, (void*)glad_lazy_glGetLightfv);
+	fn(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	static PFNGLGETLIGHTIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETLIGHTIVPROC)glad_lazy_resolve("glGetLightiv", (void**)&glad_glGetLightiv, (void*)glad_lazy_glGetLightiv);
+	fn(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	static PFNGLGETMAPDVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETMAPDVPROC)glad_lazy_resolve("glGetMapdv", (void**)&glad_glGetMapdv, (void*)glad_lazy_glGetMapdv);
+	fn(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	static PFNGLGETMAPFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETMAPFVPROC)glad_lazy_resolve("glGetMapfv", (void**)&glad_glGetMapfv, (void*)glad_lazy_glGetMapfv);
+	fn(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	static PFNGLGETMAPIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETMAPIVPROC)glad_lazy_resolve("glGetMapiv", (void**)&glad_glGetMapiv, (void*)glad_lazy_glGetMapiv);
+	fn(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	static PFNGLGETMATERIALFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETMATERIALFVPROC)glad_lazy_resolve("glGetMaterialfv", (void**)&glad_glGetMaterialfv, (void*)glad_lazy_glGetMaterialfv);
+	fn(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	static PFNGLGETMATERIALIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETMATERIALIVPROC)glad_lazy_resolve("glGetMaterialiv", (void**)&glad_glGetMaterialiv, (void*)glad_lazy_glGetMaterialiv);
+	fn(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	static PFNGLGETPIXELMAPFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPIXELMAPFVPROC)glad_lazy_resolve("glGetPixelMapfv", (void**)&glad_glGetPixelMapfv, (void*)glad_lazy_glGetPixelMapfv);
+	fn(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	static PFNGLGETPIXELMAPUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPIXELMAPUIVPROC)glad_lazy_resolve("glGetPixelMapuiv", (void**)&glad_glGetPixelMapuiv, (void*)glad_lazy_glGetPixelMapuiv);
+	fn(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum map, GLushort *values) {
+	static PFNGLGETPIXELMAPUSVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPIXELMAPUSVPROC)glad_lazy_resolve("glGetPixelMapusv", (void**)&glad_glGetPixelMapusv, (void*)glad_lazy_glGetPixelMapusv);
+	fn(map, values);
+}
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte *mask) {
+	static PFNGLGETPOLYGONSTIPPLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPOLYGONSTIPPLEPROC)glad_lazy_resolve("glGetPolygonStipple", (void**)&glad_glGetPolygonStipple, (void*)glad_lazy_glGetPolygonStipple);
+	fn(mask);
+}
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	static PFNGLGETTEXENVFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXENVFVPROC)glad_lazy_resolve("glGetTexEnvfv", (void**)&glad_glGetTexEnvfv, (void*)glad_lazy_glGetTexEnvfv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	static PFNGLGETTEXENVIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXENVIVPROC)glad_lazy_resolve("glGetTexEnviv", (void**)&glad_glGetTexEnviv, (void*)glad_lazy_glGetTexEnviv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	static PFNGLGETTEXGENDVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXGENDVPROC)glad_lazy_resolve("glGetTexGendv", (void**)&glad_glGetTexGendv, (void*)glad_lazy_glGetTexGendv);
+	fn(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	static PFNGLGETTEXGENFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXGENFVPROC)glad_lazy_resolve("glGetTexGenfv", (void**)&glad_glGetTexGenfv, (void*)glad_lazy_glGetTexGenfv);
+	fn(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	static PFNGLGETTEXGENIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXGENIVPROC)glad_lazy_resolve("glGetTexGeniv", (void**)&glad_glGetTexGeniv, (void*)glad_lazy_glGetTexGeniv);
+	fn(coord, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint list) {
+	static PFNGLISLISTPROC fn = NULL; if(fn == NULL) fn = (PFNGLISLISTPROC)glad_lazy_resolve("glIsList", (void**)&glad_glIsList, (void*)glad_lazy_glIsList);
+	return fn(list);
+}
+static void APIENTRY glad_lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	static PFNGLFRUSTUMPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRUSTUMPROC)glad_lazy_resolve("glFrustum", (void**)&glad_glFrustum, (void*)glad_lazy_glFrustum);
+	fn(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glLoadIdentity(void) {
+	static PFNGLLOADIDENTITYPROC fn = NULL; if(fn == NULL) fn = (PFNGLLOADIDENTITYPROC)glad_lazy_resolve("glLoadIdentity", (void**)&glad_glLoadIdentity, (void*)glad_lazy_glLoadIdentity);
+	fn();
+}
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat *m) {
+	static PFNGLLOADMATRIXFPROC fn = NULL; if(fn == NULL) fn = (PFNGLLOADMATRIXFPROC)glad_lazy_resolve("glLoadMatrixf", (void**)&glad_glLoadMatrixf, (void*)glad_lazy_glLoadMatrixf);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble *m) {
+	static PFNGLLOADMATRIXDPROC fn = NULL; if(fn == NULL) fn = (PFNGLLOADMATRIXDPROC)glad_lazy_resolve("glLoadMatrixd", (void**)&glad_glLoadMatrixd, (void*)glad_lazy_glLoadMatrixd);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glMatrixMode(GLenum mode) {
+	static PFNGLMATRIXMODEPROC fn = NULL; if(fn == NULL) fn = (PFNGLMATRIXMODEPROC)glad_lazy_resolve("glMatrixMode", (void**)&glad_glMatrixMode, (void*)glad_lazy_glMatrixMode);
+	fn(mode);
+}
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat *m) {
+	static PFNGLMULTMATRIXFPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTMATRIXFPROC)glad_lazy_resolve("glMultMatrixf", (void**)&glad_glMultMatrixf, (void*)glad_lazy_glMultMatrixf);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble *m) {
+	static PFNGLMULTMATRIXDPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTMATRIXDPROC)glad_lazy_resolve("glMultMatrixd", (void**)&glad_glMultMatrixd, (void*)glad_lazy_glMultMatrixd);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	static PFNGLORTHOPROC fn = NULL; if(fn == NULL) fn = (PFNGLORTHOPROC)glad_lazy_resolve("glOrtho", (void**)&glad_glOrtho, (void*)glad_lazy_glOrtho);
+	fn(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glPopMatrix(void) {
+	static PFNGLPOPMATRIXPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOPMATRIXPROC)glad_lazy_resolve("glPopMatrix", (void**)&glad_glPopMatrix, (void*)glad_lazy_glPopMatrix);
+	fn();
+}
+static void APIENTRY glad_lazy_glPushMatrix(void) {
+	static PFNGLPUSHMATRIXPROC fn = NULL; if(fn == NULL) fn = (PFNGLPUSHMATRIXPROC)glad_lazy_resolve("glPushMatrix", (void**)&glad_glPushMatrix, (void*)glad_lazy_glPushMatrix);
+	fn();
+}
+static void APIENTRY glad_lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	static PFNGLROTATEDPROC fn = NULL; if(fn == NULL) fn = (PFNGLROTATEDPROC)glad_lazy_resolve("glRotated", (void**)&glad_glRotated, (void*)glad_lazy_glRotated);
+	fn(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	static PFNGLROTATEFPROC fn = NULL; if(fn == NULL) fn = (PFNGLROTATEFPROC)glad_lazy_resolve("glRotatef", (void**)&glad_glRotatef, (void*)glad_lazy_glRotatef);
+	fn(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	static PFNGLSCALEDPROC fn = NULL; if(fn == NULL) fn = (PFNGLSCALEDPROC)glad_lazy_resolve("glScaled", (void**)&glad_glScaled, (void*)glad_lazy_glScaled);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	static PFNGLSCALEFPROC fn = NULL; if(fn == NULL) fn = (PFNGLSCALEFPROC)glad_lazy_resolve("glScalef", (void**)&glad_glScalef, (void*)glad_lazy_glScalef);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	static PFNGLTRANSLATEDPROC fn = NULL; if(fn == NULL) fn = (PFNGLTRANSLATEDPROC)glad_lazy_resolve("glTranslated", (void**)&glad_glTranslated, (void*)glad_lazy_glTranslated);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	static PFNGLTRANSLATEFPROC fn = NULL; if(fn == NULL) fn = (PFNGLTRANSLATEFPROC)glad_lazy_resolve("glTranslatef", (void**)&glad_glTranslatef, (void*)glad_lazy_glTranslatef);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	static PFNGLDRAWARRAYSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWARRAYSPROC)glad_lazy_resolve("glDrawArrays", (void**)&glad_glDrawArrays, (void*)glad_lazy_glDrawArrays);
+	fn(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	static PFNGLDRAWELEMENTSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWELEMENTSPROC)glad_lazy_resolve("glDrawElements", (void**)&glad_glDrawElements, (void*)glad_lazy_glDrawElements);
+	fn(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) {
+	static PFNGLGETPOINTERVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPOINTERVPROC)glad_lazy_resolve("glGetPointerv", (void**)&glad_glGetPointerv, (void*)glad_lazy_glGetPointerv);
+	fn(pname, params);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	static PFNGLPOLYGONOFFSETPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve("glPolygonOffset", (void**)&glad_glPolygonOffset, (void*)glad_lazy_glPolygonOffset);
+	fn(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	static PFNGLCOPYTEXIMAGE1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve("glCopyTexImage1D", (void**)&glad_glCopyTexImage1D, (void*)glad_lazy_glCopyTexImage1D);
+	fn(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	static PFNGLCOPYTEXIMAGE2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve("glCopyTexImage2D", (void**)&glad_glCopyTexImage2D, (void*)glad_lazy_glCopyTexImage2D);
+	fn(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	static PFNGLCOPYTEXSUBIMAGE1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCopyTexSubImage1D", (void**)&glad_glCopyTexSubImage1D, (void*)glad_lazy_glCopyTexSubImage1D);
+	fn(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	static PFNGLCOPYTEXSUBIMAGE2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCopyTexSubImage2D", (void**)&glad_glCopyTexSubImage2D, (void*)glad_lazy_glCopyTexSubImage2D);
+	fn(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	static PFNGLTEXSUBIMAGE1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve("glTexSubImage1D", (void**)&glad_glTexSubImage1D, (void*)glad_lazy_glTexSubImage1D);
+	fn(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	static PFNGLTEXSUBIMAGE2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve("glTexSubImage2D", (void**)&glad_glTexSubImage2D, (void*)glad_lazy_glTexSubImage2D);
+	fn(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+	static PFNGLBINDTEXTUREPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDTEXTUREPROC)glad_lazy_resolve("glBindTexture", (void**)&glad_glBindTexture, (void*)glad_lazy_glBindTexture);
+	fn(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	static PFNGLDELETETEXTURESPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETETEXTURESPROC)glad_lazy_resolve("glDeleteTextures", (void**)&glad_glDeleteTextures, (void*)glad_lazy_glDeleteTextures);
+	fn(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	static PFNGLGENTEXTURESPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENTEXTURESPROC)glad_lazy_resolve("glGenTextures", (void**)&glad_glGenTextures, (void*)glad_lazy_glGenTextures);
+	fn(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+	static PFNGLISTEXTUREPROC fn = NULL; if(fn == NULL) fn = (PFNGLISTEXTUREPROC)glad_lazy_resolve("glIsTexture", (void**)&glad_glIsTexture, (void*)glad_lazy_glIsTexture);
+	return fn(texture);
+}
+static void APIENTRY glad_lazy_glArrayElement(GLint i) {
+	static PFNGLARRAYELEMENTPROC fn = NULL; if(fn == NULL) fn = (PFNGLARRAYELEMENTPROC)glad_lazy_resolve("glArrayElement", (void**)&glad_glArrayElement, (void*)glad_lazy_glArrayElement);
+	fn(i);
+}
+static void APIENTRY glad_lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLCOLORPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORPOINTERPROC)glad_lazy_resolve("glColorPointer", (void**)&glad_glColorPointer, (void*)glad_lazy_glColorPointer);
+	fn(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glDisableClientState(GLenum array) {
+	static PFNGLDISABLECLIENTSTATEPROC fn = NULL; if(fn == NULL) fn = (PFNGLDISABLECLIENTSTATEPROC)glad_lazy_resolve("glDisableClientState", (void**)&glad_glDisableClientState, (void*)glad_lazy_glDisableClientState);
+	fn(array);
+}
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	static PFNGLEDGEFLAGPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLEDGEFLAGPOINTERPROC)glad_lazy_resolve("glEdgeFlagPointer", (void**)&glad_glEdgeFlagPointer, (void*)glad_lazy_glEdgeFlagPointer);
+	fn(stride, pointer);
+}
+static void APIENTRY glad_lazy_glEnableClientState(GLenum array) {
+	static PFNGLENABLECLIENTSTATEPROC fn = NULL; if(fn == NULL) fn = (PFNGLENABLECLIENTSTATEPROC)glad_lazy_resolve("glEnableClientState", (void**)&glad_glEnableClientState, (void*)glad_lazy_glEnableClientState);
+	fn(array);
+}
+static void APIENTRY glad_lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLINDEXPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXPOINTERPROC)glad_lazy_resolve("glIndexPointer", (void**)&glad_glIndexPointer, (void*)glad_lazy_glIndexPointer);
+	fn(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	static PFNGLINTERLEAVEDARRAYSPROC fn = NULL; if(fn == NULL) fn = (PFNGLINTERLEAVEDARRAYSPROC)glad_lazy_resolve("glInterleavedArrays", (void**)&glad_glInterleavedArrays, (void*)glad_lazy_glInterleavedArrays);
+	fn(format, stride, pointer);
+}
+static void APIENTRY glad_lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLNORMALPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMALPOINTERPROC)glad_lazy_resolve("glNormalPointer", (void**)&glad_glNormalPointer, (void*)glad_lazy_glNormalPointer);
+	fn(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLTEXCOORDPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDPOINTERPROC)glad_lazy_resolve("glTexCoordPointer", (void**)&glad_glTexCoordPointer, (void*)glad_lazy_glTexCoordPointer);
+	fn(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLVERTEXPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXPOINTERPROC)glad_lazy_resolve("glVertexPointer", (void**)&glad_glVertexPointer, (void*)glad_lazy_glVertexPointer);
+	fn(size, type, stride, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	static PFNGLARETEXTURESRESIDENTPROC fn = NULL; if(fn == NULL) fn = (PFNGLARETEXTURESRESIDENTPROC)glad_lazy_resolve("glAreTexturesResident", (void**)&glad_glAreTexturesResident, (void*)glad_lazy_glAreTexturesResident);
+	return fn(n, textures, residences);
+}
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	static PFNGLPRIORITIZETEXTURESPROC fn = NULL; if(fn == NULL) fn = (PFNGLPRIORITIZETEXTURESPROC)glad_lazy_resolve("glPrioritizeTextures", (void**)&glad_glPrioritizeTextures, (void*)glad_lazy_glPrioritizeTextures);
+	fn(n, textures, priorities);
+}
+static void APIENTRY glad_lazy_glIndexub(GLubyte c) {
+	static PFNGLINDEXUBPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXUBPROC)glad_lazy_resolve("glIndexub", (void**)&glad_glIndexub, (void*)glad_lazy_glIndexub);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte *c) {
+	static PFNGLINDEXUBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLINDEXUBVPROC)glad_lazy_resolve("glIndexubv", (void**)&glad_glIndexubv, (void*)glad_lazy_glIndexubv);
+	fn(c);
+}
+static void APIENTRY glad_lazy_glPopClientAttrib(void) {
+	static PFNGLPOPCLIENTATTRIBPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOPCLIENTATTRIBPROC)glad_lazy_resolve("glPopClientAttrib", (void**)&glad_glPopClientAttrib, (void*)glad_lazy_glPopClientAttrib);
+	fn();
+}
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield mask) {
+	static PFNGLPUSHCLIENTATTRIBPROC fn = NULL; if(fn == NULL) fn = (PFNGLPUSHCLIENTATTRIBPROC)glad_lazy_resolve("glPushClientAttrib", (void**)&glad_glPushClientAttrib, (void*)glad_lazy_glPushClientAttrib);
+	fn(mask);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	static PFNGLDRAWRANGEELEMENTSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve("glDrawRangeElements", (void**)&glad_glDrawRangeElements, (void*)glad_lazy_glDrawRangeElements);
+	fn(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	static PFNGLTEXIMAGE3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXIMAGE3DPROC)glad_lazy_resolve("glTexImage3D", (void**)&glad_glTexImage3D, (void*)glad_lazy_glTexImage3D);
+	fn(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	static PFNGLTEXSUBIMAGE3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve("glTexSubImage3D", (void**)&glad_glTexSubImage3D, (void*)glad_lazy_glTexSubImage3D);
+	fn(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	static PFNGLCOPYTEXSUBIMAGE3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCopyTexSubImage3D", (void**)&glad_glCopyTexSubImage3D, (void*)glad_lazy_glCopyTexSubImage3D);
+	fn(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+	static PFNGLACTIVETEXTUREPROC fn = NULL; if(fn == NULL) fn = (PFNGLACTIVETEXTUREPROC)glad_lazy_resolve("glActiveTexture", (void**)&glad_glActiveTexture, (void*)glad_lazy_glActiveTexture);
+	fn(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	static PFNGLSAMPLECOVERAGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve("glSampleCoverage", (void**)&glad_glSampleCoverage, (void*)glad_lazy_glSampleCoverage);
+	fn(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	static PFNGLCOMPRESSEDTEXIMAGE3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve("glCompressedTexImage3D", (void**)&glad_glCompressedTexImage3D, (void*)glad_lazy_glCompressedTexImage3D);
+	fn(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	static PFNGLCOMPRESSEDTEXIMAGE2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve("glCompressedTexImage2D", (void**)&glad_glCompressedTexImage2D, (void*)glad_lazy_glCompressedTexImage2D);
+	fn(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	static PFNGLCOMPRESSEDTEXIMAGE1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve("glCompressedTexImage1D", (void**)&glad_glCompressedTexImage1D, (void*)glad_lazy_glCompressedTexImage1D);
+	fn(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTexSubImage3D", (void**)&glad_glCompressedTexSubImage3D, (void*)glad_lazy_glCompressedTexSubImage3D);
+	fn(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTexSubImage2D", (void**)&glad_glCompressedTexSubImage2D, (void*)glad_lazy_glCompressedTexSubImage2D);
+	fn(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTexSubImage1D", (void**)&glad_glCompressedTexSubImage1D, (void*)glad_lazy_glCompressedTexSubImage1D);
+	fn(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	static PFNGLGETCOMPRESSEDTEXIMAGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve("glGetCompressedTexImage", (void**)&glad_glGetCompressedTexImage, (void*)glad_lazy_glGetCompressedTexImage);
+	fn(target, level, img);
+}
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum texture) {
+	static PFNGLCLIENTACTIVETEXTUREPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLIENTACTIVETEXTUREPROC)glad_lazy_resolve("glClientActiveTexture", (void**)&glad_glClientActiveTexture, (void*)glad_lazy_glClientActiveTexture);
+	fn(texture);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	static PFNGLMULTITEXCOORD1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1DPROC)glad_lazy_resolve("glMultiTexCoord1d", (void**)&glad_glMultiTexCoord1d, (void*)glad_lazy_glMultiTexCoord1d);
+	fn(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	static PFNGLMULTITEXCOORD1DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1DVPROC)glad_lazy_resolve("glMultiTexCoord1dv", (void**)&glad_glMultiTexCoord1dv, (void*)glad_lazy_glMultiTexCoord1dv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	static PFNGLMULTITEXCOORD1FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1FPROC)glad_lazy_resolve("glMultiTexCoord1f", (void**)&glad_glMultiTexCoord1f, (void*)glad_lazy_glMultiTexCoord1f);
+	fn(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	static PFNGLMULTITEXCOORD1FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1FVPROC)glad_lazy_resolve("glMultiTexCoord1fv", (void**)&glad_glMultiTexCoord1fv, (void*)glad_lazy_glMultiTexCoord1fv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum target, GLint s) {
+	static PFNGLMULTITEXCOORD1IPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1IPROC)glad_lazy_resolve("glMultiTexCoord1i", (void**)&glad_glMultiTexCoord1i, (void*)glad_lazy_glMultiTexCoord1i);
+	fn(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	static PFNGLMULTITEXCOORD1IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1IVPROC)glad_lazy_resolve("glMultiTexCoord1iv", (void**)&glad_glMultiTexCoord1iv, (void*)glad_lazy_glMultiTexCoord1iv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum target, GLshort s) {
+	static PFNGLMULTITEXCOORD1SPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1SPROC)glad_lazy_resolve("glMultiTexCoord1s", (void**)&glad_glMultiTexCoord1s, (void*)glad_lazy_glMultiTexCoord1s);
+	fn(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	static PFNGLMULTITEXCOORD1SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD1SVPROC)glad_lazy_resolve("glMultiTexCoord1sv", (void**)&glad_glMultiTexCoord1sv, (void*)glad_lazy_glMultiTexCoord1sv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	static PFNGLMULTITEXCOORD2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2DPROC)glad_lazy_resolve("glMultiTexCoord2d", (void**)&glad_glMultiTexCoord2d, (void*)glad_lazy_glMultiTexCoord2d);
+	fn(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	static PFNGLMULTITEXCOORD2DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2DVPROC)glad_lazy_resolve("glMultiTexCoord2dv", (void**)&glad_glMultiTexCoord2dv, (void*)glad_lazy_glMultiTexCoord2dv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	static PFNGLMULTITEXCOORD2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2FPROC)glad_lazy_resolve("glMultiTexCoord2f", (void**)&glad_glMultiTexCoord2f, (void*)glad_lazy_glMultiTexCoord2f);
+	fn(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	static PFNGLMULTITEXCOORD2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2FVPROC)glad_lazy_resolve("glMultiTexCoord2fv", (void**)&glad_glMultiTexCoord2fv, (void*)glad_lazy_glMultiTexCoord2fv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	static PFNGLMULTITEXCOORD2IPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2IPROC)glad_lazy_resolve("glMultiTexCoord2i", (void**)&glad_glMultiTexCoord2i, (void*)glad_lazy_glMultiTexCoord2i);
+	fn(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	static PFNGLMULTITEXCOORD2IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2IVPROC)glad_lazy_resolve("glMultiTexCoord2iv", (void**)&glad_glMultiTexCoord2iv, (void*)glad_lazy_glMultiTexCoord2iv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	static PFNGLMULTITEXCOORD2SPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2SPROC)glad_lazy_resolve("glMultiTexCoord2s", (void**)&glad_glMultiTexCoord2s, (void*)glad_lazy_glMultiTexCoord2s);
+	fn(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	static PFNGLMULTITEXCOORD2SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD2SVPROC)glad_lazy_resolve("glMultiTexCoord2sv", (void**)&glad_glMultiTexCoord2sv, (void*)glad_lazy_glMultiTexCoord2sv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	static PFNGLMULTITEXCOORD3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3DPROC)glad_lazy_resolve("glMultiTexCoord3d", (void**)&glad_glMultiTexCoord3d, (void*)glad_lazy_glMultiTexCoord3d);
+	fn(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	static PFNGLMULTITEXCOORD3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3DVPROC)glad_lazy_resolve("glMultiTexCoord3dv", (void**)&glad_glMultiTexCoord3dv, (void*)glad_lazy_glMultiTexCoord3dv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	static PFNGLMULTITEXCOORD3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3FPROC)glad_lazy_resolve("glMultiTexCoord3f", (void**)&glad_glMultiTexCoord3f, (void*)glad_lazy_glMultiTexCoord3f);
+	fn(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	static PFNGLMULTITEXCOORD3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3FVPROC)glad_lazy_resolve("glMultiTexCoord3fv", (void**)&glad_glMultiTexCoord3fv, (void*)glad_lazy_glMultiTexCoord3fv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	static PFNGLMULTITEXCOORD3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3IPROC)glad_lazy_resolve("glMultiTexCoord3i", (void**)&glad_glMultiTexCoord3i, (void*)glad_lazy_glMultiTexCoord3i);
+	fn(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	static PFNGLMULTITEXCOORD3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3IVPROC)glad_lazy_resolve("glMultiTexCoord3iv", (void**)&glad_glMultiTexCoord3iv, (void*)glad_lazy_glMultiTexCoord3iv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	static PFNGLMULTITEXCOORD3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3SPROC)glad_lazy_resolve("glMultiTexCoord3s", (void**)&glad_glMultiTexCoord3s, (void*)glad_lazy_glMultiTexCoord3s);
+	fn(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	static PFNGLMULTITEXCOORD3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD3SVPROC)glad_lazy_resolve("glMultiTexCoord3sv", (void**)&glad_glMultiTexCoord3sv, (void*)glad_lazy_glMultiTexCoord3sv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	static PFNGLMULTITEXCOORD4DPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4DPROC)glad_lazy_resolve("glMultiTexCoord4d", (void**)&glad_glMultiTexCoord4d, (void*)glad_lazy_glMultiTexCoord4d);
+	fn(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	static PFNGLMULTITEXCOORD4DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4DVPROC)glad_lazy_resolve("glMultiTexCoord4dv", (void**)&glad_glMultiTexCoord4dv, (void*)glad_lazy_glMultiTexCoord4dv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	static PFNGLMULTITEXCOORD4FPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4FPROC)glad_lazy_resolve("glMultiTexCoord4f", (void**)&glad_glMultiTexCoord4f, (void*)glad_lazy_glMultiTexCoord4f);
+	fn(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	static PFNGLMULTITEXCOORD4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4FVPROC)glad_lazy_resolve("glMultiTexCoord4fv", (void**)&glad_glMultiTexCoord4fv, (void*)glad_lazy_glMultiTexCoord4fv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	static PFNGLMULTITEXCOORD4IPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4IPROC)glad_lazy_resolve("glMultiTexCoord4i", (void**)&glad_glMultiTexCoord4i, (void*)glad_lazy_glMultiTexCoord4i);
+	fn(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	static PFNGLMULTITEXCOORD4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4IVPROC)glad_lazy_resolve("glMultiTexCoord4iv", (void**)&glad_glMultiTexCoord4iv, (void*)glad_lazy_glMultiTexCoord4iv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	static PFNGLMULTITEXCOORD4SPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4SPROC)glad_lazy_resolve("glMultiTexCoord4s", (void**)&glad_glMultiTexCoord4s, (void*)glad_lazy_glMultiTexCoord4s);
+	fn(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	static PFNGLMULTITEXCOORD4SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORD4SVPROC)glad_lazy_resolve("glMultiTexCoord4sv", (void**)&glad_glMultiTexCoord4sv, (void*)glad_lazy_glMultiTexCoord4sv);
+	fn(target, v);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat *m) {
+	static PFNGLLOADTRANSPOSEMATRIXFPROC fn = NULL; if(fn == NULL) fn = (PFNGLLOADTRANSPOSEMATRIXFPROC)glad_lazy_resolve("glLoadTransposeMatrixf", (void**)&glad_glLoadTransposeMatrixf, (void*)glad_lazy_glLoadTransposeMatrixf);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble *m) {
+	static PFNGLLOADTRANSPOSEMATRIXDPROC fn = NULL; if(fn == NULL) fn = (PFNGLLOADTRANSPOSEMATRIXDPROC)glad_lazy_resolve("glLoadTransposeMatrixd", (void**)&glad_glLoadTransposeMatrixd, (void*)glad_lazy_glLoadTransposeMatrixd);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat *m) {
+	static PFNGLMULTTRANSPOSEMATRIXFPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTTRANSPOSEMATRIXFPROC)glad_lazy_resolve("glMultTransposeMatrixf", (void**)&glad_glMultTransposeMatrixf, (void*)glad_lazy_glMultTransposeMatrixf);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble *m) {
+	static PFNGLMULTTRANSPOSEMATRIXDPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTTRANSPOSEMATRIXDPROC)glad_lazy_resolve("glMultTransposeMatrixd", (void**)&glad_glMultTransposeMatrixd, (void*)glad_lazy_glMultTransposeMatrixd);
+	fn(m);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	static PFNGLBLENDFUNCSEPARATEPROC fn = NULL; if(fn == NULL) fn = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve("glBlendFuncSeparate", (void**)&glad_glBlendFuncSeparate, (void*)glad_lazy_glBlendFuncSeparate);
+	fn(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	static PFNGLMULTIDRAWARRAYSPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve("glMultiDrawArrays", (void**)&glad_glMultiDrawArrays, (void*)glad_lazy_glMultiDrawArrays);
+	fn(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	static PFNGLMULTIDRAWELEMENTSPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve("glMultiDrawElements", (void**)&glad_glMultiDrawElements, (void*)glad_lazy_glMultiDrawElements);
+	fn(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	static PFNGLPOINTPARAMETERFPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve("glPointParameterf", (void**)&glad_glPointParameterf, (void*)glad_lazy_glPointParameterf);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	static PFNGLPOINTPARAMETERFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve("glPointParameterfv", (void**)&glad_glPointParameterfv, (void*)glad_lazy_glPointParameterfv);
+	fn(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+	static PFNGLPOINTPARAMETERIPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve("glPointParameteri", (void**)&glad_glPointParameteri, (void*)glad_lazy_glPointParameteri);
+	fn(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	static PFNGLPOINTPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve("glPointParameteriv", (void**)&glad_glPointParameteriv, (void*)glad_lazy_glPointParameteriv);
+	fn(pname, params);
+}
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat coord) {
+	static PFNGLFOGCOORDFPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGCOORDFPROC)glad_lazy_resolve("glFogCoordf", (void**)&glad_glFogCoordf, (void*)glad_lazy_glFogCoordf);
+	fn(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat *coord) {
+	static PFNGLFOGCOORDFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGCOORDFVPROC)glad_lazy_resolve("glFogCoordfv", (void**)&glad_glFogCoordfv, (void*)glad_lazy_glFogCoordfv);
+	fn(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble coord) {
+	static PFNGLFOGCOORDDPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGCOORDDPROC)glad_lazy_resolve("glFogCoordd", (void**)&glad_glFogCoordd, (void*)glad_lazy_glFogCoordd);
+	fn(coord);
+}
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble *coord) {
+	static PFNGLFOGCOORDDVPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGCOORDDVPROC)glad_lazy_resolve("glFogCoorddv", (void**)&glad_glFogCoorddv, (void*)glad_lazy_glFogCoorddv);
+	fn(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLFOGCOORDPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLFOGCOORDPOINTERPROC)glad_lazy_resolve("glFogCoordPointer", (void**)&glad_glFogCoordPointer, (void*)glad_lazy_glFogCoordPointer);
+	fn(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	static PFNGLSECONDARYCOLOR3BPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3BPROC)glad_lazy_resolve("glSecondaryColor3b", (void**)&glad_glSecondaryColor3b, (void*)glad_lazy_glSecondaryColor3b);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte *v) {
+	static PFNGLSECONDARYCOLOR3BVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3BVPROC)glad_lazy_resolve("glSecondaryColor3bv", (void**)&glad_glSecondaryColor3bv, (void*)glad_lazy_glSecondaryColor3bv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	static PFNGLSECONDARYCOLOR3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3DPROC)glad_lazy_resolve("glSecondaryColor3d", (void**)&glad_glSecondaryColor3d, (void*)glad_lazy_glSecondaryColor3d);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble *v) {
+	static PFNGLSECONDARYCOLOR3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3DVPROC)glad_lazy_resolve("glSecondaryColor3dv", (void**)&glad_glSecondaryColor3dv, (void*)glad_lazy_glSecondaryColor3dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	static PFNGLSECONDARYCOLOR3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3FPROC)glad_lazy_resolve("glSecondaryColor3f", (void**)&glad_glSecondaryColor3f, (void*)glad_lazy_glSecondaryColor3f);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat *v) {
+	static PFNGLSECONDARYCOLOR3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3FVPROC)glad_lazy_resolve("glSecondaryColor3fv", (void**)&glad_glSecondaryColor3fv, (void*)glad_lazy_glSecondaryColor3fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	static PFNGLSECONDARYCOLOR3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3IPROC)glad_lazy_resolve("glSecondaryColor3i", (void**)&glad_glSecondaryColor3i, (void*)glad_lazy_glSecondaryColor3i);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint *v) {
+	static PFNGLSECONDARYCOLOR3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3IVPROC)glad_lazy_resolve("glSecondaryColor3iv", (void**)&glad_glSecondaryColor3iv, (void*)glad_lazy_glSecondaryColor3iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	static PFNGLSECONDARYCOLOR3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3SPROC)glad_lazy_resolve("glSecondaryColor3s", (void**)&glad_glSecondaryColor3s, (void*)glad_lazy_glSecondaryColor3s);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort *v) {
+	static PFNGLSECONDARYCOLOR3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3SVPROC)glad_lazy_resolve("glSecondaryColor3sv", (void**)&glad_glSecondaryColor3sv, (void*)glad_lazy_glSecondaryColor3sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	static PFNGLSECONDARYCOLOR3UBPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3UBPROC)glad_lazy_resolve("glSecondaryColor3ub", (void**)&glad_glSecondaryColor3ub, (void*)glad_lazy_glSecondaryColor3ub);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte *v) {
+	static PFNGLSECONDARYCOLOR3UBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3UBVPROC)glad_lazy_resolve("glSecondaryColor3ubv", (void**)&glad_glSecondaryColor3ubv, (void*)glad_lazy_glSecondaryColor3ubv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	static PFNGLSECONDARYCOLOR3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3UIPROC)glad_lazy_resolve("glSecondaryColor3ui", (void**)&glad_glSecondaryColor3ui, (void*)glad_lazy_glSecondaryColor3ui);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint *v) {
+	static PFNGLSECONDARYCOLOR3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3UIVPROC)glad_lazy_resolve("glSecondaryColor3uiv", (void**)&glad_glSecondaryColor3uiv, (void*)glad_lazy_glSecondaryColor3uiv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	static PFNGLSECONDARYCOLOR3USPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3USPROC)glad_lazy_resolve("glSecondaryColor3us", (void**)&glad_glSecondaryColor3us, (void*)glad_lazy_glSecondaryColor3us);
+	fn(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort *v) {
+	static PFNGLSECONDARYCOLOR3USVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLOR3USVPROC)glad_lazy_resolve("glSecondaryColor3usv", (void**)&glad_glSecondaryColor3usv, (void*)glad_lazy_glSecondaryColor3usv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLSECONDARYCOLORPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLORPOINTERPROC)glad_lazy_resolve("glSecondaryColorPointer", (void**)&glad_glSecondaryColorPointer, (void*)glad_lazy_glSecondaryColorPointer);
+	fn(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble x, GLdouble y) {
+	static PFNGLWINDOWPOS2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2DPROC)glad_lazy_resolve("glWindowPos2d", (void**)&glad_glWindowPos2d, (void*)glad_lazy_glWindowPos2d);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble *v) {
+	static PFNGLWINDOWPOS2DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2DVPROC)glad_lazy_resolve("glWindowPos2dv", (void**)&glad_glWindowPos2dv, (void*)glad_lazy_glWindowPos2dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat x, GLfloat y) {
+	static PFNGLWINDOWPOS2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2FPROC)glad_lazy_resolve("glWindowPos2f", (void**)&glad_glWindowPos2f, (void*)glad_lazy_glWindowPos2f);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat *v) {
+	static PFNGLWINDOWPOS2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2FVPROC)glad_lazy_resolve("glWindowPos2fv", (void**)&glad_glWindowPos2fv, (void*)glad_lazy_glWindowPos2fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2i(GLint x, GLint y) {
+	static PFNGLWINDOWPOS2IPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2IPROC)glad_lazy_resolve("glWindowPos2i", (void**)&glad_glWindowPos2i, (void*)glad_lazy_glWindowPos2i);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint *v) {
+	static PFNGLWINDOWPOS2IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2IVPROC)glad_lazy_resolve("glWindowPos2iv", (void**)&glad_glWindowPos2iv, (void*)glad_lazy_glWindowPos2iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort x, GLshort y) {
+	static PFNGLWINDOWPOS2SPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2SPROC)glad_lazy_resolve("glWindowPos2s", (void**)&glad_glWindowPos2s, (void*)glad_lazy_glWindowPos2s);
+	fn(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort *v) {
+	static PFNGLWINDOWPOS2SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS2SVPROC)glad_lazy_resolve("glWindowPos2sv", (void**)&glad_glWindowPos2sv, (void*)glad_lazy_glWindowPos2sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	static PFNGLWINDOWPOS3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3DPROC)glad_lazy_resolve("glWindowPos3d", (void**)&glad_glWindowPos3d, (void*)glad_lazy_glWindowPos3d);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble *v) {
+	static PFNGLWINDOWPOS3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3DVPROC)glad_lazy_resolve("glWindowPos3dv", (void**)&glad_glWindowPos3dv, (void*)glad_lazy_glWindowPos3dv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	static PFNGLWINDOWPOS3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3FPROC)glad_lazy_resolve("glWindowPos3f", (void**)&glad_glWindowPos3f, (void*)glad_lazy_glWindowPos3f);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat *v) {
+	static PFNGLWINDOWPOS3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3FVPROC)glad_lazy_resolve("glWindowPos3fv", (void**)&glad_glWindowPos3fv, (void*)glad_lazy_glWindowPos3fv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3i(GLint x, GLint y, GLint z) {
+	static PFNGLWINDOWPOS3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3IPROC)glad_lazy_resolve("glWindowPos3i", (void**)&glad_glWindowPos3i, (void*)glad_lazy_glWindowPos3i);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint *v) {
+	static PFNGLWINDOWPOS3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3IVPROC)glad_lazy_resolve("glWindowPos3iv", (void**)&glad_glWindowPos3iv, (void*)glad_lazy_glWindowPos3iv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	static PFNGLWINDOWPOS3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3SPROC)glad_lazy_resolve("glWindowPos3s", (void**)&glad_glWindowPos3s, (void*)glad_lazy_glWindowPos3s);
+	fn(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort *v) {
+	static PFNGLWINDOWPOS3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLWINDOWPOS3SVPROC)glad_lazy_resolve("glWindowPos3sv", (void**)&glad_glWindowPos3sv, (void*)glad_lazy_glWindowPos3sv);
+	fn(v);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	static PFNGLBLENDCOLORPROC fn = NULL; if(fn == NULL) fn = (PFNGLBLENDCOLORPROC)glad_lazy_resolve("glBlendColor", (void**)&glad_glBlendColor, (void*)glad_lazy_glBlendColor);
+	fn(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+	static PFNGLBLENDEQUATIONPROC fn = NULL; if(fn == NULL) fn = (PFNGLBLENDEQUATIONPROC)glad_lazy_resolve("glBlendEquation", (void**)&glad_glBlendEquation, (void*)glad_lazy_glBlendEquation);
+	fn(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	static PFNGLGENQUERIESPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENQUERIESPROC)glad_lazy_resolve("glGenQueries", (void**)&glad_glGenQueries, (void*)glad_lazy_glGenQueries);
+	fn(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	static PFNGLDELETEQUERIESPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETEQUERIESPROC)glad_lazy_resolve("glDeleteQueries", (void**)&glad_glDeleteQueries, (void*)glad_lazy_glDeleteQueries);
+	fn(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+	static PFNGLISQUERYPROC fn = NULL; if(fn == NULL) fn = (PFNGLISQUERYPROC)glad_lazy_resolve("glIsQuery", (void**)&glad_glIsQuery, (void*)glad_lazy_glIsQuery);
+	return fn(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+	static PFNGLBEGINQUERYPROC fn = NULL; if(fn == NULL) fn = (PFNGLBEGINQUERYPROC)glad_lazy_resolve("glBeginQuery", (void**)&glad_glBeginQuery, (void*)glad_lazy_glBeginQuery);
+	fn(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+	static PFNGLENDQUERYPROC fn = NULL; if(fn == NULL) fn = (PFNGLENDQUERYPROC)glad_lazy_resolve("glEndQuery", (void**)&glad_glEndQuery, (void*)glad_lazy_glEndQuery);
+	fn(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	static PFNGLGETQUERYIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETQUERYIVPROC)glad_lazy_resolve("glGetQueryiv", (void**)&glad_glGetQueryiv, (void*)glad_lazy_glGetQueryiv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	static PFNGLGETQUERYOBJECTIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve("glGetQueryObjectiv", (void**)&glad_glGetQueryObjectiv, (void*)glad_lazy_glGetQueryObjectiv);
+	fn(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	static PFNGLGETQUERYOBJECTUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve("glGetQueryObjectuiv", (void**)&glad_glGetQueryObjectuiv, (void*)glad_lazy_glGetQueryObjectuiv);
+	fn(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	static PFNGLBINDBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDBUFFERPROC)glad_lazy_resolve("glBindBuffer", (void**)&glad_glBindBuffer, (void*)glad_lazy_glBindBuffer);
+	fn(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	static PFNGLDELETEBUFFERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETEBUFFERSPROC)glad_lazy_resolve("glDeleteBuffers", (void**)&glad_glDeleteBuffers, (void*)glad_lazy_glDeleteBuffers);
+	fn(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	static PFNGLGENBUFFERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENBUFFERSPROC)glad_lazy_resolve("glGenBuffers", (void**)&glad_glGenBuffers, (void*)glad_lazy_glGenBuffers);
+	fn(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+	static PFNGLISBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLISBUFFERPROC)glad_lazy_resolve("glIsBuffer", (void**)&glad_glIsBuffer, (void*)glad_lazy_glIsBuffer);
+	return fn(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	static PFNGLBUFFERDATAPROC fn = NULL; if(fn == NULL) fn = (PFNGLBUFFERDATAPROC)glad_lazy_resolve("glBufferData", (void**)&glad_glBufferData, (void*)glad_lazy_glBufferData);
+	fn(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	static PFNGLBUFFERSUBDATAPROC fn = NULL; if(fn == NULL) fn = (PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve("glBufferSubData", (void**)&glad_glBufferSubData, (void*)glad_lazy_glBufferSubData);
+	fn(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	static PFNGLGETBUFFERSUBDATAPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve("glGetBufferSubData", (void**)&glad_glGetBufferSubData, (void*)glad_lazy_glGetBufferSubData);
+	fn(target, offset, size, data);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+	static PFNGLMAPBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAPBUFFERPROC)glad_lazy_resolve("glMapBuffer", (void**)&glad_glMapBuffer, (void*)glad_lazy_glMapBuffer);
+	return fn(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+	static PFNGLUNMAPBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNMAPBUFFERPROC)glad_lazy_resolve("glUnmapBuffer", (void**)&glad_glUnmapBuffer, (void*)glad_lazy_glUnmapBuffer);
+	return fn(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	static PFNGLGETBUFFERPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetBufferParameteriv", (void**)&glad_glGetBufferParameteriv, (void*)glad_lazy_glGetBufferParameteriv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	static PFNGLGETBUFFERPOINTERVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve("glGetBufferPointerv", (void**)&glad_glGetBufferPointerv, (void*)glad_lazy_glGetBufferPointerv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	static PFNGLBLENDEQUATIONSEPARATEPROC fn = NULL; if(fn == NULL) fn = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve("glBlendEquationSeparate", (void**)&glad_glBlendEquationSeparate, (void*)glad_lazy_glBlendEquationSeparate);
+	fn(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	static PFNGLDRAWBUFFERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWBUFFERSPROC)glad_lazy_resolve("glDrawBuffers", (void**)&glad_glDrawBuffers, (void*)glad_lazy_glDrawBuffers);
+	fn(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	static PFNGLSTENCILOPSEPARATEPROC fn = NULL; if(fn == NULL) fn = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve("glStencilOpSeparate", (void**)&glad_glStencilOpSeparate, (void*)glad_lazy_glStencilOpSeparate);
+	fn(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	static PFNGLSTENCILFUNCSEPARATEPROC fn = NULL; if(fn == NULL) fn = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve("glStencilFuncSeparate", (void**)&glad_glStencilFuncSeparate, (void*)glad_lazy_glStencilFuncSeparate);
+	fn(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	static PFNGLSTENCILMASKSEPARATEPROC fn = NULL; if(fn == NULL) fn = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve("glStencilMaskSeparate", (void**)&glad_glStencilMaskSeparate, (void*)glad_lazy_glStencilMaskSeparate);
+	fn(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+	static PFNGLATTACHSHADERPROC fn = NULL; if(fn == NULL) fn = (PFNGLATTACHSHADERPROC)glad_lazy_resolve("glAttachShader", (void**)&glad_glAttachShader, (void*)glad_lazy_glAttachShader);
+	fn(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	static PFNGLBINDATTRIBLOCATIONPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve("glBindAttribLocation", (void**)&glad_glBindAttribLocation, (void*)glad_lazy_glBindAttribLocation);
+	fn(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+	static PFNGLCOMPILESHADERPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOMPILESHADERPROC)glad_lazy_resolve("glCompileShader", (void**)&glad_glCompileShader, (void*)glad_lazy_glCompileShader);
+	fn(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	static PFNGLCREATEPROGRAMPROC fn = NULL; if(fn == NULL) fn = (PFNGLCREATEPROGRAMPROC)glad_lazy_resolve("glCreateProgram", (void**)&glad_glCreateProgram, (void*)glad_lazy_glCreateProgram);
+	return fn();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+	static PFNGLCREATESHADERPROC fn = NULL; if(fn == NULL) fn = (PFNGLCREATESHADERPROC)glad_lazy_resolve("glCreateShader", (void**)&glad_glCreateShader, (void*)glad_lazy_glCreateShader);
+	return fn(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+	static PFNGLDELETEPROGRAMPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETEPROGRAMPROC)glad_lazy_resolve("glDeleteProgram", (void**)&glad_glDeleteProgram, (void*)glad_lazy_glDeleteProgram);
+	fn(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+	static PFNGLDELETESHADERPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETESHADERPROC)glad_lazy_resolve("glDeleteShader", (void**)&glad_glDeleteShader, (void*)glad_lazy_glDeleteShader);
+	fn(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+	static PFNGLDETACHSHADERPROC fn = NULL; if(fn == NULL) fn = (PFNGLDETACHSHADERPROC)glad_lazy_resolve("glDetachShader", (void**)&glad_glDetachShader, (void*)glad_lazy_glDetachShader);
+	fn(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+	static PFNGLDISABLEVERTEXATTRIBARRAYPROC fn = NULL; if(fn == NULL) fn = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glDisableVertexAttribArray", (void**)&glad_glDisableVertexAttribArray, (void*)glad_lazy_glDisableVertexAttribArray);
+	fn(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+	static PFNGLENABLEVERTEXATTRIBARRAYPROC fn = NULL; if(fn == NULL) fn = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glEnableVertexAttribArray", (void**)&glad_glEnableVertexAttribArray, (void*)glad_lazy_glEnableVertexAttribArray);
+	fn(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	static PFNGLGETACTIVEATTRIBPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve("glGetActiveAttrib", (void**)&glad_glGetActiveAttrib, (void*)glad_lazy_glGetActiveAttrib);
+	fn(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	static PFNGLGETACTIVEUNIFORMPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve("glGetActiveUniform", (void**)&glad_glGetActiveUniform, (void*)glad_lazy_glGetActiveUniform);
+	fn(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	static PFNGLGETATTACHEDSHADERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve("glGetAttachedShaders", (void**)&glad_glGetAttachedShaders, (void*)glad_lazy_glGetAttachedShaders);
+	fn(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	static PFNGLGETATTRIBLOCATIONPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve("glGetAttribLocation", (void**)&glad_glGetAttribLocation, (void*)glad_lazy_glGetAttribLocation);
+	return fn(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	static PFNGLGETPROGRAMIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPROGRAMIVPROC)glad_lazy_resolve("glGetProgramiv", (void**)&glad_glGetProgramiv, (void*)glad_lazy_glGetProgramiv);
+	fn(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	static PFNGLGETPROGRAMINFOLOGPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve("glGetProgramInfoLog", (void**)&glad_glGetProgramInfoLog, (void*)glad_lazy_glGetProgramInfoLog);
+	fn(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	static PFNGLGETSHADERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSHADERIVPROC)glad_lazy_resolve("glGetShaderiv", (void**)&glad_glGetShaderiv, (void*)glad_lazy_glGetShaderiv);
+	fn(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	static PFNGLGETSHADERINFOLOGPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve("glGetShaderInfoLog", (void**)&glad_glGetShaderInfoLog, (void*)glad_lazy_glGetShaderInfoLog);
+	fn(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	static PFNGLGETSHADERSOURCEPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve("glGetShaderSource", (void**)&glad_glGetShaderSource, (void*)glad_lazy_glGetShaderSource);
+	fn(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	static PFNGLGETUNIFORMLOCATIONPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve("glGetUniformLocation", (void**)&glad_glGetUniformLocation, (void*)glad_lazy_glGetUniformLocation);
+	return fn(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	static PFNGLGETUNIFORMFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETUNIFORMFVPROC)glad_lazy_resolve("glGetUniformfv", (void**)&glad_glGetUniformfv, (void*)glad_lazy_glGetUniformfv);
+	fn(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	static PFNGLGETUNIFORMIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETUNIFORMIVPROC)glad_lazy_resolve("glGetUniformiv", (void**)&glad_glGetUniformiv, (void*)glad_lazy_glGetUniformiv);
+	fn(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	static PFNGLGETVERTEXATTRIBDVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve("glGetVertexAttribdv", (void**)&glad_glGetVertexAttribdv, (void*)glad_lazy_glGetVertexAttribdv);
+	fn(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	static PFNGLGETVERTEXATTRIBFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve("glGetVertexAttribfv", (void**)&glad_glGetVertexAttribfv, (void*)glad_lazy_glGetVertexAttribfv);
+	fn(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	static PFNGLGETVERTEXATTRIBIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve("glGetVertexAttribiv", (void**)&glad_glGetVertexAttribiv, (void*)glad_lazy_glGetVertexAttribiv);
+	fn(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	static PFNGLGETVERTEXATTRIBPOINTERVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve("glGetVertexAttribPointerv", (void**)&glad_glGetVertexAttribPointerv, (void*)glad_lazy_glGetVertexAttribPointerv);
+	fn(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+	static PFNGLISPROGRAMPROC fn = NULL; if(fn == NULL) fn = (PFNGLISPROGRAMPROC)glad_lazy_resolve("glIsProgram", (void**)&glad_glIsProgram, (void*)glad_lazy_glIsProgram);
+	return fn(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+	static PFNGLISSHADERPROC fn = NULL; if(fn == NULL) fn = (PFNGLISSHADERPROC)glad_lazy_resolve("glIsShader", (void**)&glad_glIsShader, (void*)glad_lazy_glIsShader);
+	return fn(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+	static PFNGLLINKPROGRAMPROC fn = NULL; if(fn == NULL) fn = (PFNGLLINKPROGRAMPROC)glad_lazy_resolve("glLinkProgram", (void**)&glad_glLinkProgram, (void*)glad_lazy_glLinkProgram);
+	fn(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	static PFNGLSHADERSOURCEPROC fn = NULL; if(fn == NULL) fn = (PFNGLSHADERSOURCEPROC)glad_lazy_resolve("glShaderSource", (void**)&glad_glShaderSource, (void*)glad_lazy_glShaderSource);
+	fn(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+	static PFNGLUSEPROGRAMPROC fn = NULL; if(fn == NULL) fn = (PFNGLUSEPROGRAMPROC)glad_lazy_resolve("glUseProgram", (void**)&glad_glUseProgram, (void*)glad_lazy_glUseProgram);
+	fn(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+	static PFNGLUNIFORM1FPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM1FPROC)glad_lazy_resolve("glUniform1f", (void**)&glad_glUniform1f, (void*)glad_lazy_glUniform1f);
+	fn(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	static PFNGLUNIFORM2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM2FPROC)glad_lazy_resolve("glUniform2f", (void**)&glad_glUniform2f, (void*)glad_lazy_glUniform2f);
+	fn(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	static PFNGLUNIFORM3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM3FPROC)glad_lazy_resolve("glUniform3f", (void**)&glad_glUniform3f, (void*)glad_lazy_glUniform3f);
+	fn(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	static PFNGLUNIFORM4FPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM4FPROC)glad_lazy_resolve("glUniform4f", (void**)&glad_glUniform4f, (void*)glad_lazy_glUniform4f);
+	fn(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+	static PFNGLUNIFORM1IPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM1IPROC)glad_lazy_resolve("glUniform1i", (void**)&glad_glUniform1i, (void*)glad_lazy_glUniform1i);
+	fn(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	static PFNGLUNIFORM2IPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM2IPROC)glad_lazy_resolve("glUniform2i", (void**)&glad_glUniform2i, (void*)glad_lazy_glUniform2i);
+	fn(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	static PFNGLUNIFORM3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM3IPROC)glad_lazy_resolve("glUniform3i", (void**)&glad_glUniform3i, (void*)glad_lazy_glUniform3i);
+	fn(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	static PFNGLUNIFORM4IPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM4IPROC)glad_lazy_resolve("glUniform4i", (void**)&glad_glUniform4i, (void*)glad_lazy_glUniform4i);
+	fn(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	static PFNGLUNIFORM1FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM1FVPROC)glad_lazy_resolve("glUniform1fv", (void**)&glad_glUniform1fv, (void*)glad_lazy_glUniform1fv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	static PFNGLUNIFORM2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM2FVPROC)glad_lazy_resolve("glUniform2fv", (void**)&glad_glUniform2fv, (void*)glad_lazy_glUniform2fv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	static PFNGLUNIFORM3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM3FVPROC)glad_lazy_resolve("glUniform3fv", (void**)&glad_glUniform3fv, (void*)glad_lazy_glUniform3fv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	static PFNGLUNIFORM4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM4FVPROC)glad_lazy_resolve("glUniform4fv", (void**)&glad_glUniform4fv, (void*)glad_lazy_glUniform4fv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	static PFNGLUNIFORM1IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM1IVPROC)glad_lazy_resolve("glUniform1iv", (void**)&glad_glUniform1iv, (void*)glad_lazy_glUniform1iv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	static PFNGLUNIFORM2IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM2IVPROC)glad_lazy_resolve("glUniform2iv", (void**)&glad_glUniform2iv, (void*)glad_lazy_glUniform2iv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	static PFNGLUNIFORM3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM3IVPROC)glad_lazy_resolve("glUniform3iv", (void**)&glad_glUniform3iv, (void*)glad_lazy_glUniform3iv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	static PFNGLUNIFORM4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM4IVPROC)glad_lazy_resolve("glUniform4iv", (void**)&glad_glUniform4iv, (void*)glad_lazy_glUniform4iv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve("glUniformMatrix2fv", (void**)&glad_glUniformMatrix2fv, (void*)glad_lazy_glUniformMatrix2fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve("glUniformMatrix3fv", (void**)&glad_glUniformMatrix3fv, (void*)glad_lazy_glUniformMatrix3fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve("glUniformMatrix4fv", (void**)&glad_glUniformMatrix4fv, (void*)glad_lazy_glUniformMatrix4fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+	static PFNGLVALIDATEPROGRAMPROC fn = NULL; if(fn == NULL) fn = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve("glValidateProgram", (void**)&glad_glValidateProgram, (void*)glad_lazy_glValidateProgram);
+	fn(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	static PFNGLVERTEXATTRIB1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve("glVertexAttrib1d", (void**)&glad_glVertexAttrib1d, (void*)glad_lazy_glVertexAttrib1d);
+	fn(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	static PFNGLVERTEXATTRIB1DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve("glVertexAttrib1dv", (void**)&glad_glVertexAttrib1dv, (void*)glad_lazy_glVertexAttrib1dv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	static PFNGLVERTEXATTRIB1FPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve("glVertexAttrib1f", (void**)&glad_glVertexAttrib1f, (void*)glad_lazy_glVertexAttrib1f);
+	fn(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	static PFNGLVERTEXATTRIB1FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve("glVertexAttrib1fv", (void**)&glad_glVertexAttrib1fv, (void*)glad_lazy_glVertexAttrib1fv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	static PFNGLVERTEXATTRIB1SPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve("glVertexAttrib1s", (void**)&glad_glVertexAttrib1s, (void*)glad_lazy_glVertexAttrib1s);
+	fn(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	static PFNGLVERTEXATTRIB1SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve("glVertexAttrib1sv", (void**)&glad_glVertexAttrib1sv, (void*)glad_lazy_glVertexAttrib1sv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	static PFNGLVERTEXATTRIB2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve("glVertexAttrib2d", (void**)&glad_glVertexAttrib2d, (void*)glad_lazy_glVertexAttrib2d);
+	fn(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	static PFNGLVERTEXATTRIB2DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve("glVertexAttrib2dv", (void**)&glad_glVertexAttrib2dv, (void*)glad_lazy_glVertexAttrib2dv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	static PFNGLVERTEXATTRIB2FPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve("glVertexAttrib2f", (void**)&glad_glVertexAttrib2f, (void*)glad_lazy_glVertexAttrib2f);
+	fn(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	static PFNGLVERTEXATTRIB2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve("glVertexAttrib2fv", (void**)&glad_glVertexAttrib2fv, (void*)glad_lazy_glVertexAttrib2fv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	static PFNGLVERTEXATTRIB2SPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve("glVertexAttrib2s", (void**)&glad_glVertexAttrib2s, (void*)glad_lazy_glVertexAttrib2s);
+	fn(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	static PFNGLVERTEXATTRIB2SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve("glVertexAttrib2sv", (void**)&glad_glVertexAttrib2sv, (void*)glad_lazy_glVertexAttrib2sv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	static PFNGLVERTEXATTRIB3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve("glVertexAttrib3d", (void**)&glad_glVertexAttrib3d, (void*)glad_lazy_glVertexAttrib3d);
+	fn(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	static PFNGLVERTEXATTRIB3DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve("glVertexAttrib3dv", (void**)&glad_glVertexAttrib3dv, (void*)glad_lazy_glVertexAttrib3dv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	static PFNGLVERTEXATTRIB3FPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve("glVertexAttrib3f", (void**)&glad_glVertexAttrib3f, (void*)glad_lazy_glVertexAttrib3f);
+	fn(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	static PFNGLVERTEXATTRIB3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve("glVertexAttrib3fv", (void**)&glad_glVertexAttrib3fv, (void*)glad_lazy_glVertexAttrib3fv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	static PFNGLVERTEXATTRIB3SPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve("glVertexAttrib3s", (void**)&glad_glVertexAttrib3s, (void*)glad_lazy_glVertexAttrib3s);
+	fn(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	static PFNGLVERTEXATTRIB3SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve("glVertexAttrib3sv", (void**)&glad_glVertexAttrib3sv, (void*)glad_lazy_glVertexAttrib3sv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	static PFNGLVERTEXATTRIB4NBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve("glVertexAttrib4Nbv", (void**)&glad_glVertexAttrib4Nbv, (void*)glad_lazy_glVertexAttrib4Nbv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	static PFNGLVERTEXATTRIB4NIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve("glVertexAttrib4Niv", (void**)&glad_glVertexAttrib4Niv, (void*)glad_lazy_glVertexAttrib4Niv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	static PFNGLVERTEXATTRIB4NSVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve("glVertexAttrib4Nsv", (void**)&glad_glVertexAttrib4Nsv, (void*)glad_lazy_glVertexAttrib4Nsv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	static PFNGLVERTEXATTRIB4NUBPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve("glVertexAttrib4Nub", (void**)&glad_glVertexAttrib4Nub, (void*)glad_lazy_glVertexAttrib4Nub);
+	fn(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	static PFNGLVERTEXATTRIB4NUBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve("glVertexAttrib4Nubv", (void**)&glad_glVertexAttrib4Nubv, (void*)glad_lazy_glVertexAttrib4Nubv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	static PFNGLVERTEXATTRIB4NUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve("glVertexAttrib4Nuiv", (void**)&glad_glVertexAttrib4Nuiv, (void*)glad_lazy_glVertexAttrib4Nuiv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	static PFNGLVERTEXATTRIB4NUSVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve("glVertexAttrib4Nusv", (void**)&glad_glVertexAttrib4Nusv, (void*)glad_lazy_glVertexAttrib4Nusv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	static PFNGLVERTEXATTRIB4BVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve("glVertexAttrib4bv", (void**)&glad_glVertexAttrib4bv, (void*)glad_lazy_glVertexAttrib4bv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	static PFNGLVERTEXATTRIB4DPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve("glVertexAttrib4d", (void**)&glad_glVertexAttrib4d, (void*)glad_lazy_glVertexAttrib4d);
+	fn(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	static PFNGLVERTEXATTRIB4DVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve("glVertexAttrib4dv", (void**)&glad_glVertexAttrib4dv, (void*)glad_lazy_glVertexAttrib4dv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	static PFNGLVERTEXATTRIB4FPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve("glVertexAttrib4f", (void**)&glad_glVertexAttrib4f, (void*)glad_lazy_glVertexAttrib4f);
+	fn(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	static PFNGLVERTEXATTRIB4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve("glVertexAttrib4fv", (void**)&glad_glVertexAttrib4fv, (void*)glad_lazy_glVertexAttrib4fv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	static PFNGLVERTEXATTRIB4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve("glVertexAttrib4iv", (void**)&glad_glVertexAttrib4iv, (void*)glad_lazy_glVertexAttrib4iv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	static PFNGLVERTEXATTRIB4SPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve("glVertexAttrib4s", (void**)&glad_glVertexAttrib4s, (void*)glad_lazy_glVertexAttrib4s);
+	fn(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	static PFNGLVERTEXATTRIB4SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve("glVertexAttrib4sv", (void**)&glad_glVertexAttrib4sv, (void*)glad_lazy_glVertexAttrib4sv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	static PFNGLVERTEXATTRIB4UBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve("glVertexAttrib4ubv", (void**)&glad_glVertexAttrib4ubv, (void*)glad_lazy_glVertexAttrib4ubv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	static PFNGLVERTEXATTRIB4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve("glVertexAttrib4uiv", (void**)&glad_glVertexAttrib4uiv, (void*)glad_lazy_glVertexAttrib4uiv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	static PFNGLVERTEXATTRIB4USVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve("glVertexAttrib4usv", (void**)&glad_glVertexAttrib4usv, (void*)glad_lazy_glVertexAttrib4usv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	static PFNGLVERTEXATTRIBPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve("glVertexAttribPointer", (void**)&glad_glVertexAttribPointer, (void*)glad_lazy_glVertexAttribPointer);
+	fn(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX2X3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve("glUniformMatrix2x3fv", (void**)&glad_glUniformMatrix2x3fv, (void*)glad_lazy_glUniformMatrix2x3fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX3X2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve("glUniformMatrix3x2fv", (void**)&glad_glUniformMatrix3x2fv, (void*)glad_lazy_glUniformMatrix3x2fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX2X4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve("glUniformMatrix2x4fv", (void**)&glad_glUniformMatrix2x4fv, (void*)glad_lazy_glUniformMatrix2x4fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX4X2FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve("glUniformMatrix4x2fv", (void**)&glad_glUniformMatrix4x2fv, (void*)glad_lazy_glUniformMatrix4x2fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX3X4FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve("glUniformMatrix3x4fv", (void**)&glad_glUniformMatrix3x4fv, (void*)glad_lazy_glUniformMatrix3x4fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	static PFNGLUNIFORMMATRIX4X3FVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve("glUniformMatrix4x3fv", (void**)&glad_glUniformMatrix4x3fv, (void*)glad_lazy_glUniformMatrix4x3fv);
+	fn(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	static PFNGLCOLORMASKIPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORMASKIPROC)glad_lazy_resolve("glColorMaski", (void**)&glad_glColorMaski, (void*)glad_lazy_glColorMaski);
+	fn(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	static PFNGLGETBOOLEANI_VPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve("glGetBooleani_v", (void**)&glad_glGetBooleani_v, (void*)glad_lazy_glGetBooleani_v);
+	fn(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	static PFNGLGETINTEGERI_VPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETINTEGERI_VPROC)glad_lazy_resolve("glGetIntegeri_v", (void**)&glad_glGetIntegeri_v, (void*)glad_lazy_glGetIntegeri_v);
+	fn(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+	static PFNGLENABLEIPROC fn = NULL; if(fn == NULL) fn = (PFNGLENABLEIPROC)glad_lazy_resolve("glEnablei", (void**)&glad_glEnablei, (void*)glad_lazy_glEnablei);
+	fn(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+	static PFNGLDISABLEIPROC fn = NULL; if(fn == NULL) fn = (PFNGLDISABLEIPROC)glad_lazy_resolve("glDisablei", (void**)&glad_glDisablei, (void*)glad_lazy_glDisablei);
+	fn(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	static PFNGLISENABLEDIPROC fn = NULL; if(fn == NULL) fn = (PFNGLISENABLEDIPROC)glad_lazy_resolve("glIsEnabledi", (void**)&glad_glIsEnabledi, (void*)glad_lazy_glIsEnabledi);
+	return fn(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	static PFNGLBEGINTRANSFORMFEEDBACKPROC fn = NULL; if(fn == NULL) fn = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glBeginTransformFeedback", (void**)&glad_glBeginTransformFeedback, (void*)glad_lazy_glBeginTransformFeedback);
+	fn(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	static PFNGLENDTRANSFORMFEEDBACKPROC fn = NULL; if(fn == NULL) fn = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glEndTransformFeedback", (void**)&glad_glEndTransformFeedback, (void*)glad_lazy_glEndTransformFeedback);
+	fn();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	static PFNGLBINDBUFFERRANGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve("glBindBufferRange", (void**)&glad_glBindBufferRange, (void*)glad_lazy_glBindBufferRange);
+	fn(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	static PFNGLBINDBUFFERBASEPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve("glBindBufferBase", (void**)&glad_glBindBufferBase, (void*)glad_lazy_glBindBufferBase);
+	fn(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	static PFNGLTRANSFORMFEEDBACKVARYINGSPROC fn = NULL; if(fn == NULL) fn = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve("glTransformFeedbackVaryings", (void**)&glad_glTransformFeedbackVaryings, (void*)glad_lazy_glTransformFeedbackVaryings);
+	fn(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve("glGetTransformFeedbackVarying", (void**)&glad_glGetTransformFeedbackVarying, (void*)glad_lazy_glGetTransformFeedbackVarying);
+	fn(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+	static PFNGLCLAMPCOLORPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLAMPCOLORPROC)glad_lazy_resolve("glClampColor", (void**)&glad_glClampColor, (void*)glad_lazy_glClampColor);
+	fn(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	static PFNGLBEGINCONDITIONALRENDERPROC fn = NULL; if(fn == NULL) fn = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve("glBeginConditionalRender", (void**)&glad_glBeginConditionalRender, (void*)glad_lazy_glBeginConditionalRender);
+	fn(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	static PFNGLENDCONDITIONALRENDERPROC fn = NULL; if(fn == NULL) fn = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve("glEndConditionalRender", (void**)&glad_glEndConditionalRender, (void*)glad_lazy_glEndConditionalRender);
+	fn();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	static PFNGLVERTEXATTRIBIPOINTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve("glVertexAttribIPointer", (void**)&glad_glVertexAttribIPointer, (void*)glad_lazy_glVertexAttribIPointer);
+	fn(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	static PFNGLGETVERTEXATTRIBIIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve("glGetVertexAttribIiv", (void**)&glad_glGetVertexAttribIiv, (void*)glad_lazy_glGetVertexAttribIiv);
+	fn(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	static PFNGLGETVERTEXATTRIBIUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve("glGetVertexAttribIuiv", (void**)&glad_glGetVertexAttribIuiv, (void*)glad_lazy_glGetVertexAttribIuiv);
+	fn(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	static PFNGLVERTEXATTRIBI1IPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve("glVertexAttribI1i", (void**)&glad_glVertexAttribI1i, (void*)glad_lazy_glVertexAttribI1i);
+	fn(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	static PFNGLVERTEXATTRIBI2IPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve("glVertexAttribI2i", (void**)&glad_glVertexAttribI2i, (void*)glad_lazy_glVertexAttribI2i);
+	fn(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	static PFNGLVERTEXATTRIBI3IPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve("glVertexAttribI3i", (void**)&glad_glVertexAttribI3i, (void*)glad_lazy_glVertexAttribI3i);
+	fn(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	static PFNGLVERTEXATTRIBI4IPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve("glVertexAttribI4i", (void**)&glad_glVertexAttribI4i, (void*)glad_lazy_glVertexAttribI4i);
+	fn(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	static PFNGLVERTEXATTRIBI1UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve("glVertexAttribI1ui", (void**)&glad_glVertexAttribI1ui, (void*)glad_lazy_glVertexAttribI1ui);
+	fn(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	static PFNGLVERTEXATTRIBI2UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve("glVertexAttribI2ui", (void**)&glad_glVertexAttribI2ui, (void*)glad_lazy_glVertexAttribI2ui);
+	fn(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	static PFNGLVERTEXATTRIBI3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve("glVertexAttribI3ui", (void**)&glad_glVertexAttribI3ui, (void*)glad_lazy_glVertexAttribI3ui);
+	fn(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	static PFNGLVERTEXATTRIBI4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve("glVertexAttribI4ui", (void**)&glad_glVertexAttribI4ui, (void*)glad_lazy_glVertexAttribI4ui);
+	fn(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	static PFNGLVERTEXATTRIBI1IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve("glVertexAttribI1iv", (void**)&glad_glVertexAttribI1iv, (void*)glad_lazy_glVertexAttribI1iv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	static PFNGLVERTEXATTRIBI2IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve("glVertexAttribI2iv", (void**)&glad_glVertexAttribI2iv, (void*)glad_lazy_glVertexAttribI2iv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	static PFNGLVERTEXATTRIBI3IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve("glVertexAttribI3iv", (void**)&glad_glVertexAttribI3iv, (void*)glad_lazy_glVertexAttribI3iv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	static PFNGLVERTEXATTRIBI4IVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve("glVertexAttribI4iv", (void**)&glad_glVertexAttribI4iv, (void*)glad_lazy_glVertexAttribI4iv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	static PFNGLVERTEXATTRIBI1UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve("glVertexAttribI1uiv", (void**)&glad_glVertexAttribI1uiv, (void*)glad_lazy_glVertexAttribI1uiv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	static PFNGLVERTEXATTRIBI2UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve("glVertexAttribI2uiv", (void**)&glad_glVertexAttribI2uiv, (void*)glad_lazy_glVertexAttribI2uiv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	static PFNGLVERTEXATTRIBI3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve("glVertexAttribI3uiv", (void**)&glad_glVertexAttribI3uiv, (void*)glad_lazy_glVertexAttribI3uiv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	static PFNGLVERTEXATTRIBI4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve("glVertexAttribI4uiv", (void**)&glad_glVertexAttribI4uiv, (void*)glad_lazy_glVertexAttribI4uiv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	static PFNGLVERTEXATTRIBI4BVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve("glVertexAttribI4bv", (void**)&glad_glVertexAttribI4bv, (void*)glad_lazy_glVertexAttribI4bv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	static PFNGLVERTEXATTRIBI4SVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve("glVertexAttribI4sv", (void**)&glad_glVertexAttribI4sv, (void*)glad_lazy_glVertexAttribI4sv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	static PFNGLVERTEXATTRIBI4UBVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve("glVertexAttribI4ubv", (void**)&glad_glVertexAttribI4ubv, (void*)glad_lazy_glVertexAttribI4ubv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	static PFNGLVERTEXATTRIBI4USVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve("glVertexAttribI4usv", (void**)&glad_glVertexAttribI4usv, (void*)glad_lazy_glVertexAttribI4usv);
+	fn(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	static PFNGLGETUNIFORMUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve("glGetUniformuiv", (void**)&glad_glGetUniformuiv, (void*)glad_lazy_glGetUniformuiv);
+	fn(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	static PFNGLBINDFRAGDATALOCATIONPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve("glBindFragDataLocation", (void**)&glad_glBindFragDataLocation, (void*)glad_lazy_glBindFragDataLocation);
+	fn(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	static PFNGLGETFRAGDATALOCATIONPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve("glGetFragDataLocation", (void**)&glad_glGetFragDataLocation, (void*)glad_lazy_glGetFragDataLocation);
+	return fn(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+	static PFNGLUNIFORM1UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM1UIPROC)glad_lazy_resolve("glUniform1ui", (void**)&glad_glUniform1ui, (void*)glad_lazy_glUniform1ui);
+	fn(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	static PFNGLUNIFORM2UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM2UIPROC)glad_lazy_resolve("glUniform2ui", (void**)&glad_glUniform2ui, (void*)glad_lazy_glUniform2ui);
+	fn(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	static PFNGLUNIFORM3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM3UIPROC)glad_lazy_resolve("glUniform3ui", (void**)&glad_glUniform3ui, (void*)glad_lazy_glUniform3ui);
+	fn(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	static PFNGLUNIFORM4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM4UIPROC)glad_lazy_resolve("glUniform4ui", (void**)&glad_glUniform4ui, (void*)glad_lazy_glUniform4ui);
+	fn(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	static PFNGLUNIFORM1UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM1UIVPROC)glad_lazy_resolve("glUniform1uiv", (void**)&glad_glUniform1uiv, (void*)glad_lazy_glUniform1uiv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	static PFNGLUNIFORM2UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM2UIVPROC)glad_lazy_resolve("glUniform2uiv", (void**)&glad_glUniform2uiv, (void*)glad_lazy_glUniform2uiv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	static PFNGLUNIFORM3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM3UIVPROC)glad_lazy_resolve("glUniform3uiv", (void**)&glad_glUniform3uiv, (void*)glad_lazy_glUniform3uiv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	static PFNGLUNIFORM4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORM4UIVPROC)glad_lazy_resolve("glUniform4uiv", (void**)&glad_glUniform4uiv, (void*)glad_lazy_glUniform4uiv);
+	fn(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	static PFNGLTEXPARAMETERIIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve("glTexParameterIiv", (void**)&glad_glTexParameterIiv, (void*)glad_lazy_glTexParameterIiv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	static PFNGLTEXPARAMETERIUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve("glTexParameterIuiv", (void**)&glad_glTexParameterIuiv, (void*)glad_lazy_glTexParameterIuiv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	static PFNGLGETTEXPARAMETERIIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve("glGetTexParameterIiv", (void**)&glad_glGetTexParameterIiv, (void*)glad_lazy_glGetTexParameterIiv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	static PFNGLGETTEXPARAMETERIUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve("glGetTexParameterIuiv", (void**)&glad_glGetTexParameterIuiv, (void*)glad_lazy_glGetTexParameterIuiv);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	static PFNGLCLEARBUFFERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve("glClearBufferiv", (void**)&glad_glClearBufferiv, (void*)glad_lazy_glClearBufferiv);
+	fn(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	static PFNGLCLEARBUFFERUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve("glClearBufferuiv", (void**)&glad_glClearBufferuiv, (void*)glad_lazy_glClearBufferuiv);
+	fn(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	static PFNGLCLEARBUFFERFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve("glClearBufferfv", (void**)&glad_glClearBufferfv, (void*)glad_lazy_glClearBufferfv);
+	fn(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	static PFNGLCLEARBUFFERFIPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve("glClearBufferfi", (void**)&glad_glClearBufferfi, (void*)glad_lazy_glClearBufferfi);
+	fn(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+	static PFNGLGETSTRINGIPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSTRINGIPROC)glad_lazy_resolve("glGetStringi", (void**)&glad_glGetStringi, (void*)glad_lazy_glGetStringi);
+	return fn(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	static PFNGLISRENDERBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLISRENDERBUFFERPROC)glad_lazy_resolve("glIsRenderbuffer", (void**)&glad_glIsRenderbuffer, (void*)glad_lazy_glIsRenderbuffer);
+	return fn(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	static PFNGLBINDRENDERBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve("glBindRenderbuffer", (void**)&glad_glBindRenderbuffer, (void*)glad_lazy_glBindRenderbuffer);
+	fn(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	static PFNGLDELETERENDERBUFFERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve("glDeleteRenderbuffers", (void**)&glad_glDeleteRenderbuffers, (void*)glad_lazy_glDeleteRenderbuffers);
+	fn(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	static PFNGLGENRENDERBUFFERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve("glGenRenderbuffers", (void**)&glad_glGenRenderbuffers, (void*)glad_lazy_glGenRenderbuffers);
+	fn(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	static PFNGLRENDERBUFFERSTORAGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glRenderbufferStorage", (void**)&glad_glRenderbufferStorage, (void*)glad_lazy_glRenderbufferStorage);
+	fn(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	static PFNGLGETRENDERBUFFERPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetRenderbufferParameteriv", (void**)&glad_glGetRenderbufferParameteriv, (void*)glad_lazy_glGetRenderbufferParameteriv);
+	fn(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+	static PFNGLISFRAMEBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve("glIsFramebuffer", (void**)&glad_glIsFramebuffer, (void*)glad_lazy_glIsFramebuffer);
+	return fn(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	static PFNGLBINDFRAMEBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve("glBindFramebuffer", (void**)&glad_glBindFramebuffer, (void*)glad_lazy_glBindFramebuffer);
+	fn(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	static PFNGLDELETEFRAMEBUFFERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve("glDeleteFramebuffers", (void**)&glad_glDeleteFramebuffers, (void*)glad_lazy_glDeleteFramebuffers);
+	fn(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	static PFNGLGENFRAMEBUFFERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve("glGenFramebuffers", (void**)&glad_glGenFramebuffers, (void*)glad_lazy_glGenFramebuffers);
+	fn(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+	static PFNGLCHECKFRAMEBUFFERSTATUSPROC fn = NULL; if(fn == NULL) fn = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckFramebufferStatus", (void**)&glad_glCheckFramebufferStatus, (void*)glad_lazy_glCheckFramebufferStatus);
+	return fn(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	static PFNGLFRAMEBUFFERTEXTURE1DPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve("glFramebufferTexture1D", (void**)&glad_glFramebufferTexture1D, (void*)glad_lazy_glFramebufferTexture1D);
+	fn(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	static PFNGLFRAMEBUFFERTEXTURE2DPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve("glFramebufferTexture2D", (void**)&glad_glFramebufferTexture2D, (void*)glad_lazy_glFramebufferTexture2D);
+	fn(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	static PFNGLFRAMEBUFFERTEXTURE3DPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve("glFramebufferTexture3D", (void**)&glad_glFramebufferTexture3D, (void*)glad_lazy_glFramebufferTexture3D);
+	fn(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	static PFNGLFRAMEBUFFERRENDERBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glFramebufferRenderbuffer", (void**)&glad_glFramebufferRenderbuffer, (void*)glad_lazy_glFramebufferRenderbuffer);
+	fn(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetFramebufferAttachmentParameteriv", (void**)&glad_glGetFramebufferAttachmentParameteriv, (void*)glad_lazy_glGetFramebufferAttachmentParameteriv);
+	fn(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+	static PFNGLGENERATEMIPMAPPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve("glGenerateMipmap", (void**)&glad_glGenerateMipmap, (void*)glad_lazy_glGenerateMipmap);
+	fn(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	static PFNGLBLITFRAMEBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve("glBlitFramebuffer", (void**)&glad_glBlitFramebuffer, (void*)glad_lazy_glBlitFramebuffer);
+	fn(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glRenderbufferStorageMultisample", (void**)&glad_glRenderbufferStorageMultisample, (void*)glad_lazy_glRenderbufferStorageMultisample);
+	fn(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	static PFNGLFRAMEBUFFERTEXTURELAYERPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glFramebufferTextureLayer", (void**)&glad_glFramebufferTextureLayer, (void*)glad_lazy_glFramebufferTextureLayer);
+	fn(target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	static PFNGLMAPBUFFERRANGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve("glMapBufferRange", (void**)&glad_glMapBufferRange, (void*)glad_lazy_glMapBufferRange);
+	return fn(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	static PFNGLFLUSHMAPPEDBUFFERRANGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedBufferRange", (void**)&glad_glFlushMappedBufferRange, (void*)glad_lazy_glFlushMappedBufferRange);
+	fn(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+	static PFNGLBINDVERTEXARRAYPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve("glBindVertexArray", (void**)&glad_glBindVertexArray, (void*)glad_lazy_glBindVertexArray);
+	fn(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	static PFNGLDELETEVERTEXARRAYSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve("glDeleteVertexArrays", (void**)&glad_glDeleteVertexArrays, (void*)glad_lazy_glDeleteVertexArrays);
+	fn(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	static PFNGLGENVERTEXARRAYSPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve("glGenVertexArrays", (void**)&glad_glGenVertexArrays, (void*)glad_lazy_glGenVertexArrays);
+	fn(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+	static PFNGLISVERTEXARRAYPROC fn = NULL; if(fn == NULL) fn = (PFNGLISVERTEXARRAYPROC)glad_lazy_resolve("glIsVertexArray", (void**)&glad_glIsVertexArray, (void*)glad_lazy_glIsVertexArray);
+	return fn(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	static PFNGLDRAWARRAYSINSTANCEDPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve("glDrawArraysInstanced", (void**)&glad_glDrawArraysInstanced, (void*)glad_lazy_glDrawArraysInstanced);
+	fn(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	static PFNGLDRAWELEMENTSINSTANCEDPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve("glDrawElementsInstanced", (void**)&glad_glDrawElementsInstanced, (void*)glad_lazy_glDrawElementsInstanced);
+	fn(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	static PFNGLTEXBUFFERPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXBUFFERPROC)glad_lazy_resolve("glTexBuffer", (void**)&glad_glTexBuffer, (void*)glad_lazy_glTexBuffer);
+	fn(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+	static PFNGLPRIMITIVERESTARTINDEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve("glPrimitiveRestartIndex", (void**)&glad_glPrimitiveRestartIndex, (void*)glad_lazy_glPrimitiveRestartIndex);
+	fn(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	static PFNGLCOPYBUFFERSUBDATAPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyBufferSubData", (void**)&glad_glCopyBufferSubData, (void*)glad_lazy_glCopyBufferSubData);
+	fn(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	static PFNGLGETUNIFORMINDICESPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve("glGetUniformIndices", (void**)&glad_glGetUniformIndices, (void*)glad_lazy_glGetUniformIndices);
+	fn(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	static PFNGLGETACTIVEUNIFORMSIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve("glGetActiveUniformsiv", (void**)&glad_glGetActiveUniformsiv, (void*)glad_lazy_glGetActiveUniformsiv);
+	fn(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	static PFNGLGETACTIVEUNIFORMNAMEPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve("glGetActiveUniformName", (void**)&glad_glGetActiveUniformName, (void*)glad_lazy_glGetActiveUniformName);
+	fn(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	static PFNGLGETUNIFORMBLOCKINDEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve("glGetUniformBlockIndex", (void**)&glad_glGetUniformBlockIndex, (void*)glad_lazy_glGetUniformBlockIndex);
+	return fn(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	static PFNGLGETACTIVEUNIFORMBLOCKIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve("glGetActiveUniformBlockiv", (void**)&glad_glGetActiveUniformBlockiv, (void*)glad_lazy_glGetActiveUniformBlockiv);
+	fn(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve("glGetActiveUniformBlockName", (void**)&glad_glGetActiveUniformBlockName, (void*)glad_lazy_glGetActiveUniformBlockName);
+	fn(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	static PFNGLUNIFORMBLOCKBINDINGPROC fn = NULL; if(fn == NULL) fn = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve("glUniformBlockBinding", (void**)&glad_glUniformBlockBinding, (void*)glad_lazy_glUniformBlockBinding);
+	fn(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	static PFNGLDRAWELEMENTSBASEVERTEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsBaseVertex", (void**)&glad_glDrawElementsBaseVertex, (void*)glad_lazy_glDrawElementsBaseVertex);
+	fn(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawRangeElementsBaseVertex", (void**)&glad_glDrawRangeElementsBaseVertex, (void*)glad_lazy_glDrawRangeElementsBaseVertex);
+	fn(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertex", (void**)&glad_glDrawElementsInstancedBaseVertex, (void*)glad_lazy_glDrawElementsInstancedBaseVertex);
+	fn(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glMultiDrawElementsBaseVertex", (void**)&glad_glMultiDrawElementsBaseVertex, (void*)glad_lazy_glMultiDrawElementsBaseVertex);
+	fn(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+	static PFNGLPROVOKINGVERTEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve("glProvokingVertex", (void**)&glad_glProvokingVertex, (void*)glad_lazy_glProvokingVertex);
+	fn(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	static PFNGLFENCESYNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLFENCESYNCPROC)glad_lazy_resolve("glFenceSync", (void**)&glad_glFenceSync, (void*)glad_lazy_glFenceSync);
+	return fn(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+	static PFNGLISSYNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLISSYNCPROC)glad_lazy_resolve("glIsSync", (void**)&glad_glIsSync, (void*)glad_lazy_glIsSync);
+	return fn(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+	static PFNGLDELETESYNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETESYNCPROC)glad_lazy_resolve("glDeleteSync", (void**)&glad_glDeleteSync, (void*)glad_lazy_glDeleteSync);
+	fn(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	static PFNGLCLIENTWAITSYNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve("glClientWaitSync", (void**)&glad_glClientWaitSync, (void*)glad_lazy_glClientWaitSync);
+	return fn(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	static PFNGLWAITSYNCPROC fn = NULL; if(fn == NULL) fn = (PFNGLWAITSYNCPROC)glad_lazy_resolve("glWaitSync", (void**)&glad_glWaitSync, (void*)glad_lazy_glWaitSync);
+	fn(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	static PFNGLGETINTEGER64VPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETINTEGER64VPROC)glad_lazy_resolve("glGetInteger64v", (void**)&glad_glGetInteger64v, (void*)glad_lazy_glGetInteger64v);
+	fn(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	static PFNGLGETSYNCIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSYNCIVPROC)glad_lazy_resolve("glGetSynciv", (void**)&glad_glGetSynciv, (void*)glad_lazy_glGetSynciv);
+	fn(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	static PFNGLGETINTEGER64I_VPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve("glGetInteger64i_v", (void**)&glad_glGetInteger64i_v, (void*)glad_lazy_glGetInteger64i_v);
+	fn(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	static PFNGLGETBUFFERPARAMETERI64VPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetBufferParameteri64v", (void**)&glad_glGetBufferParameteri64v, (void*)glad_lazy_glGetBufferParameteri64v);
+	fn(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	static PFNGLFRAMEBUFFERTEXTUREPROC fn = NULL; if(fn == NULL) fn = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glFramebufferTexture", (void**)&glad_glFramebufferTexture, (void*)glad_lazy_glFramebufferTexture);
+	fn(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	static PFNGLTEXIMAGE2DMULTISAMPLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage2DMultisample", (void**)&glad_glTexImage2DMultisample, (void*)glad_lazy_glTexImage2DMultisample);
+	fn(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	static PFNGLTEXIMAGE3DMULTISAMPLEPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage3DMultisample", (void**)&glad_glTexImage3DMultisample, (void*)glad_lazy_glTexImage3DMultisample);
+	fn(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	static PFNGLGETMULTISAMPLEFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve("glGetMultisamplefv", (void**)&glad_glGetMultisamplefv, (void*)glad_lazy_glGetMultisamplefv);
+	fn(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	static PFNGLSAMPLEMASKIPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLEMASKIPROC)glad_lazy_resolve("glSampleMaski", (void**)&glad_glSampleMaski, (void*)glad_lazy_glSampleMaski);
+	fn(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve("glBindFragDataLocationIndexed", (void**)&glad_glBindFragDataLocationIndexed, (void*)glad_lazy_glBindFragDataLocationIndexed);
+	fn(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	static PFNGLGETFRAGDATAINDEXPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve("glGetFragDataIndex", (void**)&glad_glGetFragDataIndex, (void*)glad_lazy_glGetFragDataIndex);
+	return fn(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	static PFNGLGENSAMPLERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLGENSAMPLERSPROC)glad_lazy_resolve("glGenSamplers", (void**)&glad_glGenSamplers, (void*)glad_lazy_glGenSamplers);
+	fn(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	static PFNGLDELETESAMPLERSPROC fn = NULL; if(fn == NULL) fn = (PFNGLDELETESAMPLERSPROC)glad_lazy_resolve("glDeleteSamplers", (void**)&glad_glDeleteSamplers, (void*)glad_lazy_glDeleteSamplers);
+	fn(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+	static PFNGLISSAMPLERPROC fn = NULL; if(fn == NULL) fn = (PFNGLISSAMPLERPROC)glad_lazy_resolve("glIsSampler", (void**)&glad_glIsSampler, (void*)glad_lazy_glIsSampler);
+	return fn(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	static PFNGLBINDSAMPLERPROC fn = NULL; if(fn == NULL) fn = (PFNGLBINDSAMPLERPROC)glad_lazy_resolve("glBindSampler", (void**)&glad_glBindSampler, (void*)glad_lazy_glBindSampler);
+	fn(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	static PFNGLSAMPLERPARAMETERIPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve("glSamplerParameteri", (void**)&glad_glSamplerParameteri, (void*)glad_lazy_glSamplerParameteri);
+	fn(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	static PFNGLSAMPLERPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glSamplerParameteriv", (void**)&glad_glSamplerParameteriv, (void*)glad_lazy_glSamplerParameteriv);
+	fn(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	static PFNGLSAMPLERPARAMETERFPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve("glSamplerParameterf", (void**)&glad_glSamplerParameterf, (void*)glad_lazy_glSamplerParameterf);
+	fn(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	static PFNGLSAMPLERPARAMETERFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glSamplerParameterfv", (void**)&glad_glSamplerParameterfv, (void*)glad_lazy_glSamplerParameterfv);
+	fn(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	static PFNGLSAMPLERPARAMETERIIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glSamplerParameterIiv", (void**)&glad_glSamplerParameterIiv, (void*)glad_lazy_glSamplerParameterIiv);
+	fn(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	static PFNGLSAMPLERPARAMETERIUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glSamplerParameterIuiv", (void**)&glad_glSamplerParameterIuiv, (void*)glad_lazy_glSamplerParameterIuiv);
+	fn(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	static PFNGLGETSAMPLERPARAMETERIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glGetSamplerParameteriv", (void**)&glad_glGetSamplerParameteriv, (void*)glad_lazy_glGetSamplerParameteriv);
+	fn(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	static PFNGLGETSAMPLERPARAMETERIIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glGetSamplerParameterIiv", (void**)&glad_glGetSamplerParameterIiv, (void*)glad_lazy_glGetSamplerParameterIiv);
+	fn(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	static PFNGLGETSAMPLERPARAMETERFVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glGetSamplerParameterfv", (void**)&glad_glGetSamplerParameterfv, (void*)glad_lazy_glGetSamplerParameterfv);
+	fn(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	static PFNGLGETSAMPLERPARAMETERIUIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glGetSamplerParameterIuiv", (void**)&glad_glGetSamplerParameterIuiv, (void*)glad_lazy_glGetSamplerParameterIuiv);
+	fn(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+	static PFNGLQUERYCOUNTERPROC fn = NULL; if(fn == NULL) fn = (PFNGLQUERYCOUNTERPROC)glad_lazy_resolve("glQueryCounter", (void**)&glad_glQueryCounter, (void*)glad_lazy_glQueryCounter);
+	fn(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	static PFNGLGETQUERYOBJECTI64VPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve("glGetQueryObjecti64v", (void**)&glad_glGetQueryObjecti64v, (void*)glad_lazy_glGetQueryObjecti64v);
+	fn(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	static PFNGLGETQUERYOBJECTUI64VPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve("glGetQueryObjectui64v", (void**)&glad_glGetQueryObjectui64v, (void*)glad_lazy_glGetQueryObjectui64v);
+	fn(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	static PFNGLVERTEXATTRIBDIVISORPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve("glVertexAttribDivisor", (void**)&glad_glVertexAttribDivisor, (void*)glad_lazy_glVertexAttribDivisor);
+	fn(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	static PFNGLVERTEXATTRIBP1UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve("glVertexAttribP1ui", (void**)&glad_glVertexAttribP1ui, (void*)glad_lazy_glVertexAttribP1ui);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	static PFNGLVERTEXATTRIBP1UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve("glVertexAttribP1uiv", (void**)&glad_glVertexAttribP1uiv, (void*)glad_lazy_glVertexAttribP1uiv);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	static PFNGLVERTEXATTRIBP2UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve("glVertexAttribP2ui", (void**)&glad_glVertexAttribP2ui, (void*)glad_lazy_glVertexAttribP2ui);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	static PFNGLVERTEXATTRIBP2UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve("glVertexAttribP2uiv", (void**)&glad_glVertexAttribP2uiv, (void*)glad_lazy_glVertexAttribP2uiv);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	static PFNGLVERTEXATTRIBP3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve("glVertexAttribP3ui", (void**)&glad_glVertexAttribP3ui, (void*)glad_lazy_glVertexAttribP3ui);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	static PFNGLVERTEXATTRIBP3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve("glVertexAttribP3uiv", (void**)&glad_glVertexAttribP3uiv, (void*)glad_lazy_glVertexAttribP3uiv);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	static PFNGLVERTEXATTRIBP4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve("glVertexAttribP4ui", (void**)&glad_glVertexAttribP4ui, (void*)glad_lazy_glVertexAttribP4ui);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	static PFNGLVERTEXATTRIBP4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve("glVertexAttribP4uiv", (void**)&glad_glVertexAttribP4uiv, (void*)glad_lazy_glVertexAttribP4uiv);
+	fn(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+	static PFNGLVERTEXP2UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXP2UIPROC)glad_lazy_resolve("glVertexP2ui", (void**)&glad_glVertexP2ui, (void*)glad_lazy_glVertexP2ui);
+	fn(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	static PFNGLVERTEXP2UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXP2UIVPROC)glad_lazy_resolve("glVertexP2uiv", (void**)&glad_glVertexP2uiv, (void*)glad_lazy_glVertexP2uiv);
+	fn(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+	static PFNGLVERTEXP3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXP3UIPROC)glad_lazy_resolve("glVertexP3ui", (void**)&glad_glVertexP3ui, (void*)glad_lazy_glVertexP3ui);
+	fn(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	static PFNGLVERTEXP3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXP3UIVPROC)glad_lazy_resolve("glVertexP3uiv", (void**)&glad_glVertexP3uiv, (void*)glad_lazy_glVertexP3uiv);
+	fn(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+	static PFNGLVERTEXP4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXP4UIPROC)glad_lazy_resolve("glVertexP4ui", (void**)&glad_glVertexP4ui, (void*)glad_lazy_glVertexP4ui);
+	fn(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	static PFNGLVERTEXP4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLVERTEXP4UIVPROC)glad_lazy_resolve("glVertexP4uiv", (void**)&glad_glVertexP4uiv, (void*)glad_lazy_glVertexP4uiv);
+	fn(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	static PFNGLTEXCOORDP1UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve("glTexCoordP1ui", (void**)&glad_glTexCoordP1ui, (void*)glad_lazy_glTexCoordP1ui);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	static PFNGLTEXCOORDP1UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve("glTexCoordP1uiv", (void**)&glad_glTexCoordP1uiv, (void*)glad_lazy_glTexCoordP1uiv);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	static PFNGLTEXCOORDP2UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve("glTexCoordP2ui", (void**)&glad_glTexCoordP2ui, (void*)glad_lazy_glTexCoordP2ui);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	static PFNGLTEXCOORDP2UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve("glTexCoordP2uiv", (void**)&glad_glTexCoordP2uiv, (void*)glad_lazy_glTexCoordP2uiv);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	static PFNGLTEXCOORDP3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve("glTexCoordP3ui", (void**)&glad_glTexCoordP3ui, (void*)glad_lazy_glTexCoordP3ui);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	static PFNGLTEXCOORDP3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve("glTexCoordP3uiv", (void**)&glad_glTexCoordP3uiv, (void*)glad_lazy_glTexCoordP3uiv);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	static PFNGLTEXCOORDP4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve("glTexCoordP4ui", (void**)&glad_glTexCoordP4ui, (void*)glad_lazy_glTexCoordP4ui);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	static PFNGLTEXCOORDP4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve("glTexCoordP4uiv", (void**)&glad_glTexCoordP4uiv, (void*)glad_lazy_glTexCoordP4uiv);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	static PFNGLMULTITEXCOORDP1UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve("glMultiTexCoordP1ui", (void**)&glad_glMultiTexCoordP1ui, (void*)glad_lazy_glMultiTexCoordP1ui);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	static PFNGLMULTITEXCOORDP1UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve("glMultiTexCoordP1uiv", (void**)&glad_glMultiTexCoordP1uiv, (void*)glad_lazy_glMultiTexCoordP1uiv);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	static PFNGLMULTITEXCOORDP2UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve("glMultiTexCoordP2ui", (void**)&glad_glMultiTexCoordP2ui, (void*)glad_lazy_glMultiTexCoordP2ui);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	static PFNGLMULTITEXCOORDP2UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve("glMultiTexCoordP2uiv", (void**)&glad_glMultiTexCoordP2uiv, (void*)glad_lazy_glMultiTexCoordP2uiv);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	static PFNGLMULTITEXCOORDP3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve("glMultiTexCoordP3ui", (void**)&glad_glMultiTexCoordP3ui, (void*)glad_lazy_glMultiTexCoordP3ui);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	static PFNGLMULTITEXCOORDP3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve("glMultiTexCoordP3uiv", (void**)&glad_glMultiTexCoordP3uiv, (void*)glad_lazy_glMultiTexCoordP3uiv);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	static PFNGLMULTITEXCOORDP4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve("glMultiTexCoordP4ui", (void**)&glad_glMultiTexCoordP4ui, (void*)glad_lazy_glMultiTexCoordP4ui);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	static PFNGLMULTITEXCOORDP4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve("glMultiTexCoordP4uiv", (void**)&glad_glMultiTexCoordP4uiv, (void*)glad_lazy_glMultiTexCoordP4uiv);
+	fn(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	static PFNGLNORMALP3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMALP3UIPROC)glad_lazy_resolve("glNormalP3ui", (void**)&glad_glNormalP3ui, (void*)glad_lazy_glNormalP3ui);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	static PFNGLNORMALP3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLNORMALP3UIVPROC)glad_lazy_resolve("glNormalP3uiv", (void**)&glad_glNormalP3uiv, (void*)glad_lazy_glNormalP3uiv);
+	fn(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+	static PFNGLCOLORP3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORP3UIPROC)glad_lazy_resolve("glColorP3ui", (void**)&glad_glColorP3ui, (void*)glad_lazy_glColorP3ui);
+	fn(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	static PFNGLCOLORP3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORP3UIVPROC)glad_lazy_resolve("glColorP3uiv", (void**)&glad_glColorP3uiv, (void*)glad_lazy_glColorP3uiv);
+	fn(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+	static PFNGLCOLORP4UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORP4UIPROC)glad_lazy_resolve("glColorP4ui", (void**)&glad_glColorP4ui, (void*)glad_lazy_glColorP4ui);
+	fn(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	static PFNGLCOLORP4UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLCOLORP4UIVPROC)glad_lazy_resolve("glColorP4uiv", (void**)&glad_glColorP4uiv, (void*)glad_lazy_glColorP4uiv);
+	fn(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	static PFNGLSECONDARYCOLORP3UIPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve("glSecondaryColorP3ui", (void**)&glad_glSecondaryColorP3ui, (void*)glad_lazy_glSecondaryColorP3ui);
+	fn(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	static PFNGLSECONDARYCOLORP3UIVPROC fn = NULL; if(fn == NULL) fn = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve("glSecondaryColorP3uiv", (void**)&glad_glSecondaryColorP3uiv, (void*)glad_lazy_glSecondaryColorP3uiv);
+	fn(type, color);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	static PFNGLBUFFERSTORAGEPROC fn = NULL; if(fn == NULL) fn = (PFNGLBUFFERSTORAGEPROC)glad_lazy_resolve("glBufferStorage", (void**)&glad_glBufferStorage, (void*)glad_lazy_glBufferStorage);
+	fn(target, size, data, flags);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	static PFNGLDRAWARRAYSINDIRECTPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_resolve("glDrawArraysIndirect", (void**)&glad_glDrawArraysIndirect, (void*)glad_lazy_glDrawArraysIndirect);
+	fn(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	static PFNGLDRAWELEMENTSINDIRECTPROC fn = NULL; if(fn == NULL) fn = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve("glDrawElementsIndirect", (void**)&glad_glDrawElementsIndirect, (void*)glad_lazy_glDrawElementsIndirect);
+	fn(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	static PFNGLGETPROGRAMBINARYPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETPROGRAMBINARYPROC)glad_lazy_resolve("glGetProgramBinary", (void**)&glad_glGetProgramBinary, (void*)glad_lazy_glGetProgramBinary);
+	fn(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	static PFNGLPROGRAMBINARYPROC fn = NULL; if(fn == NULL) fn = (PFNGLPROGRAMBINARYPROC)glad_lazy_resolve("glProgramBinary", (void**)&glad_glProgramBinary, (void*)glad_lazy_glProgramBinary);
+	fn(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	static PFNGLPROGRAMPARAMETERIPROC fn = NULL; if(fn == NULL) fn = (PFNGLPROGRAMPARAMETERIPROC)glad_lazy_resolve("glProgramParameteri", (void**)&glad_glProgramParameteri, (void*)glad_lazy_glProgramParameteri);
+	fn(program, pname, value);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	static PFNGLMULTIDRAWARRAYSINDIRECTPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_resolve("glMultiDrawArraysIndirect", (void**)&glad_glMultiDrawArraysIndirect, (void*)glad_lazy_glMultiDrawArraysIndirect);
+	fn(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	static PFNGLMULTIDRAWELEMENTSINDIRECTPROC fn = NULL; if(fn == NULL) fn = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve("glMultiDrawElementsIndirect", (void**)&glad_glMultiDrawElementsIndirect, (void*)glad_lazy_glMultiDrawElementsIndirect);
+	fn(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	static PFNGLDEBUGMESSAGECONTROLPROC fn = NULL; if(fn == NULL) fn = (PFNGLDEBUGMESSAGECONTROLPROC)glad_lazy_resolve("glDebugMessageControl", (void**)&glad_glDebugMessageControl, (void*)glad_lazy_glDebugMessageControl);
+	fn(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	static PFNGLDEBUGMESSAGEINSERTPROC fn = NULL; if(fn == NULL) fn = (PFNGLDEBUGMESSAGEINSERTPROC)glad_lazy_resolve("glDebugMessageInsert", (void**)&glad_glDebugMessageInsert, (void*)glad_lazy_glDebugMessageInsert);
+	fn(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	static PFNGLDEBUGMESSAGECALLBACKPROC fn = NULL; if(fn == NULL) fn = (PFNGLDEBUGMESSAGECALLBACKPROC)glad_lazy_resolve("glDebugMessageCallback", (void**)&glad_glDebugMessageCallback, (void*)glad_lazy_glDebugMessageCallback);
+	fn(callback, userParam);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	static PFNGLGETDEBUGMESSAGELOGPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETDEBUGMESSAGELOGPROC)glad_lazy_resolve("glGetDebugMessageLog", (void**)&glad_glGetDebugMessageLog, (void*)glad_lazy_glGetDebugMessageLog);
+	return fn(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	static PFNGLPUSHDEBUGGROUPPROC fn = NULL; if(fn == NULL) fn = (PFNGLPUSHDEBUGGROUPPROC)glad_lazy_resolve("glPushDebugGroup", (void**)&glad_glPushDebugGroup, (void*)glad_lazy_glPushDebugGroup);
+	fn(source, id, length, message);
+}
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+	static PFNGLPOPDEBUGGROUPPROC fn = NULL; if(fn == NULL) fn = (PFNGLPOPDEBUGGROUPPROC)glad_lazy_resolve("glPopDebugGroup", (void**)&glad_glPopDebugGroup, (void*)glad_lazy_glPopDebugGroup);
+	fn();
+}
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	static PFNGLOBJECTLABELPROC fn = NULL; if(fn == NULL) fn = (PFNGLOBJECTLABELPROC)glad_lazy_resolve("glObjectLabel", (void**)&glad_glObjectLabel, (void*)glad_lazy_glObjectLabel);
+	fn(identifier, name, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	static PFNGLGETOBJECTLABELPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETOBJECTLABELPROC)glad_lazy_resolve("glGetObjectLabel", (void**)&glad_glGetObjectLabel, (void*)glad_lazy_glGetObjectLabel);
+	fn(identifier, name, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	static PFNGLOBJECTPTRLABELPROC fn = NULL; if(fn == NULL) fn = (PFNGLOBJECTPTRLABELPROC)glad_lazy_resolve("glObjectPtrLabel", (void**)&glad_glObjectPtrLabel, (void*)glad_lazy_glObjectPtrLabel);
+	fn(ptr, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	static PFNGLGETOBJECTPTRLABELPROC fn = NULL; if(fn == NULL) fn = (PFNGLGETOBJECTPTRLABELPROC)glad_lazy_resolve("glGetObjectPtrLabel", (void**)&glad_glGetObjectPtrLabel, (void*)glad_lazy_glGetObjectPtrLabel);
+	fn(ptr, bufSize, length, label);
+}
+static void glad_lazy_install_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+	glad_glNewList = glad_lazy_glNewList;
+	glad_glEndList = glad_lazy_glEndList;
+	glad_glCallList = glad_lazy_glCallList;
+	glad_glCallLists = glad_lazy_glCallLists;
+	glad_glDeleteLists = glad_lazy_glDeleteLists;
+	glad_glGenLists = glad_lazy_glGenLists;
+	glad_glListBase = glad_lazy_glListBase;
+	glad_glBegin = glad_lazy_glBegin;
+	glad_glBitmap = glad_lazy_glBitmap;
+	glad_glColor3b = glad_lazy_glColor3b;
+	glad_glColor3bv = glad_lazy_glColor3bv;
+	glad_glColor3d = glad_lazy_glColor3d;
+	glad_glColor3dv = glad_lazy_glColor3dv;
+	glad_glColor3f = glad_lazy_glColor3f;
+	glad_glColor3fv = glad_lazy_glColor3fv;
+	glad_glColor3i = glad_lazy_glColor3i;
+	glad_glColor3iv = glad_lazy_glColor3iv;
+	glad_glColor3s = glad_lazy_glColor3s;
+	glad_glColor3sv = glad_lazy_glColor3sv;
+	glad_glColor3ub = glad_lazy_glColor3ub;
+	glad_glColor3ubv = glad_lazy_glColor3ubv;
+	glad_glColor3ui = glad_lazy_glColor3ui;
+	glad_glColor3uiv = glad_lazy_glColor3uiv;
+	glad_glColor3us = glad_lazy_glColor3us;
+	glad_glColor3usv = glad_lazy_glColor3usv;
+	glad_glColor4b = glad_lazy_glColor4b;
+	glad_glColor4bv = glad_lazy_glColor4bv;
+	glad_glColor4d = glad_lazy_glColor4d;
+	glad_glColor4dv = glad_lazy_glColor4dv;
+	glad_glColor4f = glad_lazy_glColor4f;
+	glad_glColor4fv = glad_lazy_glColor4fv;
+	glad_glColor4i = glad_lazy_glColor4i;
+	glad_glColor4iv = glad_lazy_glColor4iv;
+	glad_glColor4s = glad_lazy_glColor4s;
+	glad_glColor4sv = glad_lazy_glColor4sv;
+	glad_glColor4ub = glad_lazy_glColor4ub;
+	glad_glColor4ubv = glad_lazy_glColor4ubv;
+	glad_glColor4ui = glad_lazy_glColor4ui;
+	glad_glColor4uiv = glad_lazy_glColor4uiv;
+	glad_glColor4us = glad_lazy_glColor4us;
+	glad_glColor4usv = glad_lazy_glColor4usv;
+	glad_glEdgeFlag = glad_lazy_glEdgeFlag;
+	glad_glEdgeFlagv = glad_lazy_glEdgeFlagv;
+	glad_glEnd = glad_lazy_glEnd;
+	glad_glIndexd = glad_lazy_glIndexd;
+	glad_glIndexdv = glad_lazy_glIndexdv;
+	glad_glIndexf = glad_lazy_glIndexf;
+	glad_glIndexfv = glad_lazy_glIndexfv;
+	glad_glIndexi = glad_lazy_glIndexi;
+	glad_glIndexiv = glad_lazy_glIndexiv;
+	glad_glIndexs = glad_lazy_glIndexs;
+	glad_glIndexsv = glad_lazy_glIndexsv;
+	glad_glNormal3b = glad_lazy_glNormal3b;
+	glad_glNormal3bv = glad_lazy_glNormal3bv;
+	glad_glNormal3d = glad_lazy_glNormal3d;
+	glad_glNormal3dv = glad_lazy_glNormal3dv;
+	glad_glNormal3f = glad_lazy_glNormal3f;
+	glad_glNormal3fv = glad_lazy_glNormal3fv;
+	glad_glNormal3i = glad_lazy_glNormal3i;
+	glad_glNormal3iv = glad_lazy_glNormal3iv;
+	glad_glNormal3s = glad_lazy_glNormal3s;
+	glad_glNormal3sv = glad_lazy_glNormal3sv;
+	glad_glRasterPos2d = glad_lazy_glRasterPos2d;
+	glad_glRasterPos2dv = glad_lazy_glRasterPos2dv;
+	glad_glRasterPos2f = glad_lazy_glRasterPos2f;
+	glad_glRasterPos2fv = glad_lazy_glRasterPos2fv;
+	glad_glRasterPos2i = glad_lazy_glRasterPos2i;
+	glad_glRasterPos2iv = glad_lazy_glRasterPos2iv;
+	glad_glRasterPos2s = glad_lazy_glRasterPos2s;
+	glad_glRasterPos2sv = glad_lazy_glRasterPos2sv;
+	glad_glRasterPos3d = glad_lazy_glRasterPos3d;
+	glad_glRasterPos3dv = glad_lazy_glRasterPos3dv;
+	glad_glRasterPos3f = glad_lazy_glRasterPos3f;
+	glad_glRasterPos3fv = glad_lazy_glRasterPos3fv;
+	glad_glRasterPos3i = glad_lazy_glRasterPos3i;
+	glad_glRasterPos3iv = glad_lazy_glRasterPos3iv;
+	glad_glRasterPos3s = glad_lazy_glRasterPos3s;
+	glad_glRasterPos3sv = glad_lazy_glRasterPos3sv;
+	glad_glRasterPos4d = glad_lazy_glRasterPos4d;
+	glad_glRasterPos4dv = glad_lazy_glRasterPos4dv;
+	glad_glRasterPos4f = glad_lazy_glRasterPos4f;
+	glad_glRasterPos4fv = glad_lazy_glRasterPos4fv;
+	glad_glRasterPos4i = glad_lazy_glRasterPos4i;
+	glad_glRasterPos4iv = glad_lazy_glRasterPos4iv;
+	glad_glRasterPos4s = glad_lazy_glRasterPos4s;
+	glad_glRasterPos4sv = glad_lazy_glRasterPos4sv;
+	glad_glRectd = glad_lazy_glRectd;
+	glad_glRectdv = glad_lazy_glRectdv;
+	glad_glRectf = glad_lazy_glRectf;
+	glad_glRectfv = glad_lazy_glRectfv;
+	glad_glRecti = glad_lazy_glRecti;
+	glad_glRectiv = glad_lazy_glRectiv;
+	glad_glRects = glad_lazy_glRects;
+	glad_glRectsv = glad_lazy_glRectsv;
+	glad_glTexCoord1d = glad_lazy_glTexCoord1d;
+	glad_glTexCoord1dv = glad_lazy_glTexCoord1dv;
+	glad_glTexCoord1f = glad_lazy_glTexCoord1f;
+	glad_glTexCoord1fv = glad_lazy_glTexCoord1fv;
+	glad_glTexCoord1i = glad_lazy_glTexCoord1i;
+	glad_glTexCoord1iv = glad_lazy_glTexCoord1iv;
+	glad_glTexCoord1s = glad_lazy_glTexCoord1s;
+	glad_glTexCoord1sv = glad_lazy_glTexCoord1sv;
+	glad_glTexCoord2d = glad_lazy_glTexCoord2d;
+	glad_glTexCoord2dv = glad_lazy_glTexCoord2dv;
+	glad_glTexCoord2f = glad_lazy_glTexCoord2f;
+	glad_glTexCoord2fv = glad_lazy_glTexCoord2fv;
+	glad_glTexCoord2i = glad_lazy_glTexCoord2i;
+	glad_glTexCoord2iv = glad_lazy_glTexCoord2iv;
+	glad_glTexCoord2s = glad_lazy_glTexCoord2s;
+	glad_glTexCoord2sv = glad_lazy_glTexCoord2sv;
+	glad_glTexCoord3d = glad_lazy_glTexCoord3d;
+	glad_glTexCoord3dv = glad_lazy_glTexCoord3dv;
+	glad_glTexCoord3f = glad_lazy_glTexCoord3f;
+	glad_glTexCoord3fv = glad_lazy_glTexCoord3fv;
+	glad_glTexCoord3i = glad_lazy_glTexCoord3i;
+	glad_glTexCoord3iv = glad_lazy_glTexCoord3iv;
+	glad_glTexCoord3s = glad_lazy_glTexCoord3s;
+	glad_glTexCoord3sv = glad_lazy_glTexCoord3sv;
+	glad_glTexCoord4d = glad_lazy_glTexCoord4d;
+	glad_glTexCoord4dv = glad_lazy_glTexCoord4dv;
+	glad_glTexCoord4f = glad_lazy_glTexCoord4f;
+	glad_glTexCoord4fv = glad_lazy_glTexCoord4fv;
+	glad_glTexCoord4i = glad_lazy_glTexCoord4i;
+	glad_glTexCoord4iv = glad_lazy_glTexCoord4iv;
+	glad_glTexCoord4s = glad_lazy_glTexCoord4s;
+	glad_glTexCoord4sv = glad_lazy_glTexCoord4sv;
+	glad_glVertex2d = glad_lazy_glVertex2d;
+	glad_glVertex2dv = glad_lazy_glVertex2dv;
+	glad_glVertex2f = glad_lazy_glVertex2f;
+	glad_glVertex2fv = glad_lazy_glVertex2fv;
+	glad_glVertex2i = glad_lazy_glVertex2i;
+	glad_glVertex2iv = glad_lazy_glVertex2iv;
+	glad_glVertex2s = glad_lazy_glVertex2s;
+	glad_glVertex2sv = glad_lazy_glVertex2sv;
+	glad_glVertex3d = glad_lazy_glVertex3d;
+	glad_glVertex3dv = glad_lazy_glVertex3dv;
+	glad_glVertex3f = glad_lazy_glVertex3f;
+	glad_glVertex3fv = glad_lazy_glVertex3fv;
+	glad_glVertex3i = glad_lazy_glVertex3i;
+	glad_glVertex3iv = glad_lazy_glVertex3iv;
+	glad_glVertex3s = glad_lazy_glVertex3s;
+	glad_glVertex3sv = glad_lazy_glVertex3sv;
+	glad_glVertex4d = glad_lazy_glVertex4d;
+	glad_glVertex4dv = glad_lazy_glVertex4dv;
+	glad_glVertex4f = glad_lazy_glVertex4f;
+	glad_glVertex4fv = glad_lazy_glVertex4fv;
+	glad_glVertex4i = glad_lazy_glVertex4i;
+	glad_glVertex4iv = glad_lazy_glVertex4iv;
+	glad_glVertex4s = glad_lazy_glVertex4s;
+	glad_glVertex4sv = glad_lazy_glVertex4sv;
+	glad_glClipPlane = glad_lazy_glClipPlane;
+	glad_glColorMaterial = glad_lazy_glColorMaterial;
+	glad_glFogf = glad_lazy_glFogf;
+	glad_glFogfv = glad_lazy_glFogfv;
+	glad_glFogi = glad_lazy_glFogi;
+	glad_glFogiv = glad_lazy_glFogiv;
+	glad_glLightf = glad_lazy_glLightf;
+	glad_glLightfv = glad_lazy_glLightfv;
+	glad_glLighti = glad_lazy_glLighti;
+	glad_glLightiv = glad_lazy_glLightiv;
+	glad_glLightModelf = glad_lazy_glLightModelf;
+	glad_glLightModelfv = glad_lazy_glLightModelfv;
+	glad_glLightModeli = glad_lazy_glLightModeli;
+	glad_glLightModeliv = glad_lazy_glLightModeliv;
+	glad_glLineStipple = glad_lazy_glLineStipple;
+	glad_glMaterialf = glad_lazy_glMaterialf;
+	glad_glMaterialfv = glad_lazy_glMaterialfv;
+	glad_glMateriali = glad_lazy_glMateriali;
+	glad_glMaterialiv = glad_lazy_glMaterialiv;
+	glad_glPolygonStipple = glad_lazy_glPolygonStipple;
+	glad_glShadeModel = glad_lazy_glShadeModel;
+	glad_glTexEnvf = glad_lazy_glTexEnvf;
+	glad_glTexEnvfv = glad_lazy_glTexEnvfv;
+	glad_glTexEnvi = glad_lazy_glTexEnvi;
+	glad_glTexEnviv = glad_lazy_glTexEnviv;
+	glad_glTexGend = glad_lazy_glTexGend;
+	glad_glTexGendv = glad_lazy_glTexGendv;
+	glad_glTexGenf = glad_lazy_glTexGenf;
+	glad_glTexGenfv = glad_lazy_glTexGenfv;
+	glad_glTexGeni = glad_lazy_glTexGeni;
+	glad_glTexGeniv = glad_lazy_glTexGeniv;
+	glad_glFeedbackBuffer = glad_lazy_glFeedbackBuffer;
+	glad_glSelectBuffer = glad_lazy_glSelectBuffer;
+	glad_glRenderMode = glad_lazy_glRenderMode;
+	glad_glInitNames = glad_lazy_glInitNames;
+	glad_glLoadName = glad_lazy_glLoadName;
+	glad_glPassThrough = glad_lazy_glPassThrough;
+	glad_glPopName = glad_lazy_glPopName;
+	glad_glPushName = glad_lazy_glPushName;
+	glad_glClearAccum = glad_lazy_glClearAccum;
+	glad_glClearIndex = glad_lazy_glClearIndex;
+	glad_glIndexMask = glad_lazy_glIndexMask;
+	glad_glAccum = glad_lazy_glAccum;
+	glad_glPopAttrib = glad_lazy_glPopAttrib;
+	glad_glPushAttrib = glad_lazy_glPushAttrib;
+	glad_glMap1d = glad_lazy_glMap1d;
+	glad_glMap1f = glad_lazy_glMap1f;
+	glad_glMap2d = glad_lazy_glMap2d;
+	glad_glMap2f = glad_lazy_glMap2f;
+	glad_glMapGrid1d = glad_lazy_glMapGrid1d;
+	glad_glMapGrid1f = glad_lazy_glMapGrid1f;
+	glad_glMapGrid2d = glad_lazy_glMapGrid2d;
+	glad_glMapGrid2f = glad_lazy_glMapGrid2f;
+	glad_glEvalCoord1d = glad_lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = glad_lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = glad_lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = glad_lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = glad_lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = glad_lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = glad_lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = glad_lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = glad_lazy_glEvalMesh1;
+	glad_glEvalPoint1 = glad_lazy_glEvalPoint1;
+	glad_glEvalMesh2 = glad_lazy_glEvalMesh2;
+	glad_glEvalPoint2 = glad_lazy_glEvalPoint2;
+	glad_glAlphaFunc = glad_lazy_glAlphaFunc;
+	glad_glPixelZoom = glad_lazy_glPixelZoom;
+	glad_glPixelTransferf = glad_lazy_glPixelTransferf;
+	glad_glPixelTransferi = glad_lazy_glPixelTransferi;
+	glad_glPixelMapfv = glad_lazy_glPixelMapfv;
+	glad_glPixelMapuiv = glad_lazy_glPixelMapuiv;
+	glad_glPixelMapusv = glad_lazy_glPixelMapusv;
+	glad_glCopyPixels = glad_lazy_glCopyPixels;
+	glad_glDrawPixels = glad_lazy_glDrawPixels;
+	glad_glGetClipPlane = glad_lazy_glGetClipPlane;
+	glad_glGetLightfv = glad_lazy_glGetLightfv;
+	glad_glGetLightiv = glad_lazy_glGetLightiv;
+	glad_glGetMapdv = glad_lazy_glGetMapdv;
+	glad_glGetMapfv = glad_lazy_glGetMapfv;
+	glad_glGetMapiv = glad_lazy_glGetMapiv;
+	glad_glGetMaterialfv = glad_lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = glad_lazy_glGetMaterialiv;
+	glad_glGetPixelMapfv = glad_lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = glad_lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = glad_lazy_glGetPixelMapusv;
+	glad_glGetPolygonStipple = glad_lazy_glGetPolygonStipple;
+	glad_glGetTexEnvfv = glad_lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = glad_lazy_glGetTexEnviv;
+	glad_glGetTexGendv = glad_lazy_glGetTexGendv;
+	glad_glGetTexGenfv = glad_lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = glad_lazy_glGetTexGeniv;
+	glad_glIsList = glad_lazy_glIsList;
+	glad_glFrustum = glad_lazy_glFrustum;
+	glad_glLoadIdentity = glad_lazy_glLoadIdentity;
+	glad_glLoadMatrixf = glad_lazy_glLoadMatrixf;
+	glad_glLoadMatrixd = glad_lazy_glLoadMatrixd;
+	glad_glMatrixMode = glad_lazy_glMatrixMode;
+	glad_glMultMatrixf = glad_lazy_glMultMatrixf;
+	glad_glMultMatrixd = glad_lazy_glMultMatrixd;
+	glad_glOrtho = glad_lazy_glOrtho;
+	glad_glPopMatrix = glad_lazy_glPopMatrix;
+	glad_glPushMatrix = glad_lazy_glPushMatrix;
+	glad_glRotated = glad_lazy_glRotated;
+	glad_glRotatef = glad_lazy_glRotatef;
+	glad_glScaled = glad_lazy_glScaled;
+	glad_glScalef = glad_lazy_glScalef;
+	glad_glTranslated = glad_lazy_glTranslated;
+	glad_glTranslatef = glad_lazy_glTranslatef;
+}
+static void glad_lazy_install_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+	glad_glArrayElement = glad_lazy_glArrayElement;
+	glad_glColorPointer = glad_lazy_glColorPointer;
+	glad_glDisableClientState = glad_lazy_glDisableClientState;
+	glad_glEdgeFlagPointer = glad_lazy_glEdgeFlagPointer;
+	glad_glEnableClientState = glad_lazy_glEnableClientState;
+	glad_glIndexPointer = glad_lazy_glIndexPointer;
+	glad_glInterleavedArrays = glad_lazy_glInterleavedArrays;
+	glad_glNormalPointer = glad_lazy_glNormalPointer;
+	glad_glTexCoordPointer = glad_lazy_glTexCoordPointer;
+	glad_glVertexPointer = glad_lazy_glVertexPointer;
+	glad_glAreTexturesResident = glad_lazy_glAreTexturesResident;
+	glad_glPrioritizeTextures = glad_lazy_glPrioritizeTextures;
+	glad_glIndexub = glad_lazy_glIndexub;
+	glad_glIndexubv = glad_lazy_glIndexubv;
+	glad_glPopClientAttrib = glad_lazy_glPopClientAttrib;
+	glad_glPushClientAttrib = glad_lazy_glPushClientAttrib;
+}
+static void glad_lazy_install_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void glad_lazy_install_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+	glad_glClientActiveTexture = glad_lazy_glClientActiveTexture;
+	glad_glMultiTexCoord1d = glad_lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = glad_lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = glad_lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = glad_lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = glad_lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = glad_lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = glad_lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = glad_lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = glad_lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = glad_lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = glad_lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = glad_lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = glad_lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = glad_lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = glad_lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = glad_lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = glad_lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = glad_lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = glad_lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = glad_lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = glad_lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = glad_lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = glad_lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = glad_lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = glad_lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = glad_lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = glad_lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = glad_lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = glad_lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = glad_lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = glad_lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = glad_lazy_glMultiTexCoord4sv;
+	glad_glLoadTransposeMatrixf = glad_lazy_glLoadTransposeMatrixf;
+	glad_glLoadTransposeMatrixd = glad_lazy_glLoadTransposeMatrixd;
+	glad_glMultTransposeMatrixf = glad_lazy_glMultTransposeMatrixf;
+	glad_glMultTransposeMatrixd = glad_lazy_glMultTransposeMatrixd;
+}
+static void glad_lazy_install_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glFogCoordf = glad_lazy_glFogCoordf;
+	glad_glFogCoordfv = glad_lazy_glFogCoordfv;
+	glad_glFogCoordd = glad_lazy_glFogCoordd;
+	glad_glFogCoorddv = glad_lazy_glFogCoorddv;
+	glad_glFogCoordPointer = glad_lazy_glFogCoordPointer;
+	glad_glSecondaryColor3b = glad_lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = glad_lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = glad_lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = glad_lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = glad_lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = glad_lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = glad_lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = glad_lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = glad_lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = glad_lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = glad_lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = glad_lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = glad_lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = glad_lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = glad_lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = glad_lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorPointer = glad_lazy_glSecondaryColorPointer;
+	glad_glWindowPos2d = glad_lazy_glWindowPos2d;
+	glad_glWindowPos2dv = glad_lazy_glWindowPos2dv;
+	glad_glWindowPos2f = glad_lazy_glWindowPos2f;
+	glad_glWindowPos2fv = glad_lazy_glWindowPos2fv;
+	glad_glWindowPos2i = glad_lazy_glWindowPos2i;
+	glad_glWindowPos2iv = glad_lazy_glWindowPos2iv;
+	glad_glWindowPos2s = glad_lazy_glWindowPos2s;
+	glad_glWindowPos2sv = glad_lazy_glWindowPos2sv;
+	glad_glWindowPos3d = glad_lazy_glWindowPos3d;
+	glad_glWindowPos3dv = glad_lazy_glWindowPos3dv;
+	glad_glWindowPos3f = glad_lazy_glWindowPos3f;
+	glad_glWindowPos3fv = glad_lazy_glWindowPos3fv;
+	glad_glWindowPos3i = glad_lazy_glWindowPos3i;
+	glad_glWindowPos3iv = glad_lazy_glWindowPos3iv;
+	glad_glWindowPos3s = glad_lazy_glWindowPos3s;
+	glad_glWindowPos3sv = glad_lazy_glWindowPos3sv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void glad_lazy_install_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void glad_lazy_install_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void glad_lazy_install_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void glad_lazy_install_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void glad_lazy_install_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+}
+static void glad_lazy_install_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void glad_lazy_install_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void glad_lazy_install_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+}
+static void glad_lazy_install_GL_ARB_draw_indirect(void) {
+	if(!GLAD_GL_ARB_draw_indirect) return;
+	glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+}
+static void glad_lazy_install_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+}
+static void glad_lazy_install_GL_ARB_multi_draw_indirect(void) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+}
+static void glad_lazy_install_GL_KHR_debug(void) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+	glad_glObjectLabel = glad_lazy_glObjectLabel;
+	glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+}
+static void glad_lazy_install_core(void) {
+	glad_lazy_install_GL_VERSION_1_0();
+	glad_lazy_install_GL_VERSION_1_1();
+	glad_lazy_install_GL_VERSION_1_2();
+	glad_lazy_install_GL_VERSION_1_3();
+	glad_lazy_install_GL_VERSION_1_4();
+	glad_lazy_install_GL_VERSION_1_5();
+	glad_lazy_install_GL_VERSION_2_0();
+	glad_lazy_install_GL_VERSION_2_1();
+	glad_lazy_install_GL_VERSION_3_0();
+	glad_lazy_install_GL_VERSION_3_1();
+	glad_lazy_install_GL_VERSION_3_2();
+	glad_lazy_install_GL_VERSION_3_3();
+}
+static void glad_lazy_install_extensions(void) {
+	glad_lazy_install_GL_ARB_buffer_storage();
+	glad_lazy_install_GL_ARB_draw_indirect();
+	glad_lazy_install_GL_ARB_get_program_binary();
+	glad_lazy_install_GL_ARB_multi_draw_indirect();
+	glad_lazy_install_GL_KHR_debug();
+}
+/* ---- end of generated lazy loader ---- */
+
+/* one pass over the extension list, comparing against the extensions we know about; no copies */
+static int find_extensionsGL_lazy(void) {
+	static struct { const char *name; int *flag; } known[] = {
+		{ "GL_ARB_buffer_storage", &GLAD_GL_ARB_buffer_storage },
+		{ "GL_ARB_draw_indirect", &GLAD_GL_ARB_draw_indirect },
+		{ "GL_ARB_get_program_binary", &GLAD_GL_ARB_get_program_binary },
+		{ "GL_ARB_multi_draw_indirect", &GLAD_GL_ARB_multi_draw_indirect },
+		{ "GL_KHR_debug", &GLAD_GL_KHR_debug }
+	};
+	GLint count = 0, index;
+	unsigned int k;
+	if(glGetStringi == NULL) return 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for(k = 0; k < sizeof(known) / sizeof(known[0]); k++) *known[k].flag = 0;
+	for(index = 0; index < count; index++) {
+		const char *ext = (const char *)glGetStringi(GL_EXTENSIONS, (GLuint)index);
+		if(ext == NULL || strncmp(ext, "GL_", 3) != 0) continue;
+		if(strncmp(ext + 3, "ARB_", 4) != 0 && strncmp(ext + 3, "KHR_", 4) != 0) continue;
+		for(k = 0; k < sizeof(known) / sizeof(known[0]); k++) {
+			if(strcmp(ext, known[k].name) == 0) {
+				*known[k].flag = 1;
+				break;
+			}
+		}
+	}
+	return 1;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_loader = load;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	glad_lazy_install_core();
+	if(GLVersion.major < 3) return 0; /* the lazy extension scan needs glGetStringi */
+	if (!find_extensionsGL_lazy()) return 0;
+	find_capabilitiesGL();
+	glad_lazy_install_extensions();
+	return 1;
+}
+
+static GLADtraceproc glad_trace_pre_callback = NULL;
+static GLADtraceproc glad_trace_post_callback = NULL;
+static void *glad_trace_user = NULL;
+
+static void glad_trace_pre(unsigned int function) {
+	if(glad_trace_pre_callback != NULL) glad_trace_pre_callback(function, glad_trace_user);
+}
+static void glad_trace_post(unsigned int function) {
+	if(glad_trace_post_callback != NULL) glad_trace_post_callback(function, glad_trace_user);
+}
+
+/* ---- trace layer: generated by tools/glad_lazy.py, do not edit ---- */
+
+static const char *glad_trace_names[742] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glNewList",
+	"glEndList",
+	"glCallList",
+	"glCallLists",
+	"glDeleteLists",
+	"glGenLists",
+	"glListBase",
+	"glBegin",
+	"glBitmap",
+	"glColor3b",
+	"glColor3bv",
+	"glColor3d",
+	"glColor3dv",
+	"glColor3f",
+	"glColor3fv",
+	"glColor3i",
+	"glColor3iv",
+	"glColor3s",
+	"glColor3sv",
+	"glColor3ub",
+	"glColor3ubv",
+	"glColor3ui",
+	"glColor3uiv",
+	"glColor3us",
+	"glColor3usv",
+	"glColor4b",
+	"glColor4bv",
+	"glColor4d",
+	"glColor4dv",
+	"glColor4f",
+	"glColor4fv",
+	"glColor4i",
+	"glColor4iv",
+	"glColor4s",
+	"glColor4sv",
+	"glColor4ub",
+	"glColor4ubv",
+	"glColor4ui",
+	"glColor4uiv",
+	"glColor4us",
+	"glColor4usv",
+	"glEdgeFlag",
+	"glEdgeFlagv",
+	"glEnd",
+	"glIndexd",
+	"glIndexdv",
+	"glIndexf",
+	"glIndexfv",
+	"glIndexi",
+	"glIndexiv",
+	"glIndexs",
+	"glIndexsv",
+	"glNormal3b",
+	"glNormal3bv",
+	"glNormal3d",
+	"glNormal3dv",
+	"glNormal3f",
+	"glNormal3fv",
+	"glNormal3i",
+	"glNormal3iv",
+	"glNormal3s",
+	"glNormal3sv",
+	"glRasterPos2d",
+	"glRasterPos2dv",
+	"glRasterPos2f",
+	"glRasterPos2fv",
+	"glRasterPos2i",
+	"glRasterPos2iv",
+	"glRasterPos2s",
+	"glRasterPos2sv",
+	"glRasterPos3d",
+	"glRasterPos3dv",
+	"glRasterPos3f",
+	"glRasterPos3fv",
+	"glRasterPos3i",
+	"glRasterPos3iv",
+	"glRasterPos3s",
+	"glRasterPos3sv",
+	"glRasterPos4d",
+	"glRasterPos4dv",
+	"glRasterPos4f",
+	"glRasterPos4fv",
+	"glRasterPos4i",
+	"glRasterPos4iv",
+	"glRasterPos4s",
+	"glRasterPos4sv",
+	"glRectd",
+	"glRectdv",
+	"glRectf",
+	"glRectfv",
+	"glRecti",
+	"glRectiv",
+	"glRects",
+	"glRectsv",
+	"glTexCoord1d",
+	"glTexCoord1dv",
+	"glTexCoord1f",
+	"glTexCoord1fv",
+	"glTexCoord1i",
+	"glTexCoord1iv",
+	"glTexCoord1s",
+	"glTexCoord1sv",
+	"glTexCoord2d",
+	"glTexCoord2dv",
+	"glTexCoord2f",
+	"glTexCoord2fv",
+	"glTexCoord2i",
+	"glTexCoord2iv",
+	"glTexCoord2s",
+	"glTexCoord2sv",
+	"glTexCoord3d",
+	"glTexCoord3dv",
+	"glTexCoord3f",
+	"glTexCoord3fv",
+	"glTexCoord3i",
+	"glTexCoord3iv",
+	"glTexCoord3s",
+	"glTexCoord3sv",
+	"glTexCoord4d",
+	"glTexCoord4dv",
+	"glTexCoord4f",
+	"glTexCoord4fv",
+	"glTexCoord4i",
+	"glTexCoord4iv",
+	"glTexCoord4s",
+	"glTexCoord4sv",
+	"glVertex2d",
+	"glVertex2dv",
+	"glVertex2f",
+	"glVertex2fv",
+	"glVertex2i",
+	"glVertex2iv",
+	"glVertex2s",
+	"glVertex2sv",
+	"glVertex3d",
+	"glVertex3dv",
+	"glVertex3f",
+	"glVertex3fv",
+	"glVertex3i",
+	"glVertex3iv",
+	"glVertex3s",
+	"glVertex3sv",
+	"glVertex4d",
+	"glVertex4dv",
+	"glVertex4f",
+	"glVertex4fv",
+	"glVertex4i",
+	"glVertex4iv",
+	"glVertex4s",
+	"glVertex4sv",
+	"glClipPlane",
+	"glColorMaterial",
+	"glFogf",
+	"glFogfv",
+	"glFogi",
+	"glFogiv",
+	"glLightf",
+	"glLightfv",
+	"glLighti",
+	"glLightiv",
+	"glLightModelf",
+	"glLightModelfv",
+	"glLightModeli",
+	"glLightModeliv",
+	"glLineStipple",
+	"glMaterialf",
+	"glMaterialfv",
+	"glMateriali",
+	"glMaterialiv",
+	"glPolygonStipple",
+	"glShadeModel",
+	"glTexEnvf",
+	"glTexEnvfv",
+	"glTexEnvi",
+	"glTexEnviv",
+	"glTexGend",
+	"glTexGendv",
+	"glTexGenf",
+	"glTexGenfv",
+	"glTexGeni",
+	"glTexGeniv",
+	"glFeedbackBuffer",
+	"glSelectBuffer",
+	"glRenderMode",
+	"glInitNames",
+	"glLoadName",
+	"glPassThrough",
+	"glPopName",
+	"glPushName",
+	"glClearAccum",
+	"glClearIndex",
+	"glIndexMask",
+	"glAccum",
+	"glPopAttrib",
+	"glPushAttrib",
+	"glMap1d",
+	"glMap1f",
+	"glMap2d",
+	"glMap2f",
+	"glMapGrid1d",
+	"glMapGrid1f",
+	"glMapGrid2d",
+	"glMapGrid2f",
+	"glEvalCoord1d",
+	"glEvalCoord1dv",
+	"glEvalCoord1f",
+	"glEvalCoord1fv",
+	"glEvalCoord2d",
+	"glEvalCoord2dv",
+	"glEvalCoord2f",
+	"glEvalCoord2fv",
+	"glEvalMesh1",
+	"glEvalPoint1",
+	"glEvalMesh2",
+	"glEvalPoint2",
+	"glAlphaFunc",
+	"glPixelZoom",
+	"glPixelTransferf",
+	"glPixelTransferi",
+	"glPixelMapfv",
+	"glPixelMapuiv",
+	"glPixelMapusv",
+	"glCopyPixels",
+	"glDrawPixels",
+	"glGetClipPlane",
+	"glGetLightfv",
+	"glGetLightiv",
+	"glGetMapdv",
+	"glGetMapfv",
+	"glGetMapiv",
+	"glGetMaterialfv",
+	"glGetMaterialiv",
+	"glGetPixelMapfv",
+	"glGetPixelMapuiv",
+	"glGetPixelMapusv",
+	"glGetPolygonStipple",
+	"glGetTexEnvfv",
+	"glGetTexEnviv",
+	"glGetTexGendv",
+	"glGetTexGenfv",
+	"glGetTexGeniv",
+	"glIsList",
+	"glFrustum",
+	"glLoadIdentity",
+	"glLoadMatrixf",
+	"glLoadMatrixd",
+	"glMatrixMode",
+	"glMultMatrixf",
+	"glMultMatrixd",
+	"glOrtho",
+	"glPopMatrix",
+	"glPushMatrix",
+	"glRotated",
+	"glRotatef",
+	"glScaled",
+	"glScalef",
+	"glTranslated",
+	"glTranslatef",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glArrayElement",
+	"glColorPointer",
+	"glDisableClientState",
+	"glEdgeFlagPointer",
+	"glEnableClientState",
+	"glIndexPointer",
+	"glInterleavedArrays",
+	"glNormalPointer",
+	"glTexCoordPointer",
+	"glVertexPointer",
+	"glAreTexturesResident",
+	"glPrioritizeTextures",
+	"glIndexub",
+	"glIndexubv",
+	"glPopClientAttrib",
+	"glPushClientAttrib",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glClientActiveTexture",
+	"glMultiTexCoord1d",
+	"glMultiTexCoord1dv",
+	"glMultiTexCoord1f",
+	"glMultiTexCoord1fv",
+	"glMultiTexCoord1i",
+	"glMultiTexCoord1iv",
+	"glMultiTexCoord1s",
+	"glMultiTexCoord1sv",
+	"glMultiTexCoord2d",
+	"glMultiTexCoord2dv",
+	"glMultiTexCoord2f",
+	"glMultiTexCoord2fv",
+	"glMultiTexCoord2i",
+	"glMultiTexCoord2iv",
+	"glMultiTexCoord2s",
+	"glMultiTexCoord2sv",
+	"glMultiTexCoord3d",
+	"glMultiTexCoord3dv",
+	"glMultiTexCoord3f",
+	"glMultiTexCoord3fv",
+	"glMultiTexCoord3i",
+	"glMultiTexCoord3iv",
+	"glMultiTexCoord3s",
+	"glMultiTexCoord3sv",
+	"glMultiTexCoord4d",
+	"glMultiTexCoord4dv",
+	"glMultiTexCoord4f",
+	"glMultiTexCoord4fv",
+	"glMultiTexCoord4i",
+	"glMultiTexCoord4iv",
+	"glMultiTexCoord4s",
+	"glMultiTexCoord4sv",
+	"glLoadTransposeMatrixf",
+	"glLoadTransposeMatrixd",
+	"glMultTransposeMatrixf",
+	"glMultTransposeMatrixd",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glFogCoordf",
+	"glFogCoordfv",
+	"glFogCoordd",
+	"glFogCoorddv",
+	"glFogCoordPointer",
+	"glSecondaryColor3b",
+	"glSecondaryColor3bv",
+	"glSecondaryColor3d",
+	"glSecondaryColor3dv",
+	"glSecondaryColor3f",
+	"glSecondaryColor3fv",
+	"glSecondaryColor3i",
+	"glSecondaryColor3iv",
+	"glSecondaryColor3s",
+	"glSecondaryColor3sv",
+	"glSecondaryColor3ub",
+	"glSecondaryColor3ubv",
+	"glSecondaryColor3ui",
+	"glSecondaryColor3uiv",
+	"glSecondaryColor3us",
+	"glSecondaryColor3usv",
+	"glSecondaryColorPointer",
+	"glWindowPos2d",
+	"glWindowPos2dv",
+	"glWindowPos2f",
+	"glWindowPos2fv",
+	"glWindowPos2i",
+	"glWindowPos2iv",
+	"glWindowPos2s",
+	"glWindowPos2sv",
+	"glWindowPos3d",
+	"glWindowPos3dv",
+	"glWindowPos3f",
+	"glWindowPos3fv",
+	"glWindowPos3i",
+	"glWindowPos3iv",
+	"glWindowPos3s",
+	"glWindowPos3sv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glBufferStorage",
+	"glDrawArraysIndirect",
+	"glDrawElementsIndirect",
+	"glGetProgramBinary",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawElementsIndirect",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDebugMessageCallback",
+	"glGetDebugMessageLog",
+	"glPushDebugGroup",
+	"glPopDebugGroup",
+	"glObjectLabel",
+	"glGetObjectLabel",
+	"glObjectPtrLabel",
+	"glGetObjectPtrLabel",
+};
+static PFNGLCULLFACEPROC glad_trace_next_glCullFace = NULL;
+static void APIENTRY glad_trace_glCullFace(GLenum mode) {
+	glad_trace_pre(0); glad_trace_next_glCullFace(mode); glad_trace_post(0);
+}
+static PFNGLFRONTFACEPROC glad_trace_next_glFrontFace = NULL;
+static void APIENTRY glad_trace_glFrontFace(GLenum mode) {
+	glad_trace_pre(1); glad_trace_next_glFrontFace(mode); glad_trace_post(1);
+}
+static PFNGLHINTPROC glad_trace_next_glHint = NULL;
+static void APIENTRY glad_trace_glHint(GLenum target, GLenum mode) {
+	glad_trace_pre(2); glad_trace_next_glHint(target, mode); glad_trace_post(2);
+}
+static PFNGLLINEWIDTHPROC glad_trace_next_glLineWidth = NULL;
+static void APIENTRY glad_trace_glLineWidth(GLfloat width) {
+	glad_trace_pre(3); glad_trace_next_glLineWidth(width); glad_trace_post(3);
+}
+static PFNGLPOINTSIZEPROC glad_trace_next_glPointSize = NULL;
+static void APIENTRY glad_trace_glPointSize(GLfloat size) {
+	glad_trace_pre(4); glad_trace_next_glPointSize(size); glad_trace_post(4);
+}
+static PFNGLPOLYGONMODEPROC glad_trace_next_glPolygonMode = NULL;
+static void APIENTRY glad_trace_glPolygonMode(GLenum face, GLenum mode) {
+	glad_trace_pre(5); glad_trace_next_glPolygonMode(face, mode); glad_trace_post(5);
+}
+static PFNGLSCISSORPROC glad_trace_next_glScissor = NULL;
+static void APIENTRY glad_trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_pre(6); glad_trace_next_glScissor(x, y, width, height); glad_trace_post(6);
+}
+static PFNGLTEXPARAMETERFPROC glad_trace_next_glTexParameterf = NULL;
+static void APIENTRY glad_trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_trace_pre(7); glad_trace_next_glTexParameterf(target, pname, param); glad_trace_post(7);
+}
+static PFNGLTEXPARAMETERFVPROC glad_trace_next_glTexParameterfv = NULL;
+static void APIENTRY glad_trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_trace_pre(8); glad_trace_next_glTexParameterfv(target, pname, params); glad_trace_post(8);
+}
+static PFNGLTEXPARAMETERIPROC glad_trace_next_glTexParameteri = NULL;
+static void APIENTRY glad_trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_trace_pre(9); glad_trace_next_glTexParameteri(target, pname, param); glad_trace_post(9);
+}
+static PFNGLTEXPARAMETERIVPROC glad_trace_next_glTexParameteriv = NULL;
+static void APIENTRY glad_trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_trace_pre(10); glad_trace_next_glTexParameteriv(target, pname, params); glad_trace_post(10);
+}
+static PFNGLTEXIMAGE1DPROC glad_trace_next_glTexImage1D = NULL;
+static void APIENTRY glad_trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_pre(11); glad_trace_next_glTexImage1D(target, level, internalformat, width, border, format, type, pixels); glad_trace_post(11);
+}
+static PFNGLTEXIMAGE2DPROC glad_trace_next_glTexImage2D = NULL;
+static void APIENTRY glad_trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_pre(12); glad_trace_next_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); glad_trace_post(12);
+}
+static PFNGLDRAWBUFFERPROC glad_trace_next_glDrawBuffer = NULL;
+static void APIENTRY glad_trace_glDrawBuffer(GLenum buf) {
+	glad_trace_pre(13); glad_trace_next_glDrawBuffer(buf); glad_trace_post(13);
+}
+static PFNGLCLEARPROC glad_trace_next_glClear = NULL;
+static void APIENTRY glad_trace_glClear(GLbitfield mask) {
+	glad_trace_pre(14); glad_trace_next_glClear(mask); glad_trace_post(14);
+}
+static PFNGLCLEARCOLORPROC glad_trace_next_glClearColor = NULL;
+static void APIENTRY glad_trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_trace_pre(15); glad_trace_next_glClearColor(red, green, blue, alpha); glad_trace_post(15);
+}
+static PFNGLCLEARSTENCILPROC glad_trace_next_glClearStencil = NULL;
+static void APIENTRY glad_trace_glClearStencil(GLint s) {
+	glad_trace_pre(16); glad_trace_next_glClearStencil(s); glad_trace_post(16);
+}
+static PFNGLCLEARDEPTHPROC glad_trace_next_glClearDepth = NULL;
+static void APIENTRY glad_trace_glClearDepth(GLdouble depth) {
+	glad_trace_pre(17); glad_trace_next_glClearDepth(depth); glad_trace_post(17);
+}
+static PFNGLSTENCILMASKPROC glad_trace_next_glStencilMask = NULL;
+static void APIENTRY glad_trace_glStencilMask(GLuint mask) {
+	glad_trace_pre(18); glad_trace_next_glStencilMask(mask); glad_trace_post(18);
+}
+static PFNGLCOLORMASKPROC glad_trace_next_glColorMask = NULL;
+static void APIENTRY glad_trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_trace_pre(19); glad_trace_next_glColorMask(red, green, blue, alpha); glad_trace_post(19);
+}
+static PFNGLDEPTHMASKPROC glad_trace_next_glDepthMask = NULL;
+static void APIENTRY glad_trace_glDepthMask(GLboolean flag) {
+	glad_trace_pre(20); glad_trace_next_glDepthMask(flag); glad_trace_post(20);
+}
+static PFNGLDISABLEPROC glad_trace_next_glDisable = NULL;
+static void APIENTRY glad_trace_glDisable(GLenum cap) {
+	glad_trace_pre(21); glad_trace_next_glDisable(cap); glad_trace_post(21);
+}
+static PFNGLENABLEPROC glad_trace_next_glEnable = NULL;
+static void APIENTRY glad_trace_glEnable(GLenum cap) {
+	glad_trace_pre(22); glad_trace_next_glEnable(cap); glad_trace_post(22);
+}
+static PFNGLFINISHPROC glad_trace_next_glFinish = NULL;
+static void APIENTRY glad_trace_glFinish(void) {
+	glad_trace_pre(23); glad_trace_next_glFinish(); glad_trace_post(23);
+}
+static PFNGLFLUSHPROC glad_trace_next_glFlush = NULL;
+static void APIENTRY glad_trace_glFlush(void) {
+	glad_trace_pre(24); glad_trace_next_glFlush(); glad_trace_post(24);
+}
+static PFNGLBLENDFUNCPROC glad_trace_next_glBlendFunc = NULL;
+static void APIENTRY glad_trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_trace_pre(25); glad_trace_next_glBlendFunc(sfactor, dfactor); glad_trace_post(25);
+}
+static PFNGLLOGICOPPROC glad_trace_next_glLogicOp = NULL;
+static void APIENTRY glad_trace_glLogicOp(GLenum opcode) {
+	glad_trace_pre(26); glad_trace_next_glLogicOp(opcode); glad_trace_post(26);
+}
+static PFNGLSTENCILFUNCPROC glad_trace_next_glStencilFunc = NULL;
+static void APIENTRY glad_trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_trace_pre(27); glad_trace_next_glStencilFunc(func, ref, mask); glad_trace_post(27);
+}
+static PFNGLSTENCILOPPROC glad_trace_next_glStencilOp = NULL;
+static void APIENTRY glad_trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_trace_pre(28); glad_trace_next_glStencilOp(fail, zfail, zpass); glad_trace_post(28);
+}
+static PFNGLDEPTHFUNCPROC glad_trace_next_glDepthFunc = NULL;
+static void APIENTRY glad_trace_glDepthFunc(GLenum func) {
+	glad_trace_pre(29); glad_trace_next_glDepthFunc(func); glad_trace_post(29);
+}
+static PFNGLPIXELSTOREFPROC glad_trace_next_glPixelStoref = NULL;
+static void APIENTRY glad_trace_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_trace_pre(30); glad_trace_next_glPixelStoref(pname, param); glad_trace_post(30);
+}
+static PFNGLPIXELSTOREIPROC glad_trace_next_glPixelStorei = NULL;
+static void APIENTRY glad_trace_glPixelStorei(GLenum pname, GLint param) {
+	glad_trace_pre(31); glad_trace_next_glPixelStorei(pname, param); glad_trace_post(31);
+}
+static PFNGLREADBUFFERPROC glad_trace_next_glReadBuffer = NULL;
+static void APIENTRY glad_trace_glReadBuffer(GLenum src) {
+	glad_trace_pre(32); glad_trace_next_glReadBuffer(src); glad_trace_post(32);
+}
+static PFNGLREADPIXELSPROC glad_trace_next_glReadPixels = NULL;
+static void APIENTRY glad_trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_trace_pre(33); glad_trace_next_glReadPixels(x, y, width, height, format, type, pixels); glad_trace_post(33);
+}
+static PFNGLGETBOOLEANVPROC glad_trace_next_glGetBooleanv = NULL;
+static void APIENTRY glad_trace_glGetBooleanv(GLenum pname, GLboolean *data) {
+	glad_trace_pre(34); glad_trace_next_glGetBooleanv(pname, data); glad_trace_post(34);
+}
+static PFNGLGETDOUBLEVPROC glad_trace_next_glGetDoublev = NULL;
+static void APIENTRY glad_trace_glGetDoublev(GLenum pname, GLdouble *data) {
+	glad_trace_pre(35); glad_trace_next_glGetDoublev(pname, data); glad_trace_post(35);
+}
+static PFNGLGETERRORPROC glad_trace_next_glGetError = NULL;
+static GLenum APIENTRY glad_trace_glGetError(void) {
+	GLenum result; glad_trace_pre(36); result = glad_trace_next_glGetError(); glad_trace_post(36); return result;
+}
+static PFNGLGETFLOATVPROC glad_trace_next_glGetFloatv = NULL;
+static void APIENTRY glad_trace_glGetFloatv(GLenum pname, GLfloat *data) {
+	glad_trace_pre(37); glad_trace_next_glGetFloatv(pname, data); glad_trace_post(37);
+}
+static PFNGLGETINTEGERVPROC glad_trace_next_glGetIntegerv = NULL;
+static void APIENTRY glad_trace_glGetIntegerv(GLenum pname, GLint *data) {
+	glad_trace_pre(38); glad_trace_next_glGetIntegerv(pname, data); glad_trace_post(38);
+}
+static PFNGLGETSTRINGPROC glad_trace_next_glGetString = NULL;
+static const GLubyte * APIENTRY glad_trace_glGetString(GLenum name) {
+	const GLubyte * result; glad_trace_pre(39); result = glad_trace_next_glGetString(name); glad_trace_post(39); return result;
+}
+static PFNGLGETTEXIMAGEPROC glad_trace_next_glGetTexImage = NULL;
+static void APIENTRY glad_trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_trace_pre(40); glad_trace_next_glGetTexImage(target, level, format, type, pixels); glad_trace_post(40);
+}
+static PFNGLGETTEXPARAMETERFVPROC glad_trace_next_glGetTexParameterfv = NULL;
+static void APIENTRY glad_trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_trace_pre(41); glad_trace_next_glGetTexParameterfv(target, pname, params); glad_trace_post(41);
+}
+static PFNGLGETTEXPARAMETERIVPROC glad_trace_next_glGetTexParameteriv = NULL;
+static void APIENTRY glad_trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_trace_pre(42); glad_trace_next_glGetTexParameteriv(target, pname, params); glad_trace_post(42);
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_trace_next_glGetTexLevelParameterfv = NULL;
+static void APIENTRY glad_trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_trace_pre(43); glad_trace_next_glGetTexLevelParameterfv(target, level, pname, params); glad_trace_post(43);
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_trace_next_glGetTexLevelParameteriv = NULL;
+static void APIENTRY glad_trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_trace_pre(44); glad_trace_next_glGetTexLevelParameteriv(target, level, pname, params); glad_trace_post(44);
+}
+static PFNGLISENABLEDPROC glad_trace_next_glIsEnabled = NULL;
+static GLboolean APIENTRY glad_trace_glIsEnabled(GLenum cap) {
+	GLboolean result; glad_trace_pre(45); result = glad_trace_next_glIsEnabled(cap); glad_trace_post(45); return result;
+}
+static PFNGLDEPTHRANGEPROC glad_trace_next_glDepthRange = NULL;
+static void APIENTRY glad_trace_glDepthRange(GLdouble n, GLdouble f) {
+	glad_trace_pre(46); glad_trace_next_glDepthRange(n, f); glad_trace_post(46);
+}
+static PFNGLVIEWPORTPROC glad_trace_next_glViewport = NULL;
+static void APIENTRY glad_trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_pre(47); glad_trace_next_glViewport(x, y, width, height); glad_trace_post(47);
+}
+static PFNGLNEWLISTPROC glad_trace_next_glNewList = NULL;
+static void APIENTRY glad_trace_glNewList(GLuint list, GLenum mode) {
+	glad_trace_pre(48); glad_trace_next_glNewList(list, mode); glad_trace_post(48);
+}
+static PFNGLENDLISTPROC glad_trace_next_glEndList = NULL;
+static void APIENTRY glad_trace_glEndList(void) {
+	glad_trace_pre(49); glad_trace_next_glEndList(); glad_trace_post(49);
+}
+static PFNGLCALLLISTPROC glad_trace_next_glCallList = NULL;
+static void APIENTRY glad_trace_glCallList(GLuint list) {
+	glad_trace_pre(50); glad_trace_next_glCallList(list); glad_trace_post(50);
+}
+static PFNGLCALLLISTSPROC glad_trace_next_glCallLists = NULL;
+static void APIENTRY glad_trace_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	glad_trace_pre(51); glad_trace_next_glCallLists(n, type, lists); glad_trace_post(51);
+}
+static PFNGLDELETELISTSPROC glad_trace_next_glDeleteLists = NULL;
+static void APIENTRY glad_trace_glDeleteLists(GLuint list, GLsizei range) {
+	glad_trace_pre(52); glad_trace_next_glDeleteLists(list, range); glad_trace_post(52);
+}
+static PFNGLGENLISTSPROC glad_trace_next_glGenLists = NULL;
+static GLuint APIENTRY glad_trace_glGenLists(GLsizei range) {
+	GLuint result; glad_trace_pre(53); result = glad_trace_next_glGenLists(range); glad_trace_post(53); return result;
+}
+static PFNGLLISTBASEPROC glad_trace_next_glListBase = NULL;
+static void APIENTRY glad_trace_glListBase(GLuint base) {
+	glad_trace_pre(54); glad_trace_next_glListBase(base); glad_trace_post(54);
+}
+static PFNGLBEGINPROC glad_trace_next_glBegin = NULL;
+static void APIENTRY glad_trace_glBegin(GLenum mode) {
+	glad_trace_pre(55); glad_trace_next_glBegin(mode); glad_trace_post(55);
+}
+static PFNGLBITMAPPROC glad_trace_next_glBitmap = NULL;
+static void APIENTRY glad_trace_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	glad_trace_pre(56); glad_trace_next_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap); glad_trace_post(56);
+}
+static PFNGLCOLOR3BPROC glad_trace_next_glColor3b = NULL;
+static void APIENTRY glad_trace_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_trace_pre(57); glad_trace_next_glColor3b(red, green, blue); glad_trace_post(57);
+}
+static PFNGLCOLOR3BVPROC glad_trace_next_glColor3bv = NULL;
+static void APIENTRY glad_trace_glColor3bv(const GLbyte *v) {
+	glad_trace_pre(58); glad_trace_next_glColor3bv(v); glad_trace_post(58);
+}
+static PFNGLCOLOR3DPROC glad_trace_next_glColor3d = NULL;
+static void APIENTRY glad_trace_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_trace_pre(59); glad_trace_next_glColor3d(red, green, blue); glad_trace_post(59);
+}
+static PFNGLCOLOR3DVPROC glad_trace_next_glColor3dv = NULL;
+static void APIENTRY glad_trace_glColor3dv(const GLdouble *v) {
+	glad_trace_pre(60); glad_trace_next_glColor3dv(v); glad_trace_post(60);
+}
+static PFNGLCOLOR3FPROC glad_trace_next_glColor3f = NULL;
+static void APIENTRY glad_trace_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_trace_pre(61); glad_trace_next_glColor3f(red, green, blue); glad_trace_post(61);
+}
+static PFNGLCOLOR3FVPROC glad_trace_next_glColor3fv = NULL;
+static void APIENTRY glad_trace_glColor3fv(const GLfloat *v) {
+	glad_trace_pre(62); glad_trace_next_glColor3fv(v); glad_trace_post(62);
+}
+static PFNGLCOLOR3IPROC glad_trace_next_glColor3i = NULL;
+static void APIENTRY glad_trace_glColor3i(GLint red, GLint green, GLint blue) {
+	glad_trace_pre(63); glad_trace_next_glColor3i(red, green, blue); glad_trace_post(63);
+}
+static PFNGLCOLOR3IVPROC glad_trace_next_glColor3iv = NULL;
+static void APIENTRY glad_trace_glColor3iv(const GLint *v) {
+	glad_trace_pre(64); glad_trace_next_glColor3iv(v); glad_trace_post(64);
+}
+static PFNGLCOLOR3SPROC glad_trace_next_glColor3s = NULL;
+static void APIENTRY glad_trace_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_trace_pre(65); glad_trace_next_glColor3s(red, green, blue); glad_trace_post(65);
+}
+static PFNGLCOLOR3SVPROC glad_trace_next_glColor3sv = NULL;
+static void APIENTRY glad_trace_glColor3sv(const GLshort *v) {
+	glad_trace_pre(66); glad_trace_next_glColor3sv(v); glad_trace_post(66);
+}
+static PFNGLCOLOR3UBPROC glad_trace_next_glColor3ub = NULL;
+static void APIENTRY glad_trace_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_trace_pre(67); glad_trace_next_glColor3ub(red, green, blue); glad_trace_post(67);
+}
+static PFNGLCOLOR3UBVPROC glad_trace_next_glColor3ubv = NULL;
+static void APIENTRY glad_trace_glColor3ubv(const GLubyte *v) {
+	glad_trace_pre(68); glad_trace_next_glColor3ubv(v); glad_trace_post(68);
+}
+static PFNGLCOLOR3UIPROC glad_trace_next_glColor3ui = NULL;
+static void APIENTRY glad_trace_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_trace_pre(69); glad_trace_next_glColor3ui(red, green, blue); glad_trace_post(69);
+}
+static PFNGLCOLOR3UIVPROC glad_trace_next_glColor3uiv = NULL;
+static void APIENTRY glad_trace_glColor3uiv(const GLuint *v) {
+	glad_trace_pre(70); glad_trace_next_glColor3uiv(v); glad_trace_post(70);
+}
+static PFNGLCOLOR3USPROC glad_trace_next_glColor3us = NULL;
+static void APIENTRY glad_trace_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_trace_pre(71); glad_trace_next_glColor3us(red, green, blue); glad_trace_post(71);
+}
+static PFNGLCOLOR3USVPROC glad_trace_next_glColor3usv = NULL;
+static void APIENTRY glad_trace_glColor3usv(const GLushort *v) {
+	glad_trace_pre(72); glad_trace_next_glColor3usv(v); glad_trace_post(72);
+}
+static PFNGLCOLOR4BPROC glad_trace_next_glColor4b = NULL;
+static void APIENTRY glad_trace_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	glad_trace_pre(73); glad_trace_next_glColor4b(red, green, blue, alpha); glad_trace_post(73);
+}
+static PFNGLCOLOR4BVPROC glad_trace_next_glColor4bv = NULL;
+static void APIENTRY glad_trace_glColor4bv(const GLbyte *v) {
+	glad_trace_pre(74); glad_trace_next_glColor4bv(v); glad_trace_post(74);
+}
+static PFNGLCOLOR4DPROC glad_trace_next_glColor4d = NULL;
+static void APIENTRY glad_trace_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	glad_trace_pre(75); glad_trace_next_glColor4d(red, green, blue, alpha); glad_trace_post(75);
+}
+static PFNGLCOLOR4DVPROC glad_trace_next_glColor4dv = NULL;
+static void APIENTRY glad_trace_glColor4dv(const GLdouble *v) {
+	glad_trace_pre(76); glad_trace_next_glColor4dv(v); glad_trace_post(76);
+}
+static PFNGLCOLOR4FPROC glad_trace_next_glColor4f = NULL;
+static void APIENTRY glad_trace_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_trace_pre(77); glad_trace_next_glColor4f(red, green, blue, alpha); glad_trace_post(77);
+}
+static PFNGLCOLOR4FVPROC glad_trace_next_glColor4fv = NULL;
+static void APIENTRY glad_trace_glColor4fv(const GLfloat *v) {
+	glad_trace_pre(78); glad_trace_next_glColor4fv(v); glad_trace_post(78);
+}
+static PFNGLCOLOR4IPROC glad_trace_next_glColor4i = NULL;
+static void APIENTRY glad_trace_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	glad_trace_pre(79); glad_trace_next_glColor4i(red, green, blue, alpha); glad_trace_post(79);
+}
+static PFNGLCOLOR4IVPROC glad_trace_next_glColor4iv = NULL;
+static void APIENTRY glad_trace_glColor4iv(const GLint *v) {
+	glad_trace_pre(80); glad_trace_next_glColor4iv(v); glad_trace_post(80);
+}
+static PFNGLCOLOR4SPROC glad_trace_next_glColor4s = NULL;
+static void APIENTRY glad_trace_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	glad_trace_pre(81); glad_trace_next_glColor4s(red, green, blue, alpha); glad_trace_post(81);
+}
+static PFNGLCOLOR4SVPROC glad_trace_next_glColor4sv = NULL;
+static void APIENTRY glad_trace_glColor4sv(const GLshort *v) {
+	glad_trace_pre(82); glad_trace_next_glColor4sv(v); glad_trace_post(82);
+}
+static PFNGLCOLOR4UBPROC glad_trace_next_glColor4ub = NULL;
+static void APIENTRY glad_trace_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	glad_trace_pre(83); glad_trace_next_glColor4ub(red, green, blue, alpha); glad_trace_post(83);
+}
+static PFNGLCOLOR4UBVPROC glad_trace_next_glColor4ubv = NULL;
+static void APIENTRY glad_trace_glColor4ubv(const GLubyte *v) {
+	glad_trace_pre(84); glad_trace_next_glColor4ubv(v); glad_trace_post(84);
+}
+static PFNGLCOLOR4UIPROC glad_trace_next_glColor4ui = NULL;
+static void APIENTRY glad_trace_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	glad_trace_pre(85); glad_trace_next_glColor4ui(red, green, blue, alpha); glad_trace_post(85);
+}
+static PFNGLCOLOR4UIVPROC glad_trace_next_glColor4uiv = NULL;
+static void APIENTRY glad_trace_glColor4uiv(const GLuint *v) {
+	glad_trace_pre(86); glad_trace_next_glColor4uiv(v); glad_trace_post(86);
+}
+static PFNGLCOLOR4USPROC glad_trace_next_glColor4us = NULL;
+static void APIENTRY glad_trace_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	glad_trace_pre(87); glad_trace_next_glColor4us(red, green, blue, alpha); glad_trace_post(87);
+}
+static PFNGLCOLOR4USVPROC glad_trace_next_glColor4usv = NULL;
+static void APIENTRY glad_trace_glColor4usv(const GLushort *v) {
+	glad_trace_pre(88); glad_trace_next_glColor4usv(v); glad_trace_post(88);
+}
+static PFNGLEDGEFLAGPROC glad_trace_next_glEdgeFlag = NULL;
+static void APIENTRY glad_trace_glEdgeFlag(GLboolean flag) {
+	glad_trace_pre(89); glad_trace_next_glEdgeFlag(flag); glad_trace_post(89);
+}
+static PFNGLEDGEFLAGVPROC glad_trace_next_glEdgeFlagv = NULL;
+static void APIENTRY glad_trace_glEdgeFlagv(const GLboolean *flag) {
+	glad_trace_pre(90); glad_trace_next_glEdgeFlagv(flag); glad_trace_post(90);
+}
+static PFNGLENDPROC glad_trace_next_glEnd = NULL;
+static void APIENTRY glad_trace_glEnd(void) {
+	glad_trace_pre(91); glad_trace_next_glEnd(); glad_trace_post(91);
+}
+static PFNGLINDEXDPROC glad_trace_next_glIndexd = NULL;
+static void APIENTRY glad_trace_glIndexd(GLdouble c) {
+	glad_trace_pre(92); glad_trace_next_glIndexd(c); glad_trace_post(92);
+}
+static PFNGLINDEXDVPROC glad_trace_next_glIndexdv = NULL;
+static void APIENTRY glad_trace_glIndexdv(const GLdouble *c) {
+	glad_trace_pre(93); glad_trace_next_glIndexdv(c); glad_trace_post(93);
+}
+static PFNGLINDEXFPROC glad_trace_next_glIndexf = NULL;
+static void APIENTRY glad_trace_glIndexf(GLfloat c) {
+	glad_trace_pre(94); glad_trace_next_glIndexf(c); glad_trace_post(94);
+}
+static PFNGLINDEXFVPROC glad_trace_next_glIndexfv = NULL;
+static void APIENTRY glad_trace_glIndexfv(const GLfloat *c) {
+	glad_trace_pre(95); glad_trace_next_glIndexfv(c); glad_trace_post(95);
+}
+static PFNGLINDEXIPROC glad_trace_next_glIndexi = NULL;
+static void APIENTRY glad_trace_glIndexi(GLint c) {
+	glad_trace_pre(96); glad_trace_next_glIndexi(c); glad_trace_post(96);
+}
+static PFNGLINDEXIVPROC glad_trace_next_glIndexiv = NULL;
+static void APIENTRY glad_trace_glIndexiv(const GLint *c) {
+	glad_trace_pre(97); glad_trace_next_glIndexiv(c); glad_trace_post(97);
+}
+static PFNGLINDEXSPROC glad_trace_next_glIndexs = NULL;
+static void APIENTRY glad_trace_glIndexs(GLshort c) {
+	glad_trace_pre(98); glad_trace_next_glIndexs(c); glad_trace_post(98);
+}
+static PFNGLINDEXSVPROC glad_trace_next_glIndexsv = NULL;
+static void APIENTRY glad_trace_glIndexsv(const GLshort *c) {
+	glad_trace_pre(99); glad_trace_next_glIndexsv(c); glad_trace_post(99);
+}
+static PFNGLNORMAL3BPROC glad_trace_next_glNormal3b = NULL;
+static void APIENTRY glad_trace_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	glad_trace_pre(100); glad_trace_next_glNormal3b(nx, ny, nz); glad_trace_post(100);
+}
+static PFNGLNORMAL3BVPROC glad_trace_next_glNormal3bv = NULL;
+static void APIENTRY glad_trace_glNormal3bv(const GLbyte *v) {
+	glad_trace_pre(101); glad_trace_next_glNormal3bv(v); glad_trace_post(101);
+}
+static PFNGLNORMAL3DPROC glad_trace_next_glNormal3d = NULL;
+static void APIENTRY glad_trace_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	glad_trace_pre(102); glad_trace_next_glNormal3d(nx, ny, nz); glad_trace_post(102);
+}
+static PFNGLNORMAL3DVPROC glad_trace_next_glNormal3dv = NULL;
+static void APIENTRY glad_trace_glNormal3dv(const GLdouble *v) {
+	glad_trace_pre(103); glad_trace_next_glNormal3dv(v); glad_trace_post(103);
+}
+static PFNGLNORMAL3FPROC glad_trace_next_glNormal3f = NULL;
+static void APIENTRY glad_trace_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	glad_trace_pre(104); glad_trace_next_glNormal3f(nx, ny, nz); glad_trace_post(104);
+}
+static PFNGLNORMAL3FVPROC glad_trace_next_glNormal3fv = NULL;
+static void APIENTRY glad_trace_glNormal3fv(const GLfloat *v) {
+	glad_trace_pre(105); glad_trace_next_glNormal3fv(v); glad_trace_post(105);
+}
+static PFNGLNORMAL3IPROC glad_trace_next_glNormal3i = NULL;
+static void APIENTRY glad_trace_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	glad_trace_pre(106); glad_trace_next_glNormal3i(nx, ny, nz); glad_trace_post(106);
+}
+static PFNGLNORMAL3IVPROC glad_trace_next_glNormal3iv = NULL;
+static void APIENTRY glad_trace_glNormal3iv(const GLint *v) {
+	glad_trace_pre(107); glad_trace_next_glNormal3iv(v); glad_trace_post(107);
+}
+static PFNGLNORMAL3SPROC glad_trace_next_glNormal3s = NULL;
+static void APIENTRY glad_trace_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	glad_trace_pre(108); glad_trace_next_glNormal3s(nx, ny, nz); glad_trace_post(108);
+}
+static PFNGLNORMAL3SVPROC glad_trace_next_glNormal3sv = NULL;
+static void APIENTRY glad_trace_glNormal3sv(const GLshort *v) {
+	glad_trace_pre(109); glad_trace_next_glNormal3sv(v); glad_trace_post(109);
+}
+static PFNGLRASTERPOS2DPROC glad_trace_next_glRasterPos2d = NULL;
+static void APIENTRY glad_trace_glRasterPos2d(GLdouble x, GLdouble y) {
+	glad_trace_pre(110); glad_trace_next_glRasterPos2d(x, y); glad_trace_post(110);
+}
+static PFNGLRASTERPOS2DVPROC glad_trace_next_glRasterPos2dv = NULL;
+static void APIENTRY glad_trace_glRasterPos2dv(const GLdouble *v) {
+	glad_trace_pre(111); glad_trace_next_glRasterPos2dv(v); glad_trace_post(111);
+}
+static PFNGLRASTERPOS2FPROC glad_trace_next_glRasterPos2f = NULL;
+static void APIENTRY glad_trace_glRasterPos2f(GLfloat x, GLfloat y) {
+	glad_trace_pre(112); glad_trace_next_glRasterPos2f(x, y); glad_trace_post(112);
+}
+static PFNGLRASTERPOS2FVPROC glad_trace_next_glRasterPos2fv = NULL;
+static void APIENTRY glad_trace_glRasterPos2fv(const GLfloat *v) {
+	glad_trace_pre(113); glad_trace_next_glRasterPos2fv(v); glad_trace_post(113);
+}
+static PFNGLRASTERPOS2IPROC glad_trace_next_glRasterPos2i = NULL;
+static void APIENTRY glad_trace_glRasterPos2i(GLint x, GLint y) {
+	glad_trace_pre(114); glad_trace_next_glRasterPos2i(x, y); glad_trace_post(114);
+}
+static PFNGLRASTERPOS2IVPROC glad_trace_next_glRasterPos2iv = NULL;
+static void APIENTRY glad_trace_glRasterPos2iv(const GLint *v) {
+	glad_trace_pre(115); glad_trace_next_glRasterPos2iv(v); glad_trace_post(115);
+}
+static PFNGLRASTERPOS2SPROC glad_trace_next_glRasterPos2s = NULL;
+static void APIENTRY glad_trace_glRasterPos2s(GLshort x, GLshort y) {
+	glad_trace_pre(116); glad_trace_next_glRasterPos2s(x, y); glad_trace_post(116);
+}
+static PFNGLRASTERPOS2SVPROC glad_trace_next_glRasterPos2sv = NULL;
+static void APIENTRY glad_trace_glRasterPos2sv(const GLshort *v) {
+	glad_trace_pre(117); glad_trace_next_glRasterPos2sv(v); glad_trace_post(117);
+}
+static PFNGLRASTERPOS3DPROC glad_trace_next_glRasterPos3d = NULL;
+static void APIENTRY glad_trace_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_pre(118); glad_trace_next_glRasterPos3d(x, y, z); glad_trace_post(118);
+}
+static PFNGLRASTERPOS3DVPROC glad_trace_next_glRasterPos3dv = NULL;
+static void APIENTRY glad_trace_glRasterPos3dv(const GLdouble *v) {
+	glad_trace_pre(119); glad_trace_next_glRasterPos3dv(v); glad_trace_post(119);
+}
+static PFNGLRASTERPOS3FPROC glad_trace_next_glRasterPos3f = NULL;
+static void APIENTRY glad_trace_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_pre(120); glad_trace_next_glRasterPos3f(x, y, z); glad_trace_post(120);
+}
+static PFNGLRASTERPOS3FVPROC glad_trace_next_glRasterPos3fv = NULL;
+static void APIENTRY glad_trace_glRasterPos3fv(const GLfloat *v) {
+	glad_trace_pre(121); glad_trace_next_glRasterPos3fv(v); glad_trace_post(121);
+}
+static PFNGLRASTERPOS3IPROC glad_trace_next_glRasterPos3i = NULL;
+static void APIENTRY glad_trace_glRasterPos3i(GLint x, GLint y, GLint z) {
+	glad_trace_pre(122); glad_trace_next_glRasterPos3i(x, y, z); glad_trace_post(122);
+}
+static PFNGLRASTERPOS3IVPROC glad_trace_next_glRasterPos3iv = NULL;
+static void APIENTRY glad_trace_glRasterPos3iv(const GLint *v) {
+	glad_trace_pre(123); glad_trace_next_glRasterPos3iv(v); glad_trace_post(123);
+}
+static PFNGLRASTERPOS3SPROC glad_trace_next_glRasterPos3s = NULL;
+static void APIENTRY glad_trace_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_trace_pre(124); glad_trace_next_glRasterPos3s(x, y, z); glad_trace_post(124);
+}
+static PFNGLRASTERPOS3SVPROC glad_trace_next_glRasterPos3sv = NULL;
+static void APIENTRY glad_trace_glRasterPos3sv(const GLshort *v) {
+	glad_trace_pre(125); glad_trace_next_glRasterPos3sv(v); glad_trace_post(125);
+}
+static PFNGLRASTERPOS4DPROC glad_trace_next_glRasterPos4d = NULL;
+static void APIENTRY glad_trace_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_trace_pre(126); glad_trace_next_glRasterPos4d(x, y, z, w); glad_trace_post(126);
+}
+static PFNGLRASTERPOS4DVPROC glad_trace_next_glRasterPos4dv = NULL;
+static void APIENTRY glad_trace_glRasterPos4dv(const GLdouble *v) {
+	glad_trace_pre(127); glad_trace_next_glRasterPos4dv(v); glad_trace_post(127);
+}
+static PFNGLRASTERPOS4FPROC glad_trace_next_glRasterPos4f = NULL;
+static void APIENTRY glad_trace_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_trace_pre(128); glad_trace_next_glRasterPos4f(x, y, z, w); glad_trace_post(128);
+}
+static PFNGLRASTERPOS4FVPROC glad_trace_next_glRasterPos4fv = NULL;
+static void APIENTRY glad_trace_glRasterPos4fv(const GLfloat *v) {
+	glad_trace_pre(129); glad_trace_next_glRasterPos4fv(v); glad_trace_post(129);
+}
+static PFNGLRASTERPOS4IPROC glad_trace_next_glRasterPos4i = NULL;
+static void APIENTRY glad_trace_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_trace_pre(130); glad_trace_next_glRasterPos4i(x, y, z, w); glad_trace_post(130);
+}
+static PFNGLRASTERPOS4IVPROC glad_trace_next_glRasterPos4iv = NULL;
+static void APIENTRY glad_trace_glRasterPos4iv(const GLint *v) {
+	glad_trace_pre(131); glad_trace_next_glRasterPos4iv(v); glad_trace_post(131);
+}
+static PFNGLRASTERPOS4SPROC glad_trace_next_glRasterPos4s = NULL;
+static void APIENTRY glad_trace_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_trace_pre(132); glad_trace_next_glRasterPos4s(x, y, z, w); glad_trace_post(132);
+}
+static PFNGLRASTERPOS4SVPROC glad_trace_next_glRasterPos4sv = NULL;
+static void APIENTRY glad_trace_glRasterPos4sv(const GLshort *v) {
+	glad_trace_pre(133); glad_trace_next_glRasterPos4sv(v); glad_trace_post(133);
+}
+static PFNGLRECTDPROC glad_trace_next_glRectd = NULL;
+static void APIENTRY glad_trace_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	glad_trace_pre(134); glad_trace_next_glRectd(x1, y1, x2, y2); glad_trace_post(134);
+}
+static PFNGLRECTDVPROC glad_trace_next_glRectdv = NULL;
+static void APIENTRY glad_trace_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	glad_trace_pre(135); glad_trace_next_glRectdv(v1, v2); glad_trace_post(135);
+}
+static PFNGLRECTFPROC glad_trace_next_glRectf = NULL;
+static void APIENTRY glad_trace_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	glad_trace_pre(136); glad_trace_next_glRectf(x1, y1, x2, y2); glad_trace_post(136);
+}
+static PFNGLRECTFVPROC glad_trace_next_glRectfv = NULL;
+static void APIENTRY glad_trace_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	glad_trace_pre(137); glad_trace_next_glRectfv(v1, v2); glad_trace_post(137);
+}
+static PFNGLRECTIPROC glad_trace_next_glRecti = NULL;
+static void APIENTRY glad_trace_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	glad_trace_pre(138); glad_trace_next_glRecti(x1, y1, x2, y2); glad_trace_post(138);
+}
+static PFNGLRECTIVPROC glad_trace_next_glRectiv = NULL;
+static void APIENTRY glad_trace_glRectiv(const GLint *v1, const GLint *v2) {
+	glad_trace_pre(139); glad_trace_next_glRectiv(v1, v2); glad_trace_post(139);
+}
+static PFNGLRECTSPROC glad_trace_next_glRects = NULL;
+static void APIENTRY glad_trace_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	glad_trace_pre(140); glad_trace_next_glRects(x1, y1, x2, y2); glad_trace_post(140);
+}
+static PFNGLRECTSVPROC glad_trace_next_glRectsv = NULL;
+static void APIENTRY glad_trace_glRectsv(const GLshort *v1, const GLshort *v2) {
+	glad_trace_pre(141); glad_trace_next_glRectsv(v1, v2); glad_trace_post(141);
+}
+static PFNGLTEXCOORD1DPROC glad_trace_next_glTexCoord1d = NULL;
+static void APIENTRY glad_trace_glTexCoord1d(GLdouble s) {
+	glad_trace_pre(142); glad_trace_next_glTexCoord1d(s); glad_trace_post(142);
+}
+static PFNGLTEXCOORD1DVPROC glad_trace_next_glTexCoord1dv = NULL;
+static void APIENTRY glad_trace_glTexCoord1dv(const GLdouble *v) {
+	glad_trace_pre(143); glad_trace_next_glTexCoord1dv(v); glad_trace_post(143);
+}
+static PFNGLTEXCOORD1FPROC glad_trace_next_glTexCoord1f = NULL;
+static void APIENTRY glad_trace_glTexCoord1f(GLfloat s) {
+	glad_trace_pre(144); glad_trace_next_glTexCoord1f(s); glad_trace_post(144);
+}
+static PFNGLTEXCOORD1FVPROC glad_trace_next_glTexCoord1fv = NULL;
+static void APIENTRY glad_trace_glTexCoord1fv(const GLfloat *v) {
+	glad_trace_pre(145); glad_trace_next_glTexCoord1fv(v); glad_trace_post(145);
+}
+static PFNGLTEXCOORD1IPROC glad_trace_next_glTexCoord1i = NULL;
+static void APIENTRY glad_trace_glTexCoord1i(GLint s) {
+	glad_trace_pre(146); glad_trace_next_glTexCoord1i(s); glad_trace_post(146);
+}
+static PFNGLTEXCOORD1IVPROC glad_trace_next_glTexCoord1iv = NULL;
+static void APIENTRY glad_trace_glTexCoord1iv(const GLint *v) {
+	glad_trace_pre(147); glad_trace_next_glTexCoord1iv(v); glad_trace_post(147);
+}
+static PFNGLTEXCOORD1SPROC glad_trace_next_glTexCoord1s = NULL;
+static void APIENTRY glad_trace_glTexCoord1s(GLshort s) {
+	glad_trace_pre(148); glad_trace_next_glTexCoord1s(s); glad_trace_post(148);
+}
+static PFNGLTEXCOORD1SVPROC glad_trace_next_glTexCoord1sv = NULL;
+static void APIENTRY glad_trace_glTexCoord1sv(const GLshort *v) {
+	glad_trace_pre(149); glad_trace_next_glTexCoord1sv(v); glad_trace_post(149);
+}
+static PFNGLTEXCOORD2DPROC glad_trace_next_glTexCoord2d = NULL;
+static void APIENTRY glad_trace_glTexCoord2d(GLdouble s, GLdouble t) {
+	glad_trace_pre(150); glad_trace_next_glTexCoord2d(s, t); glad_trace_post(150);
+}
+static PFNGLTEXCOORD2DVPROC glad_trace_next_glTexCoord2dv = NULL;
+static void APIENTRY glad_trace_glTexCoord2dv(const GLdouble *v) {
+	glad_trace_pre(151); glad_trace_next_glTexCoord2dv(v); glad_trace_post(151);
+}
+static PFNGLTEXCOORD2FPROC glad_trace_next_glTexCoord2f = NULL;
+static void APIENTRY glad_trace_glTexCoord2f(GLfloat s, GLfloat t) {
+	glad_trace_pre(152); glad_trace_next_glTexCoord2f(s, t); glad_trace_post(152);
+}
+static PFNGLTEXCOORD2FVPROC glad_trace_next_glTexCoord2fv = NULL;
+static void APIENTRY glad_trace_glTexCoord2fv(const GLfloat *v) {
+	glad_trace_pre(153); glad_trace_next_glTexCoord2fv(v); glad_trace_post(153);
+}
+static PFNGLTEXCOORD2IPROC glad_trace_next_glTexCoord2i = NULL;
+static void APIENTRY glad_trace_glTexCoord2i(GLint s, GLint t) {
+	glad_trace_pre(154); glad_trace_next_glTexCoord2i(s, t); glad_trace_post(154);
+}
+static PFNGLTEXCOORD2IVPROC glad_trace_next_glTexCoord2iv = NULL;
+static void APIENTRY glad_trace_glTexCoord2iv(const GLint *v) {
+	glad_trace_pre(155); glad_trace_next_glTexCoord2iv(v); glad_trace_post(155);
+}
+static PFNGLTEXCOORD2SPROC glad_trace_next_glTexCoord2s = NULL;
+static void APIENTRY glad_trace_glTexCoord2s(GLshort s, GLshort t) {
+	glad_trace_pre(156); glad_trace_next_glTexCoord2s(s, t); glad_trace_post(156);
+}
+static PFNGLTEXCOORD2SVPROC glad_trace_next_glTexCoord2sv = NULL;
+static void APIENTRY glad_trace_glTexCoord2sv(const GLshort *v) {
+	glad_trace_pre(157); glad_trace_next_glTexCoord2sv(v); glad_trace_post(157);
+}
+static PFNGLTEXCOORD3DPROC glad_trace_next_glTexCoord3d = NULL;
+static void APIENTRY glad_trace_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	glad_trace_pre(158); glad_trace_next_glTexCoord3d(s, t, r); glad_trace_post(158);
+}
+static PFNGLTEXCOORD3DVPROC glad_trace_next_glTexCoord3dv = NULL;
+static void APIENTRY glad_trace_glTexCoord3dv(const GLdouble *v) {
+	glad_trace_pre(159); glad_trace_next_glTexCoord3dv(v); glad_trace_post(159);
+}
+static PFNGLTEXCOORD3FPROC glad_trace_next_glTexCoord3f = NULL;
+static void APIENTRY glad_trace_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	glad_trace_pre(160); glad_trace_next_glTexCoord3f(s, t, r); glad_trace_post(160);
+}
+static PFNGLTEXCOORD3FVPROC glad_trace_next_glTexCoord3fv = NULL;
+static void APIENTRY glad_trace_glTexCoord3fv(const GLfloat *v) {
+	glad_trace_pre(161); glad_trace_next_glTexCoord3fv(v); glad_trace_post(161);
+}
+static PFNGLTEXCOORD3IPROC glad_trace_next_glTexCoord3i = NULL;
+static void APIENTRY glad_trace_glTexCoord3i(GLint s, GLint t, GLint r) {
+	glad_trace_pre(162); glad_trace_next_glTexCoord3i(s, t, r); glad_trace_post(162);
+}
+static PFNGLTEXCOORD3IVPROC glad_trace_next_glTexCoord3iv = NULL;
+static void APIENTRY glad_trace_glTexCoord3iv(const GLint *v) {
+	glad_trace_pre(163); glad_trace_next_glTexCoord3iv(v); glad_trace_post(163);
+}
+static PFNGLTEXCOORD3SPROC glad_trace_next_glTexCoord3s = NULL;
+static void APIENTRY glad_trace_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	glad_trace_pre(164); glad_trace_next_glTexCoord3s(s, t, r); glad_trace_post(164);
+}
+static PFNGLTEXCOORD3SVPROC glad_trace_next_glTexCoord3sv = NULL;
+static void APIENTRY glad_trace_glTexCoord3sv(const GLshort *v) {
+	glad_trace_pre(165); glad_trace_next_glTexCoord3sv(v); glad_trace_post(165);
+}
+static PFNGLTEXCOORD4DPROC glad_trace_next_glTexCoord4d = NULL;
+static void APIENTRY glad_trace_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_trace_pre(166); glad_trace_next_glTexCoord4d(s, t, r, q); glad_trace_post(166);
+}
+static PFNGLTEXCOORD4DVPROC glad_trace_next_glTexCoord4dv = NULL;
+static void APIENTRY glad_trace_glTexCoord4dv(const GLdouble *v) {
+	glad_trace_pre(167); glad_trace_next_glTexCoord4dv(v); glad_trace_post(167);
+}
+static PFNGLTEXCOORD4FPROC glad_trace_next_glTexCoord4f = NULL;
+static void APIENTRY glad_trace_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_trace_pre(168); glad_trace_next_glTexCoord4f(s, t, r, q); glad_trace_post(168);
+}
+static PFNGLTEXCOORD4FVPROC glad_trace_next_glTexCoord4fv = NULL;
+static void APIENTRY glad_trace_glTexCoord4fv(const GLfloat *v) {
+	glad_trace_pre(169); glad_trace_next_glTexCoord4fv(v); glad_trace_post(169);
+}
+static PFNGLTEXCOORD4IPROC glad_trace_next_glTexCoord4i = NULL;
+static void APIENTRY glad_trace_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	glad_trace_pre(170); glad_trace_next_glTexCoord4i(s, t, r, q); glad_trace_post(170);
+}
+static PFNGLTEXCOORD4IVPROC glad_trace_next_glTexCoord4iv = NULL;
+static void APIENTRY glad_trace_glTexCoord4iv(const GLint *v) {
+	glad_trace_pre(171); glad_trace_next_glTexCoord4iv(v); glad_trace_post(171);
+}
+static PFNGLTEXCOORD4SPROC glad_trace_next_glTexCoord4s = NULL;
+static void APIENTRY glad_trace_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_trace_pre(172); glad_trace_next_glTexCoord4s(s, t, r, q); glad_trace_post(172);
+}
+static PFNGLTEXCOORD4SVPROC glad_trace_next_glTexCoord4sv = NULL;
+static void APIENTRY glad_trace_glTexCoord4sv(const GLshort *v) {
+	glad_trace_pre(173); glad_trace_next_glTexCoord4sv(v); glad_trace_post(173);
+}
+static PFNGLVERTEX2DPROC glad_trace_next_glVertex2d = NULL;
+static void APIENTRY glad_trace_glVertex2d(GLdouble x, GLdouble y) {
+	glad_trace_pre(174); glad_trace_next_glVertex2d(x, y); glad_trace_post(174);
+}
+static PFNGLVERTEX2DVPROC glad_trace_next_glVertex2dv = NULL;
+static void APIENTRY glad_trace_glVertex2dv(const GLdouble *v) {
+	glad_trace_pre(175); glad_trace_next_glVertex2dv(v); glad_trace_post(175);
+}
+static PFNGLVERTEX2FPROC glad_trace_next_glVertex2f = NULL;
+static void APIENTRY glad_trace_glVertex2f(GLfloat x, GLfloat y) {
+	glad_trace_pre(176); glad_trace_next_glVertex2f(x, y); glad_trace_post(176);
+}
+static PFNGLVERTEX2FVPROC glad_trace_next_glVertex2fv = NULL;
+static void APIENTRY glad_trace_glVertex2fv(const GLfloat *v) {
+	glad_trace_pre(177); glad_trace_next_glVertex2fv(v); glad_trace_post(177);
+}
+static PFNGLVERTEX2IPROC glad_trace_next_glVertex2i = NULL;
+static void APIENTRY glad_trace_glVertex2i(GLint x, GLint y) {
+	glad_trace_pre(178); glad_trace_next_glVertex2i(x, y); glad_trace_post(178);
+}
+static PFNGLVERTEX2IVPROC glad_trace_next_glVertex2iv = NULL;
+static void APIENTRY glad_trace_glVertex2iv(const GLint *v) {
+	glad_trace_pre(179); glad_trace_next_glVertex2iv(v); glad_trace_post(179);
+}
+static PFNGLVERTEX2SPROC glad_trace_next_glVertex2s = NULL;
+static void APIENTRY glad_trace_glVertex2s(GLshort x, GLshort y) {
+	glad_trace_pre(180); glad_trace_next_glVertex2s(x, y); glad_trace_post(180);
+}
+static PFNGLVERTEX2SVPROC glad_trace_next_glVertex2sv = NULL;
+static void APIENTRY glad_trace_glVertex2sv(const GLshort *v) {
+	glad_trace_pre(181); glad_trace_next_glVertex2sv(v); glad_trace_post(181);
+}
+static PFNGLVERTEX3DPROC glad_trace_next_glVertex3d = NULL;
+static void APIENTRY glad_trace_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_pre(182); glad_trace_next_glVertex3d(x, y, z); glad_trace_post(182);
+}
+static PFNGLVERTEX3DVPROC glad_trace_next_glVertex3dv = NULL;
+static void APIENTRY glad_trace_glVertex3dv(const GLdouble *v) {
+	glad_trace_pre(183); glad_trace_next_glVertex3dv(v); glad_trace_post(183);
+}
+static PFNGLVERTEX3FPROC glad_trace_next_glVertex3f = NULL;
+static void APIENTRY glad_trace_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_pre(184); glad_trace_next_glVertex3f(x, y, z); glad_trace_post(184);
+}
+static PFNGLVERTEX3FVPROC glad_trace_next_glVertex3fv = NULL;
+static void APIENTRY glad_trace_glVertex3fv(const GLfloat *v) {
+	glad_trace_pre(185); glad_trace_next_glVertex3fv(v); glad_trace_post(185);
+}
+static PFNGLVERTEX3IPROC glad_trace_next_glVertex3i = NULL;
+static void APIENTRY glad_trace_glVertex3i(GLint x, GLint y, GLint z) {
+	glad_trace_pre(186); glad_trace_next_glVertex3i(x, y, z); glad_trace_post(186);
+}
+static PFNGLVERTEX3IVPROC glad_trace_next_glVertex3iv = NULL;
+static void APIENTRY glad_trace_glVertex3iv(const GLint *v) {
+	glad_trace_pre(187); glad_trace_next_glVertex3iv(v); glad_trace_post(187);
+}
+static PFNGLVERTEX3SPROC glad_trace_next_glVertex3s = NULL;
+static void APIENTRY glad_trace_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	glad_trace_pre(188); glad_trace_next_glVertex3s(x, y, z); glad_trace_post(188);
+}
+static PFNGLVERTEX3SVPROC glad_trace_next_glVertex3sv = NULL;
+static void APIENTRY glad_trace_glVertex3sv(const GLshort *v) {
+	glad_trace_pre(189); glad_trace_next_glVertex3sv(v); glad_trace_post(189);
+}
+static PFNGLVERTEX4DPROC glad_trace_next_glVertex4d = NULL;
+static void APIENTRY glad_trace_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_trace_pre(190); glad_trace_next_glVertex4d(x, y, z, w); glad_trace_post(190);
+}
+static PFNGLVERTEX4DVPROC glad_trace_next_glVertex4dv = NULL;
+static void APIENTRY glad_trace_glVertex4dv(const GLdouble *v) {
+	glad_trace_pre(191); glad_trace_next_glVertex4dv(v); glad_trace_post(191);
+}
+static PFNGLVERTEX4FPROC glad_trace_next_glVertex4f = NULL;
+static void APIENTRY glad_trace_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_trace_pre(192); glad_trace_next_glVertex4f(x, y, z, w); glad_trace_post(192);
+}
+static PFNGLVERTEX4FVPROC glad_trace_next_glVertex4fv = NULL;
+static void APIENTRY glad_trace_glVertex4fv(const GLfloat *v) {
+	glad_trace_pre(193); glad_trace_next_glVertex4fv(v); glad_trace_post(193);
+}
+static PFNGLVERTEX4IPROC glad_trace_next_glVertex4i = NULL;
+static void APIENTRY glad_trace_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_trace_pre(194); glad_trace_next_glVertex4i(x, y, z, w); glad_trace_post(194);
+}
+static PFNGLVERTEX4IVPROC glad_trace_next_glVertex4iv = NULL;
+static void APIENTRY glad_trace_glVertex4iv(const GLint *v) {
+	glad_trace_pre(195); glad_trace_next_glVertex4iv(v); glad_trace_post(195);
+}
+static PFNGLVERTEX4SPROC glad_trace_next_glVertex4s = NULL;
+static void APIENTRY glad_trace_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_trace_pre(196); glad_trace_next_glVertex4s(x, y, z, w); glad_trace_post(196);
+}
+static PFNGLVERTEX4SVPROC glad_trace_next_glVertex4sv = NULL;
+static void APIENTRY glad_trace_glVertex4sv(const GLshort *v) {
+	glad_trace_pre(197); glad_trace_next_glVertex4sv(v); glad_trace_post(197);
+}
+static PFNGLCLIPPLANEPROC glad_trace_next_glClipPlane = NULL;
+static void APIENTRY glad_trace_glClipPlane(GLenum plane, const GLdouble *equation) {
+	glad_trace_pre(198); glad_trace_next_glClipPlane(plane, equation); glad_trace_post(198);
+}
+static PFNGLCOLORMATERIALPROC glad_trace_next_glColorMaterial = NULL;
+static void APIENTRY glad_trace_glColorMaterial(GLenum face, GLenum mode) {
+	glad_trace_pre(199); glad_trace_next_glColorMaterial(face, mode); glad_trace_post(199);
+}
+static PFNGLFOGFPROC glad_trace_next_glFogf = NULL;
+static void APIENTRY glad_trace_glFogf(GLenum pname, GLfloat param) {
+	glad_trace_pre(200); glad_trace_next_glFogf(pname, param); glad_trace_post(200);
+}
+static PFNGLFOGFVPROC glad_trace_next_glFogfv = NULL;
+static void APIENTRY glad_trace_glFogfv(GLenum pname, const GLfloat *params) {
+	glad_trace_pre(201); glad_trace_next_glFogfv(pname, params); glad_trace_post(201);
+}
+static PFNGLFOGIPROC glad_trace_next_glFogi = NULL;
+static void APIENTRY glad_trace_glFogi(GLenum pname, GLint param) {
+	glad_trace_pre(202); glad_trace_next_glFogi(pname, param); glad_trace_post(202);
+}
+static PFNGLFOGIVPROC glad_trace_next_glFogiv = NULL;
+static void APIENTRY glad_trace_glFogiv(GLenum pname, const GLint *params) {
+	glad_trace_pre(203); glad_trace_next_glFogiv(pname, params); glad_trace_post(203);
+}
+static PFNGLLIGHTFPROC glad_trace_next_glLightf = NULL;
+static void APIENTRY glad_trace_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	glad_trace_pre(204); glad_trace_next_glLightf(light, pname, param); glad_trace_post(204);
+}
+static PFNGLLIGHTFVPROC glad_trace_next_glLightfv = NULL;
+static void APIENTRY glad_trace_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	glad_trace_pre(205); glad_trace_next_glLightfv(light, pname, params); glad_trace_post(205);
+}
+static PFNGLLIGHTIPROC glad_trace_next_glLighti = NULL;
+static void APIENTRY glad_trace_glLighti(GLenum light, GLenum pname, GLint param) {
+	glad_trace_pre(206); glad_trace_next_glLighti(light, pname, param); glad_trace_post(206);
+}
+static PFNGLLIGHTIVPROC glad_trace_next_glLightiv = NULL;
+static void APIENTRY glad_trace_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	glad_trace_pre(207); glad_trace_next_glLightiv(light, pname, params); glad_trace_post(207);
+}
+static PFNGLLIGHTMODELFPROC glad_trace_next_glLightModelf = NULL;
+static void APIENTRY glad_trace_glLightModelf(GLenum pname, GLfloat param) {
+	glad_trace_pre(208); glad_trace_next_glLightModelf(pname, param); glad_trace_post(208);
+}
+static PFNGLLIGHTMODELFVPROC glad_trace_next_glLightModelfv = NULL;
+static void APIENTRY glad_trace_glLightModelfv(GLenum pname, const GLfloat *params) {
+	glad_trace_pre(209); glad_trace_next_glLightModelfv(pname, params); glad_trace_post(209);
+}
+static PFNGLLIGHTMODELIPROC glad_trace_next_glLightModeli = NULL;
+static void APIENTRY glad_trace_glLightModeli(GLenum pname, GLint param) {
+	glad_trace_pre(210); glad_trace_next_glLightModeli(pname, param); glad_trace_post(210);
+}
+static PFNGLLIGHTMODELIVPROC glad_trace_next_glLightModeliv = NULL;
+static void APIENTRY glad_trace_glLightModeliv(GLenum pname, const GLint *params) {
+	glad_trace_pre(211); glad_trace_next_glLightModeliv(pname, params); glad_trace_post(211);
+}
+static PFNGLLINESTIPPLEPROC glad_trace_next_glLineStipple = NULL;
+static void APIENTRY glad_trace_glLineStipple(GLint factor, GLushort pattern) {
+	glad_trace_pre(212); glad_trace_next_glLineStipple(factor, pattern); glad_trace_post(212);
+}
+static PFNGLMATERIALFPROC glad_trace_next_glMaterialf = NULL;
+static void APIENTRY glad_trace_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	glad_trace_pre(213); glad_trace_next_glMaterialf(face, pname, param); glad_trace_post(213);
+}
+static PFNGLMATERIALFVPROC glad_trace_next_glMaterialfv = NULL;
+static void APIENTRY glad_trace_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	glad_trace_pre(214); glad_trace_next_glMaterialfv(face, pname, params); glad_trace_post(214);
+}
+static PFNGLMATERIALIPROC glad_trace_next_glMateriali = NULL;
+static void APIENTRY glad_trace_glMateriali(GLenum face, GLenum pname, GLint param) {
+	glad_trace_pre(215); glad_trace_next_glMateriali(face, pname, param); glad_trace_post(215);
+}
+static PFNGLMATERIALIVPROC glad_trace_next_glMaterialiv = NULL;
+static void APIENTRY glad_trace_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	glad_trace_pre(216); glad_trace_next_glMaterialiv(face, pname, params); glad_trace_post(216);
+}
+static PFNGLPOLYGONSTIPPLEPROC glad_trace_next_glPolygonStipple = NULL;
+static void APIENTRY glad_trace_glPolygonStipple(const GLubyte *mask) {
+	glad_trace_pre(217); glad_trace_next_glPolygonStipple(mask); glad_trace_post(217);
+}
+static PFNGLSHADEMODELPROC glad_trace_next_glShadeModel = NULL;
+static void APIENTRY glad_trace_glShadeModel(GLenum mode) {
+	glad_trace_pre(218); glad_trace_next_glShadeModel(mode); glad_trace_post(218);
+}
+static PFNGLTEXENVFPROC glad_trace_next_glTexEnvf = NULL;
+static void APIENTRY glad_trace_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	glad_trace_pre(219); glad_trace_next_glTexEnvf(target, pname, param); glad_trace_post(219);
+}
+static PFNGLTEXENVFVPROC glad_trace_next_glTexEnvfv = NULL;
+static void APIENTRY glad_trace_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_trace_pre(220); glad_trace_next_glTexEnvfv(target, pname, params); glad_trace_post(220);
+}
+static PFNGLTEXENVIPROC glad_trace_next_glTexEnvi = NULL;
+static void APIENTRY glad_trace_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	glad_trace_pre(221); glad_trace_next_glTexEnvi(target, pname, param); glad_trace_post(221);
+}
+static PFNGLTEXENVIVPROC glad_trace_next_glTexEnviv = NULL;
+static void APIENTRY glad_trace_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	glad_trace_pre(222); glad_trace_next_glTexEnviv(target, pname, params); glad_trace_post(222);
+}
+static PFNGLTEXGENDPROC glad_trace_next_glTexGend = NULL;
+static void APIENTRY glad_trace_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	glad_trace_pre(223); glad_trace_next_glTexGend(coord, pname, param); glad_trace_post(223);
+}
+static PFNGLTEXGENDVPROC glad_trace_next_glTexGendv = NULL;
+static void APIENTRY glad_trace_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	glad_trace_pre(224); glad_trace_next_glTexGendv(coord, pname, params); glad_trace_post(224);
+}
+static PFNGLTEXGENFPROC glad_trace_next_glTexGenf = NULL;
+static void APIENTRY glad_trace_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	glad_trace_pre(225); glad_trace_next_glTexGenf(coord, pname, param); glad_trace_post(225);
+}
+static PFNGLTEXGENFVPROC glad_trace_next_glTexGenfv = NULL;
+static void APIENTRY glad_trace_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	glad_trace_pre(226); glad_trace_next_glTexGenfv(coord, pname, params); glad_trace_post(226);
+}
+static PFNGLTEXGENIPROC glad_trace_next_glTexGeni = NULL;
+static void APIENTRY glad_trace_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	glad_trace_pre(227); glad_trace_next_glTexGeni(coord, pname, param); glad_trace_post(227);
+}
+static PFNGLTEXGENIVPROC glad_trace_next_glTexGeniv = NULL;
+static void APIENTRY glad_trace_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	glad_trace_pre(228); glad_trace_next_glTexGeniv(coord, pname, params); glad_trace_post(228);
+}
+static PFNGLFEEDBACKBUFFERPROC glad_trace_next_glFeedbackBuffer = NULL;
+static void APIENTRY glad_trace_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	glad_trace_pre(229); glad_trace_next_glFeedbackBuffer(size, type, buffer); glad_trace_post(229);
+}
+static PFNGLSELECTBUFFERPROC glad_trace_next_glSelectBuffer = NULL;
+static void APIENTRY glad_trace_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	glad_trace_pre(230); glad_trace_next_glSelectBuffer(size, buffer); glad_trace_post(230);
+}
+static PFNGLRENDERMODEPROC glad_trace_next_glRenderMode = NULL;
+static GLint APIENTRY glad_trace_glRenderMode(GLenum mode) {
+	GLint result; glad_trace_pre(231); result = glad_trace_next_glRenderMode(mode); glad_trace_post(231); return result;
+}
+static PFNGLINITNAMESPROC glad_trace_next_glInitNames = NULL;
+static void APIENTRY glad_trace_glInitNames(void) {
+	glad_trace_pre(232); glad_trace_next_glInitNames(); glad_trace_post(232);
+}
+static PFNGLLOADNAMEPROC glad_trace_next_glLoadName = NULL;
+static void APIENTRY glad_trace_glLoadName(GLuint name) {
+	glad_trace_pre(233); glad_trace_next_glLoadName(name); glad_trace_post(233);
+}
+static PFNGLPASSTHROUGHPROC glad_trace_next_glPassThrough = NULL;
+static void APIENTRY glad_trace_glPassThrough(GLfloat token) {
+	glad_trace_pre(234); glad_trace_next_glPassThrough(token); glad_trace_post(234);
+}
+static PFNGLPOPNAMEPROC glad_trace_next_glPopName = NULL;
+static void APIENTRY glad_trace_glPopName(void) {
+	glad_trace_pre(235); glad_trace_next_glPopName(); glad_trace_post(235);
+}
+static PFNGLPUSHNAMEPROC glad_trace_next_glPushName = NULL;
+static void APIENTRY glad_trace_glPushName(GLuint name) {
+	glad_trace_pre(236); glad_trace_next_glPushName(name); glad_trace_post(236);
+}
+static PFNGLCLEARACCUMPROC glad_trace_next_glClearAccum = NULL;
+static void APIENTRY glad_trace_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_trace_pre(237); glad_trace_next_glClearAccum(red, green, blue, alpha); glad_trace_post(237);
+}
+static PFNGLCLEARINDEXPROC glad_trace_next_glClearIndex = NULL;
+static void APIENTRY glad_trace_glClearIndex(GLfloat c) {
+	glad_trace_pre(238); glad_trace_next_glClearIndex(c); glad_trace_post(238);
+}
+static PFNGLINDEXMASKPROC glad_trace_next_glIndexMask = NULL;
+static void APIENTRY glad_trace_glIndexMask(GLuint mask) {
+	glad_trace_pre(239); glad_trace_next_glIndexMask(mask); glad_trace_post(239);
+}
+static PFNGLACCUMPROC glad_trace_next_glAccum = NULL;
+static void APIENTRY glad_trace_glAccum(GLenum op, GLfloat value) {
+	glad_trace_pre(240); glad_trace_next_glAccum(op, value); glad_trace_post(240);
+}
+static PFNGLPOPATTRIBPROC glad_trace_next_glPopAttrib = NULL;
+static void APIENTRY glad_trace_glPopAttrib(void) {
+	glad_trace_pre(241); glad_trace_next_glPopAttrib(); glad_trace_post(241);
+}
+static PFNGLPUSHATTRIBPROC glad_trace_next_glPushAttrib = NULL;
+static void APIENTRY glad_trace_glPushAttrib(GLbitfield mask) {
+	glad_trace_pre(242); glad_trace_next_glPushAttrib(mask); glad_trace_post(242);
+}
+static PFNGLMAP1DPROC glad_trace_next_glMap1d = NULL;
+static void APIENTRY glad_trace_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	glad_trace_pre(243); glad_trace_next_glMap1d(target, u1, u2, stride, order, points); glad_trace_post(243);
+}
+static PFNGLMAP1FPROC glad_trace_next_glMap1f = NULL;
+static void APIENTRY glad_trace_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	glad_trace_pre(244); glad_trace_next_glMap1f(target, u1, u2, stride, order, points); glad_trace_post(244);
+}
+static PFNGLMAP2DPROC glad_trace_next_glMap2d = NULL;
+static void APIENTRY glad_trace_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	glad_trace_pre(245); glad_trace_next_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); glad_trace_post(245);
+}
+static PFNGLMAP2FPROC glad_trace_next_glMap2f = NULL;
+static void APIENTRY glad_trace_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	glad_trace_pre(246); glad_trace_next_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); glad_trace_post(246);
+}
+static PFNGLMAPGRID1DPROC glad_trace_next_glMapGrid1d = NULL;
+static void APIENTRY glad_trace_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	glad_trace_pre(247); glad_trace_next_glMapGrid1d(un, u1, u2); glad_trace_post(247);
+}
+static PFNGLMAPGRID1FPROC glad_trace_next_glMapGrid1f = NULL;
+static void APIENTRY glad_trace_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	glad_trace_pre(248); glad_trace_next_glMapGrid1f(un, u1, u2); glad_trace_post(248);
+}
+static PFNGLMAPGRID2DPROC glad_trace_next_glMapGrid2d = NULL;
+static void APIENTRY glad_trace_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	glad_trace_pre(249); glad_trace_next_glMapGrid2d(un, u1, u2, vn, v1, v2); glad_trace_post(249);
+}
+static PFNGLMAPGRID2FPROC glad_trace_next_glMapGrid2f = NULL;
+static void APIENTRY glad_trace_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	glad_trace_pre(250); glad_trace_next_glMapGrid2f(un, u1, u2, vn, v1, v2); glad_trace_post(250);
+}
+static PFNGLEVALCOORD1DPROC glad_trace_next_glEvalCoord1d = NULL;
+static void APIENTRY glad_trace_glEvalCoord1d(GLdouble u) {
+	glad_trace_pre(251); glad_trace_next_glEvalCoord1d(u); glad_trace_post(251);
+}
+static PFNGLEVALCOORD1DVPROC glad_trace_next_glEvalCoord1dv = NULL;
+static void APIENTRY glad_trace_glEvalCoord1dv(const GLdouble *u) {
+	glad_trace_pre(252); glad_trace_next_glEvalCoord1dv(u); glad_trace_post(252);
+}
+static PFNGLEVALCOORD1FPROC glad_trace_next_glEvalCoord1f = NULL;
+static void APIENTRY glad_trace_glEvalCoord1f(GLfloat u) {
+	glad_trace_pre(253); glad_trace_next_glEvalCoord1f(u); glad_trace_post(253);
+}
+static PFNGLEVALCOORD1FVPROC glad_trace_next_glEvalCoord1fv = NULL;
+static void APIENTRY glad_trace_glEvalCoord1fv(const GLfloat *u) {
+	glad_trace_pre(254); glad_trace_next_glEvalCoord1fv(u); glad_trace_post(254);
+}
+static PFNGLEVALCOORD2DPROC glad_trace_next_glEvalCoord2d = NULL;
+static void APIENTRY glad_trace_glEvalCoord2d(GLdouble u, GLdouble v) {
+	glad_trace_pre(255); glad_trace_next_glEvalCoord2d(u, v); glad_trace_post(255);
+}
+static PFNGLEVALCOORD2DVPROC glad_trace_next_glEvalCoord2dv = NULL;
+static void APIENTRY glad_trace_glEvalCoord2dv(const GLdouble *u) {
+	glad_trace_pre(256); glad_trace_next_glEvalCoord2dv(u); glad_trace_post(256);
+}
+static PFNGLEVALCOORD2FPROC glad_trace_next_glEvalCoord2f = NULL;
+static void APIENTRY glad_trace_glEvalCoord2f(GLfloat u, GLfloat v) {
+	glad_trace_pre(257); glad_trace_next_glEvalCoord2f(u, v); glad_trace_post(257);
+}
+static PFNGLEVALCOORD2FVPROC glad_trace_next_glEvalCoord2fv = NULL;
+static void APIENTRY glad_trace_glEvalCoord2fv(const GLfloat *u) {
+	glad_trace_pre(258); glad_trace_next_glEvalCoord2fv(u); glad_trace_post(258);
+}
+static PFNGLEVALMESH1PROC glad_trace_next_glEvalMesh1 = NULL;
+static void APIENTRY glad_trace_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	glad_trace_pre(259); glad_trace_next_glEvalMesh1(mode, i1, i2); glad_trace_post(259);
+}
+static PFNGLEVALPOINT1PROC glad_trace_next_glEvalPoint1 = NULL;
+static void APIENTRY glad_trace_glEvalPoint1(GLint i) {
+	glad_trace_pre(260); glad_trace_next_glEvalPoint1(i); glad_trace_post(260);
+}
+static PFNGLEVALMESH2PROC glad_trace_next_glEvalMesh2 = NULL;
+static void APIENTRY glad_trace_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	glad_trace_pre(261); glad_trace_next_glEvalMesh2(mode, i1, i2, j1, j2); glad_trace_post(261);
+}
+static PFNGLEVALPOINT2PROC glad_trace_next_glEvalPoint2 = NULL;
+static void APIENTRY glad_trace_glEvalPoint2(GLint i, GLint j) {
+	glad_trace_pre(262); glad_trace_next_glEvalPoint2(i, j); glad_trace_post(262);
+}
+static PFNGLALPHAFUNCPROC glad_trace_next_glAlphaFunc = NULL;
+static void APIENTRY glad_trace_glAlphaFunc(GLenum func, GLfloat ref) {
+	glad_trace_pre(263); glad_trace_next_glAlphaFunc(func, ref); glad_trace_post(263);
+}
+static PFNGLPIXELZOOMPROC glad_trace_next_glPixelZoom = NULL;
+static void APIENTRY glad_trace_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	glad_trace_pre(264); glad_trace_next_glPixelZoom(xfactor, yfactor); glad_trace_post(264);
+}
+static PFNGLPIXELTRANSFERFPROC glad_trace_next_glPixelTransferf = NULL;
+static void APIENTRY glad_trace_glPixelTransferf(GLenum pname, GLfloat param) {
+	glad_trace_pre(265); glad_trace_next_glPixelTransferf(pname, param); glad_trace_post(265);
+}
+static PFNGLPIXELTRANSFERIPROC glad_trace_next_glPixelTransferi = NULL;
+static void APIENTRY glad_trace_glPixelTransferi(GLenum pname, GLint param) {
+	glad_trace_pre(266); glad_trace_next_glPixelTransferi(pname, param); glad_trace_post(266);
+}
+static PFNGLPIXELMAPFVPROC glad_trace_next_glPixelMapfv = NULL;
+static void APIENTRY glad_trace_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	glad_trace_pre(267); glad_trace_next_glPixelMapfv(map, mapsize, values); glad_trace_post(267);
+}
+static PFNGLPIXELMAPUIVPROC glad_trace_next_glPixelMapuiv = NULL;
+static void APIENTRY glad_trace_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	glad_trace_pre(268); glad_trace_next_glPixelMapuiv(map, mapsize, values); glad_trace_post(268);
+}
+static PFNGLPIXELMAPUSVPROC glad_trace_next_glPixelMapusv = NULL;
+static void APIENTRY glad_trace_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	glad_trace_pre(269); glad_trace_next_glPixelMapusv(map, mapsize, values); glad_trace_post(269);
+}
+static PFNGLCOPYPIXELSPROC glad_trace_next_glCopyPixels = NULL;
+static void APIENTRY glad_trace_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	glad_trace_pre(270); glad_trace_next_glCopyPixels(x, y, width, height, type); glad_trace_post(270);
+}
+static PFNGLDRAWPIXELSPROC glad_trace_next_glDrawPixels = NULL;
+static void APIENTRY glad_trace_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_pre(271); glad_trace_next_glDrawPixels(width, height, format, type, pixels); glad_trace_post(271);
+}
+static PFNGLGETCLIPPLANEPROC glad_trace_next_glGetClipPlane = NULL;
+static void APIENTRY glad_trace_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	glad_trace_pre(272); glad_trace_next_glGetClipPlane(plane, equation); glad_trace_post(272);
+}
+static PFNGLGETLIGHTFVPROC glad_trace_next_glGetLightfv = NULL;
+static void APIENTRY glad_trace_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	glad_trace_pre(273); glad_trace_next_glGetLightfv(light, pname, params); glad_trace_post(273);
+}
+static PFNGLGETLIGHTIVPROC glad_trace_next_glGetLightiv = NULL;
+static void APIENTRY glad_trace_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	glad_trace_pre(274); glad_trace_next_glGetLightiv(light, pname, params); glad_trace_post(274);
+}
+static PFNGLGETMAPDVPROC glad_trace_next_glGetMapdv = NULL;
+static void APIENTRY glad_trace_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	glad_trace_pre(275); glad_trace_next_glGetMapdv(target, query, v); glad_trace_post(275);
+}
+static PFNGLGETMAPFVPROC glad_trace_next_glGetMapfv = NULL;
+static void APIENTRY glad_trace_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	glad_trace_pre(276); glad_trace_next_glGetMapfv(target, query, v); glad_trace_post(276);
+}
+static PFNGLGETMAPIVPROC glad_trace_next_glGetMapiv = NULL;
+static void APIENTRY glad_trace_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	glad_trace_pre(277); glad_trace_next_glGetMapiv(target, query, v); glad_trace_post(277);
+}
+static PFNGLGETMATERIALFVPROC glad_trace_next_glGetMaterialfv = NULL;
+static void APIENTRY glad_trace_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	glad_trace_pre(278); glad_trace_next_glGetMaterialfv(face, pname, params); glad_trace_post(278);
+}
+static PFNGLGETMATERIALIVPROC glad_trace_next_glGetMaterialiv = NULL;
+static void APIENTRY glad_trace_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	glad_trace_pre(279); glad_trace_next_glGetMaterialiv(face, pname, params); glad_trace_post(279);
+}
+static PFNGLGETPIXELMAPFVPROC glad_trace_next_glGetPixelMapfv = NULL;
+static void APIENTRY glad_trace_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	glad_trace_pre(280); glad_trace_next_glGetPixelMapfv(map, values); glad_trace_post(280);
+}
+static PFNGLGETPIXELMAPUIVPROC glad_trace_next_glGetPixelMapuiv = NULL;
+static void APIENTRY glad_trace_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	glad_trace_pre(281); glad_trace_next_glGetPixelMapuiv(map, values); glad_trace_post(281);
+}
+static PFNGLGETPIXELMAPUSVPROC glad_trace_next_glGetPixelMapusv = NULL;
+static void APIENTRY glad_trace_glGetPixelMapusv(GLenum map, GLushort *values) {
+	glad_trace_pre(282); glad_trace_next_glGetPixelMapusv(map, values); glad_trace_post(282);
+}
+static PFNGLGETPOLYGONSTIPPLEPROC glad_trace_next_glGetPolygonStipple = NULL;
+static void APIENTRY glad_trace_glGetPolygonStipple(GLubyte *mask) {
+	glad_trace_pre(283); glad_trace_next_glGetPolygonStipple(mask); glad_trace_post(283);
+}
+static PFNGLGETTEXENVFVPROC glad_trace_next_glGetTexEnvfv = NULL;
+static void APIENTRY glad_trace_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_trace_pre(284); glad_trace_next_glGetTexEnvfv(target, pname, params); glad_trace_post(284);
+}
+static PFNGLGETTEXENVIVPROC glad_trace_next_glGetTexEnviv = NULL;
+static void APIENTRY glad_trace_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	glad_trace_pre(285); glad_trace_next_glGetTexEnviv(target, pname, params); glad_trace_post(285);
+}
+static PFNGLGETTEXGENDVPROC glad_trace_next_glGetTexGendv = NULL;
+static void APIENTRY glad_trace_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	glad_trace_pre(286); glad_trace_next_glGetTexGendv(coord, pname, params); glad_trace_post(286);
+}
+static PFNGLGETTEXGENFVPROC glad_trace_next_glGetTexGenfv = NULL;
+static void APIENTRY glad_trace_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	glad_trace_pre(287); glad_trace_next_glGetTexGenfv(coord, pname, params); glad_trace_post(287);
+}
+static PFNGLGETTEXGENIVPROC glad_trace_next_glGetTexGeniv = NULL;
+static void APIENTRY glad_trace_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	glad_trace_pre(288); glad_trace_next_glGetTexGeniv(coord, pname, params); glad_trace_post(288);
+}
+static PFNGLISLISTPROC glad_trace_next_glIsList = NULL;
+static GLboolean APIENTRY glad_trace_glIsList(GLuint list) {
+	GLboolean result; glad_trace_pre(289); result = glad_trace_next_glIsList(list); glad_trace_post(289); return result;
+}
+static PFNGLFRUSTUMPROC glad_trace_next_glFrustum = NULL;
+static void APIENTRY glad_trace_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_trace_pre(290); glad_trace_next_glFrustum(left, right, bottom, top, zNear, zFar); glad_trace_post(290);
+}
+static PFNGLLOADIDENTITYPROC glad_trace_next_glLoadIdentity = NULL;
+static void APIENTRY glad_trace_glLoadIdentity(void) {
+	glad_trace_pre(291); glad_trace_next_glLoadIdentity(); glad_trace_post(291);
+}
+static PFNGLLOADMATRIXFPROC glad_trace_next_glLoadMatrixf = NULL;
+static void APIENTRY glad_trace_glLoadMatrixf(const GLfloat *m) {
+	glad_trace_pre(292); glad_trace_next_glLoadMatrixf(m); glad_trace_post(292);
+}
+static PFNGLLOADMATRIXDPROC glad_trace_next_glLoadMatrixd = NULL;
+static void APIENTRY glad_trace_glLoadMatrixd(const GLdouble *m) {
+	glad_trace_pre(293); glad_trace_next_glLoadMatrixd(m); glad_trace_post(293);
+}
+static PFNGLMATRIXMODEPROC glad_trace_next_glMatrixMode = NULL;
+static void APIENTRY glad_trace_glMatrixMode(GLenum mode) {
+	glad_trace_pre(294); glad_trace_next_glMatrixMode(mode); glad_trace_post(294);
+}
+static PFNGLMULTMATRIXFPROC glad_trace_next_glMultMatrixf = NULL;
+static void APIENTRY glad_trace_glMultMatrixf(const GLfloat *m) {
+	glad_trace_pre(295); glad_trace_next_glMultMatrixf(m); glad_trace_post(295);
+}
+static PFNGLMULTMATRIXDPROC glad_trace_next_glMultMatrixd = NULL;
+static void APIENTRY glad_trace_glMultMatrixd(const GLdouble *m) {
+	glad_trace_pre(296); glad_trace_next_glMultMatrixd(m); glad_trace_post(296);
+}
+static PFNGLORTHOPROC glad_trace_next_glOrtho = NULL;
+static void APIENTRY glad_trace_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_trace_pre(297); glad_trace_next_glOrtho(left, right, bottom, top, zNear, zFar); glad_trace_post(297);
+}
+static PFNGLPOPMATRIXPROC glad_trace_next_glPopMatrix = NULL;
+static void APIENTRY glad_trace_glPopMatrix(void) {
+	glad_trace_pre(298); glad_trace_next_glPopMatrix(); glad_trace_post(298);
+}
+static PFNGLPUSHMATRIXPROC glad_trace_next_glPushMatrix = NULL;
+static void APIENTRY glad_trace_glPushMatrix(void) {
+	glad_trace_pre(299); glad_trace_next_glPushMatrix(); glad_trace_post(299);
+}
+static PFNGLROTATEDPROC glad_trace_next_glRotated = NULL;
+static void APIENTRY glad_trace_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_pre(300); glad_trace_next_glRotated(angle, x, y, z); glad_trace_post(300);
+}
+static PFNGLROTATEFPROC glad_trace_next_glRotatef = NULL;
+static void APIENTRY glad_trace_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_pre(301); glad_trace_next_glRotatef(angle, x, y, z); glad_trace_post(301);
+}
+static PFNGLSCALEDPROC glad_trace_next_glScaled = NULL;
+static void APIENTRY glad_trace_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_pre(302); glad_trace_next_glScaled(x, y, z); glad_trace_post(302);
+}
+static PFNGLSCALEFPROC glad_trace_next_glScalef = NULL;
+static void APIENTRY glad_trace_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_pre(303); glad_trace_next_glScalef(x, y, z); glad_trace_post(303);
+}
+static PFNGLTRANSLATEDPROC glad_trace_next_glTranslated = NULL;
+static void APIENTRY glad_trace_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_pre(304); glad_trace_next_glTranslated(x, y, z); glad_trace_post(304);
+}
+static PFNGLTRANSLATEFPROC glad_trace_next_glTranslatef = NULL;
+static void APIENTRY glad_trace_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_pre(305); glad_trace_next_glTranslatef(x, y, z); glad_trace_post(305);
+}
+static PFNGLDRAWARRAYSPROC glad_trace_next_glDrawArrays = NULL;
+static void APIENTRY glad_trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_trace_pre(306); glad_trace_next_glDrawArrays(mode, first, count); glad_trace_post(306);
+}
+static PFNGLDRAWELEMENTSPROC glad_trace_next_glDrawElements = NULL;
+static void APIENTRY glad_trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_trace_pre(307); glad_trace_next_glDrawElements(mode, count, type, indices); glad_trace_post(307);
+}
+static PFNGLGETPOINTERVPROC glad_trace_next_glGetPointerv = NULL;
+static void APIENTRY glad_trace_glGetPointerv(GLenum pname, void **params) {
+	glad_trace_pre(308); glad_trace_next_glGetPointerv(pname, params); glad_trace_post(308);
+}
+static PFNGLPOLYGONOFFSETPROC glad_trace_next_glPolygonOffset = NULL;
+static void APIENTRY glad_trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_trace_pre(309); glad_trace_next_glPolygonOffset(factor, units); glad_trace_post(309);
+}
+static PFNGLCOPYTEXIMAGE1DPROC glad_trace_next_glCopyTexImage1D = NULL;
+static void APIENTRY glad_trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_trace_pre(310); glad_trace_next_glCopyTexImage1D(target, level, internalformat, x, y, width, border); glad_trace_post(310);
+}
+static PFNGLCOPYTEXIMAGE2DPROC glad_trace_next_glCopyTexImage2D = NULL;
+static void APIENTRY glad_trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_trace_pre(311); glad_trace_next_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border); glad_trace_post(311);
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_trace_next_glCopyTexSubImage1D = NULL;
+static void APIENTRY glad_trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_trace_pre(312); glad_trace_next_glCopyTexSubImage1D(target, level, xoffset, x, y, width); glad_trace_post(312);
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_trace_next_glCopyTexSubImage2D = NULL;
+static void APIENTRY glad_trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_pre(313); glad_trace_next_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); glad_trace_post(313);
+}
+static PFNGLTEXSUBIMAGE1DPROC glad_trace_next_glTexSubImage1D = NULL;
+static void APIENTRY glad_trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_pre(314); glad_trace_next_glTexSubImage1D(target, level, xoffset, width, format, type, pixels); glad_trace_post(314);
+}
+static PFNGLTEXSUBIMAGE2DPROC glad_trace_next_glTexSubImage2D = NULL;
+static void APIENTRY glad_trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_pre(315); glad_trace_next_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels); glad_trace_post(315);
+}
+static PFNGLBINDTEXTUREPROC glad_trace_next_glBindTexture = NULL;
+static void APIENTRY glad_trace_glBindTexture(GLenum target, GLuint texture) {
+	glad_trace_pre(316); glad_trace_next_glBindTexture(target, texture); glad_trace_post(316);
+}
+static PFNGLDELETETEXTURESPROC glad_trace_next_glDeleteTextures = NULL;
+static void APIENTRY glad_trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_trace_pre(317); glad_trace_next_glDeleteTextures(n, textures); glad_trace_post(317);
+}
+static PFNGLGENTEXTURESPROC glad_trace_next_glGenTextures = NULL;
+static void APIENTRY glad_trace_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_trace_pre(318); glad_trace_next_glGenTextures(n, textures); glad_trace_post(318);
+}
+static PFNGLISTEXTUREPROC glad_trace_next_glIsTexture = NULL;
+static GLboolean APIENTRY glad_trace_glIsTexture(GLuint texture) {
+	GLboolean result; glad_trace_pre(319); result = glad_trace_next_glIsTexture(texture); glad_trace_post(319); return result;
+}
+static PFNGLARRAYELEMENTPROC glad_trace_next_glArrayElement = NULL;
+static void APIENTRY glad_trace_glArrayElement(GLint i) {
+	glad_trace_pre(320); glad_trace_next_glArrayElement(i); glad_trace_post(320);
+}
+static PFNGLCOLORPOINTERPROC glad_trace_next_glColorPointer = NULL;
+static void APIENTRY glad_trace_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(321); glad_trace_next_glColorPointer(size, type, stride, pointer); glad_trace_post(321);
+}
+static PFNGLDISABLECLIENTSTATEPROC glad_trace_next_glDisableClientState = NULL;
+static void APIENTRY glad_trace_glDisableClientState(GLenum array) {
+	glad_trace_pre(322); glad_trace_next_glDisableClientState(array); glad_trace_post(322);
+}
+static PFNGLEDGEFLAGPOINTERPROC glad_trace_next_glEdgeFlagPointer = NULL;
+static void APIENTRY glad_trace_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	glad_trace_pre(323); glad_trace_next_glEdgeFlagPointer(stride, pointer); glad_trace_post(323);
+}
+static PFNGLENABLECLIENTSTATEPROC glad_trace_next_glEnableClientState = NULL;
+static void APIENTRY glad_trace_glEnableClientState(GLenum array) {
+	glad_trace_pre(324); glad_trace_next_glEnableClientState(array); glad_trace_post(324);
+}
+static PFNGLINDEXPOINTERPROC glad_trace_next_glIndexPointer = NULL;
+static void APIENTRY glad_trace_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(325); glad_trace_next_glIndexPointer(type, stride, pointer); glad_trace_post(325);
+}
+static PFNGLINTERLEAVEDARRAYSPROC glad_trace_next_glInterleavedArrays = NULL;
+static void APIENTRY glad_trace_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	glad_trace_pre(326); glad_trace_next_glInterleavedArrays(format, stride, pointer); glad_trace_post(326);
+}
+static PFNGLNORMALPOINTERPROC glad_trace_next_glNormalPointer = NULL;
+static void APIENTRY glad_trace_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(327); glad_trace_next_glNormalPointer(type, stride, pointer); glad_trace_post(327);
+}
+static PFNGLTEXCOORDPOINTERPROC glad_trace_next_glTexCoordPointer = NULL;
+static void APIENTRY glad_trace_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(328); glad_trace_next_glTexCoordPointer(size, type, stride, pointer); glad_trace_post(328);
+}
+static PFNGLVERTEXPOINTERPROC glad_trace_next_glVertexPointer = NULL;
+static void APIENTRY glad_trace_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(329); glad_trace_next_glVertexPointer(size, type, stride, pointer); glad_trace_post(329);
+}
+static PFNGLARETEXTURESRESIDENTPROC glad_trace_next_glAreTexturesResident = NULL;
+static GLboolean APIENTRY glad_trace_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	GLboolean result; glad_trace_pre(330); result = glad_trace_next_glAreTexturesResident(n, textures, residences); glad_trace_post(330); return result;
+}
+static PFNGLPRIORITIZETEXTURESPROC glad_trace_next_glPrioritizeTextures = NULL;
+static void APIENTRY glad_trace_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	glad_trace_pre(331); glad_trace_next_glPrioritizeTextures(n, textures, priorities); glad_trace_post(331);
+}
+static PFNGLINDEXUBPROC glad_trace_next_glIndexub = NULL;
+static void APIENTRY glad_trace_glIndexub(GLubyte c) {
+	glad_trace_pre(332); glad_trace_next_glIndexub(c); glad_trace_post(332);
+}
+static PFNGLINDEXUBVPROC glad_trace_next_glIndexubv = NULL;
+static void APIENTRY glad_trace_glIndexubv(const GLubyte *c) {
+	glad_trace_pre(333); glad_trace_next_glIndexubv(c); glad_trace_post(333);
+}
+static PFNGLPOPCLIENTATTRIBPROC glad_trace_next_glPopClientAttrib = NULL;
+static void APIENTRY glad_trace_glPopClientAttrib(void) {
+	glad_trace_pre(334); glad_trace_next_glPopClientAttrib(); glad_trace_post(334);
+}
+static PFNGLPUSHCLIENTATTRIBPROC glad_trace_next_glPushClientAttrib = NULL;
+static void APIENTRY glad_trace_glPushClientAttrib(GLbitfield mask) {
+	glad_trace_pre(335); glad_trace_next_glPushClientAttrib(mask); glad_trace_post(335);
+}
+static PFNGLDRAWRANGEELEMENTSPROC glad_trace_next_glDrawRangeElements = NULL;
+static void APIENTRY glad_trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_trace_pre(336); glad_trace_next_glDrawRangeElements(mode, start, end, count, type, indices); glad_trace_post(336);
+}
+static PFNGLTEXIMAGE3DPROC glad_trace_next_glTexImage3D = NULL;
+static void APIENTRY glad_trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_pre(337); glad_trace_next_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels); glad_trace_post(337);
+}
+static PFNGLTEXSUBIMAGE3DPROC glad_trace_next_glTexSubImage3D = NULL;
+static void APIENTRY glad_trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_pre(338); glad_trace_next_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); glad_trace_post(338);
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_trace_next_glCopyTexSubImage3D = NULL;
+static void APIENTRY glad_trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_pre(339); glad_trace_next_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); glad_trace_post(339);
+}
+static PFNGLACTIVETEXTUREPROC glad_trace_next_glActiveTexture = NULL;
+static void APIENTRY glad_trace_glActiveTexture(GLenum texture) {
+	glad_trace_pre(340); glad_trace_next_glActiveTexture(texture); glad_trace_post(340);
+}
+static PFNGLSAMPLECOVERAGEPROC glad_trace_next_glSampleCoverage = NULL;
+static void APIENTRY glad_trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_trace_pre(341); glad_trace_next_glSampleCoverage(value, invert); glad_trace_post(341);
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_trace_next_glCompressedTexImage3D = NULL;
+static void APIENTRY glad_trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_trace_pre(342); glad_trace_next_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data); glad_trace_post(342);
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_trace_next_glCompressedTexImage2D = NULL;
+static void APIENTRY glad_trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_trace_pre(343); glad_trace_next_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data); glad_trace_post(343);
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_trace_next_glCompressedTexImage1D = NULL;
+static void APIENTRY glad_trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_trace_pre(344); glad_trace_next_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data); glad_trace_post(344);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_trace_next_glCompressedTexSubImage3D = NULL;
+static void APIENTRY glad_trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_pre(345); glad_trace_next_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); glad_trace_post(345);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_trace_next_glCompressedTexSubImage2D = NULL;
+static void APIENTRY glad_trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_pre(346); glad_trace_next_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data); glad_trace_post(346);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_trace_next_glCompressedTexSubImage1D = NULL;
+static void APIENTRY glad_trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_pre(347); glad_trace_next_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data); glad_trace_post(347);
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_trace_next_glGetCompressedTexImage = NULL;
+static void APIENTRY glad_trace_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_trace_pre(348); glad_trace_next_glGetCompressedTexImage(target, level, img); glad_trace_post(348);
+}
+static PFNGLCLIENTACTIVETEXTUREPROC glad_trace_next_glClientActiveTexture = NULL;
+static void APIENTRY glad_trace_glClientActiveTexture(GLenum texture) {
+	glad_trace_pre(349); glad_trace_next_glClientActiveTexture(texture); glad_trace_post(349);
+}
+static PFNGLMULTITEXCOORD1DPROC glad_trace_next_glMultiTexCoord1d = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	glad_trace_pre(350); glad_trace_next_glMultiTexCoord1d(target, s); glad_trace_post(350);
+}
+static PFNGLMULTITEXCOORD1DVPROC glad_trace_next_glMultiTexCoord1dv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	glad_trace_pre(351); glad_trace_next_glMultiTexCoord1dv(target, v); glad_trace_post(351);
+}
+static PFNGLMULTITEXCOORD1FPROC glad_trace_next_glMultiTexCoord1f = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	glad_trace_pre(352); glad_trace_next_glMultiTexCoord1f(target, s); glad_trace_post(352);
+}
+static PFNGLMULTITEXCOORD1FVPROC glad_trace_next_glMultiTexCoord1fv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	glad_trace_pre(353); glad_trace_next_glMultiTexCoord1fv(target, v); glad_trace_post(353);
+}
+static PFNGLMULTITEXCOORD1IPROC glad_trace_next_glMultiTexCoord1i = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1i(GLenum target, GLint s) {
+	glad_trace_pre(354); glad_trace_next_glMultiTexCoord1i(target, s); glad_trace_post(354);
+}
+static PFNGLMULTITEXCOORD1IVPROC glad_trace_next_glMultiTexCoord1iv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	glad_trace_pre(355); glad_trace_next_glMultiTexCoord1iv(target, v); glad_trace_post(355);
+}
+static PFNGLMULTITEXCOORD1SPROC glad_trace_next_glMultiTexCoord1s = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1s(GLenum target, GLshort s) {
+	glad_trace_pre(356); glad_trace_next_glMultiTexCoord1s(target, s); glad_trace_post(356);
+}
+static PFNGLMULTITEXCOORD1SVPROC glad_trace_next_glMultiTexCoord1sv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	glad_trace_pre(357); glad_trace_next_glMultiTexCoord1sv(target, v); glad_trace_post(357);
+}
+static PFNGLMULTITEXCOORD2DPROC glad_trace_next_glMultiTexCoord2d = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	glad_trace_pre(358); glad_trace_next_glMultiTexCoord2d(target, s, t); glad_trace_post(358);
+}
+static PFNGLMULTITEXCOORD2DVPROC glad_trace_next_glMultiTexCoord2dv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	glad_trace_pre(359); glad_trace_next_glMultiTexCoord2dv(target, v); glad_trace_post(359);
+}
+static PFNGLMULTITEXCOORD2FPROC glad_trace_next_glMultiTexCoord2f = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	glad_trace_pre(360); glad_trace_next_glMultiTexCoord2f(target, s, t); glad_trace_post(360);
+}
+static PFNGLMULTITEXCOORD2FVPROC glad_trace_next_glMultiTexCoord2fv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	glad_trace_pre(361); glad_trace_next_glMultiTexCoord2fv(target, v); glad_trace_post(361);
+}
+static PFNGLMULTITEXCOORD2IPROC glad_trace_next_glMultiTexCoord2i = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	glad_trace_pre(362); glad_trace_next_glMultiTexCoord2i(target, s, t); glad_trace_post(362);
+}
+static PFNGLMULTITEXCOORD2IVPROC glad_trace_next_glMultiTexCoord2iv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	glad_trace_pre(363); glad_trace_next_glMultiTexCoord2iv(target, v); glad_trace_post(363);
+}
+static PFNGLMULTITEXCOORD2SPROC glad_trace_next_glMultiTexCoord2s = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	glad_trace_pre(364); glad_trace_next_glMultiTexCoord2s(target, s, t); glad_trace_post(364);
+}
+static PFNGLMULTITEXCOORD2SVPROC glad_trace_next_glMultiTexCoord2sv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	glad_trace_pre(365); glad_trace_next_glMultiTexCoord2sv(target, v); glad_trace_post(365);
+}
+static PFNGLMULTITEXCOORD3DPROC glad_trace_next_glMultiTexCoord3d = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	glad_trace_pre(366); glad_trace_next_glMultiTexCoord3d(target, s, t, r); glad_trace_post(366);
+}
+static PFNGLMULTITEXCOORD3DVPROC glad_trace_next_glMultiTexCoord3dv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	glad_trace_pre(367); glad_trace_next_glMultiTexCoord3dv(target, v); glad_trace_post(367);
+}
+static PFNGLMULTITEXCOORD3FPROC glad_trace_next_glMultiTexCoord3f = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	glad_trace_pre(368); glad_trace_next_glMultiTexCoord3f(target, s, t, r); glad_trace_post(368);
+}
+static PFNGLMULTITEXCOORD3FVPROC glad_trace_next_glMultiTexCoord3fv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	glad_trace_pre(369); glad_trace_next_glMultiTexCoord3fv(target, v); glad_trace_post(369);
+}
+static PFNGLMULTITEXCOORD3IPROC glad_trace_next_glMultiTexCoord3i = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	glad_trace_pre(370); glad_trace_next_glMultiTexCoord3i(target, s, t, r); glad_trace_post(370);
+}
+static PFNGLMULTITEXCOORD3IVPROC glad_trace_next_glMultiTexCoord3iv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	glad_trace_pre(371); glad_trace_next_glMultiTexCoord3iv(target, v); glad_trace_post(371);
+}
+static PFNGLMULTITEXCOORD3SPROC glad_trace_next_glMultiTexCoord3s = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	glad_trace_pre(372); glad_trace_next_glMultiTexCoord3s(target, s, t, r); glad_trace_post(372);
+}
+static PFNGLMULTITEXCOORD3SVPROC glad_trace_next_glMultiTexCoord3sv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	glad_trace_pre(373); glad_trace_next_glMultiTexCoord3sv(target, v); glad_trace_post(373);
+}
+static PFNGLMULTITEXCOORD4DPROC glad_trace_next_glMultiTexCoord4d = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_trace_pre(374); glad_trace_next_glMultiTexCoord4d(target, s, t, r, q); glad_trace_post(374);
+}
+static PFNGLMULTITEXCOORD4DVPROC glad_trace_next_glMultiTexCoord4dv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	glad_trace_pre(375); glad_trace_next_glMultiTexCoord4dv(target, v); glad_trace_post(375);
+}
+static PFNGLMULTITEXCOORD4FPROC glad_trace_next_glMultiTexCoord4f = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_trace_pre(376); glad_trace_next_glMultiTexCoord4f(target, s, t, r, q); glad_trace_post(376);
+}
+static PFNGLMULTITEXCOORD4FVPROC glad_trace_next_glMultiTexCoord4fv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	glad_trace_pre(377); glad_trace_next_glMultiTexCoord4fv(target, v); glad_trace_post(377);
+}
+static PFNGLMULTITEXCOORD4IPROC glad_trace_next_glMultiTexCoord4i = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	glad_trace_pre(378); glad_trace_next_glMultiTexCoord4i(target, s, t, r, q); glad_trace_post(378);
+}
+static PFNGLMULTITEXCOORD4IVPROC glad_trace_next_glMultiTexCoord4iv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	glad_trace_pre(379); glad_trace_next_glMultiTexCoord4iv(target, v); glad_trace_post(379);
+}
+static PFNGLMULTITEXCOORD4SPROC glad_trace_next_glMultiTexCoord4s = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_trace_pre(380); glad_trace_next_glMultiTexCoord4s(target, s, t, r, q); glad_trace_post(380);
+}
+static PFNGLMULTITEXCOORD4SVPROC glad_trace_next_glMultiTexCoord4sv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	glad_trace_pre(381); glad_trace_next_glMultiTexCoord4sv(target, v); glad_trace_post(381);
+}
+static PFNGLLOADTRANSPOSEMATRIXFPROC glad_trace_next_glLoadTransposeMatrixf = NULL;
+static void APIENTRY glad_trace_glLoadTransposeMatrixf(const GLfloat *m) {
+	glad_trace_pre(382); glad_trace_next_glLoadTransposeMatrixf(m); glad_trace_post(382);
+}
+static PFNGLLOADTRANSPOSEMATRIXDPROC glad_trace_next_glLoadTransposeMatrixd = NULL;
+static void APIENTRY glad_trace_glLoadTransposeMatrixd(const GLdouble *m) {
+	glad_trace_pre(383); glad_trace_next_glLoadTransposeMatrixd(m); glad_trace_post(383);
+}
+static PFNGLMULTTRANSPOSEMATRIXFPROC glad_trace_next_glMultTransposeMatrixf = NULL;
+static void APIENTRY glad_trace_glMultTransposeMatrixf(const GLfloat *m) {
+	glad_trace_pre(384); glad_trace_next_glMultTransposeMatrixf(m); glad_trace_post(384);
+}
+static PFNGLMULTTRANSPOSEMATRIXDPROC glad_trace_next_glMultTransposeMatrixd = NULL;
+static void APIENTRY glad_trace_glMultTransposeMatrixd(const GLdouble *m) {
+	glad_trace_pre(385); glad_trace_next_glMultTransposeMatrixd(m); glad_trace_post(385);
+}
+static PFNGLBLENDFUNCSEPARATEPROC glad_trace_next_glBlendFuncSeparate = NULL;
+static void APIENTRY glad_trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_trace_pre(386); glad_trace_next_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); glad_trace_post(386);
+}
+static PFNGLMULTIDRAWARRAYSPROC glad_trace_next_glMultiDrawArrays = NULL;
+static void APIENTRY glad_trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_trace_pre(387); glad_trace_next_glMultiDrawArrays(mode, first, count, drawcount); glad_trace_post(387);
+}
+static PFNGLMULTIDRAWELEMENTSPROC glad_trace_next_glMultiDrawElements = NULL;
+static void APIENTRY glad_trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_trace_pre(388); glad_trace_next_glMultiDrawElements(mode, count, type, indices, drawcount); glad_trace_post(388);
+}
+static PFNGLPOINTPARAMETERFPROC glad_trace_next_glPointParameterf = NULL;
+static void APIENTRY glad_trace_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_trace_pre(389); glad_trace_next_glPointParameterf(pname, param); glad_trace_post(389);
+}
+static PFNGLPOINTPARAMETERFVPROC glad_trace_next_glPointParameterfv = NULL;
+static void APIENTRY glad_trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_trace_pre(390); glad_trace_next_glPointParameterfv(pname, params); glad_trace_post(390);
+}
+static PFNGLPOINTPARAMETERIPROC glad_trace_next_glPointParameteri = NULL;
+static void APIENTRY glad_trace_glPointParameteri(GLenum pname, GLint param) {
+	glad_trace_pre(391); glad_trace_next_glPointParameteri(pname, param); glad_trace_post(391);
+}
+static PFNGLPOINTPARAMETERIVPROC glad_trace_next_glPointParameteriv = NULL;
+static void APIENTRY glad_trace_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_trace_pre(392); glad_trace_next_glPointParameteriv(pname, params); glad_trace_post(392);
+}
+static PFNGLFOGCOORDFPROC glad_trace_next_glFogCoordf = NULL;
+static void APIENTRY glad_trace_glFogCoordf(GLfloat coord) {
+	glad_trace_pre(393); glad_trace_next_glFogCoordf(coord); glad_trace_post(393);
+}
+static PFNGLFOGCOORDFVPROC glad_trace_next_glFogCoordfv = NULL;
+static void APIENTRY glad_trace_glFogCoordfv(const GLfloat *coord) {
+	glad_trace_pre(394); glad_trace_next_glFogCoordfv(coord); glad_trace_post(394);
+}
+static PFNGLFOGCOORDDPROC glad_trace_next_glFogCoordd = NULL;
+static void APIENTRY glad_trace_glFogCoordd(GLdouble coord) {
+	glad_trace_pre(395); glad_trace_next_glFogCoordd(coord); glad_trace_post(395);
+}
+static PFNGLFOGCOORDDVPROC glad_trace_next_glFogCoorddv = NULL;
+static void APIENTRY glad_trace_glFogCoorddv(const GLdouble *coord) {
+	glad_trace_pre(396); glad_trace_next_glFogCoorddv(coord); glad_trace_post(396);
+}
+static PFNGLFOGCOORDPOINTERPROC glad_trace_next_glFogCoordPointer = NULL;
+static void APIENTRY glad_trace_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(397); glad_trace_next_glFogCoordPointer(type, stride, pointer); glad_trace_post(397);
+}
+static PFNGLSECONDARYCOLOR3BPROC glad_trace_next_glSecondaryColor3b = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_trace_pre(398); glad_trace_next_glSecondaryColor3b(red, green, blue); glad_trace_post(398);
+}
+static PFNGLSECONDARYCOLOR3BVPROC glad_trace_next_glSecondaryColor3bv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3bv(const GLbyte *v) {
+	glad_trace_pre(399); glad_trace_next_glSecondaryColor3bv(v); glad_trace_post(399);
+}
+static PFNGLSECONDARYCOLOR3DPROC glad_trace_next_glSecondaryColor3d = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_trace_pre(400); glad_trace_next_glSecondaryColor3d(red, green, blue); glad_trace_post(400);
+}
+static PFNGLSECONDARYCOLOR3DVPROC glad_trace_next_glSecondaryColor3dv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3dv(const GLdouble *v) {
+	glad_trace_pre(401); glad_trace_next_glSecondaryColor3dv(v); glad_trace_post(401);
+}
+static PFNGLSECONDARYCOLOR3FPROC glad_trace_next_glSecondaryColor3f = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_trace_pre(402); glad_trace_next_glSecondaryColor3f(red, green, blue); glad_trace_post(402);
+}
+static PFNGLSECONDARYCOLOR3FVPROC glad_trace_next_glSecondaryColor3fv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3fv(const GLfloat *v) {
+	glad_trace_pre(403); glad_trace_next_glSecondaryColor3fv(v); glad_trace_post(403);
+}
+static PFNGLSECONDARYCOLOR3IPROC glad_trace_next_glSecondaryColor3i = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	glad_trace_pre(404); glad_trace_next_glSecondaryColor3i(red, green, blue); glad_trace_post(404);
+}
+static PFNGLSECONDARYCOLOR3IVPROC glad_trace_next_glSecondaryColor3iv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3iv(const GLint *v) {
+	glad_trace_pre(405); glad_trace_next_glSecondaryColor3iv(v); glad_trace_post(405);
+}
+static PFNGLSECONDARYCOLOR3SPROC glad_trace_next_glSecondaryColor3s = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_trace_pre(406); glad_trace_next_glSecondaryColor3s(red, green, blue); glad_trace_post(406);
+}
+static PFNGLSECONDARYCOLOR3SVPROC glad_trace_next_glSecondaryColor3sv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3sv(const GLshort *v) {
+	glad_trace_pre(407); glad_trace_next_glSecondaryColor3sv(v); glad_trace_post(407);
+}
+static PFNGLSECONDARYCOLOR3UBPROC glad_trace_next_glSecondaryColor3ub = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_trace_pre(408); glad_trace_next_glSecondaryColor3ub(red, green, blue); glad_trace_post(408);
+}
+static PFNGLSECONDARYCOLOR3UBVPROC glad_trace_next_glSecondaryColor3ubv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3ubv(const GLubyte *v) {
+	glad_trace_pre(409); glad_trace_next_glSecondaryColor3ubv(v); glad_trace_post(409);
+}
+static PFNGLSECONDARYCOLOR3UIPROC glad_trace_next_glSecondaryColor3ui = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_trace_pre(410); glad_trace_next_glSecondaryColor3ui(red, green, blue); glad_trace_post(410);
+}
+static PFNGLSECONDARYCOLOR3UIVPROC glad_trace_next_glSecondaryColor3uiv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3uiv(const GLuint *v) {
+	glad_trace_pre(411); glad_trace_next_glSecondaryColor3uiv(v); glad_trace_post(411);
+}
+static PFNGLSECONDARYCOLOR3USPROC glad_trace_next_glSecondaryColor3us = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_trace_pre(412); glad_trace_next_glSecondaryColor3us(red, green, blue); glad_trace_post(412);
+}
+static PFNGLSECONDARYCOLOR3USVPROC glad_trace_next_glSecondaryColor3usv = NULL;
+static void APIENTRY glad_trace_glSecondaryColor3usv(const GLushort *v) {
+	glad_trace_pre(413); glad_trace_next_glSecondaryColor3usv(v); glad_trace_post(413);
+}
+static PFNGLSECONDARYCOLORPOINTERPROC glad_trace_next_glSecondaryColorPointer = NULL;
+static void APIENTRY glad_trace_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(414); glad_trace_next_glSecondaryColorPointer(size, type, stride, pointer); glad_trace_post(414);
+}
+static PFNGLWINDOWPOS2DPROC glad_trace_next_glWindowPos2d = NULL;
+static void APIENTRY glad_trace_glWindowPos2d(GLdouble x, GLdouble y) {
+	glad_trace_pre(415); glad_trace_next_glWindowPos2d(x, y); glad_trace_post(415);
+}
+static PFNGLWINDOWPOS2DVPROC glad_trace_next_glWindowPos2dv = NULL;
+static void APIENTRY glad_trace_glWindowPos2dv(const GLdouble *v) {
+	glad_trace_pre(416); glad_trace_next_glWindowPos2dv(v); glad_trace_post(416);
+}
+static PFNGLWINDOWPOS2FPROC glad_trace_next_glWindowPos2f = NULL;
+static void APIENTRY glad_trace_glWindowPos2f(GLfloat x, GLfloat y) {
+	glad_trace_pre(417); glad_trace_next_glWindowPos2f(x, y); glad_trace_post(417);
+}
+static PFNGLWINDOWPOS2FVPROC glad_trace_next_glWindowPos2fv = NULL;
+static void APIENTRY glad_trace_glWindowPos2fv(const GLfloat *v) {
+	glad_trace_pre(418); glad_trace_next_glWindowPos2fv(v); glad_trace_post(418);
+}
+static PFNGLWINDOWPOS2IPROC glad_trace_next_glWindowPos2i = NULL;
+static void APIENTRY glad_trace_glWindowPos2i(GLint x, GLint y) {
+	glad_trace_pre(419); glad_trace_next_glWindowPos2i(x, y); glad_trace_post(419);
+}
+static PFNGLWINDOWPOS2IVPROC glad_trace_next_glWindowPos2iv = NULL;
+static void APIENTRY glad_trace_glWindowPos2iv(const GLint *v) {
+	glad_trace_pre(420); glad_trace_next_glWindowPos2iv(v); glad_trace_post(420);
+}
+static PFNGLWINDOWPOS2SPROC glad_trace_next_glWindowPos2s = NULL;
+static void APIENTRY glad_trace_glWindowPos2s(GLshort x, GLshort y) {
+	glad_trace_pre(421); glad_trace_next_glWindowPos2s(x, y); glad_trace_post(421);
+}
+static PFNGLWINDOWPOS2SVPROC glad_trace_next_glWindowPos2sv = NULL;
+static void APIENTRY glad_trace_glWindowPos2sv(const GLshort *v) {
+	glad_trace_pre(422); glad_trace_next_glWindowPos2sv(v); glad_trace_post(422);
+}
+static PFNGLWINDOWPOS3DPROC glad_trace_next_glWindowPos3d = NULL;
+static void APIENTRY glad_trace_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_pre(423); glad_trace_next_glWindowPos3d(x, y, z); glad_trace_post(423);
+}
+static PFNGLWINDOWPOS3DVPROC glad_trace_next_glWindowPos3dv = NULL;
+static void APIENTRY glad_trace_glWindowPos3dv(const GLdouble *v) {
+	glad_trace_pre(424); glad_trace_next_glWindowPos3dv(v); glad_trace_post(424);
+}
+static PFNGLWINDOWPOS3FPROC glad_trace_next_glWindowPos3f = NULL;
+static void APIENTRY glad_trace_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_pre(425); glad_trace_next_glWindowPos3f(x, y, z); glad_trace_post(425);
+}
+static PFNGLWINDOWPOS3FVPROC glad_trace_next_glWindowPos3fv = NULL;
+static void APIENTRY glad_trace_glWindowPos3fv(const GLfloat *v) {
+	glad_trace_pre(426); glad_trace_next_glWindowPos3fv(v); glad_trace_post(426);
+}
+static PFNGLWINDOWPOS3IPROC glad_trace_next_glWindowPos3i = NULL;
+static void APIENTRY glad_trace_glWindowPos3i(GLint x, GLint y, GLint z) {
+	glad_trace_pre(427); glad_trace_next_glWindowPos3i(x, y, z); glad_trace_post(427);
+}
+static PFNGLWINDOWPOS3IVPROC glad_trace_next_glWindowPos3iv = NULL;
+static void APIENTRY glad_trace_glWindowPos3iv(const GLint *v) {
+	glad_trace_pre(428); glad_trace_next_glWindowPos3iv(v); glad_trace_post(428);
+}
+static PFNGLWINDOWPOS3SPROC glad_trace_next_glWindowPos3s = NULL;
+static void APIENTRY glad_trace_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_trace_pre(429); glad_trace_next_glWindowPos3s(x, y, z); glad_trace_post(429);
+}
+static PFNGLWINDOWPOS3SVPROC glad_trace_next_glWindowPos3sv = NULL;
+static void APIENTRY glad_trace_glWindowPos3sv(const GLshort *v) {
+	glad_trace_pre(430); glad_trace_next_glWindowPos3sv(v); glad_trace_post(430);
+}
+static PFNGLBLENDCOLORPROC glad_trace_next_glBlendColor = NULL;
+static void APIENTRY glad_trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_trace_pre(431); glad_trace_next_glBlendColor(red, green, blue, alpha); glad_trace_post(431);
+}
+static PFNGLBLENDEQUATIONPROC glad_trace_next_glBlendEquation = NULL;
+static void APIENTRY glad_trace_glBlendEquation(GLenum mode) {
+	glad_trace_pre(432); glad_trace_next_glBlendEquation(mode); glad_trace_post(432);
+}
+static PFNGLGENQUERIESPROC glad_trace_next_glGenQueries = NULL;
+static void APIENTRY glad_trace_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_trace_pre(433); glad_trace_next_glGenQueries(n, ids); glad_trace_post(433);
+}
+static PFNGLDELETEQUERIESPROC glad_trace_next_glDeleteQueries = NULL;
+static void APIENTRY glad_trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_trace_pre(434); glad_trace_next_glDeleteQueries(n, ids); glad_trace_post(434);
+}
+static PFNGLISQUERYPROC glad_trace_next_glIsQuery = NULL;
+static GLboolean APIENTRY glad_trace_glIsQuery(GLuint id) {
+	GLboolean result; glad_trace_pre(435); result = glad_trace_next_glIsQuery(id); glad_trace_post(435); return result;
+}
+static PFNGLBEGINQUERYPROC glad_trace_next_glBeginQuery = NULL;
+static void APIENTRY glad_trace_glBeginQuery(GLenum target, GLuint id) {
+	glad_trace_pre(436); glad_trace_next_glBeginQuery(target, id); glad_trace_post(436);
+}
+static PFNGLENDQUERYPROC glad_trace_next_glEndQuery = NULL;
+static void APIENTRY glad_trace_glEndQuery(GLenum target) {
+	glad_trace_pre(437); glad_trace_next_glEndQuery(target); glad_trace_post(437);
+}
+static PFNGLGETQUERYIVPROC glad_trace_next_glGetQueryiv = NULL;
+static void APIENTRY glad_trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_trace_pre(438); glad_trace_next_glGetQueryiv(target, pname, params); glad_trace_post(438);
+}
+static PFNGLGETQUERYOBJECTIVPROC glad_trace_next_glGetQueryObjectiv = NULL;
+static void APIENTRY glad_trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_trace_pre(439); glad_trace_next_glGetQueryObjectiv(id, pname, params); glad_trace_post(439);
+}
+static PFNGLGETQUERYOBJECTUIVPROC glad_trace_next_glGetQueryObjectuiv = NULL;
+static void APIENTRY glad_trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_trace_pre(440); glad_trace_next_glGetQueryObjectuiv(id, pname, params); glad_trace_post(440);
+}
+static PFNGLBINDBUFFERPROC glad_trace_next_glBindBuffer = NULL;
+static void APIENTRY glad_trace_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_trace_pre(441); glad_trace_next_glBindBuffer(target, buffer); glad_trace_post(441);
+}
+static PFNGLDELETEBUFFERSPROC glad_trace_next_glDeleteBuffers = NULL;
+static void APIENTRY glad_trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_trace_pre(442); glad_trace_next_glDeleteBuffers(n, buffers); glad_trace_post(442);
+}
+static PFNGLGENBUFFERSPROC glad_trace_next_glGenBuffers = NULL;
+static void APIENTRY glad_trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_trace_pre(443); glad_trace_next_glGenBuffers(n, buffers); glad_trace_post(443);
+}
+static PFNGLISBUFFERPROC glad_trace_next_glIsBuffer = NULL;
+static GLboolean APIENTRY glad_trace_glIsBuffer(GLuint buffer) {
+	GLboolean result; glad_trace_pre(444); result = glad_trace_next_glIsBuffer(buffer); glad_trace_post(444); return result;
+}
+static PFNGLBUFFERDATAPROC glad_trace_next_glBufferData = NULL;
+static void APIENTRY glad_trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_trace_pre(445); glad_trace_next_glBufferData(target, size, data, usage); glad_trace_post(445);
+}
+static PFNGLBUFFERSUBDATAPROC glad_trace_next_glBufferSubData = NULL;
+static void APIENTRY glad_trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_trace_pre(446); glad_trace_next_glBufferSubData(target, offset, size, data); glad_trace_post(446);
+}
+static PFNGLGETBUFFERSUBDATAPROC glad_trace_next_glGetBufferSubData = NULL;
+static void APIENTRY glad_trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_trace_pre(447); glad_trace_next_glGetBufferSubData(target, offset, size, data); glad_trace_post(447);
+}
+static PFNGLMAPBUFFERPROC glad_trace_next_glMapBuffer = NULL;
+static void * APIENTRY glad_trace_glMapBuffer(GLenum target, GLenum access) {
+	void * result; glad_trace_pre(448); result = glad_trace_next_glMapBuffer(target, access); glad_trace_post(448); return result;
+}
+static PFNGLUNMAPBUFFERPROC glad_trace_next_glUnmapBuffer = NULL;
+static GLboolean APIENTRY glad_trace_glUnmapBuffer(GLenum target) {
+	GLboolean result; glad_trace_pre(449); result = glad_trace_next_glUnmapBuffer(target); glad_trace_post(449); return result;
+}
+static PFNGLGETBUFFERPARAMETERIVPROC glad_trace_next_glGetBufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_trace_pre(450); glad_trace_next_glGetBufferParameteriv(target, pname, params); glad_trace_post(450);
+}
+static PFNGLGETBUFFERPOINTERVPROC glad_trace_next_glGetBufferPointerv = NULL;
+static void APIENTRY glad_trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_trace_pre(451); glad_trace_next_glGetBufferPointerv(target, pname, params); glad_trace_post(451);
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_trace_next_glBlendEquationSeparate = NULL;
+static void APIENTRY glad_trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_trace_pre(452); glad_trace_next_glBlendEquationSeparate(modeRGB, modeAlpha); glad_trace_post(452);
+}
+static PFNGLDRAWBUFFERSPROC glad_trace_next_glDrawBuffers = NULL;
+static void APIENTRY glad_trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_trace_pre(453); glad_trace_next_glDrawBuffers(n, bufs); glad_trace_post(453);
+}
+static PFNGLSTENCILOPSEPARATEPROC glad_trace_next_glStencilOpSeparate = NULL;
+static void APIENTRY glad_trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_trace_pre(454); glad_trace_next_glStencilOpSeparate(face, sfail, dpfail, dppass); glad_trace_post(454);
+}
+static PFNGLSTENCILFUNCSEPARATEPROC glad_trace_next_glStencilFuncSeparate = NULL;
+static void APIENTRY glad_trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_trace_pre(455); glad_trace_next_glStencilFuncSeparate(face, func, ref, mask); glad_trace_post(455);
+}
+static PFNGLSTENCILMASKSEPARATEPROC glad_trace_next_glStencilMaskSeparate = NULL;
+static void APIENTRY glad_trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_trace_pre(456); glad_trace_next_glStencilMaskSeparate(face, mask); glad_trace_post(456);
+}
+static PFNGLATTACHSHADERPROC glad_trace_next_glAttachShader = NULL;
+static void APIENTRY glad_trace_glAttachShader(GLuint program, GLuint shader) {
+	glad_trace_pre(457); glad_trace_next_glAttachShader(program, shader); glad_trace_post(457);
+}
+static PFNGLBINDATTRIBLOCATIONPROC glad_trace_next_glBindAttribLocation = NULL;
+static void APIENTRY glad_trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_trace_pre(458); glad_trace_next_glBindAttribLocation(program, index, name); glad_trace_post(458);
+}
+static PFNGLCOMPILESHADERPROC glad_trace_next_glCompileShader = NULL;
+static void APIENTRY glad_trace_glCompileShader(GLuint shader) {
+	glad_trace_pre(459); glad_trace_next_glCompileShader(shader); glad_trace_post(459);
+}
+static PFNGLCREATEPROGRAMPROC glad_trace_next_glCreateProgram = NULL;
+static GLuint APIENTRY glad_trace_glCreateProgram(void) {
+	GLuint result; glad_trace_pre(460); result = glad_trace_next_glCreateProgram(); glad_trace_post(460); return result;
+}
+static PFNGLCREATESHADERPROC glad_trace_next_glCreateShader = NULL;
+static GLuint APIENTRY glad_trace_glCreateShader(GLenum type) {
+	GLuint result; glad_trace_pre(461); result = glad_trace_next_glCreateShader(type); glad_trace_post(461); return result;
+}
+static PFNGLDELETEPROGRAMPROC glad_trace_next_glDeleteProgram = NULL;
+static void APIENTRY glad_trace_glDeleteProgram(GLuint program) {
+	glad_trace_pre(462); glad_trace_next_glDeleteProgram(program); glad_trace_post(462);
+}
+static PFNGLDELETESHADERPROC glad_trace_next_glDeleteShader = NULL;
+static void APIENTRY glad_trace_glDeleteShader(GLuint shader) {
+	glad_trace_pre(463); glad_trace_next_glDeleteShader(shader); glad_trace_post(463);
+}
+static PFNGLDETACHSHADERPROC glad_trace_next_glDetachShader = NULL;
+static void APIENTRY glad_trace_glDetachShader(GLuint program, GLuint shader) {
+	glad_trace_pre(464); glad_trace_next_glDetachShader(program, shader); glad_trace_post(464);
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_trace_next_glDisableVertexAttribArray = NULL;
+static void APIENTRY glad_trace_glDisableVertexAttribArray(GLuint index) {
+	glad_trace_pre(465); glad_trace_next_glDisableVertexAttribArray(index); glad_trace_post(465);
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_trace_next_glEnableVertexAttribArray = NULL;
+static void APIENTRY glad_trace_glEnableVertexAttribArray(GLuint index) {
+	glad_trace_pre(466); glad_trace_next_glEnableVertexAttribArray(index); glad_trace_post(466);
+}
+static PFNGLGETACTIVEATTRIBPROC glad_trace_next_glGetActiveAttrib = NULL;
+static void APIENTRY glad_trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_trace_pre(467); glad_trace_next_glGetActiveAttrib(program, index, bufSize, length, size, type, name); glad_trace_post(467);
+}
+static PFNGLGETACTIVEUNIFORMPROC glad_trace_next_glGetActiveUniform = NULL;
+static void APIENTRY glad_trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_trace_pre(468); glad_trace_next_glGetActiveUniform(program, index, bufSize, length, size, type, name); glad_trace_post(468);
+}
+static PFNGLGETATTACHEDSHADERSPROC glad_trace_next_glGetAttachedShaders = NULL;
+static void APIENTRY glad_trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_trace_pre(469); glad_trace_next_glGetAttachedShaders(program, maxCount, count, shaders); glad_trace_post(469);
+}
+static PFNGLGETATTRIBLOCATIONPROC glad_trace_next_glGetAttribLocation = NULL;
+static GLint APIENTRY glad_trace_glGetAttribLocation(GLuint program, const GLchar *name) {
+	GLint result; glad_trace_pre(470); result = glad_trace_next_glGetAttribLocation(program, name); glad_trace_post(470); return result;
+}
+static PFNGLGETPROGRAMIVPROC glad_trace_next_glGetProgramiv = NULL;
+static void APIENTRY glad_trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_trace_pre(471); glad_trace_next_glGetProgramiv(program, pname, params); glad_trace_post(471);
+}
+static PFNGLGETPROGRAMINFOLOGPROC glad_trace_next_glGetProgramInfoLog = NULL;
+static void APIENTRY glad_trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_trace_pre(472); glad_trace_next_glGetProgramInfoLog(program, bufSize, length, infoLog); glad_trace_post(472);
+}
+static PFNGLGETSHADERIVPROC glad_trace_next_glGetShaderiv = NULL;
+static void APIENTRY glad_trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_trace_pre(473); glad_trace_next_glGetShaderiv(shader, pname, params); glad_trace_post(473);
+}
+static PFNGLGETSHADERINFOLOGPROC glad_trace_next_glGetShaderInfoLog = NULL;
+static void APIENTRY glad_trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_trace_pre(474); glad_trace_next_glGetShaderInfoLog(shader, bufSize, length, infoLog); glad_trace_post(474);
+}
+static PFNGLGETSHADERSOURCEPROC glad_trace_next_glGetShaderSource = NULL;
+static void APIENTRY glad_trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_trace_pre(475); glad_trace_next_glGetShaderSource(shader, bufSize, length, source); glad_trace_post(475);
+}
+static PFNGLGETUNIFORMLOCATIONPROC glad_trace_next_glGetUniformLocation = NULL;
+static GLint APIENTRY glad_trace_glGetUniformLocation(GLuint program, const GLchar *name) {
+	GLint result; glad_trace_pre(476); result = glad_trace_next_glGetUniformLocation(program, name); glad_trace_post(476); return result;
+}
+static PFNGLGETUNIFORMFVPROC glad_trace_next_glGetUniformfv = NULL;
+static void APIENTRY glad_trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_trace_pre(477); glad_trace_next_glGetUniformfv(program, location, params); glad_trace_post(477);
+}
+static PFNGLGETUNIFORMIVPROC glad_trace_next_glGetUniformiv = NULL;
+static void APIENTRY glad_trace_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_trace_pre(478); glad_trace_next_glGetUniformiv(program, location, params); glad_trace_post(478);
+}
+static PFNGLGETVERTEXATTRIBDVPROC glad_trace_next_glGetVertexAttribdv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_trace_pre(479); glad_trace_next_glGetVertexAttribdv(index, pname, params); glad_trace_post(479);
+}
+static PFNGLGETVERTEXATTRIBFVPROC glad_trace_next_glGetVertexAttribfv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_trace_pre(480); glad_trace_next_glGetVertexAttribfv(index, pname, params); glad_trace_post(480);
+}
+static PFNGLGETVERTEXATTRIBIVPROC glad_trace_next_glGetVertexAttribiv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_trace_pre(481); glad_trace_next_glGetVertexAttribiv(index, pname, params); glad_trace_post(481);
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_trace_next_glGetVertexAttribPointerv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_trace_pre(482); glad_trace_next_glGetVertexAttribPointerv(index, pname, pointer); glad_trace_post(482);
+}
+static PFNGLISPROGRAMPROC glad_trace_next_glIsProgram = NULL;
+static GLboolean APIENTRY glad_trace_glIsProgram(GLuint program) {
+	GLboolean result; glad_trace_pre(483); result = glad_trace_next_glIsProgram(program); glad_trace_post(483); return result;
+}
+static PFNGLISSHADERPROC glad_trace_next_glIsShader = NULL;
+static GLboolean APIENTRY glad_trace_glIsShader(GLuint shader) {
+	GLboolean result; glad_trace_pre(484); result = glad_trace_next_glIsShader(shader); glad_trace_post(484); return result;
+}
+static PFNGLLINKPROGRAMPROC glad_trace_next_glLinkProgram = NULL;
+static void APIENTRY glad_trace_glLinkProgram(GLuint program) {
+	glad_trace_pre(485); glad_trace_next_glLinkProgram(program); glad_trace_post(485);
+}
+static PFNGLSHADERSOURCEPROC glad_trace_next_glShaderSource = NULL;
+static void APIENTRY glad_trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_trace_pre(486); glad_trace_next_glShaderSource(shader, count, string, length); glad_trace_post(486);
+}
+static PFNGLUSEPROGRAMPROC glad_trace_next_glUseProgram = NULL;
+static void APIENTRY glad_trace_glUseProgram(GLuint program) {
+	glad_trace_pre(487); glad_trace_next_glUseProgram(program); glad_trace_post(487);
+}
+static PFNGLUNIFORM1FPROC glad_trace_next_glUniform1f = NULL;
+static void APIENTRY glad_trace_glUniform1f(GLint location, GLfloat v0) {
+	glad_trace_pre(488); glad_trace_next_glUniform1f(location, v0); glad_trace_post(488);
+}
+static PFNGLUNIFORM2FPROC glad_trace_next_glUniform2f = NULL;
+static void APIENTRY glad_trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_trace_pre(489); glad_trace_next_glUniform2f(location, v0, v1); glad_trace_post(489);
+}
+static PFNGLUNIFORM3FPROC glad_trace_next_glUniform3f = NULL;
+static void APIENTRY glad_trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_trace_pre(490); glad_trace_next_glUniform3f(location, v0, v1, v2); glad_trace_post(490);
+}
+static PFNGLUNIFORM4FPROC glad_trace_next_glUniform4f = NULL;
+static void APIENTRY glad_trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_trace_pre(491); glad_trace_next_glUniform4f(location, v0, v1, v2, v3); glad_trace_post(491);
+}
+static PFNGLUNIFORM1IPROC glad_trace_next_glUniform1i = NULL;
+static void APIENTRY glad_trace_glUniform1i(GLint location, GLint v0) {
+	glad_trace_pre(492); glad_trace_next_glUniform1i(location, v0); glad_trace_post(492);
+}
+static PFNGLUNIFORM2IPROC glad_trace_next_glUniform2i = NULL;
+static void APIENTRY glad_trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_trace_pre(493); glad_trace_next_glUniform2i(location, v0, v1); glad_trace_post(493);
+}
+static PFNGLUNIFORM3IPROC glad_trace_next_glUniform3i = NULL;
+static void APIENTRY glad_trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_trace_pre(494); glad_trace_next_glUniform3i(location, v0, v1, v2); glad_trace_post(494);
+}
+static PFNGLUNIFORM4IPROC glad_trace_next_glUniform4i = NULL;
+static void APIENTRY glad_trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_trace_pre(495); glad_trace_next_glUniform4i(location, v0, v1, v2, v3); glad_trace_post(495);
+}
+static PFNGLUNIFORM1FVPROC glad_trace_next_glUniform1fv = NULL;
+static void APIENTRY glad_trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_pre(496); glad_trace_next_glUniform1fv(location, count, value); glad_trace_post(496);
+}
+static PFNGLUNIFORM2FVPROC glad_trace_next_glUniform2fv = NULL;
+static void APIENTRY glad_trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_pre(497); glad_trace_next_glUniform2fv(location, count, value); glad_trace_post(497);
+}
+static PFNGLUNIFORM3FVPROC glad_trace_next_glUniform3fv = NULL;
+static void APIENTRY glad_trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_pre(498); glad_trace_next_glUniform3fv(location, count, value); glad_trace_post(498);
+}
+static PFNGLUNIFORM4FVPROC glad_trace_next_glUniform4fv = NULL;
+static void APIENTRY glad_trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_pre(499); glad_trace_next_glUniform4fv(location, count, value); glad_trace_post(499);
+}
+static PFNGLUNIFORM1IVPROC glad_trace_next_glUniform1iv = NULL;
+static void APIENTRY glad_trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_pre(500); glad_trace_next_glUniform1iv(location, count, value); glad_trace_post(500);
+}
+static PFNGLUNIFORM2IVPROC glad_trace_next_glUniform2iv = NULL;
+static void APIENTRY glad_trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_pre(501); glad_trace_next_glUniform2iv(location, count, value); glad_trace_post(501);
+}
+static PFNGLUNIFORM3IVPROC glad_trace_next_glUniform3iv = NULL;
+static void APIENTRY glad_trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_pre(502); glad_trace_next_glUniform3iv(location, count, value); glad_trace_post(502);
+}
+static PFNGLUNIFORM4IVPROC glad_trace_next_glUniform4iv = NULL;
+static void APIENTRY glad_trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_pre(503); glad_trace_next_glUniform4iv(location, count, value); glad_trace_post(503);
+}
+static PFNGLUNIFORMMATRIX2FVPROC glad_trace_next_glUniformMatrix2fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(504); glad_trace_next_glUniformMatrix2fv(location, count, transpose, value); glad_trace_post(504);
+}
+static PFNGLUNIFORMMATRIX3FVPROC glad_trace_next_glUniformMatrix3fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(505); glad_trace_next_glUniformMatrix3fv(location, count, transpose, value); glad_trace_post(505);
+}
+static PFNGLUNIFORMMATRIX4FVPROC glad_trace_next_glUniformMatrix4fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(506); glad_trace_next_glUniformMatrix4fv(location, count, transpose, value); glad_trace_post(506);
+}
+static PFNGLVALIDATEPROGRAMPROC glad_trace_next_glValidateProgram = NULL;
+static void APIENTRY glad_trace_glValidateProgram(GLuint program) {
+	glad_trace_pre(507); glad_trace_next_glValidateProgram(program); glad_trace_post(507);
+}
+static PFNGLVERTEXATTRIB1DPROC glad_trace_next_glVertexAttrib1d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_trace_pre(508); glad_trace_next_glVertexAttrib1d(index, x); glad_trace_post(508);
+}
+static PFNGLVERTEXATTRIB1DVPROC glad_trace_next_glVertexAttrib1dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_trace_pre(509); glad_trace_next_glVertexAttrib1dv(index, v); glad_trace_post(509);
+}
+static PFNGLVERTEXATTRIB1FPROC glad_trace_next_glVertexAttrib1f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_trace_pre(510); glad_trace_next_glVertexAttrib1f(index, x); glad_trace_post(510);
+}
+static PFNGLVERTEXATTRIB1FVPROC glad_trace_next_glVertexAttrib1fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_trace_pre(511); glad_trace_next_glVertexAttrib1fv(index, v); glad_trace_post(511);
+}
+static PFNGLVERTEXATTRIB1SPROC glad_trace_next_glVertexAttrib1s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_trace_pre(512); glad_trace_next_glVertexAttrib1s(index, x); glad_trace_post(512);
+}
+static PFNGLVERTEXATTRIB1SVPROC glad_trace_next_glVertexAttrib1sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_trace_pre(513); glad_trace_next_glVertexAttrib1sv(index, v); glad_trace_post(513);
+}
+static PFNGLVERTEXATTRIB2DPROC glad_trace_next_glVertexAttrib2d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_trace_pre(514); glad_trace_next_glVertexAttrib2d(index, x, y); glad_trace_post(514);
+}
+static PFNGLVERTEXATTRIB2DVPROC glad_trace_next_glVertexAttrib2dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_trace_pre(515); glad_trace_next_glVertexAttrib2dv(index, v); glad_trace_post(515);
+}
+static PFNGLVERTEXATTRIB2FPROC glad_trace_next_glVertexAttrib2f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_trace_pre(516); glad_trace_next_glVertexAttrib2f(index, x, y); glad_trace_post(516);
+}
+static PFNGLVERTEXATTRIB2FVPROC glad_trace_next_glVertexAttrib2fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_trace_pre(517); glad_trace_next_glVertexAttrib2fv(index, v); glad_trace_post(517);
+}
+static PFNGLVERTEXATTRIB2SPROC glad_trace_next_glVertexAttrib2s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_trace_pre(518); glad_trace_next_glVertexAttrib2s(index, x, y); glad_trace_post(518);
+}
+static PFNGLVERTEXATTRIB2SVPROC glad_trace_next_glVertexAttrib2sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_trace_pre(519); glad_trace_next_glVertexAttrib2sv(index, v); glad_trace_post(519);
+}
+static PFNGLVERTEXATTRIB3DPROC glad_trace_next_glVertexAttrib3d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_pre(520); glad_trace_next_glVertexAttrib3d(index, x, y, z); glad_trace_post(520);
+}
+static PFNGLVERTEXATTRIB3DVPROC glad_trace_next_glVertexAttrib3dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_trace_pre(521); glad_trace_next_glVertexAttrib3dv(index, v); glad_trace_post(521);
+}
+static PFNGLVERTEXATTRIB3FPROC glad_trace_next_glVertexAttrib3f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_pre(522); glad_trace_next_glVertexAttrib3f(index, x, y, z); glad_trace_post(522);
+}
+static PFNGLVERTEXATTRIB3FVPROC glad_trace_next_glVertexAttrib3fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_trace_pre(523); glad_trace_next_glVertexAttrib3fv(index, v); glad_trace_post(523);
+}
+static PFNGLVERTEXATTRIB3SPROC glad_trace_next_glVertexAttrib3s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_trace_pre(524); glad_trace_next_glVertexAttrib3s(index, x, y, z); glad_trace_post(524);
+}
+static PFNGLVERTEXATTRIB3SVPROC glad_trace_next_glVertexAttrib3sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_trace_pre(525); glad_trace_next_glVertexAttrib3sv(index, v); glad_trace_post(525);
+}
+static PFNGLVERTEXATTRIB4NBVPROC glad_trace_next_glVertexAttrib4Nbv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_trace_pre(526); glad_trace_next_glVertexAttrib4Nbv(index, v); glad_trace_post(526);
+}
+static PFNGLVERTEXATTRIB4NIVPROC glad_trace_next_glVertexAttrib4Niv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_trace_pre(527); glad_trace_next_glVertexAttrib4Niv(index, v); glad_trace_post(527);
+}
+static PFNGLVERTEXATTRIB4NSVPROC glad_trace_next_glVertexAttrib4Nsv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_trace_pre(528); glad_trace_next_glVertexAttrib4Nsv(index, v); glad_trace_post(528);
+}
+static PFNGLVERTEXATTRIB4NUBPROC glad_trace_next_glVertexAttrib4Nub = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_trace_pre(529); glad_trace_next_glVertexAttrib4Nub(index, x, y, z, w); glad_trace_post(529);
+}
+static PFNGLVERTEXATTRIB4NUBVPROC glad_trace_next_glVertexAttrib4Nubv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_trace_pre(530); glad_trace_next_glVertexAttrib4Nubv(index, v); glad_trace_post(530);
+}
+static PFNGLVERTEXATTRIB4NUIVPROC glad_trace_next_glVertexAttrib4Nuiv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_trace_pre(531); glad_trace_next_glVertexAttrib4Nuiv(index, v); glad_trace_post(531);
+}
+static PFNGLVERTEXATTRIB4NUSVPROC glad_trace_next_glVertexAttrib4Nusv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_trace_pre(532); glad_trace_next_glVertexAttrib4Nusv(index, v); glad_trace_post(532);
+}
+static PFNGLVERTEXATTRIB4BVPROC glad_trace_next_glVertexAttrib4bv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_trace_pre(533); glad_trace_next_glVertexAttrib4bv(index, v); glad_trace_post(533);
+}
+static PFNGLVERTEXATTRIB4DPROC glad_trace_next_glVertexAttrib4d = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_trace_pre(534); glad_trace_next_glVertexAttrib4d(index, x, y, z, w); glad_trace_post(534);
+}
+static PFNGLVERTEXATTRIB4DVPROC glad_trace_next_glVertexAttrib4dv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_trace_pre(535); glad_trace_next_glVertexAttrib4dv(index, v); glad_trace_post(535);
+}
+static PFNGLVERTEXATTRIB4FPROC glad_trace_next_glVertexAttrib4f = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_trace_pre(536); glad_trace_next_glVertexAttrib4f(index, x, y, z, w); glad_trace_post(536);
+}
+static PFNGLVERTEXATTRIB4FVPROC glad_trace_next_glVertexAttrib4fv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_trace_pre(537); glad_trace_next_glVertexAttrib4fv(index, v); glad_trace_post(537);
+}
+static PFNGLVERTEXATTRIB4IVPROC glad_trace_next_glVertexAttrib4iv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_trace_pre(538); glad_trace_next_glVertexAttrib4iv(index, v); glad_trace_post(538);
+}
+static PFNGLVERTEXATTRIB4SPROC glad_trace_next_glVertexAttrib4s = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_trace_pre(539); glad_trace_next_glVertexAttrib4s(index, x, y, z, w); glad_trace_post(539);
+}
+static PFNGLVERTEXATTRIB4SVPROC glad_trace_next_glVertexAttrib4sv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_trace_pre(540); glad_trace_next_glVertexAttrib4sv(index, v); glad_trace_post(540);
+}
+static PFNGLVERTEXATTRIB4UBVPROC glad_trace_next_glVertexAttrib4ubv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_trace_pre(541); glad_trace_next_glVertexAttrib4ubv(index, v); glad_trace_post(541);
+}
+static PFNGLVERTEXATTRIB4UIVPROC glad_trace_next_glVertexAttrib4uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_trace_pre(542); glad_trace_next_glVertexAttrib4uiv(index, v); glad_trace_post(542);
+}
+static PFNGLVERTEXATTRIB4USVPROC glad_trace_next_glVertexAttrib4usv = NULL;
+static void APIENTRY glad_trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_trace_pre(543); glad_trace_next_glVertexAttrib4usv(index, v); glad_trace_post(543);
+}
+static PFNGLVERTEXATTRIBPOINTERPROC glad_trace_next_glVertexAttribPointer = NULL;
+static void APIENTRY glad_trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_trace_pre(544); glad_trace_next_glVertexAttribPointer(index, size, type, normalized, stride, pointer); glad_trace_post(544);
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_trace_next_glUniformMatrix2x3fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(545); glad_trace_next_glUniformMatrix2x3fv(location, count, transpose, value); glad_trace_post(545);
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_trace_next_glUniformMatrix3x2fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(546); glad_trace_next_glUniformMatrix3x2fv(location, count, transpose, value); glad_trace_post(546);
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_trace_next_glUniformMatrix2x4fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(547); glad_trace_next_glUniformMatrix2x4fv(location, count, transpose, value); glad_trace_post(547);
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_trace_next_glUniformMatrix4x2fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(548); glad_trace_next_glUniformMatrix4x2fv(location, count, transpose, value); glad_trace_post(548);
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_trace_next_glUniformMatrix3x4fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(549); glad_trace_next_glUniformMatrix3x4fv(location, count, transpose, value); glad_trace_post(549);
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_trace_next_glUniformMatrix4x3fv = NULL;
+static void APIENTRY glad_trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_pre(550); glad_trace_next_glUniformMatrix4x3fv(location, count, transpose, value); glad_trace_post(550);
+}
+static PFNGLCOLORMASKIPROC glad_trace_next_glColorMaski = NULL;
+static void APIENTRY glad_trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_trace_pre(551); glad_trace_next_glColorMaski(index, r, g, b, a); glad_trace_post(551);
+}
+static PFNGLGETBOOLEANI_VPROC glad_trace_next_glGetBooleani_v = NULL;
+static void APIENTRY glad_trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_trace_pre(552); glad_trace_next_glGetBooleani_v(target, index, data); glad_trace_post(552);
+}
+static PFNGLGETINTEGERI_VPROC glad_trace_next_glGetIntegeri_v = NULL;
+static void APIENTRY glad_trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_trace_pre(553); glad_trace_next_glGetIntegeri_v(target, index, data); glad_trace_post(553);
+}
+static PFNGLENABLEIPROC glad_trace_next_glEnablei = NULL;
+static void APIENTRY glad_trace_glEnablei(GLenum target, GLuint index) {
+	glad_trace_pre(554); glad_trace_next_glEnablei(target, index); glad_trace_post(554);
+}
+static PFNGLDISABLEIPROC glad_trace_next_glDisablei = NULL;
+static void APIENTRY glad_trace_glDisablei(GLenum target, GLuint index) {
+	glad_trace_pre(555); glad_trace_next_glDisablei(target, index); glad_trace_post(555);
+}
+static PFNGLISENABLEDIPROC glad_trace_next_glIsEnabledi = NULL;
+static GLboolean APIENTRY glad_trace_glIsEnabledi(GLenum target, GLuint index) {
+	GLboolean result; glad_trace_pre(556); result = glad_trace_next_glIsEnabledi(target, index); glad_trace_post(556); return result;
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_trace_next_glBeginTransformFeedback = NULL;
+static void APIENTRY glad_trace_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_trace_pre(557); glad_trace_next_glBeginTransformFeedback(primitiveMode); glad_trace_post(557);
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_trace_next_glEndTransformFeedback = NULL;
+static void APIENTRY glad_trace_glEndTransformFeedback(void) {
+	glad_trace_pre(558); glad_trace_next_glEndTransformFeedback(); glad_trace_post(558);
+}
+static PFNGLBINDBUFFERRANGEPROC glad_trace_next_glBindBufferRange = NULL;
+static void APIENTRY glad_trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_trace_pre(559); glad_trace_next_glBindBufferRange(target, index, buffer, offset, size); glad_trace_post(559);
+}
+static PFNGLBINDBUFFERBASEPROC glad_trace_next_glBindBufferBase = NULL;
+static void APIENTRY glad_trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_trace_pre(560); glad_trace_next_glBindBufferBase(target, index, buffer); glad_trace_post(560);
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_trace_next_glTransformFeedbackVaryings = NULL;
+static void APIENTRY glad_trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_trace_pre(561); glad_trace_next_glTransformFeedbackVaryings(program, count, varyings, bufferMode); glad_trace_post(561);
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_trace_next_glGetTransformFeedbackVarying = NULL;
+static void APIENTRY glad_trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_trace_pre(562); glad_trace_next_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name); glad_trace_post(562);
+}
+static PFNGLCLAMPCOLORPROC glad_trace_next_glClampColor = NULL;
+static void APIENTRY glad_trace_glClampColor(GLenum target, GLenum clamp) {
+	glad_trace_pre(563); glad_trace_next_glClampColor(target, clamp); glad_trace_post(563);
+}
+static PFNGLBEGINCONDITIONALRENDERPROC glad_trace_next_glBeginConditionalRender = NULL;
+static void APIENTRY glad_trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_trace_pre(564); glad_trace_next_glBeginConditionalRender(id, mode); glad_trace_post(564);
+}
+static PFNGLENDCONDITIONALRENDERPROC glad_trace_next_glEndConditionalRender = NULL;
+static void APIENTRY glad_trace_glEndConditionalRender(void) {
+	glad_trace_pre(565); glad_trace_next_glEndConditionalRender(); glad_trace_post(565);
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_trace_next_glVertexAttribIPointer = NULL;
+static void APIENTRY glad_trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_pre(566); glad_trace_next_glVertexAttribIPointer(index, size, type, stride, pointer); glad_trace_post(566);
+}
+static PFNGLGETVERTEXATTRIBIIVPROC glad_trace_next_glGetVertexAttribIiv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_trace_pre(567); glad_trace_next_glGetVertexAttribIiv(index, pname, params); glad_trace_post(567);
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_trace_next_glGetVertexAttribIuiv = NULL;
+static void APIENTRY glad_trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_trace_pre(568); glad_trace_next_glGetVertexAttribIuiv(index, pname, params); glad_trace_post(568);
+}
+static PFNGLVERTEXATTRIBI1IPROC glad_trace_next_glVertexAttribI1i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_trace_pre(569); glad_trace_next_glVertexAttribI1i(index, x); glad_trace_post(569);
+}
+static PFNGLVERTEXATTRIBI2IPROC glad_trace_next_glVertexAttribI2i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_trace_pre(570); glad_trace_next_glVertexAttribI2i(index, x, y); glad_trace_post(570);
+}
+static PFNGLVERTEXATTRIBI3IPROC glad_trace_next_glVertexAttribI3i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_trace_pre(571); glad_trace_next_glVertexAttribI3i(index, x, y, z); glad_trace_post(571);
+}
+static PFNGLVERTEXATTRIBI4IPROC glad_trace_next_glVertexAttribI4i = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_trace_pre(572); glad_trace_next_glVertexAttribI4i(index, x, y, z, w); glad_trace_post(572);
+}
+static PFNGLVERTEXATTRIBI1UIPROC glad_trace_next_glVertexAttribI1ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_trace_pre(573); glad_trace_next_glVertexAttribI1ui(index, x); glad_trace_post(573);
+}
+static PFNGLVERTEXATTRIBI2UIPROC glad_trace_next_glVertexAttribI2ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_trace_pre(574); glad_trace_next_glVertexAttribI2ui(index, x, y); glad_trace_post(574);
+}
+static PFNGLVERTEXATTRIBI3UIPROC glad_trace_next_glVertexAttribI3ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_trace_pre(575); glad_trace_next_glVertexAttribI3ui(index, x, y, z); glad_trace_post(575);
+}
+static PFNGLVERTEXATTRIBI4UIPROC glad_trace_next_glVertexAttribI4ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_trace_pre(576); glad_trace_next_glVertexAttribI4ui(index, x, y, z, w); glad_trace_post(576);
+}
+static PFNGLVERTEXATTRIBI1IVPROC glad_trace_next_glVertexAttribI1iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_trace_pre(577); glad_trace_next_glVertexAttribI1iv(index, v); glad_trace_post(577);
+}
+static PFNGLVERTEXATTRIBI2IVPROC glad_trace_next_glVertexAttribI2iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_trace_pre(578); glad_trace_next_glVertexAttribI2iv(index, v); glad_trace_post(578);
+}
+static PFNGLVERTEXATTRIBI3IVPROC glad_trace_next_glVertexAttribI3iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_trace_pre(579); glad_trace_next_glVertexAttribI3iv(index, v); glad_trace_post(579);
+}
+static PFNGLVERTEXATTRIBI4IVPROC glad_trace_next_glVertexAttribI4iv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_trace_pre(580); glad_trace_next_glVertexAttribI4iv(index, v); glad_trace_post(580);
+}
+static PFNGLVERTEXATTRIBI1UIVPROC glad_trace_next_glVertexAttribI1uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_trace_pre(581); glad_trace_next_glVertexAttribI1uiv(index, v); glad_trace_post(581);
+}
+static PFNGLVERTEXATTRIBI2UIVPROC glad_trace_next_glVertexAttribI2uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_trace_pre(582); glad_trace_next_glVertexAttribI2uiv(index, v); glad_trace_post(582);
+}
+static PFNGLVERTEXATTRIBI3UIVPROC glad_trace_next_glVertexAttribI3uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_trace_pre(583); glad_trace_next_glVertexAttribI3uiv(index, v); glad_trace_post(583);
+}
+static PFNGLVERTEXATTRIBI4UIVPROC glad_trace_next_glVertexAttribI4uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_trace_pre(584); glad_trace_next_glVertexAttribI4uiv(index, v); glad_trace_post(584);
+}
+static PFNGLVERTEXATTRIBI4BVPROC glad_trace_next_glVertexAttribI4bv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_trace_pre(585); glad_trace_next_glVertexAttribI4bv(index, v); glad_trace_post(585);
+}
+static PFNGLVERTEXATTRIBI4SVPROC glad_trace_next_glVertexAttribI4sv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_trace_pre(586); glad_trace_next_glVertexAttribI4sv(index, v); glad_trace_post(586);
+}
+static PFNGLVERTEXATTRIBI4UBVPROC glad_trace_next_glVertexAttribI4ubv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_trace_pre(587); glad_trace_next_glVertexAttribI4ubv(index, v); glad_trace_post(587);
+}
+static PFNGLVERTEXATTRIBI4USVPROC glad_trace_next_glVertexAttribI4usv = NULL;
+static void APIENTRY glad_trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_trace_pre(588); glad_trace_next_glVertexAttribI4usv(index, v); glad_trace_post(588);
+}
+static PFNGLGETUNIFORMUIVPROC glad_trace_next_glGetUniformuiv = NULL;
+static void APIENTRY glad_trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_trace_pre(589); glad_trace_next_glGetUniformuiv(program, location, params); glad_trace_post(589);
+}
+static PFNGLBINDFRAGDATALOCATIONPROC glad_trace_next_glBindFragDataLocation = NULL;
+static void APIENTRY glad_trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_trace_pre(590); glad_trace_next_glBindFragDataLocation(program, color, name); glad_trace_post(590);
+}
+static PFNGLGETFRAGDATALOCATIONPROC glad_trace_next_glGetFragDataLocation = NULL;
+static GLint APIENTRY glad_trace_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	GLint result; glad_trace_pre(591); result = glad_trace_next_glGetFragDataLocation(program, name); glad_trace_post(591); return result;
+}
+static PFNGLUNIFORM1UIPROC glad_trace_next_glUniform1ui = NULL;
+static void APIENTRY glad_trace_glUniform1ui(GLint location, GLuint v0) {
+	glad_trace_pre(592); glad_trace_next_glUniform1ui(location, v0); glad_trace_post(592);
+}
+static PFNGLUNIFORM2UIPROC glad_trace_next_glUniform2ui = NULL;
+static void APIENTRY glad_trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_trace_pre(593); glad_trace_next_glUniform2ui(location, v0, v1); glad_trace_post(593);
+}
+static PFNGLUNIFORM3UIPROC glad_trace_next_glUniform3ui = NULL;
+static void APIENTRY glad_trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_trace_pre(594); glad_trace_next_glUniform3ui(location, v0, v1, v2); glad_trace_post(594);
+}
+static PFNGLUNIFORM4UIPROC glad_trace_next_glUniform4ui = NULL;
+static void APIENTRY glad_trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_trace_pre(595); glad_trace_next_glUniform4ui(location, v0, v1, v2, v3); glad_trace_post(595);
+}
+static PFNGLUNIFORM1UIVPROC glad_trace_next_glUniform1uiv = NULL;
+static void APIENTRY glad_trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_pre(596); glad_trace_next_glUniform1uiv(location, count, value); glad_trace_post(596);
+}
+static PFNGLUNIFORM2UIVPROC glad_trace_next_glUniform2uiv = NULL;
+static void APIENTRY glad_trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_pre(597); glad_trace_next_glUniform2uiv(location, count, value); glad_trace_post(597);
+}
+static PFNGLUNIFORM3UIVPROC glad_trace_next_glUniform3uiv = NULL;
+static void APIENTRY glad_trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_pre(598); glad_trace_next_glUniform3uiv(location, count, value); glad_trace_post(598);
+}
+static PFNGLUNIFORM4UIVPROC glad_trace_next_glUniform4uiv = NULL;
+static void APIENTRY glad_trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_pre(599); glad_trace_next_glUniform4uiv(location, count, value); glad_trace_post(599);
+}
+static PFNGLTEXPARAMETERIIVPROC glad_trace_next_glTexParameterIiv = NULL;
+static void APIENTRY glad_trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_trace_pre(600); glad_trace_next_glTexParameterIiv(target, pname, params); glad_trace_post(600);
+}
+static PFNGLTEXPARAMETERIUIVPROC glad_trace_next_glTexParameterIuiv = NULL;
+static void APIENTRY glad_trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_trace_pre(601); glad_trace_next_glTexParameterIuiv(target, pname, params); glad_trace_post(601);
+}
+static PFNGLGETTEXPARAMETERIIVPROC glad_trace_next_glGetTexParameterIiv = NULL;
+static void APIENTRY glad_trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_trace_pre(602); glad_trace_next_glGetTexParameterIiv(target, pname, params); glad_trace_post(602);
+}
+static PFNGLGETTEXPARAMETERIUIVPROC glad_trace_next_glGetTexParameterIuiv = NULL;
+static void APIENTRY glad_trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_trace_pre(603); glad_trace_next_glGetTexParameterIuiv(target, pname, params); glad_trace_post(603);
+}
+static PFNGLCLEARBUFFERIVPROC glad_trace_next_glClearBufferiv = NULL;
+static void APIENTRY glad_trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_trace_pre(604); glad_trace_next_glClearBufferiv(buffer, drawbuffer, value); glad_trace_post(604);
+}
+static PFNGLCLEARBUFFERUIVPROC glad_trace_next_glClearBufferuiv = NULL;
+static void APIENTRY glad_trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_trace_pre(605); glad_trace_next_glClearBufferuiv(buffer, drawbuffer, value); glad_trace_post(605);
+}
+static PFNGLCLEARBUFFERFVPROC glad_trace_next_glClearBufferfv = NULL;
+static void APIENTRY glad_trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_trace_pre(606); glad_trace_next_glClearBufferfv(buffer, drawbuffer, value); glad_trace_post(606);
+}
+static PFNGLCLEARBUFFERFIPROC glad_trace_next_glClearBufferfi = NULL;
+static void APIENTRY glad_trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_trace_pre(607); glad_trace_next_glClearBufferfi(buffer, drawbuffer, depth, stencil); glad_trace_post(607);
+}
+static PFNGLGETSTRINGIPROC glad_trace_next_glGetStringi = NULL;
+static const GLubyte * APIENTRY glad_trace_glGetStringi(GLenum name, GLuint index) {
+	const GLubyte * result; glad_trace_pre(608); result = glad_trace_next_glGetStringi(name, index); glad_trace_post(608); return result;
+}
+static PFNGLISRENDERBUFFERPROC glad_trace_next_glIsRenderbuffer = NULL;
+static GLboolean APIENTRY glad_trace_glIsRenderbuffer(GLuint renderbuffer) {
+	GLboolean result; glad_trace_pre(609); result = glad_trace_next_glIsRenderbuffer(renderbuffer); glad_trace_post(609); return result;
+}
+static PFNGLBINDRENDERBUFFERPROC glad_trace_next_glBindRenderbuffer = NULL;
+static void APIENTRY glad_trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_trace_pre(610); glad_trace_next_glBindRenderbuffer(target, renderbuffer); glad_trace_post(610);
+}
+static PFNGLDELETERENDERBUFFERSPROC glad_trace_next_glDeleteRenderbuffers = NULL;
+static void APIENTRY glad_trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_trace_pre(611); glad_trace_next_glDeleteRenderbuffers(n, renderbuffers); glad_trace_post(611);
+}
+static PFNGLGENRENDERBUFFERSPROC glad_trace_next_glGenRenderbuffers = NULL;
+static void APIENTRY glad_trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_trace_pre(612); glad_trace_next_glGenRenderbuffers(n, renderbuffers); glad_trace_post(612);
+}
+static PFNGLRENDERBUFFERSTORAGEPROC glad_trace_next_glRenderbufferStorage = NULL;
+static void APIENTRY glad_trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_pre(613); glad_trace_next_glRenderbufferStorage(target, internalformat, width, height); glad_trace_post(613);
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_trace_next_glGetRenderbufferParameteriv = NULL;
+static void APIENTRY glad_trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_trace_pre(614); glad_trace_next_glGetRenderbufferParameteriv(target, pname, params); glad_trace_post(614);
+}
+static PFNGLISFRAMEBUFFERPROC glad_trace_next_glIsFramebuffer = NULL;
+static GLboolean APIENTRY glad_trace_glIsFramebuffer(GLuint framebuffer) {
+	GLboolean result; glad_trace_pre(615); result = glad_trace_next_glIsFramebuffer(framebuffer); glad_trace_post(615); return result;
+}
+static PFNGLBINDFRAMEBUFFERPROC glad_trace_next_glBindFramebuffer = NULL;
+static void APIENTRY glad_trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_trace_pre(616); glad_trace_next_glBindFramebuffer(target, framebuffer); glad_trace_post(616);
+}
+static PFNGLDELETEFRAMEBUFFERSPROC glad_trace_next_glDeleteFramebuffers = NULL;
+static void APIENTRY glad_trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_trace_pre(617); glad_trace_next_glDeleteFramebuffers(n, framebuffers); glad_trace_post(617);
+}
+static PFNGLGENFRAMEBUFFERSPROC glad_trace_next_glGenFramebuffers = NULL;
+static void APIENTRY glad_trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_trace_pre(618); glad_trace_next_glGenFramebuffers(n, framebuffers); glad_trace_post(618);
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_trace_next_glCheckFramebufferStatus = NULL;
+static GLenum APIENTRY glad_trace_glCheckFramebufferStatus(GLenum target) {
+	GLenum result; glad_trace_pre(619); result = glad_trace_next_glCheckFramebufferStatus(target); glad_trace_post(619); return result;
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_trace_next_glFramebufferTexture1D = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_trace_pre(620); glad_trace_next_glFramebufferTexture1D(target, attachment, textarget, texture, level); glad_trace_post(620);
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_trace_next_glFramebufferTexture2D = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_trace_pre(621); glad_trace_next_glFramebufferTexture2D(target, attachment, textarget, texture, level); glad_trace_post(621);
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_trace_next_glFramebufferTexture3D = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_trace_pre(622); glad_trace_next_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset); glad_trace_post(622);
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_trace_next_glFramebufferRenderbuffer = NULL;
+static void APIENTRY glad_trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_trace_pre(623); glad_trace_next_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); glad_trace_post(623);
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_trace_next_glGetFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY glad_trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_trace_pre(624); glad_trace_next_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params); glad_trace_post(624);
+}
+static PFNGLGENERATEMIPMAPPROC glad_trace_next_glGenerateMipmap = NULL;
+static void APIENTRY glad_trace_glGenerateMipmap(GLenum target) {
+	glad_trace_pre(625); glad_trace_next_glGenerateMipmap(target); glad_trace_post(625);
+}
+static PFNGLBLITFRAMEBUFFERPROC glad_trace_next_glBlitFramebuffer = NULL;
+static void APIENTRY glad_trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_trace_pre(626); glad_trace_next_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); glad_trace_post(626);
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_trace_next_glRenderbufferStorageMultisample = NULL;
+static void APIENTRY glad_trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_pre(627); glad_trace_next_glRenderbufferStorageMultisample(target, samples, internalformat, width, height); glad_trace_post(627);
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_trace_next_glFramebufferTextureLayer = NULL;
+static void APIENTRY glad_trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_trace_pre(628); glad_trace_next_glFramebufferTextureLayer(target, attachment, texture, level, layer); glad_trace_post(628);
+}
+static PFNGLMAPBUFFERRANGEPROC glad_trace_next_glMapBufferRange = NULL;
+static void * APIENTRY glad_trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * result; glad_trace_pre(629); result = glad_trace_next_glMapBufferRange(target, offset, length, access); glad_trace_post(629); return result;
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_trace_next_glFlushMappedBufferRange = NULL;
+static void APIENTRY glad_trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_trace_pre(630); glad_trace_next_glFlushMappedBufferRange(target, offset, length); glad_trace_post(630);
+}
+static PFNGLBINDVERTEXARRAYPROC glad_trace_next_glBindVertexArray = NULL;
+static void APIENTRY glad_trace_glBindVertexArray(GLuint array) {
+	glad_trace_pre(631); glad_trace_next_glBindVertexArray(array); glad_trace_post(631);
+}
+static PFNGLDELETEVERTEXARRAYSPROC glad_trace_next_glDeleteVertexArrays = NULL;
+static void APIENTRY glad_trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_trace_pre(632); glad_trace_next_glDeleteVertexArrays(n, arrays); glad_trace_post(632);
+}
+static PFNGLGENVERTEXARRAYSPROC glad_trace_next_glGenVertexArrays = NULL;
+static void APIENTRY glad_trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_trace_pre(633); glad_trace_next_glGenVertexArrays(n, arrays); glad_trace_post(633);
+}
+static PFNGLISVERTEXARRAYPROC glad_trace_next_glIsVertexArray = NULL;
+static GLboolean APIENTRY glad_trace_glIsVertexArray(GLuint array) {
+	GLboolean result; glad_trace_pre(634); result = glad_trace_next_glIsVertexArray(array); glad_trace_post(634); return result;
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_trace_next_glDrawArraysInstanced = NULL;
+static void APIENTRY glad_trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_trace_pre(635); glad_trace_next_glDrawArraysInstanced(mode, first, count, instancecount); glad_trace_post(635);
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_trace_next_glDrawElementsInstanced = NULL;
+static void APIENTRY glad_trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_trace_pre(636); glad_trace_next_glDrawElementsInstanced(mode, count, type, indices, instancecount); glad_trace_post(636);
+}
+static PFNGLTEXBUFFERPROC glad_trace_next_glTexBuffer = NULL;
+static void APIENTRY glad_trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_trace_pre(637); glad_trace_next_glTexBuffer(target, internalformat, buffer); glad_trace_post(637);
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_trace_next_glPrimitiveRestartIndex = NULL;
+static void APIENTRY glad_trace_glPrimitiveRestartIndex(GLuint index) {
+	glad_trace_pre(638); glad_trace_next_glPrimitiveRestartIndex(index); glad_trace_post(638);
+}
+static PFNGLCOPYBUFFERSUBDATAPROC glad_trace_next_glCopyBufferSubData = NULL;
+static void APIENTRY glad_trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_trace_pre(639); glad_trace_next_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size); glad_trace_post(639);
+}
+static PFNGLGETUNIFORMINDICESPROC glad_trace_next_glGetUniformIndices = NULL;
+static void APIENTRY glad_trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_trace_pre(640); glad_trace_next_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices); glad_trace_post(640);
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_trace_next_glGetActiveUniformsiv = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_trace_pre(641); glad_trace_next_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params); glad_trace_post(641);
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_trace_next_glGetActiveUniformName = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_trace_pre(642); glad_trace_next_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName); glad_trace_post(642);
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_trace_next_glGetUniformBlockIndex = NULL;
+static GLuint APIENTRY glad_trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	GLuint result; glad_trace_pre(643); result = glad_trace_next_glGetUniformBlockIndex(program, uniformBlockName); glad_trace_post(643); return result;
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_trace_next_glGetActiveUniformBlockiv = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_trace_pre(644); glad_trace_next_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params); glad_trace_post(644);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_trace_next_glGetActiveUniformBlockName = NULL;
+static void APIENTRY glad_trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_trace_pre(645); glad_trace_next_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName); glad_trace_post(645);
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_trace_next_glUniformBlockBinding = NULL;
+static void APIENTRY glad_trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_trace_pre(646); glad_trace_next_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding); glad_trace_post(646);
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_trace_next_glDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_trace_pre(647); glad_trace_next_glDrawElementsBaseVertex(mode, count, type, indices, basevertex); glad_trace_post(647);
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_trace_next_glDrawRangeElementsBaseVertex = NULL;
+static void APIENTRY glad_trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_trace_pre(648); glad_trace_next_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex); glad_trace_post(648);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_trace_next_glDrawElementsInstancedBaseVertex = NULL;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_trace_pre(649); glad_trace_next_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex); glad_trace_post(649);
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_trace_next_glMultiDrawElementsBaseVertex = NULL;
+static void APIENTRY glad_trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_trace_pre(650); glad_trace_next_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex); glad_trace_post(650);
+}
+static PFNGLPROVOKINGVERTEXPROC glad_trace_next_glProvokingVertex = NULL;
+static void APIENTRY glad_trace_glProvokingVertex(GLenum mode) {
+	glad_trace_pre(651); glad_trace_next_glProvokingVertex(mode); glad_trace_post(651);
+}
+static PFNGLFENCESYNCPROC glad_trace_next_glFenceSync = NULL;
+static GLsync APIENTRY glad_trace_glFenceSync(GLenum condition, GLbitfield flags) {
+	GLsync result; glad_trace_pre(652); result = glad_trace_next_glFenceSync(condition, flags); glad_trace_post(652); return result;
+}
+static PFNGLISSYNCPROC glad_trace_next_glIsSync = NULL;
+static GLboolean APIENTRY glad_trace_glIsSync(GLsync sync) {
+	GLboolean result; glad_trace_pre(653); result = glad_trace_next_glIsSync(sync); glad_trace_post(653); return result;
+}
+static PFNGLDELETESYNCPROC glad_trace_next_glDeleteSync = NULL;
+static void APIENTRY glad_trace_glDeleteSync(GLsync sync) {
+	glad_trace_pre(654); glad_trace_next_glDeleteSync(sync); glad_trace_post(654);
+}
+static PFNGLCLIENTWAITSYNCPROC glad_trace_next_glClientWaitSync = NULL;
+static GLenum APIENTRY glad_trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLenum result; glad_trace_pre(655); result = glad_trace_next_glClientWaitSync(sync, flags, timeout); glad_trace_post(655); return result;
+}
+static PFNGLWAITSYNCPROC glad_trace_next_glWaitSync = NULL;
+static void APIENTRY glad_trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_trace_pre(656); glad_trace_next_glWaitSync(sync, flags, timeout); glad_trace_post(656);
+}
+static PFNGLGETINTEGER64VPROC glad_trace_next_glGetInteger64v = NULL;
+static void APIENTRY glad_trace_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_trace_pre(657); glad_trace_next_glGetInteger64v(pname, data); glad_trace_post(657);
+}
+static PFNGLGETSYNCIVPROC glad_trace_next_glGetSynciv = NULL;
+static void APIENTRY glad_trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_trace_pre(658); glad_trace_next_glGetSynciv(sync, pname, count, length, values); glad_trace_post(658);
+}
+static PFNGLGETINTEGER64I_VPROC glad_trace_next_glGetInteger64i_v = NULL;
+static void APIENTRY glad_trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_trace_pre(659); glad_trace_next_glGetInteger64i_v(target, index, data); glad_trace_post(659);
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_trace_next_glGetBufferParameteri64v = NULL;
+static void APIENTRY glad_trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_trace_pre(660); glad_trace_next_glGetBufferParameteri64v(target, pname, params); glad_trace_post(660);
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_trace_next_glFramebufferTexture = NULL;
+static void APIENTRY glad_trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_trace_pre(661); glad_trace_next_glFramebufferTexture(target, attachment, texture, level); glad_trace_post(661);
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_trace_next_glTexImage2DMultisample = NULL;
+static void APIENTRY glad_trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_trace_pre(662); glad_trace_next_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); glad_trace_post(662);
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_trace_next_glTexImage3DMultisample = NULL;
+static void APIENTRY glad_trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_trace_pre(663); glad_trace_next_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); glad_trace_post(663);
+}
+static PFNGLGETMULTISAMPLEFVPROC glad_trace_next_glGetMultisamplefv = NULL;
+static void APIENTRY glad_trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_trace_pre(664); glad_trace_next_glGetMultisamplefv(pname, index, val); glad_trace_post(664);
+}
+static PFNGLSAMPLEMASKIPROC glad_trace_next_glSampleMaski = NULL;
+static void APIENTRY glad_trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_trace_pre(665); glad_trace_next_glSampleMaski(maskNumber, mask); glad_trace_post(665);
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_trace_next_glBindFragDataLocationIndexed = NULL;
+static void APIENTRY glad_trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_trace_pre(666); glad_trace_next_glBindFragDataLocationIndexed(program, colorNumber, index, name); glad_trace_post(666);
+}
+static PFNGLGETFRAGDATAINDEXPROC glad_trace_next_glGetFragDataIndex = NULL;
+static GLint APIENTRY glad_trace_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	GLint result; glad_trace_pre(667); result = glad_trace_next_glGetFragDataIndex(program, name); glad_trace_post(667); return result;
+}
+static PFNGLGENSAMPLERSPROC glad_trace_next_glGenSamplers = NULL;
+static void APIENTRY glad_trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_trace_pre(668); glad_trace_next_glGenSamplers(count, samplers); glad_trace_post(668);
+}
+static PFNGLDELETESAMPLERSPROC glad_trace_next_glDeleteSamplers = NULL;
+static void APIENTRY glad_trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_trace_pre(669); glad_trace_next_glDeleteSamplers(count, samplers); glad_trace_post(669);
+}
+static PFNGLISSAMPLERPROC glad_trace_next_glIsSampler = NULL;
+static GLboolean APIENTRY glad_trace_glIsSampler(GLuint sampler) {
+	GLboolean result; glad_trace_pre(670); result = glad_trace_next_glIsSampler(sampler); glad_trace_post(670); return result;
+}
+static PFNGLBINDSAMPLERPROC glad_trace_next_glBindSampler = NULL;
+static void APIENTRY glad_trace_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_trace_pre(671); glad_trace_next_glBindSampler(unit, sampler); glad_trace_post(671);
+}
+static PFNGLSAMPLERPARAMETERIPROC glad_trace_next_glSamplerParameteri = NULL;
+static void APIENTRY glad_trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_trace_pre(672); glad_trace_next_glSamplerParameteri(sampler, pname, param); glad_trace_post(672);
+}
+static PFNGLSAMPLERPARAMETERIVPROC glad_trace_next_glSamplerParameteriv = NULL;
+static void APIENTRY glad_trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_trace_pre(673); glad_trace_next_glSamplerParameteriv(sampler, pname, param); glad_trace_post(673);
+}
+static PFNGLSAMPLERPARAMETERFPROC glad_trace_next_glSamplerParameterf = NULL;
+static void APIENTRY glad_trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_trace_pre(674); glad_trace_next_glSamplerParameterf(sampler, pname, param); glad_trace_post(674);
+}
+static PFNGLSAMPLERPARAMETERFVPROC glad_trace_next_glSamplerParameterfv = NULL;
+static void APIENTRY glad_trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_trace_pre(675); glad_trace_next_glSamplerParameterfv(sampler, pname, param); glad_trace_post(675);
+}
+static PFNGLSAMPLERPARAMETERIIVPROC glad_trace_next_glSamplerParameterIiv = NULL;
+static void APIENTRY glad_trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_trace_pre(676); glad_trace_next_glSamplerParameterIiv(sampler, pname, param); glad_trace_post(676);
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_trace_next_glSamplerParameterIuiv = NULL;
+static void APIENTRY glad_trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_trace_pre(677); glad_trace_next_glSamplerParameterIuiv(sampler, pname, param); glad_trace_post(677);
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_trace_next_glGetSamplerParameteriv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_trace_pre(678); glad_trace_next_glGetSamplerParameteriv(sampler, pname, params); glad_trace_post(678);
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_trace_next_glGetSamplerParameterIiv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_trace_pre(679); glad_trace_next_glGetSamplerParameterIiv(sampler, pname, params); glad_trace_post(679);
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_trace_next_glGetSamplerParameterfv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_trace_pre(680); glad_trace_next_glGetSamplerParameterfv(sampler, pname, params); glad_trace_post(680);
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_trace_next_glGetSamplerParameterIuiv = NULL;
+static void APIENTRY glad_trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_trace_pre(681); glad_trace_next_glGetSamplerParameterIuiv(sampler, pname, params); glad_trace_post(681);
+}
+static PFNGLQUERYCOUNTERPROC glad_trace_next_glQueryCounter = NULL;
+static void APIENTRY glad_trace_glQueryCounter(GLuint id, GLenum target) {
+	glad_trace_pre(682); glad_trace_next_glQueryCounter(id, target); glad_trace_post(682);
+}
+static PFNGLGETQUERYOBJECTI64VPROC glad_trace_next_glGetQueryObjecti64v = NULL;
+static void APIENTRY glad_trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_trace_pre(683); glad_trace_next_glGetQueryObjecti64v(id, pname, params); glad_trace_post(683);
+}
+static PFNGLGETQUERYOBJECTUI64VPROC glad_trace_next_glGetQueryObjectui64v = NULL;
+static void APIENTRY glad_trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_trace_pre(684); glad_trace_next_glGetQueryObjectui64v(id, pname, params); glad_trace_post(684);
+}
+static PFNGLVERTEXATTRIBDIVISORPROC glad_trace_next_glVertexAttribDivisor = NULL;
+static void APIENTRY glad_trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_trace_pre(685); glad_trace_next_glVertexAttribDivisor(index, divisor); glad_trace_post(685);
+}
+static PFNGLVERTEXATTRIBP1UIPROC glad_trace_next_glVertexAttribP1ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_pre(686); glad_trace_next_glVertexAttribP1ui(index, type, normalized, value); glad_trace_post(686);
+}
+static PFNGLVERTEXATTRIBP1UIVPROC glad_trace_next_glVertexAttribP1uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_pre(687); glad_trace_next_glVertexAttribP1uiv(index, type, normalized, value); glad_trace_post(687);
+}
+static PFNGLVERTEXATTRIBP2UIPROC glad_trace_next_glVertexAttribP2ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_pre(688); glad_trace_next_glVertexAttribP2ui(index, type, normalized, value); glad_trace_post(688);
+}
+static PFNGLVERTEXATTRIBP2UIVPROC glad_trace_next_glVertexAttribP2uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_pre(689); glad_trace_next_glVertexAttribP2uiv(index, type, normalized, value); glad_trace_post(689);
+}
+static PFNGLVERTEXATTRIBP3UIPROC glad_trace_next_glVertexAttribP3ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_pre(690); glad_trace_next_glVertexAttribP3ui(index, type, normalized, value); glad_trace_post(690);
+}
+static PFNGLVERTEXATTRIBP3UIVPROC glad_trace_next_glVertexAttribP3uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_pre(691); glad_trace_next_glVertexAttribP3uiv(index, type, normalized, value); glad_trace_post(691);
+}
+static PFNGLVERTEXATTRIBP4UIPROC glad_trace_next_glVertexAttribP4ui = NULL;
+static void APIENTRY glad_trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_pre(692); glad_trace_next_glVertexAttribP4ui(index, type, normalized, value); glad_trace_post(692);
+}
+static PFNGLVERTEXATTRIBP4UIVPROC glad_trace_next_glVertexAttribP4uiv = NULL;
+static void APIENTRY glad_trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_pre(693); glad_trace_next_glVertexAttribP4uiv(index, type, normalized, value); glad_trace_post(693);
+}
+static PFNGLVERTEXP2UIPROC glad_trace_next_glVertexP2ui = NULL;
+static void APIENTRY glad_trace_glVertexP2ui(GLenum type, GLuint value) {
+	glad_trace_pre(694); glad_trace_next_glVertexP2ui(type, value); glad_trace_post(694);
+}
+static PFNGLVERTEXP2UIVPROC glad_trace_next_glVertexP2uiv = NULL;
+static void APIENTRY glad_trace_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_trace_pre(695); glad_trace_next_glVertexP2uiv(type, value); glad_trace_post(695);
+}
+static PFNGLVERTEXP3UIPROC glad_trace_next_glVertexP3ui = NULL;
+static void APIENTRY glad_trace_glVertexP3ui(GLenum type, GLuint value) {
+	glad_trace_pre(696); glad_trace_next_glVertexP3ui(type, value); glad_trace_post(696);
+}
+static PFNGLVERTEXP3UIVPROC glad_trace_next_glVertexP3uiv = NULL;
+static void APIENTRY glad_trace_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_trace_pre(697); glad_trace_next_glVertexP3uiv(type, value); glad_trace_post(697);
+}
+static PFNGLVERTEXP4UIPROC glad_trace_next_glVertexP4ui = NULL;
+static void APIENTRY glad_trace_glVertexP4ui(GLenum type, GLuint value) {
+	glad_trace_pre(698); glad_trace_next_glVertexP4ui(type, value); glad_trace_post(698);
+}
+static PFNGLVERTEXP4UIVPROC glad_trace_next_glVertexP4uiv = NULL;
+static void APIENTRY glad_trace_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_trace_pre(699); glad_trace_next_glVertexP4uiv(type, value); glad_trace_post(699);
+}
+static PFNGLTEXCOORDP1UIPROC glad_trace_next_glTexCoordP1ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_trace_pre(700); glad_trace_next_glTexCoordP1ui(type, coords); glad_trace_post(700);
+}
+static PFNGLTEXCOORDP1UIVPROC glad_trace_next_glTexCoordP1uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_trace_pre(701); glad_trace_next_glTexCoordP1uiv(type, coords); glad_trace_post(701);
+}
+static PFNGLTEXCOORDP2UIPROC glad_trace_next_glTexCoordP2ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_trace_pre(702); glad_trace_next_glTexCoordP2ui(type, coords); glad_trace_post(702);
+}
+static PFNGLTEXCOORDP2UIVPROC glad_trace_next_glTexCoordP2uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_trace_pre(703); glad_trace_next_glTexCoordP2uiv(type, coords); glad_trace_post(703);
+}
+static PFNGLTEXCOORDP3UIPROC glad_trace_next_glTexCoordP3ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_trace_pre(704); glad_trace_next_glTexCoordP3ui(type, coords); glad_trace_post(704);
+}
+static PFNGLTEXCOORDP3UIVPROC glad_trace_next_glTexCoordP3uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_trace_pre(705); glad_trace_next_glTexCoordP3uiv(type, coords); glad_trace_post(705);
+}
+static PFNGLTEXCOORDP4UIPROC glad_trace_next_glTexCoordP4ui = NULL;
+static void APIENTRY glad_trace_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_trace_pre(706); glad_trace_next_glTexCoordP4ui(type, coords); glad_trace_post(706);
+}
+static PFNGLTEXCOORDP4UIVPROC glad_trace_next_glTexCoordP4uiv = NULL;
+static void APIENTRY glad_trace_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_trace_pre(707); glad_trace_next_glTexCoordP4uiv(type, coords); glad_trace_post(707);
+}
+static PFNGLMULTITEXCOORDP1UIPROC glad_trace_next_glMultiTexCoordP1ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_pre(708); glad_trace_next_glMultiTexCoordP1ui(texture, type, coords); glad_trace_post(708);
+}
+static PFNGLMULTITEXCOORDP1UIVPROC glad_trace_next_glMultiTexCoordP1uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_pre(709); glad_trace_next_glMultiTexCoordP1uiv(texture, type, coords); glad_trace_post(709);
+}
+static PFNGLMULTITEXCOORDP2UIPROC glad_trace_next_glMultiTexCoordP2ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_pre(710); glad_trace_next_glMultiTexCoordP2ui(texture, type, coords); glad_trace_post(710);
+}
+static PFNGLMULTITEXCOORDP2UIVPROC glad_trace_next_glMultiTexCoordP2uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_pre(711); glad_trace_next_glMultiTexCoordP2uiv(texture, type, coords); glad_trace_post(711);
+}
+static PFNGLMULTITEXCOORDP3UIPROC glad_trace_next_glMultiTexCoordP3ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_pre(712); glad_trace_next_glMultiTexCoordP3ui(texture, type, coords); glad_trace_post(712);
+}
+static PFNGLMULTITEXCOORDP3UIVPROC glad_trace_next_glMultiTexCoordP3uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_pre(713); glad_trace_next_glMultiTexCoordP3uiv(texture, type, coords); glad_trace_post(713);
+}
+static PFNGLMULTITEXCOORDP4UIPROC glad_trace_next_glMultiTexCoordP4ui = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_pre(714); glad_trace_next_glMultiTexCoordP4ui(texture, type, coords); glad_trace_post(714);
+}
+static PFNGLMULTITEXCOORDP4UIVPROC glad_trace_next_glMultiTexCoordP4uiv = NULL;
+static void APIENTRY glad_trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_pre(715); glad_trace_next_glMultiTexCoordP4uiv(texture, type, coords); glad_trace_post(715);
+}
+static PFNGLNORMALP3UIPROC glad_trace_next_glNormalP3ui = NULL;
+static void APIENTRY glad_trace_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_trace_pre(716); glad_trace_next_glNormalP3ui(type, coords); glad_trace_post(716);
+}
+static PFNGLNORMALP3UIVPROC glad_trace_next_glNormalP3uiv = NULL;
+static void APIENTRY glad_trace_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_trace_pre(717); glad_trace_next_glNormalP3uiv(type, coords); glad_trace_post(717);
+}
+static PFNGLCOLORP3UIPROC glad_trace_next_glColorP3ui = NULL;
+static void APIENTRY glad_trace_glColorP3ui(GLenum type, GLuint color) {
+	glad_trace_pre(718); glad_trace_next_glColorP3ui(type, color); glad_trace_post(718);
+}
+static PFNGLCOLORP3UIVPROC glad_trace_next_glColorP3uiv = NULL;
+static void APIENTRY glad_trace_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_trace_pre(719); glad_trace_next_glColorP3uiv(type, color); glad_trace_post(719);
+}
+static PFNGLCOLORP4UIPROC glad_trace_next_glColorP4ui = NULL;
+static void APIENTRY glad_trace_glColorP4ui(GLenum type, GLuint color) {
+	glad_trace_pre(720); glad_trace_next_glColorP4ui(type, color); glad_trace_post(720);
+}
+static PFNGLCOLORP4UIVPROC glad_trace_next_glColorP4uiv = NULL;
+static void APIENTRY glad_trace_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_trace_pre(721); glad_trace_next_glColorP4uiv(type, color); glad_trace_post(721);
+}
+static PFNGLSECONDARYCOLORP3UIPROC glad_trace_next_glSecondaryColorP3ui = NULL;
+static void APIENTRY glad_trace_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_trace_pre(722); glad_trace_next_glSecondaryColorP3ui(type, color); glad_trace_post(722);
+}
+static PFNGLSECONDARYCOLORP3UIVPROC glad_trace_next_glSecondaryColorP3uiv = NULL;
+static void APIENTRY glad_trace_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_trace_pre(723); glad_trace_next_glSecondaryColorP3uiv(type, color); glad_trace_post(723);
+}
+static PFNGLBUFFERSTORAGEPROC glad_trace_next_glBufferStorage = NULL;
+static void APIENTRY glad_trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_trace_pre(724); glad_trace_next_glBufferStorage(target, size, data, flags); glad_trace_post(724);
+}
+static PFNGLDRAWARRAYSINDIRECTPROC glad_trace_next_glDrawArraysIndirect = NULL;
+static void APIENTRY glad_trace_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	glad_trace_pre(725); glad_trace_next_glDrawArraysIndirect(mode, indirect); glad_trace_post(725);
+}
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_trace_next_glDrawElementsIndirect = NULL;
+static void APIENTRY glad_trace_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	glad_trace_pre(726); glad_trace_next_glDrawElementsIndirect(mode, type, indirect); glad_trace_post(726);
+}
+static PFNGLGETPROGRAMBINARYPROC glad_trace_next_glGetProgramBinary = NULL;
+static void APIENTRY glad_trace_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	glad_trace_pre(727); glad_trace_next_glGetProgramBinary(program, bufSize, length, binaryFormat, binary); glad_trace_post(727);
+}
+static PFNGLPROGRAMBINARYPROC glad_trace_next_glProgramBinary = NULL;
+static void APIENTRY glad_trace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_trace_pre(728); glad_trace_next_glProgramBinary(program, binaryFormat, binary, length); glad_trace_post(728);
+}
+static PFNGLPROGRAMPARAMETERIPROC glad_trace_next_glProgramParameteri = NULL;
+static void APIENTRY glad_trace_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	glad_trace_pre(729); glad_trace_next_glProgramParameteri(program, pname, value); glad_trace_post(729);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_trace_next_glMultiDrawArraysIndirect = NULL;
+static void APIENTRY glad_trace_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_trace_pre(730); glad_trace_next_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride); glad_trace_post(730);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_trace_next_glMultiDrawElementsIndirect = NULL;
+static void APIENTRY glad_trace_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_trace_pre(731); glad_trace_next_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride); glad_trace_post(731);
+}
+static PFNGLDEBUGMESSAGECONTROLPROC glad_trace_next_glDebugMessageControl = NULL;
+static void APIENTRY glad_trace_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_trace_pre(732); glad_trace_next_glDebugMessageControl(source, type, severity, count, ids, enabled); glad_trace_post(732);
+}
+static PFNGLDEBUGMESSAGEINSERTPROC glad_trace_next_glDebugMessageInsert = NULL;
+static void APIENTRY glad_trace_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_trace_pre(733); glad_trace_next_glDebugMessageInsert(source, type, id, severity, length, buf); glad_trace_post(733);
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_trace_next_glDebugMessageCallback = NULL;
+static void APIENTRY glad_trace_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	glad_trace_pre(734); glad_trace_next_glDebugMessageCallback(callback, userParam); glad_trace_post(734);
+}
+static PFNGLGETDEBUGMESSAGELOGPROC glad_trace_next_glGetDebugMessageLog = NULL;
+static GLuint APIENTRY glad_trace_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	GLuint result; glad_trace_pre(735); result = glad_trace_next_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog); glad_trace_post(735); return result;
+}
+static PFNGLPUSHDEBUGGROUPPROC glad_trace_next_glPushDebugGroup = NULL;
+static void APIENTRY glad_trace_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	glad_trace_pre(736); glad_trace_next_glPushDebugGroup(source, id, length, message); glad_trace_post(736);
+}
+static PFNGLPOPDEBUGGROUPPROC glad_trace_next_glPopDebugGroup = NULL;
+static void APIENTRY glad_trace_glPopDebugGroup(void) {
+	glad_trace_pre(737); glad_trace_next_glPopDebugGroup(); glad_trace_post(737);
+}
+static PFNGLOBJECTLABELPROC glad_trace_next_glObjectLabel = NULL;
+static void APIENTRY glad_trace_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	glad_trace_pre(738); glad_trace_next_glObjectLabel(identifier, name, length, label); glad_trace_post(738);
+}
+static PFNGLGETOBJECTLABELPROC glad_trace_next_glGetObjectLabel = NULL;
+static void APIENTRY glad_trace_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_trace_pre(739); glad_trace_next_glGetObjectLabel(identifier, name, bufSize, length, label); glad_trace_post(739);
+}
+static PFNGLOBJECTPTRLABELPROC glad_trace_next_glObjectPtrLabel = NULL;
+static void APIENTRY glad_trace_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	glad_trace_pre(740); glad_trace_next_glObjectPtrLabel(ptr, length, label); glad_trace_post(740);
+}
+static PFNGLGETOBJECTPTRLABELPROC glad_trace_next_glGetObjectPtrLabel = NULL;
+static void APIENTRY glad_trace_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_trace_pre(741); glad_trace_next_glGetObjectPtrLabel(ptr, bufSize, length, label); glad_trace_post(741);
+}
+static void glad_trace_wrap(void) {
+	if(glad_glCullFace != NULL && glad_glCullFace != glad_trace_glCullFace) { glad_trace_next_glCullFace = glad_glCullFace; glad_glCullFace = glad_trace_glCullFace; }
+	if(glad_glFrontFace != NULL && glad_glFrontFace != glad_trace_glFrontFace) { glad_trace_next_glFrontFace = glad_glFrontFace; glad_glFrontFace = glad_trace_glFrontFace; }
+	if(glad_glHint != NULL && glad_glHint != glad_trace_glHint) { glad_trace_next_glHint = glad_glHint; glad_glHint = glad_trace_glHint; }
+	if(glad_glLineWidth != NULL && glad_glLineWidth != glad_trace_glLineWidth) { glad_trace_next_glLineWidth = glad_glLineWidth; glad_glLineWidth = glad_trace_glLineWidth; }
+	if(glad_glPointSize != NULL && glad_glPointSize != glad_trace_glPointSize) { glad_trace_next_glPointSize = glad_glPointSize; glad_glPointSize = glad_trace_glPointSize; }
+	if(glad_glPolygonMode != NULL && glad_glPolygonMode != glad_trace_glPolygonMode) { glad_trace_next_glPolygonMode = glad_glPolygonMode; glad_glPolygonMode = glad_trace_glPolygonMode; }
+	if(glad_glScissor != NULL && glad_glScissor != glad_trace_glScissor) { glad_trace_next_glScissor = glad_glScissor; glad_glScissor = glad_trace_glScissor; }
+	if(glad_glTexParameterf != NULL && glad_glTexParameterf != glad_trace_glTexParameterf) { glad_trace_next_glTexParameterf = glad_glTexParameterf; glad_glTexParameterf = glad_trace_glTexParameterf; }
+	if(glad_glTexParameterfv != NULL && glad_glTexParameterfv != glad_trace_glTexParameterfv) { glad_trace_next_glTexParameterfv = glad_glTexParameterfv; glad_glTexParameterfv = glad_trace_glTexParameterfv; }
+	if(glad_glTexParameteri != NULL && glad_glTexParameteri != glad_trace_glTexParameteri) { glad_trace_next_glTexParameteri = glad_glTexParameteri; glad_glTexParameteri = glad_trace_glTexParameteri; }
+	if(glad_glTexParameteriv != NULL && glad_glTexParameteriv != glad_trace_glTexParameteriv) { glad_trace_next_glTexParameteriv = glad_glTexParameteriv; glad_glTexParameteriv = glad_trace_glTexParameteriv; }
+	if(glad_glTexImage1D != NULL && glad_glTexImage1D != glad_trace_glTexImage1D) { glad_trace_next_glTexImage1D = glad_glTexImage1D; glad_glTexImage1D = glad_trace_glTexImage1D; }
+	if(glad_glTexImage2D != NULL && glad_glTexImage2D != glad_trace_glTexImage2D) { glad_trace_next_glTexImage2D = glad_glTexImage2D; glad_glTexImage2D = glad_trace_glTexImage2D; }
+	if(glad_glDrawBuffer != NULL && glad_glDrawBuffer != glad_trace_glDrawBuffer) { glad_trace_next_glDrawBuffer = glad_glDrawBuffer; glad_glDrawBuffer = glad_trace_glDrawBuffer; }
+	if(glad_glClear != NULL && glad_glClear != glad_trace_glClear) { glad_trace_next_glClear = glad_glClear; glad_glClear = glad_trace_glClear; }
+	if(glad_glClearColor != NULL && glad_glClearColor != glad_trace_glClearColor) { glad_trace_next_glClearColor = glad_glClearColor; glad_glClearColor = glad_trace_glClearColor; }
+	if(glad_glClearStencil != NULL && glad_glClearStencil != glad_trace_glClearStencil) { glad_trace_next_glClearStencil = glad_glClearStencil; glad_glClearStencil = glad_trace_glClearStencil; }
+	if(glad_glClearDepth != NULL && glad_glClearDepth != glad_trace_glClearDepth) { glad_trace_next_glClearDepth = glad_glClearDepth; glad_glClearDepth = glad_trace_glClearDepth; }
+	if(glad_glStencilMask != NULL && glad_glStencilMask != glad_trace_glStencilMask) { glad_trace_next_glStencilMask = glad_glStencilMask; glad_glStencilMask = glad_trace_glStencilMask; }
+	if(glad_glColorMask != NULL && glad_glColorMask != glad_trace_glColorMask) { glad_trace_next_glColorMask = glad_glColorMask; glad_glColorMask = glad_trace_glColorMask; }
+	if(glad_glDepthMask != NULL && glad_glDepthMask != glad_trace_glDepthMask) { glad_trace_next_glDepthMask = glad_glDepthMask; glad_glDepthMask = glad_trace_glDepthMask; }
+	if(glad_glDisable != NULL && glad_glDisable != glad_trace_glDisable) { glad_trace_next_glDisable = glad_glDisable; glad_glDisable = glad_trace_glDisable; }
+	if(glad_glEnable != NULL && glad_glEnable != glad_trace_glEnable) { glad_trace_next_glEnable = glad_glEnable; glad_glEnable = glad_trace_glEnable; }
+	if(glad_glFinish != NULL && glad_glFinish != glad_trace_glFinish) { glad_trace_next_glFinish = glad_glFinish; glad_glFinish = glad_trace_glFinish; }
+	if(glad_glFlush != NULL && glad_glFlush != glad_trace_glFlush) { glad_trace_next_glFlush = glad_glFlush; glad_glFlush = glad_trace_glFlush; }
+	if(glad_glBlendFunc != NULL && glad_glBlendFunc != glad_trace_glBlendFunc) { glad_trace_next_glBlendFunc = glad_glBlendFunc; glad_glBlendFunc = glad_trace_glBlendFunc; }
+	if(glad_glLogicOp != NULL && glad_glLogicOp != glad_trace_glLogicOp) { glad_trace_next_glLogicOp = glad_glLogicOp; glad_glLogicOp = glad_trace_glLogicOp; }
+	if(glad_glStencilFunc != NULL && glad_glStencilFunc != glad_trace_glStencilFunc) { glad_trace_next_glStencilFunc = glad_glStencilFunc; glad_glStencilFunc = glad_trace_glStencilFunc; }
+	if(glad_glStencilOp != NULL && glad_glStencilOp != glad_trace_glStencilOp) { glad_trace_next_glStencilOp = glad_glStencilOp; glad_glStencilOp = glad_trace_glStencilOp; }
+	if(glad_glDepthFunc != NULL && glad_glDepthFunc != glad_trace_glDepthFunc) { glad_trace_next_glDepthFunc = glad_glDepthFunc; glad_glDepthFunc = glad_trace_glDepthFunc; }
+	if(glad_glPixelStoref != NULL && glad_glPixelStoref != glad_trace_glPixelStoref) { glad_trace_next_glPixelStoref = glad_glPixelStoref; glad_glPixelStoref = glad_trace_glPixelStoref; }
+	if(glad_glPixelStorei != NULL && glad_glPixelStorei != glad_trace_glPixelStorei) { glad_trace_next_glPixelStorei = glad_glPixelStorei; glad_glPixelStorei = glad_trace_glPixelStorei; }
+	if(glad_glReadBuffer != NULL && glad_glReadBuffer != glad_trace_glReadBuffer) { glad_trace_next_glReadBuffer = glad_glReadBuffer; glad_glReadBuffer = glad_trace_glReadBuffer; }
+	if(glad_glReadPixels != NULL && glad_glReadPixels != glad_trace_glReadPixels) { glad_trace_next_glReadPixels = glad_glReadPixels; glad_glReadPixels = glad_trace_glReadPixels; }
+	if(glad_glGetBooleanv != NULL && glad_glGetBooleanv != glad_trace_glGetBooleanv) { glad_trace_next_glGetBooleanv = glad_glGetBooleanv; glad_glGetBooleanv = glad_trace_glGetBooleanv; }
+	if(glad_glGetDoublev != NULL && glad_glGetDoublev != glad_trace_glGetDoublev) { glad_trace_next_glGetDoublev = glad_glGetDoublev; glad_glGetDoublev = glad_trace_glGetDoublev; }
+	if(glad_glGetError != NULL && glad_glGetError != glad_trace_glGetError) { glad_trace_next_glGetError = glad_glGetError; glad_glGetError = glad_trace_glGetError; }
+	if(glad_glGetFloatv != NULL && glad_glGetFloatv != glad_trace_glGetFloatv) { glad_trace_next_glGetFloatv = glad_glGetFloatv; glad_glGetFloatv = glad_trace_glGetFloatv; }
+	if(glad_glGetIntegerv != NULL && glad_glGetIntegerv != glad_trace_glGetIntegerv) { glad_trace_next_glGetIntegerv = glad_glGetIntegerv; glad_glGetIntegerv = glad_trace_glGetIntegerv; }
+	if(glad_glGetString != NULL && glad_glGetString != glad_trace_glGetString) { glad_trace_next_glGetString = glad_glGetString; glad_glGetString = glad_trace_glGetString; }
+	if(glad_glGetTexImage != NULL && glad_glGetTexImage != glad_trace_glGetTexImage) { glad_trace_next_glGetTexImage = glad_glGetTexImage; glad_glGetTexImage = glad_trace_glGetTexImage; }
+	if(glad_glGetTexParameterfv != NULL && glad_glGetTexParameterfv != glad_trace_glGetTexParameterfv) { glad_trace_next_glGetTexParameterfv = glad_glGetTexParameterfv; glad_glGetTexParameterfv = glad_trace_glGetTexParameterfv; }
+	if(glad_glGetTexParameteriv != NULL && glad_glGetTexParameteriv != glad_trace_glGetTexParameteriv) { glad_trace_next_glGetTexParameteriv = glad_glGetTexParameteriv; glad_glGetTexParameteriv = glad_trace_glGetTexParameteriv; }
+	if(glad_glGetTexLevelParameterfv != NULL && glad_glGetTexLevelParameterfv != glad_trace_glGetTexLevelParameterfv) { glad_trace_next_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv; glad_glGetTexLevelParameterfv = glad_trace_glGetTexLevelParameterfv; }
+	if(glad_glGetTexLevelParameteriv != NULL && glad_glGetTexLevelParameteriv != glad_trace_glGetTexLevelParameteriv) { glad_trace_next_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv; glad_glGetTexLevelParameteriv = glad_trace_glGetTexLevelParameteriv; }
+	if(glad_glIsEnabled != NULL && glad_glIsEnabled != glad_trace_glIsEnabled) { glad_trace_next_glIsEnabled = glad_glIsEnabled; glad_glIsEnabled = glad_trace_glIsEnabled; }
+	if(glad_glDepthRange != NULL && glad_glDepthRange != glad_trace_glDepthRange) { glad_trace_next_glDepthRange = glad_glDepthRange; glad_glDepthRange = glad_trace_glDepthRange; }
+	if(glad_glViewport != NULL && glad_glViewport != glad_trace_glViewport) { glad_trace_next_glViewport = glad_glViewport; glad_glViewport = glad_trace_glViewport; }
+	if(glad_glNewList != NULL && glad_glNewList != glad_trace_glNewList) { glad_trace_next_glNewList = glad_glNewList; glad_glNewList = glad_trace_glNewList; }
+	if(glad_glEndList != NULL && glad_glEndList != glad_trace_glEndList) { glad_trace_next_glEndList = glad_glEndList; glad_glEndList = glad_trace_glEndList; }
+	if(glad_glCallList != NULL && glad_glCallList != glad_trace_glCallList) { glad_trace_next_glCallList = glad_glCallList; glad_glCallList = glad_trace_glCallList; }
+	if(glad_glCallLists != NULL && glad_glCallLists != glad_trace_glCallLists) { glad_trace_next_glCallLists = glad_glCallLists; glad_glCallLists = glad_trace_glCallLists; }
+	if(glad_glDeleteLists != NULL && glad_glDeleteLists != glad_trace_glDeleteLists) { glad_trace_next_glDeleteLists = glad_glDeleteLists; glad_glDeleteLists = glad_trace_glDeleteLists; }
+	if(glad_glGenLists != NULL && glad_glGenLists != glad_trace_glGenLists) { glad_trace_next_glGenLists = glad_glGenLists; glad_glGenLists = glad_trace_glGenLists; }
+	if(glad_glListBase != NULL && glad_glListBase != glad_trace_glListBase) { glad_trace_next_glListBase = glad_glListBase; glad_glListBase = glad_trace_glListBase; }
+	if(glad_glBegin != NULL && glad_glBegin != glad_trace_glBegin) { glad_trace_next_glBegin = glad_glBegin; glad_glBegin = glad_trace_glBegin; }
+	if(glad_glBitmap != NULL && glad_glBitmap != glad_trace_glBitmap) { glad_trace_next_glBitmap = glad_glBitmap; glad_glBitmap = glad_trace_glBitmap; }
+	if(glad_glColor3b != NULL && glad_glColor3b != glad_trace_glColor3b) { glad_trace_next_glColor3b = glad_glColor3b; glad_glColor3b = glad_trace_glColor3b; }
+	if(glad_glColor3bv != NULL && glad_glColor3bv != glad_trace_glColor3bv) { glad_trace_next_glColor3bv = glad_glColor3bv; glad_glColor3bv = glad_trace_glColor3bv; }
+	if(glad_glColor3d != NULL && glad_glColor3d != glad_trace_glColor3d) { glad_trace_next_glColor3d = glad_glColor3d; glad_glColor3d = glad_trace_glColor3d; }
+	if(glad_glColor3dv != NULL && glad_glColor3dv != glad_trace_glColor3dv) { glad_trace_next_glColor3dv = glad_glColor3dv; glad_glColor3dv = glad_trace_glColor3dv; }
+	if(glad_glColor3f != NULL && glad_glColor3f != glad_trace_glColor3f) { glad_trace_next_glColor3f = glad_glColor3f; glad_glColor3f = glad_trace_glColor3f; }
+	if(glad_glColor3fv != NULL && glad_glColor3fv != glad_trace_glColor3fv) { glad_trace_next_glColor3fv = glad_glColor3fv; glad_glColor3fv = glad_trace_glColor3fv; }
+	if(glad_glColor3i != NULL && glad_glColor3i != glad_trace_glColor3i) { glad_trace_next_glColor3i = glad_glColor3i; glad_glColor3i = glad_trace_glColor3i; }
+	if(glad_glColor3iv != NULL && glad_glColor3iv != glad_trace_glColor3iv) { glad_trace_next_glColor3iv = glad_glColor3iv; glad_glColor3iv = glad_trace_glColor3iv; }
+	if(glad_glColor3s != NULL && glad_glColor3s != glad_trace_glColor3s) { glad_trace_next_glColor3s = glad_glColor3s; glad_glColor3s = glad_trace_glColor3s; }
+	if(glad_glColor3sv != NULL && glad_glColor3sv != glad_trace_glColor3sv) { glad_trace_next_glColor3sv = glad_glColor3sv; glad_glColor3sv = glad_trace_glColor3sv; }
+	if(glad_glColor3ub != NULL && glad_glColor3ub != glad_trace_glColor3ub) { glad_trace_next_glColor3ub = glad_glColor3ub; glad_glColor3ub = glad_trace_glColor3ub; }
+	if(glad_glColor3ubv != NULL && glad_glColor3ubv != glad_trace_glColor3ubv) { glad_trace_next_glColor3ubv = glad_glColor3ubv; glad_glColor3ubv = glad_trace_glColor3ubv; }
+	if(glad_glColor3ui != NULL && glad_glColor3ui != glad_trace_glColor3ui) { glad_trace_next_glColor3ui = glad_glColor3ui; glad_glColor3ui = glad_trace_glColor3ui; }
+	if(glad_glColor3uiv != NULL && glad_glColor3uiv != glad_trace_glColor3uiv) { glad_trace_next_glColor3uiv = glad_glColor3uiv; glad_glColor3uiv = glad_trace_glColor3uiv; }
+	if(glad_glColor3us != NULL && glad_glColor3us != glad_trace_glColor3us) { glad_trace_next_glColor3us = glad_glColor3us; glad_glColor3us = glad_trace_glColor3us; }
+	if(glad_glColor3usv != NULL && glad_glColor3usv != glad_trace_glColor3usv) { glad_trace_next_glColor3usv = glad_glColor3usv; glad_glColor3usv = glad_trace_glColor3usv; }
+	if(glad_glColor4b != NULL && glad_glColor4b != glad_trace_glColor4b) { glad_trace_next_glColor4b = glad_glColor4b; glad_glColor4b = glad_trace_glColor4b; }
+	if(glad_glColor4bv != NULL && glad_glColor4bv != glad_trace_glColor4bv) { glad_trace_next_glColor4bv = glad_glColor4bv; glad_glColor4bv = glad_trace_glColor4bv; }
+	if(glad_glColor4d != NULL && glad_glColor4d != glad_trace_glColor4d) { glad_trace_next_glColor4d = glad_glColor4d; glad_glColor4d = glad_trace_glColor4d; }
+	if(glad_glColor4dv != NULL && glad_glColor4dv != glad_trace_glColor4dv) { glad_trace_next_glColor4dv = glad_glColor4dv; glad_glColor4dv = glad_trace_glColor4dv; }
+	if(glad_glColor4f != NULL && glad_glColor4f != glad_trace_glColor4f) { glad_trace_next_glColor4f = glad_glColor4f; glad_glColor4f = glad_trace_glColor4f; }
+	if(glad_glColor4fv != NULL && glad_glColor4fv != glad_trace_glColor4fv) { glad_trace_next_glColor4fv = glad_glColor4fv; glad_glColor4fv = glad_trace_glColor4fv; }
+	if(glad_glColor4i != NULL && glad_glColor4i != glad_trace_glColor4i) { glad_trace_next_glColor4i = glad_glColor4i; glad_glColor4i = glad_trace_glColor4i; }
+	if(glad_glColor4iv != NULL && glad_glColor4iv != glad_trace_glColor4iv) { glad_trace_next_glColor4iv = glad_glColor4iv; glad_glColor4iv = glad_trace_glColor4iv; }
+	if(glad_glColor4s != NULL && glad_glColor4s != glad_trace_glColor4s) { glad_trace_next_glColor4s = glad_glColor4s; glad_glColor4s = glad_trace_glColor4s; }
+	if(glad_glColor4sv != NULL && glad_glColor4sv != glad_trace_glColor4sv) { glad_trace_next_glColor4sv = glad_glColor4sv; glad_glColor4sv = glad_trace_glColor4sv; }
+	if(glad_glColor4ub != NULL && glad_glColor4ub != glad_trace_glColor4ub) { glad_trace_next_glColor4ub = glad_glColor4ub; glad_glColor4ub = glad_trace_glColor4ub; }
+	if(glad_glColor4ubv != NULL && glad_glColor4ubv != glad_trace_glColor4ubv) { glad_trace_next_glColor4ubv = glad_glColor4ubv; glad_glColor4ubv = glad_trace_glColor4ubv; }
+	if(glad_glColor4ui != NULL && glad_glColor4ui != glad_trace_glColor4ui) { glad_trace_next_glColor4ui = glad_glColor4ui; glad_glColor4ui = glad_trace_glColor4ui; }
+	if(glad_glColor4uiv != NULL && glad_glColor4uiv != glad_trace_glColor4uiv) { glad_trace_next_glColor4uiv = glad_glColor4uiv; glad_glColor4uiv = glad_trace_glColor4uiv; }
+	if(glad_glColor4us != NULL && glad_glColor4us != glad_trace_glColor4us) { glad_trace_next_glColor4us = glad_glColor4us; glad_glColor4us = glad_trace_glColor4us; }
+	if(glad_glColor4usv != NULL && glad_glColor4usv != glad_trace_glColor4usv) { glad_trace_next_glColor4usv = glad_glColor4usv; glad_glColor4usv = glad_trace_glColor4usv; }
+	if(glad_glEdgeFlag != NULL && glad_glEdgeFlag != glad_trace_glEdgeFlag) { glad_trace_next_glEdgeFlag = glad_glEdgeFlag; glad_glEdgeFlag = glad_trace_glEdgeFlag; }
+	if(glad_glEdgeFlagv != NULL && glad_glEdgeFlagv != glad_trace_glEdgeFlagv) { glad_trace_next_glEdgeFlagv = glad_glEdgeFlagv; glad_glEdgeFlagv = glad_trace_glEdgeFlagv; }
+	if(glad_glEnd != NULL && glad_glEnd != glad_trace_glEnd) { glad_trace_next_glEnd = glad_glEnd; glad_glEnd = glad_trace_glEnd; }
+	if(glad_glIndexd != NULL && glad_glIndexd != glad_trace_glIndexd) { glad_trace_next_glIndexd = glad_glIndexd; glad_glIndexd = glad_trace_glIndexd; }
+	if(glad_glIndexdv != NULL && glad_glIndexdv != glad_trace_glIndexdv) { glad_trace_next_glIndexdv = glad_glIndexdv; glad_glIndexdv = glad_trace_glIndexdv; }
+	if(glad_glIndexf != NULL && glad_glIndexf != glad_trace_glIndexf) { glad_trace_next_glIndexf = glad_glIndexf; glad_glIndexf = glad_trace_glIndexf; }
+	if(glad_glIndexfv != NULL && glad_glIndexfv != glad_trace_glIndexfv) { glad_trace_next_glIndexfv = glad_glIndexfv; glad_glIndexfv = glad_trace_glIndexfv; }
+	if(glad_glIndexi != NULL && glad_glIndexi != glad_trace_glIndexi) { glad_trace_next_glIndexi = glad_glIndexi; glad_glIndexi = glad_trace_glIndexi; }
+	if(glad_glIndexiv != NULL && glad_glIndexiv != glad_trace_glIndexiv) { glad_trace_next_glIndexiv = glad_glIndexiv; glad_glIndexiv = glad_trace_glIndexiv; }
+	if(glad_glIndexs != NULL && glad_glIndexs != glad_trace_glIndexs) { glad_trace_next_glIndexs = glad_glIndexs; glad_glIndexs = glad_trace_glIndexs; }
+	if(glad_glIndexsv != NULL && glad_glIndexsv != glad_trace_glIndexsv) { glad_trace_next_glIndexsv = glad_glIndexsv; glad_glIndexsv = glad_trace_glIndexsv; }
+	if(glad_glNormal3b != NULL && glad_glNormal3b != glad_trace_glNormal3b) { glad_trace_next_glNormal3b = glad_glNormal3b; glad_glNormal3b = glad_trace_glNormal3b; }
+	if(glad_glNormal3bv != NULL && glad_glNormal3bv != glad_trace_glNormal3bv) { glad_trace_next_glNormal3bv = glad_glNormal3bv; glad_glNormal3bv = glad_trace_glNormal3bv; }
+	if(glad_glNormal3d != NULL && glad_glNormal3d != glad_trace_glNormal3d) { glad_trace_next_glNormal3d = glad_glNormal3d; glad_glNormal3d = glad_trace_glNormal3d; }
+	if(glad_glNormal3dv != NULL && glad_glNormal3dv != glad_trace_glNormal3dv) { glad_trace_next_glNormal3dv = glad_glNormal3dv; glad_glNormal3dv = glad_trace_glNormal3dv; }
+	if(glad_glNormal3f != NULL && glad_glNormal3f != glad_trace_glNormal3f) { glad_trace_next_glNormal3f = glad_glNormal3f; glad_glNormal3f = glad_trace_glNormal3f; }
+	if(glad_glNormal3fv != NULL && glad_glNormal3fv != glad_trace_glNormal3fv) { glad_trace_next_glNormal3fv = glad_glNormal3fv; glad_glNormal3fv = glad_trace_glNormal3fv; }
+	if(glad_glNormal3i != NULL && glad_glNormal3i != glad_trace_glNormal3i) { glad_trace_next_glNormal3i = glad_glNormal3i; glad_glNormal3i = glad_trace_glNormal3i; }
+	if(glad_glNormal3iv != NULL && glad_glNormal3iv != glad_trace_glNormal3iv) { glad_trace_next_glNormal3iv = glad_glNormal3iv; glad_glNormal3iv = glad_trace_glNormal3iv; }
+	if(glad_glNormal3s != NULL && glad_glNormal3s != glad_trace_glNormal3s) { glad_trace_next_glNormal3s = glad_glNormal3s; glad_glNormal3s = glad_trace_glNormal3s; }
+	if(glad_glNormal3sv != NULL && glad_glNormal3sv != glad_trace_glNormal3sv) { glad_trace_next_glNormal3sv = glad_glNormal3sv; glad_glNormal3sv = glad_trace_glNormal3sv; }
+	if(glad_glRasterPos2d != NULL && glad_glRasterPos2d != glad_trace_glRasterPos2d) { glad_trace_next_glRasterPos2d = glad_glRasterPos2d; glad_glRasterPos2d = glad_trace_glRasterPos2d; }
+	if(glad_glRasterPos2dv != NULL && glad_glRasterPos2dv != glad_trace_glRasterPos2dv) { glad_trace_next_glRasterPos2dv = glad_glRasterPos2dv; glad_glRasterPos2dv = glad_trace_glRasterPos2dv; }
+	if(glad_glRasterPos2f != NULL && glad_glRasterPos2f != glad_trace_glRasterPos2f) { glad_trace_next_glRasterPos2f = glad_glRasterPos2f; glad_glRasterPos2f = glad_trace_glRasterPos2f; }
+	if(glad_glRasterPos2fv != NULL && glad_glRasterPos2fv != glad_trace_glRasterPos2fv) { glad_trace_next_glRasterPos2fv = glad_glRasterPos2fv; glad_glRasterPos2fv = glad_trace_glRasterPos2fv; }
+	if(glad_glRasterPos2i != NULL && glad_glRasterPos2i != glad_trace_glRasterPos2i) { glad_trace_next_glRasterPos2i = glad_glRasterPos2i; glad_glRasterPos2i = glad_trace_glRasterPos2i; }
+	if(glad_glRasterPos2iv != NULL && glad_glRasterPos2iv != glad_trace_glRasterPos2iv) { glad_trace_next_glRasterPos2iv = glad_glRasterPos2iv; glad_glRasterPos2iv = glad_trace_glRasterPos2iv; }
+	if(glad_glRasterPos2s != NULL && glad_glRasterPos2s != glad_trace_glRasterPos2s) { glad_trace_next_glRasterPos2s = glad_glRasterPos2s; glad_glRasterPos2s = glad_trace_glRasterPos2s; }
+	if(glad_glRasterPos2sv != NULL && glad_glRasterPos2sv != glad_trace_glRasterPos2sv) { glad_trace_next_glRasterPos2sv = glad_glRasterPos2sv; glad_glRasterPos2sv = glad_trace_glRasterPos2sv; }
+	if(glad_glRasterPos3d != NULL && glad_glRasterPos3d != glad_trace_glRasterPos3d) { glad_trace_next_glRasterPos3d = glad_glRasterPos3d; glad_glRasterPos3d = glad_trace_glRasterPos3d; }
+	if(glad_glRasterPos3dv != NULL && glad_glRasterPos3dv != glad_trace_glRasterPos3dv) { glad_trace_next_glRasterPos3dv = glad_glRasterPos3dv; glad_glRasterPos3dv = glad_trace_glRasterPos3dv; }
+	if(glad_glRasterPos3f != NULL && glad_glRasterPos3f != glad_trace_glRasterPos3f) { glad_trace_next_glRasterPos3f = glad_glRasterPos3f; glad_glRasterPos3f = glad_trace_glRasterPos3f; }
+	if(glad_glRasterPos3fv != NULL && glad_glRasterPos3fv != glad_trace_glRasterPos3fv) { glad_trace_next_glRasterPos3fv = glad_glRasterPos3fv; glad_glRasterPos3fv = glad_trace_glRasterPos3fv; }
+	if(glad_glRasterPos3i != NULL && glad_glRasterPos3i != glad_trace_glRasterPos3i) { glad_trace_next_glRasterPos3i = glad_glRasterPos3i; glad_glRasterPos3i = glad_trace_glRasterPos3i; }
+	if(glad_glRasterPos3iv != NULL && glad_glRasterPos3iv != glad_trace_glRasterPos3iv) { glad_trace_next_glRasterPos3iv = glad_glRasterPos3iv; glad_glRasterPos3iv = glad_trace_glRasterPos3iv; }
+	if(glad_glRasterPos3s != NULL && glad_glRasterPos3s != glad_trace_glRasterPos3s) { glad_trace_next_glRasterPos3s = glad_glRasterPos3s; glad_glRasterPos3s = glad_trace_glRasterPos3s; }
+	if(glad_glRasterPos3sv != NULL && glad_glRasterPos3sv != glad_trace_glRasterPos3sv) { glad_trace_next_glRasterPos3sv = glad_glRasterPos3sv; glad_glRasterPos3sv = glad_trace_glRasterPos3sv; }
+	if(glad_glRasterPos4d != NULL && glad_glRasterPos4d != glad_trace_glRasterPos4d) { glad_trace_next_glRasterPos4d = glad_glRasterPos4d; glad_glRasterPos4d = glad_trace_glRasterPos4d; }
+	if(glad_glRasterPos4dv != NULL && glad_glRasterPos4dv != glad_trace_glRasterPos4dv) { glad_trace_next_glRasterPos4dv = glad_glRasterPos4dv; glad_glRasterPos4dv = glad_trace_glRasterPos4dv; }
+	if(glad_glRasterPos4f != NULL && glad_glRasterPos4f != glad_trace_glRasterPos4f) { glad_trace_next_glRasterPos4f = glad_glRasterPos4f; glad_glRasterPos4f = glad_trace_glRasterPos4f; }
+	if(glad_glRasterPos4fv != NULL && glad_glRasterPos4fv != glad_trace_glRasterPos4fv) { glad_trace_next_glRasterPos4fv = glad_glRasterPos4fv; glad_glRasterPos4fv = glad_trace_glRasterPos4fv; }
+	if(glad_glRasterPos4i != NULL && glad_glRasterPos4i != glad_trace_glRasterPos4i) { glad_trace_next_glRasterPos4i = glad_glRasterPos4i; glad_glRasterPos4i = glad_trace_glRasterPos4i; }
+	if(glad_glRasterPos4iv != NULL && glad_glRasterPos4iv != glad_trace_glRasterPos4iv) { glad_trace_next_glRasterPos4iv = glad_glRasterPos4iv; glad_glRasterPos4iv = glad_trace_glRasterPos4iv; }
+	if(glad_glRasterPos4s != NULL && glad_glRasterPos4s != glad_trace_glRasterPos4s) { glad_trace_next_glRasterPos4s = glad_glRasterPos4s; glad_glRasterPos4s = glad_trace_glRasterPos4s; }
+	if(glad_glRasterPos4sv != NULL && glad_glRasterPos4sv != glad_trace_glRasterPos4sv) { glad_trace_next_glRasterPos4sv = glad_glRasterPos4sv; glad_glRasterPos4sv = glad_trace_glRasterPos4sv; }
+	if(glad_glRectd != NULL && glad_glRectd != glad_trace_glRectd) { glad_trace_next_glRectd = glad_glRectd; glad_glRectd = glad_trace_glRectd; }
+	if(glad_glRectdv != NULL && glad_glRectdv != glad_trace_glRectdv) { glad_trace_next_glRectdv = glad_glRectdv; glad_glRectdv = glad_trace_glRectdv; }
+	if(glad_glRectf != NULL && glad_glRectf != glad_trace_glRectf) { glad_trace_next_glRectf = glad_glRectf; glad_glRectf = glad_trace_glRectf; }
+	if(glad_glRectfv != NULL && glad_glRectfv != glad_trace_glRectfv) { glad_trace_next_glRectfv = glad_glRectfv; glad_glRectfv = glad_trace_glRectfv; }
+	if(glad_glRecti != NULL && glad_glRecti != glad_trace_glRecti) { glad_trace_next_glRecti = glad_glRecti; glad_glRecti = glad_trace_glRecti; }
+	if(glad_glRectiv != NULL && glad_glRectiv != glad_trace_glRectiv) { glad_trace_next_glRectiv = glad_glRectiv; glad_glRectiv = glad_trace_glRectiv; }
+	if(glad_glRects != NULL && glad_glRects != glad_trace_glRects) { glad_trace_next_glRects = glad_glRects; glad_glRects = glad_trace_glRects; }
+	if(glad_glRectsv != NULL && glad_glRectsv != glad_trace_glRectsv) { glad_trace_next_glRectsv = glad_glRectsv; glad_glRectsv = glad_trace_glRectsv; }
+	if(glad_glTexCoord1d != NULL && glad_glTexCoord1d != glad_trace_glTexCoord1d) { glad_trace_next_glTexCoord1d = glad_glTexCoord1d; glad_glTexCoord1d = glad_trace_glTexCoord1d; }
+	if(glad_glTexCoord1dv != NULL && glad_glTexCoord1dv != glad_trace_glTexCoord1dv) { glad_trace_next_glTexCoord1dv = glad_glTexCoord1dv; glad_glTexCoord1dv = glad_trace_glTexCoord1dv; }
+	if(glad_glTexCoord1f != NULL && glad_glTexCoord1f != glad_trace_glTexCoord1f) { glad_trace_next_glTexCoord1f = glad_glTexCoord1f; glad_glTexCoord1f = glad_trace_glTexCoord1f; }
+	if(glad_glTexCoord1fv != NULL && glad_glTexCoord1fv != glad_trace_glTexCoord1fv) { glad_trace_next_glTexCoord1fv = glad_glTexCoord1fv; glad_glTexCoord1fv = glad_trace_glTexCoord1fv; }
+	if(glad_glTexCoord1i != NULL && glad_glTexCoord1i != glad_trace_glTexCoord1i) { glad_trace_next_glTexCoord1i = glad_glTexCoord1i; glad_glTexCoord1i = glad_trace_glTexCoord1i; }
+	if(glad_glTexCoord1iv != NULL && glad_glTexCoord1iv != glad_trace_glTexCoord1iv) { glad_trace_next_glTexCoord1iv = glad_glTexCoord1iv; glad_glTexCoord1iv = glad_trace_glTexCoord1iv; }
+	if(glad_glTexCoord1s != NULL && glad_glTexCoord1s != glad_trace_glTexCoord1s) { glad_trace_next_glTexCoord1s = glad_glTexCoord1s; glad_glTexCoord1s = glad_trace_glTexCoord1s; }
+	if(glad_glTexCoord1sv != NULL && glad_glTexCoord1sv != glad_trace_glTexCoord1sv) { glad_trace_next_glTexCoord1sv = glad_glTexCoord1sv; glad_glTexCoord1sv = glad_trace_glTexCoord1sv; }
+	if(glad_glTexCoord2d != NULL && glad_glTexCoord2d != glad_trace_glTexCoord2d) { glad_trace_next_glTexCoord2d = glad_glTexCoord2d; glad_glTexCoord2d = glad_trace_glTexCoord2d; }
+	if(glad_glTexCoord2dv != NULL && glad_glTexCoord2dv != glad_trace_glTexCoord2dv) { glad_trace_next_glTexCoord2dv = glad_glTexCoord2dv; glad_glTexCoord2dv = glad_trace_glTexCoord2dv; }
+	if(glad_glTexCoord2f != NULL && glad_glTexCoord2f != glad_trace_glTexCoord2f) { glad_trace_next_glTexCoord2f = glad_glTexCoord2f; glad_glTexCoord2f = glad_trace_glTexCoord2f; }
+	if(glad_glTexCoord2fv != NULL && glad_glTexCoord2fv != glad_trace_glTexCoord2fv) { glad_trace_next_glTexCoord2fv = glad_glTexCoord2fv; glad_glTexCoord2fv = glad_trace_glTexCoord2fv; }
+	if(glad_glTexCoord2i != NULL && glad_glTexCoord2i != glad_trace_glTexCoord2i) { glad_trace_next_glTexCoord2i = glad_glTexCoord2i; glad_glTexCoord2i = glad_trace_glTexCoord2i; }
+	if(glad_glTexCoord2iv != NULL && glad_glTexCoord2iv != glad_trace_glTexCoord2iv) { glad_trace_next_glTexCoord2iv = glad_glTexCoord2iv; glad_glTexCoord2iv = glad_trace_glTexCoord2iv; }
+	if(glad_glTexCoord2s != NULL && glad_glTexCoord2s != glad_trace_glTexCoord2s) { glad_trace_next_glTexCoord2s = glad_glTexCoord2s; glad_glTexCoord2s = glad_trace_glTexCoord2s; }
+	if(glad_glTexCoord2sv != NULL && glad_glTexCoord2sv != glad_trace_glTexCoord2sv) { glad_trace_next_glTexCoord2sv = glad_glTexCoord2sv; glad_glTexCoord2sv = glad_trace_glTexCoord2sv; }
+	if(glad_glTexCoord3d != NULL && glad_glTexCoord3d != glad_trace_glTexCoord3d) { glad_trace_next_glTexCoord3d = glad_glTexCoord3d; glad_glTexCoord3d = glad_trace_glTexCoord3d; }
+	if(glad_glTexCoord3dv != NULL && glad_glTexCoord3dv != glad_trace_glTexCoord3dv) { glad_trace_next_glTexCoord3dv = glad_glTexCoord3dv; glad_glTexCoord3dv = glad_trace_glTexCoord3dv; }
+	if(glad_glTexCoord3f != NULL && glad_glTexCoord3f != glad_trace_glTexCoord3f) { glad_trace_next_glTexCoord3f = glad_glTexCoord3f; glad_glTexCoord3f = glad_trace_glTexCoord3f; }
+	if(glad_glTexCoord3fv != NULL && glad_glTexCoord3fv != glad_trace_glTexCoord3fv) { glad_trace_next_glTexCoord3fv = glad_glTexCoord3fv; glad_glTexCoord3fv = glad_trace_glTexCoord3fv; }
+	if(glad_glTexCoord3i != NULL && glad_glTexCoord3i != glad_trace_glTexCoord3i) { glad_trace_next_glTexCoord3i = glad_glTexCoord3i; glad_glTexCoord3i = glad_trace_glTexCoord3i; }
+	if(glad_glTexCoord3iv != NULL && glad_glTexCoord3iv != glad_trace_glTexCoord3iv) { glad_trace_next_glTexCoord3iv = glad_glTexCoord3iv; glad_glTexCoord3iv = glad_trace_glTexCoord3iv; }
+	if(glad_glTexCoord3s != NULL && glad_glTexCoord3s != glad_trace_glTexCoord3s) { glad_trace_next_glTexCoord3s = glad_glTexCoord3s; glad_glTexCoord3s = glad_trace_glTexCoord3s; }
+	if(glad_glTexCoord3sv != NULL && glad_glTexCoord3sv != glad_trace_glTexCoord3sv) { glad_trace_next_glTexCoord3sv = glad_glTexCoord3sv; glad_glTexCoord3sv = glad_trace_glTexCoord3sv; }
+	if(glad_glTexCoord4d != NULL && glad_glTexCoord4d != glad_trace_glTexCoord4d) { glad_trace_next_glTexCoord4d = glad_glTexCoord4d; glad_glTexCoord4d = glad_trace_glTexCoord4d; }
+	if(glad_glTexCoord4dv != NULL && glad_glTexCoord4dv != glad_trace_glTexCoord4dv) { glad_trace_next_glTexCoord4dv = glad_glTexCoord4dv; glad_glTexCoord4dv = glad_trace_glTexCoord4dv; }
+	if(glad_glTexCoord4f != NULL && glad_glTexCoord4f != glad_trace_glTexCoord4f) { glad_trace_next_glTexCoord4f = glad_glTexCoord4f; glad_glTexCoord4f = glad_trace_glTexCoord4f; }
+	if(glad_glTexCoord4fv != NULL && glad_glTexCoord4fv != glad_trace_glTexCoord4fv) { glad_trace_next_glTexCoord4fv = glad_glTexCoord4fv; glad_glTexCoord4fv = glad_trace_glTexCoord4fv; }
+	if(glad_glTexCoord4i != NULL && glad_glTexCoord4i != glad_trace_glTexCoord4i) { glad_trace_next_glTexCoord4i = glad_glTexCoord4i; glad_glTexCoord4i = glad_trace_glTexCoord4i; }
+	if(glad_glTexCoord4iv != NULL && glad_glTexCoord4iv != glad_trace_glTexCoord4iv) { glad_trace_next_glTexCoord4iv = glad_glTexCoord4iv; glad_glTexCoord4iv = glad_trace_glTexCoord4iv; }
+	if(glad_glTexCoord4s != NULL && glad_glTexCoord4s != glad_trace_glTexCoord4s) { glad_trace_next_glTexCoord4s = glad_glTexCoord4s; glad_glTexCoord4s = glad_trace_glTexCoord4s; }
+	if(glad_glTexCoord4sv != NULL && glad_glTexCoord4sv != glad_trace_glTexCoord4sv) { glad_trace_next_glTexCoord4sv = glad_glTexCoord4sv; glad_glTexCoord4sv = glad_trace_glTexCoord4sv; }
+	if(glad_glVertex2d != NULL && glad_glVertex2d != glad_trace_glVertex2d) { glad_trace_next_glVertex2d = glad_glVertex2d; glad_glVertex2d = glad_trace_glVertex2d; }
+	if(glad_glVertex2dv != NULL && glad_glVertex2dv != glad_trace_glVertex2dv) { glad_trace_next_glVertex2dv = glad_glVertex2dv; glad_glVertex2dv = glad_trace_glVertex2dv; }
+	if(glad_glVertex2f != NULL && glad_glVertex2f != glad_trace_glVertex2f) { glad_trace_next_glVertex2f = glad_glVertex2f; glad_glVertex2f = glad_trace_glVertex2f; }
+	if(glad_glVertex2fv != NULL && glad_glVertex2fv != glad_trace_glVertex2fv) { glad_trace_next_glVertex2fv = glad_glVertex2fv; glad_glVertex2fv = glad_trace_glVertex2fv; }
+	if(glad_glVertex2i != NULL && glad_glVertex2i != glad_trace_glVertex2i) { glad_trace_next_glVertex2i = glad_glVertex2i; glad_glVertex2i = glad_trace_glVertex2i; }
+	if(glad_glVertex2iv != NULL && glad_glVertex2iv != glad_trace_glVertex2iv) { glad_trace_next_glVertex2iv = glad_glVertex2iv; glad_glVertex2iv = glad_trace_glVertex2iv; }
+	if(glad_glVertex2s != NULL && glad_glVertex2s != glad_trace_glVertex2s) { glad_trace_next_glVertex2s = glad_glVertex2s; glad_glVertex2s = glad_trace_glVertex2s; }
+	if(glad_glVertex2sv != NULL && glad_glVertex2sv != glad_trace_glVertex2sv) { glad_trace_next_glVertex2sv = glad_glVertex2sv; glad_glVertex2sv = glad_trace_glVertex2sv; }
+	if(glad_glVertex3d != NULL && glad_glVertex3d != glad_trace_glVertex3d) { glad_trace_next_glVertex3d = glad_glVertex3d; glad_glVertex3d = glad_trace_glVertex3d; }
+	if(glad_glVertex3dv != NULL && glad_glVertex3dv != glad_trace_glVertex3dv) { glad_trace_next_glVertex3dv = glad_glVertex3dv; glad_glVertex3dv = glad_trace_glVertex3dv; }
+	if(glad_glVertex3f != NULL && glad_glVertex3f != glad_trace_glVertex3f) { glad_trace_next_glVertex3f = glad_glVertex3f; glad_glVertex3f = glad_trace_glVertex3f; }
+	if(glad_glVertex3fv != NULL && glad_glVertex3fv != glad_trace_glVertex3fv) { glad_trace_next_glVertex3fv = glad_glVertex3fv; glad_glVertex3fv = glad_trace_glVertex3fv; }
+	if(glad_glVertex3i != NULL && glad_glVertex3i != glad_trace_glVertex3i) { glad_trace_next_glVertex3i = glad_glVertex3i; glad_glVertex3i = glad_trace_glVertex3i; }
+	if(glad_glVertex3iv != NULL && glad_glVertex3iv != glad_trace_glVertex3iv) { glad_trace_next_glVertex3iv = glad_glVertex3iv; glad_glVertex3iv = glad_trace_glVertex3iv; }
+	if(glad_glVertex3s != NULL && glad_glVertex3s != glad_trace_glVertex3s) { glad_trace_next_glVertex3s = glad_glVertex3s; glad_glVertex3s = glad_trace_glVertex3s; }
+	if(glad_glVertex3sv != NULL && glad_glVertex3sv != glad_trace_glVertex3sv) { glad_trace_next_glVertex3sv = glad_glVertex3sv; glad_glVertex3sv = glad_trace_glVertex3sv; }
+	if(glad_glVertex4d != NULL && glad_glVertex4d != glad_trace_glVertex4d) { glad_trace_next_glVertex4d = glad_glVertex4d; glad_glVertex4d = glad_trace_glVertex4d; }
+	if(glad_glVertex4dv != NULL && glad_glVertex4dv != glad_trace_glVertex4dv) { glad_trace_next_glVertex4dv = glad_glVertex4dv; glad_glVertex4dv = glad_trace_glVertex4dv; }
+	if(glad_glVertex4f != NULL && glad_glVertex4f != glad_trace_glVertex4f) { glad_trace_next_glVertex4f = glad_glVertex4f; glad_glVertex4f = glad_trace_glVertex4f; }
+	if(glad_glVertex4fv != NULL && glad_glVertex4fv != glad_trace_glVertex4fv) { glad_trace_next_glVertex4fv = glad_glVertex4fv; glad_glVertex4fv = glad_trace_glVertex4fv; }
+	if(glad_glVertex4i != NULL && glad_glVertex4i != glad_trace_glVertex4i) { glad_trace_next_glVertex4i = glad_glVertex4i; glad_glVertex4i = glad_trace_glVertex4i; }
+	if(glad_glVertex4iv != NULL && glad_glVertex4iv != glad_trace_glVertex4iv) { glad_trace_next_glVertex4iv = glad_glVertex4iv; glad_glVertex4iv = glad_trace_glVertex4iv; }
+	if(glad_glVertex4s != NULL && glad_glVertex4s != glad_trace_glVertex4s) { glad_trace_next_glVertex4s = glad_glVertex4s; glad_glVertex4s = glad_trace_glVertex4s; }
+	if(glad_glVertex4sv != NULL && glad_glVertex4sv != glad_trace_glVertex4sv) { glad_trace_next_glVertex4sv = glad_glVertex4sv; glad_glVertex4sv = glad_trace_glVertex4sv; }
+	if(glad_glClipPlane != NULL && glad_glClipPlane != glad_trace_glClipPlane) { glad_trace_next_glClipPlane = glad_glClipPlane; glad_glClipPlane = glad_trace_glClipPlane; }
+	if(glad_glColorMaterial != NULL && glad_glColorMaterial != glad_trace_glColorMaterial) { glad_trace_next_glColorMaterial = glad_glColorMaterial; glad_glColorMaterial = glad_trace_glColorMaterial; }
+	if(glad_glFogf != NULL && glad_glFogf != glad_trace_glFogf) { glad_trace_next_glFogf = glad_glFogf; glad_glFogf = glad_trace_glFogf; }
+	if(glad_glFogfv != NULL && glad_glFogfv != glad_trace_glFogfv) { glad_trace_next_glFogfv = glad_glFogfv; glad_glFogfv = glad_trace_glFogfv; }
+	if(glad_glFogi != NULL && glad_glFogi != glad_trace_glFogi) { glad_trace_next_glFogi = glad_glFogi; glad_glFogi = glad_trace_glFogi; }
+	if(glad_glFogiv != NULL && glad_glFogiv != glad_trace_glFogiv) { glad_trace_next_glFogiv = glad_glFogiv; glad_glFogiv = glad_trace_glFogiv; }
+	if(glad_glLightf != NULL && glad_glLightf != glad_trace_glLightf) { glad_trace_next_glLightf = glad_glLightf; glad_glLightf = glad_trace_glLightf; }
+	if(glad_glLightfv != NULL && glad_glLightfv != glad_trace_glLightfv) { glad_trace_next_glLightfv = glad_glLightfv; glad_glLightfv = glad_trace_glLightfv; }
+	if(glad_glLighti != NULL && glad_glLighti != glad_trace_glLighti) { glad_trace_next_glLighti = glad_glLighti; glad_glLighti = glad_trace_glLighti; }
+	if(glad_glLightiv != NULL && glad_glLightiv != glad_trace_glLightiv) { glad_trace_next_glLightiv = glad_glLightiv; glad_glLightiv = glad_trace_glLightiv; }
+	if(glad_glLightModelf != NULL && glad_glLightModelf != glad_trace_glLightModelf) { glad_trace_next_glLightModelf = glad_glLightModelf; glad_glLightModelf = glad_trace_glLightModelf; }
+	if(glad_glLightModelfv != NULL && glad_glLightModelfv != glad_trace_glLightModelfv) { glad_trace_next_glLightModelfv = glad_glLightModelfv; glad_glLightModelfv = glad_trace_glLightModelfv; }
+	if(glad_glLightModeli != NULL && glad_glLightModeli != glad_trace_glLightModeli) { glad_trace_next_glLightModeli = glad_glLightModeli; glad_glLightModeli = glad_trace_glLightModeli; }
+	if(glad_glLightModeliv != NULL && glad_glLightModeliv != glad_trace_glLightModeliv) { glad_trace_next_glLightModeliv = glad_glLightModeliv; glad_glLightModeliv = glad_trace_glLightModeliv; }
+	if(glad_glLineStipple != NULL && glad_glLineStipple != glad_trace_glLineStipple) { glad_trace_next_glLineStipple = glad_glLineStipple; glad_glLineStipple = glad_trace_glLineStipple; }
+	if(glad_glMaterialf != NULL && glad_glMaterialf != glad_trace_glMaterialf) { glad_trace_next_glMaterialf = glad_glMaterialf; glad_glMaterialf = glad_trace_glMaterialf; }
+	if(glad_glMaterialfv != NULL && glad_glMaterialfv != glad_trace_glMaterialfv) { glad_trace_next_glMaterialfv = glad_glMaterialfv; glad_glMaterialfv = glad_trace_glMaterialfv; }
+	if(glad_glMateriali != NULL && glad_glMateriali != glad_trace_glMateriali) { glad_trace_next_glMateriali = glad_glMateriali; glad_glMateriali = glad_trace_glMateriali; }
+	if(glad_glMaterialiv != NULL && glad_glMaterialiv != glad_trace_glMaterialiv) { glad_trace_next_glMaterialiv = glad_glMaterialiv; glad_glMaterialiv = glad_trace_glMaterialiv; }
+	if(glad_glPolygonStipple != NULL && glad_glPolygonStipple != glad_trace_glPolygonStipple) { glad_trace_next_glPolygonStipple = glad_glPolygonStipple; glad_glPolygonStipple = glad_trace_glPolygonStipple; }
+	if(glad_glShadeModel != NULL && glad_glShadeModel != glad_trace_glShadeModel) { glad_trace_next_glShadeModel = glad_glShadeModel; glad_glShadeModel = glad_trace_glShadeModel; }
+	if(glad_glTexEnvf != NULL && glad_glTexEnvf != glad_trace_glTexEnvf) { glad_trace_next_glTexEnvf = glad_glTexEnvf; glad_glTexEnvf = glad_trace_glTexEnvf; }
+	if(glad_glTexEnvfv != NULL && glad_glTexEnvfv != glad_trace_glTexEnvfv) { glad_trace_next_glTexEnvfv = glad_glTexEnvfv; glad_glTexEnvfv = glad_trace_glTexEnvfv; }
+	if(glad_glTexEnvi != NULL && glad_glTexEnvi != glad_trace_glTexEnvi) { glad_trace_next_glTexEnvi = glad_glTexEnvi; glad_glTexEnvi = glad_trace_glTexEnvi; }
+	if(glad_glTexEnviv != NULL && glad_glTexEnviv != glad_trace_glTexEnviv) { glad_trace_next_glTexEnviv = glad_glTexEnviv; glad_glTexEnviv = glad_trace_glTexEnviv; }
+	if(glad_glTexGend != NULL && glad_glTexGend != glad_trace_glTexGend) { glad_trace_next_glTexGend = glad_glTexGend; glad_glTexGend = glad_trace_glTexGend; }
+	if(glad_glTexGendv != NULL && glad_glTexGendv != glad_trace_glTexGendv) { glad_trace_next_glTexGendv = glad_glTexGendv; glad_glTexGendv = glad_trace_glTexGendv; }
+	if(glad_glTexGenf != NULL && glad_glTexGenf != glad_trace_glTexGenf) { glad_trace_next_glTexGenf = glad_glTexGenf; glad_glTexGenf = glad_trace_glTexGenf; }
+	if(glad_glTexGenfv != NULL && glad_glTexGenfv != glad_trace_glTexGenfv) { glad_trace_next_glTexGenfv = glad_glTexGenfv; glad_glTexGenfv = glad_trace_glTexGenfv; }
+	if(glad_glTexGeni != NULL && glad_glTexGeni != glad_trace_glTexGeni) { glad_trace_next_glTexGeni = glad_glTexGeni; glad_glTexGeni = glad_trace_glTexGeni; }
+	if(glad_glTexGeniv != NULL && glad_glTexGeniv != glad_trace_glTexGeniv) { glad_trace_next_glTexGeniv = glad_glTexGeniv; glad_glTexGeniv = glad_trace_glTexGeniv; }
+	if(glad_glFeedbackBuffer != NULL && glad_glFeedbackBuffer != glad_trace_glFeedbackBuffer) { glad_trace_next_glFeedbackBuffer = glad_glFeedbackBuffer; glad_glFeedbackBuffer = glad_trace_glFeedbackBuffer; }
+	if(glad_glSelectBuffer != NULL && glad_glSelectBuffer != glad_trace_glSelectBuffer) { glad_trace_next_glSelectBuffer = glad_glSelectBuffer; glad_glSelectBuffer = glad_trace_glSelectBuffer; }
+	if(glad_glRenderMode != NULL && glad_glRenderMode != glad_trace_glRenderMode) { glad_trace_next_glRenderMode = glad_glRenderMode; glad_glRenderMode = glad_trace_glRenderMode; }
+	if(glad_glInitNames != NULL && glad_glInitNames != glad_trace_glInitNames) { glad_trace_next_glInitNames = glad_glInitNames; glad_glInitNames = glad_trace_glInitNames; }
+	if(glad_glLoadName != NULL && glad_glLoadName != glad_trace_glLoadName) { glad_trace_next_glLoadName = glad_glLoadName; glad_glLoadName = glad_trace_glLoadName; }
+	if(glad_glPassThrough != NULL && glad_glPassThrough != glad_trace_glPassThrough) { glad_trace_next_glPassThrough = glad_glPassThrough; glad_glPassThrough = glad_trace_glPassThrough; }
+	if(glad_glPopName != NULL && glad_glPopName != glad_trace_glPopName) { glad_trace_next_glPopName = glad_glPopName; glad_glPopName = glad_trace_glPopName; }
+	if(glad_glPushName != NULL && glad_glPushName != glad_trace_glPushName) { glad_trace_next_glPushName = glad_glPushName; glad_glPushName = glad_trace_glPushName; }
+	if(glad_glClearAccum != NULL && glad_glClearAccum != glad_trace_glClearAccum) { glad_trace_next_glClearAccum = glad_glClearAccum; glad_glClearAccum = glad_trace_glClearAccum; }
+	if(glad_glClearIndex != NULL && glad_glClearIndex != glad_trace_glClearIndex) { glad_trace_next_glClearIndex = glad_glClearIndex; glad_glClearIndex = glad_trace_glClearIndex; }
+	if(glad_glIndexMask != NULL && glad_glIndexMask != glad_trace_glIndexMask) { glad_trace_next_glIndexMask = glad_glIndexMask; glad_glIndexMask = glad_trace_glIndexMask; }
+	if(glad_glAccum != NULL && glad_glAccum != glad_trace_glAccum) { glad_trace_next_glAccum = glad_glAccum; glad_glAccum = glad_trace_glAccum; }
+	if(glad_glPopAttrib != NULL && glad_glPopAttrib != glad_trace_glPopAttrib) { glad_trace_next_glPopAttrib = glad_glPopAttrib; glad_glPopAttrib = glad_trace_glPopAttrib; }
+	if(glad_glPushAttrib != NULL && glad_glPushAttrib != glad_trace_glPushAttrib) { glad_trace_next_glPushAttrib = glad_glPushAttrib; glad_glPushAttrib = glad_trace_glPushAttrib; }
+	if(glad_glMap1d != NULL && glad_glMap1d != glad_trace_glMap1d) { glad_trace_next_glMap1d = glad_glMap1d; glad_glMap1d = glad_trace_glMap1d; }
+	if(glad_glMap1f != NULL && glad_glMap1f != glad_trace_glMap1f) { glad_trace_next_glMap1f = glad_glMap1f; glad_glMap1f = glad_trace_glMap1f; }
+	if(glad_glMap2d != NULL && glad_glMap2d != glad_trace_glMap2d) { glad_trace_next_glMap2d = glad_glMap2d; glad_glMap2d = glad_trace_glMap2d; }
+	if(glad_glMap2f != NULL && glad_glMap2f != glad_trace_glMap2f) { glad_trace_next_glMap2f = glad_glMap2f; glad_glMap2f = glad_trace_glMap2f; }
+	if(glad_glMapGrid1d != NULL && glad_glMapGrid1d != glad_trace_glMapGrid1d) { glad_trace_next_glMapGrid1d = glad_glMapGrid1d; glad_glMapGrid1d = glad_trace_glMapGrid1d; }
+	if(glad_glMapGrid1f != NULL && glad_glMapGrid1f != glad_trace_glMapGrid1f) { glad_trace_next_glMapGrid1f = glad_glMapGrid1f; glad_glMapGrid1f = glad_trace_glMapGrid1f; }
+	if(glad_glMapGrid2d != NULL && glad_glMapGrid2d != glad_trace_glMapGrid2d) { glad_trace_next_glMapGrid2d = glad_glMapGrid2d; glad_glMapGrid2d = glad_trace_glMapGrid2d; }
+	if(glad_glMapGrid2f != NULL && glad_glMapGrid2f != glad_trace_glMapGrid2f) { glad_trace_next_glMapGrid2f = glad_glMapGrid2f; glad_glMapGrid2f = glad_trace_glMapGrid2f; }
+	if(glad_glEvalCoord1d != NULL && glad_glEvalCoord1d != glad_trace_glEvalCoord1d) { glad_trace_next_glEvalCoord1d = glad_glEvalCoord1d; glad_glEvalCoord1d = glad_trace_glEvalCoord1d; }
+	if(glad_glEvalCoord1dv != NULL && glad_glEvalCoord1dv != glad_trace_glEvalCoord1dv) { glad_trace_next_glEvalCoord1dv = glad_glEvalCoord1dv; glad_glEvalCoord1dv = glad_trace_glEvalCoord1dv; }
+	if(glad_glEvalCoord1f != NULL && glad_glEvalCoord1f != glad_trace_glEvalCoord1f) { glad_trace_next_glEvalCoord1f = glad_glEvalCoord1f; glad_glEvalCoord1f = glad_trace_glEvalCoord1f; }
+	if(glad_glEvalCoord1fv != NULL && glad_glEvalCoord1fv != glad_trace_glEvalCoord1fv) { glad_trace_next_glEvalCoord1fv = glad_glEvalCoord1fv; glad_glEvalCoord1fv = glad_trace_glEvalCoord1fv; }
+	if(glad_glEvalCoord2d != NULL && glad_glEvalCoord2d != glad_trace_glEvalCoord2d) { glad_trace_next_glEvalCoord2d = glad_glEvalCoord2d; glad_glEvalCoord2d = glad_trace_glEvalCoord2d; }
+	if(glad_glEvalCoord2dv != NULL && glad_glEvalCoord2dv != glad_trace_glEvalCoord2dv) { glad_trace_next_glEvalCoord2dv = glad_glEvalCoord2dv; glad_glEvalCoord2dv = glad_trace_glEvalCoord2dv; }
+	if(glad_glEvalCoord2f != NULL && glad_glEvalCoord2f != glad_trace_glEvalCoord2f) { glad_trace_next_glEvalCoord2f = glad_glEvalCoord2f; glad_glEvalCoord2f = glad_trace_glEvalCoord2f; }
+	if(glad_glEvalCoord2fv != NULL && glad_glEvalCoord2fv != glad_trace_glEvalCoord2fv) { glad_trace_next_glEvalCoord2fv = glad_glEvalCoord2fv; glad_glEvalCoord2fv = glad_trace_glEvalCoord2fv; }
+	if(glad_glEvalMesh1 != NULL && glad_glEvalMesh1 != glad_trace_glEvalMesh1) { glad_trace_next_glEvalMesh1 = glad_glEvalMesh1; glad_glEvalMesh1 = glad_trace_glEvalMesh1; }
+	if(glad_glEvalPoint1 != NULL && glad_glEvalPoint1 != glad_trace_glEvalPoint1) { glad_trace_next_glEvalPoint1 = glad_glEvalPoint1; glad_glEvalPoint1 = glad_trace_glEvalPoint1; }
+	if(glad_glEvalMesh2 != NULL && glad_glEvalMesh2 != glad_trace_glEvalMesh2) { glad_trace_next_glEvalMesh2 = glad_glEvalMesh2; glad_glEvalMesh2 = glad_trace_glEvalMesh2; }
+	if(glad_glEvalPoint2 != NULL && glad_glEvalPoint2 != glad_trace_glEvalPoint2) { glad_trace_next_glEvalPoint2 = glad_glEvalPoint2; glad_glEvalPoint2 = glad_trace_glEvalPoint2; }
+	if(glad_glAlphaFunc != NULL && glad_glAlphaFunc != glad_trace_glAlphaFunc) { glad_trace_next_glAlphaFunc = glad_glAlphaFunc; glad_glAlphaFunc = glad_trace_glAlphaFunc; }
+	if(glad_glPixelZoom != NULL && glad_glPixelZoom != glad_trace_glPixelZoom) { glad_trace_next_glPixelZoom = glad_glPixelZoom; glad_glPixelZoom = glad_trace_glPixelZoom; }
+	if(glad_glPixelTransferf != NULL && glad_glPixelTransferf != glad_trace_glPixelTransferf) { glad_trace_next_glPixelTransferf = glad_glPixelTransferf; glad_glPixelTransferf = glad_trace_glPixelTransferf; }
+	if(glad_glPixelTransferi != NULL && glad_glPixelTransferi != glad_trace_glPixelTransferi) { glad_trace_next_glPixelTransferi = glad_glPixelTransferi; glad_glPixelTransferi = glad_trace_glPixelTransferi; }
+	if(glad_glPixelMapfv != NULL && glad_glPixelMapfv != glad_trace_glPixelMapfv) { glad_trace_next_glPixelMapfv = glad_glPixelMapfv; glad_glPixelMapfv = glad_trace_glPixelMapfv; }
+	if(glad_glPixelMapuiv != NULL && glad_glPixelMapuiv != glad_trace_glPixelMapuiv) { glad_trace_next_glPixelMapuiv = glad_glPixelMapuiv; glad_glPixelMapuiv = glad_trace_glPixelMapuiv; }
+	if(glad_glPixelMapusv != NULL && glad_glPixelMapusv != glad_trace_glPixelMapusv) { glad_trace_next_glPixelMapusv = glad_glPixelMapusv; glad_glPixelMapusv = glad_trace_glPixelMapusv; }
+	if(glad_glCopyPixels != NULL && glad_glCopyPixels != glad_trace_glCopyPixels) { glad_trace_next_glCopyPixels = glad_glCopyPixels; glad_glCopyPixels = glad_trace_glCopyPixels; }
+	if(glad_glDrawPixels != NULL && glad_glDrawPixels != glad_trace_glDrawPixels) { glad_trace_next_glDrawPixels = glad_glDrawPixels; glad_glDrawPixels = glad_trace_glDrawPixels; }
+	if(glad_glGetClipPlane != NULL && glad_glGetClipPlane != glad_trace_glGetClipPlane) { glad_trace_next_glGetClipPlane = glad_glGetClipPlane; glad_glGetClipPlane = glad_trace_glGetClipPlane; }
+	if(glad_glGetLightfv != NULL && glad_glGetLightfv != glad_trace_glGetLightfv) { glad_trace_next_glGetLightfv = glad_glGetLightfv; glad_glGetLightfv = glad_trace_glGetLightfv; }
+	if(glad_glGetLightiv != NULL && glad_glGetLightiv != glad_trace_glGetLightiv) { glad_trace_next_glGetLightiv = glad_glGetLightiv; glad_glGetLightiv = glad_trace_glGetLightiv; }
+	if(glad_glGetMapdv != NULL && glad_glGetMapdv != glad_trace_glGetMapdv) { glad_trace_next_glGetMapdv = glad_glGetMapdv; glad_glGetMapdv = glad_trace_glGetMapdv; }
+	if(glad_glGetMapfv != NULL && glad_glGetMapfv != glad_trace_glGetMapfv) { glad_trace_next_glGetMapfv = glad_glGetMapfv; glad_glGetMapfv = glad_trace_glGetMapfv; }
+	if(glad_glGetMapiv != NULL && glad_glGetMapiv != glad_trace_glGetMapiv) { glad_trace_next_glGetMapiv = glad_glGetMapiv; glad_glGetMapiv = glad_trace_glGetMapiv; }
+	if(glad_glGetMaterialfv != NULL && glad_glGetMaterialfv != glad_trace_glGetMaterialfv) { glad_trace_next_glGetMaterialfv = glad_glGetMaterialfv; glad_glGetMaterialfv = glad_trace_glGetMaterialfv; }
+	if(glad_glGetMaterialiv != NULL && glad_glGetMaterialiv != glad_trace_glGetMaterialiv) { glad_trace_next_glGetMaterialiv = glad_glGetMaterialiv; glad_glGetMaterialiv = glad_trace_glGetMaterialiv; }
+	if(glad_glGetPixelMapfv != NULL && glad_glGetPixelMapfv != glad_trace_glGetPixelMapfv) { glad_trace_next_glGetPixelMapfv = glad_glGetPixelMapfv; glad_glGetPixelMapfv = glad_trace_glGetPixelMapfv; }
+	if(glad_glGetPixelMapuiv != NULL && glad_glGetPixelMapuiv != glad_trace_glGetPixelMapuiv) { glad_trace_next_glGetPixelMapuiv = glad_glGetPixelMapuiv; glad_glGetPixelMapuiv = glad_trace_glGetPixelMapuiv; }
+	if(glad_glGetPixelMapusv != NULL && glad_glGetPixelMapusv != glad_trace_glGetPixelMapusv) { glad_trace_next_glGetPixelMapusv = glad_glGetPixelMapusv; glad_glGetPixelMapusv = glad_trace_glGetPixelMapusv; }
+	if(glad_glGetPolygonStipple != NULL && glad_glGetPolygonStipple != glad_trace_glGetPolygonStipple) { glad_trace_next_glGetPolygonStipple = glad_glGetPolygonStipple; glad_glGetPolygonStipple = glad_trace_glGetPolygonStipple; }
+	if(glad_glGetTexEnvfv != NULL && glad_glGetTexEnvfv != glad_trace_glGetTexEnvfv) { glad_trace_next_glGetTexEnvfv = glad_glGetTexEnvfv; glad_glGetTexEnvfv = glad_trace_glGetTexEnvfv; }
+	if(glad_glGetTexEnviv != NULL && glad_glGetTexEnviv != glad_trace_glGetTexEnviv) { glad_trace_next_glGetTexEnviv = glad_glGetTexEnviv; glad_glGetTexEnviv = glad_trace_glGetTexEnviv; }
+	if(glad_glGetTexGendv != NULL && glad_glGetTexGendv != glad_trace_glGetTexGendv) { glad_trace_next_glGetTexGendv = glad_glGetTexGendv; glad_glGetTexGendv = glad_trace_glGetTexGendv; }
+	if(glad_glGetTexGenfv != NULL && glad_glGetTexGenfv != glad_trace_glGetTexGenfv) { glad_trace_next_glGetTexGenfv = glad_glGetTexGenfv; glad_glGetTexGenfv = glad_trace_glGetTexGenfv; }
+	if(glad_glGetTexGeniv != NULL && glad_glGetTexGeniv != glad_trace_glGetTexGeniv) { glad_trace_next_glGetTexGeniv = glad_glGetTexGeniv; glad_glGetTexGeniv = glad_trace_glGetTexGeniv; }
+	if(glad_glIsList != NULL && glad_glIsList != glad_trace_glIsList) { glad_trace_next_glIsList = glad_glIsList; glad_glIsList = glad_trace_glIsList; }
+	if(glad_glFrustum != NULL && glad_glFrustum != glad_trace_glFrustum) { glad_trace_next_glFrustum = glad_glFrustum; glad_glFrustum = glad_trace_glFrustum; }
+	if(glad_glLoadIdentity != NULL && glad_glLoadIdentity != glad_trace_glLoadIdentity) { glad_trace_next_glLoadIdentity = glad_glLoadIdentity; glad_glLoadIdentity = glad_trace_glLoadIdentity; }
+	if(glad_glLoadMatrixf != NULL && glad_glLoadMatrixf != glad_trace_glLoadMatrixf) { glad_trace_next_glLoadMatrixf = glad_glLoadMatrixf; glad_glLoadMatrixf = glad_trace_glLoadMatrixf; }
+	if(glad_glLoadMatrixd != NULL && glad_glLoadMatrixd != glad_trace_glLoadMatrixd) { glad_trace_next_glLoadMatrixd = glad_glLoadMatrixd; glad_glLoadMatrixd = glad_trace_glLoadMatrixd; }
+	if(glad_glMatrixMode != NULL && glad_glMatrixMode != glad_trace_glMatrixMode) { glad_trace_next_glMatrixMode = glad_glMatrixMode; glad_glMatrixMode = glad_trace_glMatrixMode; }
+	if(glad_glMultMatrixf != NULL && glad_glMultMatrixf != glad_trace_glMultMatrixf) { glad_trace_next_glMultMatrixf = glad_glMultMatrixf; glad_glMultMatrixf = glad_trace_glMultMatrixf; }
+	if(glad_glMultMatrixd != NULL && glad_glMultMatrixd != glad_trace_glMultMatrixd) { glad_trace_next_glMultMatrixd = glad_glMultMatrixd; glad_glMultMatrixd = glad_trace_glMultMatrixd; }
+	if(glad_glOrtho != NULL && glad_glOrtho != glad_trace_glOrtho) { glad_trace_next_glOrtho = glad_glOrtho; glad_glOrtho = glad_trace_glOrtho; }
+	if(glad_glPopMatrix != NULL && glad_glPopMatrix != glad_trace_glPopMatrix) { glad_trace_next_glPopMatrix = glad_glPopMatrix; glad_glPopMatrix = glad_trace_glPopMatrix; }
+	if(glad_glPushMatrix != NULL && glad_glPushMatrix != glad_trace_glPushMatrix) { glad_trace_next_glPushMatrix = glad_glPushMatrix; glad_glPushMatrix = glad_trace_glPushMatrix; }
+	if(glad_glRotated != NULL && glad_glRotated != glad_trace_glRotated) { glad_trace_next_glRotated = glad_glRotated; glad_glRotated = glad_trace_glRotated; }
+	if(glad_glRotatef != NULL && glad_glRotatef != glad_trace_glRotatef) { glad_trace_next_glRotatef = glad_glRotatef; glad_glRotatef = glad_trace_glRotatef; }
+	if(glad_glScaled != NULL && glad_glScaled != glad_trace_glScaled) { glad_trace_next_glScaled = glad_glScaled; glad_glScaled = glad_trace_glScaled; }
+	if(glad_glScalef != NULL && glad_glScalef != glad_trace_glScalef) { glad_trace_next_glScalef = glad_glScalef; glad_glScalef = glad_trace_glScalef; }
+	if(glad_glTranslated != NULL && glad_glTranslated != glad_trace_glTranslated) { glad_trace_next_glTranslated = glad_glTranslated; glad_glTranslated = glad_trace_glTranslated; }
+	if(glad_glTranslatef != NULL && glad_glTranslatef != glad_trace_glTranslatef) { glad_trace_next_glTranslatef = glad_glTranslatef; glad_glTranslatef = glad_trace_glTranslatef; }
+	if(glad_glDrawArrays != NULL && glad_glDrawArrays != glad_trace_glDrawArrays) { glad_trace_next_glDrawArrays = glad_glDrawArrays; glad_glDrawArrays = glad_trace_glDrawArrays; }
+	if(glad_glDrawElements != NULL && glad_glDrawElements != glad_trace_glDrawElements) { glad_trace_next_glDrawElements = glad_glDrawElements; glad_glDrawElements = glad_trace_glDrawElements; }
+	if(glad_glGetPointerv != NULL && glad_glGetPointerv != glad_trace_glGetPointerv) { glad_trace_next_glGetPointerv = glad_glGetPointerv; glad_glGetPointerv = glad_trace_glGetPointerv; }
+	if(glad_glPolygonOffset != NULL && glad_glPolygonOffset != glad_trace_glPolygonOffset) { glad_trace_next_glPolygonOffset = glad_glPolygonOffset; glad_glPolygonOffset = glad_trace_glPolygonOffset; }
+	if(glad_glCopyTexImage1D != NULL && glad_glCopyTexImage1D != glad_trace_glCopyTexImage1D) { glad_trace_next_glCopyTexImage1D = glad_glCopyTexImage1D; glad_glCopyTexImage1D = glad_trace_glCopyTexImage1D; }
+	if(glad_glCopyTexImage2D != NULL && glad_glCopyTexImage2D != glad_trace_glCopyTexImage2D) { glad_trace_next_glCopyTexImage2D = glad_glCopyTexImage2D; glad_glCopyTexImage2D = glad_trace_glCopyTexImage2D; }
+	if(glad_glCopyTexSubImage1D != NULL && glad_glCopyTexSubImage1D != glad_trace_glCopyTexSubImage1D) { glad_trace_next_glCopyTexSubImage1D = glad_glCopyTexSubImage1D; glad_glCopyTexSubImage1D = glad_trace_glCopyTexSubImage1D; }
+	if(glad_glCopyTexSubImage2D != NULL && glad_glCopyTexSubImage2D != glad_trace_glCopyTexSubImage2D) { glad_trace_next_glCopyTexSubImage2D = glad_glCopyTexSubImage2D; glad_glCopyTexSubImage2D = glad_trace_glCopyTexSubImage2D; }
+	if(glad_glTexSubImage1D != NULL && glad_glTexSubImage1D != glad_trace_glTexSubImage1D) { glad_trace_next_glTexSubImage1D = glad_glTexSubImage1D; glad_glTexSubImage1D = glad_trace_glTexSubImage1D; }
+	if(glad_glTexSubImage2D != NULL && glad_glTexSubImage2D != glad_trace_glTexSubImage2D) { glad_trace_next_glTexSubImage2D = glad_glTexSubImage2D; glad_glTexSubImage2D = glad_trace_glTexSubImage2D; }
+	if(glad_glBindTexture != NULL && glad_glBindTexture != glad_trace_glBindTexture) { glad_trace_next_glBindTexture = glad_glBindTexture; glad_glBindTexture = glad_trace_glBindTexture; }
+	if(glad_glDeleteTextures != NULL && glad_glDeleteTextures != glad_trace_glDeleteTextures) { glad_trace_next_glDeleteTextures = glad_glDeleteTextures; glad_glDeleteTextures = glad_trace_glDeleteTextures; }
+	if(glad_glGenTextures != NULL && glad_glGenTextures != glad_trace_glGenTextures) { glad_trace_next_glGenTextures = glad_glGenTextures; glad_glGenTextures = glad_trace_glGenTextures; }
+	if(glad_glIsTexture != NULL && glad_glIsTexture != glad_trace_glIsTexture) { glad_trace_next_glIsTexture = glad_glIsTexture; glad_glIsTexture = glad_trace_glIsTexture; }
+	if(glad_glArrayElement != NULL && glad_glArrayElement != glad_trace_glArrayElement) { glad_trace_next_glArrayElement = glad_glArrayElement; glad_glArrayElement = glad_trace_glArrayElement; }
+	if(glad_glColorPointer != NULL && glad_glColorPointer != glad_trace_glColorPointer) { glad_trace_next_glColorPointer = glad_glColorPointer; glad_glColorPointer = glad_trace_glColorPointer; }
+	if(glad_glDisableClientState != NULL && glad_glDisableClientState != glad_trace_glDisableClientState) { glad_trace_next_glDisableClientState = glad_glDisableClientState; glad_glDisableClientState = glad_trace_glDisableClientState; }
+	if(glad_glEdgeFlagPointer != NULL && glad_glEdgeFlagPointer != glad_trace_glEdgeFlagPointer) { glad_trace_next_glEdgeFlagPointer = glad_glEdgeFlagPointer; glad_glEdgeFlagPointer = glad_trace_glEdgeFlagPointer; }
+	if(glad_glEnableClientState != NULL && glad_glEnableClientState != glad_trace_glEnableClientState) { glad_trace_next_glEnableClientState = glad_glEnableClientState; glad_glEnableClientState = glad_trace_glEnableClientState; }
+	if(glad_glIndexPointer != NULL && glad_glIndexPointer != glad_trace_glIndexPointer) { glad_trace_next_glIndexPointer = glad_glIndexPointer; glad_glIndexPointer = glad_trace_glIndexPointer; }
+	if(glad_glInterleavedArrays != NULL && glad_glInterleavedArrays != glad_trace_glInterleavedArrays) { glad_trace_next_glInterleavedArrays = glad_glInterleavedArrays; glad_glInterleavedArrays = glad_trace_glInterleavedArrays; }
+	if(glad_glNormalPointer != NULL && glad_glNormalPointer != glad_trace_glNormalPointer) { glad_trace_next_glNormalPointer = glad_glNormalPointer; glad_glNormalPointer = glad_trace_glNormalPointer; }
+	if(glad_glTexCoordPointer != NULL && glad_glTexCoordPointer != glad_trace_glTexCoordPointer) { glad_trace_next_glTexCoordPointer = glad_glTexCoordPointer; glad_glTexCoordPointer = glad_trace_glTexCoordPointer; }
+	if(glad_glVertexPointer != NULL && glad_glVertexPointer != glad_trace_glVertexPointer) { glad_trace_next_glVertexPointer = glad_glVertexPointer; glad_glVertexPointer = glad_trace_glVertexPointer; }
+	if(glad_glAreTexturesResident != NULL && glad_glAreTexturesResident != glad_trace_glAreTexturesResident) { glad_trace_next_glAreTexturesResident = glad_glAreTexturesResident; glad_glAreTexturesResident = glad_trace_glAreTexturesResident; }
+	if(glad_glPrioritizeTextures != NULL && glad_glPrioritizeTextures != glad_trace_glPrioritizeTextures) { glad_trace_next_glPrioritizeTextures = glad_glPrioritizeTextures; glad_glPrioritizeTextures = glad_trace_glPrioritizeTextures; }
+	if(glad_glIndexub != NULL && glad_glIndexub != glad_trace_glIndexub) { glad_trace_next_glIndexub = glad_glIndexub; glad_glIndexub = glad_trace_glIndexub; }
+	if(glad_glIndexubv != NULL && glad_glIndexubv != glad_trace_glIndexubv) { glad_trace_next_glIndexubv = glad_glIndexubv; glad_glIndexubv = glad_trace_glIndexubv; }
+	if(glad_glPopClientAttrib != NULL && glad_glPopClientAttrib != glad_trace_glPopClientAttrib) { glad_trace_next_glPopClientAttrib = glad_glPopClientAttrib; glad_glPopClientAttrib = glad_trace_glPopClientAttrib; }
+	if(glad_glPushClientAttrib != NULL && glad_glPushClientAttrib != glad_trace_glPushClientAttrib) { glad_trace_next_glPushClientAttrib = glad_glPushClientAttrib; glad_glPushClientAttrib = glad_trace_glPushClientAttrib; }
+	if(glad_glDrawRangeElements != NULL && glad_glDrawRangeElements != glad_trace_glDrawRangeElements) { glad_trace_next_glDrawRangeElements = glad_glDrawRangeElements; glad_glDrawRangeElements = glad_trace_glDrawRangeElements; }
+	if(glad_glTexImage3D != NULL && glad_glTexImage3D != glad_trace_glTexImage3D) { glad_trace_next_glTexImage3D = glad_glTexImage3D; glad_glTexImage3D = glad_trace_glTexImage3D; }
+	if(glad_glTexSubImage3D != NULL && glad_glTexSubImage3D != glad_trace_glTexSubImage3D) { glad_trace_next_glTexSubImage3D = glad_glTexSubImage3D; glad_glTexSubImage3D = glad_trace_glTexSubImage3D; }
+	if(glad_glCopyTexSubImage3D != NULL && glad_glCopyTexSubImage3D != glad_trace_glCopyTexSubImage3D) { glad_trace_next_glCopyTexSubImage3D = glad_glCopyTexSubImage3D; glad_glCopyTexSubImage3D = glad_trace_glCopyTexSubImage3D; }
+	if(glad_glActiveTexture != NULL && glad_glActiveTexture != glad_trace_glActiveTexture) { glad_trace_next_glActiveTexture = glad_glActiveTexture; glad_glActiveTexture = glad_trace_glActiveTexture; }
+	if(glad_glSampleCoverage != NULL && glad_glSampleCoverage != glad_trace_glSampleCoverage) { glad_trace_next_glSampleCoverage = glad_glSampleCoverage; glad_glSampleCoverage = glad_trace_glSampleCoverage; }
+	if(glad_glCompressedTexImage3D != NULL && glad_glCompressedTexImage3D != glad_trace_glCompressedTexImage3D) { glad_trace_next_glCompressedTexImage3D = glad_glCompressedTexImage3D; glad_glCompressedTexImage3D = glad_trace_glCompressedTexImage3D; }
+	if(glad_glCompressedTexImage2D != NULL && glad_glCompressedTexImage2D != glad_trace_glCompressedTexImage2D) { glad_trace_next_glCompressedTexImage2D = glad_glCompressedTexImage2D; glad_glCompressedTexImage2D = glad_trace_glCompressedTexImage2D; }
+	if(glad_glCompressedTexImage1D != NULL && glad_glCompressedTexImage1D != glad_trace_glCompressedTexImage1D) { glad_trace_next_glCompressedTexImage1D = glad_glCompressedTexImage1D; glad_glCompressedTexImage1D = glad_trace_glCompressedTexImage1D; }
+	if(glad_glCompressedTexSubImage3D != NULL && glad_glCompressedTexSubImage3D != glad_trace_glCompressedTexSubImage3D) { glad_trace_next_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D; glad_glCompressedTexSubImage3D = glad_trace_glCompressedTexSubImage3D; }
+	if(glad_glCompressedTexSubImage2D != NULL && glad_glCompressedTexSubImage2D != glad_trace_glCompressedTexSubImage2D) { glad_trace_next_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D; glad_glCompressedTexSubImage2D = glad_trace_glCompressedTexSubImage2D; }
+	if(glad_glCompressedTexSubImage1D != NULL && glad_glCompressedTexSubImage1D != glad_trace_glCompressedTexSubImage1D) { glad_trace_next_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D; glad_glCompressedTexSubImage1D = glad_trace_glCompressedTexSubImage1D; }
+	if(glad_glGetCompressedTexImage != NULL && glad_glGetCompressedTexImage != glad_trace_glGetCompressedTexImage) { glad_trace_next_glGetCompressedTexImage = glad_glGetCompressedTexImage; glad_glGetCompressedTexImage = glad_trace_glGetCompressedTexImage; }
+	if(glad_glClientActiveTexture != NULL && glad_glClientActiveTexture != glad_trace_glClientActiveTexture) { glad_trace_next_glClientActiveTexture = glad_glClientActiveTexture; glad_glClientActiveTexture = glad_trace_glClientActiveTexture; }
+	if(glad_glMultiTexCoord1d != NULL && glad_glMultiTexCoord1d != glad_trace_glMultiTexCoord1d) { glad_trace_next_glMultiTexCoord1d = glad_glMultiTexCoord1d; glad_glMultiTexCoord1d = glad_trace_glMultiTexCoord1d; }
+	if(glad_glMultiTexCoord1dv != NULL && glad_glMultiTexCoord1dv != glad_trace_glMultiTexCoord1dv) { glad_trace_next_glMultiTexCoord1dv = glad_glMultiTexCoord1dv; glad_glMultiTexCoord1dv = glad_trace_glMultiTexCoord1dv; }
+	if(glad_glMultiTexCoord1f != NULL && glad_glMultiTexCoord1f != glad_trace_glMultiTexCoord1f) { glad_trace_next_glMultiTexCoord1f = glad_glMultiTexCoord1f; glad_glMultiTexCoord1f = glad_trace_glMultiTexCoord1f; }
+	if(glad_glMultiTexCoord1fv != NULL && glad_glMultiTexCoord1fv != glad_trace_glMultiTexCoord1fv) { glad_trace_next_glMultiTexCoord1fv = glad_glMultiTexCoord1fv; glad_glMultiTexCoord1fv = glad_trace_glMultiTexCoord1fv; }
+	if(glad_glMultiTexCoord1i != NULL && glad_glMultiTexCoord1i != glad_trace_glMultiTexCoord1i) { glad_trace_next_glMultiTexCoord1i = glad_glMultiTexCoord1i; glad_glMultiTexCoord1i = glad_trace_glMultiTexCoord1i; }
+	if(glad_glMultiTexCoord1iv != NULL && glad_glMultiTexCoord1iv != glad_trace_glMultiTexCoord1iv) { glad_trace_next_glMultiTexCoord1iv = glad_glMultiTexCoord1iv; glad_glMultiTexCoord1iv = glad_trace_glMultiTexCoord1iv; }
+	if(glad_glMultiTexCoord1s != NULL && glad_glMultiTexCoord1s != glad_trace_glMultiTexCoord1s) { glad_trace_next_glMultiTexCoord1s = glad_glMultiTexCoord1s; glad_glMultiTexCoord1s = glad_trace_glMultiTexCoord1s; }
+	if(glad_glMultiTexCoord1sv != NULL && glad_glMultiTexCoord1sv != glad_trace_glMultiTexCoord1sv) { glad_trace_next_glMultiTexCoord1sv = glad_glMultiTexCoord1sv; glad_glMultiTexCoord1sv = glad_trace_glMultiTexCoord1sv; }
+	if(glad_glMultiTexCoord2d != NULL && glad_glMultiTexCoord2d != glad_trace_glMultiTexCoord2d) { glad_trace_next_glMultiTexCoord2d = glad_glMultiTexCoord2d; glad_glMultiTexCoord2d = glad_trace_glMultiTexCoord2d; }
+	if(glad_glMultiTexCoord2dv != NULL && glad_glMultiTexCoord2dv != glad_trace_glMultiTexCoord2dv) { glad_trace_next_glMultiTexCoord2dv = glad_glMultiTexCoord2dv; glad_glMultiTexCoord2dv = glad_trace_glMultiTexCoord2dv; }
+	if(glad_glMultiTexCoord2f != NULL && glad_glMultiTexCoord2f != glad_trace_glMultiTexCoord2f) { glad_trace_next_glMultiTexCoord2f = glad_glMultiTexCoord2f; glad_glMultiTexCoord2f = glad_trace_glMultiTexCoord2f; }
+	if(glad_glMultiTexCoord2fv != NULL && glad_glMultiTexCoord2fv != glad_trace_glMultiTexCoord2fv) { glad_trace_next_glMultiTexCoord2fv = glad_glMultiTexCoord2fv; glad_glMultiTexCoord2fv = glad_trace_glMultiTexCoord2fv; }
+	if(glad_glMultiTexCoord2i != NULL && glad_glMultiTexCoord2i != glad_trace_glMultiTexCoord2i) { glad_trace_next_glMultiTexCoord2i = glad_glMultiTexCoord2i; glad_glMultiTexCoord2i = glad_trace_glMultiTexCoord2i; }
+	if(glad_glMultiTexCoord2iv != NULL && glad_glMultiTexCoord2iv != glad_trace_glMultiTexCoord2iv) { glad_trace_next_glMultiTexCoord2iv = glad_glMultiTexCoord2iv; glad_glMultiTexCoord2iv = glad_trace_glMultiTexCoord2iv; }
+	if(glad_glMultiTexCoord2s != NULL && glad_glMultiTexCoord2s != glad_trace_glMultiTexCoord2s) { glad_trace_next_glMultiTexCoord2s = glad_glMultiTexCoord2s; glad_glMultiTexCoord2s = glad_trace_glMultiTexCoord2s; }
+	if(glad_glMultiTexCoord2sv != NULL && glad_glMultiTexCoord2sv != glad_trace_glMultiTexCoord2sv) { glad_trace_next_glMultiTexCoord2sv = glad_glMultiTexCoord2sv; glad_glMultiTexCoord2sv = glad_trace_glMultiTexCoord2sv; }
+	if(glad_glMultiTexCoord3d != NULL && glad_glMultiTexCoord3d != glad_trace_glMultiTexCoord3d) { glad_trace_next_glMultiTexCoord3d = glad_glMultiTexCoord3d; glad_glMultiTexCoord3d = glad_trace_glMultiTexCoord3d; }
+	if(glad_glMultiTexCoord3dv != NULL && glad_glMultiTexCoord3dv != glad_trace_glMultiTexCoord3dv) { glad_trace_next_glMultiTexCoord3dv = glad_glMultiTexCoord3dv; glad_glMultiTexCoord3dv = glad_trace_glMultiTexCoord3dv; }
+	if(glad_glMultiTexCoord3f != NULL && glad_glMultiTexCoord3f != glad_trace_glMultiTexCoord3f) { glad_trace_next_glMultiTexCoord3f = glad_glMultiTexCoord3f; glad_glMultiTexCoord3f = glad_trace_glMultiTexCoord3f; }
+	if(glad_glMultiTexCoord3fv != NULL && glad_glMultiTexCoord3fv != glad_trace_glMultiTexCoord3fv) { glad_trace_next_glMultiTexCoord3fv = glad_glMultiTexCoord3fv; glad_glMultiTexCoord3fv = glad_trace_glMultiTexCoord3fv; }
+	if(glad_glMultiTexCoord3i != NULL && glad_glMultiTexCoord3i != glad_trace_glMultiTexCoord3i) { glad_trace_next_glMultiTexCoord3i = glad_glMultiTexCoord3i; glad_glMultiTexCoord3i = glad_trace_glMultiTexCoord3i; }
+	if(glad_glMultiTexCoord3iv != NULL && glad_glMultiTexCoord3iv != glad_trace_glMultiTexCoord3iv) { glad_trace_next_glMultiTexCoord3iv = glad_glMultiTexCoord3iv; glad_glMultiTexCoord3iv = glad_trace_glMultiTexCoord3iv; }
+	if(glad_glMultiTexCoord3s != NULL && glad_glMultiTexCoord3s != glad_trace_glMultiTexCoord3s) { glad_trace_next_glMultiTexCoord3s = glad_glMultiTexCoord3s; glad_glMultiTexCoord3s = glad_trace_glMultiTexCoord3s; }
+	if(glad_glMultiTexCoord3sv != NULL && glad_glMultiTexCoord3sv != glad_trace_glMultiTexCoord3sv) { glad_trace_next_glMultiTexCoord3sv = glad_glMultiTexCoord3sv; glad_glMultiTexCoord3sv = glad_trace_glMultiTexCoord3sv; }
+	if(glad_glMultiTexCoord4d != NULL && glad_glMultiTexCoord4d != glad_trace_glMultiTexCoord4d) { glad_trace_next_glMultiTexCoord4d = glad_glMultiTexCoord4d; glad_glMultiTexCoord4d = glad_trace_glMultiTexCoord4d; }
+	if(glad_glMultiTexCoord4dv != NULL && glad_glMultiTexCoord4dv != glad_trace_glMultiTexCoord4dv) { glad_trace_next_glMultiTexCoord4dv = glad_glMultiTexCoord4dv; glad_glMultiTexCoord4dv = glad_trace_glMultiTexCoord4dv; }
+	if(glad_glMultiTexCoord4f != NULL && glad_glMultiTexCoord4f != glad_trace_glMultiTexCoord4f) { glad_trace_next_glMultiTexCoord4f = glad_glMultiTexCoord4f; glad_glMultiTexCoord4f = glad_trace_glMultiTexCoord4f; }
+	if(glad_glMultiTexCoord4fv != NULL && glad_glMultiTexCoord4fv != glad_trace_glMultiTexCoord4fv) { glad_trace_next_glMultiTexCoord4fv = glad_glMultiTexCoord4fv; glad_glMultiTexCoord4fv = glad_trace_glMultiTexCoord4fv; }
+	if(glad_glMultiTexCoord4i != NULL && glad_glMultiTexCoord4i != glad_trace_glMultiTexCoord4i) { glad_trace_next_glMultiTexCoord4i = glad_glMultiTexCoord4i; glad_glMultiTexCoord4i = glad_trace_glMultiTexCoord4i; }
+	if(glad_glMultiTexCoord4iv != NULL && glad_glMultiTexCoord4iv != glad_trace_glMultiTexCoord4iv) { glad_trace_next_glMultiTexCoord4iv = glad_glMultiTexCoord4iv; glad_glMultiTexCoord4iv = glad_trace_glMultiTexCoord4iv; }
+	if(glad_glMultiTexCoord4s != NULL && glad_glMultiTexCoord4s != glad_trace_glMultiTexCoord4s) { glad_trace_next_glMultiTexCoord4s = glad_glMultiTexCoord4s; glad_glMultiTexCoord4s = glad_trace_glMultiTexCoord4s; }
+	if(glad_glMultiTexCoord4sv != NULL && glad_glMultiTexCoord4sv != glad_trace_glMultiTexCoord4sv) { glad_trace_next_glMultiTexCoord4sv = glad_glMultiTexCoord4sv; glad_glMultiTexCoord4sv = glad_trace_glMultiTexCoord4sv; }
+	if(glad_glLoadTransposeMatrixf != NULL && glad_glLoadTransposeMatrixf != glad_trace_glLoadTransposeMatrixf) { glad_trace_next_glLoadTransposeMatrixf = glad_glLoadTransposeMatrixf; glad_glLoadTransposeMatrixf = glad_trace_glLoadTransposeMatrixf; }
+	if(glad_glLoadTransposeMatrixd != NULL && glad_glLoadTransposeMatrixd != glad_trace_glLoadTransposeMatrixd) { glad_trace_next_glLoadTransposeMatrixd = glad_glLoadTransposeMatrixd; glad_glLoadTransposeMatrixd = glad_trace_glLoadTransposeMatrixd; }
+	if(glad_glMultTransposeMatrixf != NULL && glad_glMultTransposeMatrixf != glad_trace_glMultTransposeMatrixf) { glad_trace_next_glMultTransposeMatrixf = glad_glMultTransposeMatrixf; glad_glMultTransposeMatrixf = glad_trace_glMultTransposeMatrixf; }
+	if(glad_glMultTransposeMatrixd != NULL && glad_glMultTransposeMatrixd != glad_trace_glMultTransposeMatrixd) { glad_trace_next_glMultTransposeMatrixd = glad_glMultTransposeMatrixd; glad_glMultTransposeMatrixd = glad_trace_glMultTransposeMatrixd; }
+	if(glad_glBlendFuncSeparate != NULL && glad_glBlendFuncSeparate != glad_trace_glBlendFuncSeparate) { glad_trace_next_glBlendFuncSeparate = glad_glBlendFuncSeparate; glad_glBlendFuncSeparate = glad_trace_glBlendFuncSeparate; }
+	if(glad_glMultiDrawArrays != NULL && glad_glMultiDrawArrays != glad_trace_glMultiDrawArrays) { glad_trace_next_glMultiDrawArrays = glad_glMultiDrawArrays; glad_glMultiDrawArrays = glad_trace_glMultiDrawArrays; }
+	if(glad_glMultiDrawElements != NULL && glad_glMultiDrawElements != glad_trace_glMultiDrawElements) { glad_trace_next_glMultiDrawElements = glad_glMultiDrawElements; glad_glMultiDrawElements = glad_trace_glMultiDrawElements; }
+	if(glad_glPointParameterf != NULL && glad_glPointParameterf != glad_trace_glPointParameterf) { glad_trace_next_glPointParameterf = glad_glPointParameterf; glad_glPointParameterf = glad_trace_glPointParameterf; }
+	if(glad_glPointParameterfv != NULL && glad_glPointParameterfv != glad_trace_glPointParameterfv) { glad_trace_next_glPointParameterfv = glad_glPointParameterfv; glad_glPointParameterfv = glad_trace_glPointParameterfv; }
+	if(glad_glPointParameteri != NULL && glad_glPointParameteri != glad_trace_glPointParameteri) { glad_trace_next_glPointParameteri = glad_glPointParameteri; glad_glPointParameteri = glad_trace_glPointParameteri; }
+	if(glad_glPointParameteriv != NULL && glad_glPointParameteriv != glad_trace_glPointParameteriv) { glad_trace_next_glPointParameteriv = glad_glPointParameteriv; glad_glPointParameteriv = glad_trace_glPointParameteriv; }
+	if(glad_glFogCoordf != NULL && glad_glFogCoordf != glad_trace_glFogCoordf) { glad_trace_next_glFogCoordf = glad_glFogCoordf; glad_glFogCoordf = glad_trace_glFogCoordf; }
+	if(glad_glFogCoordfv != NULL && glad_glFogCoordfv != glad_trace_glFogCoordfv) { glad_trace_next_glFogCoordfv = glad_glFogCoordfv; glad_glFogCoordfv = glad_trace_glFogCoordfv; }
+	if(glad_glFogCoordd != NULL && glad_glFogCoordd != glad_trace_glFogCoordd) { glad_trace_next_glFogCoordd = glad_glFogCoordd; glad_glFogCoordd = glad_trace_glFogCoordd; }
+	if(glad_glFogCoorddv != NULL && glad_glFogCoorddv != glad_trace_glFogCoorddv) { glad_trace_next_glFogCoorddv = glad_glFogCoorddv; glad_glFogCoorddv = glad_trace_glFogCoorddv; }
+	if(glad_glFogCoordPointer != NULL && glad_glFogCoordPointer != glad_trace_glFogCoordPointer) { glad_trace_next_glFogCoordPointer = glad_glFogCoordPointer; glad_glFogCoordPointer = glad_trace_glFogCoordPointer; }
+	if(glad_glSecondaryColor3b != NULL && glad_glSecondaryColor3b != glad_trace_glSecondaryColor3b) { glad_trace_next_glSecondaryColor3b = glad_glSecondaryColor3b; glad_glSecondaryColor3b = glad_trace_glSecondaryColor3b; }
+	if(glad_glSecondaryColor3bv != NULL && glad_glSecondaryColor3bv != glad_trace_glSecondaryColor3bv) { glad_trace_next_glSecondaryColor3bv = glad_glSecondaryColor3bv; glad_glSecondaryColor3bv = glad_trace_glSecondaryColor3bv; }
+	if(glad_glSecondaryColor3d != NULL && glad_glSecondaryColor3d != glad_trace_glSecondaryColor3d) { glad_trace_next_glSecondaryColor3d = glad_glSecondaryColor3d; glad_glSecondaryColor3d = glad_trace_glSecondaryColor3d; }
+	if(glad_glSecondaryColor3dv != NULL && glad_glSecondaryColor3dv != glad_trace_glSecondaryColor3dv) { glad_trace_next_glSecondaryColor3dv = glad_glSecondaryColor3dv; glad_glSecondaryColor3dv = glad_trace_glSecondaryColor3dv; }
+	if(glad_glSecondaryColor3f != NULL && glad_glSecondaryColor3f != glad_trace_glSecondaryColor3f) { glad_trace_next_glSecondaryColor3f = glad_glSecondaryColor3f; glad_glSecondaryColor3f = glad_trace_glSecondaryColor3f; }
+	if(glad_glSecondaryColor3fv != NULL && glad_glSecondaryColor3fv != glad_trace_glSecondaryColor3fv) { glad_trace_next_glSecondaryColor3fv = glad_glSecondaryColor3fv; glad_glSecondaryColor3fv = glad_trace_glSecondaryColor3fv; }
+	if(glad_glSecondaryColor3i != NULL && glad_glSecondaryColor3i != glad_trace_glSecondaryColor3i) { glad_trace_next_glSecondaryColor3i = glad_glSecondaryColor3i; glad_glSecondaryColor3i = glad_trace_glSecondaryColor3i; }
+	if(glad_glSecondaryColor3iv != NULL && glad_glSecondaryColor3iv != glad_trace_glSecondaryColor3iv) { glad_trace_next_glSecondaryColor3iv = glad_glSecondaryColor3iv; glad_glSecondaryColor3iv = glad_trace_glSecondaryColor3iv; }
+	if(glad_glSecondaryColor3s != NULL && glad_glSecondaryColor3s != glad_trace_glSecondaryColor3s) { glad_trace_next_glSecondaryColor3s = glad_glSecondaryColor3s; glad_glSecondaryColor3s = glad_trace_glSecondaryColor3s; }
+	if(glad_glSecondaryColor3sv != NULL && glad_glSecondaryColor3sv != glad_trace_glSecondaryColor3sv) { glad_trace_next_glSecondaryColor3sv = glad_glSecondaryColor3sv; glad_glSecondaryColor3sv = glad_trace_glSecondaryColor3sv; }
+	if(glad_glSecondaryColor3ub != NULL && glad_glSecondaryColor3ub != glad_trace_glSecondaryColor3ub) { glad_trace_next_glSecondaryColor3ub = glad_glSecondaryColor3ub; glad_glSecondaryColor3ub = glad_trace_glSecondaryColor3ub; }
+	if(glad_glSecondaryColor3ubv != NULL && glad_glSecondaryColor3ubv != glad_trace_glSecondaryColor3ubv) { glad_trace_next_glSecondaryColor3ubv = glad_glSecondaryColor3ubv; glad_glSecondaryColor3ubv = glad_trace_glSecondaryColor3ubv; }
+	if(glad_glSecondaryColor3ui != NULL && glad_glSecondaryColor3ui != glad_trace_glSecondaryColor3ui) { glad_trace_next_glSecondaryColor3ui = glad_glSecondaryColor3ui; glad_glSecondaryColor3ui = glad_trace_glSecondaryColor3ui; }
+	if(glad_glSecondaryColor3uiv != NULL && glad_glSecondaryColor3uiv != glad_trace_glSecondaryColor3uiv) { glad_trace_next_glSecondaryColor3uiv = glad_glSecondaryColor3uiv; glad_glSecondaryColor3uiv = glad_trace_glSecondaryColor3uiv; }
+	if(glad_glSecondaryColor3us != NULL && glad_glSecondaryColor3us != glad_trace_glSecondaryColor3us) { glad_trace_next_glSecondaryColor3us = glad_glSecondaryColor3us; glad_glSecondaryColor3us = glad_trace_glSecondaryColor3us; }
+	if(glad_glSecondaryColor3usv != NULL && glad_glSecondaryColor3usv != glad_trace_glSecondaryColor3usv) { glad_trace_next_glSecondaryColor3usv = glad_glSecondaryColor3usv; glad_glSecondaryColor3usv = glad_trace_glSecondaryColor3usv; }
+	if(glad_glSecondaryColorPointer != NULL && glad_glSecondaryColorPointer != glad_trace_glSecondaryColorPointer) { glad_trace_next_glSecondaryColorPointer = glad_glSecondaryColorPointer; glad_glSecondaryColorPointer = glad_trace_glSecondaryColorPointer; }
+	if(glad_glWindowPos2d != NULL && glad_glWindowPos2d != glad_trace_glWindowPos2d) { glad_trace_next_glWindowPos2d = glad_glWindowPos2d; glad_glWindowPos2d = glad_trace_glWindowPos2d; }
+	if(glad_glWindowPos2dv != NULL && glad_glWindowPos2dv != glad_trace_glWindowPos2dv) { glad_trace_next_glWindowPos2dv = glad_glWindowPos2dv; glad_glWindowPos2dv = glad_trace_glWindowPos2dv; }
+	if(glad_glWindowPos2f != NULL && glad_glWindowPos2f != glad_trace_glWindowPos2f) { glad_trace_next_glWindowPos2f = glad_glWindowPos2f; glad_glWindowPos2f = glad_trace_glWindowPos2f; }
+	if(glad_glWindowPos2fv != NULL && glad_glWindowPos2fv != glad_trace_glWindowPos2fv) { glad_trace_next_glWindowPos2fv = glad_glWindowPos2fv; glad_glWindowPos2fv = glad_trace_glWindowPos2fv; }
+	if(glad_glWindowPos2i != NULL && glad_glWindowPos2i != glad_trace_glWindowPos2i) { glad_trace_next_glWindowPos2i = glad_glWindowPos2i; glad_glWindowPos2i = glad_trace_glWindowPos2i; }
+	if(glad_glWindowPos2iv != NULL && glad_glWindowPos2iv != glad_trace_glWindowPos2iv) { glad_trace_next_glWindowPos2iv = glad_glWindowPos2iv; glad_glWindowPos2iv = glad_trace_glWindowPos2iv; }
+	if(glad_glWindowPos2s != NULL && glad_glWindowPos2s != glad_trace_glWindowPos2s) { glad_trace_next_glWindowPos2s = glad_glWindowPos2s; glad_glWindowPos2s = glad_trace_glWindowPos2s; }
+	if(glad_glWindowPos2sv != NULL && glad_glWindowPos2sv != glad_trace_glWindowPos2sv) { glad_trace_next_glWindowPos2sv = glad_glWindowPos2sv; glad_glWindowPos2sv = glad_trace_glWindowPos2sv; }
+	if(glad_glWindowPos3d != NULL && glad_glWindowPos3d != glad_trace_glWindowPos3d) { glad_trace_next_glWindowPos3d = glad_glWindowPos3d; glad_glWindowPos3d = glad_trace_glWindowPos3d; }
+	if(glad_glWindowPos3dv != NULL && glad_glWindowPos3dv != glad_trace_glWindowPos3dv) { glad_trace_next_glWindowPos3dv = glad_glWindowPos3dv; glad_glWindowPos3dv = glad_trace_glWindowPos3dv; }
+	if(glad_glWindowPos3f != NULL && glad_glWindowPos3f != glad_trace_glWindowPos3f) { glad_trace_next_glWindowPos3f = glad_glWindowPos3f; glad_glWindowPos3f = glad_trace_glWindowPos3f; }
+	if(glad_glWindowPos3fv != NULL && glad_glWindowPos3fv != glad_trace_glWindowPos3fv) { glad_trace_next_glWindowPos3fv = glad_glWindowPos3fv; glad_glWindowPos3fv = glad_trace_glWindowPos3fv; }
+	if(glad_glWindowPos3i != NULL && glad_glWindowPos3i != glad_trace_glWindowPos3i) { glad_trace_next_glWindowPos3i = glad_glWindowPos3i; glad_glWindowPos3i = glad_trace_glWindowPos3i; }
+	if(glad_glWindowPos3iv != NULL && glad_glWindowPos3iv != glad_trace_glWindowPos3iv) { glad_trace_next_glWindowPos3iv = glad_glWindowPos3iv; glad_glWindowPos3iv = glad_trace_glWindowPos3iv; }
+	if(glad_glWindowPos3s != NULL && glad_glWindowPos3s != glad_trace_glWindowPos3s) { glad_trace_next_glWindowPos3s = glad_glWindowPos3s; glad_glWindowPos3s = glad_trace_glWindowPos3s; }
+	if(glad_glWindowPos3sv != NULL && glad_glWindowPos3sv != glad_trace_glWindowPos3sv) { glad_trace_next_glWindowPos3sv = glad_glWindowPos3sv; glad_glWindowPos3sv = glad_trace_glWindowPos3sv; }
+	if(glad_glBlendColor != NULL && glad_glBlendColor != glad_trace_glBlendColor) { glad_trace_next_glBlendColor = glad_glBlendColor; glad_glBlendColor = glad_trace_glBlendColor; }
+	if(glad_glBlendEquation != NULL && glad_glBlendEquation != glad_trace_glBlendEquation) { glad_trace_next_glBlendEquation = glad_glBlendEquation; glad_glBlendEquation = glad_trace_glBlendEquation; }
+	if(glad_glGenQueries != NULL && glad_glGenQueries != glad_trace_glGenQueries) { glad_trace_next_glGenQueries = glad_glGenQueries; glad_glGenQueries = glad_trace_glGenQueries; }
+	if(glad_glDeleteQueries != NULL && glad_glDeleteQueries != glad_trace_glDeleteQueries) { glad_trace_next_glDeleteQueries = glad_glDeleteQueries; glad_glDeleteQueries = glad_trace_glDeleteQueries; }
+	if(glad_glIsQuery != NULL && glad_glIsQuery != glad_trace_glIsQuery) { glad_trace_next_glIsQuery = glad_glIsQuery; glad_glIsQuery = glad_trace_glIsQuery; }
+	if(glad_glBeginQuery != NULL && glad_glBeginQuery != glad_trace_glBeginQuery) { glad_trace_next_glBeginQuery = glad_glBeginQuery; glad_glBeginQuery = glad_trace_glBeginQuery; }
+	if(glad_glEndQuery != NULL && glad_glEndQuery != glad_trace_glEndQuery) { glad_trace_next_glEndQuery = glad_glEndQuery; glad_glEndQuery = glad_trace_glEndQuery; }
+	if(glad_glGetQueryiv != NULL && glad_glGetQueryiv != glad_trace_glGetQueryiv) { glad_trace_next_glGetQueryiv = glad_glGetQueryiv; glad_glGetQueryiv = glad_trace_glGetQueryiv; }
+	if(glad_glGetQueryObjectiv != NULL && glad_glGetQueryObjectiv != glad_trace_glGetQueryObjectiv) { glad_trace_next_glGetQueryObjectiv = glad_glGetQueryObjectiv; glad_glGetQueryObjectiv = glad_trace_glGetQueryObjectiv; }
+	if(glad_glGetQueryObjectuiv != NULL && glad_glGetQueryObjectuiv != glad_trace_glGetQueryObjectuiv) { glad_trace_next_glGetQueryObjectuiv = glad_glGetQueryObjectuiv; glad_glGetQueryObjectuiv = glad_trace_glGetQueryObjectuiv; }
+	if(glad_glBindBuffer != NULL && glad_glBindBuffer != glad_trace_glBindBuffer) { glad_trace_next_glBindBuffer = glad_glBindBuffer; glad_glBindBuffer = glad_trace_glBindBuffer; }
+	if(glad_glDeleteBuffers != NULL && glad_glDeleteBuffers != glad_trace_glDeleteBuffers) { glad_trace_next_glDeleteBuffers = glad_glDeleteBuffers; glad_glDeleteBuffers = glad_trace_glDeleteBuffers; }
+	if(glad_glGenBuffers != NULL && glad_glGenBuffers != glad_trace_glGenBuffers) { glad_trace_next_glGenBuffers = glad_glGenBuffers; glad_glGenBuffers = glad_trace_glGenBuffers; }
+	if(glad_glIsBuffer != NULL && glad_glIsBuffer != glad_trace_glIsBuffer) { glad_trace_next_glIsBuffer = glad_glIsBuffer; glad_glIsBuffer = glad_trace_glIsBuffer; }
+	if(glad_glBufferData != NULL && glad_glBufferData != glad_trace_glBufferData) { glad_trace_next_glBufferData = glad_glBufferData; glad_glBufferData = glad_trace_glBufferData; }
+	if(glad_glBufferSubData != NULL && glad_glBufferSubData != glad_trace_glBufferSubData) { glad_trace_next_glBufferSubData = glad_glBufferSubData; glad_glBufferSubData = glad_trace_glBufferSubData; }
+	if(glad_glGetBufferSubData != NULL && glad_glGetBufferSubData != glad_trace_glGetBufferSubData) { glad_trace_next_glGetBufferSubData = glad_glGetBufferSubData; glad_glGetBufferSubData = glad_trace_glGetBufferSubData; }
+	if(glad_glMapBuffer != NULL && glad_glMapBuffer != glad_trace_glMapBuffer) { glad_trace_next_glMapBuffer = glad_glMapBuffer; glad_glMapBuffer = glad_trace_glMapBuffer; }
+	if(glad_glUnmapBuffer != NULL && glad_glUnmapBuffer != glad_trace_glUnmapBuffer) { glad_trace_next_glUnmapBuffer = glad_glUnmapBuffer; glad_glUnmapBuffer = glad_trace_glUnmapBuffer; }
+	if(glad_glGetBufferParameteriv != NULL && glad_glGetBufferParameteriv != glad_trace_glGetBufferParameteriv) { glad_trace_next_glGetBufferParameteriv = glad_glGetBufferParameteriv; glad_glGetBufferParameteriv = glad_trace_glGetBufferParameteriv; }
+	if(glad_glGetBufferPointerv != NULL && glad_glGetBufferPointerv != glad_trace_glGetBufferPointerv) { glad_trace_next_glGetBufferPointerv = glad_glGetBufferPointerv; glad_glGetBufferPointerv = glad_trace_glGetBufferPointerv; }
+	if(glad_glBlendEquationSeparate != NULL && glad_glBlendEquationSeparate != glad_trace_glBlendEquationSeparate) { glad_trace_next_glBlendEquationSeparate = glad_glBlendEquationSeparate; glad_glBlendEquationSeparate = glad_trace_glBlendEquationSeparate; }
+	if(glad_glDrawBuffers != NULL && glad_glDrawBuffers != glad_trace_glDrawBuffers) { glad_trace_next_glDrawBuffers = glad_glDrawBuffers; glad_glDrawBuffers = glad_trace_glDrawBuffers; }
+	if(glad_glStencilOpSeparate != NULL && glad_glStencilOpSeparate != glad_trace_glStencilOpSeparate) { glad_trace_next_glStencilOpSeparate = glad_glStencilOpSeparate; glad_glStencilOpSeparate = glad_trace_glStencilOpSeparate; }
+	if(glad_glStencilFuncSeparate != NULL && glad_glStencilFuncSeparate != glad_trace_glStencilFuncSeparate) { glad_trace_next_glStencilFuncSeparate = glad_glStencilFuncSeparate; glad_glStencilFuncSeparate = glad_trace_glStencilFuncSeparate; }
+	if(glad_glStencilMaskSeparate != NULL && glad_glStencilMaskSeparate != glad_trace_glStencilMaskSeparate) { glad_trace_next_glStencilMaskSeparate = glad_glStencilMaskSeparate; glad_glStencilMaskSeparate = glad_trace_glStencilMaskSeparate; }
+	if(glad_glAttachShader != NULL && glad_glAttachShader != glad_trace_glAttachShader) { glad_trace_next_glAttachShader = glad_glAttachShader; glad_glAttachShader = glad_trace_glAttachShader; }
+	if(glad_glBindAttribLocation != NULL && glad_glBindAttribLocation != glad_trace_glBindAttribLocation) { glad_trace_next_glBindAttribLocation = glad_glBindAttribLocation; glad_glBindAttribLocation = glad_trace_glBindAttribLocation; }
+	if(glad_glCompileShader != NULL && glad_glCompileShader != glad_trace_glCompileShader) { glad_trace_next_glCompileShader = glad_glCompileShader; glad_glCompileShader = glad_trace_glCompileShader; }
+	if(glad_glCreateProgram != NULL && glad_glCreateProgram != glad_trace_glCreateProgram) { glad_trace_next_glCreateProgram = glad_glCreateProgram; glad_glCreateProgram = glad_trace_glCreateProgram; }
+	if(glad_glCreateShader != NULL && glad_glCreateShader != glad_trace_glCreateShader) { glad_trace_next_glCreateShader = glad_glCreateShader; glad_glCreateShader = glad_trace_glCreateShader; }
+	if(glad_glDeleteProgram != NULL && glad_glDeleteProgram != glad_trace_glDeleteProgram) { glad_trace_next_glDeleteProgram = glad_glDeleteProgram; glad_glDeleteProgram = glad_trace_glDeleteProgram; }
+	if(glad_glDeleteShader != NULL && glad_glDeleteShader != glad_trace_glDeleteShader) { glad_trace_next_glDeleteShader = glad_glDeleteShader; glad_glDeleteShader = glad_trace_glDeleteShader; }
+	if(glad_glDetachShader != NULL && glad_glDetachShader != glad_trace_glDetachShader) { glad_trace_next_glDetachShader = glad_glDetachShader; glad_glDetachShader = glad_trace_glDetachShader; }
+	if(glad_glDisableVertexAttribArray != NULL && glad_glDisableVertexAttribArray != glad_trace_glDisableVertexAttribArray) { glad_trace_next_glDisableVertexAttribArray = glad_glDisableVertexAttribArray; glad_glDisableVertexAttribArray = glad_trace_glDisableVertexAttribArray; }
+	if(glad_glEnableVertexAttribArray != NULL && glad_glEnableVertexAttribArray != glad_trace_glEnableVertexAttribArray) { glad_trace_next_glEnableVertexAttribArray = glad_glEnableVertexAttribArray; glad_glEnableVertexAttribArray = glad_trace_glEnableVertexAttribArray; }
+	if(glad_glGetActiveAttrib != NULL && glad_glGetActiveAttrib != glad_trace_glGetActiveAttrib) { glad_trace_next_glGetActiveAttrib = glad_glGetActiveAttrib; glad_glGetActiveAttrib = glad_trace_glGetActiveAttrib; }
+	if(glad_glGetActiveUniform != NULL && glad_glGetActiveUniform != glad_trace_glGetActiveUniform) { glad_trace_next_glGetActiveUniform = glad_glGetActiveUniform; glad_glGetActiveUniform = glad_trace_glGetActiveUniform; }
+	if(glad_glGetAttachedShaders != NULL && glad_glGetAttachedShaders != glad_trace_glGetAttachedShaders) { glad_trace_next_glGetAttachedShaders = glad_glGetAttachedShaders; glad_glGetAttachedShaders = glad_trace_glGetAttachedShaders; }
+	if(glad_glGetAttribLocation != NULL && glad_glGetAttribLocation != glad_trace_glGetAttribLocation) { glad_trace_next_glGetAttribLocation = glad_glGetAttribLocation; glad_glGetAttribLocation = glad_trace_glGetAttribLocation; }
+	if(glad_glGetProgramiv != NULL && glad_glGetProgramiv != glad_trace_glGetProgramiv) { glad_trace_next_glGetProgramiv = glad_glGetProgramiv; glad_glGetProgramiv = glad_trace_glGetProgramiv; }
+	if(glad_glGetProgramInfoLog != NULL && glad_glGetProgramInfoLog != glad_trace_glGetProgramInfoLog) { glad_trace_next_glGetProgramInfoLog = glad_glGetProgramInfoLog; glad_glGetProgramInfoLog = glad_trace_glGetProgramInfoLog; }
+	if(glad_glGetShaderiv != NULL && glad_glGetShaderiv != glad_trace_glGetShaderiv) { glad_trace_next_glGetShaderiv = glad_glGetShaderiv; glad_glGetShaderiv = glad_trace_glGetShaderiv; }
+	if(glad_glGetShaderInfoLog != NULL && glad_glGetShaderInfoLog != glad_trace_glGetShaderInfoLog) { glad_trace_next_glGetShaderInfoLog = glad_glGetShaderInfoLog; glad_glGetShaderInfoLog = glad_trace_glGetShaderInfoLog; }
+	if(glad_glGetShaderSource != NULL && glad_glGetShaderSource != glad_trace_glGetShaderSource) { glad_trace_next_glGetShaderSource = glad_glGetShaderSource; glad_glGetShaderSource = glad_trace_glGetShaderSource; }
+	if(glad_glGetUniformLocation != NULL && glad_glGetUniformLocation != glad_trace_glGetUniformLocation) { glad_trace_next_glGetUniformLocation = glad_glGetUniformLocation; glad_glGetUniformLocation = glad_trace_glGetUniformLocation; }
+	if(glad_glGetUniformfv != NULL && glad_glGetUniformfv != glad_trace_glGetUniformfv) { glad_trace_next_glGetUniformfv = glad_glGetUniformfv; glad_glGetUniformfv = glad_trace_glGetUniformfv; }
+	if(glad_glGetUniformiv != NULL && glad_glGetUniformiv != glad_trace_glGetUniformiv) { glad_trace_next_glGetUniformiv = glad_glGetUniformiv; glad_glGetUniformiv = glad_trace_glGetUniformiv; }
+	if(glad_glGetVertexAttribdv != NULL && glad_glGetVertexAttribdv != glad_trace_glGetVertexAttribdv) { glad_trace_next_glGetVertexAttribdv = glad_glGetVertexAttribdv; glad_glGetVertexAttribdv = glad_trace_glGetVertexAttribdv; }
+	if(glad_glGetVertexAttribfv != NULL && glad_glGetVertexAttribfv != glad_trace_glGetVertexAttribfv) { glad_trace_next_glGetVertexAttribfv = glad_glGetVertexAttribfv; glad_glGetVertexAttribfv = glad_trace_glGetVertexAttribfv; }
+	if(glad_glGetVertexAttribiv != NULL && glad_glGetVertexAttribiv != glad_trace_glGetVertexAttribiv) { glad_trace_next_glGetVertexAttribiv = glad_glGetVertexAttribiv; glad_glGetVertexAttribiv = glad_trace_glGetVertexAttribiv; }
+	if(glad_glGetVertexAttribPointerv != NULL && glad_glGetVertexAttribPointerv != glad_trace_glGetVertexAttribPointerv) { glad_trace_next_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv; glad_glGetVertexAttribPointerv = glad_trace_glGetVertexAttribPointerv; }
+	if(glad_glIsProgram != NULL && glad_glIsProgram != glad_trace_glIsProgram) { glad_trace_next_glIsProgram = glad_glIsProgram; glad_glIsProgram = glad_trace_glIsProgram; }
+	if(glad_glIsShader != NULL && glad_glIsShader != glad_trace_glIsShader) { glad_trace_next_glIsShader = glad_glIsShader; glad_glIsShader = glad_trace_glIsShader; }
+	if(glad_glLinkProgram != NULL && glad_glLinkProgram != glad_trace_glLinkProgram) { glad_trace_next_glLinkProgram = glad_glLinkProgram; glad_glLinkProgram = glad_trace_glLinkProgram; }
+	if(glad_glShaderSource != NULL && glad_glShaderSource != glad_trace_glShaderSource) { glad_trace_next_glShaderSource = glad_glShaderSource; glad_glShaderSource = glad_trace_glShaderSource; }
+	if(glad_glUseProgram != NULL && glad_glUseProgram != glad_trace_glUseProgram) { glad_trace_next_glUseProgram = glad_glUseProgram; glad_glUseProgram = glad_trace_glUseProgram; }
+	if(glad_glUniform1f != NULL && glad_glUniform1f != glad_trace_glUniform1f) { glad_trace_next_glUniform1f = glad_glUniform1f; glad_glUniform1f = glad_trace_glUniform1f; }
+	if(glad_glUniform2f != NULL && glad_glUniform2f != glad_trace_glUniform2f) { glad_trace_next_glUniform2f = glad_glUniform2f; glad_glUniform2f = glad_trace_glUniform2f; }
+	if(glad_glUniform3f != NULL && glad_glUniform3f != glad_trace_glUniform3f) { glad_trace_next_glUniform3f = glad_glUniform3f; glad_glUniform3f = glad_trace_glUniform3f; }
+	if(glad_glUniform4f != NULL && glad_glUniform4f != glad_trace_glUniform4f) { glad_trace_next_glUniform4f = glad_glUniform4f; glad_glUniform4f = glad_trace_glUniform4f; }
+	if(glad_glUniform1i != NULL && glad_glUniform1i != glad_trace_glUniform1i) { glad_trace_next_glUniform1i = glad_glUniform1i; glad_glUniform1i = glad_trace_glUniform1i; }
+	if(glad_glUniform2i != NULL && glad_glUniform2i != glad_trace_glUniform2i) { glad_trace_next_glUniform2i = glad_glUniform2i; glad_glUniform2i = glad_trace_glUniform2i; }
+	if(glad_glUniform3i != NULL && glad_glUniform3i != glad_trace_glUniform3i) { glad_trace_next_glUniform3i = glad_glUniform3i; glad_glUniform3i = glad_trace_glUniform3i; }
+	if(glad_glUniform4i != NULL && glad_glUniform4i != glad_trace_glUniform4i) { glad_trace_next_glUniform4i = glad_glUniform4i; glad_glUniform4i = glad_trace_glUniform4i; }
+	if(glad_glUniform1fv != NULL && glad_glUniform1fv != glad_trace_glUniform1fv) { glad_trace_next_glUniform1fv = glad_glUniform1fv; glad_glUniform1fv = glad_trace_glUniform1fv; }
+	if(glad_glUniform2fv != NULL && glad_glUniform2fv != glad_trace_glUniform2fv) { glad_trace_next_glUniform2fv = glad_glUniform2fv; glad_glUniform2fv = glad_trace_glUniform2fv; }
+	if(glad_glUniform3fv != NULL && glad_glUniform3fv != glad_trace_glUniform3fv) { glad_trace_next_glUniform3fv = glad_glUniform3fv; glad_glUniform3fv = glad_trace_glUniform3fv; }
+	if(glad_glUniform4fv != NULL && glad_glUniform4fv != glad_trace_glUniform4fv) { glad_trace_next_glUniform4fv = glad_glUniform4fv; glad_glUniform4fv = glad_trace_glUniform4fv; }
+	if(glad_glUniform1iv != NULL && glad_glUniform1iv != glad_trace_glUniform1iv) { glad_trace_next_glUniform1iv = glad_glUniform1iv; glad_glUniform1iv = glad_trace_glUniform1iv; }
+	if(glad_glUniform2iv != NULL && glad_glUniform2iv != glad_trace_glUniform2iv) { glad_trace_next_glUniform2iv = glad_glUniform2iv; glad_glUniform2iv = glad_trace_glUniform2iv; }
+	if(glad_glUniform3iv != NULL && glad_glUniform3iv != glad_trace_glUniform3iv) { glad_trace_next_glUniform3iv = glad_glUniform3iv; glad_glUniform3iv = glad_trace_glUniform3iv; }
+	if(glad_glUniform4iv != NULL && glad_glUniform4iv != glad_trace_glUniform4iv) { glad_trace_next_glUniform4iv = glad_glUniform4iv; glad_glUniform4iv = glad_trace_glUniform4iv; }
+	if(glad_glUniformMatrix2fv != NULL && glad_glUniformMatrix2fv != glad_trace_glUniformMatrix2fv) { glad_trace_next_glUniformMatrix2fv = glad_glUniformMatrix2fv; glad_glUniformMatrix2fv = glad_trace_glUniformMatrix2fv; }
+	if(glad_glUniformMatrix3fv != NULL && glad_glUniformMatrix3fv != glad_trace_glUniformMatrix3fv) { glad_trace_next_glUniformMatrix3fv = glad_glUniformMatrix3fv; glad_glUniformMatrix3fv = glad_trace_glUniformMatrix3fv; }
+	if(glad_glUniformMatrix4fv != NULL && glad_glUniformMatrix4fv != glad_trace_glUniformMatrix4fv) { glad_trace_next_glUniformMatrix4fv = glad_glUniformMatrix4fv; glad_glUniformMatrix4fv = glad_trace_glUniformMatrix4fv; }
+	if(glad_glValidateProgram != NULL && glad_glValidateProgram != glad_trace_glValidateProgram) { glad_trace_next_glValidateProgram = glad_glValidateProgram; glad_glValidateProgram = glad_trace_glValidateProgram; }
+	if(glad_glVertexAttrib1d != NULL && glad_glVertexAttrib1d != glad_trace_glVertexAttrib1d) { glad_trace_next_glVertexAttrib1d = glad_glVertexAttrib1d; glad_glVertexAttrib1d = glad_trace_glVertexAttrib1d; }
+	if(glad_glVertexAttrib1dv != NULL && glad_glVertexAttrib1dv != glad_trace_glVertexAttrib1dv) { glad_trace_next_glVertexAttrib1dv = glad_glVertexAttrib1dv; glad_glVertexAttrib1dv = glad_trace_glVertexAttrib1dv; }
+	if(glad_glVertexAttrib1f != NULL && glad_glVertexAttrib1f != glad_trace_glVertexAttrib1f) { glad_trace_next_glVertexAttrib1f = glad_glVertexAttrib1f; glad_glVertexAttrib1f = glad_trace_glVertexAttrib1f; }
+	if(glad_glVertexAttrib1fv != NULL && glad_glVertexAttrib1fv != glad_trace_glVertexAttrib1fv) { glad_trace_next_glVertexAttrib1fv = glad_glVertexAttrib1fv; glad_glVertexAttrib1fv = glad_trace_glVertexAttrib1fv; }
+	if(glad_glVertexAttrib1s != NULL && glad_glVertexAttrib1s != glad_trace_glVertexAttrib1s) { glad_trace_next_glVertexAttrib1s = glad_glVertexAttrib1s; glad_glVertexAttrib1s = glad_trace_glVertexAttrib1s; }
+	if(glad_glVertexAttrib1sv != NULL && glad_glVertexAttrib1sv != glad_trace_glVertexAttrib1sv) { glad_trace_next_glVertexAttrib1sv = glad_glVertexAttrib1sv; glad_glVertexAttrib1sv = glad_trace_glVertexAttrib1sv; }
+	if(glad_glVertexAttrib2d != NULL && glad_glVertexAttrib2d != glad_trace_glVertexAttrib2d) { glad_trace_next_glVertexAttrib2d = glad_glVertexAttrib2d; glad_glVertexAttrib2d = glad_trace_glVertexAttrib2d; }
+	if(glad_glVertexAttrib2dv != NULL && glad_glVertexAttrib2dv != glad_trace_glVertexAttrib2dv) { glad_trace_next_glVertexAttrib2dv = glad_glVertexAttrib2dv; glad_glVertexAttrib2dv = glad_trace_glVertexAttrib2dv; }
+	if(glad_glVertexAttrib2f != NULL && glad_glVertexAttrib2f != glad_trace_glVertexAttrib2f) { glad_trace_next_glVertexAttrib2f = glad_glVertexAttrib2f; glad_glVertexAttrib2f = glad_trace_glVertexAttrib2f; }
+	if(glad_glVertexAttrib2fv != NULL && glad_glVertexAttrib2fv != glad_trace_glVertexAttrib2fv) { glad_trace_next_glVertexAttrib2fv = glad_glVertexAttrib2fv; glad_glVertexAttrib2fv = glad_trace_glVertexAttrib2fv; }
+	if(glad_glVertexAttrib2s != NULL && glad_glVertexAttrib2s != glad_trace_glVertexAttrib2s) { glad_trace_next_glVertexAttrib2s = glad_glVertexAttrib2s; glad_glVertexAttrib2s = glad_trace_glVertexAttrib2s; }
+	if(glad_glVertexAttrib2sv != NULL && glad_glVertexAttrib2sv != glad_trace_glVertexAttrib2sv) { glad_trace_next_glVertexAttrib2sv = glad_glVertexAttrib2sv; glad_glVertexAttrib2sv = glad_trace_glVertexAttrib2sv; }
+	if(glad_glVertexAttrib3d != NULL && glad_glVertexAttrib3d != glad_trace_glVertexAttrib3d) { glad_trace_next_glVertexAttrib3d = glad_glVertexAttrib3d; glad_glVertexAttrib3d = glad_trace_glVertexAttrib3d; }
+	if(glad_glVertexAttrib3dv != NULL && glad_glVertexAttrib3dv != glad_trace_glVertexAttrib3dv) { glad_trace_next_glVertexAttrib3dv = glad_glVertexAttrib3dv; glad_glVertexAttrib3dv = glad_trace_glVertexAttrib3dv; }
+	if(glad_glVertexAttrib3f != NULL && glad_glVertexAttrib3f != glad_trace_glVertexAttrib3f) { glad_trace_next_glVertexAttrib3f = glad_glVertexAttrib3f; glad_glVertexAttrib3f = glad_trace_glVertexAttrib3f; }
+	if(glad_glVertexAttrib3fv != NULL && glad_glVertexAttrib3fv != glad_trace_glVertexAttrib3fv) { glad_trace_next_glVertexAttrib3fv = glad_glVertexAttrib3fv; glad_glVertexAttrib3fv = glad_trace_glVertexAttrib3fv; }
+	if(glad_glVertexAttrib3s != NULL && glad_glVertexAttrib3s != glad_trace_glVertexAttrib3s) { glad_trace_next_glVertexAttrib3s = glad_glVertexAttrib3s; glad_glVertexAttrib3s = glad_trace_glVertexAttrib3s; }
+	if(glad_glVertexAttrib3sv != NULL && glad_glVertexAttrib3sv != glad_trace_glVertexAttrib3sv) { glad_trace_next_glVertexAttrib3sv = glad_glVertexAttrib3sv; glad_glVertexAttrib3sv = glad_trace_glVertexAttrib3sv; }
+	if(glad_glVertexAttrib4Nbv != NULL && glad_glVertexAttrib4Nbv != glad_trace_glVertexAttrib4Nbv) { glad_trace_next_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv; glad_glVertexAttrib4Nbv = glad_trace_glVertexAttrib4Nbv; }
+	if(glad_glVertexAttrib4Niv != NULL && glad_glVertexAttrib4Niv != glad_trace_glVertexAttrib4Niv) { glad_trace_next_glVertexAttrib4Niv = glad_glVertexAttrib4Niv; glad_glVertexAttrib4Niv = glad_trace_glVertexAttrib4Niv; }
+	if(glad_glVertexAttrib4Nsv != NULL && glad_glVertexAttrib4Nsv != glad_trace_glVertexAttrib4Nsv) { glad_trace_next_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv; glad_glVertexAttrib4Nsv = glad_trace_glVertexAttrib4Nsv; }
+	if(glad_glVertexAttrib4Nub != NULL && glad_glVertexAttrib4Nub != glad_trace_glVertexAttrib4Nub) { glad_trace_next_glVertexAttrib4Nub = glad_glVertexAttrib4Nub; glad_glVertexAttrib4Nub = glad_trace_glVertexAttrib4Nub; }
+	if(glad_glVertexAttrib4Nubv != NULL && glad_glVertexAttrib4Nubv != glad_trace_glVertexAttrib4Nubv) { glad_trace_next_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv; glad_glVertexAttrib4Nubv = glad_trace_glVertexAttrib4Nubv; }
+	if(glad_glVertexAttrib4Nuiv != NULL && glad_glVertexAttrib4Nuiv != glad_trace_glVertexAttrib4Nuiv) { glad_trace_next_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv; glad_glVertexAttrib4Nuiv = glad_trace_glVertexAttrib4Nuiv; }
+	if(glad_glVertexAttrib4Nusv != NULL && glad_glVertexAttrib4Nusv != glad_trace_glVertexAttrib4Nusv) { glad_trace_next_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv; glad_glVertexAttrib4Nusv = glad_trace_glVertexAttrib4Nusv; }
+	if(glad_glVertexAttrib4bv != NULL && glad_glVertexAttrib4bv != glad_trace_glVertexAttrib4bv) { glad_trace_next_glVertexAttrib4bv = glad_glVertexAttrib4bv; glad_glVertexAttrib4bv = glad_trace_glVertexAttrib4bv; }
+	if(glad_glVertexAttrib4d != NULL && glad_glVertexAttrib4d != glad_trace_glVertexAttrib4d) { glad_trace_next_glVertexAttrib4d = glad_glVertexAttrib4d; glad_glVertexAttrib4d = glad_trace_glVertexAttrib4d; }
+	if(glad_glVertexAttrib4dv != NULL && glad_glVertexAttrib4dv != glad_trace_glVertexAttrib4dv) { glad_trace_next_glVertexAttrib4dv = glad_glVertexAttrib4dv; glad_glVertexAttrib4dv = glad_trace_glVertexAttrib4dv; }
+	if(glad_glVertexAttrib4f != NULL && glad_glVertexAttrib4f != glad_trace_glVertexAttrib4f) { glad_trace_next_glVertexAttrib4f = glad_glVertexAttrib4f; glad_glVertexAttrib4f = glad_trace_glVertexAttrib4f; }
+	if(glad_glVertexAttrib4fv != NULL && glad_glVertexAttrib4fv != glad_trace_glVertexAttrib4fv) { glad_trace_next_glVertexAttrib4fv = glad_glVertexAttrib4fv; glad_glVertexAttrib4fv = glad_trace_glVertexAttrib4fv; }
+	if(glad_glVertexAttrib4iv != NULL && glad_glVertexAttrib4iv != glad_trace_glVertexAttrib4iv) { glad_trace_next_glVertexAttrib4iv = glad_glVertexAttrib4iv; glad_glVertexAttrib4iv = glad_trace_glVertexAttrib4iv; }
+	if(glad_glVertexAttrib4s != NULL && glad_glVertexAttrib4s != glad_trace_glVertexAttrib4s) { glad_trace_next_glVertexAttrib4s = glad_glVertexAttrib4s; glad_glVertexAttrib4s = glad_trace_glVertexAttrib4s; }
+	if(glad_glVertexAttrib4sv != NULL && glad_glVertexAttrib4sv != glad_trace_glVertexAttrib4sv) { glad_trace_next_glVertexAttrib4sv = glad_glVertexAttrib4sv; glad_glVertexAttrib4sv = glad_trace_glVertexAttrib4sv; }
+	if(glad_glVertexAttrib4ubv != NULL && glad_glVertexAttrib4ubv != glad_trace_glVertexAttrib4ubv) { glad_trace_next_glVertexAttrib4ubv = glad_glVertexAttrib4ubv; glad_glVertexAttrib4ubv = glad_trace_glVertexAttrib4ubv; }
+	if(glad_glVertexAttrib4uiv != NULL && glad_glVertexAttrib4uiv != glad_trace_glVertexAttrib4uiv) { glad_trace_next_glVertexAttrib4uiv = glad_glVertexAttrib4uiv; glad_glVertexAttrib4uiv = glad_trace_glVertexAttrib4uiv; }
+	if(glad_glVertexAttrib4usv != NULL && glad_glVertexAttrib4usv != glad_trace_glVertexAttrib4usv) { glad_trace_next_glVertexAttrib4usv = glad_glVertexAttrib4usv; glad_glVertexAttrib4usv = glad_trace_glVertexAttrib4usv; }
+	if(glad_glVertexAttribPointer != NULL && glad_glVertexAttribPointer != glad_trace_glVertexAttribPointer) { glad_trace_next_glVertexAttribPointer = glad_glVertexAttribPointer; glad_glVertexAttribPointer = glad_trace_glVertexAttribPointer; }
+	if(glad_glUniformMatrix2x3fv != NULL && glad_glUniformMatrix2x3fv != glad_trace_glUniformMatrix2x3fv) { glad_trace_next_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv; glad_glUniformMatrix2x3fv = glad_trace_glUniformMatrix2x3fv; }
+	if(glad_glUniformMatrix3x2fv != NULL && glad_glUniformMatrix3x2fv != glad_trace_glUniformMatrix3x2fv) { glad_trace_next_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv; glad_glUniformMatrix3x2fv = glad_trace_glUniformMatrix3x2fv; }
+	if(glad_glUniformMatrix2x4fv != NULL && glad_glUniformMatrix2x4fv != glad_trace_glUniformMatrix2x4fv) { glad_trace_next_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv; glad_glUniformMatrix2x4fv = glad_trace_glUniformMatrix2x4fv; }
+	if(glad_glUniformMatrix4x2fv != NULL && glad_glUniformMatrix4x2fv != glad_trace_glUniformMatrix4x2fv) { glad_trace_next_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv; glad_glUniformMatrix4x2fv = glad_trace_glUniformMatrix4x2fv; }
+	if(glad_glUniformMatrix3x4fv != NULL && glad_glUniformMatrix3x4fv != glad_trace_glUniformMatrix3x4fv) { glad_trace_next_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv; glad_glUniformMatrix3x4fv = glad_trace_glUniformMatrix3x4fv; }
+	if(glad_glUniformMatrix4x3fv != NULL && glad_glUniformMatrix4x3fv != glad_trace_glUniformMatrix4x3fv) { glad_trace_next_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv; glad_glUniformMatrix4x3fv = glad_trace_glUniformMatrix4x3fv; }
+	if(glad_glColorMaski != NULL && glad_glColorMaski != glad_trace_glColorMaski) { glad_trace_next_glColorMaski = glad_glColorMaski; glad_glColorMaski = glad_trace_glColorMaski; }
+	if(glad_glGetBooleani_v != NULL && glad_glGetBooleani_v != glad_trace_glGetBooleani_v) { glad_trace_next_glGetBooleani_v = glad_glGetBooleani_v; glad_glGetBooleani_v = glad_trace_glGetBooleani_v; }
+	if(glad_glGetIntegeri_v != NULL && glad_glGetIntegeri_v != glad_trace_glGetIntegeri_v) { glad_trace_next_glGetIntegeri_v = glad_glGetIntegeri_v; glad_glGetIntegeri_v = glad_trace_glGetIntegeri_v; }
+	if(glad_glEnablei != NULL && glad_glEnablei != glad_trace_glEnablei) { glad_trace_next_glEnablei = glad_glEnablei; glad_glEnablei = glad_trace_glEnablei; }
+	if(glad_glDisablei != NULL && glad_glDisablei != glad_trace_glDisablei) { glad_trace_next_glDisablei = glad_glDisablei; glad_glDisablei = glad_trace_glDisablei; }
+	if(glad_glIsEnabledi != NULL && glad_glIsEnabledi != glad_trace_glIsEnabledi) { glad_trace_next_glIsEnabledi = glad_glIsEnabledi; glad_glIsEnabledi = glad_trace_glIsEnabledi; }
+	if(glad_glBeginTransformFeedback != NULL && glad_glBeginTransformFeedback != glad_trace_glBeginTransformFeedback) { glad_trace_next_glBeginTransformFeedback = glad_glBeginTransformFeedback; glad_glBeginTransformFeedback = glad_trace_glBeginTransformFeedback; }
+	if(glad_glEndTransformFeedback != NULL && glad_glEndTransformFeedback != glad_trace_glEndTransformFeedback) { glad_trace_next_glEndTransformFeedback = glad_glEndTransformFeedback; glad_glEndTransformFeedback = glad_trace_glEndTransformFeedback; }
+	if(glad_glBindBufferRange != NULL && glad_glBindBufferRange != glad_trace_glBindBufferRange) { glad_trace_next_glBindBufferRange = glad_glBindBufferRange; glad_glBindBufferRange = glad_trace_glBindBufferRange; }
+	if(glad_glBindBufferBase != NULL && glad_glBindBufferBase != glad_trace_glBindBufferBase) { glad_trace_next_glBindBufferBase = glad_glBindBufferBase; glad_glBindBufferBase = glad_trace_glBindBufferBase; }
+	if(glad_glTransformFeedbackVaryings != NULL && glad_glTransformFeedbackVaryings != glad_trace_glTransformFeedbackVaryings) { glad_trace_next_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings; glad_glTransformFeedbackVaryings = glad_trace_glTransformFeedbackVaryings; }
+	if(glad_glGetTransformFeedbackVarying != NULL && glad_glGetTransformFeedbackVarying != glad_trace_glGetTransformFeedbackVarying) { glad_trace_next_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying; glad_glGetTransformFeedbackVarying = glad_trace_glGetTransformFeedbackVarying; }
+	if(glad_glClampColor != NULL && glad_glClampColor != glad_trace_glClampColor) { glad_trace_next_glClampColor = glad_glClampColor; glad_glClampColor = glad_trace_glClampColor; }
+	if(glad_glBeginConditionalRender != NULL && glad_glBeginConditionalRender != glad_trace_glBeginConditionalRender) { glad_trace_next_glBeginConditionalRender = glad_glBeginConditionalRender; glad_glBeginConditionalRender = glad_trace_glBeginConditionalRender; }
+	if(glad_glEndConditionalRender != NULL && glad_glEndConditionalRender != glad_trace_glEndConditionalRender) { glad_trace_next_glEndConditionalRender = glad_glEndConditionalRender; glad_glEndConditionalRender = glad_trace_glEndConditionalRender; }
+	if(glad_glVertexAttribIPointer != NULL && glad_glVertexAttribIPointer != glad_trace_glVertexAttribIPointer) { glad_trace_next_glVertexAttribIPointer = glad_glVertexAttribIPointer; glad_glVertexAttribIPointer = glad_trace_glVertexAttribIPointer; }
+	if(glad_glGetVertexAttribIiv != NULL && glad_glGetVertexAttribIiv != glad_trace_glGetVertexAttribIiv) { glad_trace_next_glGetVertexAttribIiv = glad_glGetVertexAttribIiv; glad_glGetVertexAttribIiv = glad_trace_glGetVertexAttribIiv; }
+	if(glad_glGetVertexAttribIuiv != NULL && glad_glGetVertexAttribIuiv != glad_trace_glGetVertexAttribIuiv) { glad_trace_next_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv; glad_glGetVertexAttribIuiv = glad_trace_glGetVertexAttribIuiv; }
+	if(glad_glVertexAttribI1i != NULL && glad_glVertexAttribI1i != glad_trace_glVertexAttribI1i) { glad_trace_next_glVertexAttribI1i = glad_glVertexAttribI1i; glad_glVertexAttribI1i = glad_trace_glVertexAttribI1i; }
+	if(glad_glVertexAttribI2i != NULL && glad_glVertexAttribI2i != glad_trace_glVertexAttribI2i) { glad_trace_next_glVertexAttribI2i = glad_glVertexAttribI2i; glad_glVertexAttribI2i = glad_trace_glVertexAttribI2i; }
+	if(glad_glVertexAttribI3i != NULL && glad_glVertexAttribI3i != glad_trace_glVertexAttribI3i) { glad_trace_next_glVertexAttribI3i = glad_glVertexAttribI3i; glad_glVertexAttribI3i = glad_trace_glVertexAttribI3i; }
+	if(glad_glVertexAttribI4i != NULL && glad_glVertexAttribI4i != glad_trace_glVertexAttribI4i) { glad_trace_next_glVertexAttribI4i = glad_glVertexAttribI4i; glad_glVertexAttribI4i = glad_trace_glVertexAttribI4i; }
+	if(glad_glVertexAttribI1ui != NULL && glad_glVertexAttribI1ui != glad_trace_glVertexAttribI1ui) { glad_trace_next_glVertexAttribI1ui = glad_glVertexAttribI1ui; glad_glVertexAttribI1ui = glad_trace_glVertexAttribI1ui; }
+	if(glad_glVertexAttribI2ui != NULL && glad_glVertexAttribI2ui != glad_trace_glVertexAttribI2ui) { glad_trace_next_glVertexAttribI2ui = glad_glVertexAttribI2ui; glad_glVertexAttribI2ui = glad_trace_glVertexAttribI2ui; }
+	if(glad_glVertexAttribI3ui != NULL && glad_glVertexAttribI3ui != glad_trace_glVertexAttribI3ui) { glad_trace_next_glVertexAttribI3ui = glad_glVertexAttribI3ui; glad_glVertexAttribI3ui = glad_trace_glVertexAttribI3ui; }
+	if(glad_glVertexAttribI4ui != NULL && glad_glVertexAttribI4ui != glad_trace_glVertexAttribI4ui) { glad_trace_next_glVertexAttribI4ui = glad_glVertexAttribI4ui; glad_glVertexAttribI4ui = glad_trace_glVertexAttribI4ui; }
+	if(glad_glVertexAttribI1iv != NULL && glad_glVertexAttribI1iv != glad_trace_glVertexAttribI1iv) { glad_trace_next_glVertexAttribI1iv = glad_glVertexAttribI1iv; glad_glVertexAttribI1iv = glad_trace_glVertexAttribI1iv; }
+	if(glad_glVertexAttribI2iv != NULL && glad_glVertexAttribI2iv != glad_trace_glVertexAttribI2iv) { glad_trace_next_glVertexAttribI2iv = glad_glVertexAttribI2iv; glad_glVertexAttribI2iv = glad_trace_glVertexAttribI2iv; }
+	if(glad_glVertexAttribI3iv != NULL && glad_glVertexAttribI3iv != glad_trace_glVertexAttribI3iv) { glad_trace_next_glVertexAttribI3iv = glad_glVertexAttribI3iv; glad_glVertexAttribI3iv = glad_trace_glVertexAttribI3iv; }
+	if(glad_glVertexAttribI4iv != NULL && glad_glVertexAttribI4iv != glad_trace_glVertexAttribI4iv) { glad_trace_next_glVertexAttribI4iv = glad_glVertexAttribI4iv; glad_glVertexAttribI4iv = glad_trace_glVertexAttribI4iv; }
+	if(glad_glVertexAttribI1uiv != NULL && glad_glVertexAttribI1uiv != glad_trace_glVertexAttribI1uiv) { glad_trace_next_glVertexAttribI1uiv = glad_glVertexAttribI1uiv; glad_glVertexAttribI1uiv = glad_trace_glVertexAttribI1uiv; }
+	if(glad_glVertexAttribI2uiv != NULL && glad_glVertexAttribI2uiv != glad_trace_glVertexAttribI2uiv) { glad_trace_next_glVertexAttribI2uiv = glad_glVertexAttribI2uiv; glad_glVertexAttribI2uiv = glad_trace_glVertexAttribI2uiv; }
+	if(glad_glVertexAttribI3uiv != NULL && glad_glVertexAttribI3uiv != glad_trace_glVertexAttribI3uiv) { glad_trace_next_glVertexAttribI3uiv = glad_glVertexAttribI3uiv; glad_glVertexAttribI3uiv = glad_trace_glVertexAttribI3uiv; }
+	if(glad_glVertexAttribI4uiv != NULL && glad_glVertexAttribI4uiv != glad_trace_glVertexAttribI4uiv) { glad_trace_next_glVertexAttribI4uiv = glad_glVertexAttribI4uiv; glad_glVertexAttribI4uiv = glad_trace_glVertexAttribI4uiv; }
+	if(glad_glVertexAttribI4bv != NULL && glad_glVertexAttribI4bv != glad_trace_glVertexAttribI4bv) { glad_trace_next_glVertexAttribI4bv = glad_glVertexAttribI4bv; glad_glVertexAttribI4bv = glad_trace_glVertexAttribI4bv; }
+	if(glad_glVertexAttribI4sv != NULL && glad_glVertexAttribI4sv != glad_trace_glVertexAttribI4sv) { glad_trace_next_glVertexAttribI4sv = glad_glVertexAttribI4sv; glad_glVertexAttribI4sv = glad_trace_glVertexAttribI4sv; }
+	if(glad_glVertexAttribI4ubv != NULL && glad_glVertexAttribI4ubv != glad_trace_glVertexAttribI4ubv) { glad_trace_next_glVertexAttribI4ubv = glad_glVertexAttribI4ubv; glad_glVertexAttribI4ubv = glad_trace_glVertexAttribI4ubv; }
+	if(glad_glVertexAttribI4usv != NULL && glad_glVertexAttribI4usv != glad_trace_glVertexAttribI4usv) { glad_trace_next_glVertexAttribI4usv = glad_glVertexAttribI4usv; glad_glVertexAttribI4usv = glad_trace_glVertexAttribI4usv; }
+	if(glad_glGetUniformuiv != NULL && glad_glGetUniformuiv != glad_trace_glGetUniformuiv) { glad_trace_next_glGetUniformuiv = glad_glGetUniformuiv; glad_glGetUniformuiv = glad_trace_glGetUniformuiv; }
+	if(glad_glBindFragDataLocation != NULL && glad_glBindFragDataLocation != glad_trace_glBindFragDataLocation) { glad_trace_next_glBindFragDataLocation = glad_glBindFragDataLocation; glad_glBindFragDataLocation = glad_trace_glBindFragDataLocation; }
+	if(glad_glGetFragDataLocation != NULL && glad_glGetFragDataLocation != glad_trace_glGetFragDataLocation) { glad_trace_next_glGetFragDataLocation = glad_glGetFragDataLocation; glad_glGetFragDataLocation = glad_trace_glGetFragDataLocation; }
+	if(glad_glUniform1ui != NULL && glad_glUniform1ui != glad_trace_glUniform1ui) { glad_trace_next_glUniform1ui = glad_glUniform1ui; glad_glUniform1ui = glad_trace_glUniform1ui; }
+	if(glad_glUniform2ui != NULL && glad_glUniform2ui != glad_trace_glUniform2ui) { glad_trace_next_glUniform2ui = glad_glUniform2ui; glad_glUniform2ui = glad_trace_glUniform2ui; }
+	if(glad_glUniform3ui != NULL && glad_glUniform3ui != glad_trace_glUniform3ui) { glad_trace_next_glUniform3ui = glad_glUniform3ui; glad_glUniform3ui = glad_trace_glUniform3ui; }
+	if(glad_glUniform4ui != NULL && glad_glUniform4ui != glad_trace_glUniform4ui) { glad_trace_next_glUniform4ui = glad_glUniform4ui; glad_glUniform4ui = glad_trace_glUniform4ui; }
+	if(glad_glUniform1uiv != NULL && glad_glUniform1uiv != glad_trace_glUniform1uiv) { glad_trace_next_glUniform1uiv = glad_glUniform1uiv; glad_glUniform1uiv = glad_trace_glUniform1uiv; }
+	if(glad_glUniform2uiv != NULL && glad_glUniform2uiv != glad_trace_glUniform2uiv) { glad_trace_next_glUniform2uiv = glad_glUniform2uiv; glad_glUniform2uiv = glad_trace_glUniform2uiv; }
+	if(glad_glUniform3uiv != NULL && glad_glUniform3uiv != glad_trace_glUniform3uiv) { glad_trace_next_glUniform3uiv = glad_glUniform3uiv; glad_glUniform3uiv = glad_trace_glUniform3uiv; }
+	if(glad_glUniform4uiv != NULL && glad_glUniform4uiv != glad_trace_glUniform4uiv) { glad_trace_next_glUniform4uiv = glad_glUniform4uiv; glad_glUniform4uiv = glad_trace_glUniform4uiv; }
+	if(glad_glTexParameterIiv != NULL && glad_glTexParameterIiv != glad_trace_glTexParameterIiv) { glad_trace_next_glTexParameterIiv = glad_glTexParameterIiv; glad_glTexParameterIiv = glad_trace_glTexParameterIiv; }
+	if(glad_glTexParameterIuiv != NULL && glad_glTexParameterIuiv != glad_trace_glTexParameterIuiv) { glad_trace_next_glTexParameterIuiv = glad_glTexParameterIuiv; glad_glTexParameterIuiv = glad_trace_glTexParameterIuiv; }
+	if(glad_glGetTexParameterIiv != NULL && glad_glGetTexParameterIiv != glad_trace_glGetTexParameterIiv) { glad_trace_next_glGetTexParameterIiv = glad_glGetTexParameterIiv; glad_glGetTexParameterIiv = glad_trace_glGetTexParameterIiv; }
+	if(glad_glGetTexParameterIuiv != NULL && glad_glGetTexParameterIuiv != glad_trace_glGetTexParameterIuiv) { glad_trace_next_glGetTexParameterIuiv = glad_glGetTexParameterIuiv; glad_glGetTexParameterIuiv = glad_trace_glGetTexParameterIuiv; }
+	if(glad_glClearBufferiv != NULL && glad_glClearBufferiv != glad_trace_glClearBufferiv) { glad_trace_next_glClearBufferiv = glad_glClearBufferiv; glad_glClearBufferiv = glad_trace_glClearBufferiv; }
+	if(glad_glClearBufferuiv != NULL && glad_glClearBufferuiv != glad_trace_glClearBufferuiv) { glad_trace_next_glClearBufferuiv = glad_glClearBufferuiv; glad_glClearBufferuiv = glad_trace_glClearBufferuiv; }
+	if(glad_glClearBufferfv != NULL && glad_glClearBufferfv != glad_trace_glClearBufferfv) { glad_trace_next_glClearBufferfv = glad_glClearBufferfv; glad_glClearBufferfv = glad_trace_glClearBufferfv; }
+	if(glad_glClearBufferfi != NULL && glad_glClearBufferfi != glad_trace_glClearBufferfi) { glad_trace_next_glClearBufferfi = glad_glClearBufferfi; glad_glClearBufferfi = glad_trace_glClearBufferfi; }
+	if(glad_glGetStringi != NULL && glad_glGetStringi != glad_trace_glGetStringi) { glad_trace_next_glGetStringi = glad_glGetStringi; glad_glGetStringi = glad_trace_glGetStringi; }
+	if(glad_glIsRenderbuffer != NULL && glad_glIsRenderbuffer != glad_trace_glIsRenderbuffer) { glad_trace_next_glIsRenderbuffer = glad_glIsRenderbuffer; glad_glIsRenderbuffer = glad_trace_glIsRenderbuffer; }
+	if(glad_glBindRenderbuffer != NULL && glad_glBindRenderbuffer != glad_trace_glBindRenderbuffer) { glad_trace_next_glBindRenderbuffer = glad_glBindRenderbuffer; glad_glBindRenderbuffer = glad_trace_glBindRenderbuffer; }
+	if(glad_glDeleteRenderbuffers != NULL && glad_glDeleteRenderbuffers != glad_trace_glDeleteRenderbuffers) { glad_trace_next_glDeleteRenderbuffers = glad_glDeleteRenderbuffers; glad_glDeleteRenderbuffers = glad_trace_glDeleteRenderbuffers; }
+	if(glad_glGenRenderbuffers != NULL && glad_glGenRenderbuffers != glad_trace_glGenRenderbuffers) { glad_trace_next_glGenRenderbuffers = glad_glGenRenderbuffers; glad_glGenRenderbuffers = glad_trace_glGenRenderbuffers; }
+	if(glad_glRenderbufferStorage != NULL && glad_glRenderbufferStorage != glad_trace_glRenderbufferStorage) { glad_trace_next_glRenderbufferStorage = glad_glRenderbufferStorage; glad_glRenderbufferStorage = glad_trace_glRenderbufferStorage; }
+	if(glad_glGetRenderbufferParameteriv != NULL && glad_glGetRenderbufferParameteriv != glad_trace_glGetRenderbufferParameteriv) { glad_trace_next_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv; glad_glGetRenderbufferParameteriv = glad_trace_glGetRenderbufferParameteriv; }
+	if(glad_glIsFramebuffer != NULL && glad_glIsFramebuffer != glad_trace_glIsFramebuffer) { glad_trace_next_glIsFramebuffer = glad_glIsFramebuffer; glad_glIsFramebuffer = glad_trace_glIsFramebuffer; }
+	if(glad_glBindFramebuffer != NULL && glad_glBindFramebuffer != glad_trace_glBindFramebuffer) { glad_trace_next_glBindFramebuffer = glad_glBindFramebuffer; glad_glBindFramebuffer = glad_trace_glBindFramebuffer; }
+	if(glad_glDeleteFramebuffers != NULL && glad_glDeleteFramebuffers != glad_trace_glDeleteFramebuffers) { glad_trace_next_glDeleteFramebuffers = glad_glDeleteFramebuffers; glad_glDeleteFramebuffers = glad_trace_glDeleteFramebuffers; }
+	if(glad_glGenFramebuffers != NULL && glad_glGenFramebuffers != glad_trace_glGenFramebuffers) { glad_trace_next_glGenFramebuffers = glad_glGenFramebuffers; glad_glGenFramebuffers = glad_trace_glGenFramebuffers; }
+	if(glad_glCheckFramebufferStatus != NULL && glad_glCheckFramebufferStatus != glad_trace_glCheckFramebufferStatus) { glad_trace_next_glCheckFramebufferStatus = glad_glCheckFramebufferStatus; glad_glCheckFramebufferStatus = glad_trace_glCheckFramebufferStatus; }
+	if(glad_glFramebufferTexture1D != NULL && glad_glFramebufferTexture1D != glad_trace_glFramebufferTexture1D) { glad_trace_next_glFramebufferTexture1D = glad_glFramebufferTexture1D; glad_glFramebufferTexture1D = glad_trace_glFramebufferTexture1D; }
+	if(glad_glFramebufferTexture2D != NULL && glad_glFramebufferTexture2D != glad_trace_glFramebufferTexture2D) { glad_trace_next_glFramebufferTexture2D = glad_glFramebufferTexture2D; glad_glFramebufferTexture2D = glad_trace_glFramebufferTexture2D; }
+	if(glad_glFramebufferTexture3D != NULL && glad_glFramebufferTexture3D != glad_trace_glFramebufferTexture3D) { glad_trace_next_glFramebufferTexture3D = glad_glFramebufferTexture3D; glad_glFramebufferTexture3D = glad_trace_glFramebufferTexture3D; }
+	if(glad_glFramebufferRenderbuffer != NULL && glad_glFramebufferRenderbuffer != glad_trace_glFramebufferRenderbuffer) { glad_trace_next_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer; glad_glFramebufferRenderbuffer = glad_trace_glFramebufferRenderbuffer; }
+	if(glad_glGetFramebufferAttachmentParameteriv != NULL && glad_glGetFramebufferAttachmentParameteriv != glad_trace_glGetFramebufferAttachmentParameteriv) { glad_trace_next_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv; glad_glGetFramebufferAttachmentParameteriv = glad_trace_glGetFramebufferAttachmentParameteriv; }
+	if(glad_glGenerateMipmap != NULL && glad_glGenerateMipmap != glad_trace_glGenerateMipmap) { glad_trace_next_glGenerateMipmap = glad_glGenerateMipmap; glad_glGenerateMipmap = glad_trace_glGenerateMipmap; }
+	if(glad_glBlitFramebuffer != NULL && glad_glBlitFramebuffer != glad_trace_glBlitFramebuffer) { glad_trace_next_glBlitFramebuffer = glad_glBlitFramebuffer; glad_glBlitFramebuffer = glad_trace_glBlitFramebuffer; }
+	if(glad_glRenderbufferStorageMultisample != NULL && glad_glRenderbufferStorageMultisample != glad_trace_glRenderbufferStorageMultisample) { glad_trace_next_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample; glad_glRenderbufferStorageMultisample = glad_trace_glRenderbufferStorageMultisample; }
+	if(glad_glFramebufferTextureLayer != NULL && glad_glFramebufferTextureLayer != glad_trace_glFramebufferTextureLayer) { glad_trace_next_glFramebufferTextureLayer = glad_glFramebufferTextureLayer; glad_glFramebufferTextureLayer = glad_trace_glFramebufferTextureLayer; }
+	if(glad_glMapBufferRange != NULL && glad_glMapBufferRange != glad_trace_glMapBufferRange) { glad_trace_next_glMapBufferRange = glad_glMapBufferRange; glad_glMapBufferRange = glad_trace_glMapBufferRange; }
+	if(glad_glFlushMappedBufferRange != NULL && glad_glFlushMappedBufferRange != glad_trace_glFlushMappedBufferRange) { glad_trace_next_glFlushMappedBufferRange = glad_glFlushMappedBufferRange; glad_glFlushMappedBufferRange = glad_trace_glFlushMappedBufferRange; }
+	if(glad_glBindVertexArray != NULL && glad_glBindVertexArray != glad_trace_glBindVertexArray) { glad_trace_next_glBindVertexArray = glad_glBindVertexArray; glad_glBindVertexArray = glad_trace_glBindVertexArray; }
+	if(glad_glDeleteVertexArrays != NULL && glad_glDeleteVertexArrays != glad_trace_glDeleteVertexArrays) { glad_trace_next_glDeleteVertexArrays = glad_glDeleteVertexArrays; glad_glDeleteVertexArrays = glad_trace_glDeleteVertexArrays; }
+	if(glad_glGenVertexArrays != NULL && glad_glGenVertexArrays != glad_trace_glGenVertexArrays) { glad_trace_next_glGenVertexArrays = glad_glGenVertexArrays; glad_glGenVertexArrays = glad_trace_glGenVertexArrays; }
+	if(glad_glIsVertexArray != NULL && glad_glIsVertexArray != glad_trace_glIsVertexArray) { glad_trace_next_glIsVertexArray = glad_glIsVertexArray; glad_glIsVertexArray = glad_trace_glIsVertexArray; }
+	if(glad_glDrawArraysInstanced != NULL && glad_glDrawArraysInstanced != glad_trace_glDrawArraysInstanced) { glad_trace_next_glDrawArraysInstanced = glad_glDrawArraysInstanced; glad_glDrawArraysInstanced = glad_trace_glDrawArraysInstanced; }
+	if(glad_glDrawElementsInstanced != NULL && glad_glDrawElementsInstanced != glad_trace_glDrawElementsInstanced) { glad_trace_next_glDrawElementsInstanced = glad_glDrawElementsInstanced; glad_glDrawElementsInstanced = glad_trace_glDrawElementsInstanced; }
+	if(glad_glTexBuffer != NULL && glad_glTexBuffer != glad_trace_glTexBuffer) { glad_trace_next_glTexBuffer = glad_glTexBuffer; glad_glTexBuffer = glad_trace_glTexBuffer; }
+	if(glad_glPrimitiveRestartIndex != NULL && glad_glPrimitiveRestartIndex != glad_trace_glPrimitiveRestartIndex) { glad_trace_next_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex; glad_glPrimitiveRestartIndex = glad_trace_glPrimitiveRestartIndex; }
+	if(glad_glCopyBufferSubData != NULL && glad_glCopyBufferSubData != glad_trace_glCopyBufferSubData) { glad_trace_next_glCopyBufferSubData = glad_glCopyBufferSubData; glad_glCopyBufferSubData = glad_trace_glCopyBufferSubData; }
+	if(glad_glGetUniformIndices != NULL && glad_glGetUniformIndices != glad_trace_glGetUniformIndices) { glad_trace_next_glGetUniformIndices = glad_glGetUniformIndices; glad_glGetUniformIndices = glad_trace_glGetUniformIndices; }
+	if(glad_glGetActiveUniformsiv != NULL && glad_glGetActiveUniformsiv != glad_trace_glGetActiveUniformsiv) { glad_trace_next_glGetActiveUniformsiv = glad_glGetActiveUniformsiv; glad_glGetActiveUniformsiv = glad_trace_glGetActiveUniformsiv; }
+	if(glad_glGetActiveUniformName != NULL && glad_glGetActiveUniformName != glad_trace_glGetActiveUniformName) { glad_trace_next_glGetActiveUniformName = glad_glGetActiveUniformName; glad_glGetActiveUniformName = glad_trace_glGetActiveUniformName; }
+	if(glad_glGetUniformBlockIndex != NULL && glad_glGetUniformBlockIndex != glad_trace_glGetUniformBlockIndex) { glad_trace_next_glGetUniformBlockIndex = glad_glGetUniformBlockIndex; glad_glGetUniformBlockIndex = glad_trace_glGetUniformBlockIndex; }
+	if(glad_glGetActiveUniformBlockiv != NULL && glad_glGetActiveUniformBlockiv != glad_trace_glGetActiveUniformBlockiv) { glad_trace_next_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv; glad_glGetActiveUniformBlockiv = glad_trace_glGetActiveUniformBlockiv; }
+	if(glad_glGetActiveUniformBlockName != NULL && glad_glGetActiveUniformBlockName != glad_trace_glGetActiveUniformBlockName) { glad_trace_next_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName; glad_glGetActiveUniformBlockName = glad_trace_glGetActiveUniformBlockName; }
+	if(glad_glUniformBlockBinding != NULL && glad_glUniformBlockBinding != glad_trace_glUniformBlockBinding) { glad_trace_next_glUniformBlockBinding = glad_glUniformBlockBinding; glad_glUniformBlockBinding = glad_trace_glUniformBlockBinding; }
+	if(glad_glDrawElementsBaseVertex != NULL && glad_glDrawElementsBaseVertex != glad_trace_glDrawElementsBaseVertex) { glad_trace_next_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex; glad_glDrawElementsBaseVertex = glad_trace_glDrawElementsBaseVertex; }
+	if(glad_glDrawRangeElementsBaseVertex != NULL && glad_glDrawRangeElementsBaseVertex != glad_trace_glDrawRangeElementsBaseVertex) { glad_trace_next_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex; glad_glDrawRangeElementsBaseVertex = glad_trace_glDrawRangeElementsBaseVertex; }
+	if(glad_glDrawElementsInstancedBaseVertex != NULL && glad_glDrawElementsInstancedBaseVertex != glad_trace_glDrawElementsInstancedBaseVertex) { glad_trace_next_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex; glad_glDrawElementsInstancedBaseVertex = glad_trace_glDrawElementsInstancedBaseVertex; }
+	if(glad_glMultiDrawElementsBaseVertex != NULL && glad_glMultiDrawElementsBaseVertex != glad_trace_glMultiDrawElementsBaseVertex) { glad_trace_next_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex; glad_glMultiDrawElementsBaseVertex = glad_trace_glMultiDrawElementsBaseVertex; }
+	if(glad_glProvokingVertex != NULL && glad_glProvokingVertex != glad_trace_glProvokingVertex) { glad_trace_next_glProvokingVertex = glad_glProvokingVertex; glad_glProvokingVertex = glad_trace_glProvokingVertex; }
+	if(glad_glFenceSync != NULL && glad_glFenceSync != glad_trace_glFenceSync) { glad_trace_next_glFenceSync = glad_glFenceSync; glad_glFenceSync = glad_trace_glFenceSync; }
+	if(glad_glIsSync != NULL && glad_glIsSync != glad_trace_glIsSync) { glad_trace_next_glIsSync = glad_glIsSync; glad_glIsSync = glad_trace_glIsSync; }
+	if(glad_glDeleteSync != NULL && glad_glDeleteSync != glad_trace_glDeleteSync) { glad_trace_next_glDeleteSync = glad_glDeleteSync; glad_glDeleteSync = glad_trace_glDeleteSync; }
+	if(glad_glClientWaitSync != NULL && glad_glClientWaitSync != glad_trace_glClientWaitSync) { glad_trace_next_glClientWaitSync = glad_glClientWaitSync; glad_glClientWaitSync = glad_trace_glClientWaitSync; }
+	if(glad_glWaitSync != NULL && glad_glWaitSync != glad_trace_glWaitSync) { glad_trace_next_glWaitSync = glad_glWaitSync; glad_glWaitSync = glad_trace_glWaitSync; }
+	if(glad_glGetInteger64v != NULL && glad_glGetInteger64v != glad_trace_glGetInteger64v) { glad_trace_next_glGetInteger64v = glad_glGetInteger64v; glad_glGetInteger64v = glad_trace_glGetInteger64v; }
+	if(glad_glGetSynciv != NULL && glad_glGetSynciv != glad_trace_glGetSynciv) { glad_trace_next_glGetSynciv = glad_glGetSynciv; glad_glGetSynciv = glad_trace_glGetSynciv; }
+	if(glad_glGetInteger64i_v != NULL && glad_glGetInteger64i_v != glad_trace_glGetInteger64i_v) { glad_trace_next_glGetInteger64i_v = glad_glGetInteger64i_v; glad_glGetInteger64i_v = glad_trace_glGetInteger64i_v; }
+	if(glad_glGetBufferParameteri64v != NULL && glad_glGetBufferParameteri64v != glad_trace_glGetBufferParameteri64v) { glad_trace_next_glGetBufferParameteri64v = glad_glGetBufferParameteri64v; glad_glGetBufferParameteri64v = glad_trace_glGetBufferParameteri64v; }
+	if(glad_glFramebufferTexture != NULL && glad_glFramebufferTexture != glad_trace_glFramebufferTexture) { glad_trace_next_glFramebufferTexture = glad_glFramebufferTexture; glad_glFramebufferTexture = glad_trace_glFramebufferTexture; }
+	if(glad_glTexImage2DMultisample != NULL && glad_glTexImage2DMultisample != glad_trace_glTexImage2DMultisample) { glad_trace_next_glTexImage2DMultisample = glad_glTexImage2DMultisample; glad_glTexImage2DMultisample = glad_trace_glTexImage2DMultisample; }
+	if(glad_glTexImage3DMultisample != NULL && glad_glTexImage3DMultisample != glad_trace_glTexImage3DMultisample) { glad_trace_next_glTexImage3DMultisample = glad_glTexImage3DMultisample; glad_glTexImage3DMultisample = glad_trace_glTexImage3DMultisample; }
+	if(glad_glGetMultisamplefv != NULL && glad_glGetMultisamplefv != glad_trace_glGetMultisamplefv) { glad_trace_next_glGetMultisamplefv = glad_glGetMultisamplefv; glad_glGetMultisamplefv = glad_trace_glGetMultisamplefv; }
+	if(glad_glSampleMaski != NULL && glad_glSampleMaski != glad_trace_glSampleMaski) { glad_trace_next_glSampleMaski = glad_glSampleMaski; glad_glSampleMaski = glad_trace_glSampleMaski; }
+	if(glad_glBindFragDataLocationIndexed != NULL && glad_glBindFragDataLocationIndexed != glad_trace_glBindFragDataLocationIndexed) { glad_trace_next_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed; glad_glBindFragDataLocationIndexed = glad_trace_glBindFragDataLocationIndexed; }
+	if(glad_glGetFragDataIndex != NULL && glad_glGetFragDataIndex != glad_trace_glGetFragDataIndex) { glad_trace_next_glGetFragDataIndex = glad_glGetFragDataIndex; glad_glGetFragDataIndex = glad_trace_glGetFragDataIndex; }
+	if(glad_glGenSamplers != NULL && glad_glGenSamplers != glad_trace_glGenSamplers) { glad_trace_next_glGenSamplers = glad_glGenSamplers; glad_glGenSamplers = glad_trace_glGenSamplers; }
+	if(glad_glDeleteSamplers != NULL && glad_glDeleteSamplers != glad_trace_glDeleteSamplers) { glad_trace_next_glDeleteSamplers = glad_glDeleteSamplers; glad_glDeleteSamplers = glad_trace_glDeleteSamplers; }
+	if(glad_glIsSampler != NULL && glad_glIsSampler != glad_trace_glIsSampler) { glad_trace_next_glIsSampler = glad_glIsSampler; glad_glIsSampler = glad_trace_glIsSampler; }
+	if(glad_glBindSampler != NULL && glad_glBindSampler != glad_trace_glBindSampler) { glad_trace_next_glBindSampler = glad_glBindSampler; glad_glBindSampler = glad_trace_glBindSampler; }
+	if(glad_glSamplerParameteri != NULL && glad_glSamplerParameteri != glad_trace_glSamplerParameteri) { glad_trace_next_glSamplerParameteri = glad_glSamplerParameteri; glad_glSamplerParameteri = glad_trace_glSamplerParameteri; }
+	if(glad_glSamplerParameteriv != NULL && glad_glSamplerParameteriv != glad_trace_glSamplerParameteriv) { glad_trace_next_glSamplerParameteriv = glad_glSamplerParameteriv; glad_glSamplerParameteriv = glad_trace_glSamplerParameteriv; }
+	if(glad_glSamplerParameterf != NULL && glad_glSamplerParameterf != glad_trace_glSamplerParameterf) { glad_trace_next_glSamplerParameterf = glad_glSamplerParameterf; glad_glSamplerParameterf = glad_trace_glSamplerParameterf; }
+	if(glad_glSamplerParameterfv != NULL && glad_glSamplerParameterfv != glad_trace_glSamplerParameterfv) { glad_trace_next_glSamplerParameterfv = glad_glSamplerParameterfv; glad_glSamplerParameterfv = glad_trace_glSamplerParameterfv; }
+	if(glad_glSamplerParameterIiv != NULL && glad_glSamplerParameterIiv != glad_trace_glSamplerParameterIiv) { glad_trace_next_glSamplerParameterIiv = glad_glSamplerParameterIiv; glad_glSamplerParameterIiv = glad_trace_glSamplerParameterIiv; }
+	if(glad_glSamplerParameterIuiv != NULL && glad_glSamplerParameterIuiv != glad_trace_glSamplerParameterIuiv) { glad_trace_next_glSamplerParameterIuiv = glad_glSamplerParameterIuiv; glad_glSamplerParameterIuiv = glad_trace_glSamplerParameterIuiv; }
+	if(glad_glGetSamplerParameteriv != NULL && glad_glGetSamplerParameteriv != glad_trace_glGetSamplerParameteriv) { glad_trace_next_glGetSamplerParameteriv = glad_glGetSamplerParameteriv; glad_glGetSamplerParameteriv = glad_trace_glGetSamplerParameteriv; }
+	if(glad_glGetSamplerParameterIiv != NULL && glad_glGetSamplerParameterIiv != glad_trace_glGetSamplerParameterIiv) { glad_trace_next_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv; glad_glGetSamplerParameterIiv = glad_trace_glGetSamplerParameterIiv; }
+	if(glad_glGetSamplerParameterfv != NULL && glad_glGetSamplerParameterfv != glad_trace_glGetSamplerParameterfv) { glad_trace_next_glGetSamplerParameterfv = glad_glGetSamplerParameterfv; glad_glGetSamplerParameterfv = glad_trace_glGetSamplerParameterfv; }
+	if(glad_glGetSamplerParameterIuiv != NULL && glad_glGetSamplerParameterIuiv != glad_trace_glGetSamplerParameterIuiv) { glad_trace_next_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv; glad_glGetSamplerParameterIuiv = glad_trace_glGetSamplerParameterIuiv; }
+	if(glad_glQueryCounter != NULL && glad_glQueryCounter != glad_trace_glQueryCounter) { glad_trace_next_glQueryCounter = glad_glQueryCounter; glad_glQueryCounter = glad_trace_glQueryCounter; }
+	if(glad_glGetQueryObjecti64v != NULL && glad_glGetQueryObjecti64v != glad_trace_glGetQueryObjecti64v) { glad_trace_next_glGetQueryObjecti64v = glad_glGetQueryObjecti64v; glad_glGetQueryObjecti64v = glad_trace_glGetQueryObjecti64v; }
+	if(glad_glGetQueryObjectui64v != NULL && glad_glGetQueryObjectui64v != glad_trace_glGetQueryObjectui64v) { glad_trace_next_glGetQueryObjectui64v = glad_glGetQueryObjectui64v; glad_glGetQueryObjectui64v = glad_trace_glGetQueryObjectui64v; }
+	if(glad_glVertexAttribDivisor != NULL && glad_glVertexAttribDivisor != glad_trace_glVertexAttribDivisor) { glad_trace_next_glVertexAttribDivisor = glad_glVertexAttribDivisor; glad_glVertexAttribDivisor = glad_trace_glVertexAttribDivisor; }
+	if(glad_glVertexAttribP1ui != NULL && glad_glVertexAttribP1ui != glad_trace_glVertexAttribP1ui) { glad_trace_next_glVertexAttribP1ui = glad_glVertexAttribP1ui; glad_glVertexAttribP1ui = glad_trace_glVertexAttribP1ui; }
+	if(glad_glVertexAttribP1uiv != NULL && glad_glVertexAttribP1uiv != glad_trace_glVertexAttribP1uiv) { glad_trace_next_glVertexAttribP1uiv = glad_glVertexAttribP1uiv; glad_glVertexAttribP1uiv = glad_trace_glVertexAttribP1uiv; }
+	if(glad_glVertexAttribP2ui != NULL && glad_glVertexAttribP2ui != glad_trace_glVertexAttribP2ui) { glad_trace_next_glVertexAttribP2ui = glad_glVertexAttribP2ui; glad_glVertexAttribP2ui = glad_trace_glVertexAttribP2ui; }
+	if(glad_glVertexAttribP2uiv != NULL && glad_glVertexAttribP2uiv != glad_trace_glVertexAttribP2uiv) { glad_trace_next_glVertexAttribP2uiv = glad_glVertexAttribP2uiv; glad_glVertexAttribP2uiv = glad_trace_glVertexAttribP2uiv; }
+	if(glad_glVertexAttribP3ui != NULL && glad_glVertexAttribP3ui != glad_trace_glVertexAttribP3ui) { glad_trace_next_glVertexAttribP3ui = glad_glVertexAttribP3ui; glad_glVertexAttribP3ui = glad_trace_glVertexAttribP3ui; }
+	if(glad_glVertexAttribP3uiv != NULL && glad_glVertexAttribP3uiv != glad_trace_glVertexAttribP3uiv) { glad_trace_next_glVertexAttribP3uiv = glad_glVertexAttribP3uiv; glad_glVertexAttribP3uiv = glad_trace_glVertexAttribP3uiv; }
+	if(glad_glVertexAttribP4ui != NULL && glad_glVertexAttribP4ui != glad_trace_glVertexAttribP4ui) { glad_trace_next_glVertexAttribP4ui = glad_glVertexAttribP4ui; glad_glVertexAttribP4ui = glad_trace_glVertexAttribP4ui; }
+	if(glad_glVertexAttribP4uiv != NULL && glad_glVertexAttribP4uiv != glad_trace_glVertexAttribP4uiv) { glad_trace_next_glVertexAttribP4uiv = glad_glVertexAttribP4uiv; glad_glVertexAttribP4uiv = glad_trace_glVertexAttribP4uiv; }
+	if(glad_glVertexP2ui != NULL && glad_glVertexP2ui != glad_trace_glVertexP2ui) { glad_trace_next_glVertexP2ui = glad_glVertexP2ui; glad_glVertexP2ui = glad_trace_glVertexP2ui; }
+	if(glad_glVertexP2uiv != NULL && glad_glVertexP2uiv != glad_trace_glVertexP2uiv) { glad_trace_next_glVertexP2uiv = glad_glVertexP2uiv; glad_glVertexP2uiv = glad_trace_glVertexP2uiv; }
+	if(glad_glVertexP3ui != NULL && glad_glVertexP3ui != glad_trace_glVertexP3ui) { glad_trace_next_glVertexP3ui = glad_glVertexP3ui; glad_glVertexP3ui = glad_trace_glVertexP3ui; }
+	if(glad_glVertexP3uiv != NULL && glad_glVertexP3uiv != glad_trace_glVertexP3uiv) { glad_trace_next_glVertexP3uiv = glad_glVertexP3uiv; glad_glVertexP3uiv = glad_trace_glVertexP3uiv; }
+	if(glad_glVertexP4ui != NULL && glad_glVertexP4ui != glad_trace_glVertexP4ui) { glad_trace_next_glVertexP4ui = glad_glVertexP4ui; glad_glVertexP4ui = glad_trace_glVertexP4ui; }
+	if(glad_glVertexP4uiv != NULL && glad_glVertexP4uiv != glad_trace_glVertexP4uiv) { glad_trace_next_glVertexP4uiv = glad_glVertexP4uiv; glad_glVertexP4uiv = glad_trace_glVertexP4uiv; }
+	if(glad_glTexCoordP1ui != NULL && glad_glTexCoordP1ui != glad_trace_glTexCoordP1ui) { glad_trace_next_glTexCoordP1ui = glad_glTexCoordP1ui; glad_glTexCoordP1ui = glad_trace_glTexCoordP1ui; }
+	if(glad_glTexCoordP1uiv != NULL && glad_glTexCoordP1uiv != glad_trace_glTexCoordP1uiv) { glad_trace_next_glTexCoordP1uiv = glad_glTexCoordP1uiv; glad_glTexCoordP1uiv = glad_trace_glTexCoordP1uiv; }
+	if(glad_glTexCoordP2ui != NULL && glad_glTexCoordP2ui != glad_trace_glTexCoordP2ui) { glad_trace_next_glTexCoordP2ui = glad_glTexCoordP2ui; glad_glTexCoordP2ui = glad_trace_glTexCoordP2ui; }
+	if(glad_glTexCoordP2uiv != NULL && glad_glTexCoordP2uiv != glad_trace_glTexCoordP2uiv) { glad_trace_next_glTexCoordP2uiv = glad_glTexCoordP2uiv; glad_glTexCoordP2uiv = glad_trace_glTexCoordP2uiv; }
+	if(glad_glTexCoordP3ui != NULL && glad_glTexCoordP3ui != glad_trace_glTexCoordP3ui) { glad_trace_next_glTexCoordP3ui = glad_glTexCoordP3ui; glad_glTexCoordP3ui = glad_trace_glTexCoordP3ui; }
+	if(glad_glTexCoordP3uiv != NULL && glad_glTexCoordP3uiv != glad_trace_glTexCoordP3uiv) { glad_trace_next_glTexCoordP3uiv = glad_glTexCoordP3uiv; glad_glTexCoordP3uiv = glad_trace_glTexCoordP3uiv; }
+	if(glad_glTexCoordP4ui != NULL && glad_glTexCoordP4ui != glad_trace_glTexCoordP4ui) { glad_trace_next_glTexCoordP4ui = glad_glTexCoordP4ui; glad_glTexCoordP4ui = glad_trace_glTexCoordP4ui; }
+	if(glad_glTexCoordP4uiv != NULL && glad_glTexCoordP4uiv != glad_trace_glTexCoordP4uiv) { glad_trace_next_glTexCoordP4uiv = glad_glTexCoordP4uiv; glad_glTexCoordP4uiv = glad_trace_glTexCoordP4uiv; }
+	if(glad_glMultiTexCoordP1ui != NULL && glad_glMultiTexCoordP1ui != glad_trace_glMultiTexCoordP1ui) { glad_trace_next_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui; glad_glMultiTexCoordP1ui = glad_trace_glMultiTexCoordP1ui; }
+	if(glad_glMultiTexCoordP1uiv != NULL && glad_glMultiTexCoordP1uiv != glad_trace_glMultiTexCoordP1uiv) { glad_trace_next_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv; glad_glMultiTexCoordP1uiv = glad_trace_glMultiTexCoordP1uiv; }
+	if(glad_glMultiTexCoordP2ui != NULL && glad_glMultiTexCoordP2ui != glad_trace_glMultiTexCoordP2ui) { glad_trace_next_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui; glad_glMultiTexCoordP2ui = glad_trace_glMultiTexCoordP2ui; }
+	if(glad_glMultiTexCoordP2uiv != NULL && glad_glMultiTexCoordP2uiv != glad_trace_glMultiTexCoordP2uiv) { glad_trace_next_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv; glad_glMultiTexCoordP2uiv = glad_trace_glMultiTexCoordP2uiv; }
+	if(glad_glMultiTexCoordP3ui != NULL && glad_glMultiTexCoordP3ui != glad_trace_glMultiTexCoordP3ui) { glad_trace_next_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui; glad_glMultiTexCoordP3ui = glad_trace_glMultiTexCoordP3ui; }
+	if(glad_glMultiTexCoordP3uiv != NULL && glad_glMultiTexCoordP3uiv != glad_trace_glMultiTexCoordP3uiv) { glad_trace_next_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv; glad_glMultiTexCoordP3uiv = glad_trace_glMultiTexCoordP3uiv; }
+	if(glad_glMultiTexCoordP4ui != NULL && glad_glMultiTexCoordP4ui != glad_trace_glMultiTexCoordP4ui) { glad_trace_next_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui; glad_glMultiTexCoordP4ui = glad_trace_glMultiTexCoordP4ui; }
+	if(glad_glMultiTexCoordP4uiv != NULL && glad_glMultiTexCoordP4uiv != glad_trace_glMultiTexCoordP4uiv) { glad_trace_next_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv; glad_glMultiTexCoordP4uiv = glad_trace_glMultiTexCoordP4uiv; }
+	if(glad_glNormalP3ui != NULL && glad_glNormalP3ui != glad_trace_glNormalP3ui) { glad_trace_next_glNormalP3ui = glad_glNormalP3ui; glad_glNormalP3ui = glad_trace_glNormalP3ui; }
+	if(glad_glNormalP3uiv != NULL && glad_glNormalP3uiv != glad_trace_glNormalP3uiv) { glad_trace_next_glNormalP3uiv = glad_glNormalP3uiv; glad_glNormalP3uiv = glad_trace_glNormalP3uiv; }
+	if(glad_glColorP3ui != NULL && glad_glColorP3ui != glad_trace_glColorP3ui) { glad_trace_next_glColorP3ui = glad_glColorP3ui; glad_glColorP3ui = glad_trace_glColorP3ui; }
+	if(glad_glColorP3uiv != NULL && glad_glColorP3uiv != glad_trace_glColorP3uiv) { glad_trace_next_glColorP3uiv = glad_glColorP3uiv; glad_glColorP3uiv = glad_trace_glColorP3uiv; }
+	if(glad_glColorP4ui != NULL && glad_glColorP4ui != glad_trace_glColorP4ui) { glad_trace_next_glColorP4ui = glad_glColorP4ui; glad_glColorP4ui = glad_trace_glColorP4ui; }
+	if(glad_glColorP4uiv != NULL && glad_glColorP4uiv != glad_trace_glColorP4uiv) { glad_trace_next_glColorP4uiv = glad_glColorP4uiv; glad_glColorP4uiv = glad_trace_glColorP4uiv; }
+	if(glad_glSecondaryColorP3ui != NULL && glad_glSecondaryColorP3ui != glad_trace_glSecondaryColorP3ui) { glad_trace_next_glSecondaryColorP3ui = glad_glSecondaryColorP3ui; glad_glSecondaryColorP3ui = glad_trace_glSecondaryColorP3ui; }
+	if(glad_glSecondaryColorP3uiv != NULL && glad_glSecondaryColorP3uiv != glad_trace_glSecondaryColorP3uiv) { glad_trace_next_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv; glad_glSecondaryColorP3uiv = glad_trace_glSecondaryColorP3uiv; }
+	if(glad_glBufferStorage != NULL && glad_glBufferStorage != glad_trace_glBufferStorage) { glad_trace_next_glBufferStorage = glad_glBufferStorage; glad_glBufferStorage = glad_trace_glBufferStorage; }
+	if(glad_glDrawArraysIndirect != NULL && glad_glDrawArraysIndirect != glad_trace_glDrawArraysIndirect) { glad_trace_next_glDrawArraysIndirect = glad_glDrawArraysIndirect; glad_glDrawArraysIndirect = glad_trace_glDrawArraysIndirect; }
+	if(glad_glDrawElementsIndirect != NULL && glad_glDrawElementsIndirect != glad_trace_glDrawElementsIndirect) { glad_trace_next_glDrawElementsIndirect = glad_glDrawElementsIndirect; glad_glDrawElementsIndirect = glad_trace_glDrawElementsIndirect; }
+	if(glad_glGetProgramBinary != NULL && glad_glGetProgramBinary != glad_trace_glGetProgramBinary) { glad_trace_next_glGetProgramBinary = glad_glGetProgramBinary; glad_glGetProgramBinary = glad_trace_glGetProgramBinary; }
+	if(glad_glProgramBinary != NULL && glad_glProgramBinary != glad_trace_glProgramBinary) { glad_trace_next_glProgramBinary = glad_glProgramBinary; glad_glProgramBinary = glad_trace_glProgramBinary; }
+	if(glad_glProgramParameteri != NULL && glad_glProgramParameteri != glad_trace_glProgramParameteri) { glad_trace_next_glProgramParameteri = glad_glProgramParameteri; glad_glProgramParameteri = glad_trace_glProgramParameteri; }
+	if(glad_glMultiDrawArraysIndirect != NULL && glad_glMultiDrawArraysIndirect != glad_trace_glMultiDrawArraysIndirect) { glad_trace_next_glMultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect; glad_glMultiDrawArraysIndirect = glad_trace_glMultiDrawArraysIndirect; }
+	if(glad_glMultiDrawElementsIndirect != NULL && glad_glMultiDrawElementsIndirect != glad_trace_glMultiDrawElementsIndirect) { glad_trace_next_glMultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect; glad_glMultiDrawElementsIndirect = glad_trace_glMultiDrawElementsIndirect; }
+	if(glad_glDebugMessageControl != NULL && glad_glDebugMessageControl != glad_trace_glDebugMessageControl) { glad_trace_next_glDebugMessageControl = glad_glDebugMessageControl; glad_glDebugMessageControl = glad_trace_glDebugMessageControl; }
+	if(glad_glDebugMessageInsert != NULL && glad_glDebugMessageInsert != glad_trace_glDebugMessageInsert) { glad_trace_next_glDebugMessageInsert = glad_glDebugMessageInsert; glad_glDebugMessageInsert = glad_trace_glDebugMessageInsert; }
+	if(glad_glDebugMessageCallback != NULL && glad_glDebugMessageCallback != glad_trace_glDebugMessageCallback) { glad_trace_next_glDebugMessageCallback = glad_glDebugMessageCallback; glad_glDebugMessageCallback = glad_trace_glDebugMessageCallback; }
+	if(glad_glGetDebugMessageLog != NULL && glad_glGetDebugMessageLog != glad_trace_glGetDebugMessageLog) { glad_trace_next_glGetDebugMessageLog = glad_glGetDebugMessageLog; glad_glGetDebugMessageLog = glad_trace_glGetDebugMessageLog; }
+	if(glad_glPushDebugGroup != NULL && glad_glPushDebugGroup != glad_trace_glPushDebugGroup) { glad_trace_next_glPushDebugGroup = glad_glPushDebugGroup; glad_glPushDebugGroup = glad_trace_glPushDebugGroup; }
+	if(glad_glPopDebugGroup != NULL && glad_glPopDebugGroup != glad_trace_glPopDebugGroup) { glad_trace_next_glPopDebugGroup = glad_glPopDebugGroup; glad_glPopDebugGroup = glad_trace_glPopDebugGroup; }
+	if(glad_glObjectLabel != NULL && glad_glObjectLabel != glad_trace_glObjectLabel) { glad_trace_next_glObjectLabel = glad_glObjectLabel; glad_glObjectLabel = glad_trace_glObjectLabel; }
+	if(glad_glGetObjectLabel != NULL && glad_glGetObjectLabel != glad_trace_glGetObjectLabel) { glad_trace_next_glGetObjectLabel = glad_glGetObjectLabel; glad_glGetObjectLabel = glad_trace_glGetObjectLabel; }
+	if(glad_glObjectPtrLabel != NULL && glad_glObjectPtrLabel != glad_trace_glObjectPtrLabel) { glad_trace_next_glObjectPtrLabel = glad_glObjectPtrLabel; glad_glObjectPtrLabel = glad_trace_glObjectPtrLabel; }
+	if(glad_glGetObjectPtrLabel != NULL && glad_glGetObjectPtrLabel != glad_trace_glGetObjectPtrLabel) { glad_trace_next_glGetObjectPtrLabel = glad_glGetObjectPtrLabel; glad_glGetObjectPtrLabel = glad_trace_glGetObjectPtrLabel; }
+}
+static void glad_trace_unwrap(void) {
+	if(glad_glCullFace == glad_trace_glCullFace) glad_glCullFace = glad_trace_next_glCullFace;
+	if(glad_glFrontFace == glad_trace_glFrontFace) glad_glFrontFace = glad_trace_next_glFrontFace;
+	if(glad_glHint == glad_trace_glHint) glad_glHint = glad_trace_next_glHint;
+	if(glad_glLineWidth == glad_trace_glLineWidth) glad_glLineWidth = glad_trace_next_glLineWidth;
+	if(glad_glPointSize == glad_trace_glPointSize) glad_glPointSize = glad_trace_next_glPointSize;
+	if(glad_glPolygonMode == glad_trace_glPolygonMode) glad_glPolygonMode = glad_trace_next_glPolygonMode;
+	if(glad_glScissor == glad_trace_glScissor) glad_glScissor = glad_trace_next_glScissor;
+	if(glad_glTexParameterf == glad_trace_glTexParameterf) glad_glTexParameterf = glad_trace_next_glTexParameterf;
+	if(glad_glTexParameterfv == glad_trace_glTexParameterfv) glad_glTexParameterfv = glad_trace_next_glTexParameterfv;
+	if(glad_glTexParameteri == glad_trace_glTexParameteri) glad_glTexParameteri = glad_trace_next_glTexParameteri;
+	if(glad_glTexParameteriv == glad_trace_glTexParameteriv) glad_glTexParameteriv = glad_trace_next_glTexParameteriv;
+	if(glad_glTexImage1D == glad_trace_glTexImage1D) glad_glTexImage1D = glad_trace_next_glTexImage1D;
+	if(glad_glTexImage2D == glad_trace_glTexImage2D) glad_glTexImage2D = glad_trace_next_glTexImage2D;
+	if(glad_glDrawBuffer == glad_trace_glDrawBuffer) glad_glDrawBuffer = glad_trace_next_glDrawBuffer;
+	if(glad_glClear == glad_trace_glClear) glad_glClear = glad_trace_next_glClear;
+	if(glad_glClearColor == glad_trace_glClearColor) glad_glClearColor = glad_trace_next_glClearColor;
+	if(glad_glClearStencil == glad_trace_glClearStencil) glad_glClearStencil = glad_trace_next_glClearStencil;
+	if(glad_glClearDepth == glad_trace_glClearDepth) glad_glClearDepth = glad_trace_next_glClearDepth;
+	if(glad_glStencilMask == glad_trace_glStencilMask) glad_glStencilMask = glad_trace_next_glStencilMask;
+	if(glad_glColorMask == glad_trace_glColorMask) glad_glColorMask = glad_trace_next_glColorMask;
+	if(glad_glDepthMask == glad_trace_glDepthMask) glad_glDepthMask = glad_trace_next_glDepthMask;
+	if(glad_glDisable == glad_trace_glDisable) glad_glDisable = glad_trace_next_glDisable;
+	if(glad_glEnable == glad_trace_glEnable) glad_glEnable = glad_trace_next_glEnable;
+	if(glad_glFinish == glad_trace_glFinish) glad_glFinish = glad_trace_next_glFinish;
+	if(glad_glFlush == glad_trace_glFlush) glad_glFlush = glad_trace_next_glFlush;
+	if(glad_glBlendFunc == glad_trace_glBlendFunc) glad_glBlendFunc = glad_trace_next_glBlendFunc;
+	if(glad_glLogicOp == glad_trace_glLogicOp) glad_glLogicOp = glad_trace_next_glLogicOp;
+	if(glad_glStencilFunc == glad_trace_glStencilFunc) glad_glStencilFunc = glad_trace_next_glStencilFunc;
+	if(glad_glStencilOp == glad_trace_glStencilOp) glad_glStencilOp = glad_trace_next_glStencilOp;
+	if(glad_glDepthFunc == glad_trace_glDepthFunc) glad_glDepthFunc = glad_trace_next_glDepthFunc;
+	if(glad_glPixelStoref == glad_trace_glPixelStoref) glad_glPixelStoref = glad_trace_next_glPixelStoref;
+	if(glad_glPixelStorei == glad_trace_glPixelStorei) glad_glPixelStorei = glad_trace_next_glPixelStorei;
+	if(glad_glReadBuffer == glad_trace_glReadBuffer) glad_glReadBuffer = glad_trace_next_glReadBuffer;
+	if(glad_glReadPixels == glad_trace_glReadPixels) glad_glReadPixels = glad_trace_next_glReadPixels;
+	if(glad_glGetBooleanv == glad_trace_glGetBooleanv) glad_glGetBooleanv = glad_trace_next_glGetBooleanv;
+	if(glad_glGetDoublev == glad_trace_glGetDoublev) glad_glGetDoublev = glad_trace_next_glGetDoublev;
+	if(glad_glGetError == glad_trace_glGetError) glad_glGetError = glad_trace_next_glGetError;
+	if(glad_glGetFloatv == glad_trace_glGetFloatv) glad_glGetFloatv = glad_trace_next_glGetFloatv;
+	if(glad_glGetIntegerv == glad_trace_glGetIntegerv) glad_glGetIntegerv = glad_trace_next_glGetIntegerv;
+	if(glad_glGetString == glad_trace_glGetString) glad_glGetString = glad_trace_next_glGetString;
+	if(glad_glGetTexImage == glad_trace_glGetTexImage) glad_glGetTexImage = glad_trace_next_glGetTexImage;
+	if(glad_glGetTexParameterfv == glad_trace_glGetTexParameterfv) glad_glGetTexParameterfv = glad_trace_next_glGetTexParameterfv;
+	if(glad_glGetTexParameteriv == glad_trace_glGetTexParameteriv) glad_glGetTexParameteriv = glad_trace_next_glGetTexParameteriv;
+	if(glad_glGetTexLevelParameterfv == glad_trace_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = glad_trace_next_glGetTexLevelParameterfv;
+	if(glad_glGetTexLevelParameteriv == glad_trace_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = glad_trace_next_glGetTexLevelParameteriv;
+	if(glad_glIsEnabled == glad_trace_glIsEnabled) glad_glIsEnabled = glad_trace_next_glIsEnabled;
+	if(glad_glDepthRange == glad_trace_glDepthRange) glad_glDepthRange = glad_trace_next_glDepthRange;
+	if(glad_glViewport == glad_trace_glViewport) glad_glViewport = glad_trace_next_glViewport;
+	if(glad_glNewList == glad_trace_glNewList) glad_glNewList = glad_trace_next_glNewList;
+	if(glad_glEndList == glad_trace_glEndList) glad_glEndList = glad_trace_next_glEndList;
+	if(glad_glCallList == glad_trace_glCallList) glad_glCallList = glad_trace_next_glCallList;
+	if(glad_glCallLists == glad_trace_glCallLists) glad_glCallLists = glad_trace_next_glCallLists;
+	if(glad_glDeleteLists == glad_trace_glDeleteLists) glad_glDeleteLists = glad_trace_next_glDeleteLists;
+	if(glad_glGenLists == glad_trace_glGenLists) glad_glGenLists = glad_trace_next_glGenLists;
+	if(glad_glListBase == glad_trace_glListBase) glad_glListBase = glad_trace_next_glListBase;
+	if(glad_glBegin == glad_trace_glBegin) glad_glBegin = glad_trace_next_glBegin;
+	if(glad_glBitmap == glad_trace_glBitmap) glad_glBitmap = glad_trace_next_glBitmap;
+	if(glad_glColor3b == glad_trace_glColor3b) glad_glColor3b = glad_trace_next_glColor3b;
+	if(glad_glColor3bv == glad_trace_glColor3bv) glad_glColor3bv = glad_trace_next_glColor3bv;
+	if(glad_glColor3d == glad_trace_glColor3d) glad_glColor3d = glad_trace_next_glColor3d;
+	if(glad_glColor3dv == glad_trace_glColor3dv) glad_glColor3dv = glad_trace_next_glColor3dv;
+	if(glad_glColor3f == glad_trace_glColor3f) glad_glColor3f = glad_trace_next_glColor3f;
+	if(glad_glColor3fv == glad_trace_glColor3fv) glad_glColor3fv = glad_trace_next_glColor3fv;
+	if(glad_glColor3i == glad_trace_glColor3i) glad_glColor3i = glad_trace_next_glColor3i;
+	if(glad_glColor3iv == glad_trace_glColor3iv) glad_glColor3iv = glad_trace_next_glColor3iv;
+	if(glad_glColor3s == glad_trace_glColor3s) glad_glColor3s = glad_trace_next_glColor3s;
+	if(glad_glColor3sv == glad_trace_glColor3sv) glad_glColor3sv = glad_trace_next_glColor3sv;
+	if(glad_glColor3ub == glad_trace_glColor3ub) glad_glColor3ub = glad_trace_next_glColor3ub;
+	if(glad_glColor3ubv == glad_trace_glColor3ubv) glad_glColor3ubv = glad_trace_next_glColor3ubv;
+	if(glad_glColor3ui == glad_trace_glColor3ui) glad_glColor3ui = glad_trace_next_glColor3ui;
+	if(glad_glColor3uiv == glad_trace_glColor3uiv) glad_glColor3uiv = glad_trace_next_glColor3uiv;
+	if(glad_glColor3us == glad_trace_glColor3us) glad_glColor3us = glad_trace_next_glColor3us;
+	if(glad_glColor3usv == glad_trace_glColor3usv) glad_glColor3usv = glad_trace_next_glColor3usv;
+	if(glad_glColor4b == glad_trace_glColor4b) glad_glColor4b = glad_trace_next_glColor4b;
+	if(glad_glColor4bv == glad_trace_glColor4bv) glad_glColor4bv = glad_trace_next_glColor4bv;
+	if(glad_glColor4d == glad_trace_glColor4d) glad_glColor4d = glad_trace_next_glColor4d;
+	if(glad_glColor4dv == glad_trace_glColor4dv) glad_glColor4dv = glad_trace_next_glColor4dv;
+	if(glad_glColor4f == glad_trace_glColor4f) glad_glColor4f = glad_trace_next_glColor4f;
+	if(glad_glColor4fv == glad_trace_glColor4fv) glad_glColor4fv = glad_trace_next_glColor4fv;
+	if(glad_glColor4i == glad_trace_glColor4i) glad_glColor4i = glad_trace_next_glColor4i;
+	if(glad_glColor4iv == glad_trace_glColor4iv) glad_glColor4iv = glad_trace_next_glColor4iv;
+	if(glad_glColor4s == glad_trace_glColor4s) glad_glColor4s = glad_trace_next_glColor4s;
+	if(glad_glColor4sv == glad_trace_glColor4sv) glad_glColor4sv = glad_trace_next_glColor4sv;
+	if(glad_glColor4ub == glad_trace_glColor4ub) glad_glColor4ub = glad_trace_next_glColor4ub;
+	if(glad_glColor4ubv == glad_trace_glColor4ubv) glad_glColor4ubv = glad_trace_next_glColor4ubv;
+	if(glad_glColor4ui == glad_trace_glColor4ui) glad_glColor4ui = glad_trace_next_glColor4ui;
+	if(glad_glColor4uiv == glad_trace_glColor4uiv) glad_glColor4uiv = glad_trace_next_glColor4uiv;
+	if(glad_glColor4us == glad_trace_glColor4us) glad_glColor4us = glad_trace_next_glColor4us;
+	if(glad_glColor4usv == glad_trace_glColor4usv) glad_glColor4usv = glad_trace_next_glColor4usv;
+	if(glad_glEdgeFlag == glad_trace_glEdgeFlag) glad_glEdgeFlag = glad_trace_next_glEdgeFlag;
+	if(glad_glEdgeFlagv == glad_trace_glEdgeFlagv) glad_glEdgeFlagv = glad_trace_next_glEdgeFlagv;
+	if(glad_glEnd == glad_trace_glEnd) glad_glEnd = glad_trace_next_glEnd;
+	if(glad_glIndexd == glad_trace_glIndexd) glad_glIndexd = glad_trace_next_glIndexd;
+	if(glad_glIndexdv == glad_trace_glIndexdv) glad_glIndexdv = glad_trace_next_glIndexdv;
+	if(glad_glIndexf == glad_trace_glIndexf) glad_glIndexf = glad_trace_next_glIndexf;
+	if(glad_glIndexfv == glad_trace_glIndexfv) glad_glIndexfv = glad_trace_next_glIndexfv;
+	if(glad_glIndexi == glad_trace_glIndexi) glad_glIndexi = glad_trace_next_glIndexi;
+	if(glad_glIndexiv == glad_trace_glIndexiv) glad_glIndexiv = glad_trace_next_glIndexiv;
+	if(glad_glIndexs == glad_trace_glIndexs) glad_glIndexs = glad_trace_next_glIndexs;
+	if(glad_glIndexsv == glad_trace_glIndexsv) glad_glIndexsv = glad_trace_next_glIndexsv;
+	if(glad_glNormal3b == glad_trace_glNormal3b) glad_glNormal3b = glad_trace_next_glNormal3b;
+	if(glad_glNormal3bv == glad_trace_glNormal3bv) glad_glNormal3bv = glad_trace_next_glNormal3bv;
+	if(glad_glNormal3d == glad_trace_glNormal3d) glad_glNormal3d = glad_trace_next_glNormal3d;
+	if(glad_glNormal3dv == glad_trace_glNormal3dv) glad_glNormal3dv = glad_trace_next_glNormal3dv;
+	if(glad_glNormal3f == glad_trace_glNormal3f) glad_glNormal3f = glad_trace_next_glNormal3f;
+	if(glad_glNormal3fv == glad_trace_glNormal3fv) glad_glNormal3fv = glad_trace_next_glNormal3fv;
+	if(glad_glNormal3i == glad_trace_glNormal3i) glad_glNormal3i = glad_trace_next_glNormal3i;
+	if(glad_glNormal3iv == glad_trace_glNormal3iv) glad_glNormal3iv = glad_trace_next_glNormal3iv;
+	if(glad_glNormal3s == glad_trace_glNormal3s) glad_glNormal3s = glad_trace_next_glNormal3s;
+	if(glad_glNormal3sv == glad_trace_glNormal3sv) glad_glNormal3sv = glad_trace_next_glNormal3sv;
+	if(glad_glRasterPos2d == glad_trace_glRasterPos2d) glad_glRasterPos2d = glad_trace_next_glRasterPos2d;
+	if(glad_glRasterPos2dv == glad_trace_glRasterPos2dv) glad_glRasterPos2dv = glad_trace_next_glRasterPos2dv;
+	if(glad_glRasterPos2f == glad_trace_glRasterPos2f) glad_glRasterPos2f = glad_trace_next_glRasterPos2f;
+	if(glad_glRasterPos2fv == glad_trace_glRasterPos2fv) glad_glRasterPos2fv = glad_trace_next_glRasterPos2fv;
+	if(glad_glRasterPos2i == glad_trace_glRasterPos2i) glad_glRasterPos2i = glad_trace_next_glRasterPos2i;
+	if(glad_glRasterPos2iv == glad_trace_glRasterPos2iv) glad_glRasterPos2iv = glad_trace_next_glRasterPos2iv;
+	if(glad_glRasterPos2s == glad_trace_glRasterPos2s) glad_glRasterPos2s = glad_trace_next_glRasterPos2s;
+	if(glad_glRasterPos2sv == glad_trace_glRasterPos2sv) glad_glRasterPos2sv = glad_trace_next_glRasterPos2sv;
+	if(glad_glRasterPos3d == glad_trace_glRasterPos3d) glad_glRasterPos3d = glad_trace_next_glRasterPos3d;
+	if(glad_glRasterPos3dv == glad_trace_glRasterPos3dv) glad_glRasterPos3dv = glad_trace_next_glRasterPos3dv;
+	if(glad_glRasterPos3f == glad_trace_glRasterPos3f) glad_glRasterPos3f = glad_trace_next_glRasterPos3f;
+	if(glad_glRasterPos3fv == glad_trace_glRasterPos3fv) glad_glRasterPos3fv = glad_trace_next_glRasterPos3fv;
+	if(glad_glRasterPos3i == glad_trace_glRasterPos3i) glad_glRasterPos3i = glad_trace_next_glRasterPos3i;
+	if(glad_glRasterPos3iv == glad_trace_glRasterPos3iv) glad_glRasterPos3iv = glad_trace_next_glRasterPos3iv;
+	if(glad_glRasterPos3s == glad_trace_glRasterPos3s) glad_glRasterPos3s = glad_trace_next_glRasterPos3s;
+	if(glad_glRasterPos3sv == glad_trace_glRasterPos3sv) glad_glRasterPos3sv = glad_trace_next_glRasterPos3sv;
+	if(glad_glRasterPos4d == glad_trace_glRasterPos4d) glad_glRasterPos4d = glad_trace_next_glRasterPos4d;
+	if(glad_glRasterPos4dv == glad_trace_glRasterPos4dv) glad_glRasterPos4dv = glad_trace_next_glRasterPos4dv;
+	if(glad_glRasterPos4f == glad_trace_glRasterPos4f) glad_glRasterPos4f = glad_trace_next_glRasterPos4f;
+	if(glad_glRasterPos4fv == glad_trace_glRasterPos4fv) glad_glRasterPos4fv = glad_trace_next_glRasterPos4fv;
+	if(glad_glRasterPos4i == glad_trace_glRasterPos4i) glad_glRasterPos4i = glad_trace_next_glRasterPos4i;
+	if(glad_glRasterPos4iv == glad_trace_glRasterPos4iv) glad_glRasterPos4iv = glad_trace_next_glRasterPos4iv;
+	if(glad_glRasterPos4s == glad_trace_glRasterPos4s) glad_glRasterPos4s = glad_trace_next_glRasterPos4s;
+	if(glad_glRasterPos4sv == glad_trace_glRasterPos4sv) glad_glRasterPos4sv = glad_trace_next_glRasterPos4sv;
+	if(glad_glRectd == glad_trace_glRectd) glad_glRectd = glad_trace_next_glRectd;
+	if(glad_glRectdv == glad_trace_glRectdv) glad_glRectdv = glad_trace_next_glRectdv;
+	if(glad_glRectf == glad_trace_glRectf) glad_glRectf = glad_trace_next_glRectf;
+	if(glad_glRectfv == glad_trace_glRectfv) glad_glRectfv = glad_trace_next_glRectfv;
+	if(glad_glRecti == glad_trace_glRecti) glad_glRecti = glad_trace_next_glRecti;
+	if(glad_glRectiv == glad_trace_glRectiv) glad_glRectiv = glad_trace_next_glRectiv;
+	if(glad_glRects == glad_trace_glRects) glad_glRects = glad_trace_next_glRects;
+	if(glad_glRectsv == glad_trace_glRectsv) glad_glRectsv = glad_trace_next_glRectsv;
+	if(glad_glTexCoord1d == glad_trace_glTexCoord1d) glad_glTexCoord1d = glad_trace_next_glTexCoord1d;
+	if(glad_glTexCoord1dv == glad_trace_glTexCoord1dv) glad_glTexCoord1dv = glad_trace_next_glTexCoord1dv;
+	if(glad_glTexCoord1f == glad_trace_glTexCoord1f) glad_glTexCoord1f = glad_trace_next_glTexCoord1f;
+	if(glad_glTexCoord1fv == glad_trace_glTexCoord1fv) glad_glTexCoord1fv = glad_trace_next_glTexCoord1fv;
+	if(glad_glTexCoord1i == glad_trace_glTexCoord1i) glad_glTexCoord1i = glad_trace_next_glTexCoord1i;
+	if(glad_glTexCoord1iv == glad_trace_glTexCoord1iv) glad_glTexCoord1iv = glad_trace_next_glTexCoord1iv;
+	if(glad_glTexCoord1s == glad_trace_glTexCoord1s) glad_glTexCoord1s = glad_trace_next_glTexCoord1s;
+	if(glad_glTexCoord1sv == glad_trace_glTexCoord1sv) glad_glTexCoord1sv = glad_trace_next_glTexCoord1sv;
+	if(glad_glTexCoord2d == glad_trace_glTexCoord2d) glad_glTexCoord2d = glad_trace_next_glTexCoord2d;
+	if(glad_glTexCoord2dv == glad_trace_glTexCoord2dv) glad_glTexCoord2dv = glad_trace_next_glTexCoord2dv;
+	if(glad_glTexCoord2f == glad_trace_glTexCoord2f) glad_glTexCoord2f = glad_trace_next_glTexCoord2f;
+	if(glad_glTexCoord2fv == glad_trace_glTexCoord2fv) glad_glTexCoord2fv = glad_trace_next_glTexCoord2fv;
+	if(glad_glTexCoord2i == glad_trace_glTexCoord2i) glad_glTexCoord2i = glad_trace_next_glTexCoord2i;
+	if(glad_glTexCoord2iv == glad_trace_glTexCoord2iv) glad_glTexCoord2iv = glad_trace_next_glTexCoord2iv;
+	if(glad_glTexCoord2s == glad_trace_glTexCoord2s) glad_glTexCoord2s = glad_trace_next_glTexCoord2s;
+	if(glad_glTexCoord2sv == glad_trace_glTexCoord2sv) glad_glTexCoord2sv = glad_trace_next_glTexCoord2sv;
+	if(glad_glTexCoord3d == glad_trace_glTexCoord3d) glad_glTexCoord3d = glad_trace_next_glTexCoord3d;
+	if(glad_glTexCoord3dv == glad_trace_glTexCoord3dv) glad_glTexCoord3dv = glad_trace_next_glTexCoord3dv;
+	if(glad_glTexCoord3f == glad_trace_glTexCoord3f) glad_glTexCoord3f = glad_trace_next_glTexCoord3f;
+	if(glad_glTexCoord3fv == glad_trace_glTexCoord3fv) glad_glTexCoord3fv = glad_trace_next_glTexCoord3fv;
+	if(glad_glTexCoord3i == glad_trace_glTexCoord3i) glad_glTexCoord3i = glad_trace_next_glTexCoord3i;
+	if(glad_glTexCoord3iv == glad_trace_glTexCoord3iv) glad_glTexCoord3iv = glad_trace_next_glTexCoord3iv;
+	if(glad_glTexCoord3s == glad_trace_glTexCoord3s) glad_glTexCoord3s = glad_trace_next_glTexCoord3s;
+	if(glad_glTexCoord3sv == glad_trace_glTexCoord3sv) glad_glTexCoord3sv = glad_trace_next_glTexCoord3sv;
+	if(glad_glTexCoord4d == glad_trace_glTexCoord4d) glad_glTexCoord4d = glad_trace_next_glTexCoord4d;
+	if(glad_glTexCoord4dv == glad_trace_glTexCoord4dv) glad_glTexCoord4dv = glad_trace_next_glTexCoord4dv;
+	if(glad_glTexCoord4f == glad_trace_glTexCoord4f) glad_glTexCoord4f = glad_trace_next_glTexCoord4f;
+	if(glad_glTexCoord4fv == glad_trace_glTexCoord4fv) glad_glTexCoord4fv = glad_trace_next_glTexCoord4fv;
+	if(glad_glTexCoord4i == glad_trace_glTexCoord4i) glad_glTexCoord4i = glad_trace_next_glTexCoord4i;
+	if(glad_glTexCoord4iv == glad_trace_glTexCoord4iv) glad_glTexCoord4iv = glad_trace_next_glTexCoord4iv;
+	if(glad_glTexCoord4s == glad_trace_glTexCoord4s) glad_glTexCoord4s = glad_trace_next_glTexCoord4s;
+	if(glad_glTexCoord4sv == glad_trace_glTexCoord4sv) glad_glTexCoord4sv = glad_trace_next_glTexCoord4sv;
+	if(glad_glVertex2d == glad_trace_glVertex2d) glad_glVertex2d = glad_trace_next_glVertex2d;
+	if(glad_glVertex2dv == glad_trace_glVertex2dv) glad_glVertex2dv = glad_trace_next_glVertex2dv;
+	if(glad_glVertex2f == glad_trace_glVertex2f) glad_glVertex2f = glad_trace_next_glVertex2f;
+	if(glad_glVertex2fv == glad_trace_glVertex2fv) glad_glVertex2fv = glad_trace_next_glVertex2fv;
+	if(glad_glVertex2i == glad_trace_glVertex2i) glad_glVertex2i = glad_trace_next_glVertex2i;
+	if(glad_glVertex2iv == glad_trace_glVertex2iv) glad_glVertex2iv = glad_trace_next_glVertex2iv;
+	if(glad_glVertex2s == glad_trace_glVertex2s) glad_glVertex2s = glad_trace_next_glVertex2s;
+	if(glad_glVertex2sv == glad_trace_glVertex2sv) glad_glVertex2sv = glad_trace_next_glVertex2sv;
+	if(glad_glVertex3d == glad_trace_glVertex3d) glad_glVertex3d = glad_trace_next_glVertex3d;
+	if(glad_glVertex3dv == glad_trace_glVertex3dv) glad_glVertex3dv = glad_trace_next_glVertex3dv;
+	if(glad_glVertex3f == glad_trace_glVertex3f) glad_glVertex3f = glad_trace_next_glVertex3f;
+	if(glad_glVertex3fv == glad_trace_glVertex3fv) glad_glVertex3fv = glad_trace_next_glVertex3fv;
+	if(glad_glVertex3i == glad_trace_glVertex3i) glad_glVertex3i = glad_trace_next_glVertex3i;
+	if(glad_glVertex3iv == glad_trace_glVertex3iv) glad_glVertex3iv = glad_trace_next_glVertex3iv;
+	if(glad_glVertex3s == glad_trace_glVertex3s) glad_glVertex3s = glad_trace_next_glVertex3s;
+	if(glad_glVertex3sv == glad_trace_glVertex3sv) glad_glVertex3sv = glad_trace_next_glVertex3sv;
+	if(glad_glVertex4d == glad_trace_glVertex4d) glad_glVertex4d = glad_trace_next_glVertex4d;
+	if(glad_glVertex4dv == glad_trace_glVertex4dv) glad_glVertex4dv = glad_trace_next_glVertex4dv;
+	if(glad_glVertex4f == glad_trace_glVertex4f) glad_glVertex4f = glad_trace_next_glVertex4f;
+	if(glad_glVertex4fv == glad_trace_glVertex4fv) glad_glVertex4fv = glad_trace_next_glVertex4fv;
+	if(glad_glVertex4i == glad_trace_glVertex4i) glad_glVertex4i = glad_trace_next_glVertex4i;
+	if(glad_glVertex4iv == glad_trace_glVertex4iv) glad_glVertex4iv = glad_trace_next_glVertex4iv;
+	if(glad_glVertex4s == glad_trace_glVertex4s) glad_glVertex4s = glad_trace_next_glVertex4s;
+	if(glad_glVertex4sv == glad_trace_glVertex4sv) glad_glVertex4sv = glad_trace_next_glVertex4sv;
+	if(glad_glClipPlane == glad_trace_glClipPlane) glad_glClipPlane = glad_trace_next_glClipPlane;
+	if(glad_glColorMaterial == glad_trace_glColorMaterial) glad_glColorMaterial = glad_trace_next_glColorMaterial;
+	if(glad_glFogf == glad_trace_glFogf) glad_glFogf = glad_trace_next_glFogf;
+	if(glad_glFogfv == glad_trace_glFogfv) glad_glFogfv = glad_trace_next_glFogfv;
+	if(glad_glFogi == glad_trace_glFogi) glad_glFogi = glad_trace_next_glFogi;
+	if(glad_glFogiv == glad_trace_glFogiv) glad_glFogiv = glad_trace_next_glFogiv;
+	if(glad_glLightf == glad_trace_glLightf) glad_glLightf = glad_trace_next_glLightf;
+	if(glad_glLightfv == glad_trace_glLightfv) glad_glLightfv = glad_trace_next_glLightfv;
+	if(glad_glLighti == glad_trace_glLighti) glad_glLighti = glad_trace_next_glLighti;
+	if(glad_glLightiv == glad_trace_glLightiv) glad_glLightiv = glad_trace_next_glLightiv;
+	if(glad_glLightModelf == glad_trace_glLightModelf) glad_glLightModelf = glad_trace_next_glLightModelf;
+	if(glad_glLightModelfv == glad_trace_glLightModelfv) glad_glLightModelfv = glad_trace_next_glLightModelfv;
+	if(glad_glLightModeli == glad_trace_glLightModeli) glad_glLightModeli = glad_trace_next_glLightModeli;
+	if(glad_glLightModeliv == glad_trace_glLightModeliv) glad_glLightModeliv = glad_trace_next_glLightModeliv;
+	if(glad_glLineStipple == glad_trace_glLineStipple) glad_glLineStipple = glad_trace_next_glLineStipple;
+	if(glad_glMaterialf == glad_trace_glMaterialf) glad_glMaterialf = glad_trace_next_glMaterialf;
+	if(glad_glMaterialfv == glad_trace_glMaterialfv) glad_glMaterialfv = glad_trace_next_glMaterialfv;
+	if(glad_glMateriali == glad_trace_glMateriali) glad_glMateriali = glad_trace_next_glMateriali;
+	if(glad_glMaterialiv == glad_trace_glMaterialiv) glad_glMaterialiv = glad_trace_next_glMaterialiv;
+	if(glad_glPolygonStipple == glad_trace_glPolygonStipple) glad_glPolygonStipple = glad_trace_next_glPolygonStipple;
+	if(glad_glShadeModel == glad_trace_glShadeModel) glad_glShadeModel = glad_trace_next_glShadeModel;
+	if(glad_glTexEnvf == glad_trace_glTexEnvf) glad_glTexEnvf = glad_trace_next_glTexEnvf;
+	if(glad_glTexEnvfv == glad_trace_glTexEnvfv) glad_glTexEnvfv = glad_trace_next_glTexEnvfv;
+	if(glad_glTexEnvi == glad_trace_glTexEnvi) glad_glTexEnvi = glad_trace_next_glTexEnvi;
+	if(glad_glTexEnviv == glad_trace_glTexEnviv) glad_glTexEnviv = glad_trace_next_glTexEnviv;
+	if(glad_glTexGend == glad_trace_glTexGend) glad_glTexGend = glad_trace_next_glTexGend;
+	if(glad_glTexGendv == glad_trace_glTexGendv) glad_glTexGendv = glad_trace_next_glTexGendv;
+	if(glad_glTexGenf == glad_trace_glTexGenf) glad_glTexGenf = glad_trace_next_glTexGenf;
+	if(glad_glTexGenfv == glad_trace_glTexGenfv) glad_glTexGenfv = glad_trace_next_glTexGenfv;
+	if(glad_glTexGeni == glad_trace_glTexGeni) glad_glTexGeni = glad_trace_next_glTexGeni;
+	if(glad_glTexGeniv == glad_trace_glTexGeniv) glad_glTexGeniv = glad_trace_next_glTexGeniv;
+	if(glad_glFeedbackBuffer == glad_trace_glFeedbackBuffer) glad_glFeedbackBuffer = glad_trace_next_glFeedbackBuffer;
+	if(glad_glSelectBuffer == glad_trace_glSelectBuffer) glad_glSelectBuffer = glad_trace_next_glSelectBuffer;
+	if(glad_glRenderMode == glad_trace_glRenderMode) glad_glRenderMode = glad_trace_next_glRenderMode;
+	if(glad_glInitNames == glad_trace_glInitNames) glad_glInitNames = glad_trace_next_glInitNames;
+	if(glad_glLoadName == glad_trace_glLoadName) glad_glLoadName = glad_trace_next_glLoadName;
+	if(glad_glPassThrough == glad_trace_glPassThrough) glad_glPassThrough = glad_trace_next_glPassThrough;
+	if(glad_glPopName == glad_trace_glPopName) glad_glPopName = glad_trace_next_glPopName;
+	if(glad_glPushName == glad_trace_glPushName) glad_glPushName = glad_trace_next_glPushName;
+	if(glad_glClearAccum == glad_trace_glClearAccum) glad_glClearAccum = glad_trace_next_glClearAccum;
+	if(glad_glClearIndex == glad_trace_glClearIndex) glad_glClearIndex = glad_trace_next_glClearIndex;
+	if(glad_glIndexMask == glad_trace_glIndexMask) glad_glIndexMask = glad_trace_next_glIndexMask;
+	if(glad_glAccum == glad_trace_glAccum) glad_glAccum = glad_trace_next_glAccum;
+	if(glad_glPopAttrib == glad_trace_glPopAttrib) glad_glPopAttrib = glad_trace_next_glPopAttrib;
+	if(glad_glPushAttrib == glad_trace_glPushAttrib) glad_glPushAttrib = glad_trace_next_glPushAttrib;
+	if(glad_glMap1d == glad_trace_glMap1d) glad_glMap1d = glad_trace_next_glMap1d;
+	if(glad_glMap1f == glad_trace_glMap1f) glad_glMap1f = glad_trace_next_glMap1f;
+	if(glad_glMap2d == glad_trace_glMap2d) glad_glMap2d = glad_trace_next_glMap2d;
+	if(glad_glMap2f == glad_trace_glMap2f) glad_glMap2f = glad_trace_next_glMap2f;
+	if(glad_glMapGrid1d == glad_trace_glMapGrid1d) glad_glMapGrid1d = glad_trace_next_glMapGrid1d;
+	if(glad_glMapGrid1f == glad_trace_glMapGrid1f) glad_glMapGrid1f = glad_trace_next_glMapGrid1f;
+	if(glad_glMapGrid2d == glad_trace_glMapGrid2d) glad_glMapGrid2d = glad_trace_next_glMapGrid2d;
+	if(glad_glMapGrid2f == glad_trace_glMapGrid2f) glad_glMapGrid2f = glad_trace_next_glMapGrid2f;
+	if(glad_glEvalCoord1d == glad_trace_glEvalCoord1d) glad_glEvalCoord1d = glad_trace_next_glEvalCoord1d;
+	if(glad_glEvalCoord1dv == glad_trace_glEvalCoord1dv) glad_glEvalCoord1dv = glad_trace_next_glEvalCoord1dv;
+	if(glad_glEvalCoord1f == glad_trace_glEvalCoord1f) glad_glEvalCoord1f = glad_trace_next_glEvalCoord1f;
+	if(glad_glEvalCoord1fv == glad_trace_glEvalCoord1fv) glad_glEvalCoord1fv = glad_trace_next_glEvalCoord1fv;
+	if(glad_glEvalCoord2d == glad_trace_glEvalCoord2d) glad_glEvalCoord2d = glad_trace_next_glEvalCoord2d;
+	if(glad_glEvalCoord2dv == glad_trace_glEvalCoord2dv) glad_glEvalCoord2dv = glad_trace_next_glEvalCoord2dv;
+	if(glad_glEvalCoord2f == glad_trace_glEvalCoord2f) glad_glEvalCoord2f = glad_trace_next_glEvalCoord2f;
+	if(glad_glEvalCoord2fv == glad_trace_glEvalCoord2fv) glad_glEvalCoord2fv = glad_trace_next_glEvalCoord2fv;
+	if(glad_glEvalMesh1 == glad_trace_glEvalMesh1) glad_glEvalMesh1 = glad_trace_next_glEvalMesh1;
+	if(glad_glEvalPoint1 == glad_trace_glEvalPoint1) glad_glEvalPoint1 = glad_trace_next_glEvalPoint1;
+	if(glad_glEvalMesh2 == glad_trace_glEvalMesh2) glad_glEvalMesh2 = glad_trace_next_glEvalMesh2;
+	if(glad_glEvalPoint2 == glad_trace_glEvalPoint2) glad_glEvalPoint2 = glad_trace_next_glEvalPoint2;
+	if(glad_glAlphaFunc == glad_trace_glAlphaFunc) glad_glAlphaFunc = glad_trace_next_glAlphaFunc;
+	if(glad_glPixelZoom == glad_trace_glPixelZoom) glad_glPixelZoom = glad_trace_next_glPixelZoom;
+	if(glad_glPixelTransferf == glad_trace_glPixelTransferf) glad_glPixelTransferf = glad_trace_next_glPixelTransferf;
+	if(glad_glPixelTransferi == glad_trace_glPixelTransferi) glad_glPixelTransferi = glad_trace_next_glPixelTransferi;
+	if(glad_glPixelMapfv == glad_trace_glPixelMapfv) glad_glPixelMapfv = glad_trace_next_glPixelMapfv;
+	if(glad_glPixelMapuiv == glad_trace_glPixelMapuiv) glad_glPixelMapuiv = glad_trace_next_glPixelMapuiv;
+	if(glad_glPixelMapusv == glad_trace_glPixelMapusv) glad_glPixelMapusv = glad_trace_next_glPixelMapusv;
+	if(glad_glCopyPixels == glad_trace_glCopyPixels) glad_glCopyPixels = glad_trace_next_glCopyPixels;
+	if(glad_glDrawPixels == glad_trace_glDrawPixels) glad_glDrawPixels = glad_trace_next_glDrawPixels;
+	if(glad_glGetClipPlane == glad_trace_glGetClipPlane) glad_glGetClipPlane = glad_trace_next_glGetClipPlane;
+	if(glad_glGetLightfv == glad_trace_glGetLightfv) glad_glGetLightfv = glad_trace_next_glGetLightfv;
+	if(glad_glGetLightiv == glad_trace_glGetLightiv) glad_glGetLightiv = glad_trace_next_glGetLightiv;
+	if(glad_glGetMapdv == glad_trace_glGetMapdv) glad_glGetMapdv = glad_trace_next_glGetMapdv;
+	if(glad_glGetMapfv == glad_trace_glGetMapfv) glad_glGetMapfv = glad_trace_next_glGetMapfv;
+	if(glad_glGetMapiv == glad_trace_glGetMapiv) glad_glGetMapiv = glad_trace_next_glGetMapiv;
+	if(glad_glGetMaterialfv == glad_trace_glGetMaterialfv) glad_glGetMaterialfv = glad_trace_next_glGetMaterialfv;
+	if(glad_glGetMaterialiv == glad_trace_glGetMaterialiv) glad_glGetMaterialiv = glad_trace_next_glGetMaterialiv;
+	if(glad_glGetPixelMapfv == glad_trace_glGetPixelMapfv) glad_glGetPixelMapfv = glad_trace_next_glGetPixelMapfv;
+	if(glad_glGetPixelMapuiv == glad_trace_glGetPixelMapuiv) glad_glGetPixelMapuiv = glad_trace_next_glGetPixelMapuiv;
+	if(glad_glGetPixelMapusv == glad_trace_glGetPixelMapusv) glad_glGetPixelMapusv = glad_trace_next_glGetPixelMapusv;
+	if(glad_glGetPolygonStipple == glad_trace_glGetPolygonStipple) glad_glGetPolygonStipple = glad_trace_next_glGetPolygonStipple;
+	if(glad_glGetTexEnvfv == glad_trace_glGetTexEnvfv) glad_glGetTexEnvfv = glad_trace_next_glGetTexEnvfv;
+	if(glad_glGetTexEnviv == glad_trace_glGetTexEnviv) glad_glGetTexEnviv = glad_trace_next_glGetTexEnviv;
+	if(glad_glGetTexGendv == glad_trace_glGetTexGendv) glad_glGetTexGendv = glad_trace_next_glGetTexGendv;
+	if(glad_glGetTexGenfv == glad_trace_glGetTexGenfv) glad_glGetTexGenfv = glad_trace_next_glGetTexGenfv;
+	if(glad_glGetTexGeniv == glad_trace_glGetTexGeniv) glad_glGetTexGeniv = glad_trace_next_glGetTexGeniv;
+	if(glad_glIsList == glad_trace_glIsList) glad_glIsList = glad_trace_next_glIsList;
+	if(glad_glFrustum == glad_trace_glFrustum) glad_glFrustum = glad_trace_next_glFrustum;
+	if(glad_glLoadIdentity == glad_trace_glLoadIdentity) glad_glLoadIdentity = glad_trace_next_glLoadIdentity;
+	if(glad_glLoadMatrixf == glad_trace_glLoadMatrixf) glad_glLoadMatrixf = glad_trace_next_glLoadMatrixf;
+	if(glad_glLoadMatrixd == glad_trace_glLoadMatrixd) glad_glLoadMatrixd = glad_trace_next_glLoadMatrixd;
+	if(glad_glMatrixMode == glad_trace_glMatrixMode) glad_glMatrixMode = glad_trace_next_glMatrixMode;
+	if(glad_glMultMatrixf == glad_trace_glMultMatrixf) glad_glMultMatrixf = glad_trace_next_glMultMatrixf;
+	if(glad_glMultMatrixd == glad_trace_glMultMatrixd) glad_glMultMatrixd = glad_trace_next_glMultMatrixd;
+	if(glad_glOrtho == glad_trace_glOrtho) glad_glOrtho = glad_trace_next_glOrtho;
+	if(glad_glPopMatrix == glad_trace_glPopMatrix) glad_glPopMatrix = glad_trace_next_glPopMatrix;
+	if(glad_glPushMatrix == glad_trace_glPushMatrix) glad_glPushMatrix = glad_trace_next_glPushMatrix;
+	if(glad_glRotated == glad_trace_glRotated) glad_glRotated = glad_trace_next_glRotated;
+	if(glad_glRotatef == glad_trace_glRotatef) glad_glRotatef = glad_trace_next_glRotatef;
+	if(glad_glScaled == glad_trace_glScaled) glad_glScaled = glad_trace_next_glScaled;
+	if(glad_glScalef == glad_trace_glScalef) glad_glScalef = glad_trace_next_glScalef;
+	if(glad_glTranslated == glad_trace_glTranslated) glad_glTranslated = glad_trace_next_glTranslated;
+	if(glad_glTranslatef == glad_trace_glTranslatef) glad_glTranslatef = glad_trace_next_glTranslatef;
+	if(glad_glDrawArrays == glad_trace_glDrawArrays) glad_glDrawArrays = glad_trace_next_glDrawArrays;
+	if(glad_glDrawElements == glad_trace_glDrawElements) glad_glDrawElements = glad_trace_next_glDrawElements;
+	if(glad_glGetPointerv == glad_trace_glGetPointerv) glad_glGetPointerv = glad_trace_next_glGetPointerv;
+	if(glad_glPolygonOffset == glad_trace_glPolygonOffset) glad_glPolygonOffset = glad_trace_next_glPolygonOffset;
+	if(glad_glCopyTexImage1D == glad_trace_glCopyTexImage1D) glad_glCopyTexImage1D = glad_trace_next_glCopyTexImage1D;
+	if(glad_glCopyTexImage2D == glad_trace_glCopyTexImage2D) glad_glCopyTexImage2D = glad_trace_next_glCopyTexImage2D;
+	if(glad_glCopyTexSubImage1D == glad_trace_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = glad_trace_next_glCopyTexSubImage1D;
+	if(glad_glCopyTexSubImage2D == glad_trace_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = glad_trace_next_glCopyTexSubImage2D;
+	if(glad_glTexSubImage1D == glad_trace_glTexSubImage1D) glad_glTexSubImage1D = glad_trace_next_glTexSubImage1D;
+	if(glad_glTexSubImage2D == glad_trace_glTexSubImage2D) glad_glTexSubImage2D = glad_trace_next_glTexSubImage2D;
+	if(glad_glBindTexture == glad_trace_glBindTexture) glad_glBindTexture = glad_trace_next_glBindTexture;
+	if(glad_glDeleteTextures == glad_trace_glDeleteTextures) glad_glDeleteTextures = glad_trace_next_glDeleteTextures;
+	if(glad_glGenTextures == glad_trace_glGenTextures) glad_glGenTextures = glad_trace_next_glGenTextures;
+	if(glad_glIsTexture == glad_trace_glIsTexture) glad_glIsTexture = glad_trace_next_glIsTexture;
+	if(glad_glArrayElement == glad_trace_glArrayElement) glad_glArrayElement = glad_trace_next_glArrayElement;
+	if(glad_glColorPointer == glad_trace_glColorPointer) glad_glColorPointer = glad_trace_next_glColorPointer;
+	if(glad_glDisableClientState == glad_trace_glDisableClientState) glad_glDisableClientState = glad_trace_next_glDisableClientState;
+	if(glad_glEdgeFlagPointer == glad_trace_glEdgeFlagPointer) glad_glEdgeFlagPointer = glad_trace_next_glEdgeFlagPointer;
+	if(glad_glEnableClientState == glad_trace_glEnableClientState) glad_glEnableClientState = glad_trace_next_glEnableClientState;
+	if(glad_glIndexPointer == glad_trace_glIndexPointer) glad_glIndexPointer = glad_trace_next_glIndexPointer;
+	if(glad_glInterleavedArrays == glad_trace_glInterleavedArrays) glad_glInterleavedArrays = glad_trace_next_glInterleavedArrays;
+	if(glad_glNormalPointer == glad_trace_glNormalPointer) glad_glNormalPointer = glad_trace_next_glNormalPointer;
+	if(glad_glTexCoordPointer == glad_trace_glTexCoordPointer) glad_glTexCoordPointer = glad_trace_next_glTexCoordPointer;
+	if(glad_glVertexPointer == glad_trace_glVertexPointer) glad_glVertexPointer = glad_trace_next_glVertexPointer;
+	if(glad_glAreTexturesResident == glad_trace_glAreTexturesResident) glad_glAreTexturesResident = glad_trace_next_glAreTexturesResident;
+	if(glad_glPrioritizeTextures == glad_trace_glPrioritizeTextures) glad_glPrioritizeTextures = glad_trace_next_glPrioritizeTextures;
+	if(glad_glIndexub == glad_trace_glIndexub) glad_glIndexub = glad_trace_next_glIndexub;
+	if(glad_glIndexubv == glad_trace_glIndexubv) glad_glIndexubv = glad_trace_next_glIndexubv;
+	if(glad_glPopClientAttrib == glad_trace_glPopClientAttrib) glad_glPopClientAttrib = glad_trace_next_glPopClientAttrib;
+	if(glad_glPushClientAttrib == glad_trace_glPushClientAttrib) glad_glPushClientAttrib = glad_trace_next_glPushClientAttrib;
+	if(glad_glDrawRangeElements == glad_trace_glDrawRangeElements) glad_glDrawRangeElements = glad_trace_next_glDrawRangeElements;
+	if(glad_glTexImage3D == glad_trace_glTexImage3D) glad_glTexImage3D = glad_trace_next_glTexImage3D;
+	if(glad_glTexSubImage3D == glad_trace_glTexSubImage3D) glad_glTexSubImage3D = glad_trace_next_glTexSubImage3D;
+	if(glad_glCopyTexSubImage3D == glad_trace_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = glad_trace_next_glCopyTexSubImage3D;
+	if(glad_glActiveTexture == glad_trace_glActiveTexture) glad_glActiveTexture = glad_trace_next_glActiveTexture;
+	if(glad_glSampleCoverage == glad_trace_glSampleCoverage) glad_glSampleCoverage = glad_trace_next_glSampleCoverage;
+	if(glad_glCompressedTexImage3D == glad_trace_glCompressedTexImage3D) glad_glCompressedTexImage3D = glad_trace_next_glCompressedTexImage3D;
+	if(glad_glCompressedTexImage2D == glad_trace_glCompressedTexImage2D) glad_glCompressedTexImage2D = glad_trace_next_glCompressedTexImage2D;
+	if(glad_glCompressedTexImage1D == glad_trace_glCompressedTexImage1D) glad_glCompressedTexImage1D = glad_trace_next_glCompressedTexImage1D;
+	if(glad_glCompressedTexSubImage3D == glad_trace_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = glad_trace_next_glCompressedTexSubImage3D;
+	if(glad_glCompressedTexSubImage2D == glad_trace_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = glad_trace_next_glCompressedTexSubImage2D;
+	if(glad_glCompressedTexSubImage1D == glad_trace_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = glad_trace_next_glCompressedTexSubImage1D;
+	if(glad_glGetCompressedTexImage == glad_trace_glGetCompressedTexImage) glad_glGetCompressedTexImage = glad_trace_next_glGetCompressedTexImage;
+	if(glad_glClientActiveTexture == glad_trace_glClientActiveTexture) glad_glClientActiveTexture = glad_trace_next_glClientActiveTexture;
+	if(glad_glMultiTexCoord1d == glad_trace_glMultiTexCoord1d) glad_glMultiTexCoord1d = glad_trace_next_glMultiTexCoord1d;
+	if(glad_glMultiTexCoord1dv == glad_trace_glMultiTexCoord1dv) glad_glMultiTexCoord1dv = glad_trace_next_glMultiTexCoord1dv;
+	if(glad_glMultiTexCoord1f == glad_trace_glMultiTexCoord1f) glad_glMultiTexCoord1f = glad_trace_next_glMultiTexCoord1f;
+	if(glad_glMultiTexCoord1fv == glad_trace_glMultiTexCoord1fv) glad_glMultiTexCoord1fv = glad_trace_next_glMultiTexCoord1fv;
+	if(glad_glMultiTexCoord1i == glad_trace_glMultiTexCoord1i) glad_glMultiTexCoord1i = glad_trace_next_glMultiTexCoord1i;
+	if(glad_glMultiTexCoord1iv == glad_trace_glMultiTexCoord1iv) glad_glMultiTexCoord1iv = glad_trace_next_glMultiTexCoord1iv;
+	if(glad_glMultiTexCoord1s == glad_trace_glMultiTexCoord1s) glad_glMultiTexCoord1s = glad_trace_next_glMultiTexCoord1s;
+	if(glad_glMultiTexCoord1sv == glad_trace_glMultiTexCoord1sv) glad_glMultiTexCoord1sv = glad_trace_next_glMultiTexCoord1sv;
+	if(glad_glMultiTexCoord2d == glad_trace_glMultiTexCoord2d) glad_glMultiTexCoord2d = glad_trace_next_glMultiTexCoord2d;
+	if(glad_glMultiTexCoord2dv == glad_trace_glMultiTexCoord2dv) glad_glMultiTexCoord2dv = glad_trace_next_glMultiTexCoord2dv;
+	if(glad_glMultiTexCoord2f == glad_trace_glMultiTexCoord2f) glad_glMultiTexCoord2f = glad_trace_next_glMultiTexCoord2f;
+	if(glad_glMultiTexCoord2fv == glad_trace_glMultiTexCoord2fv) glad_glMultiTexCoord2fv = glad_trace_next_glMultiTexCoord2fv;
+	if(glad_glMultiTexCoord2i == glad_trace_glMultiTexCoord2i) glad_glMultiTexCoord2i = glad_trace_next_glMultiTexCoord2i;
+	if(glad_glMultiTexCoord2iv == glad_trace_glMultiTexCoord2iv) glad_glMultiTexCoord2iv = glad_trace_next_glMultiTexCoord2iv;
+	if(glad_glMultiTexCoord2s == glad_trace_glMultiTexCoord2s) glad_glMultiTexCoord2s = glad_trace_next_glMultiTexCoord2s;
+	if(glad_glMultiTexCoord2sv == glad_trace_glMultiTexCoord2sv) glad_glMultiTexCoord2sv = glad_trace_next_glMultiTexCoord2sv;
+	if(glad_glMultiTexCoord3d == glad_trace_glMultiTexCoord3d) glad_glMultiTexCoord3d = glad_trace_next_glMultiTexCoord3d;
+	if(glad_glMultiTexCoord3dv == glad_trace_glMultiTexCoord3dv) glad_glMultiTexCoord3dv = glad_trace_next_glMultiTexCoord3dv;
+	if(glad_glMultiTexCoord3f == glad_trace_glMultiTexCoord3f) glad_glMultiTexCoord3f = glad_trace_next_glMultiTexCoord3f;
+	if(glad_glMultiTexCoord3fv == glad_trace_glMultiTexCoord3fv) glad_glMultiTexCoord3fv = glad_trace_next_glMultiTexCoord3fv;
+	if(glad_glMultiTexCoord3i == glad_trace_glMultiTexCoord3i) glad_glMultiTexCoord3i = glad_trace_next_glMultiTexCoord3i;
+	if(glad_glMultiTexCoord3iv == glad_trace_glMultiTexCoord3iv) glad_glMultiTexCoord3iv = glad_trace_next_glMultiTexCoord3iv;
+	if(glad_glMultiTexCoord3s == glad_trace_glMultiTexCoord3s) glad_glMultiTexCoord3s = glad_trace_next_glMultiTexCoord3s;
+	if(glad_glMultiTexCoord3sv == glad_trace_glMultiTexCoord3sv) glad_glMultiTexCoord3sv = glad_trace_next_glMultiTexCoord3sv;
+	if(glad_glMultiTexCoord4d == glad_trace_glMultiTexCoord4d) glad_glMultiTexCoord4d = glad_trace_next_glMultiTexCoord4d;
+	if(glad_glMultiTexCoord4dv == glad_trace_glMultiTexCoord4dv) glad_glMultiTexCoord4dv = glad_trace_next_glMultiTexCoord4dv;
+	if(glad_glMultiTexCoord4f == glad_trace_glMultiTexCoord4f) glad_glMultiTexCoord4f = glad_trace_next_glMultiTexCoord4f;
+	if(glad_glMultiTexCoord4fv == glad_trace_glMultiTexCoord4fv) glad_glMultiTexCoord4fv = glad_trace_next_glMultiTexCoord4fv;
+	if(glad_glMultiTexCoord4i == glad_trace_glMultiTexCoord4i) glad_glMultiTexCoord4i = glad_trace_next_glMultiTexCoord4i;
+	if(glad_glMultiTexCoord4iv == glad_trace_glMultiTexCoord4iv) glad_glMultiTexCoord4iv = glad_trace_next_glMultiTexCoord4iv;
+	if(glad_glMultiTexCoord4s == glad_trace_glMultiTexCoord4s) glad_glMultiTexCoord4s = glad_trace_next_glMultiTexCoord4s;
+	if(glad_glMultiTexCoord4sv == glad_trace_glMultiTexCoord4sv) glad_glMultiTexCoord4sv = glad_trace_next_glMultiTexCoord4sv;
+	if(glad_glLoadTransposeMatrixf == glad_trace_glLoadTransposeMatrixf) glad_glLoadTransposeMatrixf = glad_trace_next_glLoadTransposeMatrixf;
+	if(glad_glLoadTransposeMatrixd == glad_trace_glLoadTransposeMatrixd) glad_glLoadTransposeMatrixd = glad_trace_next_glLoadTransposeMatrixd;
+	if(glad_glMultTransposeMatrixf == glad_trace_glMultTransposeMatrixf) glad_glMultTransposeMatrixf = glad_trace_next_glMultTransposeMatrixf;
+	if(glad_glMultTransposeMatrixd == glad_trace_glMultTransposeMatrixd) glad_glMultTransposeMatrixd = glad_trace_next_glMultTransposeMatrixd;
+	if(glad_glBlendFuncSeparate == glad_trace_glBlendFuncSeparate) glad_glBlendFuncSeparate = glad_trace_next_glBlendFuncSeparate;
+	if(glad_glMultiDrawArrays == glad_trace_glMultiDrawArrays) glad_glMultiDrawArrays = glad_trace_next_glMultiDrawArrays;
+	if(glad_glMultiDrawElements == glad_trace_glMultiDrawElements) glad_glMultiDrawElements = glad_trace_next_glMultiDrawElements;
+	if(glad_glPointParameterf == glad_trace_glPointParameterf) glad_glPointParameterf = glad_trace_next_glPointParameterf;
+	if(glad_glPointParameterfv == glad_trace_glPointParameterfv) glad_glPointParameterfv = glad_trace_next_glPointParameterfv;
+	if(glad_glPointParameteri == glad_trace_glPointParameteri) glad_glPointParameteri = glad_trace_next_glPointParameteri;
+	if(glad_glPointParameteriv == glad_trace_glPointParameteriv) glad_glPointParameteriv = glad_trace_next_glPointParameteriv;
+	if(glad_glFogCoordf == glad_trace_glFogCoordf) glad_glFogCoordf = glad_trace_next_glFogCoordf;
+	if(glad_glFogCoordfv == glad_trace_glFogCoordfv) glad_glFogCoordfv = glad_trace_next_glFogCoordfv;
+	if(glad_glFogCoordd == glad_trace_glFogCoordd) glad_glFogCoordd = glad_trace_next_glFogCoordd;
+	if(glad_glFogCoorddv == glad_trace_glFogCoorddv) glad_glFogCoorddv = glad_trace_next_glFogCoorddv;
+	if(glad_glFogCoordPointer == glad_trace_glFogCoordPointer) glad_glFogCoordPointer = glad_trace_next_glFogCoordPointer;
+	if(glad_glSecondaryColor3b == glad_trace_glSecondaryColor3b) glad_glSecondaryColor3b = glad_trace_next_glSecondaryColor3b;
+	if(glad_glSecondaryColor3bv == glad_trace_glSecondaryColor3bv) glad_glSecondaryColor3bv = glad_trace_next_glSecondaryColor3bv;
+	if(glad_glSecondaryColor3d == glad_trace_glSecondaryColor3d) glad_glSecondaryColor3d = glad_trace_next_glSecondaryColor3d;
+	if(glad_glSecondaryColor3dv == glad_trace_glSecondaryColor3dv) glad_glSecondaryColor3dv = glad_trace_next_glSecondaryColor3dv;
+	if(glad_glSecondaryColor3f == glad_trace_glSecondaryColor3f) glad_glSecondaryColor3f = glad_trace_next_glSecondaryColor3f;
+	if(glad_glSecondaryColor3fv == glad_trace_glSecondaryColor3fv) glad_glSecondaryColor3fv = glad_trace_next_glSecondaryColor3fv;
+	if(glad_glSecondaryColor3i == glad_trace_glSecondaryColor3i) glad_glSecondaryColor3i = glad_trace_next_glSecondaryColor3i;
+	if(glad_glSecondaryColor3iv == glad_trace_glSecondaryColor3iv) glad_glSecondaryColor3iv = glad_trace_next_glSecondaryColor3iv;
+	if(glad_glSecondaryColor3s == glad_trace_glSecondaryColor3s) glad_glSecondaryColor3s = glad_trace_next_glSecondaryColor3s;
+	if(glad_glSecondaryColor3sv == glad_trace_glSecondaryColor3sv) glad_glSecondaryColor3sv = glad_trace_next_glSecondaryColor3sv;
+	if(glad_glSecondaryColor3ub == glad_trace_glSecondaryColor3ub) glad_glSecondaryColor3ub = glad_trace_next_glSecondaryColor3ub;
+	if(glad_glSecondaryColor3ubv == glad_trace_glSecondaryColor3ubv) glad_glSecondaryColor3ubv = glad_trace_next_glSecondaryColor3ubv;
+	if(glad_glSecondaryColor3ui == glad_trace_glSecondaryColor3ui) glad_glSecondaryColor3ui = glad_trace_next_glSecondaryColor3ui;
+	if(glad_glSecondaryColor3uiv == glad_trace_glSecondaryColor3uiv) glad_glSecondaryColor3uiv = glad_trace_next_glSecondaryColor3uiv;
+	if(glad_glSecondaryColor3us == glad_trace_glSecondaryColor3us) glad_glSecondaryColor3us = glad_trace_next_glSecondaryColor3us;
+	if(glad_glSecondaryColor3usv == glad_trace_glSecondaryColor3usv) glad_glSecondaryColor3usv = glad_trace_next_glSecondaryColor3usv;
+	if(glad_glSecondaryColorPointer == glad_trace_glSecondaryColorPointer) glad_glSecondaryColorPointer = glad_trace_next_glSecondaryColorPointer;
+	if(glad_glWindowPos2d == glad_trace_glWindowPos2d) glad_glWindowPos2d = glad_trace_next_glWindowPos2d;
+	if(glad_glWindowPos2dv == glad_trace_glWindowPos2dv) glad_glWindowPos2dv = glad_trace_next_glWindowPos2dv;
+	if(glad_glWindowPos2f == glad_trace_glWindowPos2f) glad_glWindowPos2f = glad_trace_next_glWindowPos2f;
+	if(glad_glWindowPos2fv == glad_trace_glWindowPos2fv) glad_glWindowPos2fv = glad_trace_next_glWindowPos2fv;
+	if(glad_glWindowPos2i == glad_trace_glWindowPos2i) glad_glWindowPos2i = glad_trace_next_glWindowPos2i;
+	if(glad_glWindowPos2iv == glad_trace_glWindowPos2iv) glad_glWindowPos2iv = glad_trace_next_glWindowPos2iv;
+	if(glad_glWindowPos2s == glad_trace_glWindowPos2s) glad_glWindowPos2s = glad_trace_next_glWindowPos2s;
+	if(glad_glWindowPos2sv == glad_trace_glWindowPos2sv) glad_glWindowPos2sv = glad_trace_next_glWindowPos2sv;
+	if(glad_glWindowPos3d == glad_trace_glWindowPos3d) glad_glWindowPos3d = glad_trace_next_glWindowPos3d;
+	if(glad_glWindowPos3dv == glad_trace_glWindowPos3dv) glad_glWindowPos3dv = glad_trace_next_glWindowPos3dv;
+	if(glad_glWindowPos3f == glad_trace_glWindowPos3f) glad_glWindowPos3f = glad_trace_next_glWindowPos3f;
+	if(glad_glWindowPos3fv == glad_trace_glWindowPos3fv) glad_glWindowPos3fv = glad_trace_next_glWindowPos3fv;
+	if(glad_glWindowPos3i == glad_trace_glWindowPos3i) glad_glWindowPos3i = glad_trace_next_glWindowPos3i;
+	if(glad_glWindowPos3iv == glad_trace_glWindowPos3iv) glad_glWindowPos3iv = glad_trace_next_glWindowPos3iv;
+	if(glad_glWindowPos3s == glad_trace_glWindowPos3s) glad_glWindowPos3s = glad_trace_next_glWindowPos3s;
+	if(glad_glWindowPos3sv == glad_trace_glWindowPos3sv) glad_glWindowPos3sv = glad_trace_next_glWindowPos3sv;
+	if(glad_glBlendColor == glad_trace_glBlendColor) glad_glBlendColor = glad_trace_next_glBlendColor;
+	if(glad_glBlendEquation == glad_trace_glBlendEquation) glad_glBlendEquation = glad_trace_next_glBlendEquation;
+	if(glad_glGenQueries == glad_trace_glGenQueries) glad_glGenQueries = glad_trace_next_glGenQueries;
+	if(glad_glDeleteQueries == glad_trace_glDeleteQueries) glad_glDeleteQueries = glad_trace_next_glDeleteQueries;
+	if(glad_glIsQuery == glad_trace_glIsQuery) glad_glIsQuery = glad_trace_next_glIsQuery;
+	if(glad_glBeginQuery == glad_trace_glBeginQuery) glad_glBeginQuery = glad_trace_next_glBeginQuery;
+	if(glad_glEndQuery == glad_trace_glEndQuery) glad_glEndQuery = glad_trace_next_glEndQuery;
+	if(glad_glGetQueryiv == glad_trace_glGetQueryiv) glad_glGetQueryiv = glad_trace_next_glGetQueryiv;
+	if(glad_glGetQueryObjectiv == glad_trace_glGetQueryObjectiv) glad_glGetQueryObjectiv = glad_trace_next_glGetQueryObjectiv;
+	if(glad_glGetQueryObjectuiv == glad_trace_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = glad_trace_next_glGetQueryObjectuiv;
+	if(glad_glBindBuffer == glad_trace_glBindBuffer) glad_glBindBuffer = glad_trace_next_glBindBuffer;
+	if(glad_glDeleteBuffers == glad_trace_glDeleteBuffers) glad_glDeleteBuffers = glad_trace_next_glDeleteBuffers;
+	if(glad_glGenBuffers == glad_trace_glGenBuffers) glad_glGenBuffers = glad_trace_next_glGenBuffers;
+	if(glad_glIsBuffer == glad_trace_glIsBuffer) glad_glIsBuffer = glad_trace_next_glIsBuffer;
+	if(glad_glBufferData == glad_trace_glBufferData) glad_glBufferData = glad_trace_next_glBufferData;
+	if(glad_glBufferSubData == glad_trace_glBufferSubData) glad_glBufferSubData = glad_trace_next_glBufferSubData;
+	if(glad_glGetBufferSubData == glad_trace_glGetBufferSubData) glad_glGetBufferSubData = glad_trace_next_glGetBufferSubData;
+	if(glad_glMapBuffer == glad_trace_glMapBuffer) glad_glMapBuffer = glad_trace_next_glMapBuffer;
+	if(glad_glUnmapBuffer == glad_trace_glUnmapBuffer) glad_glUnmapBuffer = glad_trace_next_glUnmapBuffer;
+	if(glad_glGetBufferParameteriv == glad_trace_glGetBufferParameteriv) glad_glGetBufferParameteriv = glad_trace_next_glGetBufferParameteriv;
+	if(glad_glGetBufferPointerv == glad_trace_glGetBufferPointerv) glad_glGetBufferPointerv = glad_trace_next_glGetBufferPointerv;
+	if(glad_glBlendEquationSeparate == glad_trace_glBlendEquationSeparate) glad_glBlendEquationSeparate = glad_trace_next_glBlendEquationSeparate;
+	if(glad_glDrawBuffers == glad_trace_glDrawBuffers) glad_glDrawBuffers = glad_trace_next_glDrawBuffers;
+	if(glad_glStencilOpSeparate == glad_trace_glStencilOpSeparate) glad_glStencilOpSeparate = glad_trace_next_glStencilOpSeparate;
+	if(glad_glStencilFuncSeparate == glad_trace_glStencilFuncSeparate) glad_glStencilFuncSeparate = glad_trace_next_glStencilFuncSeparate;
+	if(glad_glStencilMaskSeparate == glad_trace_glStencilMaskSeparate) glad_glStencilMaskSeparate = glad_trace_next_glStencilMaskSeparate;
+	if(glad_glAttachShader == glad_trace_glAttachShader) glad_glAttachShader = glad_trace_next_glAttachShader;
+	if(glad_glBindAttribLocation == glad_trace_glBindAttribLocation) glad_glBindAttribLocation = glad_trace_next_glBindAttribLocation;
+	if(glad_glCompileShader == glad_trace_glCompileShader) glad_glCompileShader = glad_trace_next_glCompileShader;
+	if(glad_glCreateProgram == glad_trace_glCreateProgram) glad_glCreateProgram = glad_trace_next_glCreateProgram;
+	if(glad_glCreateShader == glad_trace_glCreateShader) glad_glCreateShader = glad_trace_next_glCreateShader;
+	if(glad_glDeleteProgram == glad_trace_glDeleteProgram) glad_glDeleteProgram = glad_trace_next_glDeleteProgram;
+	if(glad_glDeleteShader == glad_trace_glDeleteShader) glad_glDeleteShader = glad_trace_next_glDeleteShader;
+	if(glad_glDetachShader == glad_trace_glDetachShader) glad_glDetachShader = glad_trace_next_glDetachShader;
+	if(glad_glDisableVertexAttribArray == glad_trace_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = glad_trace_next_glDisableVertexAttribArray;
+	if(glad_glEnableVertexAttribArray == glad_trace_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = glad_trace_next_glEnableVertexAttribArray;
+	if(glad_glGetActiveAttrib == glad_trace_glGetActiveAttrib) glad_glGetActiveAttrib = glad_trace_next_glGetActiveAttrib;
+	if(glad_glGetActiveUniform == glad_trace_glGetActiveUniform) glad_glGetActiveUniform = glad_trace_next_glGetActiveUniform;
+	if(glad_glGetAttachedShaders == glad_trace_glGetAttachedShaders) glad_glGetAttachedShaders = glad_trace_next_glGetAttachedShaders;
+	if(glad_glGetAttribLocation == glad_trace_glGetAttribLocation) glad_glGetAttribLocation = glad_trace_next_glGetAttribLocation;
+	if(glad_glGetProgramiv == glad_trace_glGetProgramiv) glad_glGetProgramiv = glad_trace_next_glGetProgramiv;
+	if(glad_glGetProgramInfoLog == glad_trace_glGetProgramInfoLog) glad_glGetProgramInfoLog = glad_trace_next_glGetProgramInfoLog;
+	if(glad_glGetShaderiv == glad_trace_glGetShaderiv) glad_glGetShaderiv = glad_trace_next_glGetShaderiv;
+	if(glad_glGetShaderInfoLog == glad_trace_glGetShaderInfoLog) glad_glGetShaderInfoLog = glad_trace_next_glGetShaderInfoLog;
+	if(glad_glGetShaderSource == glad_trace_glGetShaderSource) glad_glGetShaderSource = glad_trace_next_glGetShaderSource;
+	if(glad_glGetUniformLocation == glad_trace_glGetUniformLocation) glad_glGetUniformLocation = glad_trace_next_glGetUniformLocation;
+	if(glad_glGetUniformfv == glad_trace_glGetUniformfv) glad_glGetUniformfv = glad_trace_next_glGetUniformfv;
+	if(glad_glGetUniformiv == glad_trace_glGetUniformiv) glad_glGetUniformiv = glad_trace_next_glGetUniformiv;
+	if(glad_glGetVertexAttribdv == glad_trace_glGetVertexAttribdv) glad_glGetVertexAttribdv = glad_trace_next_glGetVertexAttribdv;
+	if(glad_glGetVertexAttribfv == glad_trace_glGetVertexAttribfv) glad_glGetVertexAttribfv = glad_trace_next_glGetVertexAttribfv;
+	if(glad_glGetVertexAttribiv == glad_trace_glGetVertexAttribiv) glad_glGetVertexAttribiv = glad_trace_next_glGetVertexAttribiv;
+	if(glad_glGetVertexAttribPointerv == glad_trace_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = glad_trace_next_glGetVertexAttribPointerv;
+	if(glad_glIsProgram == glad_trace_glIsProgram) glad_glIsProgram = glad_trace_next_glIsProgram;
+	if(glad_glIsShader == glad_trace_glIsShader) glad_glIsShader = glad_trace_next_glIsShader;
+	if(glad_glLinkProgram == glad_trace_glLinkProgram) glad_glLinkProgram = glad_trace_next_glLinkProgram;
+	if(glad_glShaderSource == glad_trace_glShaderSource) glad_glShaderSource = glad_trace_next_glShaderSource;
+	if(glad_glUseProgram == glad_trace_glUseProgram) glad_glUseProgram = glad_trace_next_glUseProgram;
+	if(glad_glUniform1f == glad_trace_glUniform1f) glad_glUniform1f = glad_trace_next_glUniform1f;
+	if(glad_glUniform2f == glad_trace_glUniform2f) glad_glUniform2f = glad_trace_next_glUniform2f;
+	if(glad_glUniform3f == glad_trace_glUniform3f) glad_glUniform3f = glad_trace_next_glUniform3f;
+	if(glad_glUniform4f == glad_trace_glUniform4f) glad_glUniform4f = glad_trace_next_glUniform4f;
+	if(glad_glUniform1i == glad_trace_glUniform1i) glad_glUniform1i = glad_trace_next_glUniform1i;
+	if(glad_glUniform2i == glad_trace_glUniform2i) glad_glUniform2i = glad_trace_next_glUniform2i;
+	if(glad_glUniform3i == glad_trace_glUniform3i) glad_glUniform3i = glad_trace_next_glUniform3i;
+	if(glad_glUniform4i == glad_trace_glUniform4i) glad_glUniform4i = glad_trace_next_glUniform4i;
+	if(glad_glUniform1fv == glad_trace_glUniform1fv) glad_glUniform1fv = glad_trace_next_glUniform1fv;
+	if(glad_glUniform2fv == glad_trace_glUniform2fv) glad_glUniform2fv = glad_trace_next_glUniform2fv;
+	if(glad_glUniform3fv == glad_trace_glUniform3fv) glad_glUniform3fv = glad_trace_next_glUniform3fv;
+	if(glad_glUniform4fv == glad_trace_glUniform4fv) glad_glUniform4fv = glad_trace_next_glUniform4fv;
+	if(glad_glUniform1iv == glad_trace_glUniform1iv) glad_glUniform1iv = glad_trace_next_glUniform1iv;
+	if(glad_glUniform2iv == glad_trace_glUniform2iv) glad_glUniform2iv = glad_trace_next_glUniform2iv;
+	if(glad_glUniform3iv == glad_trace_glUniform3iv) glad_glUniform3iv = glad_trace_next_glUniform3iv;
+	if(glad_glUniform4iv == glad_trace_glUniform4iv) glad_glUniform4iv = glad_trace_next_glUniform4iv;
+	if(glad_glUniformMatrix2fv == glad_trace_glUniformMatrix2fv) glad_glUniformMatrix2fv = glad_trace_next_glUniformMatrix2fv;
+	if(glad_glUniformMatrix3fv == glad_trace_glUniformMatrix3fv) glad_glUniformMatrix3fv = glad_trace_next_glUniformMatrix3fv;
+	if(glad_glUniformMatrix4fv == glad_trace_glUniformMatrix4fv) glad_glUniformMatrix4fv = glad_trace_next_glUniformMatrix4fv;
+	if(glad_glValidateProgram == glad_trace_glValidateProgram) glad_glValidateProgram = glad_trace_next_glValidateProgram;
+	if(glad_glVertexAttrib1d == glad_trace_glVertexAttrib1d) glad_glVertexAttrib1d = glad_trace_next_glVertexAttrib1d;
+	if(glad_glVertexAttrib1dv == glad_trace_glVertexAttrib1dv) glad_glVertexAttrib1dv = glad_trace_next_glVertexAttrib1dv;
+	if(glad_glVertexAttrib1f == glad_trace_glVertexAttrib1f) glad_glVertexAttrib1f = glad_trace_next_glVertexAttrib1f;
+	if(glad_glVertexAttrib1fv == glad_trace_glVertexAttrib1fv) glad_glVertexAttrib1fv = glad_trace_next_glVertexAttrib1fv;
+	if(glad_glVertexAttrib1s == glad_trace_glVertexAttrib1s) glad_glVertexAttrib1s = glad_trace_next_glVertexAttrib1s;
+	if(glad_glVertexAttrib1sv == glad_trace_glVertexAttrib1sv) glad_glVertexAttrib1sv = glad_trace_next_glVertexAttrib1sv;
+	if(glad_glVertexAttrib2d == glad_trace_glVertexAttrib2d) glad_glVertexAttrib2d = glad_trace_next_glVertexAttrib2d;
+	if(glad_glVertexAttrib2dv == glad_trace_glVertexAttrib2dv) glad_glVertexAttrib2dv = glad_trace_next_glVertexAttrib2dv;
+	if(glad_glVertexAttrib2f == glad_trace_glVertexAttrib2f) glad_glVertexAttrib2f = glad_trace_next_glVertexAttrib2f;
+	if(glad_glVertexAttrib2fv == glad_trace_glVertexAttrib2fv) glad_glVertexAttrib2fv = glad_trace_next_glVertexAttrib2fv;
+	if(glad_glVertexAttrib2s == glad_trace_glVertexAttrib2s) glad_glVertexAttrib2s = glad_trace_next_glVertexAttrib2s;
+	if(glad_glVertexAttrib2sv == glad_trace_glVertexAttrib2sv) glad_glVertexAttrib2sv = glad_trace_next_glVertexAttrib2sv;
+	if(glad_glVertexAttrib3d == glad_trace_glVertexAttrib3d) glad_glVertexAttrib3d = glad_trace_next_glVertexAttrib3d;
+	if(glad_glVertexAttrib3dv == glad_trace_glVertexAttrib3dv) glad_glVertexAttrib3dv = glad_trace_next_glVertexAttrib3dv;
+	if(glad_glVertexAttrib3f == glad_trace_glVertexAttrib3f) glad_glVertexAttrib3f = glad_trace_next_glVertexAttrib3f;
+	if(glad_glVertexAttrib3fv == glad_trace_glVertexAttrib3fv) glad_glVertexAttrib3fv = glad_trace_next_glVertexAttrib3fv;
+	if(glad_glVertexAttrib3s == glad_trace_glVertexAttrib3s) glad_glVertexAttrib3s = glad_trace_next_glVertexAttrib3s;
+	if(glad_glVertexAttrib3sv == glad_trace_glVertexAttrib3sv) glad_glVertexAttrib3sv = glad_trace_next_glVertexAttrib3sv;
+	if(glad_glVertexAttrib4Nbv == glad_trace_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = glad_trace_next_glVertexAttrib4Nbv;
+	if(glad_glVertexAttrib4Niv == glad_trace_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = glad_trace_next_glVertexAttrib4Niv;
+	if(glad_glVertexAttrib4Nsv == glad_trace_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = glad_trace_next_glVertexAttrib4Nsv;
+	if(glad_glVertexAttrib4Nub == glad_trace_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = glad_trace_next_glVertexAttrib4Nub;
+	if(glad_glVertexAttrib4Nubv == glad_trace_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = glad_trace_next_glVertexAttrib4Nubv;
+	if(glad_glVertexAttrib4Nuiv == glad_trace_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = glad_trace_next_glVertexAttrib4Nuiv;
+	if(glad_glVertexAttrib4Nusv == glad_trace_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = glad_trace_next_glVertexAttrib4Nusv;
+	if(glad_glVertexAttrib4bv == glad_trace_glVertexAttrib4bv) glad_glVertexAttrib4bv = glad_trace_next_glVertexAttrib4bv;
+	if(glad_glVertexAttrib4d == glad_trace_glVertexAttrib4d) glad_glVertexAttrib4d = glad_trace_next_glVertexAttrib4d;
+	if(glad_glVertexAttrib4dv == glad_trace_glVertexAttrib4dv) glad_glVertexAttrib4dv = glad_trace_next_glVertexAttrib4dv;
+	if(glad_glVertexAttrib4f == glad_trace_glVertexAttrib4f) glad_glVertexAttrib4f = glad_trace_next_glVertexAttrib4f;
+	if(glad_glVertexAttrib4fv == glad_trace_glVertexAttrib4fv) glad_glVertexAttrib4fv = glad_trace_next_glVertexAttrib4fv;
+	if(glad_glVertexAttrib4iv == glad_trace_glVertexAttrib4iv) glad_glVertexAttrib4iv = glad_trace_next_glVertexAttrib4iv;
+	if(glad_glVertexAttrib4s == glad_trace_glVertexAttrib4s) glad_glVertexAttrib4s = glad_trace_next_glVertexAttrib4s;
+	if(glad_glVertexAttrib4sv == glad_trace_glVertexAttrib4sv) glad_glVertexAttrib4sv = glad_trace_next_glVertexAttrib4sv;
+	if(glad_glVertexAttrib4ubv == glad_trace_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = glad_trace_next_glVertexAttrib4ubv;
+	if(glad_glVertexAttrib4uiv == glad_trace_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = glad_trace_next_glVertexAttrib4uiv;
+	if(glad_glVertexAttrib4usv == glad_trace_glVertexAttrib4usv) glad_glVertexAttrib4usv = glad_trace_next_glVertexAttrib4usv;
+	if(glad_glVertexAttribPointer == glad_trace_glVertexAttribPointer) glad_glVertexAttribPointer = glad_trace_next_glVertexAttribPointer;
+	if(glad_glUniformMatrix2x3fv == glad_trace_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = glad_trace_next_glUniformMatrix2x3fv;
+	if(glad_glUniformMatrix3x2fv == glad_trace_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = glad_trace_next_glUniformMatrix3x2fv;
+	if(glad_glUniformMatrix2x4fv == glad_trace_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = glad_trace_next_glUniformMatrix2x4fv;
+	if(glad_glUniformMatrix4x2fv == glad_trace_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = glad_trace_next_glUniformMatrix4x2fv;
+	if(glad_glUniformMatrix3x4fv == glad_trace_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = glad_trace_next_glUniformMatrix3x4fv;
+	if(glad_glUniformMatrix4x3fv == glad_trace_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = glad_trace_next_glUniformMatrix4x3fv;
+	if(glad_glColorMaski == glad_trace_glColorMaski) glad_glColorMaski = glad_trace_next_glColorMaski;
+	if(glad_glGetBooleani_v == glad_trace_glGetBooleani_v) glad_glGetBooleani_v = glad_trace_next_glGetBooleani_v;
+	if(glad_glGetIntegeri_v == glad_trace_glGetIntegeri_v) glad_glGetIntegeri_v = glad_trace_next_glGetIntegeri_v;
+	if(glad_glEnablei == glad_trace_glEnablei) glad_glEnablei = glad_trace_next_glEnablei;
+	if(glad_glDisablei == glad_trace_glDisablei) glad_glDisablei = glad_trace_next_glDisablei;
+	if(glad_glIsEnabledi == glad_trace_glIsEnabledi) glad_glIsEnabledi = glad_trace_next_glIsEnabledi;
+	if(glad_glBeginTransformFeedback == glad_trace_glBeginTransformFeedback) glad_glBeginTransformFeedback = glad_trace_next_glBeginTransformFeedback;
+	if(glad_glEndTransformFeedback == glad_trace_glEndTransformFeedback) glad_glEndTransformFeedback = glad_trace_next_glEndTransformFeedback;
+	if(glad_glBindBufferRange == glad_trace_glBindBufferRange) glad_glBindBufferRange = glad_trace_next_glBindBufferRange;
+	if(glad_glBindBufferBase == glad_trace_glBindBufferBase) glad_glBindBufferBase = glad_trace_next_glBindBufferBase;
+	if(glad_glTransformFeedbackVaryings == glad_trace_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = glad_trace_next_glTransformFeedbackVaryings;
+	if(glad_glGetTransformFeedbackVarying == glad_trace_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = glad_trace_next_glGetTransformFeedbackVarying;
+	if(glad_glClampColor == glad_trace_glClampColor) glad_glClampColor = glad_trace_next_glClampColor;
+	if(glad_glBeginConditionalRender == glad_trace_glBeginConditionalRender) glad_glBeginConditionalRender = glad_trace_next_glBeginConditionalRender;
+	if(glad_glEndConditionalRender == glad_trace_glEndConditionalRender) glad_glEndConditionalRender = glad_trace_next_glEndConditionalRender;
+	if(glad_glVertexAttribIPointer == glad_trace_glVertexAttribIPointer) glad_glVertexAttribIPointer = glad_trace_next_glVertexAttribIPointer;
+	if(glad_glGetVertexAttribIiv == glad_trace_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = glad_trace_next_glGetVertexAttribIiv;
+	if(glad_glGetVertexAttribIuiv == glad_trace_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = glad_trace_next_glGetVertexAttribIuiv;
+	if(glad_glVertexAttribI1i == glad_trace_glVertexAttribI1i) glad_glVertexAttribI1i = glad_trace_next_glVertexAttribI1i;
+	if(glad_glVertexAttribI2i == glad_trace_glVertexAttribI2i) glad_glVertexAttribI2i = glad_trace_next_glVertexAttribI2i;
+	if(glad_glVertexAttribI3i == glad_trace_glVertexAttribI3i) glad_glVertexAttribI3i = glad_trace_next_glVertexAttribI3i;
+	if(glad_glVertexAttribI4i == glad_trace_glVertexAttribI4i) glad_glVertexAttribI4i = glad_trace_next_glVertexAttribI4i;
+	if(glad_glVertexAttribI1ui == glad_trace_glVertexAttribI1ui) glad_glVertexAttribI1ui = glad_trace_next_glVertexAttribI1ui;
+	if(glad_glVertexAttribI2ui == glad_trace_glVertexAttribI2ui) glad_glVertexAttribI2ui = glad_trace_next_glVertexAttribI2ui;
+	if(glad_glVertexAttribI3ui == glad_trace_glVertexAttribI3ui) glad_glVertexAttribI3ui = glad_trace_next_glVertexAttribI3ui;
+	if(glad_glVertexAttribI4ui == glad_trace_glVertexAttribI4ui) glad_glVertexAttribI4ui = glad_trace_next_glVertexAttribI4ui;
+	if(glad_glVertexAttribI1iv == glad_trace_glVertexAttribI1iv) glad_glVertexAttribI1iv = glad_trace_next_glVertexAttribI1iv;
+	if(glad_glVertexAttribI2iv == glad_trace_glVertexAttribI2iv) glad_glVertexAttribI2iv = glad_trace_next_glVertexAttribI2iv;
+	if(glad_glVertexAttribI3iv == glad_trace_glVertexAttribI3iv) glad_glVertexAttribI3iv = glad_trace_next_glVertexAttribI3iv;
+	if(glad_glVertexAttribI4iv == glad_trace_glVertexAttribI4iv) glad_glVertexAttribI4iv = glad_trace_next_glVertexAttribI4iv;
+	if(glad_glVertexAttribI1uiv == glad_trace_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = glad_trace_next_glVertexAttribI1uiv;
+	if(glad_glVertexAttribI2uiv == glad_trace_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = glad_trace_next_glVertexAttribI2uiv;
+	if(glad_glVertexAttribI3uiv == glad_trace_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = glad_trace_next_glVertexAttribI3uiv;
+	if(glad_glVertexAttribI4uiv == glad_trace_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = glad_trace_next_glVertexAttribI4uiv;
+	if(glad_glVertexAttribI4bv == glad_trace_glVertexAttribI4bv) glad_glVertexAttribI4bv = glad_trace_next_glVertexAttribI4bv;
+	if(glad_glVertexAttribI4sv == glad_trace_glVertexAttribI4sv) glad_glVertexAttribI4sv = glad_trace_next_glVertexAttribI4sv;
+	if(glad_glVertexAttribI4ubv == glad_trace_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = glad_trace_next_glVertexAttribI4ubv;
+	if(glad_glVertexAttribI4usv == glad_trace_glVertexAttribI4usv) glad_glVertexAttribI4usv = glad_trace_next_glVertexAttribI4usv;
+	if(glad_glGetUniformuiv == glad_trace_glGetUniformuiv) glad_glGetUniformuiv = glad_trace_next_glGetUniformuiv;
+	if(glad_glBindFragDataLocation == glad_trace_glBindFragDataLocation) glad_glBindFragDataLocation = glad_trace_next_glBindFragDataLocation;
+	if(glad_glGetFragDataLocation == glad_trace_glGetFragDataLocation) glad_glGetFragDataLocation = glad_trace_next_glGetFragDataLocation;
+	if(glad_glUniform1ui == glad_trace_glUniform1ui) glad_glUniform1ui = glad_trace_next_glUniform1ui;
+	if(glad_glUniform2ui == glad_trace_glUniform2ui) glad_glUniform2ui = glad_trace_next_glUniform2ui;
+	if(glad_glUniform3ui == glad_trace_glUniform3ui) glad_glUniform3ui = glad_trace_next_glUniform3ui;
+	if(glad_glUniform4ui == glad_trace_glUniform4ui) glad_glUniform4ui = glad_trace_next_glUniform4ui;
+	if(glad_glUniform1uiv == glad_trace_glUniform1uiv) glad_glUniform1uiv = glad_trace_next_glUniform1uiv;
+	if(glad_glUniform2uiv == glad_trace_glUniform2uiv) glad_glUniform2uiv = glad_trace_next_glUniform2uiv;
+	if(glad_glUniform3uiv == glad_trace_glUniform3uiv) glad_glUniform3uiv = glad_trace_next_glUniform3uiv;
+	if(glad_glUniform4uiv == glad_trace_glUniform4uiv) glad_glUniform4uiv = glad_trace_next_glUniform4uiv;
+	if(glad_glTexParameterIiv == glad_trace_glTexParameterIiv) glad_glTexParameterIiv = glad_trace_next_glTexParameterIiv;
+	if(glad_glTexParameterIuiv == glad_trace_glTexParameterIuiv) glad_glTexParameterIuiv = glad_trace_next_glTexParameterIuiv;
+	if(glad_glGetTexParameterIiv == glad_trace_glGetTexParameterIiv) glad_glGetTexParameterIiv = glad_trace_next_glGetTexParameterIiv;
+	if(glad_glGetTexParameterIuiv == glad_trace_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = glad_trace_next_glGetTexParameterIuiv;
+	if(glad_glClearBufferiv == glad_trace_glClearBufferiv) glad_glClearBufferiv = glad_trace_next_glClearBufferiv;
+	if(glad_glClearBufferuiv == glad_trace_glClearBufferuiv) glad_glClearBufferuiv = glad_trace_next_glClearBufferuiv;
+	if(glad_glClearBufferfv == glad_trace_glClearBufferfv) glad_glClearBufferfv = glad_trace_next_glClearBufferfv;
+	if(glad_glClearBufferfi == glad_trace_glClearBufferfi) glad_glClearBufferfi = glad_trace_next_glClearBufferfi;
+	if(glad_glGetStringi == glad_trace_glGetStringi) glad_glGetStringi = glad_trace_next_glGetStringi;
+	if(glad_glIsRenderbuffer == glad_trace_glIsRenderbuffer) glad_glIsRenderbuffer = glad_trace_next_glIsRenderbuffer;
+	if(glad_glBindRenderbuffer == glad_trace_glBindRenderbuffer) glad_glBindRenderbuffer = glad_trace_next_glBindRenderbuffer;
+	if(glad_glDeleteRenderbuffers == glad_trace_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = glad_trace_next_glDeleteRenderbuffers;
+	if(glad_glGenRenderbuffers == glad_trace_glGenRenderbuffers) glad_glGenRenderbuffers = glad_trace_next_glGenRenderbuffers;
+	if(glad_glRenderbufferStorage == glad_trace_glRenderbufferStorage) glad_glRenderbufferStorage = glad_trace_next_glRenderbufferStorage;
+	if(glad_glGetRenderbufferParameteriv == glad_trace_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = glad_trace_next_glGetRenderbufferParameteriv;
+	if(glad_glIsFramebuffer == glad_trace_glIsFramebuffer) glad_glIsFramebuffer = glad_trace_next_glIsFramebuffer;
+	if(glad_glBindFramebuffer == glad_trace_glBindFramebuffer) glad_glBindFramebuffer = glad_trace_next_glBindFramebuffer;
+	if(glad_glDeleteFramebuffers == glad_trace_glDeleteFramebuffers) glad_glDeleteFramebuffers = glad_trace_next_glDeleteFramebuffers;
+	if(glad_glGenFramebuffers == glad_trace_glGenFramebuffers) glad_glGenFramebuffers = glad_trace_next_glGenFramebuffers;
+	if(glad_glCheckFramebufferStatus == glad_trace_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = glad_trace_next_glCheckFramebufferStatus;
+	if(glad_glFramebufferTexture1D == glad_trace_glFramebufferTexture1D) glad_glFramebufferTexture1D = glad_trace_next_glFramebufferTexture1D;
+	if(glad_glFramebufferTexture2D == glad_trace_glFramebufferTexture2D) glad_glFramebufferTexture2D = glad_trace_next_glFramebufferTexture2D;
+	if(glad_glFramebufferTexture3D == glad_trace_glFramebufferTexture3D) glad_glFramebufferTexture3D = glad_trace_next_glFramebufferTexture3D;
+	if(glad_glFramebufferRenderbuffer == glad_trace_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = glad_trace_next_glFramebufferRenderbuffer;
+	if(glad_glGetFramebufferAttachmentParameteriv == glad_trace_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = glad_trace_next_glGetFramebufferAttachmentParameteriv;
+	if(glad_glGenerateMipmap == glad_trace_glGenerateMipmap) glad_glGenerateMipmap = glad_trace_next_glGenerateMipmap;
+	if(glad_glBlitFramebuffer == glad_trace_glBlitFramebuffer) glad_glBlitFramebuffer = glad_trace_next_glBlitFramebuffer;
+	if(glad_glRenderbufferStorageMultisample == glad_trace_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = glad_trace_next_glRenderbufferStorageMultisample;
+	if(glad_glFramebufferTextureLayer == glad_trace_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = glad_trace_next_glFramebufferTextureLayer;
+	if(glad_glMapBufferRange == glad_trace_glMapBufferRange) glad_glMapBufferRange = glad_trace_next_glMapBufferRange;
+	if(glad_glFlushMappedBufferRange == glad_trace_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = glad_trace_next_glFlushMappedBufferRange;
+	if(glad_glBindVertexArray == glad_trace_glBindVertexArray) glad_glBindVertexArray = glad_trace_next_glBindVertexArray;
+	if(glad_glDeleteVertexArrays == glad_trace_glDeleteVertexArrays) glad_glDeleteVertexArrays = glad_trace_next_glDeleteVertexArrays;
+	if(glad_glGenVertexArrays == glad_trace_glGenVertexArrays) glad_glGenVertexArrays = glad_trace_next_glGenVertexArrays;
+	if(glad_glIsVertexArray == glad_trace_glIsVertexArray) glad_glIsVertexArray = glad_trace_next_glIsVertexArray;
+	if(glad_glDrawArraysInstanced == glad_trace_glDrawArraysInstanced) glad_glDrawArraysInstanced = glad_trace_next_glDrawArraysInstanced;
+	if(glad_glDrawElementsInstanced == glad_trace_glDrawElementsInstanced) glad_glDrawElementsInstanced = glad_trace_next_glDrawElementsInstanced;
+	if(glad_glTexBuffer == glad_trace_glTexBuffer) glad_glTexBuffer = glad_trace_next_glTexBuffer;
+	if(glad_glPrimitiveRestartIndex == glad_trace_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = glad_trace_next_glPrimitiveRestartIndex;
+	if(glad_glCopyBufferSubData == glad_trace_glCopyBufferSubData) glad_glCopyBufferSubData = glad_trace_next_glCopyBufferSubData;
+	if(glad_glGetUniformIndices == glad_trace_glGetUniformIndices) glad_glGetUniformIndices = glad_trace_next_glGetUniformIndices;
+	if(glad_glGetActiveUniformsiv == glad_trace_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = glad_trace_next_glGetActiveUniformsiv;
+	if(glad_glGetActiveUniformName == glad_trace_glGetActiveUniformName) glad_glGetActiveUniformName = glad_trace_next_glGetActiveUniformName;
+	if(glad_glGetUniformBlockIndex == glad_trace_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = glad_trace_next_glGetUniformBlockIndex;
+	if(glad_glGetActiveUniformBlockiv == glad_trace_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = glad_trace_next_glGetActiveUniformBlockiv;
+	if(glad_glGetActiveUniformBlockName == glad_trace_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = glad_trace_next_glGetActiveUniformBlockName;
+	if(glad_glUniformBlockBinding == glad_trace_glUniformBlockBinding) glad_glUniformBlockBinding = glad_trace_next_glUniformBlockBinding;
+	if(glad_glDrawElementsBaseVertex == glad_trace_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = glad_trace_next_glDrawElementsBaseVertex;
+	if(glad_glDrawRangeElementsBaseVertex == glad_trace_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = glad_trace_next_glDrawRangeElementsBaseVertex;
+	if(glad_glDrawElementsInstancedBaseVertex == glad_trace_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = glad_trace_next_glDrawElementsInstancedBaseVertex;
+	if(glad_glMultiDrawElementsBaseVertex == glad_trace_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = glad_trace_next_glMultiDrawElementsBaseVertex;
+	if(glad_glProvokingVertex == glad_trace_glProvokingVertex) glad_glProvokingVertex = glad_trace_next_glProvokingVertex;
+	if(glad_glFenceSync == glad_trace_glFenceSync) glad_glFenceSync = glad_trace_next_glFenceSync;
+	if(glad_glIsSync == glad_trace_glIsSync) glad_glIsSync = glad_trace_next_glIsSync;
+	if(glad_glDeleteSync == glad_trace_glDeleteSync) glad_glDeleteSync = glad_trace_next_glDeleteSync;
+	if(glad_glClientWaitSync == glad_trace_glClientWaitSync) glad_glClientWaitSync = glad_trace_next_glClientWaitSync;
+	if(glad_glWaitSync == glad_trace_glWaitSync) glad_glWaitSync = glad_trace_next_glWaitSync;
+	if(glad_glGetInteger64v == glad_trace_glGetInteger64v) glad_glGetInteger64v = glad_trace_next_glGetInteger64v;
+	if(glad_glGetSynciv == glad_trace_glGetSynciv) glad_glGetSynciv = glad_trace_next_glGetSynciv;
+	if(glad_glGetInteger64i_v == glad_trace_glGetInteger64i_v) glad_glGetInteger64i_v = glad_trace_next_glGetInteger64i_v;
+	if(glad_glGetBufferParameteri64v == glad_trace_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = glad_trace_next_glGetBufferParameteri64v;
+	if(glad_glFramebufferTexture == glad_trace_glFramebufferTexture) glad_glFramebufferTexture = glad_trace_next_glFramebufferTexture;
+	if(glad_glTexImage2DMultisample == glad_trace_glTexImage2DMultisample) glad_glTexImage2DMultisample = glad_trace_next_glTexImage2DMultisample;
+	if(glad_glTexImage3DMultisample == glad_trace_glTexImage3DMultisample) glad_glTexImage3DMultisample = glad_trace_next_glTexImage3DMultisample;
+	if(glad_glGetMultisamplefv == glad_trace_glGetMultisamplefv) glad_glGetMultisamplefv = glad_trace_next_glGetMultisamplefv;
+	if(glad_glSampleMaski == glad_trace_glSampleMaski) glad_glSampleMaski = glad_trace_next_glSampleMaski;
+	if(glad_glBindFragDataLocationIndexed == glad_trace_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = glad_trace_next_glBindFragDataLocationIndexed;
+	if(glad_glGetFragDataIndex == glad_trace_glGetFragDataIndex) glad_glGetFragDataIndex = glad_trace_next_glGetFragDataIndex;
+	if(glad_glGenSamplers == glad_trace_glGenSamplers) glad_glGenSamplers = glad_trace_next_glGenSamplers;
+	if(glad_glDeleteSamplers == glad_trace_glDeleteSamplers) glad_glDeleteSamplers = glad_trace_next_glDeleteSamplers;
+	if(glad_glIsSampler == glad_trace_glIsSampler) glad_glIsSampler = glad_trace_next_glIsSampler;
+	if(glad_glBindSampler == glad_trace_glBindSampler) glad_glBindSampler = glad_trace_next_glBindSampler;
+	if(glad_glSamplerParameteri == glad_trace_glSamplerParameteri) glad_glSamplerParameteri = glad_trace_next_glSamplerParameteri;
+	if(glad_glSamplerParameteriv == glad_trace_glSamplerParameteriv) glad_glSamplerParameteriv = glad_trace_next_glSamplerParameteriv;
+	if(glad_glSamplerParameterf == glad_trace_glSamplerParameterf) glad_glSamplerParameterf = glad_trace_next_glSamplerParameterf;
+	if(glad_glSamplerParameterfv == glad_trace_glSamplerParameterfv) glad_glSamplerParameterfv = glad_trace_next_glSamplerParameterfv;
+	if(glad_glSamplerParameterIiv == glad_trace_glSamplerParameterIiv) glad_glSamplerParameterIiv = glad_trace_next_glSamplerParameterIiv;
+	if(glad_glSamplerParameterIuiv == glad_trace_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = glad_trace_next_glSamplerParameterIuiv;
+	if(glad_glGetSamplerParameteriv == glad_trace_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = glad_trace_next_glGetSamplerParameteriv;
+	if(glad_glGetSamplerParameterIiv == glad_trace_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = glad_trace_next_glGetSamplerParameterIiv;
+	if(glad_glGetSamplerParameterfv == glad_trace_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = glad_trace_next_glGetSamplerParameterfv;
+	if(glad_glGetSamplerParameterIuiv == glad_trace_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = glad_trace_next_glGetSamplerParameterIuiv;
+	if(glad_glQueryCounter == glad_trace_glQueryCounter) glad_glQueryCounter = glad_trace_next_glQueryCounter;
+	if(glad_glGetQueryObjecti64v == glad_trace_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = glad_trace_next_glGetQueryObjecti64v;
+	if(glad_glGetQueryObjectui64v == glad_trace_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = glad_trace_next_glGetQueryObjectui64v;
+	if(glad_glVertexAttribDivisor == glad_trace_glVertexAttribDivisor) glad_glVertexAttribDivisor = glad_trace_next_glVertexAttribDivisor;
+	if(glad_glVertexAttribP1ui == glad_trace_glVertexAttribP1ui) glad_glVertexAttribP1ui = glad_trace_next_glVertexAttribP1ui;
+	if(glad_glVertexAttribP1uiv == glad_trace_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = glad_trace_next_glVertexAttribP1uiv;
+	if(glad_glVertexAttribP2ui == glad_trace_glVertexAttribP2ui) glad_glVertexAttribP2ui = glad_trace_next_glVertexAttribP2ui;
+	if(glad_glVertexAttribP2uiv == glad_trace_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = glad_trace_next_glVertexAttribP2uiv;
+	if(glad_glVertexAttribP3ui == glad_trace_glVertexAttribP3ui) glad_glVertexAttribP3ui = glad_trace_next_glVertexAttribP3ui;
+	if(glad_glVertexAttribP3uiv == glad_trace_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = glad_trace_next_glVertexAttribP3uiv;
+	if(glad_glVertexAttribP4ui == glad_trace_glVertexAttribP4ui) glad_glVertexAttribP4ui = glad_trace_next_glVertexAttribP4ui;
+	if(glad_glVertexAttribP4uiv == glad_trace_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = glad_trace_next_glVertexAttribP4uiv;
+	if(glad_glVertexP2ui == glad_trace_glVertexP2ui) glad_glVertexP2ui = glad_trace_next_glVertexP2ui;
+	if(glad_glVertexP2uiv == glad_trace_glVertexP2uiv) glad_glVertexP2uiv = glad_trace_next_glVertexP2uiv;
+	if(glad_glVertexP3ui == glad_trace_glVertexP3ui) glad_glVertexP3ui = glad_trace_next_glVertexP3ui;
+	if(glad_glVertexP3uiv == glad_trace_glVertexP3uiv) glad_glVertexP3uiv = glad_trace_next_glVertexP3uiv;
+	if(glad_glVertexP4ui == glad_trace_glVertexP4ui) glad_glVertexP4ui = glad_trace_next_glVertexP4ui;
+	if(glad_glVertexP4uiv == glad_trace_glVertexP4uiv) glad_glVertexP4uiv = glad_trace_next_glVertexP4uiv;
+	if(glad_glTexCoordP1ui == glad_trace_glTexCoordP1ui) glad_glTexCoordP1ui = glad_trace_next_glTexCoordP1ui;
+	if(glad_glTexCoordP1uiv == glad_trace_glTexCoordP1uiv) glad_glTexCoordP1uiv = glad_trace_next_glTexCoordP1uiv;
+	if(glad_glTexCoordP2ui == glad_trace_glTexCoordP2ui) glad_glTexCoordP2ui = glad_trace_next_glTexCoordP2ui;
+	if(glad_glTexCoordP2uiv == glad_trace_glTexCoordP2uiv) glad_glTexCoordP2uiv = glad_trace_next_glTexCoordP2uiv;
+	if(glad_glTexCoordP3ui == glad_trace_glTexCoordP3ui) glad_glTexCoordP3ui = glad_trace_next_glTexCoordP3ui;
+	if(glad_glTexCoordP3uiv == glad_trace_glTexCoordP3uiv) glad_glTexCoordP3uiv = glad_trace_next_glTexCoordP3uiv;
+	if(glad_glTexCoordP4ui == glad_trace_glTexCoordP4ui) glad_glTexCoordP4ui = glad_trace_next_glTexCoordP4ui;
+	if(glad_glTexCoordP4uiv == glad_trace_glTexCoordP4uiv) glad_glTexCoordP4uiv = glad_trace_next_glTexCoordP4uiv;
+	if(glad_glMultiTexCoordP1ui == glad_trace_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = glad_trace_next_glMultiTexCoordP1ui;
+	if(glad_glMultiTexCoordP1uiv == glad_trace_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = glad_trace_next_glMultiTexCoordP1uiv;
+	if(glad_glMultiTexCoordP2ui == glad_trace_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = glad_trace_next_glMultiTexCoordP2ui;
+	if(glad_glMultiTexCoordP2uiv == glad_trace_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = glad_trace_next_glMultiTexCoordP2uiv;
+	if(glad_glMultiTexCoordP3ui == glad_trace_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = glad_trace_next_glMultiTexCoordP3ui;
+	if(glad_glMultiTexCoordP3uiv == glad_trace_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = glad_trace_next_glMultiTexCoordP3uiv;
+	if(glad_glMultiTexCoordP4ui == glad_trace_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = glad_trace_next_glMultiTexCoordP4ui;
+	if(glad_glMultiTexCoordP4uiv == glad_trace_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = glad_trace_next_glMultiTexCoordP4uiv;
+	if(glad_glNormalP3ui == glad_trace_glNormalP3ui) glad_glNormalP3ui = glad_trace_next_glNormalP3ui;
+	if(glad_glNormalP3uiv == glad_trace_glNormalP3uiv) glad_glNormalP3uiv = glad_trace_next_glNormalP3uiv;
+	if(glad_glColorP3ui == glad_trace_glColorP3ui) glad_glColorP3ui = glad_trace_next_glColorP3ui;
+	if(glad_glColorP3uiv == glad_trace_glColorP3uiv) glad_glColorP3uiv = glad_trace_next_glColorP3uiv;
+	if(glad_glColorP4ui == glad_trace_glColorP4ui) glad_glColorP4ui = glad_trace_next_glColorP4ui;
+	if(glad_glColorP4uiv == glad_trace_glColorP4uiv) glad_glColorP4uiv = glad_trace_next_glColorP4uiv;
+	if(glad_glSecondaryColorP3ui == glad_trace_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = glad_trace_next_glSecondaryColorP3ui;
+	if(glad_glSecondaryColorP3uiv == glad_trace_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = glad_trace_next_glSecondaryColorP3uiv;
+	if(glad_glBufferStorage == glad_trace_glBufferStorage) glad_glBufferStorage = glad_trace_next_glBufferStorage;
+	if(glad_glDrawArraysIndirect == glad_trace_glDrawArraysIndirect) glad_glDrawArraysIndirect = glad_trace_next_glDrawArraysIndirect;
+	if(glad_glDrawElementsIndirect == glad_trace_glDrawElementsIndirect) glad_glDrawElementsIndirect = glad_trace_next_glDrawElementsIndirect;
+	if(glad_glGetProgramBinary == glad_trace_glGetProgramBinary) glad_glGetProgramBinary = glad_trace_next_glGetProgramBinary;
+	if(glad_glProgramBinary == glad_trace_glProgramBinary) glad_glProgramBinary = glad_trace_next_glProgramBinary;
+	if(glad_glProgramParameteri == glad_trace_glProgramParameteri) glad_glProgramParameteri = glad_trace_next_glProgramParameteri;
+	if(glad_glMultiDrawArraysIndirect == glad_trace_glMultiDrawArraysIndirect) glad_glMultiDrawArraysIndirect = glad_trace_next_glMultiDrawArraysIndirect;
+	if(glad_glMultiDrawElementsIndirect == glad_trace_glMultiDrawElementsIndirect) glad_glMultiDrawElementsIndirect = glad_trace_next_glMultiDrawElementsIndirect;
+	if(glad_glDebugMessageControl == glad_trace_glDebugMessageControl) glad_glDebugMessageControl = glad_trace_next_glDebugMessageControl;
+	if(glad_glDebugMessageInsert == glad_trace_glDebugMessageInsert) glad_glDebugMessageInsert = glad_trace_next_glDebugMessageInsert;
+	if(glad_glDebugMessageCallback == glad_trace_glDebugMessageCallback) glad_glDebugMessageCallback = glad_trace_next_glDebugMessageCallback;
+	if(glad_glGetDebugMessageLog == glad_trace_glGetDebugMessageLog) glad_glGetDebugMessageLog = glad_trace_next_glGetDebugMessageLog;
+	if(glad_glPushDebugGroup == glad_trace_glPushDebugGroup) glad_glPushDebugGroup = glad_trace_next_glPushDebugGroup;
+	if(glad_glPopDebugGroup == glad_trace_glPopDebugGroup) glad_glPopDebugGroup = glad_trace_next_glPopDebugGroup;
+	if(glad_glObjectLabel == glad_trace_glObjectLabel) glad_glObjectLabel = glad_trace_next_glObjectLabel;
+	if(glad_glGetObjectLabel == glad_trace_glGetObjectLabel) glad_glGetObjectLabel = glad_trace_next_glGetObjectLabel;
+	if(glad_glObjectPtrLabel == glad_trace_glObjectPtrLabel) glad_glObjectPtrLabel = glad_trace_next_glObjectPtrLabel;
+	if(glad_glGetObjectPtrLabel == glad_trace_glGetObjectPtrLabel) glad_glGetObjectPtrLabel = glad_trace_next_glGetObjectPtrLabel;
+}
+/* ---- end of generated trace layer ---- */
+
+void gladInstallTrace(GLADtraceproc pre, GLADtraceproc post, void *user) {
+	glad_trace_pre_callback = pre;
+	glad_trace_post_callback = post;
+	glad_trace_user = user;
+	glad_trace_wrap();
+}
+
+void gladUninstallTrace(void) {
+	glad_trace_unwrap();
+	glad_trace_pre_callback = NULL;
+	glad_trace_post_callback = NULL;
+	glad_trace_user = NULL;
+}
+
+unsigned int gladTraceFunctionCount(void) {
+	return (unsigned int)(sizeof(glad_trace_names) / sizeof(glad_trace_names[0]));
+}
+
+const char* gladTraceFunctionName(unsigned int function) {
+	return function < gladTraceFunctionCount() ? glad_trace_names[function] : NULL;
+}
@@ -0,0 +1,106 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <atomic>
+#include <cstddef>
+
+// Counts heap allocations made through operator new, on every thread, to check that a loop
+// doesn't allocate once it has warmed up. Only C++ allocations are seen: malloc calls (the GL
+// driver, GLFW) go straight to libc.
+//
+// The counting replacements of the global operator new/delete are compiled into the one
+// translation unit that defines ALLOC_COUNTER_IMPLEMENTATION before including this header:
+//
+//   #define ALLOC_COUNTER_IMPLEMENTATION
+//   #include <core/alloc_counter.h>
+//   ...
+//   unsigned long long before = AllocCounter::allocations();
+//   for (...) frame();
+//   std::cout << AllocCounter::allocations() - before << " allocations\n";
+class AllocCounter
+{
+public:
+    // false when no translation unit defines ALLOC_COUNTER_IMPLEMENTATION (the counts stay 0)
+    static bool installed()
+    {
+        return state().installed.load(std::memory_order_relaxed);
+    }
+    static unsigned long long allocations()
+    {
+        return state().allocations.load(std::memory_order_relaxed);
+    }
+    static unsigned long long bytes()
+    {
+        return state().bytes.load(std::memory_order_relaxed);
+    }
+
+    static void record(size_t size)
+    {
+        state().allocations.fetch_add(1, std::memory_order_relaxed);
+        state().bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    static bool install()
+    {
+        state().installed.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    struct State
+    {
+        std::atomic<unsigned long long> allocations{0};
+        std::atomic<unsigned long long> bytes{0};
+        std::atomic<bool> installed{false};
+    };
+    // constant-initialised, so it works for allocations made before main() too
+    static State &state()
+    {
+        static State counters;
+        return counters;
+    }
+};
+
+#ifdef ALLOC_COUNTER_IMPLEMENTATION
+#include <cstdlib>
+#include <new>
+
+static const bool allocCounterInstalled = AllocCounter::install();
+
+static void *allocCounterAllocate(size_t size, size_t alignment, bool nothrow)
+{
+    AllocCounter::record(size);
+    if (size == 0)
+        size = 1;
+    void *memory;
+    if (alignment > alignof(std::max_align_t))
+        memory = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+    else
+        memory = std::malloc(size);
+    if (memory == nullptr && !nothrow)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new(size_t size) { return allocCounterAllocate(size, 0, false); }
+void *operator new[](size_t size) { return allocCounterAllocate(size, 0, false); }
+void *operator new(size_t size, const std::nothrow_t&) noexcept { return allocCounterAllocate(size, 0, true); }
+void *operator new[](size_t size, const std::nothrow_t&) noexcept { return allocCounterAllocate(size, 0, true); }
+void *operator new(size_t size, std::align_val_t alignment) { return allocCounterAllocate(size, (size_t)alignment, false); }
+void *operator new[](size_t size, std::align_val_t alignment) { return allocCounterAllocate(size, (size_t)alignment, false); }
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocCounterAllocate(size, (size_t)alignment, true); }
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocCounterAllocate(size, (size_t)alignment, true); }
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void *memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t&) noexcept { std::free(memory); }
+#endif
+#endif
@@ -0,0 +1,57 @@
+#ifndef ARENA_ALLOCATOR_H
+#define ARENA_ALLOCATOR_H
+
+#include <core/linear_arena.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// STL allocator over a LinearArena: containers built with it take their memory from the arena
+// and deallocate() does nothing, it all goes away on the arena's reset(). A growing vector
+// leaves its old buffers behind until then, so reserve() what you can.
+//
+//   ArenaVector<DrawItem> items{ ArenaAllocator<DrawItem>(arena) };
+//   ArenaString name("material.diffuse", ArenaAllocator<char>(arena));
+template <typename T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    explicit ArenaAllocator(LinearArena &arena)
+        : arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other)
+        : arena(other.arena) {}
+
+    T *allocate(size_t count)
+    {
+        return arena->allocateArray<T>(count);
+    }
+    void deallocate(T*, size_t)
+    {
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const
+    {
+        return arena == other.arena;
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const
+    {
+        return arena != other.arena;
+    }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    LinearArena *arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>> ArenaString;
+#endif
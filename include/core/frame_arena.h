@@ -0,0 +1,127 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <core/arena_allocator.h>
+#include <core/linear_arena.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+// Memory for data that lives exactly one frame: draw lists, uniform values, formatted names.
+// One LinearArena per frame in flight; nextFrame() moves on to the next arena and rewinds it,
+// so an allocation stays valid until nextFrame() has been called frames() more times.
+//
+// Call nextFrame() once per frame, at the point the oldest frame is known to be finished:
+// right after glfwSwapBuffers in a single-threaded loop (frames = 1 would do there, keep 2 to
+// read last frame's data), right after RenderThread::beginFrame() when the render thread reads
+// what the main thread allocated (frames = 2, its frame data is double-buffered). Once every
+// arena has seen its peak frame, nothing in here touches the heap again.
+//
+//   FrameArena frameArena;
+//   ArenaVector<DrawItem> items = frameArena.vector<DrawItem>(objectCount);
+//   shader.setFloat(frameArena.format("lights[%d].intensity", i), light.intensity);
+//   ...swap...
+//   frameArena.nextFrame();
+class FrameArena
+{
+public:
+    explicit FrameArena(unsigned frames = 2, size_t chunkSize = 256 * 1024)
+    {
+        for (unsigned i = 0; i < (frames ? frames : 1); i++)
+            arenas.emplace_back(new LinearArena(chunkSize));
+    }
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // this frame's arena
+    // ------------------------------------------------------------------------
+    LinearArena &arena()
+    {
+        return *arenas[current];
+    }
+    void *allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        return arena().allocate(size, alignment);
+    }
+    template <typename T>
+    T *allocateArray(size_t count)
+    {
+        return arena().allocateArray<T>(count);
+    }
+    template <typename T>
+    ArenaAllocator<T> allocator()
+    {
+        return ArenaAllocator<T>(arena());
+    }
+    // an empty vector with room for reserve elements
+    template <typename T>
+    ArenaVector<T> vector(size_t reserve = 0)
+    {
+        ArenaVector<T> result{ ArenaAllocator<T>(arena()) };
+        result.reserve(reserve);
+        return result;
+    }
+    // printf into the arena, e.g. a uniform name
+    // ------------------------------------------------------------------------
+    const char *format(const char *pattern, ...)
+    {
+        va_list args;
+        va_start(args, pattern);
+        va_list copy;
+        va_copy(copy, args);
+        int length = std::vsnprintf(nullptr, 0, pattern, copy);
+        va_end(copy);
+        char *text = (char*)allocate(length > 0 ? (size_t)length + 1 : 1, 1);
+        if (length > 0)
+            std::vsnprintf(text, (size_t)length + 1, pattern, args);
+        else
+            text[0] = '\0';
+        va_end(args);
+        return text;
+    }
+
+    // start the next frame: its arena is rewound, the others keep their data
+    // ------------------------------------------------------------------------
+    void nextFrame()
+    {
+        current = (current + 1) % arenas.size();
+        arenas[current]->reset();
+        frameIndex++;
+    }
+    unsigned frames() const
+    {
+        return (unsigned)arenas.size();
+    }
+    unsigned long long frame() const
+    {
+        return frameIndex;
+    }
+    // bytes allocated this frame
+    size_t used() const
+    {
+        return arenas[current]->used();
+    }
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for (const std::unique_ptr<LinearArena> &arena : arenas)
+            total += arena->capacity();
+        return total;
+    }
+    // heap allocations made by all arenas so far; flat once the frame size is steady
+    size_t chunkCount() const
+    {
+        size_t total = 0;
+        for (const std::unique_ptr<LinearArena> &arena : arenas)
+            total += arena->chunkCount();
+        return total;
+    }
+
+private:
+    std::vector<std::unique_ptr<LinearArena>> arenas;
+    size_t current = 0;
+    unsigned long long frameIndex = 0;
+};
+#endif
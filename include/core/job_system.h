@@ -0,0 +1,384 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <core/work_stealing_deque.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing job scheduler. Every thread (the one that created the JobSystem is thread 0,
+// the workers are 1..threadCount()-1) has a Chase-Lev deque and a ring of preallocated jobs,
+// so creating and running a job never locks or allocates. Idle threads steal from random
+// victims and, after a short spin, sleep until new work is pushed.
+//
+// Dependencies without fibers: a job created with createChild() keeps its parent unfinished
+// until it completes, and continuations added with addContinuation() are scheduled when their
+// ancestor (including all of its children) finishes. wait() runs other jobs while it waits.
+//
+//   JobSystem jobs;                                   // hardware_concurrency() threads
+//   JobSystem::Job *frame = jobs.create(nullptr);     // an empty root to hang a frame's work on
+//   for (...) jobs.run(jobs.createChild(frame, &cullJob, &args, sizeof(args)));
+//   jobs.run(frame);
+//   jobs.wait(frame);
+//   jobs.parallelFor(0, count, 256, [&](size_t begin, size_t end) { ... });
+//
+// A job's slot is recycled after jobsPerThread (a power of two) more jobs were created on the
+// same thread, so no more than that may be pending per thread. Create, run and wait from the
+// creating thread or from inside jobs only.
+class JobSystem
+{
+public:
+    struct Job;
+    typedef void (*JobFunction)(JobSystem &jobs, Job *job);
+
+    static constexpr size_t JOB_DATA_SIZE = 24;
+    static constexpr int MAX_CONTINUATIONS = 2;
+
+    struct alignas(64) Job
+    {
+        JobFunction function;
+        Job *parent;
+        std::atomic<int32_t> unfinished; // itself plus its unfinished children
+        std::atomic<int32_t> continuationCount;
+        Job *continuations[MAX_CONTINUATIONS];
+        unsigned char data[JOB_DATA_SIZE];
+
+        template <typename T>
+        const T &dataAs() const
+        {
+            static_assert(sizeof(T) <= JOB_DATA_SIZE, "job data too large");
+            return *(const T*)data;
+        }
+    };
+    static_assert(sizeof(Job) == 64, "a job should fill exactly one cache line");
+
+    struct Stats
+    {
+        unsigned long long executed = 0;
+        unsigned long long stolen = 0;
+    };
+
+    // threads = 0 uses std::thread::hardware_concurrency(); the calling thread counts as one
+    // ------------------------------------------------------------------------
+    explicit JobSystem(unsigned threads = 0, size_t jobsPerThread = 1 << 16)
+    {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < threads; i++)
+            workers.push_back(new Worker(jobsPerThread, i));
+        bind(0);
+        for (unsigned i = 1; i < threads; i++)
+            workers[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+    }
+    ~JobSystem()
+    {
+        quit.store(true);
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wake.notify_all();
+        // every thread stopped before any deque goes: a running worker may still steal from any of them
+        for (Worker *worker : workers)
+            if (worker->thread.joinable())
+                worker->thread.join();
+        for (Worker *worker : workers)
+            delete worker;
+        if (current().owner == this)
+            current().owner = nullptr;
+    }
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned threadCount() const
+    {
+        return (unsigned)workers.size();
+    }
+    // 0 for the creating thread, 1.. for workers; use it to index per-thread data (command buffers)
+    unsigned threadIndex() const
+    {
+        return current().owner == this ? current().index : 0;
+    }
+
+    // creating jobs: data is copied into the job; more than JOB_DATA_SIZE bytes is a hard error
+    // ------------------------------------------------------------------------
+    Job *create(JobFunction function, const void *data = nullptr, size_t size = 0)
+    {
+        return allocate(function, nullptr, data, size);
+    }
+    Job *createChild(Job *parent, JobFunction function, const void *data = nullptr, size_t size = 0)
+    {
+        parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+        return allocate(function, parent, data, size);
+    }
+    // continuation runs once ancestor and its children are done; add before running ancestor
+    // ------------------------------------------------------------------------
+    bool addContinuation(Job *ancestor, Job *continuation)
+    {
+        int32_t slot = ancestor->continuationCount.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= MAX_CONTINUATIONS)
+        {
+            ancestor->continuationCount.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        ancestor->continuations[slot] = continuation;
+        return true;
+    }
+
+    // schedule on this thread's deque (runs inline if the deque is full)
+    // ------------------------------------------------------------------------
+    void run(Job *job)
+    {
+        Worker &worker = self();
+        if (!worker.deque.push(job))
+        {
+            execute(job, worker);
+            return;
+        }
+        if (sleepers.load(std::memory_order_relaxed) > 0)
+            wake.notify_one();
+    }
+    // help with other jobs until job has finished
+    // ------------------------------------------------------------------------
+    void wait(const Job *job)
+    {
+        Worker &worker = self();
+        while (job->unfinished.load(std::memory_order_acquire) > 0)
+        {
+            Job *next = find(worker);
+            if (next)
+                execute(next, worker);
+            else
+                std::this_thread::yield();
+        }
+    }
+    void runAndWait(Job *job)
+    {
+        run(job);
+        wait(job);
+    }
+
+    // f(begin, end) over [begin, end) in pieces of at most grain, split recursively so idle
+    // threads steal large halves first
+    // ------------------------------------------------------------------------
+    template <typename F>
+    void parallelFor(size_t begin, size_t end, size_t grain, const F &f)
+    {
+        if (begin >= end)
+            return;
+        RangeContext context = { &f, grain ? grain : 1, &invokeRange<F> };
+        Range range = { &context, begin, end };
+        Job *root = create(&rangeJob, &range, sizeof(range));
+        runAndWait(root);
+    }
+
+    Stats stats() const
+    {
+        Stats total;
+        for (const Worker *worker : workers)
+        {
+            total.executed += worker->executed;
+            total.stolen += worker->stolen;
+        }
+        return total;
+    }
+    void resetStats()
+    {
+        for (Worker *worker : workers)
+            worker->executed = worker->stolen = 0;
+    }
+
+private:
+    struct Worker
+    {
+        WorkStealingDeque<Job> deque;
+        std::vector<Job> pool;
+        size_t allocated = 0;
+        uint32_t random;
+        unsigned long long executed = 0;
+        unsigned long long stolen = 0;
+        std::thread thread;
+
+        Worker(size_t jobs, unsigned index)
+            : deque(jobs), pool(jobs), random(0x9E3779B9u * (index + 1))
+        {
+            for (Job &job : pool)
+                job.unfinished.store(0, std::memory_order_relaxed);
+        }
+    };
+    struct ThreadBinding
+    {
+        JobSystem *owner = nullptr;
+        unsigned index = 0;
+    };
+    struct RangeContext
+    {
+        const void *function;
+        size_t grain;
+        void (*invoke)(const void *function, size_t begin, size_t end);
+    };
+    struct Range
+    {
+        const RangeContext *context;
+        size_t begin;
+        size_t end;
+    };
+
+    static ThreadBinding &current()
+    {
+        static thread_local ThreadBinding binding;
+        return binding;
+    }
+    void bind(unsigned index)
+    {
+        current().owner = this;
+        current().index = index;
+    }
+    Worker &self()
+    {
+        return *workers[threadIndex()];
+    }
+
+    Job *allocate(JobFunction function, Job *parent, const void *data, size_t size)
+    {
+        if (size > JOB_DATA_SIZE)
+        {
+            std::cout << "ERROR::JOB_SYSTEM::DATA_TOO_LARGE " << size << " > " << JOB_DATA_SIZE << " bytes" << std::endl;
+            std::abort();
+        }
+        Worker &worker = self();
+        Job *job = &worker.pool[worker.allocated++ & (worker.pool.size() - 1)];
+        // the slot's previous job must be done before it can be reused
+        while (job->unfinished.load(std::memory_order_acquire) > 0)
+        {
+            Job *next = find(worker);
+            if (next)
+                execute(next, worker);
+            else
+                std::this_thread::yield();
+        }
+        job->function = function;
+        job->parent = parent;
+        job->continuationCount.store(0, std::memory_order_relaxed);
+        if (size)
+            std::memcpy(job->data, data, size);
+        job->unfinished.store(1, std::memory_order_release);
+        return job;
+    }
+
+    // own deque first, then steal starting at a random victim
+    // ------------------------------------------------------------------------
+    Job *find(Worker &worker)
+    {
+        Job *job = worker.deque.pop();
+        if (job)
+            return job;
+        size_t count = workers.size();
+        if (count < 2)
+            return nullptr;
+        worker.random ^= worker.random << 13;
+        worker.random ^= worker.random >> 17;
+        worker.random ^= worker.random << 5;
+        size_t start = worker.random % count;
+        for (size_t i = 0; i < count; i++)
+        {
+            Worker *victim = workers[(start + i) % count];
+            if (victim == &worker)
+                continue;
+            job = victim->deque.steal();
+            if (job)
+            {
+                worker.stolen++;
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void execute(Job *job, Worker &worker)
+    {
+        if (job->function)
+            job->function(*this, job);
+        worker.executed++;
+        finish(job);
+    }
+    // everything needed after the last decrement is read before it: once unfinished reaches 0
+    // the owning thread may recycle the slot and overwrite the job
+    // ------------------------------------------------------------------------
+    void finish(Job *job)
+    {
+        Job *parent = job->parent;
+        Job *continuations[MAX_CONTINUATIONS];
+        int32_t continuationCount = std::min<int32_t>(job->continuationCount.load(std::memory_order_acquire), MAX_CONTINUATIONS);
+        for (int32_t i = 0; i < continuationCount; i++)
+            continuations[i] = job->continuations[i];
+        if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+        for (int32_t i = 0; i < continuationCount; i++)
+            run(continuations[i]);
+        if (parent)
+            finish(parent);
+    }
+
+    void workerLoop(unsigned index)
+    {
+        bind(index);
+        Worker &worker = *workers[index];
+        int idle = 0;
+        while (!quit.load(std::memory_order_relaxed))
+        {
+            Job *job = find(worker);
+            if (job)
+            {
+                execute(job, worker);
+                idle = 0;
+                continue;
+            }
+            if (++idle < 64)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            // the timeout covers a push that races with going to sleep
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepers.fetch_add(1, std::memory_order_relaxed);
+            wake.wait_for(lock, std::chrono::milliseconds(1));
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            idle = 0;
+        }
+    }
+
+    template <typename F>
+    static void invokeRange(const void *function, size_t begin, size_t end)
+    {
+        (*(const F*)function)(begin, end);
+    }
+    static void rangeJob(JobSystem &jobs, Job *job)
+    {
+        Range range = job->dataAs<Range>();
+        // split off the upper half until the piece left is small enough to run here
+        while (range.end - range.begin > range.context->grain)
+        {
+            size_t middle = range.begin + (range.end - range.begin) / 2;
+            Range upper = { range.context, middle, range.end };
+            jobs.run(jobs.createChild(job, &rangeJob, &upper, sizeof(upper)));
+            range.end = middle;
+        }
+        range.context->invoke(range.context->function, range.begin, range.end);
+    }
+
+    std::vector<Worker*> workers;
+    std::atomic<bool> quit{false};
+    std::atomic<int> sleepers{0};
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+};
+#endif
@@ -0,0 +1,111 @@
+#ifndef LINEAR_ARENA_H
+#define LINEAR_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Bump allocator over a list of chunks. allocate() is a pointer increment; nothing is freed
+// individually, reset() rewinds to the first chunk and keeps every chunk for reuse, so once
+// an arena has seen its peak usage it never touches the heap again. Not thread-safe: give
+// each thread its own arena.
+class LinearArena
+{
+public:
+    explicit LinearArena(size_t chunkSize = 64 * 1024)
+        : chunkSize(chunkSize) {}
+    ~LinearArena()
+    {
+        for (Chunk &chunk : chunks)
+            std::free(chunk.data);
+    }
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    // alignment must be a power of two
+    // ------------------------------------------------------------------------
+    void *allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        if (current < chunks.size())
+        {
+            Chunk &chunk = chunks[current];
+            size_t start = (offset + alignment - 1) & ~(alignment - 1);
+            if (start + size <= chunk.size)
+            {
+                offset = start + size;
+                usedBytes += size;
+                return chunk.data + start;
+            }
+        }
+        return allocateSlow(size, alignment);
+    }
+    template <typename T>
+    T *allocateArray(size_t count)
+    {
+        return (T*)allocate(sizeof(T) * count, alignof(T));
+    }
+
+    // forget every allocation, keep the memory
+    // ------------------------------------------------------------------------
+    void reset()
+    {
+        current = 0;
+        offset = 0;
+        usedBytes = 0;
+    }
+    size_t used() const
+    {
+        return usedBytes;
+    }
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for (const Chunk &chunk : chunks)
+            total += chunk.size;
+        return total;
+    }
+    // heap allocations made so far (chunks); stays flat in a steady state
+    size_t chunkCount() const
+    {
+        return chunks.size();
+    }
+
+private:
+    struct Chunk
+    {
+        char *data;
+        size_t size;
+    };
+
+    // move on to the next chunk that fits, inserting a new one if none does
+    // ------------------------------------------------------------------------
+    void *allocateSlow(size_t size, size_t alignment)
+    {
+        size_t next = current < chunks.size() ? current + 1 : chunks.size();
+        if (current >= chunks.size())
+            next = 0;
+        while (next < chunks.size() && chunks[next].size < size + alignment)
+            next++;
+        if (next >= chunks.size())
+        {
+            size_t bytes = size + alignment > chunkSize ? size + alignment : chunkSize;
+            char *data = (char*)std::malloc(bytes);
+            if (data == nullptr)
+                throw std::bad_alloc();
+            next = current < chunks.size() ? current + 1 : chunks.size();
+            chunks.insert(chunks.begin() + next, Chunk{ data, bytes });
+        }
+        current = next;
+        offset = 0;
+        return allocate(size, alignment);
+    }
+
+    size_t chunkSize;
+    std::vector<Chunk> chunks;
+    size_t current = 0;
+    size_t offset = 0;
+    size_t usedBytes = 0;
+};
+#endif
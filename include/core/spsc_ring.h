@@ -0,0 +1,69 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+
+// Bounded single-producer / single-consumer queue. One thread calls push(), one other thread
+// calls pop(); neither ever blocks or takes a lock. head and tail live on separate cache
+// lines, and each side keeps a cached copy of the other's index so the common case touches
+// only its own line.
+template <typename T, size_t CAPACITY>
+class SpscRing
+{
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    // producer: false when the ring is full
+    // ------------------------------------------------------------------------
+    bool push(const T &item)
+    {
+        size_t head = producer.head.load(std::memory_order_relaxed);
+        if (head - producer.tailCache == CAPACITY)
+        {
+            producer.tailCache = consumer.tail.load(std::memory_order_acquire);
+            if (head - producer.tailCache == CAPACITY)
+                return false;
+        }
+        items[head & (CAPACITY - 1)] = item;
+        producer.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+    // consumer: false when the ring is empty
+    // ------------------------------------------------------------------------
+    bool pop(T &item)
+    {
+        size_t tail = consumer.tail.load(std::memory_order_relaxed);
+        if (tail == consumer.headCache)
+        {
+            consumer.headCache = producer.head.load(std::memory_order_acquire);
+            if (tail == consumer.headCache)
+                return false;
+        }
+        item = items[tail & (CAPACITY - 1)];
+        consumer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    // approximate when called from a third thread
+    size_t size() const
+    {
+        return producer.head.load(std::memory_order_acquire) - consumer.tail.load(std::memory_order_acquire);
+    }
+
+private:
+    struct alignas(64) Producer
+    {
+        std::atomic<size_t> head{0};
+        size_t tailCache = 0;
+    };
+    struct alignas(64) Consumer
+    {
+        std::atomic<size_t> tail{0};
+        size_t headCache = 0;
+    };
+
+    Producer producer;
+    Consumer consumer;
+    T items[CAPACITY];
+};
+#endif
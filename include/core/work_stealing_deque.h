@@ -0,0 +1,90 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Bounded Chase-Lev deque (the C11 formulation by Le, Pop, Cohen and Zappa Nardelli, 2013).
+// The owning thread push()es and pop()s at the bottom, LIFO, which keeps its working set
+// hot; any other thread steal()s from the top, FIFO, taking the oldest - usually largest -
+// piece of work. Only the last remaining item is contended.
+template <typename T>
+class WorkStealingDeque
+{
+public:
+    explicit WorkStealingDeque(size_t capacity = 4096)
+        : mask(capacity - 1), items(new std::atomic<T*>[capacity])
+    {
+    }
+    ~WorkStealingDeque()
+    {
+        delete[] items;
+    }
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // owner only; false when full (capacity must be a power of two)
+    // ------------------------------------------------------------------------
+    bool push(T *item)
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t > (int64_t)mask)
+            return false;
+        items[b & mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+    // owner only; nullptr when empty or a thief took the last item
+    // ------------------------------------------------------------------------
+    T *pop()
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T *item = items[b & mask].load(std::memory_order_relaxed);
+        if (t == b)
+        {
+            // last item: race the thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                item = nullptr;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+    // any thread; nullptr when empty or on losing a race
+    // ------------------------------------------------------------------------
+    T *steal()
+    {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return nullptr;
+        T *item = items[t & mask].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return item;
+    }
+    // approximate
+    size_t size() const
+    {
+        int64_t b = bottom.load(std::memory_order_relaxed), t = top.load(std::memory_order_relaxed);
+        return b > t ? (size_t)(b - t) : 0;
+    }
+
+private:
+    size_t mask;
+    std::atomic<T*> *items;
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+};
+#endif
@@ -0,0 +1,244 @@
+#ifndef MATH_BATCH_H
+#define MATH_BATCH_H
+
+#include <math/matrix.h>
+
+#include <cstddef>
+
+// One matrix applied to many points stored as structure of arrays (x, y and z each in their
+// own array), and many matrix products, for the loops where per-call overhead and shuffles
+// would dominate. Each runs 8 at a time with AVX2 when the CPU has it, 4 at a time with SSE or
+// NEON otherwise, and finishes the remainder in scalar code; all paths give the same results
+// (the products summed in the same order), and path picks one, for comparisons.
+//
+//   math::transformPoints(model, x, y, z, worldX, worldY, worldZ, count);
+//   math::multiply(parentWorld, locals, worlds, count);   // worlds[i] = parentWorld * locals[i]
+namespace math
+{
+enum BatchPath
+{
+    BATCH_SCALAR,
+    BATCH_SIMD4,    // SSE or NEON
+    BATCH_AVX2,
+    BATCH_BEST
+};
+
+inline bool batchSupported(BatchPath path)
+{
+    if (path == BATCH_SIMD4)
+    {
+#ifdef MATH_SIMD4
+        return true;
+#else
+        return false;
+#endif
+    }
+    if (path == BATCH_AVX2)
+    {
+#ifdef MATH_AVX2
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+#else
+        return false;
+#endif
+    }
+    return true;
+}
+
+namespace batch
+{
+// the path to run: the one asked for, or the best supported below it
+inline BatchPath choose(BatchPath path)
+{
+    if (path >= BATCH_AVX2 && batchSupported(BATCH_AVX2))
+        return BATCH_AVX2;
+    if (path >= BATCH_SIMD4 && batchSupported(BATCH_SIMD4))
+        return BATCH_SIMD4;
+    return BATCH_SCALAR;
+}
+
+// points [begin, end): out = m * (p, w), w 1 for points and 0 for vectors (whose translation
+// terms are then skipped)
+inline void transformScalar(const mat4 &m, float w, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        float px = x[i], py = y[i], pz = z[i];
+        float rx = m[0].x * px + m[1].x * py + m[2].x * pz, ry = m[0].y * px + m[1].y * py + m[2].y * pz, rz = m[0].z * px + m[1].z * py + m[2].z * pz;
+        if (w != 0.0f)
+        {
+            rx = rx + m[3].x;
+            ry = ry + m[3].y;
+            rz = rz + m[3].z;
+        }
+        outX[i] = rx;
+        outY[i] = ry;
+        outZ[i] = rz;
+    }
+}
+#ifdef MATH_SIMD4
+inline size_t transformSimd4(const mat4 &m, float w, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count)
+{
+    simd::float4 e[12];
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 3; r++)
+            e[c * 3 + r] = simd::splat(m[c][r]);
+    size_t end = count & ~(size_t)3;
+    for (size_t i = 0; i < end; i += 4)
+    {
+        simd::float4 px = simd::load(x + i), py = simd::load(y + i), pz = simd::load(z + i);
+        simd::float4 r[3];
+        for (int row = 0; row < 3; row++)
+        {
+            r[row] = simd::add(simd::add(simd::mul(e[row], px), simd::mul(e[3 + row], py)), simd::mul(e[6 + row], pz));
+            if (w != 0.0f)
+                r[row] = simd::add(r[row], e[9 + row]);
+        }
+        simd::store(outX + i, r[0]);
+        simd::store(outY + i, r[1]);
+        simd::store(outZ + i, r[2]);
+    }
+    return end;
+}
+#endif
+#ifdef MATH_AVX2
+__attribute__((target("avx2")))
+inline size_t transformAvx2(const mat4 &m, float w, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count)
+{
+    __m256 e[12];
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 3; r++)
+            e[c * 3 + r] = _mm256_set1_ps(m[c][r]);
+    size_t end = count & ~(size_t)7;
+    for (size_t i = 0; i < end; i += 8)
+    {
+        __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i), pz = _mm256_loadu_ps(z + i);
+        __m256 r[3];
+        for (int row = 0; row < 3; row++)
+        {
+            r[row] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[row], px), _mm256_mul_ps(e[3 + row], py)), _mm256_mul_ps(e[6 + row], pz));
+            if (w != 0.0f)
+                r[row] = _mm256_add_ps(r[row], e[9 + row]);
+        }
+        _mm256_storeu_ps(outX + i, r[0]);
+        _mm256_storeu_ps(outY + i, r[1]);
+        _mm256_storeu_ps(outZ + i, r[2]);
+    }
+    return end;
+}
+#endif
+
+inline void transform(const mat4 &m, float w, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count, BatchPath path)
+{
+    size_t done = 0;
+    path = choose(path);
+#ifdef MATH_AVX2
+    if (path == BATCH_AVX2)
+        done = transformAvx2(m, w, x, y, z, outX, outY, outZ, count);
+#endif
+#ifdef MATH_SIMD4
+    if (path == BATCH_SIMD4)
+        done = transformSimd4(m, w, x, y, z, outX, outY, outZ, count);
+#endif
+    transformScalar(m, w, x, y, z, outX, outY, outZ, done, count);
+}
+
+// out[i] = a[i or 0] * b[i]; two columns per AVX2 step (a's columns repeated in both halves,
+// each half times one element of its column of b), one per SSE/NEON step
+inline void multiplyScalar(const mat4 *a, size_t aStride, const mat4 *b, mat4 *out, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        const mat4 &l = a[i * aStride], &r = b[i];
+        mat4 product;
+        for (int c = 0; c < 4; c++)
+            product[c] = vec4(l[0].x * r[c].x + l[1].x * r[c].y + l[2].x * r[c].z + l[3].x * r[c].w,
+                              l[0].y * r[c].x + l[1].y * r[c].y + l[2].y * r[c].z + l[3].y * r[c].w,
+                              l[0].z * r[c].x + l[1].z * r[c].y + l[2].z * r[c].z + l[3].z * r[c].w,
+                              l[0].w * r[c].x + l[1].w * r[c].y + l[2].w * r[c].z + l[3].w * r[c].w);
+        out[i] = product;
+    }
+}
+#ifdef MATH_SIMD4
+inline void multiplySimd4(const mat4 *a, size_t aStride, const mat4 *b, mat4 *out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const float *l = a[i * aStride].data(), *r = b[i].data();
+        simd::float4 l0 = simd::load(l), l1 = simd::load(l + 4), l2 = simd::load(l + 8), l3 = simd::load(l + 12);
+        simd::float4 columns[4];
+        for (int c = 0; c < 4; c++)
+        {
+            simd::float4 column = simd::load(r + c * 4);
+            simd::float4 sum = simd::add(simd::mul(l0, simd::lane<0>(column)), simd::mul(l1, simd::lane<1>(column)));
+            sum = simd::add(sum, simd::mul(l2, simd::lane<2>(column)));
+            columns[c] = simd::add(sum, simd::mul(l3, simd::lane<3>(column)));
+        }
+        float *o = &out[i][0].x;
+        for (int c = 0; c < 4; c++)
+            simd::store(o + c * 4, columns[c]);
+    }
+}
+#endif
+#ifdef MATH_AVX2
+__attribute__((target("avx2")))
+inline void multiplyAvx2(const mat4 *a, size_t aStride, const mat4 *b, mat4 *out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const float *l = a[i * aStride].data(), *r = b[i].data();
+        __m256 l0 = _mm256_broadcast_ps((const __m128*)l), l1 = _mm256_broadcast_ps((const __m128*)(l + 4));
+        __m256 l2 = _mm256_broadcast_ps((const __m128*)(l + 8)), l3 = _mm256_broadcast_ps((const __m128*)(l + 12));
+        __m256 columns[2];
+        for (int c = 0; c < 2; c++)
+        {
+            __m256 pair = _mm256_loadu_ps(r + c * 8);
+            __m256 sum = _mm256_add_ps(_mm256_mul_ps(l0, _mm256_shuffle_ps(pair, pair, 0x00)), _mm256_mul_ps(l1, _mm256_shuffle_ps(pair, pair, 0x55)));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(l2, _mm256_shuffle_ps(pair, pair, 0xAA)));
+            columns[c] = _mm256_add_ps(sum, _mm256_mul_ps(l3, _mm256_shuffle_ps(pair, pair, 0xFF)));
+        }
+        float *o = &out[i][0].x;
+        _mm256_storeu_ps(o, columns[0]);
+        _mm256_storeu_ps(o + 8, columns[1]);
+    }
+}
+#endif
+
+inline void multiply(const mat4 *a, size_t aStride, const mat4 *b, mat4 *out, size_t count, BatchPath path)
+{
+    path = choose(path);
+#ifdef MATH_AVX2
+    if (path == BATCH_AVX2)
+        return multiplyAvx2(a, aStride, b, out, count);
+#endif
+#ifdef MATH_SIMD4
+    if (path == BATCH_SIMD4)
+        return multiplySimd4(a, aStride, b, out, count);
+#endif
+    multiplyScalar(a, aStride, b, out, 0, count);
+}
+}
+
+// points: out = m * (p, 1); vectors: without the translation
+// ------------------------------------------------------------------------
+inline void transformPoints(const mat4 &m, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count, BatchPath path = BATCH_BEST)
+{
+    batch::transform(m, 1.0f, x, y, z, outX, outY, outZ, count, path);
+}
+inline void transformVectors(const mat4 &m, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count, BatchPath path = BATCH_BEST)
+{
+    batch::transform(m, 0.0f, x, y, z, outX, outY, outZ, count, path);
+}
+
+// out[i] = a[i] * b[i], or a * b[i] for the children of one parent; out may be b
+// ------------------------------------------------------------------------
+inline void multiply(const mat4 *a, const mat4 *b, mat4 *out, size_t count, BatchPath path = BATCH_BEST)
+{
+    batch::multiply(a, 1, b, out, count, path);
+}
+inline void multiply(const mat4 &a, const mat4 *b, mat4 *out, size_t count, BatchPath path = BATCH_BEST)
+{
+    batch::multiply(&a, 0, b, out, count, path);
+}
+}
+#endif
@@ -0,0 +1,119 @@
+#ifndef MATH_BOUNDS_H
+#define MATH_BOUNDS_H
+
+#include <math/matrix.h>
+
+#include <cmath>
+#include <limits>
+
+// Axis-aligned boxes and planes, with the tests culling needs. The plane test is the one
+// FrustumCuller and Bvh use (a box is outside when it is entirely behind a plane), and
+// frustumPlanes() gives the planes FrustumCuller::extractPlanes() does, in the same order.
+//
+//   math::AABB bounds;                               // empty: grows to the first point
+//   for (math::vec3 p : points) bounds.grow(p);
+//   math::plane planes[6];
+//   math::frustumPlanes(viewProjection, planes);
+//   bool visible = math::intersects(planes, math::transform(model, bounds));
+namespace math
+{
+struct AABB
+{
+    vec3 min;
+    vec3 max;
+
+    constexpr AABB() : min(std::numeric_limits<float>::infinity()), max(-std::numeric_limits<float>::infinity()) {}
+    constexpr AABB(vec3 min, vec3 max) : min(min), max(max) {}
+
+    constexpr bool empty() const { return min.x > max.x || min.y > max.y || min.z > max.z; }
+    constexpr vec3 center() const { return (min + max) * 0.5f; }
+    constexpr vec3 extent() const { return (max - min) * 0.5f; }
+    constexpr float surfaceArea() const
+    {
+        vec3 d = max - min;
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+    constexpr void grow(vec3 p)
+    {
+        min = math::min(min, p);
+        max = math::max(max, p);
+    }
+    constexpr void grow(const AABB &box)
+    {
+        min = math::min(min, box.min);
+        max = math::max(max, box.max);
+    }
+    constexpr bool contains(vec3 p) const
+    {
+        return min.x <= p.x && p.x <= max.x && min.y <= p.y && p.y <= max.y && min.z <= p.z && p.z <= max.z;
+    }
+};
+
+constexpr bool overlaps(const AABB &a, const AABB &b)
+{
+    return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y && a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+// the box around m applied to every point of box: the centre transformed, the extent through
+// the absolute linear part (Arvo)
+constexpr AABB transform(const mat4 &m, const AABB &box)
+{
+    vec3 c = transformPoint(m, box.center()), e = box.extent();
+    vec3 r = abs(m[0].xyz()) * e.x + abs(m[1].xyz()) * e.y + abs(m[2].xyz()) * e.z;
+    return AABB(c - r, c + r);
+}
+
+// the points p with dot(normal, p) + d = 0; normal points to the positive side
+// ------------------------------------------------------------------------
+struct plane
+{
+    vec3 normal;
+    float d;
+
+    constexpr plane() : normal(0.0f, 1.0f, 0.0f), d(0.0f) {}
+    constexpr plane(vec3 normal, float d) : normal(normal), d(d) {}
+    constexpr plane(vec3 normal, vec3 point) : normal(normal), d(-dot(normal, point)) {}
+    // signed distance in lengths of normal
+    constexpr float distance(vec3 p) const { return dot(normal, p) + d; }
+};
+
+inline plane normalize(const plane &p)
+{
+    float scale = 1.0f / length(p.normal);
+    return plane(p.normal * scale, p.d * scale);
+}
+// through a, b and c, counter-clockwise seen from the positive side
+inline plane planeFromPoints(vec3 a, vec3 b, vec3 c)
+{
+    return plane(normalize(cross(b - a, c - a)), a);
+}
+
+// left, right, bottom, top, near, far of a column-major view-projection, pointing inside and
+// normalised: each the w row plus or minus the x, y or z row
+inline void frustumPlanes(const mat4 &viewProjection, plane planes[6])
+{
+    for (int p = 0; p < 6; p++)
+    {
+        int row = p / 2;
+        float sign = (p & 1) ? -1.0f : 1.0f;
+        float c[4];
+        for (int column = 0; column < 4; column++)
+            c[column] = viewProjection[column].w + sign * viewProjection[column][row];
+        planes[p] = normalize(plane(vec3(c[0], c[1], c[2]), c[3]));
+    }
+}
+
+// box entirely on the negative side of the plane
+constexpr bool outside(const plane &p, const AABB &box)
+{
+    return p.distance(box.center()) + dot(abs(p.normal), box.extent()) < 0.0f;
+}
+// conservative: a box outside the frustum near a corner may still count as intersecting
+constexpr bool intersects(const plane planes[6], const AABB &box)
+{
+    for (int p = 0; p < 6; p++)
+        if (outside(planes[p], box))
+            return false;
+    return true;
+}
+}
+#endif
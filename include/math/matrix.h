@@ -0,0 +1,196 @@
+#ifndef MATH_MATRIX_H
+#define MATH_MATRIX_H
+
+#include <math/vector.h>
+
+#include <cmath>
+
+// mat3 and mat4, column-major like GLSL (columns[c][r] is row r of column c, and data() is
+// what glUniformMatrix4fv takes with transpose GL_FALSE); both start as identity.
+// mat4 products and transforms are a column at a time in SSE/NEON, a broadcast element of the
+// right-hand side times each column of the left, summed first to last.
+//
+//   math::mat4 model = math::translate(position) * math::rotate(axis, angle) * math::scale(size);
+//   math::vec3 p = math::transformPoint(model, corner);
+namespace math
+{
+struct mat3
+{
+    vec3 columns[3];
+
+    constexpr mat3() : columns{ vec3(1.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f), vec3(0.0f, 0.0f, 1.0f) } {}
+    constexpr mat3(vec3 c0, vec3 c1, vec3 c2) : columns{ c0, c1, c2 } {}
+
+    constexpr vec3 operator[](int c) const { return columns[c]; }
+    constexpr vec3 &operator[](int c) { return columns[c]; }
+    const float *data() const { return &columns[0].x; }
+};
+
+struct alignas(16) mat4
+{
+    vec4 columns[4];
+
+    constexpr mat4()
+        : columns{ vec4(1.0f, 0.0f, 0.0f, 0.0f), vec4(0.0f, 1.0f, 0.0f, 0.0f), vec4(0.0f, 0.0f, 1.0f, 0.0f), vec4(0.0f, 0.0f, 0.0f, 1.0f) } {}
+    constexpr mat4(vec4 c0, vec4 c1, vec4 c2, vec4 c3) : columns{ c0, c1, c2, c3 } {}
+    // the upper left 3x3 of a mat4 and the other way (with identity around it)
+    constexpr explicit mat4(const mat3 &m)
+        : columns{ vec4(m[0], 0.0f), vec4(m[1], 0.0f), vec4(m[2], 0.0f), vec4(0.0f, 0.0f, 0.0f, 1.0f) } {}
+    // from 16 column-major floats
+    static mat4 fromArray(const float m[16])
+    {
+        return mat4(vec4(m[0], m[1], m[2], m[3]), vec4(m[4], m[5], m[6], m[7]), vec4(m[8], m[9], m[10], m[11]), vec4(m[12], m[13], m[14], m[15]));
+    }
+
+    constexpr vec4 operator[](int c) const { return columns[c]; }
+    constexpr vec4 &operator[](int c) { return columns[c]; }
+    const float *data() const { return &columns[0].x; }
+};
+
+constexpr mat3 upperLeft(const mat4 &m)
+{
+    return mat3(m[0].xyz(), m[1].xyz(), m[2].xyz());
+}
+
+// mat3: scalar
+// ------------------------------------------------------------------------
+constexpr vec3 operator*(const mat3 &m, vec3 v)
+{
+    return m[0] * v.x + m[1] * v.y + m[2] * v.z;
+}
+constexpr mat3 operator*(const mat3 &a, const mat3 &b)
+{
+    return mat3(a * b[0], a * b[1], a * b[2]);
+}
+constexpr mat3 transpose(const mat3 &m)
+{
+    return mat3(vec3(m[0].x, m[1].x, m[2].x), vec3(m[0].y, m[1].y, m[2].y), vec3(m[0].z, m[1].z, m[2].z));
+}
+constexpr float determinant(const mat3 &m)
+{
+    return dot(m[0], cross(m[1], m[2]));
+}
+// the rows of the inverse are the cross products of the columns, over the determinant
+constexpr mat3 inverse(const mat3 &m)
+{
+    float scale = 1.0f / determinant(m);
+    return transpose(mat3(cross(m[1], m[2]) * scale, cross(m[2], m[0]) * scale, cross(m[0], m[1]) * scale));
+}
+// transforms normals of a model matrix that scales unevenly
+constexpr mat3 normalMatrix(const mat4 &model)
+{
+    return transpose(inverse(upperLeft(model)));
+}
+
+// mat4
+// ------------------------------------------------------------------------
+constexpr vec4 operator*(const mat4 &m, vec4 v)
+{
+#ifdef MATH_SIMD4
+    if (MATH_USE_SIMD())
+    {
+        simd::float4 sum = simd::add(simd::mul(simd::load(&m.columns[0].x), simd::splat(v.x)), simd::mul(simd::load(&m.columns[1].x), simd::splat(v.y)));
+        sum = simd::add(sum, simd::mul(simd::load(&m.columns[2].x), simd::splat(v.z)));
+        sum = simd::add(sum, simd::mul(simd::load(&m.columns[3].x), simd::splat(v.w)));
+        vec4 r;
+        simd::store(&r.x, sum);
+        return r;
+    }
+#endif
+    return vec4(m[0].x * v.x + m[1].x * v.y + m[2].x * v.z + m[3].x * v.w,
+                m[0].y * v.x + m[1].y * v.y + m[2].y * v.z + m[3].y * v.w,
+                m[0].z * v.x + m[1].z * v.y + m[2].z * v.z + m[3].z * v.w,
+                m[0].w * v.x + m[1].w * v.y + m[2].w * v.z + m[3].w * v.w);
+}
+constexpr mat4 operator*(const mat4 &a, const mat4 &b)
+{
+    return mat4(a * b[0], a * b[1], a * b[2], a * b[3]);
+}
+constexpr mat4 &operator*=(mat4 &a, const mat4 &b) { return a = a * b; }
+constexpr bool operator==(const mat4 &a, const mat4 &b) { return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3]; }
+constexpr bool operator!=(const mat4 &a, const mat4 &b) { return !(a == b); }
+
+// m * (p, 1) without the w row (affine matrices), m * (v, 0), and m * (p, 1) divided by w
+// (projections)
+constexpr vec3 transformPoint(const mat4 &m, vec3 p)
+{
+    return (m * vec4(p, 1.0f)).xyz();
+}
+constexpr vec3 transformVector(const mat4 &m, vec3 v)
+{
+    return (m * vec4(v, 0.0f)).xyz();
+}
+constexpr vec3 project(const mat4 &m, vec3 p)
+{
+    vec4 clip = m * vec4(p, 1.0f);
+    return clip.xyz() / clip.w;
+}
+
+constexpr mat4 transpose(const mat4 &m)
+{
+    return mat4(vec4(m[0].x, m[1].x, m[2].x, m[3].x), vec4(m[0].y, m[1].y, m[2].y, m[3].y),
+                vec4(m[0].z, m[1].z, m[2].z, m[3].z), vec4(m[0].w, m[1].w, m[2].w, m[3].w));
+}
+// general inverse by cofactors: the 2x2 determinants of the lower and upper row pairs, combined
+constexpr mat4 inverse(const mat4 &m)
+{
+    float s0 = m[0].x * m[1].y - m[1].x * m[0].y, s1 = m[0].x * m[2].y - m[2].x * m[0].y, s2 = m[0].x * m[3].y - m[3].x * m[0].y;
+    float s3 = m[1].x * m[2].y - m[2].x * m[1].y, s4 = m[1].x * m[3].y - m[3].x * m[1].y, s5 = m[2].x * m[3].y - m[3].x * m[2].y;
+    float c5 = m[2].z * m[3].w - m[3].z * m[2].w, c4 = m[1].z * m[3].w - m[3].z * m[1].w, c3 = m[1].z * m[2].w - m[2].z * m[1].w;
+    float c2 = m[0].z * m[3].w - m[3].z * m[0].w, c1 = m[0].z * m[2].w - m[2].z * m[0].w, c0 = m[0].z * m[1].w - m[1].z * m[0].w;
+    float scale = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+    return mat4(vec4((m[1].y * c5 - m[2].y * c4 + m[3].y * c3) * scale, (-m[0].y * c5 + m[2].y * c2 - m[3].y * c1) * scale,
+                     (m[0].y * c4 - m[1].y * c2 + m[3].y * c0) * scale, (-m[0].y * c3 + m[1].y * c1 - m[2].y * c0) * scale),
+                vec4((-m[1].x * c5 + m[2].x * c4 - m[3].x * c3) * scale, (m[0].x * c5 - m[2].x * c2 + m[3].x * c1) * scale,
+                     (-m[0].x * c4 + m[1].x * c2 - m[3].x * c0) * scale, (m[0].x * c3 - m[1].x * c1 + m[2].x * c0) * scale),
+                vec4((m[1].w * s5 - m[2].w * s4 + m[3].w * s3) * scale, (-m[0].w * s5 + m[2].w * s2 - m[3].w * s1) * scale,
+                     (m[0].w * s4 - m[1].w * s2 + m[3].w * s0) * scale, (-m[0].w * s3 + m[1].w * s1 - m[2].w * s0) * scale),
+                vec4((-m[1].z * s5 + m[2].z * s4 - m[3].z * s3) * scale, (m[0].z * s5 - m[2].z * s2 + m[3].z * s1) * scale,
+                     (-m[0].z * s4 + m[1].z * s2 - m[3].z * s0) * scale, (m[0].z * s3 - m[1].z * s1 + m[2].z * s0) * scale));
+}
+
+// builders
+// ------------------------------------------------------------------------
+constexpr mat4 translate(vec3 t)
+{
+    return mat4(vec4(1.0f, 0.0f, 0.0f, 0.0f), vec4(0.0f, 1.0f, 0.0f, 0.0f), vec4(0.0f, 0.0f, 1.0f, 0.0f), vec4(t, 1.0f));
+}
+constexpr mat4 scale(vec3 s)
+{
+    return mat4(vec4(s.x, 0.0f, 0.0f, 0.0f), vec4(0.0f, s.y, 0.0f, 0.0f), vec4(0.0f, 0.0f, s.z, 0.0f), vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+// by angle radians about the unit axis, counter-clockwise looking down the axis
+inline mat3 rotate3(vec3 axis, float angle)
+{
+    float c = std::cos(angle), s = std::sin(angle), t = 1.0f - c;
+    float x = axis.x, y = axis.y, z = axis.z;
+    return mat3(vec3(t * x * x + c, t * x * y + s * z, t * x * z - s * y),
+                vec3(t * x * y - s * z, t * y * y + c, t * y * z + s * x),
+                vec3(t * x * z + s * y, t * y * z - s * x, t * z * z + c));
+}
+inline mat4 rotate(vec3 axis, float angle)
+{
+    return mat4(rotate3(axis, angle));
+}
+// translation * rotation * scale, without the products
+constexpr mat4 compose(vec3 translation, const mat3 &rotation, vec3 scale)
+{
+    return mat4(vec4(rotation[0] * scale.x, 0.0f), vec4(rotation[1] * scale.y, 0.0f), vec4(rotation[2] * scale.z, 0.0f), vec4(translation, 1.0f));
+}
+// gluPerspective
+inline mat4 perspective(float fovY, float aspect, float nearPlane, float farPlane)
+{
+    float f = 1.0f / std::tan(fovY * 0.5f);
+    return mat4(vec4(f / aspect, 0.0f, 0.0f, 0.0f), vec4(0.0f, f, 0.0f, 0.0f),
+                vec4(0.0f, 0.0f, (farPlane + nearPlane) / (nearPlane - farPlane), -1.0f),
+                vec4(0.0f, 0.0f, 2.0f * farPlane * nearPlane / (nearPlane - farPlane), 0.0f));
+}
+// world to eye for an eye at eye looking at target (gluLookAt)
+inline mat4 lookAt(vec3 eye, vec3 target, vec3 up)
+{
+    vec3 f = normalize(target - eye), s = normalize(cross(f, up)), u = cross(s, f);
+    return mat4(vec4(s.x, u.x, -f.x, 0.0f), vec4(s.y, u.y, -f.y, 0.0f), vec4(s.z, u.z, -f.z, 0.0f),
+                vec4(-dot(s, eye), -dot(u, eye), dot(f, eye), 1.0f));
+}
+}
+#endif
@@ -0,0 +1,134 @@
+#ifndef MATH_QUATERNION_H
+#define MATH_QUATERNION_H
+
+#include <math/matrix.h>
+
+#include <cmath>
+
+// Rotations as unit quaternions (x, y, z the vector part, w the scalar part), identity by
+// default. a * b rotates by b, then by a, like the matrices; the product is four broadcasts of
+// a's components times shuffled, sign-flipped copies of b in SSE/NEON.
+//
+//   math::quat spin = math::angleAxis(angle, math::vec3(0.0f, 1.0f, 0.0f));
+//   math::quat turned = math::normalize(spin * orientation);
+//   math::mat4 model = math::compose(position, turned, size);
+namespace math
+{
+struct alignas(16) quat
+{
+    float x, y, z, w;
+
+    constexpr quat() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+    constexpr quat(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr vec3 vector() const { return vec3(x, y, z); }
+};
+
+// ------------------------------------------------------------------------
+constexpr quat operator*(const quat &a, const quat &b)
+{
+#ifdef MATH_SIMD4
+    if (MATH_USE_SIMD())
+    {
+        simd::float4 q = simd::load(&b.x);
+        simd::float4 sum = simd::add(simd::mul(simd::splat(a.w), q), simd::mul(simd::splat(a.x), simd::mul(simd::reverse(q), simd::set(1.0f, -1.0f, 1.0f, -1.0f))));
+        sum = simd::add(sum, simd::mul(simd::splat(a.y), simd::mul(simd::swapHalves(q), simd::set(1.0f, 1.0f, -1.0f, -1.0f))));
+        sum = simd::add(sum, simd::mul(simd::splat(a.z), simd::mul(simd::swapPairs(q), simd::set(-1.0f, 1.0f, 1.0f, -1.0f))));
+        quat r;
+        simd::store(&r.x, sum);
+        return r;
+    }
+#endif
+    return quat(a.w * b.x + a.x * b.w + a.y * b.z + a.z * -b.y,
+                a.w * b.y + a.x * -b.z + a.y * b.w + a.z * b.x,
+                a.w * b.z + a.x * b.y + a.y * -b.x + a.z * b.w,
+                a.w * b.w + a.x * -b.x + a.y * -b.y + a.z * -b.z);
+}
+constexpr bool operator==(const quat &a, const quat &b) { return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w; }
+constexpr bool operator!=(const quat &a, const quat &b) { return !(a == b); }
+
+constexpr float dot(const quat &a, const quat &b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+// the inverse of a unit quaternion
+constexpr quat conjugate(const quat &q) { return quat(-q.x, -q.y, -q.z, q.w); }
+inline quat normalize(const quat &q)
+{
+    float scale = 1.0f / std::sqrt(dot(q, q));
+    return quat(q.x * scale, q.y * scale, q.z * scale, q.w * scale);
+}
+inline quat angleAxis(float angle, vec3 axis)
+{
+    float s = std::sin(angle * 0.5f);
+    return quat(axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f));
+}
+
+// v rotated by the unit quaternion q: v + 2w(u x v) + 2u x (u x v)
+constexpr vec3 rotate(const quat &q, vec3 v)
+{
+    vec3 u = q.vector(), t = cross(u, v) * 2.0f;
+    return v + t * q.w + cross(u, t);
+}
+
+// ------------------------------------------------------------------------
+constexpr mat3 toMat3(const quat &q)
+{
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z, wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    return mat3(vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)),
+                vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)),
+                vec3(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)));
+}
+constexpr mat4 toMat4(const quat &q)
+{
+    return mat4(toMat3(q));
+}
+// the rotation of an orthonormal matrix (Shepperd: from the largest of w, x, y and z)
+inline quat fromMat3(const mat3 &m)
+{
+    float trace = m[0].x + m[1].y + m[2].z;
+    if (trace > 0.0f)
+    {
+        float s = 0.5f / std::sqrt(trace + 1.0f);
+        return quat((m[1].z - m[2].y) * s, (m[2].x - m[0].z) * s, (m[0].y - m[1].x) * s, 0.25f / s);
+    }
+    if (m[0].x > m[1].y && m[0].x > m[2].z)
+    {
+        float s = 2.0f * std::sqrt(1.0f + m[0].x - m[1].y - m[2].z);
+        return quat(0.25f * s, (m[1].x + m[0].y) / s, (m[2].x + m[0].z) / s, (m[1].z - m[2].y) / s);
+    }
+    if (m[1].y > m[2].z)
+    {
+        float s = 2.0f * std::sqrt(1.0f + m[1].y - m[0].x - m[2].z);
+        return quat((m[1].x + m[0].y) / s, 0.25f * s, (m[2].y + m[1].z) / s, (m[2].x - m[0].z) / s);
+    }
+    float s = 2.0f * std::sqrt(1.0f + m[2].z - m[0].x - m[1].y);
+    return quat((m[2].x + m[0].z) / s, (m[2].y + m[1].z) / s, 0.25f * s, (m[0].y - m[1].x) / s);
+}
+// translation * rotation * scale
+constexpr mat4 compose(vec3 translation, const quat &rotation, vec3 scale)
+{
+    return compose(translation, toMat3(rotation), scale);
+}
+
+// interpolation along the shorter arc: normalised lerp (cheap, uneven speed) and slerp
+// ------------------------------------------------------------------------
+inline quat nlerp(const quat &a, quat b, float t)
+{
+    if (dot(a, b) < 0.0f)
+        b = quat(-b.x, -b.y, -b.z, -b.w);
+    return normalize(quat(mix(a.x, b.x, t), mix(a.y, b.y, t), mix(a.z, b.z, t), mix(a.w, b.w, t)));
+}
+inline quat slerp(const quat &a, quat b, float t)
+{
+    float cosine = dot(a, b);
+    if (cosine < 0.0f)
+    {
+        b = quat(-b.x, -b.y, -b.z, -b.w);
+        cosine = -cosine;
+    }
+    if (cosine > 0.9995f) // nearly parallel: the sine below would lose its precision
+        return nlerp(a, b, t);
+    float angle = std::acos(cosine), s = 1.0f / std::sin(angle);
+    float wa = std::sin((1.0f - t) * angle) * s, wb = std::sin(t * angle) * s;
+    return quat(a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb);
+}
+}
+#endif
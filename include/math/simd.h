@@ -0,0 +1,99 @@
+#ifndef MATH_SIMD_H
+#define MATH_SIMD_H
+
+// What the math types (include/math/) are built on. vec4, mat4 and quat use 4-wide registers,
+// chosen at compile time: SSE on x86 (always there on x86-64), NEON on ARM. The batch functions
+// add an 8-wide AVX2 path on x86, picked at run time. Without either everything is scalar.
+//
+// Every function with a SIMD path is constexpr as well: MATH_USE_SIMD() is false while the
+// compiler evaluates a constant expression, which then takes the scalar code. Compilers that
+// cannot tell (no __builtin_is_constant_evaluated) get the scalar code only. Both paths multiply
+// and add in the same order, so they give the same results.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define MATH_CONSTANT_EVALUATED_BUILTIN
+#endif
+#elif defined(__GNUC__) && __GNUC__ >= 9
+#define MATH_CONSTANT_EVALUATED_BUILTIN
+#endif
+
+#ifdef MATH_CONSTANT_EVALUATED_BUILTIN
+#define MATH_USE_SIMD() (!__builtin_is_constant_evaluated())
+#if defined(__SSE2__) || defined(_M_X64)
+#define MATH_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MATH_NEON
+#include <arm_neon.h>
+#endif
+#else
+#define MATH_USE_SIMD() false
+#endif
+
+#if defined(MATH_SSE) || defined(MATH_NEON)
+#define MATH_SIMD4
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MATH_AVX2
+#include <immintrin.h>
+#endif
+
+#ifdef MATH_SIMD4
+namespace math
+{
+// the few 4-wide operations the types need, over either instruction set
+namespace simd
+{
+#ifdef MATH_SSE
+typedef __m128 float4;
+
+inline float4 load(const float *p) { return _mm_loadu_ps(p); }
+inline void store(float *p, float4 v) { _mm_storeu_ps(p, v); }
+inline float4 splat(float value) { return _mm_set1_ps(value); }
+inline float4 set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+inline float4 add(float4 a, float4 b) { return _mm_add_ps(a, b); }
+inline float4 sub(float4 a, float4 b) { return _mm_sub_ps(a, b); }
+inline float4 mul(float4 a, float4 b) { return _mm_mul_ps(a, b); }
+inline float4 div(float4 a, float4 b) { return _mm_div_ps(a, b); }
+// lane i of v in every lane
+template <int i>
+inline float4 lane(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i)); }
+// (w, z, y, x), (z, w, x, y) and (y, x, w, z): the orders a quaternion product needs
+inline float4 reverse(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)); }
+inline float4 swapHalves(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)); }
+inline float4 swapPairs(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); }
+#else
+typedef float32x4_t float4;
+
+inline float4 load(const float *p) { return vld1q_f32(p); }
+inline void store(float *p, float4 v) { vst1q_f32(p, v); }
+inline float4 splat(float value) { return vdupq_n_f32(value); }
+inline float4 set(float x, float y, float z, float w)
+{
+    const float values[4] = { x, y, z, w };
+    return vld1q_f32(values);
+}
+inline float4 add(float4 a, float4 b) { return vaddq_f32(a, b); }
+inline float4 sub(float4 a, float4 b) { return vsubq_f32(a, b); }
+inline float4 mul(float4 a, float4 b) { return vmulq_f32(a, b); } // not vmlaq: that may fuse, and differ from the scalar code
+inline float4 div(float4 a, float4 b)
+{
+#if defined(__aarch64__)
+    return vdivq_f32(a, b);
+#else
+    float x[4], y[4];
+    vst1q_f32(x, a);
+    vst1q_f32(y, b);
+    return set(x[0] / y[0], x[1] / y[1], x[2] / y[2], x[3] / y[3]);
+#endif
+}
+template <int i>
+inline float4 lane(float4 v) { return vdupq_n_f32(vgetq_lane_f32(v, i)); }
+inline float4 swapHalves(float4 v) { return vextq_f32(v, v, 2); }
+inline float4 swapPairs(float4 v) { return vrev64q_f32(v); }
+inline float4 reverse(float4 v) { return vrev64q_f32(vextq_f32(v, v, 2)); }
+#endif
+}
+}
+#endif
+#endif
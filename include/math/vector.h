@@ -0,0 +1,161 @@
+#ifndef MATH_VECTOR_H
+#define MATH_VECTOR_H
+
+#include <math/simd.h>
+
+#include <cmath>
+
+// vec2, vec3 and vec4 with GLSL's component-wise operators (and a scalar on either side), dot,
+// cross, length, normalize, min, max and mix. vec2 and vec3 are plain floats, so arrays of them
+// are vertex arrays; vec4 is 16-byte aligned and its arithmetic is one SSE/NEON instruction.
+// All of it is constexpr except what takes a square root.
+//
+//   constexpr math::vec3 up(0.0f, 1.0f, 0.0f);
+//   math::vec3 side = math::normalize(math::cross(forward, up));
+namespace math
+{
+struct vec2
+{
+    float x, y;
+
+    constexpr vec2() : x(0.0f), y(0.0f) {}
+    constexpr explicit vec2(float s) : x(s), y(s) {}
+    constexpr vec2(float x, float y) : x(x), y(y) {}
+
+    constexpr float operator[](int i) const { return i == 0 ? x : y; }
+    constexpr float &operator[](int i) { return i == 0 ? x : y; }
+};
+
+struct vec3
+{
+    float x, y, z;
+
+    constexpr vec3() : x(0.0f), y(0.0f), z(0.0f) {}
+    constexpr explicit vec3(float s) : x(s), y(s), z(s) {}
+    constexpr vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+    constexpr vec3(vec2 xy, float z) : x(xy.x), y(xy.y), z(z) {}
+
+    constexpr float operator[](int i) const { return i == 0 ? x : i == 1 ? y : z; }
+    constexpr float &operator[](int i) { return i == 0 ? x : i == 1 ? y : z; }
+};
+
+struct alignas(16) vec4
+{
+    float x, y, z, w;
+
+    constexpr vec4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+    constexpr explicit vec4(float s) : x(s), y(s), z(s), w(s) {}
+    constexpr vec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr vec4(vec3 xyz, float w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+    constexpr vec3 xyz() const { return vec3(x, y, z); }
+
+    constexpr float operator[](int i) const { return i == 0 ? x : i == 1 ? y : i == 2 ? z : w; }
+    constexpr float &operator[](int i) { return i == 0 ? x : i == 1 ? y : i == 2 ? z : w; }
+};
+
+// vec2 and vec3
+// ------------------------------------------------------------------------
+constexpr vec2 operator+(vec2 a, vec2 b) { return vec2(a.x + b.x, a.y + b.y); }
+constexpr vec2 operator-(vec2 a, vec2 b) { return vec2(a.x - b.x, a.y - b.y); }
+constexpr vec2 operator*(vec2 a, vec2 b) { return vec2(a.x * b.x, a.y * b.y); }
+constexpr vec2 operator/(vec2 a, vec2 b) { return vec2(a.x / b.x, a.y / b.y); }
+constexpr vec2 operator*(vec2 a, float s) { return vec2(a.x * s, a.y * s); }
+constexpr vec2 operator*(float s, vec2 a) { return vec2(s * a.x, s * a.y); }
+constexpr vec2 operator/(vec2 a, float s) { return vec2(a.x / s, a.y / s); }
+constexpr vec2 operator-(vec2 a) { return vec2(-a.x, -a.y); }
+constexpr bool operator==(vec2 a, vec2 b) { return a.x == b.x && a.y == b.y; }
+constexpr bool operator!=(vec2 a, vec2 b) { return !(a == b); }
+
+constexpr vec3 operator+(vec3 a, vec3 b) { return vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+constexpr vec3 operator-(vec3 a, vec3 b) { return vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+constexpr vec3 operator*(vec3 a, vec3 b) { return vec3(a.x * b.x, a.y * b.y, a.z * b.z); }
+constexpr vec3 operator/(vec3 a, vec3 b) { return vec3(a.x / b.x, a.y / b.y, a.z / b.z); }
+constexpr vec3 operator*(vec3 a, float s) { return vec3(a.x * s, a.y * s, a.z * s); }
+constexpr vec3 operator*(float s, vec3 a) { return vec3(s * a.x, s * a.y, s * a.z); }
+constexpr vec3 operator/(vec3 a, float s) { return vec3(a.x / s, a.y / s, a.z / s); }
+constexpr vec3 operator-(vec3 a) { return vec3(-a.x, -a.y, -a.z); }
+constexpr bool operator==(vec3 a, vec3 b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+constexpr bool operator!=(vec3 a, vec3 b) { return !(a == b); }
+
+constexpr vec2 &operator+=(vec2 &a, vec2 b) { return a = a + b; }
+constexpr vec2 &operator-=(vec2 &a, vec2 b) { return a = a - b; }
+constexpr vec2 &operator*=(vec2 &a, float s) { return a = a * s; }
+constexpr vec3 &operator+=(vec3 &a, vec3 b) { return a = a + b; }
+constexpr vec3 &operator-=(vec3 &a, vec3 b) { return a = a - b; }
+constexpr vec3 &operator*=(vec3 &a, float s) { return a = a * s; }
+
+constexpr float dot(vec2 a, vec2 b) { return a.x * b.x + a.y * b.y; }
+constexpr float dot(vec3 a, vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+constexpr vec3 cross(vec3 a, vec3 b) { return vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+inline float length(vec2 a) { return std::sqrt(dot(a, a)); }
+inline float length(vec3 a) { return std::sqrt(dot(a, a)); }
+inline vec2 normalize(vec2 a) { return a / length(a); }
+inline vec3 normalize(vec3 a) { return a / length(a); }
+
+// value-based, so they compile to minss/maxss rather than compares and branches
+constexpr float min(float a, float b) { return a < b ? a : b; }
+constexpr float max(float a, float b) { return a > b ? a : b; }
+constexpr float clamp(float v, float lo, float hi) { return min(max(v, lo), hi); }
+constexpr vec2 min(vec2 a, vec2 b) { return vec2(min(a.x, b.x), min(a.y, b.y)); }
+constexpr vec2 max(vec2 a, vec2 b) { return vec2(max(a.x, b.x), max(a.y, b.y)); }
+constexpr vec3 min(vec3 a, vec3 b) { return vec3(min(a.x, b.x), min(a.y, b.y), min(a.z, b.z)); }
+constexpr vec3 max(vec3 a, vec3 b) { return vec3(max(a.x, b.x), max(a.y, b.y), max(a.z, b.z)); }
+constexpr vec3 abs(vec3 a) { return vec3(a.x < 0.0f ? -a.x : a.x, a.y < 0.0f ? -a.y : a.y, a.z < 0.0f ? -a.z : a.z); }
+constexpr float mix(float a, float b, float t) { return a + (b - a) * t; }
+constexpr vec2 mix(vec2 a, vec2 b, float t) { return a + (b - a) * t; }
+constexpr vec3 mix(vec3 a, vec3 b, float t) { return a + (b - a) * t; }
+
+// vec4: one instruction each at run time
+// ------------------------------------------------------------------------
+#ifdef MATH_SIMD4
+#define MATH_VEC4_SIMD(expression)                                  \
+    if (MATH_USE_SIMD())                                            \
+    {                                                               \
+        vec4 r;                                                     \
+        simd::float4 va = simd::load(&a.x), vb = simd::load(&b.x);  \
+        simd::store(&r.x, expression);                              \
+        return r;                                                   \
+    }
+#else
+#define MATH_VEC4_SIMD(expression)
+#endif
+
+constexpr vec4 operator+(vec4 a, vec4 b)
+{
+    MATH_VEC4_SIMD(simd::add(va, vb))
+    return vec4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+}
+constexpr vec4 operator-(vec4 a, vec4 b)
+{
+    MATH_VEC4_SIMD(simd::sub(va, vb))
+    return vec4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+}
+constexpr vec4 operator*(vec4 a, vec4 b)
+{
+    MATH_VEC4_SIMD(simd::mul(va, vb))
+    return vec4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+}
+constexpr vec4 operator/(vec4 a, vec4 b)
+{
+    MATH_VEC4_SIMD(simd::div(va, vb))
+    return vec4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+}
+#undef MATH_VEC4_SIMD
+constexpr vec4 operator*(vec4 a, float s) { return a * vec4(s); }
+constexpr vec4 operator*(float s, vec4 a) { return vec4(s) * a; }
+constexpr vec4 operator/(vec4 a, float s) { return a / vec4(s); }
+constexpr vec4 operator-(vec4 a) { return vec4(-a.x, -a.y, -a.z, -a.w); }
+constexpr bool operator==(vec4 a, vec4 b) { return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w; }
+constexpr bool operator!=(vec4 a, vec4 b) { return !(a == b); }
+constexpr vec4 &operator+=(vec4 &a, vec4 b) { return a = a + b; }
+constexpr vec4 &operator-=(vec4 &a, vec4 b) { return a = a - b; }
+constexpr vec4 &operator*=(vec4 &a, float s) { return a = a * s; }
+
+constexpr float dot(vec4 a, vec4 b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+inline float length(vec4 a) { return std::sqrt(dot(a, a)); }
+inline vec4 normalize(vec4 a) { return a / length(a); }
+constexpr vec4 min(vec4 a, vec4 b) { return vec4(min(a.x, b.x), min(a.y, b.y), min(a.z, b.z), min(a.w, b.w)); }
+constexpr vec4 max(vec4 a, vec4 b) { return vec4(max(a.x, b.x), max(a.y, b.y), max(a.z, b.z), max(a.w, b.w)); }
+constexpr vec4 mix(vec4 a, vec4 b, float t) { return a + (b - a) * t; }
+}
+#endif
@@ -0,0 +1,199 @@
+#ifndef MAPPED_MESH_H
+#define MAPPED_MESH_H
+
+#include <glad/glad.h>
+#include <mesh/mesh_format.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Loads a .mesh file by mapping it into memory. Nothing is parsed or copied on the CPU:
+// the header is validated in place and upload() passes pointers into the mapping straight
+// to glBufferData. The mapping can be released as soon as upload() returns.
+class MappedMesh
+{
+public:
+    unsigned int VAO = 0, VBO = 0, EBO = 0;
+
+    MappedMesh() {}
+    ~MappedMesh()
+    {
+        close();
+        release();
+    }
+    MappedMesh(const MappedMesh&) = delete;
+    MappedMesh& operator=(const MappedMesh&) = delete;
+
+    // map the file and validate the header, the block bounds and every sub-mesh's index range
+    // ------------------------------------------------------------------------
+    bool open(const std::string &path)
+    {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            std::cout << "ERROR::MESH::FILE_NOT_SUCCESSFULLY_READ: " << path << std::endl;
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(MeshHeader))
+        {
+            std::cout << "ERROR::MESH::FILE_TOO_SMALL: " << path << std::endl;
+            ::close(fd);
+            return false;
+        }
+        size = (size_t)info.st_size;
+        void *ptr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps the file alive
+        if (ptr == MAP_FAILED)
+        {
+            std::cout << "ERROR::MESH::MMAP_FAILED: " << path << std::endl;
+            size = 0;
+            return false;
+        }
+        data = (const unsigned char*)ptr;
+        madvise(ptr, size, MADV_WILLNEED); // start paging in before upload() touches it
+        if (!validate())
+        {
+            std::cout << "ERROR::MESH::INVALID_FILE: " << path << std::endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+    void close()
+    {
+        if (data)
+            munmap((void*)data, size);
+        data = NULL;
+        size = 0;
+    }
+
+    const MeshHeader& header() const
+    {
+        return *(const MeshHeader*)data;
+    }
+    const MeshAttribute* attributes() const
+    {
+        return (const MeshAttribute*)(data + sizeof(MeshHeader));
+    }
+    const SubMesh* subMeshes() const
+    {
+        return (const SubMesh*)(attributes() + header().attributeCount);
+    }
+    const void* vertexData() const
+    {
+        return data + header().vertexDataOffset;
+    }
+    const void* indexData() const
+    {
+        return data + header().indexDataOffset;
+    }
+
+    // create VAO/VBO/EBO straight from the mapping and set up the attribute layout
+    // ------------------------------------------------------------------------
+    void upload(GLenum usage = GL_STATIC_DRAW)
+    {
+        const MeshHeader &h = header();
+        if (!VAO)
+        {
+            glGenVertexArrays(1, &VAO);
+            glGenBuffers(1, &VBO);
+            glGenBuffers(1, &EBO);
+        }
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)h.vertexDataSize, vertexData(), usage);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)h.indexDataSize, indexData(), usage);
+        const MeshAttribute *attribute = attributes();
+        for (uint32_t i = 0; i < h.attributeCount; i++, attribute++)
+        {
+            glVertexAttribPointer(attribute->location, attribute->components, attribute->type,
+                attribute->normalized ? GL_TRUE : GL_FALSE, h.vertexStride, (void*)(uintptr_t)attribute->offset);
+            glEnableVertexAttribArray(attribute->location);
+        }
+        indexType = h.indexType;
+        ranges.assign(subMeshes(), subMeshes() + h.subMeshCount);
+    }
+    // draw every sub-mesh; usable after close() since the ranges are kept
+    // ------------------------------------------------------------------------
+    void draw() const
+    {
+        glBindVertexArray(VAO);
+        size_t indexSize = indexType == MESH_TYPE_UNSIGNED_INT ? 4 : 2;
+        for (const SubMesh &range : ranges)
+            glDrawElementsBaseVertex(GL_TRIANGLES, range.indexCount, indexType,
+                (void*)(uintptr_t)(range.indexOffset * indexSize), range.baseVertex);
+    }
+    void release()
+    {
+        if (!VAO)
+            return;
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteBuffers(1, &EBO);
+        VAO = VBO = EBO = 0;
+    }
+
+private:
+    const unsigned char *data = NULL;
+    size_t size = 0;
+    uint32_t indexType = MESH_TYPE_UNSIGNED_INT;
+    std::vector<SubMesh> ranges;
+
+    bool validate() const
+    {
+        const MeshHeader &h = header();
+        if (std::memcmp(h.magic, MESH_MAGIC, sizeof(h.magic)) != 0 || h.version != MESH_VERSION || h.headerSize != sizeof(MeshHeader))
+            return false;
+        if (h.indexType != MESH_TYPE_UNSIGNED_SHORT && h.indexType != MESH_TYPE_UNSIGNED_INT)
+            return false;
+        // offsets and sizes come from the file: compare each against what is left of the mapping by
+        // subtraction, since an offset + size sum of two uint64 values can wrap back below size
+        uint64_t tablesEnd = sizeof(MeshHeader) + (uint64_t)sizeof(MeshAttribute) * h.attributeCount + (uint64_t)sizeof(SubMesh) * h.subMeshCount;
+        bool blocks = tablesEnd <= h.vertexDataOffset
+            && h.vertexDataOffset % MESH_DATA_ALIGNMENT == 0 && h.indexDataOffset % MESH_DATA_ALIGNMENT == 0
+            && h.vertexDataOffset <= h.indexDataOffset && h.vertexDataSize <= h.indexDataOffset - h.vertexDataOffset
+            && h.indexDataOffset <= size && h.indexDataSize <= size - h.indexDataOffset
+            && h.vertexDataSize == (uint64_t)h.vertexCount * h.vertexStride
+            && h.indexDataSize == (uint64_t)h.indexCount * (h.indexType == MESH_TYPE_UNSIGNED_INT ? 4 : 2);
+        if (!blocks)
+            return false;
+        // every attribute must be a type GL accepts and lie inside one vertex
+        const MeshAttribute *attribute = attributes();
+        for (uint32_t i = 0; i < h.attributeCount; i++, attribute++)
+        {
+            uint32_t bytes = typeSize(attribute->type);
+            if (!bytes || attribute->components < 1 || attribute->components > 4 ||
+                attribute->offset > h.vertexStride || (uint64_t)attribute->components * bytes > h.vertexStride - attribute->offset)
+                return false;
+        }
+        // every draw must stay inside the index block
+        const SubMesh *subMesh = subMeshes();
+        for (uint32_t i = 0; i < h.subMeshCount; i++, subMesh++)
+            if ((uint64_t)subMesh->indexOffset + subMesh->indexCount > h.indexCount || (h.vertexCount && subMesh->baseVertex >= h.vertexCount))
+                return false;
+        return true;
+    }
+    static uint32_t typeSize(uint32_t type)
+    {
+        switch (type)
+        {
+        case MESH_TYPE_UNSIGNED_BYTE:  return 1;
+        case MESH_TYPE_SHORT:
+        case MESH_TYPE_UNSIGNED_SHORT: return 2;
+        case MESH_TYPE_UNSIGNED_INT:
+        case MESH_TYPE_FLOAT:          return 4;
+        default:                       return 0;
+        }
+    }
+};
+#endif
@@ -0,0 +1,425 @@
+#ifndef MESH_CODEC_H
+#define MESH_CODEC_H
+
+#include <mesh/mesh_format.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MESH_CODEC_SSE2 1
+#endif
+
+// Compressed mesh stream for storage and transfer:
+//   positions  16-bit per component, quantised relative to the mesh bounds
+//   normals    octahedral encoding, two snorm16 per normal
+//   texcoords  16-bit per component, quantised relative to the UV bounds
+//   indices    zigzag delta to the previous index, LEB128 varint bytes
+// Vertex streams are stored as structure-of-arrays padded to a multiple of 4 vertices, so the
+// decoder can dequantise 4 vertices per SSE2 instruction and interleave them straight into
+// the destination, which may be a glMapBufferRange pointer.
+// The decoded layout matches what ObjLoader produces: position, [normal], [texcoord], all float.
+
+const char MESH_CODEC_MAGIC[4] = { 'T', 'M', 'S', 'Z' };
+const uint32_t MESH_CODEC_VERSION = 1;
+
+enum MeshCodecFlags
+{
+    MESH_CODEC_NORMALS   = 1,
+    MESH_CODEC_TEXCOORDS = 2
+};
+
+struct EncodedMeshHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t paddedVertexCount; // vertex streams are padded to a multiple of 4
+    float    boundsMin[3];
+    float    boundsMax[3];
+    float    uvMin[2];
+    float    uvMax[2];
+    uint64_t indexStreamSize;
+};
+
+class MeshCodec
+{
+public:
+    // floats per decoded vertex
+    static uint32_t decodedStride(const EncodedMeshHeader &header)
+    {
+        return 3 + ((header.flags & MESH_CODEC_NORMALS) ? 3 : 0) + ((header.flags & MESH_CODEC_TEXCOORDS) ? 2 : 0);
+    }
+    static size_t decodedVertexBytes(const EncodedMeshHeader &header)
+    {
+        return (size_t)header.vertexCount * decodedStride(header) * sizeof(float);
+    }
+    // attribute table for the decoded vertices (for glVertexAttribPointer / MeshData)
+    // ------------------------------------------------------------------------
+    static void decodedAttributes(const EncodedMeshHeader &header, std::vector<MeshAttribute> &attributes)
+    {
+        attributes.clear();
+        uint32_t offset = 0;
+        attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_POSITION, 3, MESH_TYPE_FLOAT, 0, offset });
+        offset += 3 * sizeof(float);
+        if (header.flags & MESH_CODEC_NORMALS)
+        {
+            attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_NORMAL, 3, MESH_TYPE_FLOAT, 0, offset });
+            offset += 3 * sizeof(float);
+        }
+        if (header.flags & MESH_CODEC_TEXCOORDS)
+            attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_TEXCOORD, 2, MESH_TYPE_FLOAT, 0, offset });
+    }
+
+    // compress a float mesh; returns false if the mesh has no float3 position at location 0
+    // ------------------------------------------------------------------------
+    static bool encode(const MeshData &mesh, std::vector<unsigned char> &out)
+    {
+        const MeshAttribute *position = find(mesh, MESH_ATTRIBUTE_POSITION, 3);
+        const MeshAttribute *normal = find(mesh, MESH_ATTRIBUTE_NORMAL, 3);
+        const MeshAttribute *texcoord = find(mesh, MESH_ATTRIBUTE_TEXCOORD, 2);
+        if (!position)
+        {
+            std::cout << "ERROR::MESH_CODEC::NO_FLOAT3_POSITION" << std::endl;
+            return false;
+        }
+
+        EncodedMeshHeader header = {};
+        std::memcpy(header.magic, MESH_CODEC_MAGIC, sizeof(header.magic));
+        header.version = MESH_CODEC_VERSION;
+        header.flags = (normal ? MESH_CODEC_NORMALS : 0) | (texcoord ? MESH_CODEC_TEXCOORDS : 0);
+        if (mesh.vertexCount() > UINT32_MAX - 3 || mesh.indices.size() > UINT32_MAX)
+        {
+            std::cout << "ERROR::MESH_CODEC::TOO_LARGE" << std::endl;
+            return false;
+        }
+        header.vertexCount = mesh.vertexCount();
+        header.indexCount = (uint32_t)mesh.indices.size();
+        header.paddedVertexCount = paddedCount(header.vertexCount);
+        std::vector<SubMesh> subMeshes;
+        computeMeshBounds(mesh, header.boundsMin, header.boundsMax, subMeshes);
+
+        uint32_t n = header.vertexCount, padded = header.paddedVertexCount;
+        std::vector<uint16_t> positions((size_t)padded * 3, 0);
+        std::vector<int16_t> normals(normal ? (size_t)padded * 2 : 0, 0);
+        std::vector<uint16_t> texcoords(texcoord ? (size_t)padded * 2 : 0, 0);
+        float v[3];
+        for (uint32_t i = 0; i < n; i++)
+        {
+            read(mesh, i, *position, 3, v);
+            for (int c = 0; c < 3; c++)
+                positions[(size_t)c * padded + i] = quantize(v[c], header.boundsMin[c], header.boundsMax[c]);
+        }
+        if (normal)
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                read(mesh, i, *normal, 3, v);
+                octEncode(v, &normals[i], &normals[(size_t)padded + i]);
+            }
+        }
+        if (texcoord)
+        {
+            header.uvMin[0] = header.uvMin[1] = 3.4e38f;
+            header.uvMax[0] = header.uvMax[1] = -3.4e38f;
+            for (uint32_t i = 0; i < n; i++)
+            {
+                read(mesh, i, *texcoord, 2, v);
+                for (int c = 0; c < 2; c++)
+                {
+                    header.uvMin[c] = std::fmin(header.uvMin[c], v[c]);
+                    header.uvMax[c] = std::fmax(header.uvMax[c], v[c]);
+                }
+            }
+            for (uint32_t i = 0; i < n; i++)
+            {
+                read(mesh, i, *texcoord, 2, v);
+                for (int c = 0; c < 2; c++)
+                    texcoords[(size_t)c * padded + i] = quantize(v[c], header.uvMin[c], header.uvMax[c]);
+            }
+        }
+
+        std::vector<unsigned char> indexStream;
+        indexStream.reserve(mesh.indices.size() * 2);
+        int64_t previous = 0;
+        for (size_t i = 0; i < mesh.indices.size(); i++)
+        {
+            int64_t delta = (int64_t)mesh.indices[i] - previous;
+            previous = mesh.indices[i];
+            uint64_t zigzag = ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+            do
+            {
+                unsigned char byte = zigzag & 0x7F;
+                zigzag >>= 7;
+                indexStream.push_back(byte | (zigzag ? 0x80 : 0));
+            } while (zigzag);
+        }
+        header.indexStreamSize = indexStream.size();
+
+        out.clear();
+        append(out, &header, sizeof(header));
+        append(out, positions.data(), positions.size() * sizeof(uint16_t));
+        append(out, normals.data(), normals.size() * sizeof(int16_t));
+        append(out, texcoords.data(), texcoords.size() * sizeof(uint16_t));
+        append(out, indexStream.data(), indexStream.size());
+        return true;
+    }
+
+    // validate the header and stream sizes; every size is checked against what is left of the
+    // buffer by subtraction, so no header value can wrap a sum back below size
+    // ------------------------------------------------------------------------
+    static bool readHeader(const unsigned char *data, size_t size, EncodedMeshHeader &header)
+    {
+        if (size < sizeof(EncodedMeshHeader))
+            return false;
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, MESH_CODEC_MAGIC, sizeof(header.magic)) != 0 || header.version != MESH_CODEC_VERSION)
+            return false;
+        if (header.vertexCount > UINT32_MAX - 3 || header.paddedVertexCount != paddedCount(header.vertexCount))
+            return false;
+        uint64_t remaining = size - sizeof(EncodedMeshHeader);
+        uint64_t vertexBytes = vertexStreamBytes(header);
+        if (vertexBytes > remaining)
+            return false;
+        return header.indexStreamSize <= remaining - vertexBytes;
+    }
+
+    // decode the vertex streams into dst (decodedVertexBytes(header) bytes, any alignment)
+    // ------------------------------------------------------------------------
+    static bool decodeVertices(const unsigned char *data, size_t size, void *dst)
+    {
+        EncodedMeshHeader h;
+        if (!readHeader(data, size, h))
+        {
+            std::cout << "ERROR::MESH_CODEC::INVALID_STREAM" << std::endl;
+            return false;
+        }
+        uint32_t padded = h.paddedVertexCount;
+        const unsigned char *stream = data + sizeof(EncodedMeshHeader);
+        const uint16_t *px = (const uint16_t*)stream;
+        const int16_t *nx = (const int16_t*)(px + (size_t)padded * 3);
+        const uint16_t *tx = (const uint16_t*)(nx + ((h.flags & MESH_CODEC_NORMALS) ? (size_t)padded * 2 : 0));
+        bool hasNormals = (h.flags & MESH_CODEC_NORMALS) != 0;
+        bool hasTexcoords = (h.flags & MESH_CODEC_TEXCOORDS) != 0;
+        uint32_t stride = decodedStride(h);
+        float scale[3], uvScale[2];
+        for (int c = 0; c < 3; c++)
+            scale[c] = (h.boundsMax[c] - h.boundsMin[c]) / 65535.0f;
+        for (int c = 0; c < 2; c++)
+            uvScale[c] = (h.uvMax[c] - h.uvMin[c]) / 65535.0f;
+
+        float *out = (float*)dst;
+        uint32_t i = 0;
+#ifdef MESH_CODEC_SSE2
+        const __m128 sx = _mm_set1_ps(scale[0]), sy = _mm_set1_ps(scale[1]), sz = _mm_set1_ps(scale[2]);
+        const __m128 ox = _mm_set1_ps(h.boundsMin[0]), oy = _mm_set1_ps(h.boundsMin[1]), oz = _mm_set1_ps(h.boundsMin[2]);
+        const __m128 su = _mm_set1_ps(uvScale[0]), sv = _mm_set1_ps(uvScale[1]);
+        const __m128 ou = _mm_set1_ps(h.uvMin[0]), ov = _mm_set1_ps(h.uvMin[1]);
+        const __m128 one = _mm_set1_ps(1.0f), zero = _mm_setzero_ps(), snorm = _mm_set1_ps(1.0f / 32767.0f);
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        for (; i + 4 <= h.vertexCount; i += 4)
+        {
+            __m128 x = _mm_add_ps(_mm_mul_ps(loadU16(px + i), sx), ox);
+            __m128 y = _mm_add_ps(_mm_mul_ps(loadU16(px + padded + i), sy), oy);
+            __m128 z = _mm_add_ps(_mm_mul_ps(loadU16(px + 2 * (size_t)padded + i), sz), oz);
+            __m128 nnx = zero, nny = zero, nnz = zero, u = zero, v = zero;
+            if (hasNormals)
+            {
+                // octahedral decode: z = 1 - |x| - |y|, fold the lower hemisphere back, normalise
+                __m128 ex = _mm_mul_ps(loadS16(nx + i), snorm);
+                __m128 ey = _mm_mul_ps(loadS16(nx + padded + i), snorm);
+                __m128 ax = _mm_andnot_ps(signMask, ex), ay = _mm_andnot_ps(signMask, ey);
+                nnz = _mm_sub_ps(_mm_sub_ps(one, ax), ay);
+                __m128 lower = _mm_cmplt_ps(nnz, zero);
+                __m128 fx = _mm_or_ps(_mm_sub_ps(one, ay), _mm_and_ps(signMask, ex));
+                __m128 fy = _mm_or_ps(_mm_sub_ps(one, ax), _mm_and_ps(signMask, ey));
+                nnx = _mm_or_ps(_mm_and_ps(lower, fx), _mm_andnot_ps(lower, ex));
+                nny = _mm_or_ps(_mm_and_ps(lower, fy), _mm_andnot_ps(lower, ey));
+                __m128 length2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nnx, nnx), _mm_mul_ps(nny, nny)), _mm_mul_ps(nnz, nnz));
+                __m128 inv = _mm_div_ps(one, _mm_sqrt_ps(length2));
+                nnx = _mm_mul_ps(nnx, inv);
+                nny = _mm_mul_ps(nny, inv);
+                nnz = _mm_mul_ps(nnz, inv);
+            }
+            if (hasTexcoords)
+            {
+                u = _mm_add_ps(_mm_mul_ps(loadU16(tx + i), su), ou);
+                v = _mm_add_ps(_mm_mul_ps(loadU16(tx + padded + i), sv), ov);
+            }
+            float *o = out + (size_t)i * stride;
+            if (stride == 8)
+            {
+                // position+normal+uv is exactly two float4 per vertex: two 4x4 transposes
+                __m128 a0 = x, a1 = y, a2 = z, a3 = nnx;
+                __m128 b0 = nny, b1 = nnz, b2 = u, b3 = v;
+                _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+                _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+                _mm_storeu_ps(o + 0, a0);  _mm_storeu_ps(o + 4, b0);
+                _mm_storeu_ps(o + 8, a1);  _mm_storeu_ps(o + 12, b1);
+                _mm_storeu_ps(o + 16, a2); _mm_storeu_ps(o + 20, b2);
+                _mm_storeu_ps(o + 24, a3); _mm_storeu_ps(o + 28, b3);
+            }
+            else
+            {
+                alignas(16) float lanes[8][4];
+                _mm_store_ps(lanes[0], x);   _mm_store_ps(lanes[1], y);   _mm_store_ps(lanes[2], z);
+                _mm_store_ps(lanes[3], nnx); _mm_store_ps(lanes[4], nny); _mm_store_ps(lanes[5], nnz);
+                _mm_store_ps(lanes[6], u);   _mm_store_ps(lanes[7], v);
+                for (int k = 0; k < 4; k++, o += stride)
+                {
+                    int c = 0;
+                    o[c++] = lanes[0][k]; o[c++] = lanes[1][k]; o[c++] = lanes[2][k];
+                    if (hasNormals)
+                    {
+                        o[c++] = lanes[3][k]; o[c++] = lanes[4][k]; o[c++] = lanes[5][k];
+                    }
+                    if (hasTexcoords)
+                    {
+                        o[c++] = lanes[6][k]; o[c++] = lanes[7][k];
+                    }
+                }
+            }
+        }
+#endif
+        // scalar tail (and the whole mesh without SSE2)
+        for (; i < h.vertexCount; i++)
+        {
+            float *o = out + (size_t)i * stride;
+            for (int c = 0; c < 3; c++)
+                *o++ = px[(size_t)c * padded + i] * scale[c] + h.boundsMin[c];
+            if (hasNormals)
+            {
+                octDecode(nx[i], nx[(size_t)padded + i], o);
+                o += 3;
+            }
+            if (hasTexcoords)
+                for (int c = 0; c < 2; c++)
+                    *o++ = tx[(size_t)c * padded + i] * uvScale[c] + h.uvMin[c];
+        }
+        return true;
+    }
+
+    // decode the index stream into dst (indexCount 32-bit indices)
+    // ------------------------------------------------------------------------
+    static bool decodeIndices(const unsigned char *data, size_t size, uint32_t *dst)
+    {
+        EncodedMeshHeader h;
+        if (!readHeader(data, size, h))
+        {
+            std::cout << "ERROR::MESH_CODEC::INVALID_STREAM" << std::endl;
+            return false;
+        }
+        const unsigned char *p = data + sizeof(EncodedMeshHeader) + vertexStreamBytes(h);
+        const unsigned char *end = p + h.indexStreamSize;
+        int64_t previous = 0;
+        for (uint32_t i = 0; i < h.indexCount; i++)
+        {
+            uint64_t zigzag = 0;
+            int shift = 0;
+            unsigned char byte;
+            do
+            {
+                if (p == end || shift > 63)
+                {
+                    std::cout << "ERROR::MESH_CODEC::TRUNCATED_INDEX_STREAM" << std::endl;
+                    return false;
+                }
+                byte = *p++;
+                zigzag |= (uint64_t)(byte & 0x7F) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+            previous += (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+            dst[i] = (uint32_t)previous;
+        }
+        return true;
+    }
+
+private:
+    // vertexCount rounded up to a multiple of 4, in 64 bits so that it cannot wrap to 0
+    static uint64_t paddedCount(uint64_t vertexCount)
+    {
+        return (vertexCount + 3) & ~(uint64_t)3;
+    }
+    static uint64_t vertexStreamBytes(const EncodedMeshHeader &h)
+    {
+        uint64_t perVertex = 3 * sizeof(uint16_t);
+        if (h.flags & MESH_CODEC_NORMALS)
+            perVertex += 2 * sizeof(int16_t);
+        if (h.flags & MESH_CODEC_TEXCOORDS)
+            perVertex += 2 * sizeof(uint16_t);
+        return (uint64_t)h.paddedVertexCount * perVertex;
+    }
+    static const MeshAttribute* find(const MeshData &mesh, uint32_t location, uint32_t components)
+    {
+        for (const MeshAttribute &attribute : mesh.attributes)
+            if (attribute.location == location && attribute.type == MESH_TYPE_FLOAT && attribute.components == components)
+                return &attribute;
+        return NULL;
+    }
+    static void read(const MeshData &mesh, uint32_t vertex, const MeshAttribute &attribute, int components, float *out)
+    {
+        std::memcpy(out, &mesh.vertices[(size_t)vertex * mesh.vertexStride + attribute.offset], components * sizeof(float));
+    }
+    static void append(std::vector<unsigned char> &out, const void *data, size_t bytes)
+    {
+        out.insert(out.end(), (const unsigned char*)data, (const unsigned char*)data + bytes);
+    }
+    static uint16_t quantize(float value, float lo, float hi)
+    {
+        if (hi <= lo)
+            return 0;
+        float t = (value - lo) / (hi - lo);
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        return (uint16_t)std::lround(t * 65535.0f);
+    }
+    static void octEncode(const float n[3], int16_t *outX, int16_t *outY)
+    {
+        float sum = std::fabs(n[0]) + std::fabs(n[1]) + std::fabs(n[2]);
+        float x = sum > 0.0f ? n[0] / sum : 0.0f;
+        float y = sum > 0.0f ? n[1] / sum : 0.0f;
+        if (n[2] < 0.0f)
+        {
+            float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            float fy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = fx;
+            y = fy;
+        }
+        *outX = (int16_t)std::lround(std::fmax(-1.0f, std::fmin(1.0f, x)) * 32767.0f);
+        *outY = (int16_t)std::lround(std::fmax(-1.0f, std::fmin(1.0f, y)) * 32767.0f);
+    }
+    static void octDecode(int16_t ex, int16_t ey, float *n)
+    {
+        float x = ex / 32767.0f, y = ey / 32767.0f;
+        float z = 1.0f - std::fabs(x) - std::fabs(y);
+        if (z < 0.0f)
+        {
+            float fx = std::copysign(1.0f - std::fabs(y), x);
+            float fy = std::copysign(1.0f - std::fabs(x), y);
+            x = fx;
+            y = fy;
+        }
+        float inv = 1.0f / std::sqrt(x * x + y * y + z * z);
+        n[0] = x * inv;
+        n[1] = y * inv;
+        n[2] = z * inv;
+    }
+#ifdef MESH_CODEC_SSE2
+    static __m128 loadU16(const uint16_t *p)
+    {
+        __m128i v = _mm_loadl_epi64((const __m128i*)p);
+        return _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128()));
+    }
+    static __m128 loadS16(const int16_t *p)
+    {
+        __m128i v = _mm_loadl_epi64((const __m128i*)p);
+        return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+    }
+#endif
+};
+#endif
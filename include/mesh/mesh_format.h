@@ -0,0 +1,199 @@
+#ifndef MESH_FORMAT_H
+#define MESH_FORMAT_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// On-disk layout of a .mesh file. Everything the renderer needs to set up a VAO is described by the
+// header, so a loader can mmap the file and hand the vertex/index blocks straight to glBufferData.
+//
+//   MeshHeader | MeshAttribute[attributeCount] | SubMesh[subMeshCount] | vertex data | index data
+//
+// The vertex and index blocks start on MESH_DATA_ALIGNMENT byte boundaries. All values are
+// little-endian; the header records its own size so old readers can reject newer files.
+// GL enums are stored by value (0x1406 GL_FLOAT etc.) so this header does not need glad.
+
+const char MESH_MAGIC[4] = { 'T', 'M', 'S', 'H' };
+const uint32_t MESH_VERSION = 1;
+const uint32_t MESH_DATA_ALIGNMENT = 64;
+
+const uint32_t MESH_TYPE_UNSIGNED_BYTE  = 0x1401; // GL_UNSIGNED_BYTE
+const uint32_t MESH_TYPE_SHORT          = 0x1402; // GL_SHORT
+const uint32_t MESH_TYPE_UNSIGNED_SHORT = 0x1403; // GL_UNSIGNED_SHORT
+const uint32_t MESH_TYPE_UNSIGNED_INT   = 0x1405; // GL_UNSIGNED_INT
+const uint32_t MESH_TYPE_FLOAT          = 0x1406; // GL_FLOAT
+
+// attribute locations used across the project's shaders
+enum MeshAttributeLocation
+{
+    MESH_ATTRIBUTE_POSITION = 0,
+    MESH_ATTRIBUTE_NORMAL   = 1, // colour in the oldBuilds triangles, normal for imported meshes
+    MESH_ATTRIBUTE_TEXCOORD = 2
+};
+
+struct MeshHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t flags;
+    uint32_t vertexCount;
+    uint32_t vertexStride;   // bytes per interleaved vertex
+    uint32_t indexCount;
+    uint32_t indexType;      // MESH_TYPE_UNSIGNED_SHORT or MESH_TYPE_UNSIGNED_INT
+    uint32_t attributeCount;
+    uint32_t subMeshCount;
+    float    boundsMin[3];
+    float    boundsMax[3];
+    uint64_t vertexDataOffset;
+    uint64_t vertexDataSize;
+    uint64_t indexDataOffset;
+    uint64_t indexDataSize;
+};
+
+// one glVertexAttribPointer call
+struct MeshAttribute
+{
+    uint32_t location;
+    uint32_t components;
+    uint32_t type;
+    uint32_t normalized;
+    uint32_t offset;         // byte offset inside the vertex
+};
+
+// a range of the index buffer drawn with one glDrawElementsBaseVertex
+struct SubMesh
+{
+    uint32_t indexOffset;    // in indices, not bytes
+    uint32_t indexCount;
+    uint32_t baseVertex;
+    uint32_t materialIndex;
+    float    boundsMin[3];
+    float    boundsMax[3];
+};
+
+// In-memory mesh as produced by importers and consumed by writeMesh()
+struct MeshData
+{
+    uint32_t vertexStride = 0;
+    std::vector<MeshAttribute> attributes;
+    std::vector<SubMesh> subMeshes;
+    std::vector<unsigned char> vertices; // interleaved, vertexStride bytes each
+    std::vector<uint32_t> indices;
+
+    uint32_t vertexCount() const
+    {
+        return vertexStride ? (uint32_t)(vertices.size() / vertexStride) : 0;
+    }
+};
+
+inline uint64_t alignMeshOffset(uint64_t offset)
+{
+    return (offset + MESH_DATA_ALIGNMENT - 1) & ~(uint64_t)(MESH_DATA_ALIGNMENT - 1);
+}
+
+// compute position bounds for the whole mesh and each sub-mesh (position is always a float3 attribute)
+// ------------------------------------------------------------------------
+inline void computeMeshBounds(const MeshData &mesh, float boundsMin[3], float boundsMax[3], std::vector<SubMesh> &subMeshes)
+{
+    uint32_t positionOffset = 0;
+    for (const MeshAttribute &attribute : mesh.attributes)
+        if (attribute.location == MESH_ATTRIBUTE_POSITION)
+            positionOffset = attribute.offset;
+    for (int i = 0; i < 3; i++)
+    {
+        boundsMin[i] = mesh.vertexCount() ? 3.4e38f : 0.0f;
+        boundsMax[i] = mesh.vertexCount() ? -3.4e38f : 0.0f;
+    }
+    float p[3];
+    for (SubMesh &subMesh : subMeshes)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            subMesh.boundsMin[i] = 3.4e38f;
+            subMesh.boundsMax[i] = -3.4e38f;
+        }
+        for (uint32_t i = 0; i < subMesh.indexCount; i++)
+        {
+            uint32_t vertex = subMesh.baseVertex + mesh.indices[subMesh.indexOffset + i];
+            std::memcpy(p, &mesh.vertices[(size_t)vertex * mesh.vertexStride + positionOffset], sizeof(p));
+            for (int c = 0; c < 3; c++)
+            {
+                if (p[c] < subMesh.boundsMin[c]) subMesh.boundsMin[c] = p[c];
+                if (p[c] > subMesh.boundsMax[c]) subMesh.boundsMax[c] = p[c];
+            }
+        }
+    }
+    for (uint32_t v = 0; v < mesh.vertexCount(); v++)
+    {
+        std::memcpy(p, &mesh.vertices[(size_t)v * mesh.vertexStride + positionOffset], sizeof(p));
+        for (int c = 0; c < 3; c++)
+        {
+            if (p[c] < boundsMin[c]) boundsMin[c] = p[c];
+            if (p[c] > boundsMax[c]) boundsMax[c] = p[c];
+        }
+    }
+}
+
+// write a .mesh file; indices are narrowed to 16 bit when every sub-mesh allows it
+// ------------------------------------------------------------------------
+inline bool writeMesh(const MeshData &mesh, const std::string &path)
+{
+    std::vector<SubMesh> subMeshes = mesh.subMeshes;
+    if (subMeshes.empty())
+    {
+        SubMesh all = {};
+        all.indexCount = (uint32_t)mesh.indices.size();
+        subMeshes.push_back(all);
+    }
+
+    MeshHeader header = {};
+    std::memcpy(header.magic, MESH_MAGIC, sizeof(header.magic));
+    header.version = MESH_VERSION;
+    header.headerSize = sizeof(MeshHeader);
+    header.vertexCount = mesh.vertexCount();
+    header.vertexStride = mesh.vertexStride;
+    header.indexCount = (uint32_t)mesh.indices.size();
+    header.indexType = MESH_TYPE_UNSIGNED_SHORT;
+    for (size_t i = 0; i < mesh.indices.size(); i++)
+        if (mesh.indices[i] > 0xFFFF)
+            header.indexType = MESH_TYPE_UNSIGNED_INT;
+    header.attributeCount = (uint32_t)mesh.attributes.size();
+    header.subMeshCount = (uint32_t)subMeshes.size();
+    computeMeshBounds(mesh, header.boundsMin, header.boundsMax, subMeshes);
+
+    uint64_t tablesEnd = sizeof(MeshHeader) + sizeof(MeshAttribute) * mesh.attributes.size() + sizeof(SubMesh) * subMeshes.size();
+    header.vertexDataOffset = alignMeshOffset(tablesEnd);
+    header.vertexDataSize = mesh.vertices.size();
+    header.indexDataOffset = alignMeshOffset(header.vertexDataOffset + header.vertexDataSize);
+    header.indexDataSize = (uint64_t)mesh.indices.size() * (header.indexType == MESH_TYPE_UNSIGNED_INT ? 4 : 2);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        std::cout << "ERROR::MESH::FILE_NOT_WRITABLE: " << path << std::endl;
+        return false;
+    }
+    const char padding[MESH_DATA_ALIGNMENT] = {};
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)mesh.attributes.data(), sizeof(MeshAttribute) * mesh.attributes.size());
+    file.write((const char*)subMeshes.data(), sizeof(SubMesh) * subMeshes.size());
+    file.write(padding, (std::streamsize)(header.vertexDataOffset - tablesEnd));
+    file.write((const char*)mesh.vertices.data(), (std::streamsize)mesh.vertices.size());
+    file.write(padding, (std::streamsize)(header.indexDataOffset - header.vertexDataOffset - header.vertexDataSize));
+    if (header.indexType == MESH_TYPE_UNSIGNED_INT)
+    {
+        file.write((const char*)mesh.indices.data(), (std::streamsize)header.indexDataSize);
+    }
+    else
+    {
+        std::vector<uint16_t> narrow(mesh.indices.begin(), mesh.indices.end());
+        file.write((const char*)narrow.data(), (std::streamsize)header.indexDataSize);
+    }
+    return (bool)file;
+}
+#endif
@@ -0,0 +1,236 @@
+#ifndef OBJ_LOADER_H
+#define OBJ_LOADER_H
+
+#include <mesh/mesh_format.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Wavefront OBJ reader producing an interleaved MeshData:
+// position (location 0), then normal (location 1) and texcoord (location 2) when the file has them.
+// Polygons of any size are fan-triangulated, each "usemtl"/"o"/"g" starts a new sub-mesh, and
+// identical v/vt/vn triples are merged into one vertex. A face referring to a v, vt or vn that
+// doesn't exist (yet) rejects the whole file.
+class ObjLoader
+{
+public:
+    static bool load(const std::string &path, MeshData &mesh)
+    {
+        std::string text;
+        std::ifstream file;
+        file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        try
+        {
+            file.open(path, std::ios::binary);
+            std::stringstream stream;
+            stream << file.rdbuf();
+            file.close();
+            text = stream.str();
+        }
+        catch (std::ifstream::failure& e)
+        {
+            std::cout << "ERROR::OBJ::FILE_NOT_SUCCESSFULLY_READ: " << e.what() << std::endl;
+            return false;
+        }
+        return parse(text.c_str(), mesh);
+    }
+
+    static bool parse(const char *text, MeshData &mesh)
+    {
+        std::vector<float> positions, normals, texcoords;
+        std::vector<Corner> corners; // three per triangle
+        std::vector<Corner> polygon; // scratch for the face being read
+        std::vector<uint32_t> groupStarts(1, 0);
+        const char *p = text;
+        while (*p)
+        {
+            p = skipSpace(p);
+            if (p[0] == 'v' && p[1] == ' ')
+                p = readFloats(p + 2, 3, positions);
+            else if (p[0] == 'v' && p[1] == 'n' && p[2] == ' ')
+                p = readFloats(p + 3, 3, normals);
+            else if (p[0] == 'v' && p[1] == 't' && p[2] == ' ')
+                p = readFloats(p + 3, 2, texcoords);
+            else if (p[0] == 'f' && p[1] == ' ')
+            {
+                p = readFace(p + 2, positions.size() / 3, texcoords.size() / 2, normals.size() / 3, polygon, corners);
+                if (!p)
+                {
+                    std::cout << "ERROR::OBJ::INDEX_OUT_OF_RANGE" << std::endl;
+                    return false;
+                }
+            }
+            else if (((p[0] == 'o' || p[0] == 'g') && p[1] == ' ') || std::strncmp(p, "usemtl ", 7) == 0)
+            {
+                if (groupStarts.back() != corners.size())
+                    groupStarts.push_back((uint32_t)corners.size());
+            }
+            p = skipLine(p);
+        }
+        if (corners.empty())
+        {
+            std::cout << "ERROR::OBJ::NO_FACES" << std::endl;
+            return false;
+        }
+
+        bool hasNormals = !normals.empty(), hasTexcoords = !texcoords.empty();
+        mesh = MeshData();
+        mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_POSITION, 3, MESH_TYPE_FLOAT, 0, 0 });
+        mesh.vertexStride = 3 * sizeof(float);
+        if (hasNormals)
+        {
+            mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_NORMAL, 3, MESH_TYPE_FLOAT, 0, mesh.vertexStride });
+            mesh.vertexStride += 3 * sizeof(float);
+        }
+        if (hasTexcoords)
+        {
+            mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_TEXCOORD, 2, MESH_TYPE_FLOAT, 0, mesh.vertexStride });
+            mesh.vertexStride += 2 * sizeof(float);
+        }
+
+        std::unordered_map<Corner, uint32_t, CornerHash> unique;
+        unique.reserve(positions.size() / 3);
+        mesh.indices.reserve(corners.size());
+        groupStarts.push_back((uint32_t)corners.size());
+        for (size_t g = 0; g + 1 < groupStarts.size(); g++)
+        {
+            SubMesh subMesh = {};
+            subMesh.indexOffset = (uint32_t)mesh.indices.size();
+            subMesh.indexCount = groupStarts[g + 1] - groupStarts[g];
+            subMesh.materialIndex = (uint32_t)g;
+            for (uint32_t c = groupStarts[g]; c < groupStarts[g + 1]; c++)
+            {
+                const Corner &corner = corners[c];
+                std::unordered_map<Corner, uint32_t, CornerHash>::iterator it = unique.find(corner);
+                if (it == unique.end())
+                {
+                    uint32_t index = mesh.vertexCount();
+                    it = unique.emplace(corner, index).first;
+                    appendVertex(mesh, &positions[(size_t)corner.v * 3],
+                        hasNormals ? (corner.vn >= 0 ? &normals[(size_t)corner.vn * 3] : ZERO) : NULL,
+                        hasTexcoords ? (corner.vt >= 0 ? &texcoords[(size_t)corner.vt * 2] : ZERO) : NULL);
+                }
+                mesh.indices.push_back(it->second);
+            }
+            if (subMesh.indexCount)
+                mesh.subMeshes.push_back(subMesh);
+        }
+        return true;
+    }
+
+private:
+    struct Corner
+    {
+        int32_t v, vt, vn; // zero based, -1 when missing
+
+        bool operator==(const Corner &other) const
+        {
+            return v == other.v && vt == other.vt && vn == other.vn;
+        }
+    };
+    struct CornerHash
+    {
+        size_t operator()(const Corner &c) const
+        {
+            uint64_t h = (uint64_t)(uint32_t)c.v * 0x9E3779B97F4A7C15ull;
+            h ^= (uint64_t)(uint32_t)c.vt * 0xC2B2AE3D27D4EB4Full + (h >> 29);
+            h ^= (uint64_t)(uint32_t)c.vn * 0x165667B19E3779F9ull + (h >> 32);
+            return (size_t)h;
+        }
+    };
+    static constexpr float ZERO[3] = { 0.0f, 0.0f, 0.0f };
+
+    static const char* skipSpace(const char *p)
+    {
+        while (*p == ' ' || *p == '\t')
+            p++;
+        return p;
+    }
+    static const char* skipLine(const char *p)
+    {
+        while (*p && *p != '\n')
+            p++;
+        return *p ? p + 1 : p;
+    }
+    static const char* readFloats(const char *p, int count, std::vector<float> &out)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            char *end;
+            out.push_back(std::strtof(p, &end));
+            p = end;
+        }
+        return p;
+    }
+    // resolve a (possibly negative, relative) OBJ index to zero based, -1 when out of range
+    static int32_t resolve(long index, size_t count)
+    {
+        long resolved = index < 0 ? (long)count + index : index - 1;
+        return resolved >= 0 && resolved < (long)count ? (int32_t)resolved : -1;
+    }
+    // NULL when a corner refers to a v, vt or vn out of range
+    static const char* readFace(const char *p, size_t vCount, size_t vtCount, size_t vnCount, std::vector<Corner> &polygon, std::vector<Corner> &corners)
+    {
+        polygon.clear();
+        p = skipSpace(p);
+        while (*p && *p != '\n' && *p != '\r' && *p != '#')
+        {
+            char *end;
+            Corner corner = { -1, -1, -1 };
+            bool hasVt = false, hasVn = false;
+            corner.v = resolve(std::strtol(p, &end, 10), vCount);
+            if (end == p)
+                return NULL;
+            p = end;
+            if (*p == '/')
+            {
+                p++;
+                if (*p != '/')
+                {
+                    corner.vt = resolve(std::strtol(p, &end, 10), vtCount);
+                    hasVt = true;
+                    p = end;
+                }
+                if (*p == '/')
+                {
+                    corner.vn = resolve(std::strtol(p + 1, &end, 10), vnCount);
+                    hasVn = true;
+                    p = end;
+                }
+            }
+            if (corner.v < 0 || (hasVt && corner.vt < 0) || (hasVn && corner.vn < 0))
+                return NULL;
+            polygon.push_back(corner);
+            p = skipSpace(p);
+        }
+        for (size_t i = 2; i < polygon.size(); i++)
+        {
+            corners.push_back(polygon[0]);
+            corners.push_back(polygon[i - 1]);
+            corners.push_back(polygon[i]);
+        }
+        return p;
+    }
+    static void appendVertex(MeshData &mesh, const float *position, const float *normal, const float *texcoord)
+    {
+        size_t at = mesh.vertices.size();
+        mesh.vertices.resize(at + mesh.vertexStride);
+        unsigned char *dst = &mesh.vertices[at];
+        std::memcpy(dst, position, 3 * sizeof(float));
+        dst += 3 * sizeof(float);
+        if (normal)
+        {
+            std::memcpy(dst, normal, 3 * sizeof(float));
+            dst += 3 * sizeof(float);
+        }
+        if (texcoord)
+            std::memcpy(dst, texcoord, 2 * sizeof(float));
+    }
+};
+#endif
@@ -0,0 +1,96 @@
+#ifndef ROCK_MESH_H
+#define ROCK_MESH_H
+
+#include <math/vector.h>
+#include <mesh/mesh_format.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// A generated boulder for the level-of-detail demo and benchmark: an icosahedron subdivided
+// subdivisions times (20 * 4^subdivisions triangles, one closed surface with shared vertices)
+// and pushed in and out along its directions by a sum of random waves, squashed a little in y.
+// Interleaved position and normal (locations 0 and 1), radius about 1 around the origin.
+// ------------------------------------------------------------------------
+inline void generateRockMesh(MeshData &mesh, int subdivisions, unsigned seed = 1)
+{
+    const int WAVES = 12;
+    std::vector<math::vec3> directions;
+    std::vector<uint32_t> triangles;
+    const float t = 1.6180340f; // the golden ratio
+    const math::vec3 corners[12] = { { -1, t, 0 }, { 1, t, 0 }, { -1, -t, 0 }, { 1, -t, 0 }, { 0, -1, t }, { 0, 1, t },
+                                     { 0, -1, -t }, { 0, 1, -t }, { t, 0, -1 }, { t, 0, 1 }, { -t, 0, -1 }, { -t, 0, 1 } };
+    const uint32_t faces[60] = { 0, 11, 5, 0, 5, 1, 0, 1, 7, 0, 7, 10, 0, 10, 11, 1, 5, 9, 5, 11, 4, 11, 10, 2, 10, 7, 6, 7, 1, 8,
+                                 3, 9, 4, 3, 4, 2, 3, 2, 6, 3, 6, 8, 3, 8, 9, 4, 9, 5, 2, 4, 11, 6, 2, 10, 8, 6, 7, 9, 8, 1 };
+    for (const math::vec3 &c : corners)
+        directions.push_back(math::normalize(c));
+    triangles.assign(faces, faces + 60);
+    for (int s = 0; s < subdivisions; s++)
+    {
+        // each edge split once: its midpoint is shared by the triangles on both sides
+        std::unordered_map<uint64_t, uint32_t> midpoints;
+        auto midpoint = [&](uint32_t a, uint32_t b) {
+            uint64_t key = a < b ? (uint64_t)a << 32 | b : (uint64_t)b << 32 | a;
+            std::unordered_map<uint64_t, uint32_t>::iterator it = midpoints.find(key);
+            if (it != midpoints.end())
+                return it->second;
+            directions.push_back(math::normalize(directions[a] + directions[b]));
+            return midpoints[key] = (uint32_t)directions.size() - 1;
+        };
+        std::vector<uint32_t> split;
+        split.reserve(triangles.size() * 4);
+        for (size_t i = 0; i < triangles.size(); i += 3)
+        {
+            uint32_t a = triangles[i], b = triangles[i + 1], c = triangles[i + 2];
+            uint32_t ab = midpoint(a, b), bc = midpoint(b, c), ca = midpoint(c, a);
+            uint32_t four[12] = { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca };
+            split.insert(split.end(), four, four + 12);
+        }
+        triangles.swap(split);
+    }
+
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    math::vec3 waveAxis[WAVES];
+    float waveFrequency[WAVES], wavePhase[WAVES], waveAmplitude[WAVES];
+    for (int w = 0; w < WAVES; w++)
+    {
+        waveAxis[w] = math::normalize(math::vec3(unit(random), unit(random), unit(random)) + math::vec3(0.0f, 0.0f, 1e-3f));
+        waveFrequency[w] = 2.0f + 2.0f * w;
+        wavePhase[w] = 3.1415927f * unit(random);
+        waveAmplitude[w] = 0.25f / (1.0f + w) * (0.75f + 0.25f * unit(random));
+    }
+    std::vector<math::vec3> positions(directions.size()), normals(directions.size());
+    for (size_t v = 0; v < directions.size(); v++)
+    {
+        float radius = 1.0f;
+        for (int w = 0; w < WAVES; w++)
+            radius += waveAmplitude[w] * std::sin(waveFrequency[w] * math::dot(directions[v], waveAxis[w]) + wavePhase[w]);
+        positions[v] = directions[v] * radius * math::vec3(1.0f, 0.75f, 1.0f);
+    }
+    for (size_t i = 0; i < triangles.size(); i += 3)
+    {
+        const math::vec3 &a = positions[triangles[i]], &b = positions[triangles[i + 1]], &c = positions[triangles[i + 2]];
+        math::vec3 normal = math::cross(b - a, c - a); // area weighted
+        for (int k = 0; k < 3; k++)
+            normals[triangles[i + k]] += normal;
+    }
+
+    mesh = MeshData();
+    mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_POSITION, 3, MESH_TYPE_FLOAT, 0, 0 });
+    mesh.attributes.push_back(MeshAttribute{ MESH_ATTRIBUTE_NORMAL, 3, MESH_TYPE_FLOAT, 0, 3 * sizeof(float) });
+    mesh.vertexStride = 6 * sizeof(float);
+    mesh.vertices.resize(positions.size() * mesh.vertexStride);
+    for (size_t v = 0; v < positions.size(); v++)
+    {
+        math::vec3 normal = math::normalize(normals[v]);
+        std::memcpy(&mesh.vertices[v * mesh.vertexStride], &positions[v].x, 3 * sizeof(float));
+        std::memcpy(&mesh.vertices[v * mesh.vertexStride + 3 * sizeof(float)], &normal.x, 3 * sizeof(float));
+    }
+    mesh.indices = triangles;
+}
+#endif
@@ -0,0 +1,450 @@
+#ifndef MESH_SIMPLIFIER_H
+#define MESH_SIMPLIFIER_H
+
+#include <math/vector.h>
+#include <mesh/mesh_format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// Quadric error simplification (Garland and Heckbert) for level-of-detail chains. An edge
+// collapses onto one of its two vertices, never to a new position, so every level is an index
+// list over the original vertices and their attributes: a chain is one vertex buffer and an
+// index range per level.
+//
+// Each vertex carries the planes of the triangles around it as a quadric, area weighted, plus
+// planes standing on border edges so that open borders keep their shape. Collapsing a vertex
+// onto another costs the weighted mean squared distance from the kept position to the planes
+// of both. The collapses run in passes: a pass sorts the edges by cost and takes the cheapest
+// whose neighbourhood no earlier collapse of the pass has touched, skipping any that would fold
+// a triangle over or pinch the surface. Border vertices only slide along the border; vertices on
+// attribute seams (a position shared by several vertices) and on non-manifold edges stay.
+//
+//   std::vector<MeshLod> levels = buildLodChain(mesh, 8);   // mesh.indices now holds every level
+//   glDrawElements(GL_TRIANGLES, levels[2].indexCount, GL_UNSIGNED_INT, (void*)(levels[2].indexOffset * sizeof(uint32_t)));
+class MeshSimplifier
+{
+public:
+    // float3 positions stride bytes apart; the indices are copied
+    // ------------------------------------------------------------------------
+    MeshSimplifier(const void *positions, size_t stride, size_t vertexCount, const uint32_t *indices, size_t indexCount)
+        : points(vertexCount), quadrics(vertexCount), remap(vertexCount), kinds(vertexCount, MANIFOLD), current(indices, indices + indexCount)
+    {
+        for (size_t v = 0; v < vertexCount; v++)
+        {
+            std::memcpy(&points[v].x, (const unsigned char*)positions + v * stride, sizeof(math::vec3));
+            remap[v] = (uint32_t)v;
+        }
+        lockSeams();
+        for (size_t t = 0; t < triangleCount(); t++)
+        {
+            const uint32_t *corner = &current[t * 3];
+            math::vec3 normal = math::cross(points[corner[1]] - points[corner[0]], points[corner[2]] - points[corner[0]]);
+            float area = math::length(normal);
+            if (area <= 0.0f)
+                continue;
+            normal = normal / area;
+            for (int c = 0; c < 3; c++)
+                addPlane(quadrics[corner[c]], normal, -math::dot(normal, points[corner[0]]), area * 0.5f);
+        }
+        addBorderPlanes();
+    }
+
+    // collapse edges until at most targetTriangles are left or the next collapse would have an
+    // error above maxError (in mesh units); returns the triangles left, which can be more than
+    // targetTriangles when no valid collapse remains. Can be called again to go further.
+    // ------------------------------------------------------------------------
+    size_t simplify(size_t targetTriangles, float maxError = std::numeric_limits<float>::infinity())
+    {
+        double maxCost = (double)maxError * maxError;
+        while (triangleCount() > targetTriangles)
+            if (!pass(targetTriangles, maxCost))
+                break;
+        return triangleCount();
+    }
+
+    const std::vector<uint32_t>& indices() const { return current; }
+    size_t triangleCount() const { return current.size() / 3; }
+    // the largest error of the collapses so far: the root of their cost, in mesh units
+    float error() const { return (float)std::sqrt(largestCost); }
+
+    // the largest distance from an original vertex to the triangles now near the vertex it
+    // collapsed into (around it and its neighbours), in mesh units: what the quadrics estimate,
+    // measured, as they average the planes and so underestimate the worst spots
+    // ------------------------------------------------------------------------
+    float deviation()
+    {
+        buildAdjacency();
+        float largest = 0.0f;
+        for (size_t v = 0; v < points.size(); v++)
+        {
+            uint32_t kept = (uint32_t)v;
+            while (remap[kept] != kept)
+                kept = remap[kept];
+            remap[v] = kept;
+            ring(kept, ringFrom);
+            ringFrom.push_back(kept);
+            float nearest = firstTriangle[kept] < firstTriangle[kept + 1] ? std::numeric_limits<float>::infinity() : 0.0f;
+            for (uint32_t w : ringFrom)
+                for (uint32_t i = firstTriangle[w]; i < firstTriangle[w + 1]; i++)
+                {
+                    const uint32_t *corner = &current[triangleList[i] * 3];
+                    nearest = std::min(nearest, distance(points[v], points[corner[0]], points[corner[1]], points[corner[2]]));
+                }
+            largest = std::max(largest, nearest);
+        }
+        return largest;
+    }
+
+private:
+    enum Kind : uint8_t
+    {
+        MANIFOLD,
+        BORDER,     // on an edge of one triangle: collapses only along such edges
+        LOCKED      // on a seam or a non-manifold edge: never collapses
+    };
+
+    // the planes' outer products (a symmetric 4x4 over x, y, z and 1) and their total weight
+    struct Quadric
+    {
+        double xx = 0, xy = 0, xz = 0, xw = 0, yy = 0, yz = 0, yw = 0, zz = 0, zw = 0, ww = 0, weight = 0;
+    };
+
+    struct Collapse
+    {
+        float cost;
+        uint32_t from, to;
+        bool operator<(const Collapse &other) const { return cost < other.cost; }
+    };
+
+    static constexpr float BORDER_WEIGHT = 10.0f;   // how much more a border resists moving than the surface
+
+    std::vector<math::vec3> points;
+    std::vector<Quadric> quadrics;
+    std::vector<uint32_t> remap;            // each vertex, or the one it collapsed onto
+    std::vector<Kind> kinds;
+    std::vector<uint32_t> current;
+    double largestCost = 0.0;
+
+    // scratch, kept between passes
+    std::vector<uint64_t> edges;
+    std::vector<uint32_t> firstTriangle, triangleList, fill;   // the triangles around each vertex
+    std::vector<Collapse> collapses;
+    std::vector<uint8_t> touched;
+    std::vector<uint32_t> ringFrom, ringTo;
+
+    static void addPlane(Quadric &q, math::vec3 n, float d, float weight)
+    {
+        double a = n.x, b = n.y, c = n.z, e = d, w = weight;
+        q.xx += w * a * a; q.xy += w * a * b; q.xz += w * a * c; q.xw += w * a * e;
+        q.yy += w * b * b; q.yz += w * b * c; q.yw += w * b * e;
+        q.zz += w * c * c; q.zw += w * c * e;
+        q.ww += w * e * e;
+        q.weight += w;
+    }
+    // weighted mean squared distance of p to the planes of a and b together
+    static double cost(const Quadric &a, const Quadric &b, math::vec3 p)
+    {
+        double x = p.x, y = p.y, z = p.z;
+        double sum = (a.xx + b.xx) * x * x + (a.yy + b.yy) * y * y + (a.zz + b.zz) * z * z + (a.ww + b.ww)
+                   + 2.0 * ((a.xy + b.xy) * x * y + (a.xz + b.xz) * x * z + (a.yz + b.yz) * y * z)
+                   + 2.0 * ((a.xw + b.xw) * x + (a.yw + b.yw) * y + (a.zw + b.zw) * z);
+        double weight = a.weight + b.weight;
+        return weight > 0.0 && sum > 0.0 ? sum / weight : 0.0;
+    }
+    static void add(Quadric &a, const Quadric &b)
+    {
+        a.xx += b.xx; a.xy += b.xy; a.xz += b.xz; a.xw += b.xw;
+        a.yy += b.yy; a.yz += b.yz; a.yw += b.yw;
+        a.zz += b.zz; a.zw += b.zw;
+        a.ww += b.ww;
+        a.weight += b.weight;
+    }
+    // from p to the closest point of the triangle abc (Ericson, by the region p projects into)
+    static float distance(math::vec3 p, math::vec3 a, math::vec3 b, math::vec3 c)
+    {
+        math::vec3 ab = b - a, ac = c - a, ap = p - a, bp = p - b, cp = p - c;
+        float d1 = math::dot(ab, ap), d2 = math::dot(ac, ap), d3 = math::dot(ab, bp), d4 = math::dot(ac, bp), d5 = math::dot(ab, cp), d6 = math::dot(ac, cp);
+        if (d1 <= 0.0f && d2 <= 0.0f)
+            return math::length(ap);
+        if (d3 >= 0.0f && d4 <= d3)
+            return math::length(bp);
+        if (d6 >= 0.0f && d5 <= d6)
+            return math::length(cp);
+        float vc = d1 * d4 - d3 * d2, vb = d5 * d2 - d1 * d6, va = d3 * d6 - d5 * d4;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+            return math::length(p - (a + ab * (d1 / (d1 - d3))));
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+            return math::length(p - (a + ac * (d2 / (d2 - d6))));
+        if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+            return math::length(p - (b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)))));
+        float scale = 1.0f / (va + vb + vc);
+        return math::length(p - (a + ab * (vb * scale) + ac * (vc * scale)));
+    }
+    static uint64_t edgeKey(uint32_t a, uint32_t b)
+    {
+        return a < b ? (uint64_t)a << 32 | b : (uint64_t)b << 32 | a;
+    }
+
+    // vertices sharing a position (split normals or texcoords) are locked, so the seam stays closed
+    // ------------------------------------------------------------------------
+    void lockSeams()
+    {
+        std::vector<uint32_t> order(points.size());
+        for (size_t v = 0; v < order.size(); v++)
+            order[v] = (uint32_t)v;
+        auto less = [&](uint32_t a, uint32_t b) {
+            const math::vec3 &p = points[a], &q = points[b];
+            return p.x != q.x ? p.x < q.x : p.y != q.y ? p.y < q.y : p.z < q.z;
+        };
+        std::sort(order.begin(), order.end(), less);
+        for (size_t i = 1; i < order.size(); i++)
+            if (points[order[i]] == points[order[i - 1]])
+                kinds[order[i]] = kinds[order[i - 1]] = LOCKED;
+    }
+
+    // the sorted edge keys of the current triangles, each once per triangle using it
+    void collectEdges()
+    {
+        edges.clear();
+        for (size_t t = 0; t < triangleCount(); t++)
+            for (int c = 0; c < 3; c++)
+                edges.push_back(edgeKey(current[t * 3 + c], current[t * 3 + (c + 1) % 3]));
+        std::sort(edges.begin(), edges.end());
+    }
+
+    // a plane through each border edge, perpendicular to its triangle
+    // ------------------------------------------------------------------------
+    void addBorderPlanes()
+    {
+        collectEdges();
+        for (size_t t = 0; t < triangleCount(); t++)
+        {
+            const uint32_t *corner = &current[t * 3];
+            math::vec3 normal = math::cross(points[corner[1]] - points[corner[0]], points[corner[2]] - points[corner[0]]);
+            for (int c = 0; c < 3; c++)
+            {
+                uint32_t a = corner[c], b = corner[(c + 1) % 3];
+                uint64_t key = edgeKey(a, b);
+                std::vector<uint64_t>::iterator first = std::lower_bound(edges.begin(), edges.end(), key);
+                if (first + 1 != edges.end() && first[1] == key)
+                    continue;
+                math::vec3 edge = points[b] - points[a], side = math::cross(edge, normal);
+                float length = math::length(side);
+                if (length <= 0.0f)
+                    continue;
+                side = side / length;
+                float weight = BORDER_WEIGHT * math::dot(edge, edge);
+                addPlane(quadrics[a], side, -math::dot(side, points[a]), weight);
+                addPlane(quadrics[b], side, -math::dot(side, points[a]), weight);
+            }
+        }
+    }
+
+    // triangleList[firstTriangle[v] .. firstTriangle[v + 1]) are the triangles using v
+    void buildAdjacency()
+    {
+        size_t vertexCount = points.size();
+        firstTriangle.assign(vertexCount + 1, 0);
+        for (uint32_t v : current)
+            firstTriangle[v + 1]++;
+        for (size_t v = 0; v < vertexCount; v++)
+            firstTriangle[v + 1] += firstTriangle[v];
+        triangleList.resize(current.size());
+        fill.assign(firstTriangle.begin(), firstTriangle.end() - 1);
+        for (size_t i = 0; i < current.size(); i++)
+            triangleList[fill[current[i]]++] = (uint32_t)(i / 3);
+    }
+
+    // the vertices of the triangles around v, other than v, sorted
+    void ring(uint32_t v, std::vector<uint32_t> &out) const
+    {
+        out.clear();
+        for (uint32_t i = firstTriangle[v]; i < firstTriangle[v + 1]; i++)
+            for (int c = 0; c < 3; c++)
+            {
+                uint32_t w = current[triangleList[i] * 3 + c];
+                if (w != v)
+                    out.push_back(w);
+            }
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    // from onto to keeps the surface a manifold (the two rings share only the vertices opposite
+    // their shared edge) and turns no triangle of from over
+    // ------------------------------------------------------------------------
+    bool valid(uint32_t from, uint32_t to)
+    {
+        ring(from, ringFrom);
+        ring(to, ringTo);
+        size_t common = 0, shared = 0;
+        for (size_t i = 0, j = 0; i < ringFrom.size() && j < ringTo.size();)
+        {
+            if (ringFrom[i] < ringTo[j])
+                i++;
+            else if (ringTo[j] < ringFrom[i])
+                j++;
+            else
+            {
+                common++;
+                i++;
+                j++;
+            }
+        }
+        for (uint32_t i = firstTriangle[from]; i < firstTriangle[from + 1]; i++)
+        {
+            const uint32_t *corner = &current[triangleList[i] * 3];
+            if (corner[0] == to || corner[1] == to || corner[2] == to)
+            {
+                shared++;
+                continue;
+            }
+            math::vec3 p[3], q[3];
+            for (int c = 0; c < 3; c++)
+            {
+                p[c] = points[corner[c]];
+                q[c] = corner[c] == from ? points[to] : p[c];
+            }
+            math::vec3 before = math::cross(p[1] - p[0], p[2] - p[0]), after = math::cross(q[1] - q[0], q[2] - q[0]);
+            if (math::dot(before, after) <= 1e-3f * math::length(before) * math::length(after))
+                return false;
+        }
+        return common == shared;
+    }
+
+    // one round of independent collapses; false when none was possible
+    // ------------------------------------------------------------------------
+    bool pass(size_t targetTriangles, double maxCost)
+    {
+        size_t vertexCount = points.size();
+        collectEdges();
+        for (size_t v = 0; v < vertexCount; v++)
+            if (kinds[v] == BORDER)
+                kinds[v] = MANIFOLD;
+        for (size_t i = 0; i < edges.size();)
+        {
+            size_t end = i + 1;
+            while (end < edges.size() && edges[end] == edges[i])
+                end++;
+            uint32_t a = (uint32_t)(edges[i] >> 32), b = (uint32_t)edges[i];
+            Kind kind = end - i == 1 ? BORDER : end - i > 2 ? LOCKED : MANIFOLD;
+            if (kind != MANIFOLD)
+                for (uint32_t v : { a, b })
+                    if (kinds[v] != LOCKED)
+                        kinds[v] = kind;
+            i = end;
+        }
+
+        buildAdjacency();
+
+        collapses.clear();
+        for (size_t i = 0; i < edges.size();)
+        {
+            size_t end = i + 1;
+            while (end < edges.size() && edges[end] == edges[i])
+                end++;
+            uint32_t a = (uint32_t)(edges[i] >> 32), b = (uint32_t)edges[i];
+            size_t uses = end - i;
+            i = end;
+            if (uses > 2)
+                continue;
+            bool border = uses == 1;
+            Collapse best = { std::numeric_limits<float>::infinity(), 0, 0 };
+            for (int direction = 0; direction < 2; direction++)
+            {
+                uint32_t from = direction ? b : a, to = direction ? a : b;
+                if (kinds[from] == LOCKED || (kinds[from] == BORDER && !border))
+                    continue;
+                float c = (float)cost(quadrics[from], quadrics[to], points[to]);
+                if (c < best.cost)
+                    best = { c, from, to };
+            }
+            if (best.cost <= maxCost)
+                collapses.push_back(best);
+        }
+        std::sort(collapses.begin(), collapses.end());
+
+        touched.assign(vertexCount, 0);
+        size_t triangles = triangleCount(), done = 0;
+        for (const Collapse &collapse : collapses)
+        {
+            if (triangles <= targetTriangles)
+                break;
+            if (touched[collapse.from] || touched[collapse.to] || !valid(collapse.from, collapse.to))
+                continue;
+            remap[collapse.from] = collapse.to;
+            add(quadrics[collapse.to], quadrics[collapse.from]);
+            largestCost = std::max(largestCost, (double)collapse.cost);
+            touched[collapse.from] = touched[collapse.to] = 1;
+            for (uint32_t v : ringFrom)
+                touched[v] = 1;
+            for (uint32_t i = firstTriangle[collapse.from]; i < firstTriangle[collapse.from + 1]; i++)
+            {
+                const uint32_t *corner = &current[triangleList[i] * 3];
+                triangles -= corner[0] == collapse.to || corner[1] == collapse.to || corner[2] == collapse.to;
+            }
+            done++;
+        }
+        if (!done)
+            return false;
+
+        size_t kept = 0;
+        for (size_t t = 0; t < triangleCount(); t++)
+        {
+            uint32_t a = remap[current[t * 3]], b = remap[current[t * 3 + 1]], c = remap[current[t * 3 + 2]];
+            if (a == b || b == c || c == a)
+                continue;
+            current[kept++] = a;
+            current[kept++] = b;
+            current[kept++] = c;
+        }
+        current.resize(kept);
+        return true;
+    }
+};
+
+// one level of a chain: a range of MeshData::indices and its error, the deviation() from the
+// mesh as it was in mesh units (never less than the level before's)
+struct MeshLod
+{
+    uint32_t indexOffset;
+    uint32_t indexCount;
+    float error;
+};
+
+// replace mesh.indices with a chain of levels, the mesh as it was first and each next one about
+// ratio of the triangles of the one before, simplified from it; stops at maxLevels, below
+// minTriangles, or when simplification stalls (only locked vertices or folds left). The sub-meshes
+// are simplified together, so a level is drawn as one range.
+// ------------------------------------------------------------------------
+inline std::vector<MeshLod> buildLodChain(MeshData &mesh, int maxLevels, float ratio = 0.5f, size_t minTriangles = 32)
+{
+    uint32_t positionOffset = 0;
+    for (const MeshAttribute &attribute : mesh.attributes)
+        if (attribute.location == MESH_ATTRIBUTE_POSITION)
+            positionOffset = attribute.offset;
+    std::vector<MeshLod> levels(1, MeshLod{ 0, (uint32_t)mesh.indices.size(), 0.0f });
+    if (!mesh.vertexCount())
+        return levels;
+    MeshSimplifier simplifier(&mesh.vertices[positionOffset], mesh.vertexStride, mesh.vertexCount(), mesh.indices.data(), mesh.indices.size());
+    std::vector<uint32_t> chain = mesh.indices;
+    while ((int)levels.size() < maxLevels)
+    {
+        size_t previous = levels.back().indexCount / 3, target = (size_t)(previous * ratio);
+        if (target < minTriangles)
+            break;
+        size_t reached = simplifier.simplify(target);
+        if (reached > previous * (1.0f + ratio) * 0.5f)
+            break;
+        levels.push_back(MeshLod{ (uint32_t)chain.size(), (uint32_t)(reached * 3), std::max(levels.back().error, simplifier.deviation()) });
+        chain.insert(chain.end(), simplifier.indices().begin(), simplifier.indices().end());
+    }
+    mesh.indices.swap(chain);
+    return levels;
+}
+#endif
@@ -0,0 +1,505 @@
+#ifndef RASTER_BINNED_RASTERIZER_H
+#define RASTER_BINNED_RASTERIZER_H
+
+#include <core/job_system.h>
+#include <raster/framebuffer.h>
+#include <raster/pipeline.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define BINNED_RASTERIZER_AVX2
+#include <immintrin.h>
+#endif
+
+// Multithreaded variant of Rasterizer, with the same API, pipeline and fill rules, for scenes
+// with many triangles. A draw runs in two parallel phases on a JobSystem:
+//
+//   setup   chunks of SETUP_CHUNK triangles are shaded, clipped and set up (integer edge
+//           functions, float planes for depth and the varyings) and binned into the
+//           TILE_SIZE x TILE_SIZE screen tiles their edges overlap
+//   raster  every tile is a job that walks the bins of all chunks in submission order, so
+//           triangles land in each pixel in draw order without locks
+//
+// Inside a tile triangles are rasterised in 8x8 blocks: a block outside any edge is skipped,
+// edges it is entirely inside of are not evaluated, and the remaining ones are evaluated 8
+// pixels at a time with AVX2 (chosen at run time), followed by the depth test, shading and
+// colour packing per row of 8. Program::fragment8 shades the row in one call when set,
+// otherwise the fragment shader runs per covered pixel. setSimd(false) uses the scalar path,
+// which writes the same pixels (bit for bit, unless the compiler contracts its arithmetic
+// into FMAs, e.g. with -march=native).
+//
+//   JobSystem jobs;
+//   BinnedRasterizer raster(target, jobs);
+//   raster.vertexAttribPointer(0, 3, 6 * sizeof(float), vertices);
+//   raster.useProgram(program);
+//   raster.drawArrays(0, triangles * 3);
+//
+// Coverage matches Rasterizer exactly; interpolated values come from per-triangle planes
+// rather than per-pixel barycentrics and can differ from it in the last bit. Setup data and
+// bins keep their capacity between draws. Draw from the JobSystem's creating thread.
+class BinnedRasterizer : public RasterPipeline
+{
+public:
+    static const int TILE_SIZE = 64;
+    static const int BLOCK_SIZE = 8;
+    static const int SETUP_CHUNK = 4096;
+
+    BinnedRasterizer(Framebuffer &target, JobSystem &jobSystem) : jobs(jobSystem)
+    {
+        setFramebuffer(target);
+#ifdef BINNED_RASTERIZER_AVX2
+        avx2 = __builtin_cpu_supports("avx2");
+#endif
+        simd = avx2;
+    }
+
+    // the viewport is reset to the whole target, as with a new GL context
+    // ------------------------------------------------------------------------
+    void setFramebuffer(Framebuffer &target)
+    {
+        framebuffer = &target;
+        viewport(0, 0, target.width(), target.height());
+    }
+    void viewport(int x, int y, int width, int height)
+    {
+        view[0] = x;
+        view[1] = y;
+        view[2] = width;
+        view[3] = height;
+    }
+    void enableDepthTest(bool enable)
+    {
+        depthTest = enable;
+    }
+
+    // AVX2 edge evaluation and shading, on by default where the CPU supports it
+    // ------------------------------------------------------------------------
+    void setSimd(bool enable)
+    {
+        simd = enable && avx2;
+    }
+    bool simdEnabled() const { return simd; }
+    bool simdSupported() const { return avx2; }
+
+    // size floats per vertex at pointer, stride bytes apart (0: tightly packed)
+    // ------------------------------------------------------------------------
+    void vertexAttribPointer(int index, int size, size_t stride, const void *pointer)
+    {
+        Attribute &attribute = attributes[index];
+        attribute.size = size;
+        attribute.stride = stride ? stride : size * sizeof(float);
+        attribute.data = (const unsigned char*)pointer;
+    }
+    void disableVertexAttribArray(int index)
+    {
+        attributes[index].data = nullptr;
+    }
+    void useProgram(const Program &newProgram)
+    {
+        program = newProgram;
+    }
+
+    // GL_TRIANGLES from the attribute arrays; returns when the framebuffer is written
+    // ------------------------------------------------------------------------
+    void drawArrays(size_t first, size_t count)
+    {
+        draw(nullptr, first, count / 3);
+    }
+    void drawElements(const uint32_t *indices, size_t count)
+    {
+        draw(indices, 0, count / 3);
+    }
+
+    const Stats &stats() const { return counters; }
+    void resetStats()
+    {
+        counters = Stats();
+    }
+
+private:
+    // edge i at pixel (x, y) is edge[i] + stepX[i] * x + stepY[i] * y, >= 0 inside: Rasterizer's
+    // edge function with the fill rule bias, divided by the subpixel scale (floored, so the sign
+    // is kept) to evaluate in 32 bits near the triangle
+    struct SetupTriangle
+    {
+        int box[4];         // pixels x0, y0, x1, y1, inclusive
+        int64_t edge[3];
+        int32_t stepX[3];
+        int32_t stepY[3];
+        uint32_t planes;    // index of the chunk's plane floats: z, 1 / w, then varying / w
+    };
+
+    struct BinEntry
+    {
+        uint32_t tile;
+        uint32_t triangle;
+    };
+
+    struct Chunk
+    {
+        std::vector<SetupTriangle> triangles;
+        std::vector<float> planes;
+        std::vector<BinEntry> entries;
+        std::vector<uint32_t> binStart; // tile t: binned[binStart[t]] .. binned[binStart[t + 1] - 1]
+        std::vector<uint32_t> binned;
+        Stats stats;
+    };
+
+    void draw(const uint32_t *indices, size_t first, size_t triangles)
+    {
+        if (triangles == 0)
+            return;
+        tilesX = (framebuffer->width() + TILE_SIZE - 1) / TILE_SIZE;
+        tilesY = (framebuffer->height() + TILE_SIZE - 1) / TILE_SIZE;
+        size_t tileCount = (size_t)tilesX * tilesY;
+        chunkCount = (triangles + SETUP_CHUNK - 1) / SETUP_CHUNK;
+        if (chunks.size() < chunkCount)
+            chunks.resize(chunkCount);
+
+        jobs.parallelFor(0, chunkCount, 1, [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; c++)
+                setupChunk(chunks[c], indices, first, c * SETUP_CHUNK, std::min(triangles, (c + 1) * SETUP_CHUNK));
+        });
+        tileStats.assign(tileCount, Stats());
+        jobs.parallelFor(0, tileCount, 1, [this](size_t begin, size_t end) {
+            for (size_t t = begin; t < end; t++)
+                rasterizeTile(t);
+        });
+
+        for (size_t c = 0; c < chunkCount; c++)
+        {
+            counters.triangles += chunks[c].stats.triangles;
+            counters.rasterized += chunks[c].stats.rasterized;
+        }
+        for (const Stats &tile : tileStats)
+        {
+            counters.fragments += tile.fragments;
+            counters.pixels += tile.pixels;
+        }
+    }
+
+    // setup phase
+    // ------------------------------------------------------------------------
+    void setupChunk(Chunk &chunk, const uint32_t *indices, size_t first, size_t begin, size_t end)
+    {
+        chunk.triangles.clear();
+        chunk.planes.clear();
+        chunk.entries.clear();
+        chunk.stats = Stats();
+        ClipVertex v[3];
+        for (size_t t = begin; t < end; t++)
+        {
+            for (int k = 0; k < 3; k++)
+                shadeVertex(attributes, program, indices ? indices[t * 3 + k] : first + t * 3 + k, v[k]);
+            chunk.stats.triangles++;
+            clip(v[0], v[1], v[2], program.varyings, [&](const ClipVertex &a, const ClipVertex &b, const ClipVertex &c) {
+                setupTriangle(chunk, a, b, c);
+            });
+        }
+        bin(chunk);
+    }
+
+    void setupTriangle(Chunk &chunk, const ClipVertex &a, const ClipVertex &b, const ClipVertex &c)
+    {
+        ScreenVertex v[3];
+        int64_t area = project(a, b, c, view, v);
+        if (area == 0)
+            return;
+        chunk.stats.rasterized++;
+        SetupTriangle triangle;
+        if (!pixelBounds(v, view, framebuffer->width(), framebuffer->height(), triangle.box))
+            return;
+
+        const int64_t one = 1 << SUBPIXEL_BITS, half = one / 2;
+        for (int i = 0; i < 3; i++)
+        {
+            const ScreenVertex &from = v[(i + 1) % 3], &to = v[(i + 2) % 3];
+            int64_t dx = to.x - from.x, dy = to.y - from.y;
+            triangle.edge[i] = floorDiv(dx * (half - from.y) - dy * (half - from.x) + edgeBias(dx, dy), one);
+            triangle.stepX[i] = (int32_t)-dy;
+            triangle.stepY[i] = (int32_t)dx;
+        }
+
+        triangle.planes = (uint32_t)chunk.planes.size();
+        chunk.planes.resize(chunk.planes.size() + (2 + program.varyings) * PLANE_FLOATS);
+        setupPlanes(v, area, triangle.box, program.varyings, &chunk.planes[triangle.planes]);
+        chunk.triangles.push_back(triangle);
+    }
+
+    // counting sort of (tile, triangle) pairs into per-tile lists, keeping triangle order
+    // ------------------------------------------------------------------------
+    void bin(Chunk &chunk)
+    {
+        for (uint32_t i = 0; i < chunk.triangles.size(); i++)
+        {
+            const SetupTriangle &triangle = chunk.triangles[i];
+            int tx0 = triangle.box[0] / TILE_SIZE, tx1 = triangle.box[2] / TILE_SIZE;
+            int ty0 = triangle.box[1] / TILE_SIZE, ty1 = triangle.box[3] / TILE_SIZE;
+            for (int ty = ty0; ty <= ty1; ty++)
+                for (int tx = tx0; tx <= tx1; tx++)
+                {
+                    int rect[4];
+                    clipToTile(triangle, tx, ty, rect);
+                    if ((tx0 == tx1 && ty0 == ty1) || overlaps(triangle, rect))
+                        chunk.entries.push_back({ (uint32_t)(ty * tilesX + tx), i });
+                }
+        }
+        size_t tileCount = (size_t)tilesX * tilesY;
+        chunk.binStart.assign(tileCount + 1, 0);
+        for (const BinEntry &entry : chunk.entries)
+            chunk.binStart[entry.tile + 1]++;
+        for (size_t t = 0; t < tileCount; t++)
+            chunk.binStart[t + 1] += chunk.binStart[t];
+        chunk.binned.resize(chunk.entries.size());
+        // binStart[t] is tile t's write cursor, ending at the start of tile t + 1
+        for (const BinEntry &entry : chunk.entries)
+            chunk.binned[chunk.binStart[entry.tile]++] = entry.triangle;
+        for (size_t t = tileCount; t > 0; t--)
+            chunk.binStart[t] = chunk.binStart[t - 1];
+        chunk.binStart[0] = 0;
+    }
+
+    void clipToTile(const SetupTriangle &triangle, int tx, int ty, int *rect) const
+    {
+        rect[0] = std::max(triangle.box[0], tx * TILE_SIZE);
+        rect[1] = std::max(triangle.box[1], ty * TILE_SIZE);
+        rect[2] = std::min(triangle.box[2], tx * TILE_SIZE + TILE_SIZE - 1);
+        rect[3] = std::min(triangle.box[3], ty * TILE_SIZE + TILE_SIZE - 1);
+    }
+
+    // false if a whole rectangle of pixels is outside one of the edges
+    static bool overlaps(const SetupTriangle &triangle, const int *rect)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            int64_t highest = triangle.edge[i] + (int64_t)triangle.stepX[i] * (triangle.stepX[i] > 0 ? rect[2] : rect[0])
+                                               + (int64_t)triangle.stepY[i] * (triangle.stepY[i] > 0 ? rect[3] : rect[1]);
+            if (highest < 0)
+                return false;
+        }
+        return true;
+    }
+
+    // raster phase
+    // ------------------------------------------------------------------------
+    void rasterizeTile(size_t tile)
+    {
+        int tx = (int)(tile % tilesX), ty = (int)(tile / tilesX);
+        Stats stats;
+        for (size_t c = 0; c < chunkCount; c++)
+        {
+            const Chunk &chunk = chunks[c];
+            for (uint32_t j = chunk.binStart[tile]; j < chunk.binStart[tile + 1]; j++)
+            {
+                const SetupTriangle &triangle = chunk.triangles[chunk.binned[j]];
+                const float *planes = &chunk.planes[triangle.planes];
+                int rect[4];
+                clipToTile(triangle, tx, ty, rect);
+#ifdef BINNED_RASTERIZER_AVX2
+                if (simd)
+                {
+                    rasterizeAvx2(triangle, planes, rect, stats);
+                    continue;
+                }
+#endif
+                rasterizeScalar(triangle, planes, rect, stats);
+            }
+        }
+        tileStats[tile] = stats;
+    }
+
+    // the edges crossing the block at (x, y) (indices in crossing[], values at the block's
+    // corner in edge[]) and their count, or -1 if the block is outside the triangle
+    static int classifyBlock(const SetupTriangle &triangle, int x, int y, int *crossing, int32_t *edge)
+    {
+        const int64_t last = BLOCK_SIZE - 1;
+        int count = 0;
+        for (int i = 0; i < 3; i++)
+        {
+            int64_t stepX = triangle.stepX[i], stepY = triangle.stepY[i];
+            int64_t corner = triangle.edge[i] + stepX * x + stepY * y;
+            if (corner + std::max<int64_t>(stepX, 0) * last + std::max<int64_t>(stepY, 0) * last < 0)
+                return -1;
+            if (corner + std::min<int64_t>(stepX, 0) * last + std::min<int64_t>(stepY, 0) * last < 0)
+            {
+                crossing[count] = i;
+                edge[count++] = (int32_t)corner; // between the block's extremes, which differ by < 2^27
+            }
+        }
+        return count;
+    }
+
+    void rasterizeScalar(const SetupTriangle &triangle, const float *planes, const int *rect, Stats &stats)
+    {
+        const int width = framebuffer->width();
+        uint32_t *pixels = framebuffer->pixels();
+        float *depth = framebuffer->depth();
+        const int varyings = program.varyings;
+        float interpolated[MAX_VARYINGS];
+        float color[4];
+        for (int by = rect[1] & ~(BLOCK_SIZE - 1); by <= rect[3]; by += BLOCK_SIZE)
+            for (int bx = rect[0] & ~(BLOCK_SIZE - 1); bx <= rect[2]; bx += BLOCK_SIZE)
+            {
+                int crossing[3];
+                int32_t edge[3];
+                int edges = classifyBlock(triangle, bx, by, crossing, edge);
+                if (edges < 0)
+                    continue;
+                int x0 = std::max(bx, rect[0]), x1 = std::min(bx + BLOCK_SIZE - 1, rect[2]);
+                int y0 = std::max(by, rect[1]), y1 = std::min(by + BLOCK_SIZE - 1, rect[3]);
+                for (int y = y0; y <= y1; y++)
+                    for (int x = x0; x <= x1; x++)
+                    {
+                        bool inside = true;
+                        for (int e = 0; e < edges; e++)
+                            inside = inside && edge[e] + triangle.stepX[crossing[e]] * (x - bx) + triangle.stepY[crossing[e]] * (y - by) >= 0;
+                        if (!inside)
+                            continue;
+                        stats.fragments++;
+                        float fx = (float)(x - triangle.box[0]), fy = (float)(y - triangle.box[1]);
+                        size_t index = (size_t)y * width + x;
+                        float z = plane(planes, 0, fx, fy);
+                        if (depthTest && !(z < depth[index]))
+                            continue;
+                        float w = 1.0f / plane(planes, 1, fx, fy);
+                        for (int k = 0; k < varyings; k++)
+                            interpolated[k] = plane(planes, 2 + k, fx, fy) * w;
+                        program.fragment(interpolated, program.uniforms, color);
+                        pixels[index] = Framebuffer::pack(color[0], color[1], color[2], color[3]);
+                        if (depthTest)
+                            depth[index] = z;
+                        stats.pixels++;
+                    }
+            }
+    }
+
+#ifdef BINNED_RASTERIZER_AVX2
+    // rasterizeScalar a row of 8 pixels at a time; mul and add rather than FMA keep the results
+    // identical to it
+    // ------------------------------------------------------------------------
+    __attribute__((target("avx2")))
+    void rasterizeAvx2(const SetupTriangle &triangle, const float *planes, const int *rect, Stats &stats)
+    {
+        const int width = framebuffer->width();
+        uint32_t *pixels = framebuffer->pixels();
+        float *depth = framebuffer->depth();
+        const int planeCount = 2 + program.varyings;
+        alignas(32) float interpolated[MAX_VARYINGS * SIMD_WIDTH];
+        alignas(32) float color[4 * SIMD_WIDTH];
+        float fragmentVaryings[MAX_VARYINGS];
+        float fragmentColor[4];
+        __m256 rowStart[2 + MAX_VARYINGS];
+        const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i minusOne = _mm256_set1_epi32(-1);
+        const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f), scale = _mm256_set1_ps(255.0f);
+        for (int by = rect[1] & ~(BLOCK_SIZE - 1); by <= rect[3]; by += BLOCK_SIZE)
+            for (int bx = rect[0] & ~(BLOCK_SIZE - 1); bx <= rect[2]; bx += BLOCK_SIZE)
+            {
+                int crossing[3];
+                int32_t edge[3];
+                int edges = classifyBlock(triangle, bx, by, crossing, edge);
+                if (edges < 0)
+                    continue;
+                int x0 = std::max(bx, rect[0]), x1 = std::min(bx + BLOCK_SIZE - 1, rect[2]);
+                int y0 = std::max(by, rect[1]), y1 = std::min(by + BLOCK_SIZE - 1, rect[3]);
+                __m256i rowEdge[3], rowStep[3];
+                for (int e = 0; e < edges; e++)
+                {
+                    int i = crossing[e];
+                    rowEdge[e] = _mm256_add_epi32(_mm256_set1_epi32(edge[e] + triangle.stepY[i] * (y0 - by)),
+                                                  _mm256_mullo_epi32(lanes, _mm256_set1_epi32(triangle.stepX[i])));
+                    rowStep[e] = _mm256_set1_epi32(triangle.stepY[i]);
+                }
+                __m256i xs = _mm256_add_epi32(_mm256_set1_epi32(bx), lanes);
+                __m256i columns = _mm256_and_si256(_mm256_cmpgt_epi32(xs, _mm256_set1_epi32(x0 - 1)),
+                                                   _mm256_cmpgt_epi32(_mm256_set1_epi32(x1 + 1), xs));
+                __m256 fx = _mm256_cvtepi32_ps(_mm256_sub_epi32(xs, _mm256_set1_epi32(triangle.box[0])));
+                for (int p = 0; p < planeCount; p++)
+                {
+                    const float *coefficients = planes + p * PLANE_FLOATS;
+                    rowStart[p] = _mm256_add_ps(_mm256_set1_ps(coefficients[0]), _mm256_mul_ps(_mm256_set1_ps(coefficients[1]), fx));
+                }
+
+                for (int y = y0; y <= y1; y++)
+                {
+                    __m256i mask = columns;
+                    for (int e = 0; e < edges; e++)
+                    {
+                        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(rowEdge[e], minusOne));
+                        rowEdge[e] = _mm256_add_epi32(rowEdge[e], rowStep[e]);
+                    }
+                    int bits = _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+                    if (!bits)
+                        continue;
+                    stats.fragments += __builtin_popcount(bits);
+
+                    float fy = (float)(y - triangle.box[1]);
+                    size_t index = (size_t)y * width + bx;
+                    __m256 z = _mm256_add_ps(rowStart[0], _mm256_set1_ps(planes[2] * fy));
+                    if (depthTest)
+                    {
+                        __m256 stored = _mm256_maskload_ps(depth + index, mask);
+                        mask = _mm256_and_si256(mask, _mm256_castps_si256(_mm256_cmp_ps(z, stored, _CMP_LT_OQ)));
+                        bits = _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+                        if (!bits)
+                            continue;
+                    }
+                    __m256 w = _mm256_div_ps(one, _mm256_add_ps(rowStart[1], _mm256_set1_ps(planes[PLANE_FLOATS + 2] * fy)));
+                    for (int p = 2; p < planeCount; p++)
+                    {
+                        __m256 value = _mm256_add_ps(rowStart[p], _mm256_set1_ps(planes[p * PLANE_FLOATS + 2] * fy));
+                        _mm256_store_ps(interpolated + (p - 2) * SIMD_WIDTH, _mm256_mul_ps(value, w));
+                    }
+
+                    if (program.fragment8)
+                        program.fragment8(interpolated, program.uniforms, color);
+                    else
+                        for (int lane = 0; lane < SIMD_WIDTH; lane++)
+                        {
+                            if (!(bits & (1 << lane)))
+                                continue;
+                            for (int k = 0; k < planeCount - 2; k++)
+                                fragmentVaryings[k] = interpolated[k * SIMD_WIDTH + lane];
+                            program.fragment(fragmentVaryings, program.uniforms, fragmentColor);
+                            for (int c = 0; c < 4; c++)
+                                color[c * SIMD_WIDTH + lane] = fragmentColor[c];
+                        }
+
+                    // as Framebuffer::pack: clamp, scale, round to nearest even
+                    __m256i packed = _mm256_setzero_si256();
+                    for (int c = 0; c < 4; c++)
+                    {
+                        __m256 channel = _mm256_min_ps(_mm256_max_ps(_mm256_load_ps(color + c * SIMD_WIDTH), zero), one);
+                        __m256i bytes = _mm256_cvtps_epi32(_mm256_mul_ps(channel, scale));
+                        packed = _mm256_or_si256(packed, _mm256_slli_epi32(bytes, 8 * c));
+                    }
+                    _mm256_maskstore_epi32((int*)(pixels + index), mask, packed);
+                    if (depthTest)
+                        _mm256_maskstore_ps(depth + index, mask, z);
+                    stats.pixels += __builtin_popcount(bits);
+                }
+            }
+    }
+#endif
+
+    JobSystem &jobs;
+    Framebuffer *framebuffer;
+    int view[4] = { 0, 0, 0, 0 };
+    bool depthTest = false;
+    bool avx2 = false;
+    bool simd = false;
+    Attribute attributes[MAX_ATTRIBUTES];
+    Program program;
+    Stats counters;
+
+    int tilesX = 0;
+    int tilesY = 0;
+    size_t chunkCount = 0;
+    std::vector<Chunk> chunks;
+    std::vector<Stats> tileStats;
+};
+#endif
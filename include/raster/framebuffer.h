@@ -0,0 +1,101 @@
+#ifndef RASTER_FRAMEBUFFER_H
+#define RASTER_FRAMEBUFFER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Colour (RGBA8, bytes in r, g, b, a order on little-endian hosts) and depth (float) buffers
+// for the software rasteriser. Row 0 is the bottom row, as in GL, so pixels() compares
+// directly with what glReadPixels(GL_RGBA, GL_UNSIGNED_BYTE) returns.
+class Framebuffer
+{
+public:
+    Framebuffer(int width = 0, int height = 0)
+    {
+        resize(width, height);
+    }
+
+    void resize(int newWidth, int newHeight)
+    {
+        w = std::max(0, newWidth);
+        h = std::max(0, newHeight);
+        color.assign((size_t)w * h, 0);
+        depthBuffer.assign((size_t)w * h, 1.0f);
+    }
+    int width() const { return w; }
+    int height() const { return h; }
+
+    // as glClearColor + glClear(GL_COLOR_BUFFER_BIT)
+    // ------------------------------------------------------------------------
+    void clearColor(float r, float g, float b, float a)
+    {
+        std::fill(color.begin(), color.end(), pack(r, g, b, a));
+    }
+    void clearDepth(float depth = 1.0f)
+    {
+        std::fill(depthBuffer.begin(), depthBuffer.end(), depth);
+    }
+
+    uint32_t *pixels() { return color.data(); }
+    const uint32_t *pixels() const { return color.data(); }
+    float *depth() { return depthBuffer.data(); }
+    const float *depth() const { return depthBuffer.data(); }
+    uint32_t pixel(int x, int y) const
+    {
+        return color[(size_t)y * w + x];
+    }
+
+    // float colour to RGBA8 the way GL converts to a normalised format: clamp, scale, round
+    // (to nearest even in float, as Mesa does: 0.3 -> 76.5 -> 76)
+    // ------------------------------------------------------------------------
+    static uint32_t pack(float r, float g, float b, float a)
+    {
+        return (uint32_t)toByte(r) | (uint32_t)toByte(g) << 8 | (uint32_t)toByte(b) << 16 | (uint32_t)toByte(a) << 24;
+    }
+    static unsigned char toByte(float value)
+    {
+        value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+        // adding 1.5 * 2^23 leaves no fraction bits, so the FPU rounds to nearest even
+        float rounded = value * 255.0f + 12582912.0f;
+        return (unsigned char)(rounded - 12582912.0f);
+    }
+
+    // binary PPM (P6), top row first
+    // ------------------------------------------------------------------------
+    bool writePPM(const std::string &path) const
+    {
+        FILE *file = std::fopen(path.c_str(), "wb");
+        if (!file)
+        {
+            std::cout << "ERROR::FRAMEBUFFER::CANNOT_WRITE: " << path << std::endl;
+            return false;
+        }
+        std::fprintf(file, "P6\n%d %d\n255\n", w, h);
+        std::vector<unsigned char> row((size_t)w * 3);
+        for (int y = h - 1; y >= 0; y--)
+        {
+            const uint32_t *source = &color[(size_t)y * w];
+            for (int x = 0; x < w; x++)
+            {
+                row[x * 3 + 0] = (unsigned char)(source[x] & 0xFF);
+                row[x * 3 + 1] = (unsigned char)(source[x] >> 8 & 0xFF);
+                row[x * 3 + 2] = (unsigned char)(source[x] >> 16 & 0xFF);
+            }
+            std::fwrite(row.data(), 1, row.size(), file);
+        }
+        bool ok = std::ferror(file) == 0;
+        std::fclose(file);
+        return ok;
+    }
+
+private:
+    int w = 0;
+    int h = 0;
+    std::vector<uint32_t> color;
+    std::vector<float> depthBuffer;
+};
+#endif
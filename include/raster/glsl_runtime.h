@@ -0,0 +1,165 @@
+#ifndef RASTER_GLSL_RUNTIME_H
+#define RASTER_GLSL_RUNTIME_H
+
+#include <cmath>
+#include <cstring>
+
+// What the shaders generated by tools/glslc.py are compiled against. Their fragment shader
+// bodies are templates over the component type F: float for one fragment, or GlslFloat8 (a GCC
+// vector of RasterPipeline::SIMD_WIDTH floats) for fragment8, which the compiler turns into
+// SSE or, in the GLSL_AVX2 variant, AVX instructions. The built-ins below work for both, and
+// give the same result per lane as for float, so the scalar and 8-wide shaders agree exactly.
+#if defined(__GNUC__)
+#define GLSL_SIMD
+#define GLSL_INLINE inline __attribute__((always_inline))
+// everything taking or returning vectors is inlined, so the vector ABI never matters; not
+// popped, as the warning comes at the end of the including file where templates are instantiated
+#pragma GCC diagnostic ignored "-Wpsabi"
+typedef float GlslFloat8 __attribute__((vector_size(32)));
+typedef float GlslFloat8Unaligned __attribute__((vector_size(32), aligned(4)));
+#if defined(__x86_64__) || defined(__i386__)
+#include <xmmintrin.h>
+#define GLSL_AVX2 __attribute__((target("avx2")))
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+#define GLSL_SSE_SQRT
+#endif
+#endif
+#else
+#define GLSL_AVX2
+#endif
+#else
+#define GLSL_INLINE inline
+#endif
+
+// one value in every lane
+template <typename F>
+GLSL_INLINE F glslSplat(float value)
+{
+    return value;
+}
+#ifdef GLSL_SIMD
+template <>
+GLSL_INLINE GlslFloat8 glslSplat<GlslFloat8>(float value)
+{
+    return GlslFloat8{ value, value, value, value, value, value, value, value };
+}
+
+// whether fragment8 should take the AVX2 variant, checked once
+// ------------------------------------------------------------------------
+inline bool glslAvx2()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+// count SoA rows of 8 floats between the rasteriser's arrays and vectors
+GLSL_INLINE void glslLoad8(const float *source, GlslFloat8 *rows, int count)
+{
+    for (int k = 0; k < count; k++)
+        rows[k] = *(const GlslFloat8Unaligned*)(source + 8 * k);
+}
+GLSL_INLINE void glslStore8(const GlslFloat8 *rows, float *target, int count)
+{
+    for (int k = 0; k < count; k++)
+        *(GlslFloat8Unaligned*)(target + 8 * k) = rows[k];
+}
+#endif
+
+// built-ins, per component
+// ------------------------------------------------------------------------
+template <typename F>
+GLSL_INLINE F glslMin(const F &a, const F &b)
+{
+    return b < a ? b : a;
+}
+template <typename F>
+GLSL_INLINE F glslMax(const F &a, const F &b)
+{
+    return a < b ? b : a;
+}
+template <typename F>
+GLSL_INLINE F glslClamp(const F &x, const F &low, const F &high)
+{
+    return glslMin(glslMax(x, low), high);
+}
+template <typename F>
+GLSL_INLINE F glslMix(const F &x, const F &y, const F &a)
+{
+    return x * (glslSplat<F>(1.0f) - a) + y * a;
+}
+template <typename F>
+GLSL_INLINE F glslStep(const F &edge, const F &x)
+{
+    return x < edge ? glslSplat<F>(0.0f) : glslSplat<F>(1.0f);
+}
+template <typename F>
+GLSL_INLINE F glslAbs(const F &x)
+{
+    return x < glslSplat<F>(0.0f) ? -x : x;
+}
+template <typename F>
+GLSL_INLINE F glslSign(const F &x)
+{
+    F zero = glslSplat<F>(0.0f);
+    return zero < x ? glslSplat<F>(1.0f) : (x < zero ? glslSplat<F>(-1.0f) : zero);
+}
+
+// the rest go through <cmath>, lane by lane where SSE has no equivalent
+GLSL_INLINE float glslSqrt(float x)
+{
+    return std::sqrt(x);
+}
+GLSL_INLINE float glslFloor(float x)
+{
+    return std::floor(x);
+}
+GLSL_INLINE float glslPow(float x, float y)
+{
+    return std::pow(x, y);
+}
+#ifdef GLSL_SIMD
+GLSL_INLINE GlslFloat8 glslSqrt(const GlslFloat8 &x)
+{
+#ifdef GLSL_SSE_SQRT
+    // sqrtps on each half, which AVX code gets as vsqrtps with VEX encoding
+    __m128 low = _mm_sqrt_ps(__builtin_shufflevector(x, x, 0, 1, 2, 3));
+    __m128 high = _mm_sqrt_ps(__builtin_shufflevector(x, x, 4, 5, 6, 7));
+    return __builtin_shufflevector(low, high, 0, 1, 2, 3, 4, 5, 6, 7);
+#else
+    GlslFloat8 result = x;
+    for (int lane = 0; lane < 8; lane++)
+        result[lane] = std::sqrt(x[lane]);
+    return result;
+#endif
+}
+GLSL_INLINE GlslFloat8 glslFloor(const GlslFloat8 &value)
+{
+    GlslFloat8 x = value;
+    for (int lane = 0; lane < 8; lane++)
+        x[lane] = std::floor(x[lane]);
+    return x;
+}
+GLSL_INLINE GlslFloat8 glslPow(const GlslFloat8 &value, const GlslFloat8 &y)
+{
+    GlslFloat8 x = value;
+    for (int lane = 0; lane < 8; lane++)
+        x[lane] = std::pow(x[lane], y[lane]);
+    return x;
+}
+#endif
+template <typename F>
+GLSL_INLINE F glslInverseSqrt(const F &x)
+{
+    return glslSplat<F>(1.0f) / glslSqrt(x);
+}
+template <typename F>
+GLSL_INLINE F glslFract(const F &x)
+{
+    return x - glslFloor(x);
+}
+#endif
@@ -0,0 +1,268 @@
+#ifndef RASTER_PIPELINE_H
+#define RASTER_PIPELINE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// The parts of the software triangle pipeline shared by Rasterizer and BinnedRasterizer:
+// shader types, vertex fetch, clipping, the projection to fixed-point window coordinates and
+// the interpolation planes.
+class RasterPipeline
+{
+public:
+    static const int MAX_ATTRIBUTES = 4;
+    static const int MAX_VARYINGS = 12;
+    static const int SUBPIXEL_BITS = 8;
+    static const int SIMD_WIDTH = 8;
+    static const int PLANE_FLOATS = 3;
+
+    // attributes[i] points at 4 floats; writes the clip-space position (4 floats) and the varyings
+    typedef void (*VertexShader)(const float *const *attributes, const void *uniforms, float *position, float *varyings);
+    // interpolated varyings in, RGBA colour out
+    typedef void (*FragmentShader)(const float *varyings, const void *uniforms, float *color);
+    // the same for SIMD_WIDTH fragments at once, structure of arrays: varyings[k * 8 + lane],
+    // color[c * 8 + lane]; optional, the binned rasteriser uses it when set
+    typedef void (*FragmentShader8)(const float *varyings, const void *uniforms, float *color);
+
+    struct Program
+    {
+        VertexShader vertex = nullptr;
+        FragmentShader fragment = nullptr;
+        FragmentShader8 fragment8 = nullptr;
+        int varyings = 0; // floats passed from vertex to fragment shader, at most MAX_VARYINGS
+        const void *uniforms = nullptr;
+    };
+
+    struct Stats
+    {
+        unsigned long long triangles = 0;  // submitted
+        unsigned long long rasterized = 0; // after clipping, culling zero-area ones
+        unsigned long long fragments = 0;  // covered samples
+        unsigned long long pixels = 0;     // written after the depth test
+    };
+
+    // size floats per vertex at data, stride bytes apart; data == nullptr: disabled
+    struct Attribute
+    {
+        int size = 4;
+        size_t stride = 0;
+        const unsigned char *data = nullptr;
+    };
+
+    struct ClipVertex
+    {
+        float position[4];
+        float varyings[MAX_VARYINGS];
+    };
+
+    struct ScreenVertex
+    {
+        int64_t x, y;   // window coordinates, 24.8 fixed point
+        float z;        // window depth, [0, 1]
+        float invW;
+        const float *varyings;
+    };
+
+    // fetch vertex index (missing components are 0, 0, 0, 1 as in GL) and run the vertex shader
+    // ------------------------------------------------------------------------
+    static void shadeVertex(const Attribute *attributes, const Program &program, size_t index, ClipVertex &out)
+    {
+        float values[MAX_ATTRIBUTES][4];
+        const float *inputs[MAX_ATTRIBUTES];
+        for (int a = 0; a < MAX_ATTRIBUTES; a++)
+        {
+            float *value = values[a];
+            value[0] = value[1] = value[2] = 0.0f;
+            value[3] = 1.0f;
+            const Attribute &attribute = attributes[a];
+            if (attribute.data)
+            {
+                const float *source = (const float*)(attribute.data + index * attribute.stride);
+                for (int c = 0; c < attribute.size; c++)
+                    value[c] = source[c];
+            }
+            inputs[a] = value;
+        }
+        program.vertex(inputs, program.uniforms, out.position, out.varyings);
+    }
+
+    // clip against the six planes of the view volume, so x and y against the viewport's edges
+    // as GL drivers do (llvmpipe included): a guard band would keep more of each edge unclipped,
+    // and its snapped end points then differ from the driver's by a subpixel now and then.
+    // emit(a, b, c) gets every resulting triangle, none if it is outside
+    // ------------------------------------------------------------------------
+    template <typename Emit>
+    static void clip(const ClipVertex &a, const ClipVertex &b, const ClipVertex &c, int varyings, Emit &&emit)
+    {
+        unsigned codeA = outcode(a.position), codeB = outcode(b.position), codeC = outcode(c.position);
+        if (codeA & codeB & codeC)
+            return;
+        if ((codeA | codeB | codeC) == 0)
+        {
+            emit(a, b, c);
+            return;
+        }
+        // Sutherland-Hodgman against each plane a vertex is outside of, then a fan
+        ClipVertex buffers[2][3 + PLANES];
+        int count = 3;
+        buffers[0][0] = a;
+        buffers[0][1] = b;
+        buffers[0][2] = c;
+        int current = 0;
+        unsigned planes = codeA | codeB | codeC;
+        for (int plane = 0; plane < PLANES && count >= 3; plane++)
+        {
+            if (!(planes & (1u << plane)))
+                continue;
+            const ClipVertex *in = buffers[current];
+            ClipVertex *out = buffers[current ^ 1];
+            int outCount = 0;
+            for (int i = 0; i < count; i++)
+            {
+                const ClipVertex &p = in[i], &q = in[(i + 1) % count];
+                float dp = planeDistance(p.position, plane), dq = planeDistance(q.position, plane);
+                if (dp >= 0.0f)
+                    out[outCount++] = p;
+                if ((dp >= 0.0f) != (dq >= 0.0f))
+                {
+                    float t = dp / (dp - dq);
+                    ClipVertex &v = out[outCount++];
+                    for (int k = 0; k < 4; k++)
+                        v.position[k] = p.position[k] + t * (q.position[k] - p.position[k]);
+                    for (int k = 0; k < varyings; k++)
+                        v.varyings[k] = p.varyings[k] + t * (q.varyings[k] - p.varyings[k]);
+                }
+            }
+            count = outCount;
+            current ^= 1;
+        }
+        for (int i = 1; i + 1 < count; i++)
+            emit(buffers[current][0], buffers[current][i], buffers[current][i + 1]);
+    }
+
+    // perspective divide and viewport transform of a clipped triangle; turns it counter-
+    // clockwise (there is no face culling) and returns its doubled area in subpixels squared,
+    // 0 for a degenerate one. The transform is x / w * scale + translate, snapped to the subpixel
+    // grid with ties to even, in the order GL drivers evaluate it
+    // ------------------------------------------------------------------------
+    static int64_t project(const ClipVertex &a, const ClipVertex &b, const ClipVertex &c, const int *view, ScreenVertex *v)
+    {
+        const ClipVertex *clipped[3] = { &a, &b, &c };
+        const float scale = (float)(1 << SUBPIXEL_BITS);
+        for (int i = 0; i < 3; i++)
+        {
+            const float *p = clipped[i]->position;
+            if (!(p[3] > 0.0f))
+                return 0;
+            float invW = 1.0f / p[3];
+            float x = p[0] * invW * (0.5f * view[2]) + (view[0] + 0.5f * view[2]);
+            float y = p[1] * invW * (0.5f * view[3]) + (view[1] + 0.5f * view[3]);
+            v[i].x = (int64_t)std::nearbyint(x * scale);
+            v[i].y = (int64_t)std::nearbyint(y * scale);
+            v[i].z = p[2] * invW * 0.5f + 0.5f;
+            v[i].invW = invW;
+            v[i].varyings = clipped[i]->varyings;
+        }
+        int64_t area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+        if (area < 0)
+        {
+            std::swap(v[1], v[2]);
+            area = -area;
+        }
+        return area;
+    }
+
+    // pixels whose centres lie in the triangle's bounding box, limited to the viewport and a
+    // width x height target, as box = { x0, y0, x1, y1 } inclusive; false if there are none
+    // ------------------------------------------------------------------------
+    static bool pixelBounds(const ScreenVertex *v, const int *view, int width, int height, int *box)
+    {
+        const int64_t one = 1 << SUBPIXEL_BITS, half = one / 2;
+        int64_t minX = std::min(std::min(v[0].x, v[1].x), v[2].x), maxX = std::max(std::max(v[0].x, v[1].x), v[2].x);
+        int64_t minY = std::min(std::min(v[0].y, v[1].y), v[2].y), maxY = std::max(std::max(v[0].y, v[1].y), v[2].y);
+        box[0] = (int)std::max<int64_t>(std::max(view[0], 0), floorDiv(minX - half + one - 1, one));
+        box[1] = (int)std::max<int64_t>(std::max(view[1], 0), floorDiv(minY - half + one - 1, one));
+        box[2] = (int)std::min<int64_t>(std::min(view[0] + view[2], width) - 1, floorDiv(maxX - half, one));
+        box[3] = (int)std::min<int64_t>(std::min(view[1] + view[3], height) - 1, floorDiv(maxY - half, one));
+        return box[0] <= box[2] && box[1] <= box[3];
+    }
+
+    // the planes z, 1 / w, then varying / w over a projected triangle, PLANE_FLOATS each: the
+    // value at the centre of pixel (box[0], box[1]) and its x and y derivatives. Both rasterisers
+    // interpolate with plane(), in the same order of operations, so they write identical pixels
+    // ------------------------------------------------------------------------
+    static void setupPlanes(const ScreenVertex *v, int64_t area, const int *box, int varyings, float *planes)
+    {
+        const int64_t one = 1 << SUBPIXEL_BITS, half = one / 2;
+        const int64_t px = (int64_t)box[0] * one + half, py = (int64_t)box[1] * one + half;
+        const float invArea = 1.0f / (float)area;
+        float weight[3][PLANE_FLOATS]; // barycentric weight of vertex i at the box origin, d/dx, d/dy
+        for (int i = 0; i < 3; i++)
+        {
+            const ScreenVertex &from = v[(i + 1) % 3], &to = v[(i + 2) % 3];
+            int64_t dx = to.x - from.x, dy = to.y - from.y;
+            weight[i][0] = (float)(dx * (py - from.y) - dy * (px - from.x)) * invArea;
+            weight[i][1] = (float)(-dy * one) * invArea;
+            weight[i][2] = (float)(dx * one) * invArea;
+        }
+        setPlane(weight, v[0].z, v[1].z, v[2].z, planes);
+        setPlane(weight, v[0].invW, v[1].invW, v[2].invW, planes + PLANE_FLOATS);
+        for (int k = 0; k < varyings; k++)
+            setPlane(weight, v[0].varyings[k] * v[0].invW, v[1].varyings[k] * v[1].invW, v[2].varyings[k] * v[2].invW,
+                     planes + (2 + k) * PLANE_FLOATS);
+    }
+    // plane index at (x, y) pixels from the box origin
+    static float plane(const float *planes, int index, float x, float y)
+    {
+        const float *p = planes + index * PLANE_FLOATS;
+        return p[0] + p[1] * x + p[2] * y;
+    }
+
+    // fill rule (y up, counter-clockwise): pixel centres exactly on an edge belong to left edges
+    // (going down) and bottom edges (horizontal, going right) only, which is D3D's top-left rule
+    // with the rows in glReadPixels order and what GL drivers (llvmpipe included) do; add to the
+    // edge function
+    // ------------------------------------------------------------------------
+    static int64_t edgeBias(int64_t dx, int64_t dy)
+    {
+        return (dy < 0 || (dy == 0 && dx > 0)) ? 0 : -1;
+    }
+
+    static int64_t floorDiv(int64_t a, int64_t b)
+    {
+        return a >= 0 ? a / b : -((-a + b - 1) / b);
+    }
+
+private:
+    enum { PLANES = 6 };
+
+    static void setPlane(const float (*weight)[PLANE_FLOATS], float a, float b, float c, float *plane)
+    {
+        for (int j = 0; j < PLANE_FLOATS; j++)
+            plane[j] = weight[0][j] * a + weight[1][j] * b + weight[2][j] * c;
+    }
+
+    static float planeDistance(const float *p, int plane)
+    {
+        switch (plane)
+        {
+        case 0: return p[2] + p[3];     // near
+        case 1: return p[3] - p[2];     // far
+        case 2: return p[0] + p[3];     // left
+        case 3: return p[3] - p[0];     // right
+        case 4: return p[1] + p[3];     // bottom
+        default: return p[3] - p[1];    // top
+        }
+    }
+    static unsigned outcode(const float *p)
+    {
+        unsigned code = 0;
+        for (int plane = 0; plane < PLANES; plane++)
+            if (planeDistance(p, plane) < 0.0f)
+                code |= 1u << plane;
+        return code;
+    }
+};
+#endif
@@ -0,0 +1,187 @@
+#ifndef RASTER_RASTERIZER_H
+#define RASTER_RASTERIZER_H
+
+#include <raster/framebuffer.h>
+#include <raster/pipeline.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Software backend for GPU-less machines: the GL 3.3 triangle pipeline on the CPU, with the
+// same vertex data and attribute layouts (glVertexAttribPointer-style size, stride, offset).
+// Shaders are plain functions: the vertex shader gets each enabled attribute as 4 floats
+// (missing components filled with 0, 0, 0, 1 as GL does) and writes a clip-space position
+// and the varyings, the fragment shader turns interpolated varyings into an RGBA colour.
+//
+//   Framebuffer target(800, 600);
+//   Rasterizer raster(target);
+//   raster.vertexAttribPointer(0, 3, 6 * sizeof(float), vertices);
+//   raster.vertexAttribPointer(1, 3, 6 * sizeof(float), vertices + 3);
+//   raster.useProgram(program);
+//   raster.drawArrays(0, 3);
+//
+// Triangles are clipped against the view volume (near, far and the viewport's edges), then
+// rasterised with half-space edge functions in 24.8 fixed point, sampled at
+// pixel centres with GL's fill rule so shared edges are drawn once. Depth is linear in
+// screen space, varyings are perspective-correct, both interpolated with the planes
+// BinnedRasterizer uses, so the two write identical pixels. The depth test, when enabled, is GL_LESS
+// with depth writes.
+class Rasterizer : public RasterPipeline
+{
+public:
+    explicit Rasterizer(Framebuffer &target)
+    {
+        setFramebuffer(target);
+    }
+
+    // the viewport is reset to the whole target, as with a new GL context
+    // ------------------------------------------------------------------------
+    void setFramebuffer(Framebuffer &target)
+    {
+        framebuffer = &target;
+        viewport(0, 0, target.width(), target.height());
+    }
+    void viewport(int x, int y, int width, int height)
+    {
+        view[0] = x;
+        view[1] = y;
+        view[2] = width;
+        view[3] = height;
+    }
+    void enableDepthTest(bool enable)
+    {
+        depthTest = enable;
+    }
+
+    // size floats per vertex at pointer, stride bytes apart (0: tightly packed)
+    // ------------------------------------------------------------------------
+    void vertexAttribPointer(int index, int size, size_t stride, const void *pointer)
+    {
+        Attribute &attribute = attributes[index];
+        attribute.size = size;
+        attribute.stride = stride ? stride : size * sizeof(float);
+        attribute.data = (const unsigned char*)pointer;
+    }
+    void disableVertexAttribArray(int index)
+    {
+        attributes[index].data = nullptr;
+    }
+    void useProgram(const Program &newProgram)
+    {
+        program = newProgram;
+    }
+
+    // GL_TRIANGLES from the attribute arrays
+    // ------------------------------------------------------------------------
+    void drawArrays(size_t first, size_t count)
+    {
+        ClipVertex v[3];
+        for (size_t i = 0; i + 3 <= count; i += 3)
+        {
+            for (int k = 0; k < 3; k++)
+                shadeVertex(attributes, program, first + i + k, v[k]);
+            triangle(v[0], v[1], v[2]);
+        }
+    }
+    void drawElements(const uint32_t *indices, size_t count)
+    {
+        ClipVertex v[3];
+        for (size_t i = 0; i + 3 <= count; i += 3)
+        {
+            for (int k = 0; k < 3; k++)
+                shadeVertex(attributes, program, indices[i + k], v[k]);
+            triangle(v[0], v[1], v[2]);
+        }
+    }
+
+    const Stats &stats() const { return counters; }
+    void resetStats()
+    {
+        counters = Stats();
+    }
+
+private:
+    void triangle(const ClipVertex &a, const ClipVertex &b, const ClipVertex &c)
+    {
+        counters.triangles++;
+        clip(a, b, c, program.varyings, [this](const ClipVertex &p, const ClipVertex &q, const ClipVertex &r) {
+            ScreenVertex v[3];
+            int64_t area = project(p, q, r, view, v);
+            if (area == 0)
+                return;
+            counters.rasterized++;
+            rasterize(v, area);
+        });
+    }
+
+    void rasterize(const ScreenVertex *v, int64_t area)
+    {
+        const int64_t one = 1 << SUBPIXEL_BITS, half = one / 2;
+        int box[4];
+        if (!pixelBounds(v, view, framebuffer->width(), framebuffer->height(), box))
+            return;
+        const int x0 = box[0], y0 = box[1], x1 = box[2], y1 = box[3];
+
+        // edge i is opposite vertex i; E(p) = (b - a) x (p - a), positive inside
+        int64_t stepX[3], stepY[3], row[3];
+        for (int i = 0; i < 3; i++)
+        {
+            const ScreenVertex &a = v[(i + 1) % 3], &b = v[(i + 2) % 3];
+            int64_t dx = b.x - a.x, dy = b.y - a.y;
+            stepX[i] = -dy * one;
+            stepY[i] = dx * one;
+            int64_t px = (int64_t)x0 * one + half, py = (int64_t)y0 * one + half;
+            row[i] = dx * (py - a.y) - dy * (px - a.x) + edgeBias(dx, dy);
+        }
+
+        const int varyings = program.varyings;
+        float planes[(2 + MAX_VARYINGS) * PLANE_FLOATS];
+        setupPlanes(v, area, box, varyings, planes);
+        float interpolated[MAX_VARYINGS];
+        float color[4];
+        const int width = framebuffer->width();
+        uint32_t *pixels = framebuffer->pixels();
+        float *depth = framebuffer->depth();
+        for (int y = y0; y <= y1; y++)
+        {
+            int64_t e0 = row[0], e1 = row[1], e2 = row[2];
+            float fy = (float)(y - y0);
+            for (int x = x0; x <= x1; x++)
+            {
+                if ((e0 | e1 | e2) >= 0)
+                {
+                    counters.fragments++;
+                    float fx = (float)(x - x0);
+                    size_t index = (size_t)y * width + x;
+                    float z = plane(planes, 0, fx, fy);
+                    if (!depthTest || z < depth[index])
+                    {
+                        // perspective-correct: interpolate attribute / w and 1 / w
+                        float w = 1.0f / plane(planes, 1, fx, fy);
+                        for (int k = 0; k < varyings; k++)
+                            interpolated[k] = plane(planes, 2 + k, fx, fy) * w;
+                        program.fragment(interpolated, program.uniforms, color);
+                        pixels[index] = Framebuffer::pack(color[0], color[1], color[2], color[3]);
+                        if (depthTest)
+                            depth[index] = z;
+                        counters.pixels++;
+                    }
+                }
+                e0 += stepX[0];
+                e1 += stepX[1];
+                e2 += stepX[2];
+            }
+            row[0] += stepY[0];
+            row[1] += stepY[1];
+            row[2] += stepY[2];
+        }
+    }
+
+    Framebuffer *framebuffer;
+    int view[4] = { 0, 0, 0, 0 };
+    bool depthTest = false;
+    Attribute attributes[MAX_ATTRIBUTES];
+    Program program;
+    Stats counters;
+};
+#endif
@@ -0,0 +1,70 @@
+#ifndef RASTER_SOFTWARE_BACKEND_H
+#define RASTER_SOFTWARE_BACKEND_H
+
+#include <raster/framebuffer.h>
+#include <raster/rasterizer.h>
+#include <raster/triangle_scenes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+// The oldmain.cpp render loop on the CPU: draws the triangle scenes with Rasterizer for a number
+// of frames and writes the last one as a PPM. No GL, window system or Mesa is touched, so
+// main.cpp's --backend=software and tools/soft_render run it on GPU-less machines.
+//
+//   SoftwareBackend backend;
+//   backend.scene = "all";
+//   backend.frames = 100;
+//   if (!backend.run())
+//       return 1;
+struct SoftwareBackend
+{
+    std::string scene = "third"; // first, second, third (what oldmain.cpp's render loop draws) or all
+    std::string output = "frame.ppm";
+    int width = 800;
+    int height = 600;
+    int frames = 1;
+
+    static bool hasScene(const std::string &name)
+    {
+        bool found = name == "all";
+        for (int s = 0; s < TRIANGLE_SCENE_COUNT; s++)
+            found = found || name == triangleScenes[s].name;
+        return found;
+    }
+
+    // render and write the image; prints triangles/s and fill rate to out
+    // ------------------------------------------------------------------------
+    bool run(std::ostream &out = std::cout) const
+    {
+        if (!hasScene(scene))
+        {
+            std::cout << "ERROR::SOFTWARE_BACKEND::UNKNOWN_SCENE: " << scene << std::endl;
+            return false;
+        }
+        Framebuffer target(width, height);
+        Rasterizer raster(target);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++)
+        {
+            target.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            for (int s = 0; s < TRIANGLE_SCENE_COUNT; s++)
+                if (scene == "all" || scene == triangleScenes[s].name)
+                    triangleScenes[s].draw(raster);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (!target.writePPM(output))
+            return false;
+
+        const Rasterizer::Stats &stats = raster.stats();
+        char line[200];
+        std::snprintf(line, sizeof(line), "%s: %dx%d, %d frames in %.3f s: %.3f ms/frame, %.0f triangles/s, %.1f Mpixels/s",
+                      output.c_str(), width, height, frames, seconds, seconds * 1000.0 / frames,
+                      stats.triangles / seconds, stats.pixels / seconds * 1e-6);
+        out << line << std::endl;
+        return true;
+    }
+};
+#endif
@@ -0,0 +1,416 @@
+#ifndef RASTER_TEXTURE_H
+#define RASTER_TEXTURE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define TEXTURE_AVX2
+#include <immintrin.h>
+#endif
+
+// RGBA8 texture with a mipmap chain for the software rasterisers, sampled like a GL 3.3
+// sampler2D: texture coordinates in [0, 1] with REPEAT or CLAMP_TO_EDGE wrapping, NEAREST,
+// LINEAR or LINEAR_MIPMAP_LINEAR (trilinear) filtering, results as floats in [0, 1].
+//
+//   Texture texture;                                  // SWIZZLED layout
+//   texture.setImage(width, height, data);            // stbi_load(..., 4) output, bottom row first
+//   texture.generateMipmap();
+//   texture.setFilter(Texture::LINEAR_MIPMAP_LINEAR);
+//   float lod = texture.lod(dudx, dvdx, dudy, dvdy);  // from the UV derivatives
+//   texture.sample(u, v, lod, rgba);                  // or sample8() for 8 fragments at once
+//
+// SWIZZLED stores each level as 8x8 texel tiles (256 bytes, four cache lines) in row-major
+// tile order, with the texels of a tile in Morton (Z) order, so a bilinear footprint and its
+// neighbours mostly share cache lines whatever the direction of traversal. ROW_MAJOR is the
+// plain GL-style layout. sample8() runs 8 fragments at once with AVX2 gathers, chosen at run
+// time, and returns the same values as sample() bit for bit (unless the compiler contracts
+// the scalar arithmetic into FMAs).
+//
+// LINEAR_MIPMAP_LINEAR magnifies (lod <= 0) with LINEAR on level 0, as with
+// GL_TEXTURE_MAG_FILTER GL_LINEAR; the other filters use level 0 only.
+class Texture
+{
+public:
+    enum Layout { ROW_MAJOR, SWIZZLED };
+    enum Wrap { REPEAT, CLAMP_TO_EDGE };
+    enum Filter { NEAREST, LINEAR, LINEAR_MIPMAP_LINEAR };
+
+    static const int MAX_LEVELS = 16;
+    static const int TILE_SIZE = 8;
+
+    explicit Texture(Layout storage = SWIZZLED) : layout(storage)
+    {
+    }
+
+    // width x height RGBA8 texels (4 bytes each, r first), bottom row first as glTexImage2D
+    // takes them; drops the mipmap chain. A texture without an image samples as (0, 0, 0, 1),
+    // as an incomplete one does in GL
+    // ------------------------------------------------------------------------
+    void setImage(int width, int height, const unsigned char *rgba)
+    {
+        texels.clear();
+        levelCount = 0;
+        if (width <= 0 || height <= 0 || width > (1 << (MAX_LEVELS - 1)) || height > (1 << (MAX_LEVELS - 1)))
+        {
+            std::cout << "ERROR::TEXTURE::UNSUPPORTED_SIZE: " << width << "x" << height << std::endl;
+            return;
+        }
+        addLevel(width, height);
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                std::memcpy(&texels[address(0, x, y)], rgba + ((size_t)y * width + x) * 4, 4);
+    }
+
+    // as glGenerateMipmap: every level down to 1x1, each texel the rounded average of the 2x2
+    // texels above it (the last row or column repeated for odd sizes)
+    // ------------------------------------------------------------------------
+    void generateMipmap()
+    {
+        if (levelCount > 1)
+        {
+            texels.resize(levelOffset[1]);
+            levelCount = 1;
+        }
+        while (levelCount > 0 && levelCount < MAX_LEVELS && (levelWidth[levelCount - 1] > 1 || levelHeight[levelCount - 1] > 1))
+        {
+            int source = levelCount - 1;
+            int width = levelWidth[source], height = levelHeight[source];
+            addLevel(std::max(1, width / 2), std::max(1, height / 2));
+            for (int y = 0; y < levelHeight[source + 1]; y++)
+                for (int x = 0; x < levelWidth[source + 1]; x++)
+                {
+                    int x0 = std::min(2 * x, width - 1), x1 = std::min(2 * x + 1, width - 1);
+                    int y0 = std::min(2 * y, height - 1), y1 = std::min(2 * y + 1, height - 1);
+                    uint32_t a = texel(source, x0, y0), b = texel(source, x1, y0), c = texel(source, x0, y1), d = texel(source, x1, y1);
+                    uint32_t average = 0;
+                    for (int shift = 0; shift < 32; shift += 8)
+                    {
+                        uint32_t sum = (a >> shift & 0xFF) + (b >> shift & 0xFF) + (c >> shift & 0xFF) + (d >> shift & 0xFF);
+                        average |= ((sum + 2) / 4) << shift;
+                    }
+                    texels[address(source + 1, x, y)] = average;
+                }
+        }
+    }
+
+    void setWrap(Wrap s, Wrap t)
+    {
+        wrapS = s;
+        wrapT = t;
+    }
+    void setFilter(Filter newFilter)
+    {
+        filter = newFilter;
+    }
+
+    int width(int level = 0) const { return levelWidth[level]; }
+    int height(int level = 0) const { return levelHeight[level]; }
+    int levels() const { return levelCount; }
+    Layout storage() const { return layout; }
+    uint32_t texel(int level, int x, int y) const
+    {
+        return texels[address(level, x, y)];
+    }
+
+    // GL's level of detail for the screen-space derivatives of (u, v): log2 of the longer
+    // side of the pixel's footprint, in level 0 texels
+    // ------------------------------------------------------------------------
+    float lod(float dudx, float dvdx, float dudy, float dvdy) const
+    {
+        float w = (float)levelWidth[0], h = (float)levelHeight[0];
+        float x = dudx * w * (dudx * w) + dvdx * h * (dvdx * h);
+        float y = dudy * w * (dudy * w) + dvdy * h * (dvdy * h);
+        return 0.5f * std::log2(std::max(x, y));
+    }
+
+    // filtered colour at (u, v); rgba gets 4 floats
+    // ------------------------------------------------------------------------
+    void sample(float u, float v, float lod, float *rgba) const
+    {
+        if (levelCount == 0)
+        {
+            rgba[0] = rgba[1] = rgba[2] = 0.0f;
+            rgba[3] = 1.0f;
+            return;
+        }
+        if (filter == NEAREST)
+        {
+            int x, y, unused;
+            float weight;
+            footprint(u, levelWidth[0], wrapS, 0.0f, x, unused, weight);
+            footprint(v, levelHeight[0], wrapT, 0.0f, y, unused, weight);
+            uint32_t t = texels[address(0, x, y)];
+            for (int c = 0; c < 4; c++)
+                rgba[c] = (float)(t >> (8 * c) & 0xFF) * INV_255;
+            return;
+        }
+        float level = 0.0f;
+        if (filter == LINEAR_MIPMAP_LINEAR)
+        {
+            level = lod > 0.0f ? lod : 0.0f;
+            level = level < (float)(levelCount - 1) ? level : (float)(levelCount - 1);
+        }
+        float base = std::floor(level), fraction = level - base;
+        bilinear((int)base, u, v, rgba);
+        if (fraction > 0.0f)
+        {
+            float upper[4];
+            bilinear((int)base + 1, u, v, upper);
+            for (int c = 0; c < 4; c++)
+                rgba[c] = rgba[c] + (upper[c] - rgba[c]) * fraction;
+        }
+        for (int c = 0; c < 4; c++)
+            rgba[c] *= INV_255;
+    }
+
+    // sample() for 8 fragments, structure of arrays: u[lane], v[lane], lod[lane] in,
+    // rgba[channel * 8 + lane] out
+    // ------------------------------------------------------------------------
+    void sample8(const float *u, const float *v, const float *lod, float *rgba) const
+    {
+#ifdef TEXTURE_AVX2
+        if (simdSupported() && levelCount > 0)
+        {
+            sample8Avx2(u, v, lod, rgba);
+            return;
+        }
+#endif
+        float color[4];
+        for (int lane = 0; lane < 8; lane++)
+        {
+            sample(u[lane], v[lane], lod[lane], color);
+            for (int c = 0; c < 4; c++)
+                rgba[c * 8 + lane] = color[c];
+        }
+    }
+
+    static bool simdSupported()
+    {
+#ifdef TEXTURE_AVX2
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        return avx2;
+#else
+        return false;
+#endif
+    }
+
+private:
+    // beyond this many texels the coordinate is clamped, which keeps the integer texel
+    // coordinates (and NaNs) in range
+    static constexpr float COORDINATE_LIMIT = 1048576.0f;
+    static constexpr float INV_255 = 1.0f / 255.0f;
+
+    // Morton code of a 3-bit coordinate: bits spread to even positions
+    static int spread(int value)
+    {
+        return (value & 1) | (value & 2) << 1 | (value & 4) << 2;
+    }
+
+    void addLevel(int width, int height)
+    {
+        int level = levelCount++;
+        levelWidth[level] = width;
+        levelHeight[level] = height;
+        levelOffset[level] = (int)texels.size();
+        size_t size;
+        if (layout == SWIZZLED)
+        {
+            int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE, tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+            levelPitch[level] = tilesX;
+            size = (size_t)tilesX * tilesY * TILE_SIZE * TILE_SIZE;
+        }
+        else
+        {
+            levelPitch[level] = width;
+            size = (size_t)width * height;
+        }
+        texels.resize(texels.size() + size);
+    }
+
+    size_t address(int level, int x, int y) const
+    {
+        if (layout == ROW_MAJOR)
+            return (size_t)levelOffset[level] + (size_t)y * levelPitch[level] + x;
+        return (size_t)levelOffset[level] + (((size_t)(y >> 3) * levelPitch[level] + (x >> 3)) << 6)
+             + (spread(x & 7) | spread(y & 7) << 1);
+    }
+
+    // the two texel coordinates along one axis whose centres surround coordinate * size + shift
+    // (shift -0.5 for LINEAR, 0 for NEAREST's single texel), wrapped, and the second's weight
+    // ------------------------------------------------------------------------
+    static void footprint(float coordinate, int size, Wrap wrap, float shift, int &i0, int &i1, float &weight)
+    {
+        float t = coordinate * (float)size + shift;
+        t = t > -COORDINATE_LIMIT ? t : -COORDINATE_LIMIT;
+        t = t < COORDINATE_LIMIT ? t : COORDINATE_LIMIT;
+        float base = std::floor(t);
+        weight = t - base;
+        int i = (int)base;
+        if (wrap == REPEAT)
+        {
+            i0 = i - (int)std::floor(base / (float)size) * size;
+            if (i0 < 0)
+                i0 += size;
+            if (i0 >= size)
+                i0 -= size;
+            i1 = i0 + 1 == size ? 0 : i0 + 1;
+        }
+        else
+        {
+            i0 = std::min(std::max(i, 0), size - 1);
+            i1 = std::min(std::max(i + 1, 0), size - 1);
+        }
+    }
+
+    // LINEAR on one level, in [0, 255]
+    void bilinear(int level, float u, float v, float *rgba) const
+    {
+        int x0, x1, y0, y1;
+        float wx, wy;
+        footprint(u, levelWidth[level], wrapS, -0.5f, x0, x1, wx);
+        footprint(v, levelHeight[level], wrapT, -0.5f, y0, y1, wy);
+        uint32_t t00 = texels[address(level, x0, y0)], t10 = texels[address(level, x1, y0)];
+        uint32_t t01 = texels[address(level, x0, y1)], t11 = texels[address(level, x1, y1)];
+        for (int c = 0; c < 4; c++)
+        {
+            int shift = 8 * c;
+            float c00 = (float)(t00 >> shift & 0xFF), c10 = (float)(t10 >> shift & 0xFF);
+            float c01 = (float)(t01 >> shift & 0xFF), c11 = (float)(t11 >> shift & 0xFF);
+            float bottom = c00 + (c10 - c00) * wx, top = c01 + (c11 - c01) * wx;
+            rgba[c] = bottom + (top - bottom) * wy;
+        }
+    }
+
+#ifdef TEXTURE_AVX2
+    // the same steps as sample(), footprint() and bilinear(), 8 lanes at a time; each lane
+    // may use its own mip level
+    // ------------------------------------------------------------------------
+    __attribute__((target("avx2")))
+    void sample8Avx2(const float *u, const float *v, const float *lod, float *rgba) const
+    {
+        const __m256 U = _mm256_loadu_ps(u), V = _mm256_loadu_ps(v), zero = _mm256_setzero_ps();
+        __m256 color[4];
+        if (filter == NEAREST)
+        {
+            __m256i x, y, unused;
+            __m256 weight;
+            const __m256i level = _mm256_setzero_si256();
+            footprint8(U, _mm256_set1_epi32(levelWidth[0]), wrapS, 0.0f, x, unused, weight);
+            footprint8(V, _mm256_set1_epi32(levelHeight[0]), wrapT, 0.0f, y, unused, weight);
+            __m256i t = fetch8(level, x, y);
+            for (int c = 0; c < 4; c++)
+                color[c] = channel8(t, c);
+        }
+        else
+        {
+            __m256 level = zero;
+            if (filter == LINEAR_MIPMAP_LINEAR)
+                level = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(lod), zero), _mm256_set1_ps((float)(levelCount - 1)));
+            __m256 base = _mm256_floor_ps(level), fraction = _mm256_sub_ps(level, base);
+            __m256i baseLevel = _mm256_cvttps_epi32(base);
+            bilinear8(baseLevel, U, V, color);
+            if (_mm256_movemask_ps(_mm256_cmp_ps(fraction, zero, _CMP_GT_OQ)))
+            {
+                __m256 upper[4];
+                __m256i upperLevel = _mm256_min_epi32(_mm256_add_epi32(baseLevel, _mm256_set1_epi32(1)), _mm256_set1_epi32(levelCount - 1));
+                bilinear8(upperLevel, U, V, upper);
+                for (int c = 0; c < 4; c++)
+                    color[c] = _mm256_add_ps(color[c], _mm256_mul_ps(_mm256_sub_ps(upper[c], color[c]), fraction));
+            }
+        }
+        const __m256 scale = _mm256_set1_ps(INV_255);
+        for (int c = 0; c < 4; c++)
+            _mm256_storeu_ps(rgba + c * 8, _mm256_mul_ps(color[c], scale));
+    }
+
+    __attribute__((target("avx2")))
+    static void footprint8(__m256 coordinate, __m256i size, Wrap wrap, float shift, __m256i &i0, __m256i &i1, __m256 &weight)
+    {
+        const __m256i one = _mm256_set1_epi32(1);
+        __m256 sizeF = _mm256_cvtepi32_ps(size);
+        __m256 t = _mm256_add_ps(_mm256_mul_ps(coordinate, sizeF), _mm256_set1_ps(shift));
+        t = _mm256_max_ps(t, _mm256_set1_ps(-COORDINATE_LIMIT));
+        t = _mm256_min_ps(t, _mm256_set1_ps(COORDINATE_LIMIT));
+        __m256 base = _mm256_floor_ps(t);
+        weight = _mm256_sub_ps(t, base);
+        __m256i i = _mm256_cvttps_epi32(base);
+        if (wrap == REPEAT)
+        {
+            __m256i quotient = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_div_ps(base, sizeF)));
+            i0 = _mm256_sub_epi32(i, _mm256_mullo_epi32(quotient, size));
+            i0 = _mm256_add_epi32(i0, _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), i0), size));
+            i0 = _mm256_sub_epi32(i0, _mm256_and_si256(_mm256_cmpgt_epi32(i0, _mm256_sub_epi32(size, one)), size));
+            i1 = _mm256_add_epi32(i0, one);
+            i1 = _mm256_andnot_si256(_mm256_cmpeq_epi32(i1, size), i1);
+        }
+        else
+        {
+            __m256i last = _mm256_sub_epi32(size, one), first = _mm256_setzero_si256();
+            i0 = _mm256_min_epi32(_mm256_max_epi32(i, first), last);
+            i1 = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(i, one), first), last);
+        }
+    }
+
+    // the texels at (x, y) of each lane's level
+    __attribute__((target("avx2")))
+    __m256i fetch8(__m256i level, __m256i x, __m256i y) const
+    {
+        return _mm256_i32gather_epi32((const int*)texels.data(), address8(level, x, y), 4);
+    }
+
+    __attribute__((target("avx2")))
+    __m256i address8(__m256i level, __m256i x, __m256i y) const
+    {
+        __m256i offset = _mm256_i32gather_epi32(levelOffset, level, 4);
+        __m256i pitch = _mm256_i32gather_epi32(levelPitch, level, 4);
+        if (layout == ROW_MAJOR)
+            return _mm256_add_epi32(offset, _mm256_add_epi32(_mm256_mullo_epi32(y, pitch), x));
+        const __m256i spreads = _mm256_setr_epi32(0, 1, 4, 5, 16, 17, 20, 21), seven = _mm256_set1_epi32(7);
+        __m256i tile = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(y, 3), pitch), _mm256_srli_epi32(x, 3));
+        __m256i morton = _mm256_or_si256(_mm256_permutevar8x32_epi32(spreads, _mm256_and_si256(x, seven)),
+                                         _mm256_slli_epi32(_mm256_permutevar8x32_epi32(spreads, _mm256_and_si256(y, seven)), 1));
+        return _mm256_add_epi32(offset, _mm256_add_epi32(_mm256_slli_epi32(tile, 6), morton));
+    }
+
+    __attribute__((target("avx2")))
+    static __m256 channel8(__m256i texels, int c)
+    {
+        return _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(texels, 8 * c), _mm256_set1_epi32(0xFF)));
+    }
+
+    __attribute__((target("avx2")))
+    void bilinear8(__m256i level, __m256 U, __m256 V, __m256 *rgba) const
+    {
+        __m256i x0, x1, y0, y1;
+        __m256 wx, wy;
+        footprint8(U, _mm256_i32gather_epi32(levelWidth, level, 4), wrapS, -0.5f, x0, x1, wx);
+        footprint8(V, _mm256_i32gather_epi32(levelHeight, level, 4), wrapT, -0.5f, y0, y1, wy);
+        __m256i t00 = fetch8(level, x0, y0), t10 = fetch8(level, x1, y0);
+        __m256i t01 = fetch8(level, x0, y1), t11 = fetch8(level, x1, y1);
+        for (int c = 0; c < 4; c++)
+        {
+            __m256 c00 = channel8(t00, c), c10 = channel8(t10, c), c01 = channel8(t01, c), c11 = channel8(t11, c);
+            __m256 bottom = _mm256_add_ps(c00, _mm256_mul_ps(_mm256_sub_ps(c10, c00), wx));
+            __m256 top = _mm256_add_ps(c01, _mm256_mul_ps(_mm256_sub_ps(c11, c01), wx));
+            rgba[c] = _mm256_add_ps(bottom, _mm256_mul_ps(_mm256_sub_ps(top, bottom), wy));
+        }
+    }
+#endif
+
+    Layout layout;
+    Wrap wrapS = REPEAT;
+    Wrap wrapT = REPEAT;
+    Filter filter = LINEAR;
+    std::vector<uint32_t> texels;
+    int levelCount = 0;
+    int levelWidth[MAX_LEVELS] = {};
+    int levelHeight[MAX_LEVELS] = {};
+    int levelPitch[MAX_LEVELS] = {};  // texels per row (ROW_MAJOR) or tiles per row (SWIZZLED)
+    int levelOffset[MAX_LEVELS] = {};
+};
+#endif
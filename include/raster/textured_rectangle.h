@@ -0,0 +1,113 @@
+#ifndef RASTER_TEXTURED_RECTANGLE_H
+#define RASTER_TEXTURED_RECTANGLE_H
+
+#include <raster/pipeline.h>
+#include <raster/texture.h>
+
+#include <cstdint>
+#include <cstring>
+
+const char *const texturedRectangleVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec3 aColor;\n"
+"layout (location = 2) in vec2 aTexCoord;\n"
+"out vec3 ourColor;\n"
+"out vec2 TexCoord;\n"
+"void main()\n"
+"{\n"
+"   gl_Position = vec4(aPos, 1.0);\n"
+"   ourColor = aColor;\n"
+"   TexCoord = aTexCoord;\n"
+"}\0";
+
+const char *const texturedRectangleFragmentShaderSource = "#version 330 core\n"
+"out vec4 FragColor;\n"
+"in vec3 ourColor;\n"
+"in vec2 TexCoord;\n"
+"uniform sampler2D ourTexture;\n"
+"void main()\n"
+"{\n"
+"   FragColor = texture(ourTexture, TexCoord) * vec4(ourColor, 1.0);\n"
+"}\0";
+
+const float texturedRectangle[] = {
+    // positions          // colors           // texture coords
+     0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,   // top right
+     0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,   // bottom right
+    -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,   // bottom left
+    -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f    // top left
+};
+const uint32_t texturedRectangleIndices[] = {
+    0, 1, 3,  // first triangle
+    1, 2, 3   // second triangle
+};
+
+// The textured rectangle from oldBuilds/main.cpp (position, colour and texture coordinates,
+// 8 floats per vertex, two triangles by index) with the LearnOpenGL texture shaders, in GLSL
+// and for the software rasterisers. The software fragment shaders take their level of detail
+// from the uniforms, as the rectangle is drawn without perspective and its UV derivatives
+// are the same for every pixel: TexturedRectangle::lod() computes it for a viewport.
+struct TexturedRectangle
+{
+    struct Uniforms
+    {
+        const Texture *texture;
+        float lod;
+    };
+
+    // gl_Position = vec4(aPos, 1.0); ourColor = aColor; TexCoord = aTexCoord
+    // ------------------------------------------------------------------------
+    static void vertex(const float *const *attributes, const void*, float *position, float *varyings)
+    {
+        std::memcpy(position, attributes[0], 3 * sizeof(float));
+        position[3] = 1.0f;
+        std::memcpy(varyings, attributes[1], 3 * sizeof(float));
+        std::memcpy(varyings + 3, attributes[2], 2 * sizeof(float));
+    }
+    // FragColor = texture(ourTexture, TexCoord) * vec4(ourColor, 1.0)
+    static void fragment(const float *varyings, const void *uniforms, float *color)
+    {
+        const Uniforms &u = *(const Uniforms*)uniforms;
+        u.texture->sample(varyings[3], varyings[4], u.lod, color);
+        for (int c = 0; c < 3; c++)
+            color[c] *= varyings[c];
+    }
+    static void fragment8(const float *varyings, const void *uniforms, float *color)
+    {
+        const int lanes = RasterPipeline::SIMD_WIDTH;
+        const Uniforms &u = *(const Uniforms*)uniforms;
+        float lod[lanes];
+        for (int lane = 0; lane < lanes; lane++)
+            lod[lane] = u.lod;
+        u.texture->sample8(varyings + 3 * lanes, varyings + 4 * lanes, lod, color);
+        for (int i = 0; i < 3 * lanes; i++)
+            color[i] *= varyings[i];
+    }
+
+    // the level of detail of the rectangle's texture on a width x height viewport
+    // ------------------------------------------------------------------------
+    static float lod(const Texture &texture, int width, int height)
+    {
+        // UV goes from 0 to 1 over half the viewport in each direction
+        return texture.lod(2.0f / width, 0.0f, 0.0f, 2.0f / height);
+    }
+
+    // bind the rectangle's attributes and program to a Rasterizer or BinnedRasterizer and draw it
+    // ------------------------------------------------------------------------
+    template <typename Raster>
+    static void draw(Raster &raster, const Uniforms &uniforms)
+    {
+        RasterPipeline::Program program;
+        program.vertex = &vertex;
+        program.fragment = &fragment;
+        program.fragment8 = &fragment8;
+        program.varyings = 5;
+        program.uniforms = &uniforms;
+        raster.vertexAttribPointer(0, 3, 8 * sizeof(float), texturedRectangle);
+        raster.vertexAttribPointer(1, 3, 8 * sizeof(float), texturedRectangle + 3);
+        raster.vertexAttribPointer(2, 2, 8 * sizeof(float), texturedRectangle + 6);
+        raster.useProgram(program);
+        raster.drawElements(texturedRectangleIndices, 6);
+    }
+};
+#endif
@@ -0,0 +1,145 @@
+#ifndef RASTER_TRIANGLE_SCENES_H
+#define RASTER_TRIANGLE_SCENES_H
+
+#include <raster/pipeline.h>
+
+#include <cstddef>
+#include <cstring>
+
+// The triangles from oldBuilds/oldmain.cpp, with the GLSL they were drawn with and the
+// software rasteriser's equivalent shaders, so both backends render the same scene:
+//   first   orange, uniform colour      (position)
+//   second  yellow, uniform colour      (position)
+//   third   per-vertex red/green/blue   (position + colour, 6 floats per vertex)
+struct TriangleScene
+{
+    const char *name;
+    const float *vertices;
+    int vertexCount;
+    int stride;             // floats per vertex
+    int colorOffset;        // floats; -1 when the colour is the uniform below
+    float color[4];
+    const char *vertexShaderSource;
+    const char *fragmentShaderSource;
+
+    // software equivalents of the GLSL above
+    // ------------------------------------------------------------------------
+    static void positionVertex(const float *const *attributes, const void*, float *position, float*)
+    {
+        std::memcpy(position, attributes[0], 3 * sizeof(float)); // gl_Position = vec4(aPos, 1.0)
+        position[3] = 1.0f;
+    }
+    static void uniformColorFragment(const float*, const void *uniforms, float *color)
+    {
+        std::memcpy(color, uniforms, 4 * sizeof(float)); // FragColor = ourColor
+    }
+    static void colorVertex(const float *const *attributes, const void*, float *position, float *varyings)
+    {
+        std::memcpy(position, attributes[0], 3 * sizeof(float));
+        position[3] = 1.0f;
+        std::memcpy(varyings, attributes[1], 3 * sizeof(float)); // ourColor = aColor
+    }
+    static void colorFragment(const float *varyings, const void*, float *color)
+    {
+        std::memcpy(color, varyings, 3 * sizeof(float)); // FragColor = vec4(ourColor, 1.0)
+        color[3] = 1.0f;
+    }
+    // the fragment shaders 8 fragments at a time, for BinnedRasterizer
+    static void uniformColorFragment8(const float*, const void *uniforms, float *color)
+    {
+        const float *ourColor = (const float*)uniforms;
+        for (int c = 0; c < 4; c++)
+            for (int lane = 0; lane < RasterPipeline::SIMD_WIDTH; lane++)
+                color[c * RasterPipeline::SIMD_WIDTH + lane] = ourColor[c];
+    }
+    static void colorFragment8(const float *varyings, const void*, float *color)
+    {
+        std::memcpy(color, varyings, 3 * RasterPipeline::SIMD_WIDTH * sizeof(float));
+        for (int lane = 0; lane < RasterPipeline::SIMD_WIDTH; lane++)
+            color[3 * RasterPipeline::SIMD_WIDTH + lane] = 1.0f;
+    }
+
+    // bind the scene's attributes and program to a Rasterizer or BinnedRasterizer and draw it
+    // ------------------------------------------------------------------------
+    template <typename Raster>
+    void draw(Raster &raster) const
+    {
+        RasterPipeline::Program program;
+        raster.vertexAttribPointer(0, 3, stride * sizeof(float), vertices);
+        if (colorOffset >= 0)
+        {
+            raster.vertexAttribPointer(1, 3, stride * sizeof(float), vertices + colorOffset);
+            program.vertex = &colorVertex;
+            program.fragment = &colorFragment;
+            program.fragment8 = &colorFragment8;
+            program.varyings = 3;
+        }
+        else
+        {
+            raster.disableVertexAttribArray(1);
+            program.vertex = &positionVertex;
+            program.fragment = &uniformColorFragment;
+            program.fragment8 = &uniformColorFragment8;
+            program.uniforms = color;
+        }
+        raster.useProgram(program);
+        raster.drawArrays(0, vertexCount);
+    }
+};
+
+const char *const triangleVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"void main()\n"
+"{\n"
+"   gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+"}\0";
+
+const char *const triangleUniformColorFragmentSource = "#version 330 core\n"
+"out vec4 FragColor;\n"
+"uniform vec4 ourColor;\n"
+"void main()\n"
+"{\n"
+"   FragColor = ourColor;\n"
+"}\0";
+
+const char *const triangleWithColorVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec3 aColor;\n"
+"out vec3 ourColor;"
+"void main()\n"
+"{\n"
+"   gl_Position = vec4(aPos, 1.0);\n"
+"   ourColor = aColor;\n"
+"}\0";
+
+const char *const triangleWithColorFragmentSource = "#version 330 core\n"
+"out vec4 FragColor;\n"
+"in vec3 ourColor;\n"
+"void main()\n"
+"{\n"
+"   FragColor = vec4(ourColor, 1.0);\n"
+"}\0";
+
+const float firstTriangle[] = {
+    -0.9f, -0.5f, 0.0f,  // left
+    -0.0f, -0.5f, 0.0f,  // right
+    -0.45f, 0.5f, 0.0f,  // top
+};
+const float secondTriangle[] = {
+    0.0f, -0.5f, 0.0f,  // left
+    0.9f, -0.5f, 0.0f,  // right
+    0.45f, 0.5f, 0.0f   // top
+};
+const float thirdTriangle[] = {
+    -0.9f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f, // left
+    -0.0f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // right
+    -0.45f, 0.5f, 0.0f, 0.0f, 0.0f, 1.0f  // top
+};
+
+const TriangleScene triangleScenes[] = {
+    { "first", firstTriangle, 3, 3, -1, { 1.0f, 0.5f, 0.2f, 1.0f }, triangleVertexShaderSource, triangleUniformColorFragmentSource },
+    { "second", secondTriangle, 3, 3, -1, { 1.0f, 1.0f, 0.0f, 1.0f }, triangleVertexShaderSource, triangleUniformColorFragmentSource },
+    { "third", thirdTriangle, 3, 6, 3, { 0.0f, 0.0f, 0.0f, 0.0f }, triangleWithColorVertexShaderSource, triangleWithColorFragmentSource },
+};
+const int TRIANGLE_SCENE_COUNT = sizeof(triangleScenes) / sizeof(triangleScenes[0]);
+#endif
@@ -0,0 +1,119 @@
+#ifndef BUFFER_RING_H
+#define BUFFER_RING_H
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <iostream>
+
+// Streaming buffer for data that changes every frame (animated positions, per-frame uniforms).
+// One GL buffer is split into REGIONS frame-sized regions. Each frame writes the next region
+// through an unsynchronized map, so the driver never stalls on a buffer the GPU is still reading;
+// a fence per region makes us wait only when the CPU gets REGIONS frames ahead of the GPU.
+//
+//   void* dst = ring.map();           // wait for this region's fence, map it
+//   memcpy(dst, vertices, bytes);
+//   GLintptr offset = ring.unmap();   // byte offset of this frame's data in ring.ID
+//   glDrawArrays(GL_TRIANGLES, offset / stride, count);
+//   ring.fence();                     // after the last draw that reads the region
+class BufferRing
+{
+public:
+    static const int REGIONS = 3;
+
+    unsigned int ID;
+    GLenum target;
+    GLsizeiptr regionSize;
+
+    BufferRing(GLenum target, GLsizeiptr regionSize)
+        : ID(0), target(target), regionSize(regionSize), current(0), mapped(false), stall(0.0)
+    {
+        for (int i = 0; i < REGIONS; i++)
+            fences[i] = 0;
+        glGenBuffers(1, &ID);
+        glBindBuffer(target, ID);
+        glBufferData(target, regionSize * REGIONS, NULL, GL_STREAM_DRAW);
+    }
+    ~BufferRing()
+    {
+        for (int i = 0; i < REGIONS; i++)
+            if (fences[i])
+                glDeleteSync(fences[i]);
+        glDeleteBuffers(1, &ID);
+    }
+    BufferRing(const BufferRing&) = delete;
+    BufferRing& operator=(const BufferRing&) = delete;
+
+    // wait until the GPU is done with the current region, then map it for writing
+    // ------------------------------------------------------------------------
+    void* map()
+    {
+        waitRegion(current);
+        glBindBuffer(target, ID);
+        void *ptr = glMapBufferRange(target, offset(), regionSize,
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (ptr == NULL)
+            std::cout << "ERROR::BUFFER_RING::MAP_FAILED 0x" << std::hex << glGetError() << std::dec << std::endl;
+        mapped = ptr != NULL;
+        return ptr;
+    }
+    // unmap the current region; returns its byte offset into the buffer
+    // ------------------------------------------------------------------------
+    GLintptr unmap()
+    {
+        if (mapped)
+        {
+            glBindBuffer(target, ID);
+            glUnmapBuffer(target);
+            mapped = false;
+        }
+        return offset();
+    }
+    // fence the current region once all draws reading it are submitted, and move to the next one
+    // ------------------------------------------------------------------------
+    void fence()
+    {
+        if (fences[current])
+            glDeleteSync(fences[current]);
+        fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        current = (current + 1) % REGIONS;
+    }
+    GLintptr offset() const
+    {
+        return (GLintptr)current * regionSize;
+    }
+    // total CPU time spent blocked on region fences, in seconds
+    // ------------------------------------------------------------------------
+    double stallSeconds() const
+    {
+        return stall;
+    }
+
+private:
+    int current;
+    bool mapped;
+    double stall;
+    GLsync fences[REGIONS];
+
+    void waitRegion(int region)
+    {
+        if (!fences[region])
+            return;
+        // cheap poll first: in steady state the GPU finished this region frames ago
+        GLenum result = glClientWaitSync(fences[region], 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            do
+            {
+                result = glClientWaitSync(fences[region], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+            } while (result == GL_TIMEOUT_EXPIRED);
+            stall += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        if (result == GL_WAIT_FAILED)
+            std::cout << "ERROR::BUFFER_RING::WAIT_FAILED" << std::endl;
+        glDeleteSync(fences[region]);
+        fences[region] = 0;
+    }
+};
+#endif
@@ -0,0 +1,224 @@
+#ifndef CITY_RENDERER_H
+#define CITY_RENDERER_H
+
+#include <glad/glad.h>
+#include <render/instance_stream.h>
+#include <scene/city_scene.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// Draws a CityScene with GL as instances of a unit cube: the buildings listed (a culled list is
+// what the render loop submits) are written as per-instance box and colour attributes into an
+// InstanceStream and drawn with one glDrawElementsInstanced per create() capacity of them, so
+// the cost of a frame does not grow with draw calls. With ids set each building is flat-shaded
+// in a colour that encodes its index (id()), for reading back which buildings are visible.
+class CityRenderer
+{
+public:
+    // a unit cube with a normal per face, counter-clockwise from outside
+    static const int CUBE_INDEX_COUNT = 36;
+    static const int CUBE_VERTEX_FLOATS = 6 * 4 * 6;    // position and normal, 4 corners per face
+
+    // per building: locations 2 to 4
+    struct Instance
+    {
+        float boxMin[3];
+        float boxSize[3];
+        float color[3];
+    };
+
+    // maxInstances: buildings per instanced draw, usually the scene's building count
+    // ------------------------------------------------------------------------
+    bool create(size_t maxInstances)
+    {
+        float vertices[CUBE_VERTEX_FLOATS];
+        unsigned short indices[CUBE_INDEX_COUNT];
+        cube(vertices, indices);
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        instances.create(maxInstances, sizeof(Instance));
+        for (int location = 2; location <= 4; location++)
+        {
+            glEnableVertexAttribArray(location);
+            glVertexAttribDivisor(location, 1);
+        }
+        pointInstances(0);
+        glBindVertexArray(0);
+
+        program = compile();
+        if (!program)
+            return false;
+        viewProjectionLocation = glGetUniformLocation(program, "viewProjection");
+        lightingLocation = glGetUniformLocation(program, "lighting");
+        return true;
+    }
+    void destroy()
+    {
+        if (!VAO)
+            return;
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteBuffers(1, &EBO);
+        instances.destroy();
+        glDeleteProgram(program);
+        VAO = VBO = EBO = program = 0;
+    }
+
+    // draw the buildings listed (indices into scene.buildings), or all of them when list is
+    // nullptr; expects the depth test on
+    // ------------------------------------------------------------------------
+    void draw(const CityScene &scene, const float viewProjection[16], const uint32_t *list, size_t count, bool ids = false)
+    {
+        glUseProgram(program);
+        glBindVertexArray(VAO);
+        glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, viewProjection);
+        glUniform1f(lightingLocation, ids ? 0.0f : 1.0f);
+        if (!list)
+            count = scene.buildings.size();
+        for (size_t first = 0; first < count; )
+        {
+            size_t batch = count - first;
+            Instance *dst = (Instance*)instances.map(batch);
+            if (!dst)
+            {
+                instances.unmap();
+                break;
+            }
+            for (size_t i = 0; i < batch; i++, dst++)
+            {
+                uint32_t index = list ? list[first + i] : (uint32_t)(first + i);
+                const CityScene::Building &b = scene.buildings[index];
+                for (int c = 0; c < 3; c++)
+                {
+                    dst->boxMin[c] = b.min[c];
+                    dst->boxSize[c] = b.max[c] - b.min[c];
+                    dst->color[c] = b.color[c];
+                }
+                if (ids)
+                    id(index, dst->color);
+            }
+            pointInstances(instances.unmap());
+            glDrawElementsInstanced(GL_TRIANGLES, CUBE_INDEX_COUNT, GL_UNSIGNED_SHORT, 0, (GLsizei)batch);
+            instances.fence();
+            first += batch;
+        }
+    }
+
+    // the cube from 0 to 1 on each axis, position then normal per vertex
+    // ------------------------------------------------------------------------
+    static void cube(float vertices[CUBE_VERTEX_FLOATS], unsigned short indices[CUBE_INDEX_COUNT])
+    {
+        // corners: x, y and z are 1 where bits 0, 1 and 2 are set; faces -z, +z, -x, +x, -y, +y
+        static const int faces[6][4] = {
+            { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }
+        };
+        static const int normalAxis[3] = { 2, 0, 1 };
+        for (int f = 0; f < 6; f++)
+        {
+            for (int v = 0; v < 4; v++)
+            {
+                float *vertex = vertices + (f * 4 + v) * 6;
+                for (int i = 0; i < 3; i++)
+                {
+                    vertex[i] = (float)(faces[f][v] >> i & 1);
+                    vertex[3 + i] = i == normalAxis[f / 2] ? (f & 1 ? 1.0f : -1.0f) : 0.0f;
+                }
+            }
+            const int quad[6] = { 0, 1, 2, 0, 2, 3 };
+            for (int i = 0; i < 6; i++)
+                indices[f * 6 + i] = (unsigned short)(f * 4 + quad[i]);
+        }
+    }
+
+    // building index + 1 as an RGB8 colour (black is no building), and back from a read pixel
+    // ------------------------------------------------------------------------
+    static void id(uint32_t index, float color[3])
+    {
+        uint32_t value = index + 1;
+        for (int c = 0; c < 3; c++)
+            color[c] = (float)(value >> (8 * c) & 0xFF) / 255.0f;
+    }
+    static int64_t index(const unsigned char *rgb)
+    {
+        return (int64_t)(rgb[0] | rgb[1] << 8 | rgb[2] << 16) - 1;
+    }
+
+private:
+    // the instance attributes at byte offset in the stream (GL 3.3 has no base instance, so they
+    // follow the ring's region). Expects the VAO bound
+    void pointInstances(GLintptr offset)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, instances.buffer());
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, boxMin)));
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, boxSize)));
+        glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, color)));
+    }
+
+    static unsigned int compile()
+    {
+        const char *vertexSource = "#version 330 core\n"
+        "layout (location = 0) in vec3 aPos;\n"
+        "layout (location = 1) in vec3 aNormal;\n"
+        "layout (location = 2) in vec3 boxMin;\n"
+        "layout (location = 3) in vec3 boxSize;\n"
+        "layout (location = 4) in vec3 color;\n"
+        "uniform mat4 viewProjection;\n"
+        "uniform float lighting;\n"
+        "flat out vec3 ourColor;\n"
+        "void main()\n"
+        "{\n"
+        "   gl_Position = viewProjection * vec4(boxMin + aPos * boxSize, 1.0);\n"
+        "   float light = 0.45 + 0.55 * max(dot(aNormal, normalize(vec3(0.4, 1.0, 0.3))), 0.0);\n"
+        "   ourColor = mix(color, color * light, lighting);\n"
+        "}\0";
+        const char *fragmentSource = "#version 330 core\n"
+        "out vec4 FragColor;\n"
+        "flat in vec3 ourColor;\n"
+        "void main()\n"
+        "{\n"
+        "   FragColor = vec4(ourColor, 1.0);\n"
+        "}\0";
+        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShader, 1, &vertexSource, NULL);
+        glCompileShader(vertexShader);
+        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+        glCompileShader(fragmentShader);
+        unsigned int shaderProgram = glCreateProgram();
+        glAttachShader(shaderProgram, vertexShader);
+        glAttachShader(shaderProgram, fragmentShader);
+        glLinkProgram(shaderProgram);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        int success;
+        glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            char infoLog[512];
+            glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+            std::cout << "ERROR::CITY_RENDERER::PROGRAM_LINKING_FAILED\n" << infoLog << std::endl;
+            glDeleteProgram(shaderProgram);
+            return 0;
+        }
+        return shaderProgram;
+    }
+
+    InstanceStream instances;
+    unsigned int VAO = 0, VBO = 0, EBO = 0;
+    unsigned int program = 0;
+    int viewProjectionLocation = -1;
+    int lightingLocation = -1;
+};
+#endif
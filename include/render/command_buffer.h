@@ -0,0 +1,198 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include <core/linear_arena.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// API-agnostic render command stream. Any thread can record into its own CommandBuffer
+// (they share nothing); the render thread replays them in order through a backend
+// (GLCommandReplay in render/gl_command_replay.h). Handles and uniform slots are opaque
+// 32-bit values the backend interprets - for GL they are object names and uniform locations.
+//
+// Commands are packed back to back in the buffer's LinearArena: a 4-byte header
+// { type, size } followed by the payload. reset() keeps the arena's memory, so recording
+// the same amount of work every frame doesn't allocate.
+//
+// Meant for scenes submitted as many small draws (bench/command_recording.cpp). main.cpp's
+// render loop doesn't record through it: its per-frame work (culling, the turbine graph, LOD
+// selection) already runs on the JobSystem, and what reaches the render thread is a handful of
+// instanced draws whose per-instance data goes through mapped InstanceStreams, which the
+// command set has no record for.
+class CommandBuffer
+{
+public:
+    enum Type : uint16_t
+    {
+        BIND_PROGRAM = 0,
+        BIND_VERTEX_ARRAY,
+        UNIFORM_1F,
+        UNIFORM_4F,
+        UNIFORM_MATRIX_4F,
+        DRAW_ARRAYS,
+        DRAW_INDEXED,
+        SET_CLEAR_COLOR,
+        CLEAR,
+        SET_VIEWPORT,
+        TYPE_COUNT
+    };
+    enum Primitive : uint32_t
+    {
+        POINTS = 0,
+        LINES,
+        TRIANGLES,
+        TRIANGLE_STRIP
+    };
+    enum IndexType : uint32_t
+    {
+        INDEX_UINT16 = 0,
+        INDEX_UINT32
+    };
+    enum ClearMask : uint32_t
+    {
+        CLEAR_COLOR = 1,
+        CLEAR_DEPTH = 2,
+        CLEAR_STENCIL = 4
+    };
+
+    struct Header
+    {
+        uint16_t type;
+        uint16_t size; // bytes, header included
+    };
+    struct BindProgram { Header header; uint32_t program; };
+    struct BindVertexArray { Header header; uint32_t vertexArray; };
+    struct Uniform1f { Header header; int32_t slot; float value; };
+    struct Uniform4f { Header header; int32_t slot; float value[4]; };
+    struct UniformMatrix4f { Header header; int32_t slot; float value[16]; };
+    struct DrawArrays { Header header; Primitive primitive; uint32_t first; uint32_t count; uint32_t instances; };
+    struct DrawIndexed { Header header; Primitive primitive; IndexType indexType; uint32_t count; uint32_t firstIndex; int32_t baseVertex; uint32_t instances; };
+    struct SetClearColor { Header header; float color[4]; };
+    struct Clear { Header header; uint32_t mask; };
+    struct SetViewport { Header header; int32_t x, y, width, height; };
+
+    // a contiguous run of commands; a new one starts whenever the arena moves to another chunk
+    struct Block
+    {
+        const unsigned char *begin;
+        const unsigned char *end;
+    };
+
+    explicit CommandBuffer(size_t chunkSize = 64 * 1024)
+        : arena(chunkSize) {}
+
+    // recording
+    // ------------------------------------------------------------------------
+    void bindProgram(uint32_t program)
+    {
+        push<BindProgram>(BIND_PROGRAM).program = program;
+    }
+    void bindVertexArray(uint32_t vertexArray)
+    {
+        push<BindVertexArray>(BIND_VERTEX_ARRAY).vertexArray = vertexArray;
+    }
+    void uniform1f(int32_t slot, float value)
+    {
+        Uniform1f &command = push<Uniform1f>(UNIFORM_1F);
+        command.slot = slot;
+        command.value = value;
+    }
+    void uniform4f(int32_t slot, float x, float y, float z, float w)
+    {
+        Uniform4f &command = push<Uniform4f>(UNIFORM_4F);
+        command.slot = slot;
+        command.value[0] = x;
+        command.value[1] = y;
+        command.value[2] = z;
+        command.value[3] = w;
+    }
+    // column-major, as glUniformMatrix4fv with transpose = GL_FALSE
+    void uniformMatrix4f(int32_t slot, const float *matrix)
+    {
+        UniformMatrix4f &command = push<UniformMatrix4f>(UNIFORM_MATRIX_4F);
+        command.slot = slot;
+        std::memcpy(command.value, matrix, sizeof(command.value));
+    }
+    void drawArrays(Primitive primitive, uint32_t first, uint32_t count, uint32_t instances = 1)
+    {
+        DrawArrays &command = push<DrawArrays>(DRAW_ARRAYS);
+        command.primitive = primitive;
+        command.first = first;
+        command.count = count;
+        command.instances = instances;
+    }
+    void drawIndexed(Primitive primitive, IndexType indexType, uint32_t count, uint32_t firstIndex, int32_t baseVertex = 0, uint32_t instances = 1)
+    {
+        DrawIndexed &command = push<DrawIndexed>(DRAW_INDEXED);
+        command.primitive = primitive;
+        command.indexType = indexType;
+        command.count = count;
+        command.firstIndex = firstIndex;
+        command.baseVertex = baseVertex;
+        command.instances = instances;
+    }
+    void setClearColor(float r, float g, float b, float a)
+    {
+        SetClearColor &command = push<SetClearColor>(SET_CLEAR_COLOR);
+        command.color[0] = r;
+        command.color[1] = g;
+        command.color[2] = b;
+        command.color[3] = a;
+    }
+    void clear(uint32_t mask)
+    {
+        push<Clear>(CLEAR).mask = mask;
+    }
+    void setViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+    {
+        SetViewport &command = push<SetViewport>(SET_VIEWPORT);
+        command.x = x;
+        command.y = y;
+        command.width = width;
+        command.height = height;
+    }
+
+    // drop all commands, keep the memory
+    // ------------------------------------------------------------------------
+    void reset()
+    {
+        arena.reset();
+        blocks.clear();
+        commands = 0;
+    }
+    size_t commandCount() const
+    {
+        return commands;
+    }
+    size_t bytes() const
+    {
+        return arena.used();
+    }
+    const std::vector<Block> &commandBlocks() const
+    {
+        return blocks;
+    }
+
+private:
+    template <typename T>
+    T &push(Type type)
+    {
+        static_assert(sizeof(T) < 65536 && sizeof(T) % 4 == 0, "commands are 4-byte aligned and their size must fit the header");
+        unsigned char *memory = (unsigned char*)arena.allocate(sizeof(T), 4);
+        if (blocks.empty() || blocks.back().end != memory)
+            blocks.push_back(Block{ memory, memory });
+        blocks.back().end = memory + sizeof(T);
+        T *command = (T*)memory;
+        command->header.type = type;
+        command->header.size = (uint16_t)sizeof(T);
+        commands++;
+        return *command;
+    }
+
+    LinearArena arena;
+    std::vector<Block> blocks;
+    size_t commands = 0;
+};
+#endif
@@ -0,0 +1,350 @@
+#ifndef DEBUG_OUTPUT_H
+#define DEBUG_OUTPUT_H
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+
+// KHR_debug message capture. The driver callback never touches std::cout: it classifies the
+// message (error, buffer migration, shader recompile, implicit sync, other performance warning),
+// tags it with the innermost DebugOutput::Scope, drops repeats of a message it has already seen
+// and pushes new ones into a fixed-size lock-free ring. The render loop calls drain() when it
+// can afford the I/O (once per frame, or at exit) and report() prints the repeat counts.
+// The callback may run on driver threads when synchronous output is off, so the ring and the
+// repeat table accept concurrent producers; drain() and report() must only run on one thread.
+class DebugOutput
+{
+public:
+    enum Category
+    {
+        CATEGORY_ERROR = 0,
+        CATEGORY_BUFFER_MIGRATION,
+        CATEGORY_SHADER_RECOMPILE,
+        CATEGORY_IMPLICIT_SYNC,
+        CATEGORY_PERFORMANCE,
+        CATEGORY_OTHER,
+        CATEGORY_COUNT
+    };
+
+    static const unsigned int MESSAGE_LENGTH = 232;
+
+    struct Entry
+    {
+        GLenum source;
+        GLenum type;
+        GLuint id;
+        GLenum severity;
+        Category category;
+        const char *scope;
+        char message[MESSAGE_LENGTH];
+    };
+
+    // names a region of the frame: messages raised inside it are attributed to it, and it is
+    // pushed as a debug group so it also shows up in GPU debuggers. name must outlive the program
+    // (a string literal)
+    // ------------------------------------------------------------------------
+    class Scope
+    {
+    public:
+        explicit Scope(const char *name)
+            : previous(state().scope.exchange(name, std::memory_order_relaxed))
+        {
+            if (state().installed)
+                glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+        }
+        ~Scope()
+        {
+            if (state().installed)
+                glPopDebugGroup();
+            state().scope.store(previous, std::memory_order_relaxed);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char *previous;
+    };
+
+    // register the callback; needs KHR_debug (GL 4.3). synchronous output makes scope
+    // attribution exact at some driver cost; without it messages may arrive late
+    // ------------------------------------------------------------------------
+    static bool install(bool synchronous = true)
+    {
+        if (!(gladCapabilities & GLAD_CAP_KHR_DEBUG) || glad_glDebugMessageCallback == NULL)
+        {
+            std::cout << "WARNING::DEBUG_OUTPUT::KHR_DEBUG_NOT_AVAILABLE" << std::endl;
+            return false;
+        }
+        glEnable(GL_DEBUG_OUTPUT);
+        if (synchronous)
+            glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        else
+            glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        glDebugMessageCallback(&callback, NULL);
+        // everything except notifications (debug group push/pop, info chatter)
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
+        state().installed = true;
+        return true;
+    }
+    static void uninstall()
+    {
+        if (!state().installed)
+            return;
+        glDebugMessageCallback(NULL, NULL);
+        glDisable(GL_DEBUG_OUTPUT);
+        state().installed = false;
+    }
+
+    // write queued messages; returns how many were written
+    // ------------------------------------------------------------------------
+    static size_t drain(std::ostream &out = std::cout)
+    {
+        Entry entry;
+        size_t written = 0;
+        while (pop(entry))
+        {
+            out << "GL::" << categoryName(entry.category) << " [" << (entry.scope ? entry.scope : "-") << "] id "
+                << entry.id << ": " << entry.message << '\n';
+            written++;
+        }
+        if (written)
+            out.flush();
+        return written;
+    }
+    // how often each distinct message was raised
+    // ------------------------------------------------------------------------
+    static void report(std::ostream &out = std::cout)
+    {
+        drain(out);
+        State &s = state();
+        out << "==== GL debug messages ====\n";
+        for (unsigned int i = 0; i < TABLE_SIZE; i++)
+        {
+            const Seen &seen = s.seen[i];
+            if (!seen.published.load(std::memory_order_acquire))
+                continue; // empty, or its first sighting is still being copied in
+            out << std::setw(8) << seen.count.load(std::memory_order_relaxed) << "x  " << categoryName(seen.category)
+                << " [" << (seen.scope ? seen.scope : "-") << "] " << seen.message << '\n';
+        }
+        if (s.dropped.load())
+            out << "WARNING::DEBUG_OUTPUT::DROPPED " << s.dropped.load() << " messages (log ring full)\n";
+        out.flush();
+    }
+    static unsigned long long count(Category category)
+    {
+        return state().counts[category].load(std::memory_order_relaxed);
+    }
+    static const char* categoryName(Category category)
+    {
+        static const char *names[CATEGORY_COUNT] = { "ERROR", "BUFFER_MIGRATION", "SHADER_RECOMPILE", "IMPLICIT_SYNC", "PERFORMANCE", "OTHER" };
+        return names[category];
+    }
+
+    // keyword classification of driver performance warnings; drivers word these differently
+    // ------------------------------------------------------------------------
+    static Category classify(GLenum type, const char *message)
+    {
+        if (type == GL_DEBUG_TYPE_ERROR)
+            return CATEGORY_ERROR;
+        if (type != GL_DEBUG_TYPE_PERFORMANCE)
+            return CATEGORY_OTHER;
+        if (contains(message, "recompil"))
+            return CATEGORY_SHADER_RECOMPILE;
+        if (contains(message, "migrat") || contains(message, "video memory") || contains(message, "system memory")
+            || contains(message, "host memory") || contains(message, "moved"))
+            return CATEGORY_BUFFER_MIGRATION;
+        if (contains(message, "stall") || contains(message, "sync") || contains(message, "wait") || contains(message, "busy"))
+            return CATEGORY_IMPLICIT_SYNC;
+        return CATEGORY_PERFORMANCE;
+    }
+
+private:
+    static const unsigned int RING_SIZE = 1024;  // power of two
+    static const unsigned int TABLE_SIZE = 512;  // power of two
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        Entry entry;
+    };
+    // key claims the entry; category, scope and message are written by the claiming producer
+    // and only read once published is set
+    struct Seen
+    {
+        std::atomic<uint64_t> key;
+        std::atomic<unsigned long long> count;
+        std::atomic<bool> published;
+        Category category;
+        const char *scope;
+        char message[MESSAGE_LENGTH];
+    };
+    struct State
+    {
+        Slot ring[RING_SIZE];
+        std::atomic<size_t> head;
+        std::atomic<size_t> tail;
+        Seen seen[TABLE_SIZE];
+        std::atomic<const char*> scope;
+        std::atomic<unsigned long long> counts[CATEGORY_COUNT];
+        std::atomic<unsigned long long> dropped;
+        bool installed;
+
+        State()
+            : head(0), tail(0), scope(NULL), dropped(0), installed(false)
+        {
+            for (size_t i = 0; i < RING_SIZE; i++)
+                ring[i].sequence.store(i, std::memory_order_relaxed);
+            for (size_t i = 0; i < TABLE_SIZE; i++)
+            {
+                seen[i].key.store(0, std::memory_order_relaxed);
+                seen[i].count.store(0, std::memory_order_relaxed);
+                seen[i].published.store(false, std::memory_order_relaxed);
+            }
+            for (int i = 0; i < CATEGORY_COUNT; i++)
+                counts[i].store(0, std::memory_order_relaxed);
+        }
+    };
+    static State &state()
+    {
+        static State s;
+        return s;
+    }
+
+    static bool contains(const char *text, const char *word)
+    {
+        size_t length = std::strlen(word);
+        for (; *text; text++)
+        {
+            size_t i = 0;
+            while (i < length && text[i] && (text[i] | 0x20) == word[i])
+                i++;
+            if (i == length)
+                return true;
+        }
+        return false;
+    }
+    static uint64_t hash(const void *data, size_t bytes, uint64_t h)
+    {
+        const unsigned char *p = (const unsigned char*)data;
+        for (size_t i = 0; i < bytes; i++)
+            h = (h ^ p[i]) * 0x100000001B3ull; // FNV-1a
+        return h;
+    }
+
+    // true the first time a key is seen; later calls only bump its count
+    // ------------------------------------------------------------------------
+    static bool firstSighting(uint64_t key, const Entry &entry)
+    {
+        State &s = state();
+        for (unsigned int probe = 0; probe < TABLE_SIZE; probe++)
+        {
+            Seen &seen = s.seen[(key + probe) & (TABLE_SIZE - 1)];
+            uint64_t current = seen.key.load(std::memory_order_acquire);
+            if (current == key)
+            {
+                seen.count.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (current == 0)
+            {
+                uint64_t expected = 0;
+                if (seen.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel))
+                {
+                    seen.category = entry.category;
+                    seen.scope = entry.scope;
+                    std::memcpy(seen.message, entry.message, MESSAGE_LENGTH);
+                    seen.count.fetch_add(1, std::memory_order_relaxed);
+                    seen.published.store(true, std::memory_order_release);
+                    return true;
+                }
+                if (expected == key)
+                {
+                    seen.count.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+        }
+        return true; // table full: stop deduplicating rather than lose messages
+    }
+
+    // bounded multi-producer ring (Vyukov): a slot's sequence number says whose turn it is
+    // ------------------------------------------------------------------------
+    static bool push(const Entry &entry)
+    {
+        State &s = state();
+        size_t position = s.head.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot &slot = s.ring[position & (RING_SIZE - 1)];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+            if (difference == 0)
+            {
+                if (s.head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.entry = entry;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                position = s.head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    static bool pop(Entry &entry)
+    {
+        State &s = state();
+        size_t position = s.tail.load(std::memory_order_relaxed);
+        Slot &slot = s.ring[position & (RING_SIZE - 1)];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((intptr_t)sequence - (intptr_t)(position + 1) < 0)
+            return false; // empty
+        entry = slot.entry;
+        slot.sequence.store(position + RING_SIZE, std::memory_order_release);
+        s.tail.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    static void APIENTRY callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void*)
+    {
+        if (type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP)
+            return;
+        State &s = state();
+        Entry entry;
+        entry.source = source;
+        entry.type = type;
+        entry.id = id;
+        entry.severity = severity;
+        entry.scope = s.scope.load(std::memory_order_relaxed);
+        size_t bytes = length >= 0 ? (size_t)length : std::strlen(message);
+        if (bytes >= MESSAGE_LENGTH)
+            bytes = MESSAGE_LENGTH - 1;
+        std::memcpy(entry.message, message, bytes);
+        entry.message[bytes] = '\0';
+        entry.category = classify(type, entry.message);
+        s.counts[entry.category].fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t key = hash(&entry.scope, sizeof(entry.scope), 0xCBF29CE484222325ull);
+        key = hash(&id, sizeof(id), key);
+        key = hash(&type, sizeof(type), key);
+        key = hash(entry.message, bytes, key);
+        if (key == 0)
+            key = 1;
+        if (!firstSighting(key, entry))
+            return;
+        if (!push(entry))
+            s.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+#endif
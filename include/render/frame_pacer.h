@@ -0,0 +1,236 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <render/frame_stats.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+// When to start a frame, traded between latency and throughput:
+//
+//   UNCAPPED     swap interval 0, no waiting: as many frames as the GPU takes (benchmarks)
+//   VSYNC        swap interval 1, the swap blocks until the vblank
+//   LIMITED      swap interval 0, frames started targetFps apart (sleep, then spin the rest)
+//   LOW_LATENCY  swap interval 1, and input is sampled as late as possible: the predicted
+//                work of a frame (main thread + render CPU + GPU time, the maximum over the
+//                last WINDOW frames plus a margin) before the first vblank not taken by a
+//                frame that is already queued
+//
+// waitForInput() and frameSubmitted() run on the thread that samples input, framePresented()
+// on the one that swaps (the same thread in a single-threaded loop):
+//
+//   pacer.waitForInput(); glfwPollEvents(); ...; renderer.submitFrame(); pacer.frameSubmitted();
+//   render thread: glfwSwapInterval(pacer.swapInterval()) once; swap; pacer.framePresented(cpu, gpu);
+class FramePacer
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    enum Mode
+    {
+        UNCAPPED = 0,
+        VSYNC,
+        LIMITED,
+        LOW_LATENCY
+    };
+    static const int WINDOW = 16;
+
+    explicit FramePacer(Mode mode = VSYNC, double targetFps = 60.0, double marginSeconds = 0.001)
+        : pacingMode(mode), margin(marginSeconds)
+    {
+        setTargetFps(targetFps);
+    }
+
+    Mode mode() const
+    {
+        return pacingMode;
+    }
+    // LIMITED: the frame rate to hold; VSYNC and LOW_LATENCY: the display refresh rate
+    void setTargetFps(double fps)
+    {
+        period = 1.0 / (fps > 0.0 ? fps : 60.0);
+    }
+    double targetFps() const
+    {
+        return 1.0 / period;
+    }
+    int swapInterval() const
+    {
+        return pacingMode == VSYNC || pacingMode == LOW_LATENCY ? 1 : 0;
+    }
+
+    // wait until this frame should sample its input; returns when it did
+    // ------------------------------------------------------------------------
+    Clock::time_point waitForInput()
+    {
+        Clock::time_point now = Clock::now();
+        Clock::time_point wake = now;
+        if (pacingMode == LIMITED)
+        {
+            // a fixed schedule, a late frame is caught up on the next one; start again from now
+            // after falling more than a whole frame behind
+            Clock::time_point slot = nextStart + toDuration(period);
+            nextStart = (nextStart == Clock::time_point() || now - slot > toDuration(period)) ? now : slot;
+            wake = nextStart;
+        }
+        else if (pacingMode == LOW_LATENCY)
+        {
+            int64_t presented = lastPresent.load(std::memory_order_acquire);
+            if (presented != 0)
+            {
+                // frames submitted but not presented yet each take a vblank first
+                unsigned queued = mainFrames - presentedFrames.load(std::memory_order_acquire);
+                Clock::time_point vblank = Clock::time_point(Clock::duration(presented)) + toDuration(period * (1 + queued));
+                while (vblank < now)
+                    vblank += toDuration(period);
+                double renderWork = renderEstimate.load(std::memory_order_relaxed) * 1e-9;
+                wake = vblank - toDuration(maxOf(mainWork) + renderWork + margin);
+            }
+        }
+        if (wake > now)
+            sleepUntil(wake);
+        sampleTime = Clock::now();
+        delayStats.add(std::chrono::duration<double>(sampleTime - now).count());
+        return sampleTime;
+    }
+    // the frame has been handed to the renderer (main-thread work since waitForInput returned)
+    // ------------------------------------------------------------------------
+    void frameSubmitted()
+    {
+        mainWork[mainFrames++ % WINDOW] = std::chrono::duration<double>(Clock::now() - sampleTime).count();
+    }
+    // right after the swap returned: CPU time spent issuing the frame (without the swap) and
+    // its GPU time, if known (see GpuTimer; pass 0 otherwise)
+    // ------------------------------------------------------------------------
+    void framePresented(double renderSeconds, double gpuSeconds)
+    {
+        // CPU and GPU time overlap in part; adding them keeps the estimate on the safe side
+        renderWork[renderFrames++ % WINDOW] = renderSeconds + gpuSeconds;
+        renderEstimate.store((int64_t)(maxOf(renderWork) * 1e9), std::memory_order_relaxed);
+        renderStats.add(renderSeconds);
+        if (gpuSeconds > 0.0)
+            gpuStats.add(gpuSeconds);
+        lastPresent.store(Clock::now().time_since_epoch().count(), std::memory_order_release);
+        presentedFrames.fetch_add(1, std::memory_order_release);
+    }
+
+    // how long waitForInput held the input back; written by the input thread
+    const FrameStats &inputDelay() const { return delayStats; }
+    // written by the render thread, read them after it stopped
+    const FrameStats &renderTime() const { return renderStats; }
+    const FrameStats &gpuTime() const { return gpuStats; }
+
+    void report(std::ostream &out = std::cout) const
+    {
+        out << "pacing: " << modeName(pacingMode);
+        if (pacingMode != UNCAPPED)
+            out << " at " << std::fixed << std::setprecision(1) << targetFps() << " Hz" << std::defaultfloat;
+        out << "\n";
+        delayStats.print(out, "input delay");
+        renderStats.print(out, "render (CPU)");
+        if (gpuStats.count())
+            gpuStats.print(out, "render (GPU)");
+    }
+
+    // sleep for most of the time, then spin: the OS oversleeps by up to a few ms, so the sleeps
+    // stop at the mean plus one standard deviation of the oversleep seen so far (per thread)
+    // ------------------------------------------------------------------------
+    static void sleepUntil(Clock::time_point target)
+    {
+        struct Estimate
+        {
+            double estimate = 0.005, mean = 0.005, m2 = 0.0;
+            long long count = 1;
+        };
+        static thread_local Estimate sleep;
+        Clock::time_point now = Clock::now();
+        while (std::chrono::duration<double>(target - now).count() > sleep.estimate)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            Clock::time_point after = Clock::now();
+            double observed = std::chrono::duration<double>(after - now).count();
+            now = after;
+            // Welford's running mean and variance
+            sleep.count++;
+            double delta = observed - sleep.mean;
+            sleep.mean += delta / sleep.count;
+            sleep.m2 += delta * (observed - sleep.mean);
+            sleep.estimate = sleep.mean + std::sqrt(sleep.m2 / (sleep.count - 1));
+        }
+        while (Clock::now() < target)
+            ;
+    }
+
+    static const char *modeName(Mode mode)
+    {
+        switch (mode)
+        {
+        case UNCAPPED: return "uncapped";
+        case VSYNC: return "vsync";
+        case LIMITED: return "limited";
+        case LOW_LATENCY: return "low-latency";
+        }
+        return "unknown";
+    }
+    // "uncapped", "vsync", "low-latency" or "limit=<fps>"; false if text is none of them
+    // ------------------------------------------------------------------------
+    static bool parse(const char *text, Mode &mode, double &fps)
+    {
+        if (std::strncmp(text, "limit=", 6) == 0)
+        {
+            char *end;
+            double value = std::strtod(text + 6, &end);
+            if (*end != '\0' || !(value > 0.0))
+                return false;
+            mode = LIMITED;
+            fps = value;
+            return true;
+        }
+        for (Mode candidate : { UNCAPPED, VSYNC, LOW_LATENCY })
+            if (std::strcmp(text, modeName(candidate)) == 0)
+            {
+                mode = candidate;
+                return true;
+            }
+        return false;
+    }
+
+private:
+    static Clock::duration toDuration(double seconds)
+    {
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    }
+    static double maxOf(const double (&window)[WINDOW])
+    {
+        return *std::max_element(window, window + WINDOW);
+    }
+
+    Mode pacingMode;
+    double period = 1.0 / 60.0;
+    double margin;
+
+    // input thread
+    Clock::time_point nextStart;
+    Clock::time_point sampleTime;
+    double mainWork[WINDOW] = {};
+    unsigned mainFrames = 0;
+    FrameStats delayStats;
+
+    // render thread
+    double renderWork[WINDOW] = {};
+    unsigned renderFrames = 0;
+    FrameStats renderStats;
+    FrameStats gpuStats;
+    alignas(64) std::atomic<int64_t> lastPresent{0};
+    std::atomic<int64_t> renderEstimate{0};
+    std::atomic<unsigned> presentedFrames{0};
+};
+#endif
@@ -0,0 +1,88 @@
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// Sample set for frame timings (latencies, present intervals), in seconds; summaries print in ms.
+// Keeps the most recent capacity samples: add() never allocates, so it is safe in a loop that
+// must not touch the heap.
+class FrameStats
+{
+public:
+    explicit FrameStats(size_t capacity = 8192)
+        : samples(capacity ? capacity : 1) {}
+
+    void add(double seconds)
+    {
+        samples[next] = seconds;
+        next = (next + 1) % samples.size();
+        if (filled < samples.size())
+            filled++;
+    }
+    void clear()
+    {
+        next = 0;
+        filled = 0;
+    }
+    size_t count() const
+    {
+        return filled;
+    }
+    double mean() const
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < filled; i++)
+            sum += samples[i];
+        return filled == 0 ? 0.0 : sum / filled;
+    }
+    double stddev() const
+    {
+        double m = mean(), sum = 0.0;
+        for (size_t i = 0; i < filled; i++)
+            sum += (samples[i] - m) * (samples[i] - m);
+        return filled < 2 ? 0.0 : std::sqrt(sum / (filled - 1));
+    }
+    // p in [0, 1], nearest rank
+    // ------------------------------------------------------------------------
+    double percentile(double p) const
+    {
+        if (filled == 0)
+            return 0.0;
+        std::vector<double> sorted(samples.begin(), samples.begin() + filled);
+        size_t rank = (size_t)std::ceil(p * sorted.size());
+        rank = std::min(sorted.size() - 1, rank ? rank - 1 : 0);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        return sorted[rank];
+    }
+    double max() const
+    {
+        return filled == 0 ? 0.0 : *std::max_element(samples.begin(), samples.begin() + filled);
+    }
+    // samples above limit, e.g. present intervals longer than 1.5 refresh periods
+    size_t countAbove(double limit) const
+    {
+        return (size_t)std::count_if(samples.begin(), samples.begin() + filled, [limit](double s) { return s > limit; });
+    }
+
+    // one line: mean, p50, p99, max and standard deviation in ms
+    // ------------------------------------------------------------------------
+    void print(std::ostream &out, const char *label) const
+    {
+        out << std::left << std::setw(28) << label << std::right << std::fixed << std::setprecision(2)
+            << " mean " << std::setw(7) << mean() * 1000.0
+            << "  p50 " << std::setw(7) << percentile(0.50) * 1000.0
+            << "  p99 " << std::setw(7) << percentile(0.99) * 1000.0
+            << "  max " << std::setw(7) << max() * 1000.0
+            << "  sd " << std::setw(6) << stddev() * 1000.0 << " ms\n" << std::defaultfloat;
+    }
+
+private:
+    std::vector<double> samples;
+    size_t next = 0;
+    size_t filled = 0;
+};
+#endif
@@ -0,0 +1,99 @@
+#ifndef GL_COMMAND_REPLAY_H
+#define GL_COMMAND_REPLAY_H
+
+#include <glad/glad.h>
+#include <render/command_buffer.h>
+
+#include <cstdint>
+
+// GL backend for CommandBuffer: decodes the packed stream and issues the matching GL calls.
+// Must run on the thread that owns the context; buffers are replayed in the order given.
+class GLCommandReplay
+{
+public:
+    static void replay(const CommandBuffer &buffer)
+    {
+        const GLenum primitives[] = { GL_POINTS, GL_LINES, GL_TRIANGLES, GL_TRIANGLE_STRIP };
+        const GLenum indexTypes[] = { GL_UNSIGNED_SHORT, GL_UNSIGNED_INT };
+        const uintptr_t indexSizes[] = { 2, 4 };
+        for (const CommandBuffer::Block &block : buffer.commandBlocks())
+        {
+            const unsigned char *p = block.begin;
+            while (p < block.end)
+            {
+                const CommandBuffer::Header *header = (const CommandBuffer::Header*)p;
+                switch (header->type)
+                {
+                case CommandBuffer::BIND_PROGRAM:
+                    glUseProgram(((const CommandBuffer::BindProgram*)p)->program);
+                    break;
+                case CommandBuffer::BIND_VERTEX_ARRAY:
+                    glBindVertexArray(((const CommandBuffer::BindVertexArray*)p)->vertexArray);
+                    break;
+                case CommandBuffer::UNIFORM_1F:
+                {
+                    const CommandBuffer::Uniform1f *command = (const CommandBuffer::Uniform1f*)p;
+                    glUniform1f(command->slot, command->value);
+                    break;
+                }
+                case CommandBuffer::UNIFORM_4F:
+                {
+                    const CommandBuffer::Uniform4f *command = (const CommandBuffer::Uniform4f*)p;
+                    glUniform4fv(command->slot, 1, command->value);
+                    break;
+                }
+                case CommandBuffer::UNIFORM_MATRIX_4F:
+                {
+                    const CommandBuffer::UniformMatrix4f *command = (const CommandBuffer::UniformMatrix4f*)p;
+                    glUniformMatrix4fv(command->slot, 1, GL_FALSE, command->value);
+                    break;
+                }
+                case CommandBuffer::DRAW_ARRAYS:
+                {
+                    const CommandBuffer::DrawArrays *command = (const CommandBuffer::DrawArrays*)p;
+                    if (command->instances == 1)
+                        glDrawArrays(primitives[command->primitive], command->first, command->count);
+                    else
+                        glDrawArraysInstanced(primitives[command->primitive], command->first, command->count, command->instances);
+                    break;
+                }
+                case CommandBuffer::DRAW_INDEXED:
+                {
+                    const CommandBuffer::DrawIndexed *command = (const CommandBuffer::DrawIndexed*)p;
+                    const void *offset = (const void*)(command->firstIndex * indexSizes[command->indexType]);
+                    glDrawElementsInstancedBaseVertex(primitives[command->primitive], command->count, indexTypes[command->indexType],
+                                                      offset, command->instances, command->baseVertex);
+                    break;
+                }
+                case CommandBuffer::SET_CLEAR_COLOR:
+                {
+                    const CommandBuffer::SetClearColor *command = (const CommandBuffer::SetClearColor*)p;
+                    glClearColor(command->color[0], command->color[1], command->color[2], command->color[3]);
+                    break;
+                }
+                case CommandBuffer::CLEAR:
+                {
+                    uint32_t mask = ((const CommandBuffer::Clear*)p)->mask;
+                    glClear((mask & CommandBuffer::CLEAR_COLOR ? GL_COLOR_BUFFER_BIT : 0)
+                            | (mask & CommandBuffer::CLEAR_DEPTH ? GL_DEPTH_BUFFER_BIT : 0)
+                            | (mask & CommandBuffer::CLEAR_STENCIL ? GL_STENCIL_BUFFER_BIT : 0));
+                    break;
+                }
+                case CommandBuffer::SET_VIEWPORT:
+                {
+                    const CommandBuffer::SetViewport *command = (const CommandBuffer::SetViewport*)p;
+                    glViewport(command->x, command->y, command->width, command->height);
+                    break;
+                }
+                }
+                p += header->size;
+            }
+        }
+    }
+    static void replay(const CommandBuffer *const *buffers, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            replay(*buffers[i]);
+    }
+};
+#endif
@@ -0,0 +1,186 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// Per-entry-point GL call counts and CPU time, built on glad's trace layer (gladInstallTrace).
+// Calls that make the CPU wait for the GPU (glGet*, glReadPixels, glFinish, ...) are flagged,
+// and counted separately when they happen inside a frame, where they hurt the most.
+//
+//   GLTrace::install();                  // after gladLoadGLLoader
+//   while (...) { GLTrace::beginFrame(); ...render...; GLTrace::endFrame(); }
+//   GLTrace::report();                   // aggregated table
+class GLTrace
+{
+public:
+    struct Stat
+    {
+        unsigned long long calls = 0;
+        double seconds = 0.0;
+    };
+
+    // wrap every loaded entry point; frameSummary prints a table at every endFrame()
+    // ------------------------------------------------------------------------
+    static void install(bool frameSummary = false)
+    {
+        State &s = state();
+        unsigned int count = gladTraceFunctionCount();
+        s.frame.assign(count, Stat());
+        s.total.assign(count, Stat());
+        s.hotSync.assign(count, 0);
+        s.sync.assign(count, false);
+        for (unsigned int i = 0; i < count; i++)
+            s.sync[i] = synchronises(gladTraceFunctionName(i));
+        s.frameSummary = frameSummary;
+        s.frames = 0;
+        s.inFrame = false;
+        s.depth = 0;
+        gladInstallTrace(&pre, &post, NULL);
+    }
+    static void uninstall()
+    {
+        gladUninstallTrace();
+    }
+
+    static void beginFrame()
+    {
+        state().inFrame = true;
+    }
+    // fold this frame into the totals (and print it if frame summaries are on)
+    // ------------------------------------------------------------------------
+    static void endFrame(std::ostream &out = std::cout)
+    {
+        State &s = state();
+        if (s.frameSummary)
+        {
+            out << "---- frame " << s.frames << " ----\n";
+            printTable(out, s.frame, 1, 12);
+        }
+        for (size_t i = 0; i < s.frame.size(); i++)
+        {
+            s.total[i].calls += s.frame[i].calls;
+            s.total[i].seconds += s.frame[i].seconds;
+            s.frame[i] = Stat();
+        }
+        s.frames++;
+        s.inFrame = false;
+    }
+
+    // everything since install(), per frame averages, plus the synchronising calls made inside frames
+    // ------------------------------------------------------------------------
+    static void report(std::ostream &out = std::cout, size_t rows = 30)
+    {
+        State &s = state();
+        unsigned long long frames = s.frames ? s.frames : 1;
+        out << "==== GL calls over " << s.frames << " frames (per frame averages) ====\n";
+        printTable(out, s.total, frames, rows);
+        bool any = false;
+        for (size_t i = 0; i < s.hotSync.size(); i++)
+        {
+            if (!s.hotSync[i])
+                continue;
+            if (!any)
+                out << "WARNING::GL_TRACE::SYNCHRONISING_CALLS_IN_FRAME\n";
+            any = true;
+            out << "    " << std::left << std::setw(32) << gladTraceFunctionName((unsigned int)i) << std::right
+                << s.hotSync[i] << " calls (" << (double)s.hotSync[i] / frames << " per frame)\n";
+        }
+        out.flush();
+    }
+
+    static Stat total(const char *name)
+    {
+        State &s = state();
+        for (unsigned int i = 0; i < s.total.size(); i++)
+            if (std::strcmp(gladTraceFunctionName(i), name) == 0)
+            {
+                Stat stat = s.total[i];
+                stat.calls += s.frame[i].calls;
+                stat.seconds += s.frame[i].seconds;
+                return stat;
+            }
+        return Stat();
+    }
+
+private:
+    struct State
+    {
+        std::vector<Stat> frame;
+        std::vector<Stat> total;
+        std::vector<unsigned long long> hotSync;
+        std::vector<bool> sync;
+        bool frameSummary = false;
+        bool inFrame = false;
+        unsigned long long frames = 0;
+        int depth = 0;
+        std::chrono::steady_clock::time_point start[8];
+    };
+    static State &state()
+    {
+        static State s;
+        return s;
+    }
+
+    // calls that wait for the GPU, or may, depending on the driver
+    // ------------------------------------------------------------------------
+    static bool synchronises(const char *name)
+    {
+        static const char *explicitSync[] = {
+            "glReadPixels", "glFinish", "glClientWaitSync", "glMapBuffer", "glMapBufferRange", "glGetError"
+        };
+        if (std::strncmp(name, "glGet", 5) == 0)
+            return true;
+        for (const char *sync : explicitSync)
+            if (std::strcmp(name, sync) == 0)
+                return true;
+        return false;
+    }
+
+    static void pre(unsigned int, void*)
+    {
+        State &s = state();
+        // wrappers can nest when another trace-aware layer calls back into glad
+        if (s.depth < 8)
+            s.start[s.depth] = std::chrono::steady_clock::now();
+        s.depth++;
+    }
+    static void post(unsigned int function, void*)
+    {
+        State &s = state();
+        s.depth--;
+        if (s.depth < 8)
+            s.frame[function].seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - s.start[s.depth]).count();
+        s.frame[function].calls++;
+        if (s.inFrame && s.sync[function])
+            s.hotSync[function]++;
+    }
+
+    static void printTable(std::ostream &out, const std::vector<Stat> &stats, unsigned long long divisor, size_t rows)
+    {
+        std::vector<unsigned int> order;
+        for (unsigned int i = 0; i < stats.size(); i++)
+            if (stats[i].calls)
+                order.push_back(i);
+        std::sort(order.begin(), order.end(), [&stats](unsigned int a, unsigned int b) { return stats[a].seconds > stats[b].seconds; });
+        out << std::left << std::setw(32) << "function" << std::right << std::setw(12) << "calls" << std::setw(12) << "time us"
+            << std::setw(12) << "us/call" << "  sync\n";
+        for (size_t r = 0; r < order.size() && r < rows; r++)
+        {
+            const Stat &stat = stats[order[r]];
+            out << std::left << std::setw(32) << gladTraceFunctionName(order[r]) << std::right << std::fixed
+                << std::setw(12) << std::setprecision(divisor > 1 ? 1 : 0) << (double)stat.calls / divisor
+                << std::setw(12) << std::setprecision(2) << stat.seconds * 1e6 / divisor
+                << std::setw(12) << stat.seconds * 1e6 / stat.calls
+                << (state().sync[order[r]] ? "  SYNC" : "") << "\n";
+        }
+        out << std::defaultfloat;
+    }
+};
+#endif
@@ -0,0 +1,72 @@
+#ifndef GPU_TIMER_H
+#define GPU_TIMER_H
+
+#include <glad/glad.h>
+
+// GPU time of a span of GL commands (GL_TIME_ELAPSED queries), read back without stalling:
+// a ring of QUERIES queries, so a result is usually picked up a frame or two after its
+// commands were submitted. Not nestable with other GL_TIME_ELAPSED queries.
+//
+//   timer.begin(); ...draw...; timer.end();
+//   double seconds;
+//   if (timer.poll(seconds)) ...   // latest finished measurement
+class GpuTimer
+{
+public:
+    static const unsigned QUERIES = 4;
+
+    // needs a current context
+    // ------------------------------------------------------------------------
+    void create()
+    {
+        glGenQueries(QUERIES, queries);
+        begun = finished = 0;
+    }
+    void destroy()
+    {
+        glDeleteQueries(QUERIES, queries);
+    }
+
+    void begin()
+    {
+        // all queries in flight: drop the oldest measurement rather than wait for it
+        if (begun - finished == QUERIES)
+            finished++;
+        glBeginQuery(GL_TIME_ELAPSED, queries[begun % QUERIES]);
+    }
+    void end()
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        begun++;
+    }
+
+    // the newest result that is ready; false if none is
+    // ------------------------------------------------------------------------
+    bool poll(double &seconds)
+    {
+        bool found = false;
+        while (finished != begun)
+        {
+            GLuint query = queries[finished % QUERIES];
+            GLint available = 0;
+            glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                break;
+            GLuint64 nanoseconds = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+            finished++;
+            // some drivers (llvmpipe) report a raw timestamp for the first query: skip it
+            if (nanoseconds > 1000000000ull)
+                continue;
+            seconds = nanoseconds * 1e-9;
+            found = true;
+        }
+        return found;
+    }
+
+private:
+    GLuint queries[QUERIES] = {};
+    unsigned begun = 0;
+    unsigned finished = 0;
+};
+#endif
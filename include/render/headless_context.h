@@ -0,0 +1,113 @@
+#ifndef HEADLESS_CONTEXT_H
+#define HEADLESS_CONTEXT_H
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <iostream>
+
+// Off-screen GL 3.3 core context through EGL, for benchmarks and servers without a window system.
+// Falls back to Mesa's surfaceless platform when there is no default display (no X/Wayland).
+// After create() returns true, load glad with gladLoadGLLoader((GLADloadproc)eglGetProcAddress).
+class HeadlessContext
+{
+public:
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLSurface surface = EGL_NO_SURFACE;
+    EGLContext context = EGL_NO_CONTEXT;
+
+    HeadlessContext() {}
+    ~HeadlessContext()
+    {
+        destroy();
+    }
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    // create the context and a width x height pbuffer and make them current;
+    // debug requests a debug context so the driver reports KHR_debug messages (see DebugOutput)
+    // ------------------------------------------------------------------------
+    bool create(int width, int height, bool debug = false)
+    {
+        EGLint major, minor;
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+        {
+            PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            display = getPlatformDisplay ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL) : EGL_NO_DISPLAY;
+            if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+            {
+                std::cout << "ERROR::HEADLESS_CONTEXT::NO_EGL_DISPLAY" << std::endl;
+                display = EGL_NO_DISPLAY;
+                return false;
+            }
+        }
+        const EGLint configAttribs[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+            EGL_DEPTH_SIZE, 24,
+            EGL_NONE
+        };
+        EGLConfig config;
+        EGLint configCount = 0;
+        if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0)
+        {
+            std::cout << "ERROR::HEADLESS_CONTEXT::NO_CONFIG" << std::endl;
+            return false;
+        }
+        eglBindAPI(EGL_OPENGL_API);
+        const EGLint contextAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_CONTEXT_OPENGL_DEBUG, debug ? EGL_TRUE : EGL_FALSE,
+            EGL_NONE
+        };
+        context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+        if (context == EGL_NO_CONTEXT)
+        {
+            std::cout << "ERROR::HEADLESS_CONTEXT::CONTEXT_CREATION_FAILED 0x" << std::hex << eglGetError() << std::dec << std::endl;
+            return false;
+        }
+        const EGLint surfaceAttribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        surface = eglCreatePbufferSurface(display, config, surfaceAttribs);
+        if (!eglMakeCurrent(display, surface, surface, context))
+        {
+            std::cout << "ERROR::HEADLESS_CONTEXT::MAKE_CURRENT_FAILED 0x" << std::hex << eglGetError() << std::dec << std::endl;
+            return false;
+        }
+        return true;
+    }
+    // move the context to another thread: release() on the old one, makeCurrent() on the new one
+    // ------------------------------------------------------------------------
+    bool makeCurrent()
+    {
+        return eglMakeCurrent(display, surface, surface, context) == EGL_TRUE;
+    }
+    void release()
+    {
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+    // stands in for glfwSwapBuffers in headless frame loops
+    // ------------------------------------------------------------------------
+    void swapBuffers()
+    {
+        eglSwapBuffers(display, surface);
+    }
+    void destroy()
+    {
+        if (display == EGL_NO_DISPLAY)
+            return;
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (surface != EGL_NO_SURFACE)
+            eglDestroySurface(display, surface);
+        if (context != EGL_NO_CONTEXT)
+            eglDestroyContext(display, context);
+        eglTerminate(display);
+        display = EGL_NO_DISPLAY;
+        surface = EGL_NO_SURFACE;
+        context = EGL_NO_CONTEXT;
+    }
+};
+#endif
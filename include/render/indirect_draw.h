@@ -0,0 +1,140 @@
+#ifndef INDIRECT_DRAW_H
+#define INDIRECT_DRAW_H
+
+#include <glad/glad.h>
+#include <render/buffer_ring.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Layout fixed by ARB_draw_indirect for glDrawElementsIndirect / glMultiDrawElementsIndirect
+struct DrawElementsIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint  baseVertex;
+    GLuint baseInstance;
+};
+
+// CPU-built list of indexed draws that all share one VAO, index type and program, submitted
+// with a single call. With ARB_multi_draw_indirect the commands are streamed into a
+// GL_DRAW_INDIRECT_BUFFER (through a BufferRing, so writing never waits on the GPU) and go out
+// in one glMultiDrawElementsIndirect. On a plain 3.3 context they go out through
+// glMultiDrawElementsBaseVertex instead; that path cannot honour baseInstance, and draws with
+// instanceCount != 1 fall back to one glDrawElementsInstancedBaseVertex each.
+class IndirectDrawList
+{
+public:
+    enum Path
+    {
+        MULTI_DRAW_INDIRECT = 0, // glMultiDrawElementsIndirect (ARB_multi_draw_indirect / GL 4.3)
+        MULTI_DRAW,              // glMultiDrawElementsBaseVertex (GL 3.2)
+        SEPARATE_DRAWS,          // one glDrawElementsInstancedBaseVertex per command, for comparison
+        PATH_COUNT
+    };
+
+    std::vector<DrawElementsIndirectCommand> commands;
+
+    IndirectDrawList()
+        : path(bestPath())
+    {
+    }
+
+    static bool indirectSupported()
+    {
+        return GLAD_GL_ARB_multi_draw_indirect && glad_glMultiDrawElementsIndirect != NULL;
+    }
+    static Path bestPath()
+    {
+        return indirectSupported() ? MULTI_DRAW_INDIRECT : MULTI_DRAW;
+    }
+    // force a submission path (benchmarks); an unsupported indirect path is downgraded
+    // ------------------------------------------------------------------------
+    void setPath(Path requested)
+    {
+        path = (requested == MULTI_DRAW_INDIRECT && !indirectSupported()) ? MULTI_DRAW : requested;
+    }
+    Path currentPath() const
+    {
+        return path;
+    }
+
+    void clear()
+    {
+        commands.clear();
+    }
+    void add(GLuint count, GLuint firstIndex, GLint baseVertex, GLuint instanceCount = 1, GLuint baseInstance = 0)
+    {
+        DrawElementsIndirectCommand command = { count, instanceCount, firstIndex, baseVertex, baseInstance };
+        commands.push_back(command);
+    }
+
+    // draw every command; the caller has bound the VAO (with its element buffer) and the program
+    // ------------------------------------------------------------------------
+    void submit(GLenum mode, GLenum indexType)
+    {
+        if (commands.empty())
+            return;
+        GLsizei drawCount = (GLsizei)commands.size();
+        size_t indexSize = indexType == GL_UNSIGNED_INT ? 4 : (indexType == GL_UNSIGNED_SHORT ? 2 : 1);
+        if (path == MULTI_DRAW_INDIRECT)
+        {
+            GLsizeiptr bytes = (GLsizeiptr)(commands.size() * sizeof(DrawElementsIndirectCommand));
+            if (!ring || ring->regionSize < bytes)
+                ring.reset(new BufferRing(GL_DRAW_INDIRECT_BUFFER, grow(bytes)));
+            void *dst = ring->map();
+            if (dst == NULL)
+                return;
+            std::memcpy(dst, commands.data(), bytes);
+            GLintptr offset = ring->unmap();
+            glMultiDrawElementsIndirect(mode, indexType, (const void*)offset, drawCount, 0);
+            ring->fence();
+            return;
+        }
+        if (path == MULTI_DRAW)
+        {
+            counts.clear();
+            offsets.clear();
+            baseVertices.clear();
+            for (const DrawElementsIndirectCommand &command : commands)
+            {
+                if (command.instanceCount != 1)
+                {
+                    drawSeparate(mode, indexType, indexSize, command);
+                    continue;
+                }
+                counts.push_back((GLsizei)command.count);
+                offsets.push_back((const void*)(command.firstIndex * indexSize));
+                baseVertices.push_back(command.baseVertex);
+            }
+            if (!counts.empty())
+                glMultiDrawElementsBaseVertex(mode, counts.data(), indexType, (const void* const*)offsets.data(), (GLsizei)counts.size(), baseVertices.data());
+            return;
+        }
+        for (const DrawElementsIndirectCommand &command : commands)
+            drawSeparate(mode, indexType, indexSize, command);
+    }
+
+private:
+    Path path;
+    std::unique_ptr<BufferRing> ring;
+    std::vector<GLsizei> counts;
+    std::vector<const void*> offsets;
+    std::vector<GLint> baseVertices;
+
+    static GLsizeiptr grow(GLsizeiptr bytes)
+    {
+        GLsizeiptr size = 4096;
+        while (size < bytes)
+            size *= 2;
+        return size;
+    }
+    static void drawSeparate(GLenum mode, GLenum indexType, size_t indexSize, const DrawElementsIndirectCommand &command)
+    {
+        glDrawElementsInstancedBaseVertex(mode, (GLsizei)command.count, indexType,
+            (const void*)(command.firstIndex * indexSize), (GLsizei)command.instanceCount, command.baseVertex);
+    }
+};
+#endif
@@ -0,0 +1,192 @@
+#ifndef INSTANCE_RENDERER_H
+#define INSTANCE_RENDERER_H
+
+#include <glad/glad.h>
+#include <math/matrix.h>
+#include <render/city_renderer.h>
+#include <render/instance_stream.h>
+
+#include <cstddef>
+#include <iostream>
+
+// Draws many unit cubes (CityRenderer's, from 0 to 1 on each axis) in one instanced draw, each
+// placed by its own 4x4 matrix: the world matrices a SceneGraph writes, streamed as they are
+// (a column per attribute, locations 2 to 5) through an InstanceStream, next to a static colour
+// per instance. On the GL thread the graph writes straight into the mapped stream; a render
+// thread that gets the matrices from another thread copies them in once with upload().
+//
+//   instances.create(graph.size());
+//   instances.setColors(colors, graph.size());   // in slot order
+//   size_t count = graph.size();
+//   graph.update(instances.map(count));          // each frame
+//   instances.unmap(count);                      // or instances.upload(matrices, graph.size())
+//   instances.draw(viewProjection, graph.size());
+class InstanceRenderer
+{
+public:
+    // ------------------------------------------------------------------------
+    bool create(size_t maxInstances)
+    {
+        capacity = maxInstances;
+        float vertices[CityRenderer::CUBE_VERTEX_FLOATS];
+        unsigned short indices[CityRenderer::CUBE_INDEX_COUNT];
+        CityRenderer::cube(vertices, indices);
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
+        glGenBuffers(1, &colorBuffer);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        matrices.create(capacity, sizeof(math::mat4));
+        for (int column = 0; column < 4; column++)
+        {
+            glEnableVertexAttribArray(2 + column);
+            glVertexAttribDivisor(2 + column, 1);
+        }
+        pointMatrices(0);
+        glBindBuffer(GL_ARRAY_BUFFER, colorBuffer);
+        glBufferData(GL_ARRAY_BUFFER, capacity * 3 * sizeof(float), NULL, GL_STATIC_DRAW);
+        glVertexAttribPointer(6, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(6);
+        glVertexAttribDivisor(6, 1);
+        glBindVertexArray(0);
+
+        program = compile();
+        if (!program)
+            return false;
+        viewProjectionLocation = glGetUniformLocation(program, "viewProjection");
+        return true;
+    }
+    void destroy()
+    {
+        if (!VAO)
+            return;
+        glDeleteVertexArrays(1, &VAO);
+        unsigned int buffers[3] = { VBO, EBO, colorBuffer };
+        glDeleteBuffers(3, buffers);
+        matrices.destroy();
+        glDeleteProgram(program);
+        VAO = VBO = EBO = colorBuffer = program = 0;
+    }
+
+    // count RGB colours (at most the create() size)
+    // ------------------------------------------------------------------------
+    void setColors(const float *rgb, size_t count)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, colorBuffer);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, (count < capacity ? count : capacity) * 3 * sizeof(float), rgb);
+    }
+
+    // room for count matrices in this frame's part of the stream (count is lowered to the
+    // create() size), for SceneGraph::update to write into; NULL if count is 0. Regions are
+    // whole matrices apart and GL maps at least 64-byte aligned, so mat4's alignment holds
+    // ------------------------------------------------------------------------
+    math::mat4 *map(size_t &count)
+    {
+        return (math::mat4*)matrices.map(count);
+    }
+    // count: as map() left it
+    void unmap(size_t count)
+    {
+        matrixOffset = matrices.unmap();
+        uploaded = count;
+    }
+    // copy count matrices written elsewhere into the stream
+    void upload(const math::mat4 *world, size_t count)
+    {
+        uploaded = matrices.upload(world, count);
+        matrixOffset = matrices.offset();
+    }
+
+    // the first count instances (of those uploaded this frame); expects the depth test on
+    // ------------------------------------------------------------------------
+    void draw(const float viewProjection[16], size_t count)
+    {
+        glUseProgram(program);
+        glBindVertexArray(VAO);
+        glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, viewProjection);
+        if (count > uploaded)
+            count = uploaded;
+        if (count)
+        {
+            pointMatrices(matrixOffset);
+            glDrawElementsInstanced(GL_TRIANGLES, CityRenderer::CUBE_INDEX_COUNT, GL_UNSIGNED_SHORT, 0, (GLsizei)count);
+        }
+        matrices.fence();
+        uploaded = 0;
+    }
+
+private:
+    // the world matrix attributes (a column per location, 2 to 5) at byte offset in the stream;
+    // GL 3.3 has no base instance, so they follow the ring's region. Expects the VAO bound
+    void pointMatrices(GLintptr offset)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, matrices.buffer());
+        for (int column = 0; column < 4; column++)
+            glVertexAttribPointer(2 + column, 4, GL_FLOAT, GL_FALSE, 16 * sizeof(float), (void*)(offset + column * 4 * sizeof(float)));
+    }
+
+    static unsigned int compile()
+    {
+        const char *vertexSource = "#version 330 core\n"
+        "layout (location = 0) in vec3 aPos;\n"
+        "layout (location = 1) in vec3 aNormal;\n"
+        "layout (location = 2) in mat4 aModel;\n"
+        "layout (location = 6) in vec3 aColor;\n"
+        "uniform mat4 viewProjection;\n"
+        "flat out vec3 ourColor;\n"
+        "void main()\n"
+        "{\n"
+        "   gl_Position = viewProjection * aModel * vec4(aPos, 1.0);\n"
+        "   vec3 normal = normalize(transpose(inverse(mat3(aModel))) * aNormal);\n"
+        "   float light = 0.45 + 0.55 * max(dot(normal, normalize(vec3(0.4, 1.0, 0.3))), 0.0);\n"
+        "   ourColor = aColor * light;\n"
+        "}\0";
+        const char *fragmentSource = "#version 330 core\n"
+        "out vec4 FragColor;\n"
+        "flat in vec3 ourColor;\n"
+        "void main()\n"
+        "{\n"
+        "   FragColor = vec4(ourColor, 1.0);\n"
+        "}\0";
+        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShader, 1, &vertexSource, NULL);
+        glCompileShader(vertexShader);
+        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+        glCompileShader(fragmentShader);
+        unsigned int shaderProgram = glCreateProgram();
+        glAttachShader(shaderProgram, vertexShader);
+        glAttachShader(shaderProgram, fragmentShader);
+        glLinkProgram(shaderProgram);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        int success;
+        glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            char infoLog[512];
+            glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+            std::cout << "ERROR::INSTANCE_RENDERER::PROGRAM_LINKING_FAILED\n" << infoLog << std::endl;
+            glDeleteProgram(shaderProgram);
+            return 0;
+        }
+        return shaderProgram;
+    }
+
+    size_t capacity = 0, uploaded = 0;
+    InstanceStream matrices;
+    GLintptr matrixOffset = 0;
+    unsigned int VAO = 0, VBO = 0, EBO = 0;
+    unsigned int colorBuffer = 0;
+    unsigned int program = 0;
+    int viewProjectionLocation = -1;
+};
+#endif
@@ -0,0 +1,83 @@
+#ifndef INSTANCE_STREAM_H
+#define INSTANCE_STREAM_H
+
+#include <glad/glad.h>
+#include <render/buffer_ring.h>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+// Per-instance data rewritten every frame (world matrices, LOD instances), streamed through a
+// BufferRing: map() hands out this frame's region so the producer (SceneGraph::update, a copy
+// of a LodSelector selection) writes the instances straight into GL memory, unmap() returns the
+// byte offset to point the instance attributes at (GL 3.3 has no base instance), and fence()
+// follows the last draw that reads them. Nothing is orphaned or copied a second time by
+// glBufferSubData. Counts beyond the create() capacity are clamped.
+//
+//   stream.create(maxInstances, sizeof(Instance));
+//   size_t count = n;
+//   void *dst = stream.map(count);     // count clamped to the capacity
+//   ...write count instances to dst...
+//   GLintptr offset = stream.unmap();
+//   ...glVertexAttribPointer(..., (void*)(offset + ...)); glDrawElementsInstanced(...)...
+//   stream.fence();
+class InstanceStream
+{
+public:
+    // ------------------------------------------------------------------------
+    void create(size_t maxInstances, size_t instanceBytes)
+    {
+        capacity = maxInstances;
+        stride = instanceBytes;
+        ring.reset(new BufferRing(GL_ARRAY_BUFFER, (GLsizeiptr)(capacity ? capacity * stride : stride)));
+    }
+    void destroy()
+    {
+        ring.reset();
+        capacity = 0;
+    }
+
+    // this frame's region with room for count instances (lowered to the capacity); NULL if
+    // there is nothing to write or the map failed (count is then 0)
+    // ------------------------------------------------------------------------
+    void *map(size_t &count)
+    {
+        if (count > capacity)
+            count = capacity;
+        void *dst = count ? ring->map() : NULL;
+        if (dst == NULL)
+            count = 0;
+        return dst;
+    }
+    // byte offset of this frame's instances in buffer()
+    // ------------------------------------------------------------------------
+    GLintptr unmap()
+    {
+        return ring->unmap();
+    }
+    // map, copy and unmap: for instances produced somewhere map() can't be reached (another
+    // thread); returns how many were copied
+    // ------------------------------------------------------------------------
+    size_t upload(const void *instances, size_t count)
+    {
+        void *dst = map(count);
+        if (dst)
+            std::memcpy(dst, instances, count * stride);
+        ring->unmap();
+        return count;
+    }
+    void fence()
+    {
+        ring->fence();
+    }
+
+    unsigned int buffer() const { return ring->ID; }
+    GLintptr offset() const { return ring->offset(); }
+
+private:
+    std::unique_ptr<BufferRing> ring;
+    size_t capacity = 0;
+    size_t stride = 0;
+};
+#endif
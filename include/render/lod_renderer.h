@@ -0,0 +1,214 @@
+#ifndef LOD_RENDERER_H
+#define LOD_RENDERER_H
+
+#include <glad/glad.h>
+#include <mesh/mesh_format.h>
+#include <mesh/simplifier.h>
+#include <render/instance_stream.h>
+#include <scene/lod_selector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Draws what a LodSelector chose for one mesh. The vertices and the indices of every level
+// are uploaded once with glBufferData, as oldBuilds/main.cpp uploads its triangle; the
+// instances are streamed each frame through an InstanceStream (one copy into a mapped ring
+// region, fenced after the frame's draws). Each level is one glDrawElementsInstanced of its solid
+// instances and one of its fading ones, whose fragment shader discards the pixels outside a
+// 4x4 ordered-dither mask. The solid draws don't discard, so they keep early depth testing.
+// GL 3.3 has no base instance, so the instance attributes are pointed at the level's part of
+// the stream's region before each draw.
+//
+//   rocks.create(mesh, levels, objects * 2);   // a fading instance is drawn twice
+//   rocks.upload(selection);                   // each frame, what LodSelector::select wrote
+//   rocks.draw(viewProjection, selection);
+class LodRenderer
+{
+public:
+    // the mesh as buildLodChain left it, with a position and a normal (locations 0 and 1)
+    // ------------------------------------------------------------------------
+    bool create(const MeshData &mesh, const std::vector<MeshLod> &chain, size_t maxInstances)
+    {
+        levels = chain;
+        capacity = maxInstances;
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size(), mesh.vertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        indexType = mesh.vertexCount() <= 0x10000 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        if (indexType == GL_UNSIGNED_SHORT)
+        {
+            std::vector<uint16_t> narrow(mesh.indices.begin(), mesh.indices.end());
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, narrow.size() * sizeof(uint16_t), narrow.data(), GL_STATIC_DRAW);
+        }
+        else
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint32_t), mesh.indices.data(), GL_STATIC_DRAW);
+        for (const MeshAttribute &attribute : mesh.attributes)
+        {
+            if (attribute.location > MESH_ATTRIBUTE_NORMAL)
+                continue;
+            glVertexAttribPointer(attribute.location, attribute.components, attribute.type,
+                attribute.normalized ? GL_TRUE : GL_FALSE, mesh.vertexStride, (void*)(uintptr_t)attribute.offset);
+            glEnableVertexAttribArray(attribute.location);
+        }
+        instances.create(capacity, sizeof(LodSelector::Instance));
+        for (int attribute = 0; attribute < 5; attribute++)
+        {
+            glEnableVertexAttribArray(3 + attribute);
+            glVertexAttribDivisor(3 + attribute, 1);
+        }
+        pointInstances(0);
+        glBindVertexArray(0);
+
+        for (int masked = 0; masked < 2; masked++)
+        {
+            programs[masked] = compile(masked != 0);
+            if (!programs[masked])
+                return false;
+            viewProjectionLocations[masked] = glGetUniformLocation(programs[masked], "viewProjection");
+            colorLocations[masked] = glGetUniformLocation(programs[masked], "color");
+        }
+        return true;
+    }
+    void destroy()
+    {
+        if (!VAO)
+            return;
+        glDeleteVertexArrays(1, &VAO);
+        unsigned int buffers[2] = { VBO, EBO };
+        glDeleteBuffers(2, buffers);
+        instances.destroy();
+        glDeleteProgram(programs[0]);
+        glDeleteProgram(programs[1]);
+        VAO = VBO = EBO = programs[0] = programs[1] = 0;
+    }
+
+    // the selection's instances (at most the create() count), into this frame's ring region
+    // ------------------------------------------------------------------------
+    void upload(const LodSelector::Selection &selection)
+    {
+        uploaded = instances.upload(selection.instances.data(), selection.instances.size());
+        instanceOffset = instances.offset();
+    }
+
+    // every level's solid instances, then the fading ones; expects the depth test on. Fences
+    // the uploaded instances, so upload again before the next draw
+    // ------------------------------------------------------------------------
+    void draw(const float viewProjection[16], const LodSelector::Selection &selection, const float color[3] = DEFAULT_COLOR)
+    {
+        glBindVertexArray(VAO);
+        size_t indexSize = indexType == GL_UNSIGNED_INT ? 4 : 2;
+        for (int masked = 0; masked < 2; masked++)
+        {
+            glUseProgram(programs[masked]);
+            glUniformMatrix4fv(viewProjectionLocations[masked], 1, GL_FALSE, viewProjection);
+            glUniform3fv(colorLocations[masked], 1, color);
+            for (size_t l = 0; l < levels.size() && l < selection.ranges.size(); l++)
+            {
+                const LodSelector::Range &range = selection.ranges[l];
+                uint32_t first = masked ? range.first + range.solid : range.first, count = masked ? range.fading : range.solid;
+                if (!count || first + count > uploaded)
+                    continue;
+                pointInstances(first);
+                glDrawElementsInstanced(GL_TRIANGLES, levels[l].indexCount, indexType, (void*)(uintptr_t)(levels[l].indexOffset * indexSize), count);
+            }
+        }
+        instances.fence();
+        uploaded = 0;
+    }
+
+private:
+    static constexpr float DEFAULT_COLOR[3] = { 0.55f, 0.5f, 0.45f };
+
+    // the model matrix (a column per location, 3 to 6) and fade (7) from this frame's instance
+    // first on
+    void pointInstances(size_t first) const
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, instances.buffer());
+        size_t offset = instanceOffset + first * sizeof(LodSelector::Instance);
+        for (int column = 0; column < 4; column++)
+            glVertexAttribPointer(3 + column, 4, GL_FLOAT, GL_FALSE, sizeof(LodSelector::Instance), (void*)(offset + column * 4 * sizeof(float)));
+        glVertexAttribPointer(7, 1, GL_FLOAT, GL_FALSE, sizeof(LodSelector::Instance), (void*)(offset + offsetof(LodSelector::Instance, fade)));
+    }
+
+    static unsigned int compile(bool masked)
+    {
+        const char *vertexSource = "#version 330 core\n"
+        "layout (location = 0) in vec3 aPos;\n"
+        "layout (location = 1) in vec3 aNormal;\n"
+        "layout (location = 3) in mat4 aModel;\n"
+        "layout (location = 7) in float aFade;\n"
+        "uniform mat4 viewProjection;\n"
+        "uniform vec3 color;\n"
+        "out vec3 ourColor;\n"
+        "flat out float fade;\n"
+        "void main()\n"
+        "{\n"
+        "   gl_Position = viewProjection * aModel * vec4(aPos, 1.0);\n"
+        "   vec3 normal = normalize(mat3(aModel) * aNormal);\n" // uniform scale: no inverse transpose needed
+        "   float light = 0.35 + 0.65 * max(dot(normal, normalize(vec3(0.4, 1.0, 0.3))), 0.0);\n"
+        "   ourColor = color * light;\n"
+        "   fade = aFade;\n"
+        "}\0";
+        const char *solidSource = "#version 330 core\n"
+        "out vec4 FragColor;\n"
+        "in vec3 ourColor;\n"
+        "flat in float fade;\n"
+        "void main()\n"
+        "{\n"
+        "   FragColor = vec4(ourColor, 1.0);\n"
+        "}\0";
+        const char *maskedSource = "#version 330 core\n"
+        "out vec4 FragColor;\n"
+        "in vec3 ourColor;\n"
+        "flat in float fade;\n"
+        "const float BAYER[16] = float[16](0.0, 8.0, 2.0, 10.0, 12.0, 4.0, 14.0, 6.0, 3.0, 11.0, 1.0, 9.0, 15.0, 7.0, 13.0, 5.0);\n"
+        "void main()\n"
+        "{\n"
+        "   ivec2 p = ivec2(gl_FragCoord.xy) & 3;\n"
+        "   float threshold = (BAYER[p.y * 4 + p.x] + 0.5) / 16.0;\n"
+        "   if (fade >= 0.0 ? threshold >= fade : threshold < -fade)\n"
+        "       discard;\n"
+        "   FragColor = vec4(ourColor, 1.0);\n"
+        "}\0";
+        const char *fragmentSource = masked ? maskedSource : solidSource;
+        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShader, 1, &vertexSource, NULL);
+        glCompileShader(vertexShader);
+        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+        glCompileShader(fragmentShader);
+        unsigned int shaderProgram = glCreateProgram();
+        glAttachShader(shaderProgram, vertexShader);
+        glAttachShader(shaderProgram, fragmentShader);
+        glLinkProgram(shaderProgram);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        int success;
+        glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            char infoLog[512];
+            glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+            std::cout << "ERROR::LOD_RENDERER::PROGRAM_LINKING_FAILED\n" << infoLog << std::endl;
+            glDeleteProgram(shaderProgram);
+            return 0;
+        }
+        return shaderProgram;
+    }
+
+    std::vector<MeshLod> levels;
+    size_t capacity = 0, uploaded = 0;
+    GLenum indexType = GL_UNSIGNED_INT;
+    InstanceStream instances;
+    GLintptr instanceOffset = 0;
+    unsigned int VAO = 0, VBO = 0, EBO = 0;
+    unsigned int programs[2] = { 0, 0 };    // solid, masked
+    int viewProjectionLocations[2] = { -1, -1 }, colorLocations[2] = { -1, -1 };
+};
+#endif
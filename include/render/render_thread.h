@@ -0,0 +1,230 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <core/spsc_ring.h>
+#include <render/frame_stats.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Commands the main thread sends to the render thread outside of the per-frame data:
+// window resizes, one-off GL work (resource creation) and shutdown.
+struct RenderCommand
+{
+    enum Type
+    {
+        RESIZE,
+        CALL,
+        QUIT
+    };
+    Type type = CALL;
+    int width = 0;
+    int height = 0;
+    void (*function)(void*) = nullptr;
+    void *user = nullptr;
+
+    static RenderCommand resize(int width, int height)
+    {
+        RenderCommand command;
+        command.type = RESIZE;
+        command.width = width;
+        command.height = height;
+        return command;
+    }
+    static RenderCommand call(void (*function)(void*), void *user)
+    {
+        RenderCommand command;
+        command.type = CALL;
+        command.function = function;
+        command.user = user;
+        return command;
+    }
+};
+
+// Runs GL on its own thread so the main thread can keep the window system's event queue
+// (glfwPollEvents and friends, which must stay on the main thread) without delaying frames.
+//
+// Commands go through a lock-free SPSC ring. Frame data is double-buffered: the main thread
+// fills one FrameData while the render thread draws the other, so it runs at most one frame
+// ahead. The thread only sleeps (on a condition variable) when it has nothing to do.
+//
+//   RenderThread<FrameData>::Hooks hooks;  // init (make the context current, load GL), render, present, resize, shutdown
+//   renderer.start(hooks);
+//   while (...) { FrameData &frame = renderer.beginFrame(); ...fill...; renderer.submitFrame(inputTime); }
+//   renderer.stop();
+//
+// latency() is input sample to present returning (input-to-photon, minus display scanout);
+// pacing() is the interval between consecutive presents. Both are written by the render
+// thread, read them after stop().
+template <typename FrameData>
+class RenderThread
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Hooks
+    {
+        std::function<bool()> init;                  // render thread: make the context current, load GL
+        std::function<void(const FrameData&)> render;
+        std::function<void()> present;               // swap buffers (and wait for vsync, if enabled)
+        std::function<void(int, int)> resize;
+        std::function<void()> shutdown;              // render thread: release GL objects and the context
+    };
+
+    RenderThread() {}
+    ~RenderThread()
+    {
+        stop();
+    }
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // returns once hooks.init has run on the new thread; false if it failed
+    // ------------------------------------------------------------------------
+    bool start(const Hooks &renderHooks)
+    {
+        hooks = renderHooks;
+        initState.store(0);
+        thread = std::thread(&RenderThread::run, this);
+        std::unique_lock<std::mutex> lock(mutex);
+        mainWake.wait(lock, [this] { return initState.load() != 0; });
+        if (initState.load() < 0)
+        {
+            lock.unlock();
+            thread.join();
+            return false;
+        }
+        return true;
+    }
+    // post QUIT and wait for the thread; frames already submitted are still drawn
+    // ------------------------------------------------------------------------
+    void stop()
+    {
+        if (!thread.joinable())
+            return;
+        RenderCommand quit;
+        quit.type = RenderCommand::QUIT;
+        post(quit);
+        thread.join();
+    }
+
+    // main thread only; spins (yielding) in the rare case the ring is full
+    // ------------------------------------------------------------------------
+    void post(const RenderCommand &command)
+    {
+        while (!commands.push(command))
+            std::this_thread::yield();
+        wakeRenderThread();
+    }
+
+    // the buffer to fill for the next frame; waits while the render thread still needs it
+    // ------------------------------------------------------------------------
+    FrameData &beginFrame()
+    {
+        size_t frame = submitted.load(std::memory_order_relaxed);
+        if (frame - consumed.load(std::memory_order_acquire) >= 2)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            mainWake.wait(lock, [this, frame] { return frame - consumed.load(std::memory_order_acquire) < 2; });
+        }
+        return frames[frame & 1];
+    }
+    // hand the buffer from beginFrame() over; inputTime is when the input it reflects was sampled
+    // ------------------------------------------------------------------------
+    void submitFrame(Clock::time_point inputTime = Clock::now())
+    {
+        size_t frame = submitted.load(std::memory_order_relaxed);
+        inputTimes[frame & 1] = inputTime;
+        submitted.store(frame + 1, std::memory_order_release);
+        wakeRenderThread();
+    }
+
+    const FrameStats &latency() const { return latencyStats; }
+    const FrameStats &pacing() const { return pacingStats; }
+
+private:
+    void wakeRenderThread()
+    {
+        // the state change above is already visible; taking the lock orders it with the waiter's predicate check
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        renderWake.notify_one();
+    }
+
+    void run()
+    {
+        bool ok = !hooks.init || hooks.init();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            initState.store(ok ? 1 : -1);
+        }
+        mainWake.notify_one();
+        if (!ok)
+            return;
+
+        bool running = true;
+        Clock::time_point lastPresent;
+        bool presented = false;
+        while (running)
+        {
+            RenderCommand command;
+            while (commands.pop(command))
+            {
+                if (command.type == RenderCommand::QUIT)
+                    running = false;
+                else if (command.type == RenderCommand::RESIZE && hooks.resize)
+                    hooks.resize(command.width, command.height);
+                else if (command.type == RenderCommand::CALL && command.function)
+                    command.function(command.user);
+            }
+            size_t frame = consumed.load(std::memory_order_relaxed);
+            if (submitted.load(std::memory_order_acquire) == frame)
+            {
+                if (!running)
+                    break;
+                std::unique_lock<std::mutex> lock(mutex);
+                renderWake.wait(lock, [this, frame] {
+                    return submitted.load(std::memory_order_acquire) != frame || commands.size() != 0;
+                });
+                continue;
+            }
+            if (hooks.render)
+                hooks.render(frames[frame & 1]);
+            if (hooks.present)
+                hooks.present();
+            Clock::time_point now = Clock::now();
+            latencyStats.add(std::chrono::duration<double>(now - inputTimes[frame & 1]).count());
+            if (presented)
+                pacingStats.add(std::chrono::duration<double>(now - lastPresent).count());
+            lastPresent = now;
+            presented = true;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                consumed.store(frame + 1, std::memory_order_release);
+            }
+            mainWake.notify_one();
+        }
+        if (hooks.shutdown)
+            hooks.shutdown();
+    }
+
+    Hooks hooks;
+    std::thread thread;
+    SpscRing<RenderCommand, 64> commands;
+    FrameData frames[2];
+    Clock::time_point inputTimes[2];
+    alignas(64) std::atomic<size_t> submitted{0};
+    alignas(64) std::atomic<size_t> consumed{0};
+    std::atomic<int> initState{0};
+    std::mutex mutex;
+    std::condition_variable renderWake;
+    std::condition_variable mainWake;
+    FrameStats latencyStats;
+    FrameStats pacingStats;
+};
+#endif
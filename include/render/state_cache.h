@@ -0,0 +1,340 @@
+#ifndef STATE_CACHE_H
+#define STATE_CACHE_H
+
+#include <glad/glad.h>
+
+#include <iostream>
+#include <iomanip>
+
+// Shadow copy of the bits of GL state the render loop touches every frame.
+// install() swaps the glad function pointers for glUseProgram, glBindVertexArray,
+// glBindBuffer and glClearColor with filtering versions, so existing code (main.cpp,
+// Shader::use) drops redundant calls without being rewritten. glBindBufferBase/Range and the
+// deletes are hooked only to keep the shadow right, as they move the bindings it tracks.
+// Must be installed after gladLoadGLLoader and only used from the thread owning the context.
+class StateCache
+{
+public:
+    enum Entry
+    {
+        USE_PROGRAM = 0,
+        BIND_VERTEX_ARRAY,
+        BIND_BUFFER,
+        CLEAR_COLOR,
+        ENTRY_COUNT
+    };
+
+    struct Counters
+    {
+        unsigned long long forwarded[ENTRY_COUNT];
+        unsigned long long filtered[ENTRY_COUNT];
+    };
+
+    // wrap the glad function pointers with the filtering versions
+    // ------------------------------------------------------------------------
+    static void install()
+    {
+        if (installed())
+            return;
+        real().useProgram        = glad_glUseProgram;
+        real().bindVertexArray   = glad_glBindVertexArray;
+        real().bindBuffer        = glad_glBindBuffer;
+        real().clearColor        = glad_glClearColor;
+        real().deleteBuffers     = glad_glDeleteBuffers;
+        real().deleteVertexArrays = glad_glDeleteVertexArrays;
+        real().bindBufferBase    = glad_glBindBufferBase;
+        real().bindBufferRange   = glad_glBindBufferRange;
+        glad_glUseProgram         = &hookUseProgram;
+        glad_glBindVertexArray    = &hookBindVertexArray;
+        glad_glBindBuffer         = &hookBindBuffer;
+        glad_glClearColor         = &hookClearColor;
+        glad_glDeleteBuffers      = &hookDeleteBuffers;
+        glad_glDeleteVertexArrays = &hookDeleteVertexArrays;
+        glad_glBindBufferBase     = &hookBindBufferBase;
+        glad_glBindBufferRange    = &hookBindBufferRange;
+        invalidate();
+    }
+    // restore the original glad function pointers
+    // ------------------------------------------------------------------------
+    static void uninstall()
+    {
+        if (!installed())
+            return;
+        glad_glUseProgram         = real().useProgram;
+        glad_glBindVertexArray    = real().bindVertexArray;
+        glad_glBindBuffer         = real().bindBuffer;
+        glad_glClearColor         = real().clearColor;
+        glad_glDeleteBuffers      = real().deleteBuffers;
+        glad_glDeleteVertexArrays = real().deleteVertexArrays;
+        glad_glBindBufferBase     = real().bindBufferBase;
+        glad_glBindBufferRange    = real().bindBufferRange;
+        real() = RealFunctions();
+    }
+    static bool installed()
+    {
+        return real().useProgram != NULL;
+    }
+    // forget everything we know; the next call of each kind is forwarded.
+    // call this after code that changes GL state behind our back (e.g. a third party library)
+    // ------------------------------------------------------------------------
+    static void invalidate()
+    {
+        Shadow &s = shadow();
+        s.program = UNKNOWN;
+        s.vertexArray = UNKNOWN;
+        for (int i = 0; i < TARGET_COUNT; i++)
+            s.buffers[i] = UNKNOWN;
+        s.clearColorKnown = false;
+    }
+    // compare the shadow against what the driver reports. only compiled into debug builds,
+    // since every query here is a round trip into the driver
+    // ------------------------------------------------------------------------
+    static bool validate()
+    {
+#ifndef NDEBUG
+        const Shadow &s = shadow();
+        bool ok = true;
+        GLint value = 0;
+        if (s.program != UNKNOWN)
+        {
+            glGetIntegerv(GL_CURRENT_PROGRAM, &value);
+            ok &= check("GL_CURRENT_PROGRAM", s.program, (GLuint)value);
+        }
+        if (s.vertexArray != UNKNOWN)
+        {
+            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &value);
+            ok &= check("GL_VERTEX_ARRAY_BINDING", s.vertexArray, (GLuint)value);
+        }
+        for (int i = 0; i < TARGET_COUNT; i++)
+        {
+            GLenum binding = targetBinding(i);
+            if (s.buffers[i] == UNKNOWN || binding == GL_NONE)
+                continue;
+            glGetIntegerv(binding, &value);
+            ok &= check("buffer binding", s.buffers[i], (GLuint)value);
+        }
+        if (s.clearColorKnown)
+        {
+            GLfloat color[4];
+            glGetFloatv(GL_COLOR_CLEAR_VALUE, color);
+            for (int i = 0; i < 4; i++)
+            {
+                if (color[i] != s.clearColor[i])
+                {
+                    std::cout << "ERROR::STATE_CACHE::MISMATCH GL_COLOR_CLEAR_VALUE[" << i << "] shadow " << s.clearColor[i] << " driver " << color[i] << std::endl;
+                    ok = false;
+                }
+            }
+        }
+        return ok;
+#else
+        return true;
+#endif
+    }
+    // when enabled (debug builds only) every filtered call re-checks the shadow against the driver
+    // ------------------------------------------------------------------------
+    static void setValidation(bool enabled)
+    {
+        shadow().validateOnFilter = enabled;
+    }
+
+    static Counters counters()
+    {
+        return stats();
+    }
+    static void resetCounters()
+    {
+        stats() = Counters();
+    }
+    // print forwarded/filtered calls per entry point
+    // ------------------------------------------------------------------------
+    static void report(std::ostream &out = std::cout)
+    {
+        static const char *names[ENTRY_COUNT] = { "glUseProgram", "glBindVertexArray", "glBindBuffer", "glClearColor" };
+        const Counters &c = stats();
+        out << std::left << std::setw(20) << "entry point" << std::right << std::setw(12) << "forwarded" << std::setw(12) << "filtered" << "\n";
+        for (int i = 0; i < ENTRY_COUNT; i++)
+            out << std::left << std::setw(20) << names[i] << std::right << std::setw(12) << c.forwarded[i] << std::setw(12) << c.filtered[i] << "\n";
+    }
+
+private:
+    static const GLuint UNKNOWN = 0xFFFFFFFFu;
+    enum { TARGET_COUNT = 10 };
+
+    struct RealFunctions
+    {
+        PFNGLUSEPROGRAMPROC useProgram = NULL;
+        PFNGLBINDVERTEXARRAYPROC bindVertexArray = NULL;
+        PFNGLBINDBUFFERPROC bindBuffer = NULL;
+        PFNGLCLEARCOLORPROC clearColor = NULL;
+        PFNGLDELETEBUFFERSPROC deleteBuffers = NULL;
+        PFNGLDELETEVERTEXARRAYSPROC deleteVertexArrays = NULL;
+        PFNGLBINDBUFFERBASEPROC bindBufferBase = NULL;
+        PFNGLBINDBUFFERRANGEPROC bindBufferRange = NULL;
+    };
+    struct Shadow
+    {
+        GLuint program = UNKNOWN;
+        GLuint vertexArray = UNKNOWN;
+        GLuint buffers[TARGET_COUNT];
+        GLfloat clearColor[4];
+        bool clearColorKnown = false;
+        bool validateOnFilter = false;
+    };
+
+    static RealFunctions &real()
+    {
+        static RealFunctions functions;
+        return functions;
+    }
+    static Shadow &shadow()
+    {
+        static Shadow state;
+        return state;
+    }
+    static Counters &stats()
+    {
+        static Counters counters = Counters();
+        return counters;
+    }
+
+    // map a buffer target onto a shadow slot, -1 for targets we don't track
+    // ------------------------------------------------------------------------
+    static int targetIndex(GLenum target)
+    {
+        switch (target)
+        {
+            case GL_ARRAY_BUFFER:              return 0;
+            case GL_ELEMENT_ARRAY_BUFFER:      return 1;
+            case GL_UNIFORM_BUFFER:            return 2;
+            case GL_COPY_READ_BUFFER:          return 3;
+            case GL_COPY_WRITE_BUFFER:         return 4;
+            case GL_PIXEL_PACK_BUFFER:         return 5;
+            case GL_PIXEL_UNPACK_BUFFER:       return 6;
+            case GL_TEXTURE_BUFFER:            return 7;
+            case GL_TRANSFORM_FEEDBACK_BUFFER: return 8;
+            case GL_DRAW_INDIRECT_BUFFER:      return 9;
+            default:                           return -1;
+        }
+    }
+    // the glGetIntegerv name of a slot's binding, GL_NONE where the context can't report it:
+    // 3.3 has no query for the GL_TEXTURE_BUFFER buffer binding (GL_TEXTURE_BINDING_BUFFER is
+    // the texture), and the indirect binding exists only with ARB_draw_indirect
+    // ------------------------------------------------------------------------
+    static GLenum targetBinding(int index)
+    {
+        static const GLenum bindings[TARGET_COUNT] = {
+            GL_ARRAY_BUFFER_BINDING, GL_ELEMENT_ARRAY_BUFFER_BINDING, GL_UNIFORM_BUFFER_BINDING,
+            GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, /* 3.3 queries these by target name */ GL_PIXEL_PACK_BUFFER_BINDING,
+            GL_PIXEL_UNPACK_BUFFER_BINDING, GL_NONE, GL_TRANSFORM_FEEDBACK_BUFFER_BINDING,
+            GL_DRAW_INDIRECT_BUFFER_BINDING
+        };
+        if (bindings[index] == GL_DRAW_INDIRECT_BUFFER_BINDING && !GLAD_GL_ARB_draw_indirect)
+            return GL_NONE;
+        return bindings[index];
+    }
+    static bool check(const char *what, GLuint expected, GLuint actual)
+    {
+        if (expected == actual)
+            return true;
+        std::cout << "ERROR::STATE_CACHE::MISMATCH " << what << " shadow " << expected << " driver " << actual << std::endl;
+        return false;
+    }
+    static void filtered(Entry entry)
+    {
+        stats().filtered[entry]++;
+#ifndef NDEBUG
+        if (shadow().validateOnFilter)
+            validate();
+#endif
+    }
+
+    // filtering replacements for the glad entry points
+    // ------------------------------------------------------------------------
+    static void APIENTRY hookUseProgram(GLuint program)
+    {
+        Shadow &s = shadow();
+        if (s.program == program)
+            return filtered(USE_PROGRAM);
+        s.program = program;
+        stats().forwarded[USE_PROGRAM]++;
+        real().useProgram(program);
+    }
+    static void APIENTRY hookBindVertexArray(GLuint array)
+    {
+        Shadow &s = shadow();
+        if (s.vertexArray == array)
+            return filtered(BIND_VERTEX_ARRAY);
+        s.vertexArray = array;
+        // the element array binding is part of the VAO, so we no longer know it
+        s.buffers[targetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+        stats().forwarded[BIND_VERTEX_ARRAY]++;
+        real().bindVertexArray(array);
+    }
+    static void APIENTRY hookBindBuffer(GLenum target, GLuint buffer)
+    {
+        Shadow &s = shadow();
+        int index = targetIndex(target);
+        if (index >= 0 && s.buffers[index] == buffer)
+            return filtered(BIND_BUFFER);
+        if (index >= 0)
+            s.buffers[index] = buffer;
+        stats().forwarded[BIND_BUFFER]++;
+        real().bindBuffer(target, buffer);
+    }
+    static void APIENTRY hookClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Shadow &s = shadow();
+        if (s.clearColorKnown && s.clearColor[0] == red && s.clearColor[1] == green && s.clearColor[2] == blue && s.clearColor[3] == alpha)
+            return filtered(CLEAR_COLOR);
+        s.clearColor[0] = red;
+        s.clearColor[1] = green;
+        s.clearColor[2] = blue;
+        s.clearColor[3] = alpha;
+        s.clearColorKnown = true;
+        stats().forwarded[CLEAR_COLOR]++;
+        real().clearColor(red, green, blue, alpha);
+    }
+    // an indexed bind also binds the buffer to the generic target; forget that slot rather than
+    // guess, since a failed call (index out of range) leaves it unchanged
+    // ------------------------------------------------------------------------
+    static void APIENTRY hookBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        int slot = targetIndex(target);
+        if (slot >= 0)
+            shadow().buffers[slot] = UNKNOWN;
+        real().bindBufferBase(target, index, buffer);
+    }
+    static void APIENTRY hookBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        int slot = targetIndex(target);
+        if (slot >= 0)
+            shadow().buffers[slot] = UNKNOWN;
+        real().bindBufferRange(target, index, buffer, offset, size);
+    }
+    // deleting a bound object resets its binding to 0, keep the shadow in step
+    // ------------------------------------------------------------------------
+    static void APIENTRY hookDeleteBuffers(GLsizei n, const GLuint *buffers)
+    {
+        Shadow &s = shadow();
+        for (GLsizei i = 0; i < n; i++)
+            for (int t = 0; t < TARGET_COUNT; t++)
+                if (buffers[i] != 0 && s.buffers[t] == buffers[i])
+                    s.buffers[t] = 0;
+        real().deleteBuffers(n, buffers);
+    }
+    static void APIENTRY hookDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+    {
+        Shadow &s = shadow();
+        for (GLsizei i = 0; i < n; i++)
+        {
+            if (arrays[i] != 0 && s.vertexArray == arrays[i])
+            {
+                s.vertexArray = 0;
+                s.buffers[targetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+            }
+        }
+        real().deleteVertexArrays(n, arrays);
+    }
+};
+#endif
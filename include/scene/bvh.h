@@ -0,0 +1,735 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <core/job_system.h>
+#include <scene/frustum_culler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Bounding volume hierarchy over object boxes, for culling, picking and overlap queries that
+// touch a small part of a large scene.
+//
+//   build    top down with binned SAH: each node's objects are put into BINS bins by centroid
+//            on every axis, and split where the surface area heuristic is lowest. Nodes with
+//            more than PARALLEL_SIZE objects are binned in chunks and split into two jobs on the
+//            JobSystem, so the whole build spreads over the threads. The objects' boxes are
+//            partitioned in place and kept in leaf order, so binning, refits and the tests at
+//            the leaves read memory front to back
+//   update   moves an object; refit() then recomputes the bounds of the leaves holding moved
+//            objects and their ancestors (all nodes in one backward pass when many moved)
+//   rebuild  refit keeps the tree correct but not good; startRebuild() builds a fresh tree from
+//            a copy of the boxes on a thread of its own, and finishRebuild() swaps it in and
+//            refits the objects moved meanwhile
+//
+// Queries: frustum() lists the objects a view-projection sees (the same box test and list as
+// FrustumCuller, nodes entirely inside a plane skip it below), raycast() the nearest box a ray
+// enters and overlap() the boxes overlapping a box. Children are allocated after their parent,
+// so nodes[0] is the root and every child comes later in the array.
+//
+//   Bvh bvh(&jobs);
+//   bvh.build(&objects[0].min[0], &objects[0].max[0], sizeof(objects[0]), count);
+//   size_t n = bvh.frustum(viewProjection, visible.data());  // visible holds size() indices
+//
+// Build, update and query from the JobSystem's creating thread.
+class Bvh
+{
+public:
+    static const int BINS = 16;
+    static const uint32_t LEAF_SIZE = 4;
+    static const size_t PARALLEL_SIZE = 16384;
+    static const int MAX_DEPTH = 64;            // deeper nodes become leaves however many objects they hold
+    static const size_t FULL_REFIT_RATIO = 16;  // refit every node when more than 1 in this many leaves changed
+
+    struct Box
+    {
+        float min[3];
+        float max[3];
+    };
+    struct Node
+    {
+        float min[3];
+        uint32_t first;     // interior: the left child, the right one follows; leaf: the first in indices
+        float max[3];
+        uint32_t count;     // objects in a leaf, 0 for interior nodes
+    };
+    struct Hit
+    {
+        uint32_t object;
+        float distance;     // along the ray, in lengths of its direction; 0 when it starts inside
+    };
+
+    Bvh(JobSystem *jobSystem = nullptr) : jobs(jobSystem) {}
+    ~Bvh()
+    {
+        if (rebuildThread.joinable())
+            rebuildThread.join();
+    }
+    Bvh(const Bvh&) = delete;
+    Bvh& operator=(const Bvh&) = delete;
+
+    // count boxes, min and max 3 floats each, boxes stride bytes apart; object i is box i
+    // ------------------------------------------------------------------------
+    void build(const float *min, const float *max, size_t stride, size_t count)
+    {
+        if (rebuildThread.joinable()) // a rebuild of the old objects is of no use now
+            rebuildThread.join();
+        std::vector<Ref> refs(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const float *lo = (const float*)((const unsigned char*)min + i * stride);
+            const float *hi = (const float*)((const unsigned char*)max + i * stride);
+            for (int a = 0; a < 3; a++)
+            {
+                refs[i].min[a] = lo[a];
+                refs[i].max[a] = hi[a];
+            }
+            refs[i].object = (uint32_t)i;
+        }
+        buildTree(tree, refs, jobs);
+        leafDirty.assign(tree.nodeCount, 0);
+        dirtyLeaves.clear();
+    }
+
+    // moving objects
+    // ------------------------------------------------------------------------
+    void update(size_t object, const float min[3], const float max[3])
+    {
+        Box &box = tree.boxes[tree.slots[object]];
+        for (int a = 0; a < 3; a++)
+        {
+            box.min[a] = min[a];
+            box.max[a] = max[a];
+        }
+        markDirty((uint32_t)object);
+        if (rebuildThread.joinable() && !movedFlags[object])
+        {
+            movedFlags[object] = 1;
+            moved.push_back((uint32_t)object);
+        }
+    }
+    void refit()
+    {
+        if (dirtyLeaves.empty())
+            return;
+        if (dirtyLeaves.size() * FULL_REFIT_RATIO > tree.nodeCount / 2)
+        {
+            for (size_t n = tree.nodeCount; n-- > 0;)
+                refitNode((uint32_t)n);
+        }
+        else
+        {
+            for (uint32_t leaf : dirtyLeaves)
+            {
+                if (!refitNode(leaf))
+                    continue;
+                // up to the root, or until a node's bounds stay the same
+                for (uint32_t node = leaf; node != 0;)
+                {
+                    node = tree.parents[node];
+                    if (!refitNode(node))
+                        break;
+                }
+            }
+        }
+        for (uint32_t leaf : dirtyLeaves)
+            leafDirty[leaf] = 0;
+        dirtyLeaves.clear();
+    }
+
+    // background rebuild: one at a time; finishRebuild() returns true when it swapped a tree in
+    // (waiting for it if wait is set, else only if it is ready)
+    // ------------------------------------------------------------------------
+    void startRebuild()
+    {
+        if (rebuildThread.joinable())
+            return;
+        rebuildRefs.resize(size());
+        for (size_t i = 0; i < size(); i++)
+        {
+            const Box &box = tree.boxes[i];
+            rebuildRefs[i] = { { box.min[0], box.min[1], box.min[2] }, tree.indices[i], { box.max[0], box.max[1], box.max[2] }, 0 };
+        }
+        movedFlags.assign(size(), 0);
+        moved.clear();
+        rebuildReady.store(false, std::memory_order_relaxed);
+        rebuildThread = std::thread([this] {
+            buildTree(next, rebuildRefs, nullptr);
+            rebuildReady.store(true, std::memory_order_release);
+        });
+    }
+    bool finishRebuild(bool wait = false)
+    {
+        if (!rebuildThread.joinable() || (!wait && !rebuildReady.load(std::memory_order_acquire)))
+            return false;
+        rebuildThread.join();
+        for (uint32_t object : moved)
+            next.boxes[next.slots[object]] = tree.boxes[tree.slots[object]];
+        std::swap(tree, next);
+        leafDirty.assign(tree.nodeCount, 0);
+        dirtyLeaves.clear();
+        for (uint32_t object : moved)
+            markDirty(object);
+        refit();
+        return true;
+    }
+    bool rebuilding() const { return rebuildThread.joinable(); }
+
+    // queries
+    // ------------------------------------------------------------------------
+    // the objects inside or crossing the frustum of viewProjection (column-major, see Camera)
+    // written to visible (room for size() entries) in tree order; returns how many
+    size_t frustum(const float viewProjection[16], uint32_t *visible) const
+    {
+        if (!tree.nodeCount)
+            return 0;
+        float planes[6][4], absolute[6][3];
+        FrustumCuller::extractPlanes(viewProjection, planes);
+        for (int p = 0; p < 6; p++)
+            for (int a = 0; a < 3; a++)
+                absolute[p][a] = std::fabs(planes[p][a]);
+        struct Entry
+        {
+            uint32_t node;
+            uint32_t planeMask;     // the planes the node may cross; the others it is inside
+        };
+        Entry stack[MAX_DEPTH + 1];
+        int top = 0;
+        stack[top++] = { 0, 0x3F };
+        size_t count = 0;
+        while (top)
+        {
+            Entry entry = stack[--top];
+            const Node &node = tree.nodes[entry.node];
+            uint32_t mask = entry.planeMask;
+            if (mask && !classify(planes, absolute, node.min, node.max, mask))
+                continue;
+            if (!node.count)
+            {
+                stack[top++] = { node.first + 1, mask };
+                stack[top++] = { node.first, mask };
+                continue;
+            }
+            for (uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                visible[count] = tree.indices[i];
+                count += !mask || outsideNone(planes, absolute, tree.boxes[i], mask);
+            }
+        }
+        return count;
+    }
+    // the nearest object box the ray origin + t * direction enters for t in [0, maxDistance]
+    bool raycast(const float origin[3], const float direction[3], float maxDistance, Hit &hit) const
+    {
+        if (!tree.nodeCount)
+            return false;
+        float inverse[3] = { 1.0f / direction[0], 1.0f / direction[1], 1.0f / direction[2] };
+        float best = maxDistance, t;
+        bool found = false;
+        uint32_t stack[MAX_DEPTH + 1];
+        int top = 0;
+        if (slab(tree.nodes[0].min, tree.nodes[0].max, origin, inverse, best, t))
+            stack[top++] = 0;
+        while (top)
+        {
+            const Node &node = tree.nodes[stack[--top]];
+            if (!slab(node.min, node.max, origin, inverse, best, t)) // best may have shrunk since the push
+                continue;
+            if (node.count)
+            {
+                for (uint32_t i = node.first; i < node.first + node.count; i++)
+                {
+                    uint32_t object = tree.indices[i];
+                    if (slab(tree.boxes[i].min, tree.boxes[i].max, origin, inverse, best, t) && (!found || t < best || (t == best && object < hit.object)))
+                    {
+                        best = t;
+                        hit = { object, t };
+                        found = true;
+                    }
+                }
+                continue;
+            }
+            // nearer child on top
+            float tLeft, tRight;
+            const Node &left = tree.nodes[node.first], &right = tree.nodes[node.first + 1];
+            bool hitLeft = slab(left.min, left.max, origin, inverse, best, tLeft);
+            bool hitRight = slab(right.min, right.max, origin, inverse, best, tRight);
+            if (hitLeft && hitRight)
+            {
+                bool leftFirst = tLeft <= tRight;
+                stack[top++] = leftFirst ? node.first + 1 : node.first;
+                stack[top++] = leftFirst ? node.first : node.first + 1;
+            }
+            else if (hitLeft || hitRight)
+                stack[top++] = hitLeft ? node.first : node.first + 1;
+        }
+        return found;
+    }
+    // the objects whose boxes overlap [min, max] (touching counts) written to out (room for
+    // size() entries); returns how many
+    size_t overlap(const float min[3], const float max[3], uint32_t *out) const
+    {
+        if (!tree.nodeCount)
+            return 0;
+        uint32_t stack[MAX_DEPTH + 1];
+        int top = 0;
+        stack[top++] = 0;
+        size_t count = 0;
+        while (top)
+        {
+            const Node &node = tree.nodes[stack[--top]];
+            if (!overlaps(node.min, node.max, min, max))
+                continue;
+            if (!node.count)
+            {
+                stack[top++] = node.first + 1;
+                stack[top++] = node.first;
+                continue;
+            }
+            for (uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                out[count] = tree.indices[i];
+                count += overlaps(tree.boxes[i].min, tree.boxes[i].max, min, max);
+            }
+        }
+        return count;
+    }
+
+    size_t size() const { return tree.indices.size(); }
+    const Box &bounds(size_t object) const { return tree.boxes[tree.slots[object]]; }
+    const Node *nodes() const { return tree.nodes.data(); }
+    size_t nodeCount() const { return tree.nodeCount; }
+    int depth() const { return tree.depth; }
+
+    // the SAH cost of the tree: expected nodes visited plus objects tested by a ray through the
+    // root, with both costing 1; grows as refits loosen it
+    // ------------------------------------------------------------------------
+    double cost() const
+    {
+        if (!tree.nodeCount)
+            return 0.0;
+        double rootArea = area(tree.nodes[0].min, tree.nodes[0].max), total = 0.0;
+        for (size_t n = 0; n < tree.nodeCount; n++)
+        {
+            const Node &node = tree.nodes[n];
+            total += area(node.min, node.max) * (node.count ? node.count : 1);
+        }
+        return rootArea > 0.0 ? total / rootArea : (double)tree.nodeCount;
+    }
+
+private:
+    struct Tree
+    {
+        std::vector<Node> nodes;
+        std::vector<uint32_t> parents;
+        std::vector<uint32_t> indices;      // objects, leaf by leaf
+        std::vector<Box> boxes;             // boxes[i] is object indices[i]'s
+        std::vector<uint32_t> slots;        // per object, its position in indices and boxes
+        std::vector<uint32_t> objectLeaf;
+        size_t nodeCount = 0;
+        int depth = 0;
+    };
+    // an object while building; the centroid is taken as min + max, twice the real one
+    struct Ref
+    {
+        float min[3];
+        uint32_t object;
+        float max[3];
+        uint32_t padding;
+    };
+    struct Bin
+    {
+        Box bounds;
+        uint32_t count;
+    };
+    struct Bins
+    {
+        Bin bins[3][BINS];
+    };
+    struct Builder
+    {
+        Tree *tree;
+        std::vector<Ref> *refs;
+        std::vector<Ref> scratch;           // partitions go through it
+        std::atomic<uint32_t> nodeCount;
+        std::atomic<int> depth;
+        JobSystem *jobs;
+    };
+
+    // boxes
+    // ------------------------------------------------------------------------
+    static void empty(Box &box)
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            box.min[a] = INFINITY;
+            box.max[a] = -INFINITY;
+        }
+    }
+    // on values rather than std::min's references, which GCC turns into branches here
+    static float lesser(float a, float b)
+    {
+        return a < b ? a : b;
+    }
+    static float greater(float a, float b)
+    {
+        return a > b ? a : b;
+    }
+    static void grow(Box &box, const float min[3], const float max[3])
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            box.min[a] = lesser(min[a], box.min[a]);
+            box.max[a] = greater(max[a], box.max[a]);
+        }
+    }
+    // half the surface area, 0 for an empty box
+    static double area(const float min[3], const float max[3])
+    {
+        double d[3];
+        for (int a = 0; a < 3; a++)
+            d[a] = std::max((double)max[a] - min[a], 0.0);
+        return d[0] * d[1] + d[1] * d[2] + d[2] * d[0];
+    }
+    static bool overlaps(const float aMin[3], const float aMax[3], const float bMin[3], const float bMax[3])
+    {
+        return aMin[0] <= bMax[0] && bMin[0] <= aMax[0] && aMin[1] <= bMax[1] && bMin[1] <= aMax[1] && aMin[2] <= bMax[2] && bMin[2] <= aMax[2];
+    }
+    // the ray's entry distance into the box, if it enters it within [0, maxDistance]; slabs the
+    // ray lies in the plane of (0 * infinity) are skipped
+    static bool slab(const float min[3], const float max[3], const float origin[3], const float inverse[3], float maxDistance, float &t)
+    {
+        float enter = 0.0f, exit = maxDistance;
+        for (int a = 0; a < 3; a++)
+        {
+            float t0 = (min[a] - origin[a]) * inverse[a], t1 = (max[a] - origin[a]) * inverse[a];
+            enter = std::max(enter, std::min(t0, t1));
+            exit = std::min(exit, std::max(t0, t1));
+        }
+        t = enter;
+        return enter <= exit;
+    }
+
+    // frustum tests, as FrustumCuller does them: false if the node is outside a plane in mask,
+    // else mask loses the planes it is entirely inside
+    // ------------------------------------------------------------------------
+    static bool classify(const float planes[6][4], const float absolute[6][3], const float min[3], const float max[3], uint32_t &mask)
+    {
+        float c[3], e[3];
+        for (int a = 0; a < 3; a++)
+        {
+            c[a] = (min[a] + max[a]) * 0.5f;
+            e[a] = (max[a] - min[a]) * 0.5f;
+        }
+        for (int p = 0; p < 6; p++)
+        {
+            if (!(mask & 1u << p))
+                continue;
+            const float *n = planes[p];
+            float d = n[0] * c[0] + n[1] * c[1] + n[2] * c[2] + n[3];
+            float r = absolute[p][0] * e[0] + absolute[p][1] * e[1] + absolute[p][2] * e[2];
+            if (d + r < 0.0f)
+                return false;
+            if (d - r >= 0.0f)
+                mask &= ~(1u << p);
+        }
+        return true;
+    }
+    static bool outsideNone(const float planes[6][4], const float absolute[6][3], const Box &box, uint32_t mask)
+    {
+        return classify(planes, absolute, box.min, box.max, mask);
+    }
+
+    // refit
+    // ------------------------------------------------------------------------
+    void markDirty(uint32_t object)
+    {
+        uint32_t leaf = tree.objectLeaf[object];
+        if (!leafDirty[leaf])
+        {
+            leafDirty[leaf] = 1;
+            dirtyLeaves.push_back(leaf);
+        }
+    }
+    // recompute a node from its objects or children; false if its bounds stayed the same
+    bool refitNode(uint32_t index)
+    {
+        Node &node = tree.nodes[index];
+        Box box;
+        empty(box);
+        if (node.count)
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; i++)
+                grow(box, tree.boxes[i].min, tree.boxes[i].max);
+        }
+        else
+        {
+            grow(box, tree.nodes[node.first].min, tree.nodes[node.first].max);
+            grow(box, tree.nodes[node.first + 1].min, tree.nodes[node.first + 1].max);
+        }
+        bool changed = false;
+        for (int a = 0; a < 3; a++)
+        {
+            changed |= node.min[a] != box.min[a] || node.max[a] != box.max[a];
+            node.min[a] = box.min[a];
+            node.max[a] = box.max[a];
+        }
+        return changed;
+    }
+
+    // build
+    // ------------------------------------------------------------------------
+    // refs (reordered) into tree
+    static void buildTree(Tree &tree, std::vector<Ref> &refs, JobSystem *jobs)
+    {
+        size_t count = refs.size();
+        tree.nodes.resize(std::max<size_t>(2 * count, 1));
+        tree.parents.resize(tree.nodes.size());
+        tree.indices.resize(count);
+        tree.boxes.resize(count);
+        tree.slots.resize(count);
+        tree.objectLeaf.resize(count);
+        tree.nodeCount = 0;
+        tree.depth = 0;
+        if (!count)
+            return;
+        Builder builder;
+        builder.tree = &tree;
+        builder.refs = &refs;
+        builder.scratch.resize(count);
+        builder.nodeCount.store(1, std::memory_order_relaxed);
+        builder.depth.store(0, std::memory_order_relaxed);
+        builder.jobs = jobs;
+        Box bounds, centroids;
+        empty(bounds);
+        empty(centroids);
+        for (const Ref &ref : refs)
+        {
+            float c[3] = { ref.min[0] + ref.max[0], ref.min[1] + ref.max[1], ref.min[2] + ref.max[2] };
+            grow(bounds, ref.min, ref.max);
+            grow(centroids, c, c);
+        }
+        tree.parents[0] = 0;
+        buildNode(builder, 0, 0, count, bounds, centroids, 1);
+        tree.nodeCount = builder.nodeCount.load(std::memory_order_relaxed);
+        tree.depth = builder.depth.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; i++)
+        {
+            tree.indices[i] = refs[i].object;
+            tree.slots[refs[i].object] = (uint32_t)i;
+            std::copy(refs[i].min, refs[i].min + 3, tree.boxes[i].min);
+            std::copy(refs[i].max, refs[i].max + 3, tree.boxes[i].max);
+        }
+    }
+
+    static int binIndex(float centroid, float origin, float scale)
+    {
+        return std::min((int)((centroid - origin) * scale), BINS - 1);
+    }
+    static void binRange(const Builder &builder, size_t begin, size_t end, const Box &centroids, const float scale[3], Bins &out)
+    {
+        for (int a = 0; a < 3; a++)
+            for (Bin &bin : out.bins[a])
+            {
+                empty(bin.bounds);
+                bin.count = 0;
+            }
+        const Ref *refs = builder.refs->data();
+        for (size_t i = begin; i < end; i++)
+        {
+            const Ref &ref = refs[i];
+            float c[3] = { ref.min[0] + ref.max[0], ref.min[1] + ref.max[1], ref.min[2] + ref.max[2] };
+            for (int a = 0; a < 3; a++)
+            {
+                if (scale[a] == 0.0f)
+                    continue;
+                Bin &bin = out.bins[a][binIndex(c[a], centroids.min[a], scale[a])];
+                grow(bin.bounds, ref.min, ref.max);
+                bin.count++;
+            }
+        }
+    }
+
+    static void makeLeaf(Builder &builder, uint32_t index, size_t begin, size_t end, int depth)
+    {
+        Tree &tree = *builder.tree;
+        tree.nodes[index].first = (uint32_t)begin;
+        tree.nodes[index].count = (uint32_t)(end - begin);
+        for (size_t i = begin; i < end; i++)
+            tree.objectLeaf[(*builder.refs)[i].object] = index;
+        int deepest = builder.depth.load(std::memory_order_relaxed);
+        while (deepest < depth && !builder.depth.compare_exchange_weak(deepest, depth, std::memory_order_relaxed))
+            ;
+    }
+    static void buildNode(Builder &builder, uint32_t index, size_t begin, size_t end, const Box &bounds, const Box &centroids, int depth)
+    {
+        Tree &tree = *builder.tree;
+        Node &node = tree.nodes[index];
+        for (int a = 0; a < 3; a++)
+        {
+            node.min[a] = bounds.min[a];
+            node.max[a] = bounds.max[a];
+        }
+        size_t count = end - begin;
+        float scale[3];
+        bool splittable = false;
+        for (int a = 0; a < 3; a++)
+        {
+            float extent = centroids.max[a] - centroids.min[a];
+            scale[a] = extent > 0.0f ? BINS / extent : 0.0f;
+            if (!std::isfinite(scale[a]))
+                scale[a] = 0.0f;
+            splittable |= scale[a] > 0.0f;
+        }
+        if (count <= LEAF_SIZE || depth >= MAX_DEPTH || !splittable) // coincident centroids: no split separates them
+        {
+            makeLeaf(builder, index, begin, end, depth);
+            return;
+        }
+
+        // bin, in parallel chunks for large nodes
+        Bins bins;
+        bool parallel = builder.jobs && count > PARALLEL_SIZE;
+        if (parallel)
+        {
+            size_t chunks = (count + PARALLEL_SIZE - 1) / PARALLEL_SIZE;
+            std::vector<Bins> partial(chunks);
+            builder.jobs->parallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+                for (size_t c = first; c < last; c++)
+                    binRange(builder, begin + c * PARALLEL_SIZE, std::min(begin + (c + 1) * PARALLEL_SIZE, end), centroids, scale, partial[c]);
+            });
+            bins = partial[0];
+            for (size_t c = 1; c < chunks; c++)
+                for (int a = 0; a < 3; a++)
+                    for (int b = 0; b < BINS; b++)
+                    {
+                        grow(bins.bins[a][b].bounds, partial[c].bins[a][b].bounds.min, partial[c].bins[a][b].bounds.max);
+                        bins.bins[a][b].count += partial[c].bins[a][b].count;
+                    }
+        }
+        else
+            binRange(builder, begin, end, centroids, scale, bins);
+
+        // the cheapest split: bins up to bestBin on bestAxis go left
+        double bestCost = INFINITY;
+        int bestAxis = -1, bestBin = 0;
+        for (int a = 0; a < 3; a++)
+        {
+            if (scale[a] == 0.0f)
+                continue;
+            double rightArea[BINS];
+            uint32_t rightCount[BINS];
+            Box box;
+            empty(box);
+            uint32_t total = 0;
+            for (int b = BINS - 1; b > 0; b--)
+            {
+                grow(box, bins.bins[a][b].bounds.min, bins.bins[a][b].bounds.max);
+                total += bins.bins[a][b].count;
+                rightArea[b] = area(box.min, box.max);
+                rightCount[b] = total;
+            }
+            empty(box);
+            total = 0;
+            for (int b = 0; b < BINS - 1; b++)
+            {
+                grow(box, bins.bins[a][b].bounds.min, bins.bins[a][b].bounds.max);
+                total += bins.bins[a][b].count;
+                if (!total || !rightCount[b + 1])
+                    continue;
+                double cost = area(box.min, box.max) * total + rightArea[b + 1] * rightCount[b + 1];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = a;
+                    bestBin = b;
+                }
+            }
+        }
+
+        if (bestAxis < 0)
+        {
+            makeLeaf(builder, index, begin, end, depth);
+            return;
+        }
+        Box childBounds[2], childCentroids[2];
+        for (int side = 0; side < 2; side++)
+        {
+            empty(childBounds[side]);
+            empty(childCentroids[side]);
+        }
+        for (int b = 0; b < BINS; b++)
+        {
+            const Bin &bin = bins.bins[bestAxis][b];
+            int side = b > bestBin;
+            grow(childBounds[side], bin.bounds.min, bin.bounds.max);
+        }
+        // partition through the scratch copy, left side from the front and right side from the
+        // back, without branching on the side
+        float origin = centroids.min[bestAxis], axisScale = scale[bestAxis];
+        Ref *refs = builder.refs->data(), *scratch = builder.scratch.data();
+        size_t split = begin, right = end;
+        float low[2][3], high[2][3];
+        for (int side = 0; side < 2; side++)
+            for (int a = 0; a < 3; a++)
+            {
+                low[side][a] = INFINITY;
+                high[side][a] = -INFINITY;
+            }
+        for (size_t i = begin; i < end; i++)
+        {
+            const Ref &ref = refs[i];
+            float c[3] = { ref.min[0] + ref.max[0], ref.min[1] + ref.max[1], ref.min[2] + ref.max[2] };
+            size_t side = binIndex(c[bestAxis], origin, axisScale) > bestBin;
+            scratch[side ? right - 1 : split] = ref;
+            split += 1 - side;
+            right -= side;
+            for (int a = 0; a < 3; a++)
+            {
+                low[side][a] = lesser(c[a], low[side][a]);
+                high[side][a] = greater(c[a], high[side][a]);
+            }
+        }
+        std::copy(scratch + begin, scratch + end, refs + begin);
+        for (int side = 0; side < 2; side++)
+            for (int a = 0; a < 3; a++)
+            {
+                childCentroids[side].min[a] = low[side][a];
+                childCentroids[side].max[a] = high[side][a];
+            }
+
+        uint32_t left = builder.nodeCount.fetch_add(2, std::memory_order_relaxed);
+        node.first = left;
+        node.count = 0;
+        tree.parents[left] = tree.parents[left + 1] = index;
+        if (parallel)
+        {
+            builder.jobs->parallelFor(0, 2, 1, [&](size_t first, size_t last) {
+                for (size_t side = first; side < last; side++)
+                    buildNode(builder, left + (uint32_t)side, side ? split : begin, side ? end : split, childBounds[side], childCentroids[side], depth + 1);
+            });
+            return;
+        }
+        buildNode(builder, left, begin, split, childBounds[0], childCentroids[0], depth + 1);
+        buildNode(builder, left + 1, split, end, childBounds[1], childCentroids[1], depth + 1);
+    }
+
+    Tree tree;
+    std::vector<uint8_t> leafDirty;     // per node
+    std::vector<uint32_t> dirtyLeaves;
+    JobSystem *jobs;
+
+    // background rebuild
+    Tree next;
+    std::vector<Ref> rebuildRefs;       // the boxes when it started
+    std::vector<uint8_t> movedFlags;    // per object, moved since the snapshot
+    std::vector<uint32_t> moved;
+    std::atomic<bool> rebuildReady{false};
+    std::thread rebuildThread;
+};
+#endif
@@ -0,0 +1,89 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <math/matrix.h>
+
+#include <algorithm>
+#include <cmath>
+
+// Perspective camera with GL conventions: right-handed world with +y up, column-major 4x4
+// matrices (element [column * 4 + row], as glUniformMatrix4fv takes them with transpose
+// GL_FALSE) and clip space z in [-w, w]. yaw 0 looks down -z, positive yaw turns to the right.
+struct Camera
+{
+    float position[3] = { 0.0f, 0.0f, 0.0f };
+    float yaw = 0.0f;           // radians
+    float pitch = 0.0f;         // radians, positive looks up
+    float fovY = 1.0f;          // radians
+    float aspect = 4.0f / 3.0f;
+    float nearPlane = 0.1f;
+    float farPlane = 1000.0f;
+
+    void forward(float out[3]) const
+    {
+        out[0] = std::sin(yaw) * std::cos(pitch);
+        out[1] = std::sin(pitch);
+        out[2] = -std::cos(yaw) * std::cos(pitch);
+    }
+
+    // the unit direction from position through the point at normalised device coordinates
+    // x, y, for picking
+    // ------------------------------------------------------------------------
+    void ray(float x, float y, float out[3]) const
+    {
+        float f[3];
+        forward(f);
+        float r[3] = { std::cos(yaw), 0.0f, std::sin(yaw) };
+        float u[3] = { r[1] * f[2] - r[2] * f[1], r[2] * f[0] - r[0] * f[2], r[0] * f[1] - r[1] * f[0] };
+        float h = std::tan(fovY * 0.5f);
+        for (int i = 0; i < 3; i++)
+            out[i] = f[i] + r[i] * x * h * aspect + u[i] * y * h;
+        float length = std::sqrt(out[0] * out[0] + out[1] * out[1] + out[2] * out[2]);
+        for (int i = 0; i < 3; i++)
+            out[i] /= length;
+    }
+
+    // world to eye: the basis (right, up, back) transposed, then the translation
+    // ------------------------------------------------------------------------
+    math::mat4 viewMatrix() const
+    {
+        float f[3];
+        forward(f);
+        math::vec3 front(f[0], f[1], f[2]), eye(position[0], position[1], position[2]);
+        math::vec3 r(std::cos(yaw), 0.0f, std::sin(yaw)); // forward x (0, 1, 0), normalised
+        math::vec3 u = math::cross(r, front);
+        // eye space looks down -z
+        return math::mat4(math::vec4(r.x, u.x, -front.x, 0.0f), math::vec4(r.y, u.y, -front.y, 0.0f), math::vec4(r.z, u.z, -front.z, 0.0f),
+                          math::vec4(-math::dot(r, eye), -math::dot(u, eye), math::dot(front, eye), 1.0f));
+    }
+    math::mat4 projectionMatrix() const
+    {
+        return math::perspective(fovY, aspect, nearPlane, farPlane);
+    }
+    math::mat4 viewProjectionMatrix() const
+    {
+        return projectionMatrix() * viewMatrix();
+    }
+
+    // the same as 16 floats, for uniforms and frame data
+    // ------------------------------------------------------------------------
+    void view(float out[16]) const
+    {
+        store(viewMatrix(), out);
+    }
+    void projection(float out[16]) const
+    {
+        store(projectionMatrix(), out);
+    }
+    void viewProjection(float out[16]) const
+    {
+        store(viewProjectionMatrix(), out);
+    }
+
+private:
+    static void store(const math::mat4 &m, float out[16])
+    {
+        std::copy(m.data(), m.data() + 16, out);
+    }
+};
+#endif
@@ -0,0 +1,104 @@
+#ifndef CITY_SCENE_H
+#define CITY_SCENE_H
+
+#include <scene/camera.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// A generated city for the culling benchmarks and the render loop: blocks x blocks city blocks,
+// each lots x lots box-shaped buildings, separated by streets, on the y = 0 ground and centred on
+// the origin. Buildings get taller towards the centre, so a street-level view is dense overdraw
+// where almost everything is hidden behind the first row of facades.
+struct CityScene
+{
+    static constexpr float LOT_SIZE = 20.0f;
+    static constexpr float STREET_WIDTH = 14.0f;
+    static constexpr float EYE_HEIGHT = 1.8f;
+
+    struct Building
+    {
+        float min[3];
+        float max[3];
+        float color[3];
+    };
+
+    std::vector<Building> buildings;
+    int blocks = 0;
+    int lots = 0;
+
+    float blockPitch() const
+    {
+        return lots * LOT_SIZE + STREET_WIDTH;
+    }
+    float extent() const
+    {
+        return blocks * blockPitch();
+    }
+
+    // ------------------------------------------------------------------------
+    void generate(int blockCount, int lotsPerBlock, unsigned seed = 1)
+    {
+        blocks = blockCount;
+        lots = lotsPerBlock;
+        buildings.clear();
+        buildings.reserve((size_t)blocks * blocks * lots * lots);
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        float half = extent() * 0.5f;
+        for (int bz = 0; bz < blocks; bz++)
+            for (int bx = 0; bx < blocks; bx++)
+            {
+                float blockX = -half + bx * blockPitch() + STREET_WIDTH * 0.5f;
+                float blockZ = -half + bz * blockPitch() + STREET_WIDTH * 0.5f;
+                float centre = std::sqrt((bx + 0.5f - blocks * 0.5f) * (bx + 0.5f - blocks * 0.5f) + (bz + 0.5f - blocks * 0.5f) * (bz + 0.5f - blocks * 0.5f));
+                float tallest = 25.0f + 120.0f * std::max(0.0f, 1.0f - centre / (blocks * 0.6f));
+                for (int lz = 0; lz < lots; lz++)
+                    for (int lx = 0; lx < lots; lx++)
+                    {
+                        Building b;
+                        float inset = 0.5f + 2.5f * unit(random);
+                        b.min[0] = blockX + lx * LOT_SIZE + inset;
+                        b.max[0] = blockX + (lx + 1) * LOT_SIZE - inset;
+                        b.min[2] = blockZ + lz * LOT_SIZE + inset;
+                        b.max[2] = blockZ + (lz + 1) * LOT_SIZE - inset;
+                        b.min[1] = 0.0f;
+                        b.max[1] = 8.0f + (tallest - 8.0f) * unit(random);
+                        float shade = 0.45f + 0.4f * unit(random);
+                        b.color[0] = shade;
+                        b.color[1] = shade * (0.9f + 0.1f * unit(random));
+                        b.color[2] = shade * (0.85f + 0.2f * unit(random));
+                        buildings.push_back(b);
+                    }
+            }
+    }
+
+    // a walk along the city's central east-west street and back along a north-south one,
+    // t in [0, 1) for one loop, looking ahead and swaying into the side streets
+    // ------------------------------------------------------------------------
+    void cameraPath(float t, Camera &camera) const
+    {
+        float half = extent() * 0.5f;
+        float street = -half + (blocks / 2) * blockPitch(); // centre line of the street south of the middle block row
+        float u = t - std::floor(t);
+        float along = (u < 0.5f ? u * 2.0f : u * 2.0f - 1.0f) * (extent() - STREET_WIDTH) - (half - STREET_WIDTH * 0.5f);
+        float sway = 0.5f * std::sin(u * 40.0f);
+        camera.position[1] = EYE_HEIGHT;
+        camera.pitch = 0.08f;
+        if (u < 0.5f)
+        {
+            camera.position[0] = along;             // eastwards, +x
+            camera.position[2] = street;
+            camera.yaw = 1.5707963f + sway;
+        }
+        else
+        {
+            camera.position[0] = street;            // southwards, +z
+            camera.position[2] = along;
+            camera.yaw = 3.1415927f + sway;
+        }
+    }
+};
+#endif
@@ -0,0 +1,259 @@
+#ifndef FRUSTUM_CULLER_H
+#define FRUSTUM_CULLER_H
+
+#include <core/job_system.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define FRUSTUM_CULLER_AVX2
+#include <immintrin.h>
+#endif
+
+// View-frustum culling of many objects. Bounding volumes are kept as structure of arrays (centre
+// x, y, z, extent x, y, z and radius each in their own array), so the AVX2 path tests 8 objects
+// against a plane with a handful of instructions and no gathers; the scalar loop does the same
+// arithmetic one object at a time and produces the same list.
+//
+//   BOXES    an axis-aligned box is outside when it is entirely behind one of the six planes:
+//            dot(n, centre) + d + dot(|n|, extent) < 0
+//   SPHERES  the same with the radius instead of the projected extent; cheaper, looser
+//
+// Both tests are conservative: a box that straddles two planes outside the frustum corner is
+// kept. With a JobSystem, chunks of CHUNK objects are culled in parallel and the lists joined.
+//
+//   FrustumCuller culler(&jobs);
+//   size_t id = culler.add(min, max);                            // or addSphere(); set() moves it
+//   size_t count = culler.cull(viewProjection, visible.data());  // visible holds size() indices
+class FrustumCuller
+{
+public:
+    static const size_t CHUNK = 16384;
+
+    enum Volume
+    {
+        BOXES,
+        SPHERES
+    };
+
+    FrustumCuller(JobSystem *jobSystem = nullptr) : jobs(jobSystem)
+    {
+#ifdef FRUSTUM_CULLER_AVX2
+        avx2 = __builtin_cpu_supports("avx2");
+#endif
+        simd = avx2;
+    }
+
+    void setSimd(bool enable)
+    {
+        simd = enable && avx2;
+    }
+    bool simdEnabled() const { return simd; }
+    bool simdSupported() const { return avx2; }
+
+    // objects: world-space boxes, or spheres (whose box is the cube around them); the returned
+    // index is what cull() lists
+    // ------------------------------------------------------------------------
+    size_t add(const float min[3], const float max[3])
+    {
+        for (int i = 0; i < 7; i++)
+            arrays[i].push_back(0.0f);
+        set(size() - 1, min, max);
+        return size() - 1;
+    }
+    size_t addSphere(const float centre[3], float radius)
+    {
+        for (int i = 0; i < 7; i++)
+            arrays[i].push_back(0.0f);
+        setSphere(size() - 1, centre, radius);
+        return size() - 1;
+    }
+    void set(size_t index, const float min[3], const float max[3])
+    {
+        float lengthSquared = 0.0f;
+        for (int i = 0; i < 3; i++)
+        {
+            arrays[CENTRE_X + i][index] = (min[i] + max[i]) * 0.5f;
+            arrays[EXTENT_X + i][index] = (max[i] - min[i]) * 0.5f;
+            lengthSquared += arrays[EXTENT_X + i][index] * arrays[EXTENT_X + i][index];
+        }
+        arrays[RADIUS][index] = std::sqrt(lengthSquared);
+    }
+    void setSphere(size_t index, const float centre[3], float radius)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            arrays[CENTRE_X + i][index] = centre[i];
+            arrays[EXTENT_X + i][index] = radius;
+        }
+        arrays[RADIUS][index] = radius;
+    }
+    void reserve(size_t count)
+    {
+        for (int i = 0; i < 7; i++)
+            arrays[i].reserve(count);
+    }
+    void clear()
+    {
+        for (int i = 0; i < 7; i++)
+            arrays[i].clear();
+    }
+    size_t size() const { return arrays[0].size(); }
+
+    // the six planes of viewProjection (column-major, see Camera), normal pointing inside and
+    // normalised: left, right, bottom, top, near, far, each (nx, ny, nz, d)
+    // ------------------------------------------------------------------------
+    static void extractPlanes(const float viewProjection[16], float planes[6][4])
+    {
+        for (int p = 0; p < 6; p++)
+        {
+            int row = p / 2;
+            float sign = (p & 1) ? -1.0f : 1.0f;
+            for (int c = 0; c < 4; c++)
+                planes[p][c] = viewProjection[c * 4 + 3] + sign * viewProjection[c * 4 + row];
+            float length = std::sqrt(planes[p][0] * planes[p][0] + planes[p][1] * planes[p][1] + planes[p][2] * planes[p][2]);
+            for (int c = 0; c < 4; c++)
+                planes[p][c] /= length;
+        }
+    }
+
+    // write the indices of the objects inside or crossing the frustum to visible (room for
+    // size() entries) in ascending order, and return how many there are
+    // ------------------------------------------------------------------------
+    size_t cull(const float viewProjection[16], uint32_t *visible, Volume volume = BOXES)
+    {
+        float planes[6][4];
+        extractPlanes(viewProjection, planes);
+        size_t count = size();
+        if (!jobs || count <= CHUNK)
+            return cullRange(planes, volume, 0, count, visible);
+        size_t chunks = (count + CHUNK - 1) / CHUNK;
+        chunkCounts.resize(chunks);
+        jobs->parallelFor(0, chunks, 1, [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; c++)
+                chunkCounts[c] = cullRange(planes, volume, c * CHUNK, std::min((c + 1) * CHUNK, count), visible + c * CHUNK);
+        });
+        size_t total = chunkCounts[0];
+        for (size_t c = 1; c < chunks; c++)
+        {
+            std::memmove(visible + total, visible + c * CHUNK, chunkCounts[c] * sizeof(uint32_t));
+            total += chunkCounts[c];
+        }
+        return total;
+    }
+
+private:
+    enum Array
+    {
+        CENTRE_X,
+        EXTENT_X = 3,
+        RADIUS = 6
+    };
+
+    size_t cullRange(const float planes[6][4], Volume volume, size_t begin, size_t end, uint32_t *visible) const
+    {
+#ifdef FRUSTUM_CULLER_AVX2
+        if (simd)
+        {
+            size_t count = cullAvx2(planes, volume, begin, end & ~(size_t)7, visible);
+            return count + cullScalar(planes, volume, std::max(begin, end & ~(size_t)7), end, visible + count);
+        }
+#endif
+        return cullScalar(planes, volume, begin, end, visible);
+    }
+
+    // mul and add in the same order as the AVX2 loop, so both keep the same objects
+    size_t cullScalar(const float planes[6][4], Volume volume, size_t begin, size_t end, uint32_t *visible) const
+    {
+        const float *cx = arrays[CENTRE_X].data(), *cy = arrays[CENTRE_X + 1].data(), *cz = arrays[CENTRE_X + 2].data();
+        const float *ex = arrays[EXTENT_X].data(), *ey = arrays[EXTENT_X + 1].data(), *ez = arrays[EXTENT_X + 2].data();
+        const float *radius = arrays[RADIUS].data();
+        size_t count = 0;
+        for (size_t i = begin; i < end; i++)
+        {
+            bool outside = false;
+            for (int p = 0; p < 6; p++)
+            {
+                const float *n = planes[p];
+                float d = n[0] * cx[i] + n[1] * cy[i] + n[2] * cz[i] + n[3];
+                if (volume == BOXES)
+                    d = d + (std::fabs(n[0]) * ex[i] + std::fabs(n[1]) * ey[i] + std::fabs(n[2]) * ez[i]);
+                else
+                    d = d + radius[i];
+                outside |= d < 0.0f;
+            }
+            visible[count] = (uint32_t)i;
+            count += !outside;
+        }
+        return count;
+    }
+#ifdef FRUSTUM_CULLER_AVX2
+    // 8 objects per step: an outside mask accumulated over the planes (left and right first, as
+    // most of what is culled is beside the view; done once all 8 are out), then the indices
+    // of the clear lanes appended
+    __attribute__((target("avx2")))
+    size_t cullAvx2(const float planes[6][4], Volume volume, size_t begin, size_t end, uint32_t *visible) const
+    {
+        const float *cx = arrays[CENTRE_X].data(), *cy = arrays[CENTRE_X + 1].data(), *cz = arrays[CENTRE_X + 2].data();
+        const float *ex = arrays[EXTENT_X].data(), *ey = arrays[EXTENT_X + 1].data(), *ez = arrays[EXTENT_X + 2].data();
+        const float *radius = arrays[RADIUS].data();
+        __m256 n[6][4], a[6][3];
+        for (int p = 0; p < 6; p++)
+            for (int c = 0; c < 4; c++)
+            {
+                n[p][c] = _mm256_set1_ps(planes[p][c]);
+                if (c < 3)
+                    a[p][c] = _mm256_set1_ps(std::fabs(planes[p][c]));
+            }
+        const __m256 zero = _mm256_setzero_ps();
+        size_t count = 0;
+        for (size_t i = begin; i < end; i += 8)
+        {
+            __m256 x = _mm256_loadu_ps(cx + i), y = _mm256_loadu_ps(cy + i), z = _mm256_loadu_ps(cz + i);
+            __m256 outside = zero;
+            if (volume == BOXES)
+            {
+                __m256 sx = _mm256_loadu_ps(ex + i), sy = _mm256_loadu_ps(ey + i), sz = _mm256_loadu_ps(ez + i);
+                for (int p = 0; p < 6; p++)
+                {
+                    __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(n[p][0], x), _mm256_mul_ps(n[p][1], y)), _mm256_mul_ps(n[p][2], z)), n[p][3]);
+                    __m256 e = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[p][0], sx), _mm256_mul_ps(a[p][1], sy)), _mm256_mul_ps(a[p][2], sz));
+                    outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(d, e), zero, _CMP_LT_OQ));
+                    if (p & 1 && _mm256_movemask_ps(outside) == 0xFF)
+                        break;
+                }
+            }
+            else
+            {
+                __m256 r = _mm256_loadu_ps(radius + i);
+                for (int p = 0; p < 6; p++)
+                {
+                    __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(n[p][0], x), _mm256_mul_ps(n[p][1], y)), _mm256_mul_ps(n[p][2], z)), n[p][3]);
+                    outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(d, r), zero, _CMP_LT_OQ));
+                    if (p & 1 && _mm256_movemask_ps(outside) == 0xFF)
+                        break;
+                }
+            }
+            unsigned inside = ~(unsigned)_mm256_movemask_ps(outside) & 0xFF;
+            while (inside)
+            {
+                visible[count++] = (uint32_t)(i + __builtin_ctz(inside));
+                inside &= inside - 1;
+            }
+        }
+        return count;
+    }
+#endif
+
+    std::vector<float> arrays[7];   // indexed by Array: centre x, y, z, extent x, y, z, radius
+    std::vector<size_t> chunkCounts;
+    JobSystem *jobs;
+    bool avx2 = false;
+    bool simd = false;
+};
+#endif
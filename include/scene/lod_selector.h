@@ -0,0 +1,171 @@
+#ifndef LOD_SELECTOR_H
+#define LOD_SELECTOR_H
+
+#include <math/bounds.h>
+#include <math/matrix.h>
+#include <mesh/mesh_format.h>
+#include <mesh/simplifier.h>
+#include <scene/camera.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Picks a level of a MeshLod chain for every instance of a mesh by screen-space error: the
+// level's error times the instance's scale, seen from the nearest point of the instance's
+// bounding sphere, in pixels. Each instance gets the coarsest level whose error is at most
+// thresholdPixels. Near a switch the levels cross-fade instead of popping: while the chosen
+// level's error is within the last fadeBand of the threshold, the instance is drawn at both
+// it and the finer level, with complementary screen-door masks. Instances outside the view
+// frustum are dropped.
+//
+// The result is a Selection, the instances grouped by level with the solid ones first, which
+// LodRenderer draws with one instanced call per group.
+//
+//   LodSelector selector(levels, mesh);
+//   selector.select(camera, viewportHeight, models.data(), models.size(), frame.selection);
+class LodSelector
+{
+public:
+    // fade t > 0 keeps the pixels whose mask threshold is below t, -t the rest, so a pair covers
+    // every pixel once; 1 is solid
+    struct Instance
+    {
+        math::mat4 model;
+        float fade;
+    };
+    // a level's instances: [first, first + solid) solid, then fading more with a mask
+    struct Range
+    {
+        uint32_t first;
+        uint32_t solid;
+        uint32_t fading;
+    };
+    struct Selection
+    {
+        std::vector<Instance> instances;
+        std::vector<Range> ranges;      // one per level
+        size_t triangles = 0;           // submitted: a fading instance counts at both its levels
+    };
+
+    float thresholdPixels = 1.0f;
+    float fadeBand = 0.25f;             // fraction of the threshold over which a level fades in
+
+    // the chain's levels and the mesh they index, for its bounding sphere
+    // ------------------------------------------------------------------------
+    LodSelector(const std::vector<MeshLod> &levels, const MeshData &mesh) : levels(levels)
+    {
+        uint32_t positionOffset = 0;
+        for (const MeshAttribute &attribute : mesh.attributes)
+            if (attribute.location == MESH_ATTRIBUTE_POSITION)
+                positionOffset = attribute.offset;
+        math::AABB box;
+        math::vec3 p;
+        for (uint32_t v = 0; v < mesh.vertexCount(); v++)
+        {
+            std::memcpy(&p.x, &mesh.vertices[(size_t)v * mesh.vertexStride + positionOffset], sizeof(p));
+            box.grow(p);
+        }
+        center = box.empty() ? math::vec3(0.0f) : box.center();
+        for (uint32_t v = 0; v < mesh.vertexCount(); v++)
+        {
+            std::memcpy(&p.x, &mesh.vertices[(size_t)v * mesh.vertexStride + positionOffset], sizeof(p));
+            radius = math::max(radius, math::length(p - center));
+        }
+    }
+
+    size_t levelCount() const { return levels.size(); }
+    const MeshLod& level(size_t l) const { return levels[l]; }
+
+    // select a level for each of count instances, placed by models (rotation, uniform scale and
+    // translation), for a viewport viewportHeight pixels high; returns the instances in view
+    // ------------------------------------------------------------------------
+    size_t select(const Camera &camera, float viewportHeight, const math::mat4 *models, size_t count, Selection &out)
+    {
+        float viewProjection[16];
+        camera.viewProjection(viewProjection);
+        math::plane planes[6];
+        math::frustumPlanes(math::mat4::fromArray(viewProjection), planes);
+        math::vec3 eye(camera.position[0], camera.position[1], camera.position[2]);
+        float pixelsPerUnit = viewportHeight / (2.0f * std::tan(camera.fovY * 0.5f)); // at distance 1
+        float fadeStart = thresholdPixels * (1.0f - fadeBand);
+
+        out.ranges.assign(levels.size(), Range{ 0, 0, 0 });
+        chosen.resize(count);
+        fades.resize(count);
+        size_t inView = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const math::mat4 &m = models[i];
+            chosen[i] = NOT_IN_VIEW;
+            math::vec3 c = math::transformPoint(m, center);
+            float scale = std::sqrt(math::max(math::dot(m[0].xyz(), m[0].xyz()), math::max(math::dot(m[1].xyz(), m[1].xyz()), math::dot(m[2].xyz(), m[2].xyz()))));
+            float r = radius * scale;
+            bool visible = true;
+            for (int p = 0; p < 6 && visible; p++)
+                visible = planes[p].distance(c) >= -r;
+            if (!visible)
+                continue;
+            inView++;
+            // pixels per unit of error at the sphere's nearest point
+            float distance = math::max(math::length(c - eye) - r, camera.nearPlane);
+            float pixels = scale * pixelsPerUnit / distance;
+            uint32_t l = 0;
+            while (l + 1 < levels.size() && levels[l + 1].error * pixels <= thresholdPixels)
+                l++;
+            float error = levels[l].error * pixels;
+            chosen[i] = l;
+            fades[i] = 1.0f;
+            if (l > 0 && error > fadeStart)
+            {
+                fades[i] = (thresholdPixels - error) / (thresholdPixels - fadeStart); // 0 at the switch, 1 once past the band
+                out.ranges[l].fading++;
+                out.ranges[l - 1].fading++;
+            }
+            else
+                out.ranges[l].solid++;
+        }
+
+        uint32_t first = 0;
+        out.triangles = 0;
+        for (size_t l = 0; l < levels.size(); l++)
+        {
+            Range &range = out.ranges[l];
+            range.first = first;
+            first += range.solid + range.fading;
+            out.triangles += (size_t)(range.solid + range.fading) * (levels[l].indexCount / 3);
+        }
+        out.instances.resize(first);
+        cursors.resize(levels.size() * 2);
+        for (size_t l = 0; l < levels.size(); l++)
+        {
+            cursors[l * 2] = out.ranges[l].first;
+            cursors[l * 2 + 1] = out.ranges[l].first + out.ranges[l].solid;
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t l = chosen[i];
+            if (l == NOT_IN_VIEW)
+                continue;
+            if (fades[i] == 1.0f)
+            {
+                out.instances[cursors[l * 2]++] = Instance{ models[i], 1.0f };
+                continue;
+            }
+            out.instances[cursors[l * 2 + 1]++] = Instance{ models[i], fades[i] };
+            out.instances[cursors[(l - 1) * 2 + 1]++] = Instance{ models[i], -fades[i] };
+        }
+        return inView;
+    }
+
+private:
+    static const uint32_t NOT_IN_VIEW = ~0u;
+
+    std::vector<MeshLod> levels;
+    math::vec3 center;
+    float radius = 0.0f;
+    std::vector<uint32_t> chosen, cursors;  // scratch, kept between selects
+    std::vector<float> fades;
+};
+#endif
@@ -0,0 +1,486 @@
+#ifndef OCCLUSION_CULLER_H
+#define OCCLUSION_CULLER_H
+
+#include <core/job_system.h>
+#include <math/matrix.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define OCCLUSION_CULLER_AVX2
+#include <immintrin.h>
+#endif
+
+// Hierarchical-Z occlusion culling on the CPU. Occluder triangles (world space, added once) are
+// rasterised every frame into a small depth buffer, and a min/max depth pyramid is built over it;
+// objects are then tested by bounding box against the pyramid level where their screen
+// rectangle covers at most 4x4 texels, refining a level or two where that is inconclusive.
+//
+//   setup   chunks of SETUP_CHUNK triangles are transformed, clipped at the near plane,
+//           back-face culled (occluders are counter-clockwise, as GL's default front face) and
+//           turned into edge functions and a depth plane, in parallel
+//   raster  every BAND_HEIGHT rows of the depth buffer are a job that draws the triangles
+//           overlapping them, 8 pixels at a time with AVX2 (chosen at run time; setSimd(false)
+//           runs the scalar loop, which writes identical depths)
+//   pyramid each level holds the nearest and the farthest depth of 2x2 texels of the one below
+//
+// The test is conservative with respect to that depth buffer: occluders are written with the
+// depth of the far corner of each pixel, a box is tested with its nearest corner, boxes that
+// cross the near plane are visible, and the rectangle a box is tested over is widened by a
+// pixel. Coverage is sampled at pixel centres like GL's, so at the low resolution an occluder
+// can overhang its edge by up to half a pixel; the widening keeps that from hiding objects seen
+// just past it. Depths are GL window depths, [0, 1] with 1 far.
+//
+//   OcclusionCuller culler(jobs, 256, 192);
+//   culler.addOccluderBox(min, max);                                     // once per occluder
+//   culler.render(viewProjection);                                       // every frame
+//   culler.testBoxes(&box.min[0], &box.max[0], sizeof(box), count, visible);
+//
+// Render and test from the JobSystem's creating thread.
+class OcclusionCuller
+{
+public:
+    static const int BAND_HEIGHT = 8;
+    static const int SETUP_CHUNK = 2048;
+    static const int TEST_CHUNK = 1024;
+    static const int MAX_LEVELS = 16;
+
+    enum Result
+    {
+        VISIBLE,
+        OUTSIDE,    // outside the view frustum
+        OCCLUDED
+    };
+
+    struct Stats
+    {
+        unsigned long long occluderTriangles = 0;  // submitted, over all renders
+        unsigned long long rasterized = 0;         // after clipping and culling
+        unsigned long long tested = 0;
+        unsigned long long outside = 0;
+        unsigned long long occluded = 0;
+    };
+
+    OcclusionCuller(JobSystem &jobSystem, int width, int height) : jobs(jobSystem)
+    {
+#ifdef OCCLUSION_CULLER_AVX2
+        avx2 = __builtin_cpu_supports("avx2");
+#endif
+        simd = avx2;
+        resize(width, height);
+    }
+
+    // depth buffer size; the pyramid goes down to 1x1
+    // ------------------------------------------------------------------------
+    void resize(int width, int height)
+    {
+        depthWidth = std::max(width, 1);
+        depthHeight = std::max(height, 1);
+        stride = (depthWidth + 7) & ~7;
+        depthBuffer.assign((size_t)stride * depthHeight, 1.0f);
+        levelCount = 0;
+        size_t offset = 0;
+        for (int w = depthWidth, h = depthHeight; levelCount < MAX_LEVELS; w = (w + 1) / 2, h = (h + 1) / 2)
+        {
+            levels[levelCount++] = { w, h, offset };
+            offset += (size_t)w * h;
+            if (w == 1 && h == 1)
+                break;
+        }
+        nearest.assign(offset, 1.0f);
+        farthest.assign(offset, 1.0f);
+    }
+    int width() const { return depthWidth; }
+    int height() const { return depthHeight; }
+
+    void setSimd(bool enable)
+    {
+        simd = enable && avx2;
+    }
+    bool simdEnabled() const { return simd; }
+    bool simdSupported() const { return avx2; }
+
+    // occluders: world-space triangles, counter-clockwise seen from outside
+    // ------------------------------------------------------------------------
+    void addOccluder(const float *positions, size_t stride, const uint32_t *indices, size_t indexCount)
+    {
+        const unsigned char *base = (const unsigned char*)positions;
+        for (size_t i = 0; i + 2 < indexCount; i += 3)
+            for (int v = 0; v < 3; v++)
+            {
+                const float *p = (const float*)(base + indices[i + v] * (stride ? stride : 3 * sizeof(float)));
+                triangles.insert(triangles.end(), p, p + 3);
+            }
+    }
+    void addOccluderBox(const float min[3], const float max[3])
+    {
+        // corner c has x, y and z from max where bits 0, 1 and 2 of c are set
+        static const uint32_t faces[36] = {
+            0, 2, 3, 0, 3, 1,   4, 5, 7, 4, 7, 6,   // -z, +z
+            0, 4, 6, 0, 6, 2,   1, 3, 7, 1, 7, 5,   // -x, +x
+            0, 1, 5, 0, 5, 4,   2, 6, 7, 2, 7, 3    // -y, +y
+        };
+        float corners[8][3];
+        for (int c = 0; c < 8; c++)
+            for (int i = 0; i < 3; i++)
+                corners[c][i] = (c >> i & 1) ? max[i] : min[i];
+        addOccluder(&corners[0][0], 0, faces, 36);
+    }
+    void clearOccluders()
+    {
+        triangles.clear();
+    }
+    size_t occluderTriangles() const
+    {
+        return triangles.size() / 9;
+    }
+
+    // rasterise the occluders seen through viewProjection (column-major, see Camera) and build
+    // the pyramid the tests use
+    // ------------------------------------------------------------------------
+    void render(const float viewProjection[16])
+    {
+        matrix = math::mat4::fromArray(viewProjection);
+        size_t count = occluderTriangles();
+        size_t chunkCount = (count + SETUP_CHUNK - 1) / SETUP_CHUNK;
+        if (chunks.size() < chunkCount)
+            chunks.resize(chunkCount);
+        std::atomic<unsigned long long> rasterized(0);
+        jobs.parallelFor(0, chunkCount, 1, [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; c++)
+                rasterized += setupChunk(c, std::min(count, (c + 1) * SETUP_CHUNK));
+        });
+        activeChunks = chunkCount;
+        std::fill(depthBuffer.begin(), depthBuffer.end(), 1.0f);
+        jobs.parallelFor(0, (depthHeight + BAND_HEIGHT - 1) / BAND_HEIGHT, 1, [&](size_t begin, size_t end) {
+            for (size_t band = begin; band < end; band++)
+                rasterizeBand((int)band);
+        });
+        buildPyramid();
+        counters.occluderTriangles += count;
+        counters.rasterized += rasterized;
+    }
+
+    // a world-space axis-aligned box against the last render
+    // ------------------------------------------------------------------------
+    Result test(const float min[3], const float max[3]) const
+    {
+        math::vec4 clip[8];
+        unsigned outsideAll = 0x3F, nearCrossing = 0;
+        for (int c = 0; c < 8; c++)
+        {
+            math::vec4 corner((c & 1) ? max[0] : min[0], (c & 2) ? max[1] : min[1], (c & 4) ? max[2] : min[2], 1.0f);
+            clip[c] = matrix * corner;
+            const float *p = &clip[c].x;
+            unsigned outcode = (p[0] < -p[3]) | (p[0] > p[3]) << 1 | (p[1] < -p[3]) << 2 | (p[1] > p[3]) << 3 | (p[2] < -p[3]) << 4 | (p[2] > p[3]) << 5;
+            outsideAll &= outcode;
+            nearCrossing |= outcode & 0x10;
+        }
+        if (outsideAll) // all corners outside one frustum plane
+            return OUTSIDE;
+        if (nearCrossing) // partly in front of the near plane, may surround the eye
+            return VISIBLE;
+        float x0 = 1e30f, y0 = 1e30f, x1 = -1e30f, y1 = -1e30f, z = 1e30f;
+        for (int c = 0; c < 8; c++)
+        {
+            float invW = 1.0f / clip[c][3];
+            float x = (clip[c][0] * invW * 0.5f + 0.5f) * depthWidth;
+            float y = (clip[c][1] * invW * 0.5f + 0.5f) * depthHeight;
+            x0 = std::min(x0, x);
+            x1 = std::max(x1, x);
+            y0 = std::min(y0, y);
+            y1 = std::max(y1, y);
+            z = std::min(z, clip[c][2] * invW * 0.5f + 0.5f);
+        }
+        int rect[4] = {
+            std::max((int)std::floor(std::max(x0, 0.0f)) - 1, 0),
+            std::max((int)std::floor(std::max(y0, 0.0f)) - 1, 0),
+            std::min((int)std::floor(std::min(x1, (float)depthWidth)) + 1, depthWidth - 1),
+            std::min((int)std::floor(std::min(y1, (float)depthHeight)) + 1, depthHeight - 1)
+        };
+        int level = 0;
+        while (level + 1 < levelCount && ((rect[2] >> level) - (rect[0] >> level) >= 4 || (rect[3] >> level) - (rect[1] >> level) >= 4))
+            level++;
+        // refine while the region has occluders both in front of and behind the box
+        for (int finest = std::max(level - 2, 0); ; level--)
+        {
+            const Level &l = levels[level];
+            float regionNearest = 1.0f, regionFarthest = 0.0f;
+            for (int y = rect[1] >> level; y <= rect[3] >> level; y++)
+                for (int x = rect[0] >> level; x <= rect[2] >> level; x++)
+                {
+                    size_t index = l.offset + (size_t)y * l.width + x;
+                    regionNearest = std::min(regionNearest, nearest[index]);
+                    regionFarthest = std::max(regionFarthest, farthest[index]);
+                }
+            if (z > regionFarthest)
+                return OCCLUDED;
+            if (z <= regionNearest || level == finest)
+                return VISIBLE;
+        }
+    }
+
+    // visible[i] = 1 if box i (min and max 3 floats each, boxes stride bytes apart) may be
+    // visible, 0 if it is off screen or occluded; in parallel
+    // ------------------------------------------------------------------------
+    void testBoxes(const float *min, const float *max, size_t stride, size_t count, uint8_t *visible)
+    {
+        testBoxes(min, max, stride, nullptr, count, visible);
+    }
+    // the same for the boxes list names (indices, e.g. what a FrustumCuller kept), visible[i]
+    // for list[i]; a nullptr list is boxes 0 to count - 1
+    void testBoxes(const float *min, const float *max, size_t stride, const uint32_t *list, size_t count, uint8_t *visible)
+    {
+        std::atomic<unsigned long long> outside(0), occluded(0);
+        jobs.parallelFor(0, count, TEST_CHUNK, [&](size_t begin, size_t end) {
+            unsigned long long out = 0, hidden = 0;
+            for (size_t i = begin; i < end; i++)
+            {
+                size_t box = list ? list[i] : i;
+                Result result = test((const float*)((const unsigned char*)min + box * stride), (const float*)((const unsigned char*)max + box * stride));
+                visible[i] = result == VISIBLE;
+                out += result == OUTSIDE;
+                hidden += result == OCCLUDED;
+            }
+            outside += out;
+            occluded += hidden;
+        });
+        counters.tested += count;
+        counters.outside += outside;
+        counters.occluded += occluded;
+    }
+
+    // the rasterised depth buffer, rows bottom up, rowStride() floats apart
+    // ------------------------------------------------------------------------
+    const float *depth() const { return depthBuffer.data(); }
+    int rowStride() const { return stride; }
+
+    const Stats &stats() const { return counters; }
+    void resetStats()
+    {
+        counters = Stats();
+    }
+
+private:
+    // edge i at pixel centre (px, py) is edge[i][0] * px + (edge[i][1] * py + edge[i][2]), >= 0
+    // inside; depth is zPlane[0] * px + (zPlane[1] * py + zPlane[2]), at the pixel's far corner
+    struct SetupTriangle
+    {
+        int box[4];         // pixel x0, y0, x1, y1 whose centres the triangle's bounds contain
+        float edge[3][3];
+        float zPlane[3];
+    };
+    struct Chunk
+    {
+        std::vector<SetupTriangle> triangles;
+    };
+    struct Level
+    {
+        int width;
+        int height;
+        size_t offset;
+    };
+
+    // setup phase
+    // ------------------------------------------------------------------------
+    size_t setupChunk(size_t c, size_t end)
+    {
+        Chunk &chunk = chunks[c];
+        chunk.triangles.clear();
+        chunk.triangles.reserve(2 * SETUP_CHUNK);
+        for (size_t t = c * SETUP_CHUNK; t < end; t++)
+        {
+            math::vec4 clip[3];
+            for (int v = 0; v < 3; v++)
+            {
+                const float *p = &triangles[t * 9 + v * 3];
+                clip[v] = matrix * math::vec4(p[0], p[1], p[2], 1.0f);
+            }
+            // Sutherland-Hodgman against the near plane, z >= -w: a triangle or a quad
+            float polygon[4][4];
+            int count = 0;
+            for (int v = 0; v < 3; v++)
+            {
+                const float *a = &clip[v].x, *b = &clip[(v + 1) % 3].x;
+                float da = a[2] + a[3], db = b[2] + b[3];
+                if (da >= 0.0f)
+                    std::copy(a, a + 4, polygon[count++]);
+                if ((da >= 0.0f) != (db >= 0.0f))
+                {
+                    float t = da / (da - db);
+                    for (int i = 0; i < 4; i++)
+                        polygon[count][i] = a[i] + (b[i] - a[i]) * t;
+                    count++;
+                }
+            }
+            for (int v = 2; v < count; v++)
+                setupTriangle(polygon[0], polygon[v - 1], polygon[v], chunk);
+        }
+        return chunk.triangles.size();
+    }
+
+    void setupTriangle(const float *a, const float *b, const float *c, Chunk &chunk) const
+    {
+        const float *clip[3] = { a, b, c };
+        float x[3], y[3], z[3];
+        for (int v = 0; v < 3; v++)
+        {
+            float invW = 1.0f / clip[v][3];
+            x[v] = (clip[v][0] * invW * 0.5f + 0.5f) * depthWidth;
+            y[v] = (clip[v][1] * invW * 0.5f + 0.5f) * depthHeight;
+            z[v] = clip[v][2] * invW * 0.5f + 0.5f;
+        }
+        float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+        if (!(area > 0.0f)) // back-facing or degenerate
+            return;
+        SetupTriangle t;
+        t.box[0] = std::max((int)std::ceil(std::min({ x[0], x[1], x[2] }) - 0.5f), 0);
+        t.box[1] = std::max((int)std::ceil(std::min({ y[0], y[1], y[2] }) - 0.5f), 0);
+        t.box[2] = std::min((int)std::floor(std::max({ x[0], x[1], x[2] }) - 0.5f), depthWidth - 1);
+        t.box[3] = std::min((int)std::floor(std::max({ y[0], y[1], y[2] }) - 0.5f), depthHeight - 1);
+        if (t.box[0] > t.box[2] || t.box[1] > t.box[3])
+            return;
+        for (int i = 0; i < 3; i++)
+        {
+            int j = (i + 1) % 3;
+            t.edge[i][0] = -(y[j] - y[i]);
+            t.edge[i][1] = x[j] - x[i];
+            t.edge[i][2] = -(t.edge[i][0] * x[i] + t.edge[i][1] * y[i]);
+        }
+        float dzdx = ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) / area;
+        float dzdy = ((x[1] - x[0]) * (z[2] - z[0]) - (x[2] - x[0]) * (z[1] - z[0])) / area;
+        t.zPlane[0] = dzdx;
+        t.zPlane[1] = dzdy;
+        t.zPlane[2] = z[0] - dzdx * x[0] - dzdy * y[0] + 0.5f * (std::fabs(dzdx) + std::fabs(dzdy));
+        chunk.triangles.push_back(t);
+    }
+
+    // raster phase
+    // ------------------------------------------------------------------------
+    void rasterizeBand(int band)
+    {
+        int rows[2] = { band * BAND_HEIGHT, std::min((band + 1) * BAND_HEIGHT, depthHeight) - 1 };
+        for (size_t c = 0; c < activeChunks; c++)
+            for (const SetupTriangle &t : chunks[c].triangles)
+            {
+                if (t.box[3] < rows[0] || t.box[1] > rows[1])
+                    continue;
+                int y0 = std::max(t.box[1], rows[0]), y1 = std::min(t.box[3], rows[1]);
+#ifdef OCCLUSION_CULLER_AVX2
+                if (simd)
+                {
+                    rasterizeAvx2(t, y0, y1);
+                    continue;
+                }
+#endif
+                rasterizeScalar(t, y0, y1);
+            }
+    }
+
+    // rows y0 to y1, in runs of 8 pixels from box[0] rounded down to a multiple of 8 (the depth
+    // buffer rows are padded to one); lanes past box[2] are outside an edge or in the padding
+    void rasterizeScalar(const SetupTriangle &t, int y0, int y1)
+    {
+        for (int y = y0; y <= y1; y++)
+        {
+            float py = (float)y + 0.5f;
+            float row[3], zRow = t.zPlane[1] * py + t.zPlane[2];
+            for (int i = 0; i < 3; i++)
+                row[i] = t.edge[i][1] * py + t.edge[i][2];
+            float *line = &depthBuffer[(size_t)y * stride];
+            for (int run = t.box[0] & ~7; run <= t.box[2]; run += 8)
+                for (int x = run; x < run + 8; x++)
+                {
+                    float px = (float)run + ((float)(x - run) + 0.5f);
+                    if (t.edge[0][0] * px + row[0] >= 0.0f && t.edge[1][0] * px + row[1] >= 0.0f && t.edge[2][0] * px + row[2] >= 0.0f)
+                    {
+                        float z = t.zPlane[0] * px + zRow;
+                        line[x] = line[x] < z ? line[x] : z;
+                    }
+                }
+        }
+    }
+#ifdef OCCLUSION_CULLER_AVX2
+    // rasterizeScalar with a run of 8 pixels per step; mul and add rather than FMA keep the
+    // depths identical to it
+    __attribute__((target("avx2")))
+    void rasterizeAvx2(const SetupTriangle &t, int y0, int y1)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 centres = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+        __m256 a[3], zA = _mm256_set1_ps(t.zPlane[0]);
+        for (int i = 0; i < 3; i++)
+            a[i] = _mm256_set1_ps(t.edge[i][0]);
+        for (int y = y0; y <= y1; y++)
+        {
+            float py = (float)y + 0.5f;
+            __m256 row[3], zRow = _mm256_set1_ps(t.zPlane[1] * py + t.zPlane[2]);
+            for (int i = 0; i < 3; i++)
+                row[i] = _mm256_set1_ps(t.edge[i][1] * py + t.edge[i][2]);
+            float *line = &depthBuffer[(size_t)y * stride];
+            for (int x = t.box[0] & ~7; x <= t.box[2]; x += 8)
+            {
+                __m256 px = _mm256_add_ps(_mm256_set1_ps((float)x), centres);
+                __m256 inside = _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(a[0], px), row[0]), zero, _CMP_GE_OQ);
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(a[1], px), row[1]), zero, _CMP_GE_OQ));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(a[2], px), row[2]), zero, _CMP_GE_OQ));
+                if (_mm256_testz_ps(inside, inside))
+                    continue;
+                __m256 z = _mm256_add_ps(_mm256_mul_ps(zA, px), zRow);
+                __m256 d = _mm256_loadu_ps(line + x);
+                _mm256_storeu_ps(line + x, _mm256_blendv_ps(d, _mm256_min_ps(d, z), inside));
+            }
+        }
+    }
+#endif
+
+    // pyramid
+    // ------------------------------------------------------------------------
+    void buildPyramid()
+    {
+        for (int y = 0; y < depthHeight; y++)
+        {
+            std::copy(&depthBuffer[(size_t)y * stride], &depthBuffer[(size_t)y * stride] + depthWidth, &nearest[(size_t)y * depthWidth]);
+            std::copy(&depthBuffer[(size_t)y * stride], &depthBuffer[(size_t)y * stride] + depthWidth, &farthest[(size_t)y * depthWidth]);
+        }
+        for (int level = 1; level < levelCount; level++)
+        {
+            const Level &below = levels[level - 1], &l = levels[level];
+            for (int y = 0; y < l.height; y++)
+            {
+                size_t rowA = below.offset + (size_t)(2 * y) * below.width;
+                size_t rowB = below.offset + (size_t)std::min(2 * y + 1, below.height - 1) * below.width;
+                for (int x = 0; x < l.width; x++)
+                {
+                    int xa = 2 * x, xb = std::min(2 * x + 1, below.width - 1);
+                    size_t index = l.offset + (size_t)y * l.width + x;
+                    nearest[index] = std::min(std::min(nearest[rowA + xa], nearest[rowA + xb]), std::min(nearest[rowB + xa], nearest[rowB + xb]));
+                    farthest[index] = std::max(std::max(farthest[rowA + xa], farthest[rowA + xb]), std::max(farthest[rowB + xa], farthest[rowB + xb]));
+                }
+            }
+        }
+    }
+
+    JobSystem &jobs;
+    bool avx2 = false;
+    bool simd = false;
+    int depthWidth = 0;
+    int depthHeight = 0;
+    int stride = 0;
+    math::mat4 matrix;
+    std::vector<float> triangles;   // 3 vertices x 3 floats each
+    std::vector<Chunk> chunks;
+    size_t activeChunks = 0;
+    std::vector<float> depthBuffer;
+    Level levels[MAX_LEVELS];
+    int levelCount = 0;
+    std::vector<float> nearest;     // all levels, level 0 first
+    std::vector<float> farthest;
+    Stats counters;
+};
+#endif
@@ -0,0 +1,314 @@
+#ifndef SCENE_GRAPH_H
+#define SCENE_GRAPH_H
+
+#include <core/job_system.h>
+#include <math/batch.h>
+#include <math/matrix.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Transform hierarchy stored as arrays rather than linked nodes. Each node has a local matrix
+// (relative to its parent) and a world matrix (parent world * local), both math::mat4, the
+// products math's batch kernels (AVX2 when the CPU has it); the nodes are laid out so that one front to back pass computes every world matrix
+// from an already computed parent:
+//
+//   top      the nodes whose subtree is larger than ISLAND_SIZE, in depth order; few, updated
+//            first on the calling thread
+//   islands  every other subtree hanging off the top (or a root with a small tree), contiguous
+//            and in depth order within itself, so islands are independent and are updated in
+//            parallel on the JobSystem
+//
+// setLocal() marks a node dirty and update() recomputes the dirty nodes and everything below
+// them; islands without a dirty node (or dirty parent) are skipped without being read. Creating
+// nodes puts them at the end; the next update() lays the arrays out again (and node slots move).
+//
+// worlds() is the instance buffer image: a mat4 per node in slot order. update(instances) also
+// writes every world matrix to instances in the same pass, parents being read from the scene
+// graph's own copy, so that may be a write-only mapping or the frame's upload buffer.
+//
+//   SceneGraph graph(&jobs);
+//   uint32_t car = graph.create(SceneGraph::NONE, carMatrix);
+//   uint32_t wheel = graph.create(car, math::translate(axle) * math::rotate(math::vec3(1.0f, 0.0f, 0.0f), turn));
+//   graph.setLocal(wheel, turned);
+//   graph.update(instances);  // instances[graph.slot(wheel)] is its world matrix
+//
+// Create, set and update from the JobSystem's creating thread.
+class SceneGraph
+{
+public:
+    static constexpr uint32_t NONE = ~0u;
+    static const size_t ISLAND_SIZE = 1024;
+
+    SceneGraph(JobSystem *jobSystem = nullptr) : jobs(jobSystem)
+    {
+        avx2 = math::batchSupported(math::BATCH_AVX2);
+        simd = avx2;
+    }
+
+    void setSimd(bool enable)
+    {
+        simd = enable && avx2;
+    }
+    bool simdEnabled() const { return simd; }
+    bool simdSupported() const { return avx2; }
+
+    // a node under parent (NONE for a root) with the given local matrix; returns its id, which
+    // stays the node's while slots move
+    // ------------------------------------------------------------------------
+    uint32_t create(uint32_t parent = NONE, const math::mat4 &local = math::mat4())
+    {
+        uint32_t node = (uint32_t)parentIds.size();
+        parentIds.push_back(parent);
+        slots.push_back(node);
+        ids.push_back(node);
+        parentSlots.push_back(parent == NONE ? NONE : slots[parent]);
+        localMatrices.push_back(local);
+        worldMatrices.emplace_back();
+        dirty.push_back(1);
+        layoutChanged = true;
+        return node;
+    }
+    void reserve(size_t count)
+    {
+        parentIds.reserve(count);
+        slots.reserve(count);
+        ids.reserve(count);
+        parentSlots.reserve(count);
+        localMatrices.reserve(count);
+        worldMatrices.reserve(count);
+        dirty.reserve(count);
+    }
+
+    // ------------------------------------------------------------------------
+    void setLocal(uint32_t node, const math::mat4 &local)
+    {
+        uint32_t s = slots[node];
+        localMatrices[s] = local;
+        dirty[s] = 1;
+        if (!layoutChanged && s >= topEnd)
+            islandDirty[islandOf[s - topEnd]] = 1;
+    }
+    const math::mat4 &local(uint32_t node) const { return localMatrices[slots[node]]; }
+    // as of the last update()
+    const math::mat4 &world(uint32_t node) const { return worldMatrices[slots[node]]; }
+    uint32_t parent(uint32_t node) const { return parentIds[node]; }
+
+    size_t size() const { return parentIds.size(); }
+    // position of a node in worlds() and the instances update() writes, and the node at a slot
+    uint32_t slot(uint32_t node) const { return slots[node]; }
+    uint32_t node(uint32_t slot) const { return ids[slot]; }
+    const math::mat4 *worlds() const { return worldMatrices.data(); }
+    size_t topSize() const { return topEnd; }
+    size_t islandCount() const { return islands.size(); }
+
+    // recompute the world matrices of dirty nodes and their descendants (and write all of them
+    // to instances, one per slot, when given); returns how many were recomputed
+    // ------------------------------------------------------------------------
+    size_t update(math::mat4 *instances = nullptr)
+    {
+        if (layoutChanged)
+            layout();
+        size_t updated = updateRange(0, (uint32_t)topEnd, instances);
+        if (!jobs || islands.size() < 2)
+            updated += updateIslands(0, islands.size(), instances);
+        else
+        {
+            std::atomic<size_t> total(0);
+            size_t grain = std::max<size_t>(1, islands.size() / (jobs->threadCount() * 8));
+            jobs->parallelFor(0, islands.size(), grain, [&](size_t begin, size_t end) {
+                total.fetch_add(updateIslands(begin, end, instances), std::memory_order_relaxed);
+            });
+            updated += total.load(std::memory_order_relaxed);
+        }
+        std::memset(dirty.data(), 0, topEnd); // the islands cleared their own
+        return updated;
+    }
+
+private:
+    struct Island
+    {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    // slots: the top in breadth-first order from the roots, then each island breadth first;
+    // the matrices and flags move with their nodes
+    void layout()
+    {
+        size_t count = parentIds.size();
+        std::vector<uint32_t> childStart(count + 1, 0), children(count);
+        for (uint32_t p : parentIds)
+            if (p != NONE)
+                childStart[p + 1]++;
+        for (size_t i = 0; i < count; i++)
+            childStart[i + 1] += childStart[i];
+        std::vector<uint32_t> fill(childStart.begin(), childStart.end() - 1), order;
+        order.reserve(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (parentIds[i] == NONE)
+                order.push_back(i);
+            else
+                children[fill[parentIds[i]]++] = i;
+        }
+        for (size_t i = 0; i < order.size(); i++) // breadth first over everything: every parent before its children
+            order.insert(order.end(), children.begin() + childStart[order[i]], children.begin() + childStart[order[i] + 1]);
+        std::vector<uint32_t> subtree(count, 1);
+        for (size_t i = count; i-- > 0;)
+            if (parentIds[order[i]] != NONE)
+                subtree[parentIds[order[i]]] += subtree[order[i]];
+
+        std::vector<uint32_t> newIds, roots;
+        newIds.reserve(count);
+        for (uint32_t node : order)
+        {
+            uint32_t p = parentIds[node];
+            bool topParent = p == NONE || subtree[p] > ISLAND_SIZE;
+            if (topParent && subtree[node] > ISLAND_SIZE)
+                newIds.push_back(node);
+            else if (topParent)
+                roots.push_back(node);
+        }
+        topEnd = newIds.size();
+        islands.clear();
+        islandOf.clear();
+        for (uint32_t root : roots)
+        {
+            Island island = { (uint32_t)newIds.size(), 0 };
+            newIds.push_back(root);
+            for (size_t i = island.begin; i < newIds.size(); i++)
+                newIds.insert(newIds.end(), children.begin() + childStart[newIds[i]], children.begin() + childStart[newIds[i] + 1]);
+            island.end = (uint32_t)newIds.size();
+            islandOf.insert(islandOf.end(), island.end - island.begin, (uint32_t)islands.size());
+            islands.push_back(island);
+        }
+
+        std::vector<math::mat4> newLocal(count), newWorld(count);
+        std::vector<uint8_t> newDirty(count);
+        for (size_t s = 0; s < count; s++)
+        {
+            uint32_t old = slots[newIds[s]];
+            newLocal[s] = localMatrices[old];
+            newWorld[s] = worldMatrices[old];
+            newDirty[s] = dirty[old];
+        }
+        for (size_t s = 0; s < count; s++)
+            slots[newIds[s]] = (uint32_t)s;
+        for (size_t s = 0; s < count; s++)
+            parentSlots[s] = parentIds[newIds[s]] == NONE ? NONE : slots[parentIds[newIds[s]]];
+        localMatrices.swap(newLocal);
+        worldMatrices.swap(newWorld);
+        dirty.swap(newDirty);
+        ids.swap(newIds);
+        islandDirty.assign(islands.size(), 0);
+        for (size_t s = topEnd; s < count; s++)
+            islandDirty[islandOf[s - topEnd]] |= dirty[s];
+        layoutChanged = false;
+    }
+
+    size_t updateIslands(size_t begin, size_t end, math::mat4 *instances)
+    {
+        size_t updated = 0;
+        for (size_t i = begin; i < end; i++)
+        {
+            const Island &island = islands[i];
+            uint32_t above = parentSlots[island.begin];
+            if (islandDirty[i] || (above != NONE && dirty[above]))
+            {
+                updated += updateRange(island.begin, island.end, instances);
+                std::memset(&dirty[island.begin], 0, island.end - island.begin);
+                islandDirty[i] = 0;
+            }
+            else if (instances)
+                std::copy(worldMatrices.begin() + island.begin, worldMatrices.begin() + island.end, instances + island.begin);
+        }
+        return updated;
+    }
+
+    size_t updateRange(uint32_t begin, uint32_t end, math::mat4 *instances)
+    {
+#ifdef MATH_AVX2
+        if (simd)
+            return updateRangeAvx2(begin, end, instances);
+#endif
+        return updateRangeScalar(begin, end, instances);
+    }
+
+    // a node is dirty when it was set or its parent is (parents come first, so that has been
+    // carried down already). The same loop twice so that math's kernel inlines into the AVX2 one;
+    // both sum the products in the same order
+    size_t updateRangeScalar(uint32_t begin, uint32_t end, math::mat4 *instances)
+    {
+        const math::mat4 *local = localMatrices.data();
+        math::mat4 *world = worldMatrices.data();
+        size_t updated = 0;
+        for (uint32_t i = begin; i < end; i++)
+        {
+            uint32_t p = parentSlots[i];
+            uint8_t d = dirty[i] | (p != NONE ? dirty[p] : 0);
+            dirty[i] = d;
+            if (d)
+            {
+                if (p == NONE)
+                    world[i] = local[i];
+                else
+                    math::batch::multiplyScalar(world + p, 0, local + i, world + i, 0, 1);
+                updated++;
+            }
+            if (instances)
+                instances[i] = world[i];
+        }
+        return updated;
+    }
+#ifdef MATH_AVX2
+    __attribute__((target("avx2")))
+    size_t updateRangeAvx2(uint32_t begin, uint32_t end, math::mat4 *instances)
+    {
+        const math::mat4 *local = localMatrices.data();
+        math::mat4 *world = worldMatrices.data();
+        size_t updated = 0;
+        for (uint32_t i = begin; i < end; i++)
+        {
+            uint32_t p = parentSlots[i];
+            uint8_t d = dirty[i] | (p != NONE ? dirty[p] : 0);
+            dirty[i] = d;
+            if (d)
+            {
+                if (p == NONE)
+                    world[i] = local[i];
+                else
+                    math::batch::multiplyAvx2(world + p, 0, local + i, world + i, 1);
+                updated++;
+            }
+            if (instances)
+                instances[i] = world[i];
+        }
+        return updated;
+    }
+#endif
+
+    // by node id
+    std::vector<uint32_t> parentIds;
+    std::vector<uint32_t> slots;
+    // by slot
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> parentSlots;
+    std::vector<math::mat4> localMatrices;
+    std::vector<math::mat4> worldMatrices;
+    std::vector<uint8_t> dirty;
+    std::vector<uint32_t> islandOf;     // for the slots after the top
+    // by island
+    std::vector<Island> islands;
+    std::vector<uint8_t> islandDirty;
+    size_t topEnd = 0;
+    bool layoutChanged = false;
+    JobSystem *jobs;
+    bool avx2 = false;
+    bool simd = false;
+};
+#endif
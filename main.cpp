@@ -1,21 +1,123 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <random>
+#include <vector>
+#include <core/job_system.h>
+#include <math/quaternion.h>
+#include <mesh/rock_mesh.h>
+#include <mesh/simplifier.h>
+#include <raster/software_backend.h>
+#include <render/city_renderer.h>
+#include <render/state_cache.h>
+#include <render/debug_output.h>
+#include <render/frame_pacer.h>
+#include <render/gpu_timer.h>
+#include <render/instance_renderer.h>
+#include <render/lod_renderer.h>
+#include <render/render_thread.h>
+#include <scene/bvh.h>
+#include <scene/camera.h>
+#include <scene/city_scene.h>
+#include <scene/lod_selector.h>
+#include <scene/occlusion_culler.h>
+#include <scene/scene_graph.h>
+#ifdef GL_TRACE
+#include <render/gl_trace.h>
+#endif
+#ifdef ALLOC_COUNTER
+#define ALLOC_COUNTER_IMPLEMENTATION // build with -DALLOC_COUNTER to check the main loop doesn't allocate once warmed up
+#include <core/alloc_counter.h>
+#endif
+
+// everything the render thread needs to draw one frame, filled by the main thread
+struct FrameData
+{
+    float clearColor[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+    float viewProjection[16] = {};
+    std::vector<uint32_t> visible; // the city's buildings to draw, after culling (keeps its capacity between frames)
+    std::vector<math::mat4> instances;  // the turbines' world matrices, written by SceneGraph::update
+    LodSelector::Selection boulders; // the boulders in view, grouped by the level of detail each is drawn at
+};
+
+// the nodes of a wind turbine, created in this order (so a node's part is its id % TURBINE_PARTS)
+enum TurbinePart
+{
+    TURBINE_PLINTH,
+    TURBINE_MAST,
+    TURBINE_NACELLE,
+    TURBINE_HUB,
+    TURBINE_BLADE,
+    TURBINE_PARTS = TURBINE_BLADE + 3
+};
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void processInput(GLFWwindow *window);
+void buildTurbines(const CityScene &city, SceneGraph &graph, std::vector<uint32_t> &nacelles, std::vector<uint32_t> &hubs);
+void animateTurbines(float seconds, SceneGraph &graph, const std::vector<uint32_t> &nacelles, const std::vector<uint32_t> &hubs);
+void placeBoulders(const CityScene &city, std::vector<math::mat4> &models);
 
 // Settings 
 // _________________________________________________________________________________________________________________________________
     
     const unsigned int SCR_WIDTH = 800;
     const unsigned int SCR_HEIGHT = 600;
+    const int WARMUP_FRAMES = 60; // -DALLOC_COUNTER: allocations are counted from this frame on
+    const FramePacer::Mode PACING = FramePacer::VSYNC; // UNCAPPED, VSYNC, LIMITED (at TARGET_FPS) or LOW_LATENCY; --pacing= overrides
+    const double TARGET_FPS = 60.0;
+    const int CITY_BLOCKS = 16;
+    const int CITY_LOTS = 4;        // CITY_BLOCKS^2 * CITY_LOTS^2 buildings
+    const bool FRUSTUM_CULLING = true;   // draw only the buildings whose boxes are in the view (a BVH query)
+    const bool OCCLUSION_CULLING = true; // and of those, only the ones not hidden in a CPU depth buffer of the buildings
+    const int CULL_WIDTH = 256;
+    const int CULL_HEIGHT = 144;
+    const int TURBINE_SPACING = 4;  // a wind turbine on every 4th roof: a scene graph of plinth, mast, nacelle, hub and blades
+    const int IDLE_TURBINES = 4;    // every 4th one stands still, and its subtree is skipped by the update
+    const int ROCK_DETAIL = 5;      // a boulder at every street crossing, 20 * 4^5 triangles at full detail
+    const int ROCK_LEVELS = 10;     // simplified to half as many each level
+    const float LOD_ERROR_PIXELS = 1.0f; // each boulder drawn at the coarsest level whose error stays under this on screen
+    const double CAMERA_LOOP_SECONDS = 60.0;
 
 // _________________________________________________________________________________________________________________________________
 
-int main()
+int main(int argc, char **argv)
 {
+    // frame pacing: --pacing=uncapped|vsync|limit=<fps>|low-latency
+    // backend: --backend=gl (the window) or --backend=software, which draws the oldmain.cpp triangles on the
+    // CPU into a PPM (--scene=, --frames=, --output=) without creating a window or a GL context
+    // _________________________________________________________________________________________________________________________________
+    FramePacer::Mode pacing = PACING;
+    double targetFps = TARGET_FPS;
+    bool software = false;
+    SoftwareBackend softwareBackend;
+    softwareBackend.width = SCR_WIDTH;
+    softwareBackend.height = SCR_HEIGHT;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--pacing=", 9) == 0 && FramePacer::parse(arg + 9, pacing, targetFps))
+            ;
+        else if (std::strcmp(arg, "--backend=gl") == 0 || std::strcmp(arg, "--backend=software") == 0)
+            software = arg[10] == 's';
+        else if (std::strncmp(arg, "--scene=", 8) == 0)
+            softwareBackend.scene = arg + 8;
+        else if (std::strncmp(arg, "--output=", 9) == 0)
+            softwareBackend.output = arg + 9;
+        else if (std::sscanf(arg, "--frames=%d", &softwareBackend.frames) == 1 && softwareBackend.frames > 0)
+            ;
+        else
+        {
+            std::cout << "Unknown argument " << arg << " (use --pacing=uncapped|vsync|limit=<fps>|low-latency, --backend=gl|software,"
+                      << " and with the software backend --scene=first|second|third|all, --frames=<n>, --output=<file.ppm>)" << std::endl;
+            return -1;
+        }
+    }
+    if (software)
+        return softwareBackend.run() ? 0 : -1;
+    FramePacer pacer(pacing, targetFps);
     // _________________________________________________________________________________________________________________________________
     // glfw: initialize and configure
     // _________________________________________________________________________________________________________________________________
@@ -26,10 +128,14 @@ int main()
     #ifdef __APPLE__
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     #endif
+    #ifndef NDEBUG
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE); // debug builds: ask the driver for KHR_debug messages
+    #endif
     // _________________________________________________________________________________________________________________________________
 
     // glfw window creation
     // _________________________________________________________________________________________________________________________________
+    RenderThread<FrameData> renderer; // declared first so it outlives the window callbacks that use it
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL); // Create a window object
     if (window == NULL) // Check if the window failed to create
     {
@@ -37,36 +143,239 @@ int main()
         glfwTerminate(); // Terminate GLFW
         return -1;
     }
-    glfwMakeContextCurrent(window); // Make the window the current context
+    glfwSetWindowUserPointer(window, &renderer); // the resize callback forwards to the render thread
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback); // Set the callback function for when the window is resized
+    const GLFWvidmode *videoMode = glfwGetVideoMode(glfwGetPrimaryMonitor());
+    if (pacer.swapInterval() && videoMode && videoMode->refreshRate > 0)
+        pacer.setTargetFps(videoMode->refreshRate); // vsync modes pace to the display
+    // _________________________________________________________________________________________________________________________________
+
+    // scene: a generated city, culled on the main thread while the render thread draws the previous frame
+    // _________________________________________________________________________________________________________________________________
+    CityScene city;
+    city.generate(CITY_BLOCKS, CITY_LOTS);
+    Camera camera;
+    camera.nearPlane = 0.5f;
+    camera.farPlane = 3000.0f;
+    JobSystem jobs;
+    Bvh bvh(&jobs); // frustum culling, and picking with the mouse
+    bvh.build(city.buildings[0].min, city.buildings[0].max, sizeof(CityScene::Building), city.buildings.size());
+    OcclusionCuller culler(jobs, CULL_WIDTH, CULL_HEIGHT);
+    for (const CityScene::Building &b : city.buildings)
+        culler.addOccluderBox(b.min, b.max);
+    SceneGraph turbines(&jobs);
+    std::vector<uint32_t> nacelles, hubs;
+    std::vector<float> partColors;
+    buildTurbines(city, turbines, nacelles, hubs);
+    turbines.update(); // lays the nodes out; their slots are the instance order from here on
+    for (size_t slot = 0; slot < turbines.size(); slot++)
+    {
+        float white = (turbines.node((uint32_t)slot) % TURBINE_PARTS) == TURBINE_HUB ? 0.3f : 0.9f; // the hubs dark red
+        partColors.push_back(0.9f);
+        partColors.push_back(white);
+        partColors.push_back(white);
+    }
+    MeshData rock;
+    generateRockMesh(rock, ROCK_DETAIL);
+    std::vector<MeshLod> rockLevels = buildLodChain(rock, ROCK_LEVELS);
+    std::vector<math::mat4> boulders;
+    placeBoulders(city, boulders);
+    LodSelector boulderLod(rockLevels, rock);
+    boulderLod.thresholdPixels = LOD_ERROR_PIXELS;
+    bool wasClicked = false;
+    std::vector<uint32_t> inFrustum(city.buildings.size());
+    std::vector<uint8_t> visible(city.buildings.size());
+    unsigned long long buildingsTested = 0, buildingsInFrustum = 0, buildingsDrawn = 0;
+    unsigned long long boulderFrames = 0, boulderTriangles = 0, boulderFullTriangles = 0;
     // _________________________________________________________________________________________________________________________________
 
-    // glad: load all OpenGL function pointers
+    // render thread: owns the GL context; the main thread keeps the GLFW event queue
     // _________________________________________________________________________________________________________________________________
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) // Load all the OpenGL functions
+    CityRenderer cityRenderer;
+    InstanceRenderer turbineRenderer;
+    LodRenderer boulderRenderer;
+    GpuTimer gpuTimer; // render thread: GPU time of each frame, for the low-latency pacing estimate
+    std::chrono::steady_clock::time_point renderStart;
+    double gpuSeconds = 0.0;
+    RenderThread<FrameData>::Hooks hooks;
+    hooks.init = [&] {
+        glfwMakeContextCurrent(window); // Make the window the current context (of the render thread)
+        // glad: load all OpenGL function pointers
+        if (!gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress)) // Load the OpenGL functions (each one is resolved on its first call)
+        {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            return false;
+        }
+        glfwSwapInterval(pacer.swapInterval()); // 0: present immediately (uncapped, limited), 1: wait for the vblank
+        #ifdef GL_TRACE
+        GLTrace::install(); // build with -DGL_TRACE to count and time every GL call (installed first, so it sees what the state cache forwards)
+        #endif
+        StateCache::install(); // drop redundant state changes (the per-frame glClearColor etc.) before they reach the driver
+        #ifndef NDEBUG
+        StateCache::setValidation(true); // debug builds: check the shadow state against the driver on every filtered call
+        DebugOutput::install(); // debug builds: capture driver errors and performance warnings into a log ring
+        #endif
+        if (!cityRenderer.create(city.buildings.size()) || !turbineRenderer.create(turbines.size()) || !boulderRenderer.create(rock, rockLevels, boulders.size() * 2))
+            return false;
+        turbineRenderer.setColors(partColors.data(), turbines.size());
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_CULL_FACE);
+        gpuTimer.create();
+        return true;
+    };
+    hooks.render = [&](const FrameData &frame) {
+        #ifdef GL_TRACE
+        GLTrace::beginFrame();
+        #endif
+        renderStart = std::chrono::steady_clock::now();
+        gpuTimer.begin();
+        {
+            DebugOutput::Scope scope("clear"); // driver messages raised in here are attributed to "clear"
+            glClearColor(frame.clearColor[0], frame.clearColor[1], frame.clearColor[2], frame.clearColor[3]); // Set the color of the window
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // Clear the window
+        }
+        DebugOutput::Scope scope("city");
+        cityRenderer.draw(city, frame.viewProjection, frame.visible.data(), frame.visible.size());
+        turbineRenderer.upload(frame.instances.data(), frame.instances.size()); // the graph runs on the main thread (with the job system): one copy into the stream
+        turbineRenderer.draw(frame.viewProjection, frame.instances.size());
+        boulderRenderer.upload(frame.boulders);
+        boulderRenderer.draw(frame.viewProjection, frame.boulders);
+        gpuTimer.end();
+    };
+    hooks.present = [&] {
+        double renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - renderStart).count();
+        glfwSwapBuffers(window); // Swap the buffers (blocks until the vblank with a swap interval of 1)
+        gpuTimer.poll(gpuSeconds); // the newest finished measurement, usually a frame or two old
+        pacer.framePresented(renderSeconds, gpuSeconds);
+        #ifdef GL_TRACE
+        GLTrace::endFrame();
+        #endif
+        DebugOutput::drain(); // write new debug messages outside the GL calls that raised them
+    };
+    hooks.resize = [](int width, int height) {
+        // make sure the viewport matches the new window dimensions; note that width and
+        // height will be significantly larger than specified on retina displays.
+        glViewport(0, 0, width, height);
+    };
+    hooks.shutdown = [&] {
+        cityRenderer.destroy();
+        turbineRenderer.destroy();
+        boulderRenderer.destroy();
+        gpuTimer.destroy();
+        StateCache::report(); // forwarded vs filtered state changes
+        DebugOutput::report(); // each distinct debug message and how often it was raised
+        #ifdef GL_TRACE
+        GLTrace::report();
+        #endif
+        glfwMakeContextCurrent(NULL);
+    };
+    if (!renderer.start(hooks))
     {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+        glfwTerminate(); // Terminate GLFW
         return -1;
     }
     // _________________________________________________________________________________________________________________________________
-    // render loop
+    // main loop: events and input here, drawing on the render thread
     // _________________________________________________________________________________________________________________________________
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    #ifdef ALLOC_COUNTER
+    int frameCount = 0;
+    unsigned long long warmAllocations = 0;
+    #endif
 while (!glfwWindowShouldClose(window))
 {
     // ================================================================================================================================
     // input
     // _________________________________________________________________________________________________________________________________
+    FrameData &frame = renderer.beginFrame(); // waits while the render thread is a full frame behind, so the input below is fresh
+    pacer.waitForInput(); // limited: hold the frame rate; low-latency: wait until just in time for the next vblank
+    glfwPollEvents(); // Poll for events
     processInput(window);
+    bool clicked = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT) == GLFW_PRESS;
+    if (clicked && !wasClicked) // pick the building under the cursor, as the last frame showed it
+    {
+        double cursorX, cursorY;
+        int windowWidth, windowHeight;
+        glfwGetCursorPos(window, &cursorX, &cursorY);
+        glfwGetWindowSize(window, &windowWidth, &windowHeight);
+        float direction[3];
+        camera.ray(2.0f * (float)cursorX / windowWidth - 1.0f, 1.0f - 2.0f * (float)cursorY / windowHeight, direction);
+        Bvh::Hit hit;
+        if (bvh.raycast(camera.position, direction, camera.farPlane, hit))
+            std::cout << "picked building " << hit.object << ", " << hit.distance << " away" << std::endl;
+    }
+    wasClicked = clicked;
+    std::chrono::steady_clock::time_point inputTime = std::chrono::steady_clock::now();
     // ================================================================================================================================
-    // render
+    // frame data for the render thread
     // _________________________________________________________________________________________________________________________________
-    glClearColor(0.2f, 0.3f, 0.3f, 1.0f); // Set the color of the window
-    glClear(GL_COLOR_BUFFER_BIT); // Clear the window
-    glfwSwapBuffers(window); // Swap the buffers
-    glfwPollEvents(); // Poll for events
+    frame.clearColor[0] = 0.2f;
+    frame.clearColor[1] = 0.3f;
+    frame.clearColor[2] = 0.3f;
+    frame.clearColor[3] = 1.0f;
+    int framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    if (framebufferWidth > 0 && framebufferHeight > 0)
+        camera.aspect = (float)framebufferWidth / framebufferHeight;
+    double seconds = std::chrono::duration<double>(inputTime - startTime).count();
+    city.cameraPath((float)std::fmod(seconds / CAMERA_LOOP_SECONDS, 1.0), camera);
+    camera.viewProjection(frame.viewProjection);
+    size_t candidates = city.buildings.size();
+    if (FRUSTUM_CULLING)
+        candidates = bvh.frustum(frame.viewProjection, inFrustum.data());
+    else
+        for (size_t i = 0; i < candidates; i++)
+            inFrustum[i] = (uint32_t)i;
+    frame.visible.clear();
+    if (OCCLUSION_CULLING)
+    {
+        // occluders first, then the boxes left by the frustum test against the depth pyramid; only the survivors are submitted
+        culler.render(frame.viewProjection);
+        culler.testBoxes(city.buildings[0].min, city.buildings[0].max, sizeof(CityScene::Building), inFrustum.data(), candidates, visible.data());
+        for (size_t i = 0; i < candidates; i++)
+            if (visible[i])
+                frame.visible.push_back(inFrustum[i]);
+    }
+    else
+        frame.visible.insert(frame.visible.end(), inFrustum.begin(), inFrustum.begin() + candidates);
+    animateTurbines((float)seconds, turbines, nacelles, hubs);
+    frame.instances.resize(turbines.size());
+    turbines.update(frame.instances.data()); // the dirty subtrees recomputed, every matrix written to the frame's instance data
+    if (framebufferHeight > 0)
+    {
+        size_t bouldersInView = boulderLod.select(camera, (float)framebufferHeight, boulders.data(), boulders.size(), frame.boulders);
+        boulderFrames++;
+        boulderTriangles += frame.boulders.triangles;
+        boulderFullTriangles += bouldersInView * (rockLevels[0].indexCount / 3);
+    }
+    buildingsTested += city.buildings.size();
+    buildingsInFrustum += candidates;
+    buildingsDrawn += frame.visible.size();
+    renderer.submitFrame(inputTime);
+    pacer.frameSubmitted();
+    #ifdef ALLOC_COUNTER
+    if (++frameCount == WARMUP_FRAMES)
+        warmAllocations = AllocCounter::allocations();
+    #endif
     // ================================================================================================================================
 }
 
+    #ifdef ALLOC_COUNTER
+    if (frameCount > WARMUP_FRAMES) // read before stop(): the shutdown reports allocate
+        std::cout << "heap allocations after warm-up: " << AllocCounter::allocations() - warmAllocations
+                  << " in " << frameCount - WARMUP_FRAMES << " frames" << std::endl;
+    #endif
+    renderer.stop(); // draws what was submitted, reports and releases the context
+    renderer.latency().print(std::cout, "input -> present");
+    renderer.pacing().print(std::cout, "present interval");
+    pacer.report(std::cout); // input delay, render CPU and GPU time
+    if (buildingsTested)
+        std::cout << "culling: " << 100.0 * (buildingsTested - buildingsDrawn) / buildingsTested << "% of buildings not drawn ("
+                  << 100.0 * (buildingsTested - buildingsInFrustum) / buildingsTested << "% outside the view, "
+                  << 100.0 * (buildingsInFrustum - buildingsDrawn) / buildingsTested << "% occluded)" << std::endl;
+    if (boulderFrames)
+        std::cout << "boulders: " << boulderTriangles / boulderFrames << " triangles per frame with levels of detail, "
+                  << boulderFullTriangles / boulderFrames << " at full detail" << std::endl;
     glfwTerminate(); // Terminate GLFW
     return 0;
 }
@@ -88,7 +397,65 @@ void processInput(GLFWwindow *window)
 // _________________________________________________________________________________________________________________________________
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
-    // make sure the viewport matches the new window dimensions; note that width and 
-    // height will be significantly larger than specified on retina displays.
-    glViewport(0, 0, width, height);
-}
\ No newline at end of file
+    // GL belongs to the render thread: hand the new size over, it updates the viewport
+    RenderThread<FrameData> *renderer = (RenderThread<FrameData>*)glfwGetWindowUserPointer(window);
+    renderer->post(RenderCommand::resize(width, height));
+}
+
+// wind turbines on the roofs: each node is drawn as the unit cube its world matrix places, so
+// the pivots (plinth, nacelle, hub) scale uniformly and only the leaves are stretched
+// _________________________________________________________________________________________________________________________________
+math::mat4 turbinePart(math::vec3 translation, math::vec3 axis, float angle, math::vec3 scale, math::vec3 offset)
+{
+    // the cube moved by offset first, so it turns about that point
+    return math::compose(translation, math::rotate3(axis, angle), scale) * math::translate(offset);
+}
+
+void buildTurbines(const CityScene &city, SceneGraph &graph, std::vector<uint32_t> &nacelles, std::vector<uint32_t> &hubs)
+{
+    const math::vec3 yAxis(0.0f, 1.0f, 0.0f), zAxis(0.0f, 0.0f, 1.0f), centreXZ(-0.5f, 0.0f, -0.5f), centre(-0.5f);
+    graph.reserve(city.buildings.size() / TURBINE_SPACING * TURBINE_PARTS + TURBINE_PARTS);
+    for (size_t i = 0; i < city.buildings.size(); i += TURBINE_SPACING)
+    {
+        const CityScene::Building &b = city.buildings[i];
+        math::vec3 roof((b.min[0] + b.max[0]) * 0.5f, b.max[1], (b.min[2] + b.max[2]) * 0.5f);
+        uint32_t plinth = graph.create(SceneGraph::NONE, turbinePart(roof, yAxis, 0.0f, math::vec3(1.0f), centreXZ));
+        graph.create(plinth, turbinePart(math::vec3(0.5f, 1.0f, 0.5f), yAxis, 0.0f, math::vec3(0.2f, 7.0f, 0.2f), centreXZ));
+        nacelles.push_back(graph.create(plinth, turbinePart(math::vec3(0.5f, 8.0f, 0.5f), yAxis, 0.0f, math::vec3(1.0f), centreXZ)));
+        hubs.push_back(graph.create(nacelles.back(), turbinePart(math::vec3(0.5f, 0.5f, 1.0f), zAxis, 0.0f, math::vec3(0.4f), centre)));
+        for (int blade = 0; blade < 3; blade++)
+            graph.create(hubs.back(), turbinePart(math::vec3(0.5f), zAxis, blade * 2.0943951f, math::vec3(0.5f, 10.0f, 0.2f), centreXZ));
+    }
+}
+
+// the rotors spin, and the nacelles turn slowly as the wind does; the idle ones keep still
+void animateTurbines(float seconds, SceneGraph &graph, const std::vector<uint32_t> &nacelles, const std::vector<uint32_t> &hubs)
+{
+    const math::vec3 yAxis(0.0f, 1.0f, 0.0f), zAxis(0.0f, 0.0f, 1.0f), centreXZ(-0.5f, 0.0f, -0.5f), centre(-0.5f);
+    const math::vec3 top(0.5f, 8.0f, 0.5f), front(0.5f, 0.5f, 1.0f);
+    float wind = 0.6f * std::sin(seconds * 0.05f);
+    for (size_t t = 0; t < hubs.size(); t++)
+    {
+        if (t % IDLE_TURBINES == 0)
+            continue;
+        graph.setLocal(nacelles[t], turbinePart(top, yAxis, wind + 0.1f * (float)(t % 7), math::vec3(1.0f), centreXZ));
+        graph.setLocal(hubs[t], turbinePart(front, zAxis, seconds * (1.0f + 0.15f * (float)(t % 5)), math::vec3(0.4f), centre));
+    }
+}
+
+// a boulder at a corner of every street crossing, clear of the camera's path along the middle
+// of the streets; turned and sized at random, a third sunk into the road
+void placeBoulders(const CityScene &city, std::vector<math::mat4> &models)
+{
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    float half = city.extent() * 0.5f, offset = CityScene::STREET_WIDTH * 0.3f;
+    for (int z = 0; z <= city.blocks; z++)
+        for (int x = 0; x <= city.blocks; x++)
+        {
+            float size = 1.2f + 0.8f * unit(random);
+            math::quat turn = math::angleAxis(6.2831853f * unit(random), math::normalize(math::vec3(unit(random) - 0.5f, 2.0f, unit(random) - 0.5f)));
+            math::vec3 position(-half + x * city.blockPitch() + offset, 0.4f * size, -half + z * city.blockPitch() + offset);
+            models.push_back(math::compose(position, turn, math::vec3(size)));
+        }
+}
@@ -0,0 +1,13 @@
+#version 330 core
+// the vertex colour, lit by a directional light as if the triangle bulged towards the viewer
+out vec4 FragColor;
+in vec3 ourColor;
+uniform vec3 lightDirection;
+uniform float ambient;
+void main()
+{
+   vec3 normal = normalize(vec3(ourColor.xy * 2.0 - 1.0, 1.0));
+   float diffuse = max(dot(normal, normalize(lightDirection)), 0.0);
+   vec3 lit = ourColor * clamp(ambient + diffuse, 0.0, 1.0);
+   FragColor = vec4(mix(lit, vec3(1.0), 0.1), 1.0);
+}
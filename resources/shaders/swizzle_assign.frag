@@ -0,0 +1,12 @@
+#version 330 core
+// assignments whose right-hand side reads the components being written: a compiler check
+out vec4 FragColor;
+in vec3 ourColor;
+void main()
+{
+   vec3 c = ourColor;
+   c.xy = c.yx;
+   c += c.zxy;
+   c.yz = c.zy;
+   FragColor = vec4(c, 1.0);
+}
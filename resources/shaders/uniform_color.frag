@@ -0,0 +1,7 @@
+#version 330 core
+out vec4 FragColor;
+uniform vec4 ourColor;
+void main()
+{
+   FragColor = ourColor;
+}
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""Generate the lazy loader and trace layer blocks of glad.c from glad.h.
+
+Lazy loader: every glad_gl* pointer gets a trampoline that resolves the real entry point
+the first time it is called, stores it back into the pointer and forwards the call.
+Trace layer: every glad_gl* pointer gets a wrapper that calls the installed pre/post
+callbacks with the function's index around the real call (see gladInstallTrace).
+
+The blocks are written between the LAZY_BEGIN/LAZY_END and TRACE_BEGIN/TRACE_END markers
+in glad.c; rerun this script whenever glad.h is regenerated with different versions or
+extensions.
+
+    python3 tools/glad_lazy.py dependencies/include/glad/glad.h glad.c
+"""
+import re
+import sys
+
+LAZY_BEGIN = "/* ---- lazy loader: generated by tools/glad_lazy.py, do not edit ---- */"
+LAZY_END = "/* ---- end of generated lazy loader ---- */"
+TRACE_BEGIN = "/* ---- trace layer: generated by tools/glad_lazy.py, do not edit ---- */"
+TRACE_END = "/* ---- end of generated trace layer ---- */"
+
+# resolved eagerly by gladLoadGLLoaderLazy itself
+EAGER = {"glGetString"}
+
+TYPEDEF = re.compile(r"^typedef (.+?) \(APIENTRYP (PFN\w+PROC)\)\((.*)\);$")
+POINTER = re.compile(r"^GLAPI (PFN\w+PROC) glad_(\w+);$")
+FEATURE = re.compile(r"^#ifndef (GL_VERSION_\d_\d|GL_[A-Z0-9]+_\w+)$")
+
+
+def parse(header):
+    features = []  # [(name, [function, ...])]
+    signatures = {}  # function -> (return type, pfn, params)
+    typedefs = {}
+    current = None
+    for line in open(header):
+        line = line.rstrip("\n")
+        m = FEATURE.match(line)
+        if m:
+            current = (m.group(1), [])
+            features.append(current)
+            continue
+        m = TYPEDEF.match(line)
+        if m:
+            typedefs[m.group(2)] = (m.group(1), m.group(3))
+            continue
+        m = POINTER.match(line)
+        if m and current is not None:
+            pfn, name = m.group(1), m.group(2)
+            ret, params = typedefs[pfn]
+            signatures[name] = (ret, pfn, params)
+            current[1].append(name)
+    return [f for f in features if f[1]], signatures
+
+
+def arguments(params):
+    if params.strip() == "void":
+        return ""
+    names = []
+    for param in params.split(","):
+        names.append(re.search(r"(\w+)\s*$", param.strip()).group(1))
+    return ", ".join(names)
+
+
+def generate(features, signatures):
+    out = [LAZY_BEGIN, ""]
+    emitted = set()
+    for _, functions in features:
+        for name in functions:
+            if name in emitted or name in EAGER:
+                continue
+            emitted.add(name)
+            ret, pfn, params = signatures[name]
+            call = "%sfn(%s);" % ("" if ret == "void" else "return ", arguments(params))
+            out.append("static %s APIENTRY glad_lazy_%s(%s) {" % (ret, name, params))
+            out.append("\tstatic %s fn = NULL; if(fn == NULL) fn = (%s)glad_lazy_resolve(\"%s\", (void**)&glad_%s, (void*)glad_lazy_%s);" % (pfn, pfn, name, name, name))
+            out.append("\t" + call)
+            out.append("}")
+    for feature, functions in features:
+        out.append("static void glad_lazy_install_%s(void) {" % feature)
+        out.append("\tif(!GLAD_%s) return;" % feature)
+        for name in functions:
+            if name not in EAGER:
+                out.append("\tglad_%s = glad_lazy_%s;" % (name, name))
+        out.append("}")
+    out.append("static void glad_lazy_install_core(void) {")
+    out += ["\tglad_lazy_install_%s();" % f for f, _ in features if f.startswith("GL_VERSION_")]
+    out.append("}")
+    out.append("static void glad_lazy_install_extensions(void) {")
+    out += ["\tglad_lazy_install_%s();" % f for f, _ in features if not f.startswith("GL_VERSION_")]
+    out.append("}")
+    out.append(LAZY_END)
+    return "\n".join(out)
+
+
+def generate_trace(features, signatures):
+    out = [TRACE_BEGIN, ""]
+    functions = []
+    for _, names in features:
+        for name in names:
+            if name not in functions:
+                functions.append(name)
+    out.append("static const char *glad_trace_names[%d] = {" % len(functions))
+    out += ["\t\"%s\"," % name for name in functions]
+    out.append("};")
+    for index, name in enumerate(functions):
+        ret, pfn, params = signatures[name]
+        args = arguments(params)
+        out.append("static %s glad_trace_next_%s = NULL;" % (pfn, name))
+        out.append("static %s APIENTRY glad_trace_%s(%s) {" % (ret, name, params))
+        if ret == "void":
+            out.append("\tglad_trace_pre(%d); glad_trace_next_%s(%s); glad_trace_post(%d);" % (index, name, args, index))
+        else:
+            out.append("\t%s result; glad_trace_pre(%d); result = glad_trace_next_%s(%s); glad_trace_post(%d); return result;" % (ret, index, name, args, index))
+        out.append("}")
+    out.append("static void glad_trace_wrap(void) {")
+    for name in functions:
+        out.append("\tif(glad_%s != NULL && glad_%s != glad_trace_%s) { glad_trace_next_%s = glad_%s; glad_%s = glad_trace_%s; }" % ((name,) * 7))
+    out.append("}")
+    out.append("static void glad_trace_unwrap(void) {")
+    for name in functions:
+        out.append("\tif(glad_%s == glad_trace_%s) glad_%s = glad_trace_next_%s;" % ((name,) * 4))
+    out.append("}")
+    out.append(TRACE_END)
+    return "\n".join(out)
+
+
+def replace_block(source, begin_marker, end_marker, block):
+    begin, end = source.find(begin_marker), source.find(end_marker)
+    if begin < 0 or end < 0:
+        return None
+    return source[:begin] + block + source[end + len(end_marker):]
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: glad_lazy.py <glad.h> <glad.c>")
+        return 1
+    features, signatures = parse(sys.argv[1])
+    source = open(sys.argv[2]).read()
+    source = replace_block(source, LAZY_BEGIN, LAZY_END, generate(features, signatures))
+    if source is not None:
+        source = replace_block(source, TRACE_BEGIN, TRACE_END, generate_trace(features, signatures))
+    if source is None:
+        print("glad_lazy.py: markers not found in %s" % sys.argv[2])
+        return 1
+    open(sys.argv[2], "w").write(source)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,468 @@
+#!/usr/bin/env python3
+"""Compile a GLSL 3.30 vertex/fragment shader pair (a subset) to C++ for the software rasterisers.
+
+The output header defines a struct with the shaders as RasterPipeline functions:
+
+    struct Glsl<Name>
+    {
+        struct Uniforms { ... };            // the uniforms, in declaration order
+        static const int VARYINGS;          // floats from vertex to fragment shader
+        static void vertex(...);            // RasterPipeline::VertexShader
+        static void fragment(...);          // RasterPipeline::FragmentShader
+        static void fragment8(...);         // RasterPipeline::FragmentShader8
+        static RasterPipeline::Program program(const Uniforms *uniforms);
+    };
+
+Every vector is split into its components at compile time, so each statement becomes a few
+scalar operations; the fragment shader body is a template over the component type, compiled
+for float (one fragment) and for an 8-lane GCC vector (fragment8, with an AVX2 variant chosen
+at run time, see raster/glsl_runtime.h). There is no interpreter and no dispatch per pixel.
+
+The subset: float and vec2/3/4 inputs (layout(location = N), N < 4, in the vertex shader), outputs
+and uniforms; main() with local declarations and (compound) assignments, including to
+swizzles; + - * /, unary minus, parentheses, constructors, swizzles (xyzw, rgba, stpq) and
+the built-ins abs sign floor fract sqrt inversesqrt pow min max clamp mix step dot length
+normalize cross. No control flow, functions, matrices, integers or samplers.
+
+    python3 tools/glslc.py --name TriangleWithColor resources/shaders/triangle_with_color.vert \\
+        resources/shaders/triangle_with_color.frag -o triangle_with_color.h
+"""
+import argparse
+import re
+import sys
+
+TYPES = {"float": 1, "vec2": 2, "vec3": 3, "vec4": 4}
+MAX_ATTRIBUTES = 4  # RasterPipeline::MAX_ATTRIBUTES
+SWIZZLES = ["xyzw", "rgba", "stpq"]
+TOKEN = re.compile(r"""
+    (?P<space>\s+|//[^\n]*|/\*.*?\*/|\#[^\n]*)
+  | (?P<number>(\d+\.\d*|\.\d+|\d+)([eE][+-]?\d+)?[fF]?)
+  | (?P<name>[A-Za-z_]\w*)
+  | (?P<op>[-+*/]=|[-+*/=(){},;.])
+""", re.VERBOSE | re.DOTALL)
+
+# component-wise built-ins: name -> (argument count, runtime helper)
+ELEMENTWISE = {
+    "abs": (1, "glslAbs"), "sign": (1, "glslSign"), "floor": (1, "glslFloor"), "fract": (1, "glslFract"),
+    "sqrt": (1, "glslSqrt"), "inversesqrt": (1, "glslInverseSqrt"), "pow": (2, "glslPow"),
+    "min": (2, "glslMin"), "max": (2, "glslMax"), "clamp": (3, "glslClamp"), "mix": (3, "glslMix"),
+    "step": (2, "glslStep"),
+}
+
+
+class CompileError(Exception):
+    pass
+
+
+def tokenize(path, source):
+    tokens = []
+    line, position = 1, 0
+    while position < len(source):
+        m = TOKEN.match(source, position)
+        if not m:
+            raise CompileError("%s:%d: unexpected character %r" % (path, line, source[position]))
+        if m.lastgroup != "space":
+            tokens.append((m.lastgroup, m.group(m.lastgroup), line))
+        line += m.group(0).count("\n")
+        position = m.end()
+    tokens.append(("end", "", line))
+    return tokens
+
+
+class Variable:
+    def __init__(self, kind, type_, name, location=None):
+        self.kind = kind  # "in", "out", "uniform" or "local"
+        self.type = type_
+        self.size = TYPES[type_]
+        self.name = name
+        self.location = location
+
+
+class Shader:
+    """One parsed and compiled shader: its interface and the C++ statements of main()."""
+
+    def __init__(self, path, stage, scalar):
+        self.path = path
+        self.stage = stage
+        self.scalar = scalar  # C++ component type: "float" or the template parameter "F"
+        self.globals = {}
+        self.order = []
+        self.locals = {}
+        self.lines = []
+        self.temporaries = 0
+        source = open(path).read()
+        self.tokens = tokenize(path, source)
+        self.index = 0
+        self.parse()
+
+    # tokens
+    def peek(self, offset=0):
+        return self.tokens[self.index + offset]
+
+    def error(self, message):
+        raise CompileError("%s:%d: %s" % (self.path, self.peek()[2], message))
+
+    def take(self, value=None, kind=None):
+        token = self.peek()
+        if (value is not None and token[1] != value) or (kind is not None and token[0] != kind):
+            self.error("expected %s, found %r" % (value or kind, token[1] or "end of file"))
+        self.index += 1
+        return token[1]
+
+    def accept(self, value):
+        if self.peek()[1] == value and self.peek()[0] != "end":
+            self.index += 1
+            return True
+        return False
+
+    # declarations
+    def parse(self):
+        while self.peek()[0] != "end":
+            if self.accept("void"):
+                self.take("main")
+                self.take("(")
+                self.take(")")
+                self.take("{")
+                while not self.accept("}"):
+                    self.statement()
+                continue
+            location = None
+            if self.accept("layout"):
+                self.take("(")
+                self.take("location")
+                self.take("=")
+                location = int(self.take(kind="number"))
+                if location >= MAX_ATTRIBUTES:
+                    self.error("location %d out of range (the software pipeline has %d attributes)" % (location, MAX_ATTRIBUTES))
+                self.take(")")
+            qualifier = self.take(kind="name")
+            if qualifier not in ("in", "out", "uniform"):
+                self.error("unsupported declaration %r" % qualifier)
+            type_ = self.take(kind="name")
+            if type_ not in TYPES:
+                self.error("unsupported type %r" % type_)
+            name = self.take(kind="name")
+            self.take(";")
+            if self.stage == "vertex" and qualifier == "in" and location is None:
+                self.error("vertex inputs need layout(location = N)")
+            variable = Variable(qualifier, type_, name, location)
+            self.globals[name] = variable
+            self.order.append(variable)
+
+    def variables(self, kind):
+        return [v for v in self.order if v.kind == kind]
+
+    # statements
+    def statement(self):
+        self.accept("const")
+        token = self.peek()
+        if token[1] in TYPES:
+            type_ = self.take()
+            name = self.take(kind="name")
+            if name in self.locals or name in self.globals:
+                self.error("%r is already declared" % name)
+            if self.accept("="):
+                value = self.convert(self.expression(), TYPES[type_])
+            else:
+                value = [self.constant(0.0)] * TYPES[type_]
+            self.take(";")
+            self.locals[name] = Variable("local", type_, name)
+            for i, component in enumerate(value):
+                self.lines.append("%s %s = %s;" % (self.scalar, self.component(name, i), component))
+            return
+        name = self.take(kind="name")
+        target = self.lookup(name)
+        if target.kind in ("in", "uniform"):
+            self.error("cannot assign to %s %r" % (target.kind, name))
+        indices = list(range(target.size))
+        if self.accept("."):
+            indices = self.swizzle(self.take(kind="name"), target.size)
+            if len(set(indices)) != len(indices):
+                self.error("repeated component in an assignment")
+        op = self.take()
+        if op not in ("=", "+=", "-=", "*=", "/="):
+            self.error("expected an assignment, found %r" % op)
+        value = self.convert(self.expression(), len(indices))
+        self.take(";")
+        if len(indices) > 1:
+            # read the target's components before writing any: c.xy = c.yx, c += c.zxy
+            value = [self.temporary(c) if c.startswith(name + "_") else c for c in value]
+        for i, component in zip(indices, value):
+            left = self.component(name, i)
+            if op == "=":
+                self.lines.append("%s = %s;" % (left, component))
+            else:
+                self.lines.append("%s = %s %s %s;" % (left, left, op[0], component))
+
+    def lookup(self, name):
+        if name == "gl_Position" and self.stage == "vertex":
+            return Variable("out", "vec4", name)
+        variable = self.locals.get(name) or self.globals.get(name)
+        if variable is None:
+            self.error("undeclared %r" % name)
+        return variable
+
+    @staticmethod
+    def component(name, index):
+        return "%s_%d" % (name, index)
+
+    def swizzle(self, text, size):
+        for letters in SWIZZLES:
+            if all(c in letters for c in text):
+                indices = [letters.index(c) for c in text]
+                if len(text) > 4 or max(indices) >= size:
+                    self.error("swizzle %r out of range" % text)
+                return indices
+        self.error("bad swizzle %r" % text)
+
+    # expressions: each evaluates to a list of C++ expressions, one per component
+    def temporary(self, value):
+        name = "t%d" % self.temporaries
+        self.temporaries += 1
+        self.lines.append("const %s %s = %s;" % (self.scalar, name, value))
+        return name
+
+    def constant(self, value):
+        return "glslSplat<%s>(%sf)" % (self.scalar, repr(float(value)))
+
+    def convert(self, value, size):
+        if len(value) == size:
+            return value
+        if len(value) == 1:
+            return value * size
+        self.error("expected %d components, found %d" % (size, len(value)))
+
+    def binary(self, left, right, op):
+        size = max(len(left), len(right))
+        if len(left) != len(right) and min(len(left), len(right)) != 1:
+            self.error("mismatched operands: %d and %d components" % (len(left), len(right)))
+        left, right = self.convert(left, size), self.convert(right, size)
+        return [self.temporary("%s %s %s" % (a, op, b)) for a, b in zip(left, right)]
+
+    def expression(self):
+        value = self.term()
+        while self.peek()[1] in ("+", "-"):
+            op = self.take()
+            value = self.binary(value, self.term(), op)
+        return value
+
+    def term(self):
+        value = self.unary()
+        while self.peek()[1] in ("*", "/"):
+            op = self.take()
+            value = self.binary(value, self.unary(), op)
+        return value
+
+    def unary(self):
+        if self.accept("-"):
+            return [self.temporary("-%s" % c) for c in self.unary()]
+        self.accept("+")
+        return self.postfix()
+
+    def postfix(self):
+        value = self.primary()
+        while self.accept("."):
+            value = [value[i] for i in self.swizzle(self.take(kind="name"), len(value))]
+        return value
+
+    def arguments(self):
+        self.take("(")
+        args = []
+        if not self.accept(")"):
+            args.append(self.expression())
+            while self.accept(","):
+                args.append(self.expression())
+            self.take(")")
+        return args
+
+    def primary(self):
+        kind, text, _ = self.peek()
+        if kind == "number":
+            self.take()
+            return [self.constant(float(text.rstrip("fF")))]
+        if self.accept("("):
+            value = self.expression()
+            self.take(")")
+            return value
+        name = self.take(kind="name")
+        if name in TYPES:
+            return self.construct(TYPES[name], self.arguments())
+        if self.peek()[1] == "(":
+            return self.call(name, self.arguments())
+        variable = self.lookup(name)
+        if variable.kind == "uniform":
+            return [self.uniform(variable, i) for i in range(variable.size)]
+        return [self.component(name, i) for i in range(variable.size)]
+
+    def uniform(self, variable, index):
+        field = "uniforms->%s" % variable.name
+        if variable.size > 1:
+            field += "[%d]" % index
+        return "glslSplat<%s>(%s)" % (self.scalar, field)
+
+    def construct(self, size, args):
+        components = [c for arg in args for c in arg]
+        if len(args) == 1 and len(components) == 1:
+            return components * size
+        if len(components) < size:
+            self.error("not enough components for a %d-component constructor" % size)
+        return components[:size]
+
+    def call(self, name, args):
+        if name in ELEMENTWISE:
+            count, helper = ELEMENTWISE[name]
+            if len(args) != count:
+                self.error("%s takes %d arguments" % (name, count))
+            size = max(len(a) for a in args)
+            args = [self.convert(a, size) for a in args]
+            return [self.temporary("%s(%s)" % (helper, ", ".join(parts))) for parts in zip(*args)]
+        if name == "dot":
+            return [self.dot(*self.pair(name, args))]
+        if name == "length":
+            if len(args) != 1:
+                self.error("length takes 1 argument")
+            return [self.temporary("glslSqrt(%s)" % self.dot(args[0], args[0]))]
+        if name == "normalize":
+            if len(args) != 1:
+                self.error("normalize takes 1 argument")
+            scale = self.temporary("glslInverseSqrt(%s)" % self.dot(args[0], args[0]))
+            return [self.temporary("%s * %s" % (c, scale)) for c in args[0]]
+        if name == "cross":
+            a, b = self.pair(name, args)
+            if len(a) != 3:
+                self.error("cross takes vec3 arguments")
+            return [self.temporary("%s * %s - %s * %s" % (a[(i + 1) % 3], b[(i + 2) % 3], a[(i + 2) % 3], b[(i + 1) % 3]))
+                    for i in range(3)]
+        self.error("unsupported function %r" % name)
+
+    def pair(self, name, args):
+        if len(args) != 2 or len(args[0]) != len(args[1]):
+            self.error("%s takes two arguments of the same size" % name)
+        return args
+
+    def dot(self, a, b):
+        total = self.temporary("%s * %s" % (a[0], b[0]))
+        for x, y in zip(a[1:], b[1:]):
+            total = self.temporary("%s + %s * %s" % (total, x, y))
+        return total
+
+
+def indent(lines, depth):
+    return "".join("    " * depth + line + "\n" for line in lines)
+
+
+def declare(variables, scalar):
+    return ["%s %s = glslSplat<%s>(0.0f);" % (scalar, Shader.component(v.name, i), scalar)
+            for v in variables for i in range(v.size)]
+
+
+def generate(name, vertex, fragment, sources):
+    varyings = {}
+    offset = 0
+    for v in vertex.variables("out"):
+        varyings[v.name] = (offset, v)
+        offset += v.size
+    for v in fragment.variables("in"):
+        if v.name not in varyings or varyings[v.name][1].type != v.type:
+            raise CompileError("%s: input %s %s is not a vertex shader output" % (fragment.path, v.type, v.name))
+    outputs = fragment.variables("out")
+    if len(outputs) != 1 or outputs[0].size != 4:
+        raise CompileError("%s: needs exactly one vec4 output" % fragment.path)
+
+    uniforms = []
+    seen = {}
+    for shader in (vertex, fragment):
+        for v in shader.variables("uniform"):
+            if v.name in seen:
+                if seen[v.name].type != v.type:
+                    raise CompileError("%s: uniform %s declared with two types" % (shader.path, v.name))
+                continue
+            seen[v.name] = v
+            uniforms.append(v)
+
+    struct = "Glsl" + name
+    guard = "GLSL_" + re.sub(r"(?<!^)(?=[A-Z])", "_", name).upper() + "_H"
+    out = []
+    out.append("// Generated by tools/glslc.py from %s; do not edit.\n" % ", ".join(sources))
+    out.append("#ifndef %s\n#define %s\n\n#include <raster/glsl_runtime.h>\n#include <raster/pipeline.h>\n\n" % (guard, guard))
+    # components a shader never reads, e.g. after a swizzle, are left to the C++ compiler to drop
+    out.append("#ifdef __GNUC__\n#pragma GCC diagnostic push\n#pragma GCC diagnostic ignored \"-Wunused-variable\"\n#endif\n")
+    out.append("struct %s\n{\n" % struct)
+    out.append("    struct Uniforms\n    {\n")
+    for v in uniforms:
+        out.append("        float %s%s;\n" % (v.name, "" if v.size == 1 else "[%d]" % v.size))
+    if not uniforms:
+        out.append("        char unused;\n")
+    out.append("    };\n")
+    out.append("    static const int VARYINGS = %d;\n\n" % offset)
+
+    # vertex shader
+    body = []
+    for v in vertex.variables("in"):
+        body += ["const float %s = attributes[%d][%d];" % (Shader.component(v.name, i), v.location, i) for i in range(v.size)]
+    body += declare([Variable("out", "vec4", "gl_Position")] + vertex.variables("out"), "float")
+    body += vertex.lines
+    body += ["position[%d] = gl_Position_%d;" % (i, i) for i in range(4)]
+    for v in vertex.variables("out"):
+        body += ["varyings[%d] = %s;" % (varyings[v.name][0] + i, Shader.component(v.name, i)) for i in range(v.size)]
+    out.append("    static void vertex(const float *const *attributes, const void *uniformData, float *position, float *varyings)\n    {\n")
+    out.append("        const Uniforms *uniforms = (const Uniforms*)uniformData;\n        (void)uniforms;\n")
+    out.append(indent(body, 2))
+    out.append("    }\n\n")
+
+    # fragment shader, over F
+    body = []
+    for v in fragment.variables("in"):
+        start = varyings[v.name][0]
+        body += ["const F %s = in[%d];" % (Shader.component(v.name, i), start + i) for i in range(v.size)]
+    body += declare(outputs, "F")
+    body += fragment.lines
+    body += ["out[%d] = %s;" % (i, Shader.component(outputs[0].name, i)) for i in range(4)]
+    out.append("    template <typename F>\n    GLSL_INLINE static void fragmentMain(const F *in, const Uniforms *uniforms, F *out)\n    {\n")
+    out.append("        (void)in;\n        (void)uniforms;\n")
+    out.append(indent(body, 2))
+    out.append("    }\n")
+    out.append("    static void fragment(const float *varyings, const void *uniforms, float *color)\n    {\n")
+    out.append("        fragmentMain<float>(varyings, (const Uniforms*)uniforms, color);\n    }\n")
+    out.append("#ifdef GLSL_SIMD\n")
+    for suffix, attribute in (("Generic", ""), ("Avx2", "    GLSL_AVX2\n")):
+        out.append("%s    static void fragment8%s(const float *varyings, const void *uniforms, float *color)\n    {\n" % (attribute, suffix))
+        out.append("        GlslFloat8 in[%d], out[4];\n" % max(offset, 1))
+        out.append("        glslLoad8(varyings, in, VARYINGS);\n")
+        out.append("        fragmentMain<GlslFloat8>(in, (const Uniforms*)uniforms, out);\n")
+        out.append("        glslStore8(out, color, 4);\n    }\n")
+    out.append("    static void fragment8(const float *varyings, const void *uniforms, float *color)\n    {\n")
+    out.append("        if (glslAvx2())\n            fragment8Avx2(varyings, uniforms, color);\n")
+    out.append("        else\n            fragment8Generic(varyings, uniforms, color);\n    }\n")
+    out.append("#endif\n\n")
+
+    out.append("    static RasterPipeline::Program program(const Uniforms *uniforms = nullptr)\n    {\n")
+    out.append("        RasterPipeline::Program program;\n")
+    out.append("        program.vertex = &vertex;\n        program.fragment = &fragment;\n")
+    out.append("#ifdef GLSL_SIMD\n        program.fragment8 = &fragment8;\n#endif\n")
+    out.append("        program.varyings = VARYINGS;\n        program.uniforms = uniforms;\n")
+    out.append("        return program;\n    }\n")
+    out.append("};\n#ifdef __GNUC__\n#pragma GCC diagnostic pop\n#endif\n#endif\n")
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile a GLSL-subset shader pair to C++.")
+    parser.add_argument("--name", required=True, help="CamelCase program name; the struct is Glsl<name>")
+    parser.add_argument("vertex")
+    parser.add_argument("fragment")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+    try:
+        vertex = Shader(args.vertex, "vertex", "float")
+        fragment = Shader(args.fragment, "fragment", "F")
+        sources = [path.replace("\\", "/").split("/")[-1] for path in (args.vertex, args.fragment)]
+        code = generate(args.name, vertex, fragment, sources)
+    except (CompileError, OSError) as e:
+        sys.exit("ERROR::GLSLC::%s" % e)
+    with open(args.output, "w") as f:
+        f.write(code)
+
+
+if __name__ == "__main__":
+    main()
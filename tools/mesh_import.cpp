@@ -0,0 +1,34 @@
+// Convert a Wavefront OBJ file into the binary .mesh format read by MappedMesh.
+//
+// g++ -std=c++17 -O2 -Iinclude tools/mesh_import.cpp -o mesh_import
+// ./mesh_import model.obj model.mesh
+#include <mesh/mesh_format.h>
+#include <mesh/obj_loader.h>
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        std::cout << "usage: mesh_import <input.obj> <output.mesh>" << std::endl;
+        return 1;
+    }
+    std::string input = argv[1];
+    std::string output = argv[2];
+    if (input.size() < 4 || input.compare(input.size() - 4, 4, ".obj") != 0)
+    {
+        std::cout << "ERROR::MESH_IMPORT::UNSUPPORTED_FORMAT: only .obj input is supported" << std::endl;
+        return 1;
+    }
+
+    MeshData mesh;
+    if (!ObjLoader::load(input, mesh))
+        return 1;
+    if (!writeMesh(mesh, output))
+        return 1;
+    std::cout << output << ": " << mesh.vertexCount() << " vertices, " << mesh.indices.size() / 3 << " triangles, "
+              << mesh.subMeshes.size() << " sub-meshes, stride " << mesh.vertexStride << std::endl;
+    return 0;
+}
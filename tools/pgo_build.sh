@@ -0,0 +1,20 @@
+#!/bin/sh
+# Two-stage profile guided build: instrument, train on the headless benchmarks, rebuild with the profiles
+# and run the tests (the self-checking benchmarks) on the result.
+#
+#   tools/pgo_build.sh [build directory] [extra cmake arguments...]
+#
+# Both stages reuse one build directory because GCC looks profiles up by object file path.
+set -e
+BUILD=${1:-build/pgo}
+[ $# -gt 0 ] && shift
+SOURCE=$(cd "$(dirname "$0")/.." && pwd)
+
+rm -rf "$BUILD/pgo"
+cmake -S "$SOURCE" -B "$BUILD" -DCMAKE_BUILD_TYPE=Release -DTRIANGLE_PGO=GENERATE "$@"
+cmake --build "$BUILD" -j
+cmake --build "$BUILD" --target pgo-train
+cmake -S "$SOURCE" -B "$BUILD" -DTRIANGLE_PGO=USE "$@"
+cmake --build "$BUILD" -j --clean-first
+(cd "$BUILD" && ctest --output-on-failure)
+echo "PGO build ready in $BUILD"
@@ -0,0 +1,35 @@
+// Render the oldmain.cpp triangle scene with the software rasteriser, without GL, a window
+// system or Mesa, and report triangles/s and fill rate. The image is written as a PPM.
+// main.cpp --backend=software runs the same thing (include/raster/software_backend.h).
+//
+// g++ -std=c++17 -O2 -Iinclude tools/soft_render.cpp -o soft_render
+// ./soft_render --scene=third --size=800x600 --frames=100 --output=frame.ppm
+#include <raster/software_backend.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char **argv)
+{
+    SoftwareBackend backend;
+    backend.frames = 100;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--scene=", 8) == 0)
+            backend.scene = arg + 8;
+        else if (std::strncmp(arg, "--output=", 9) == 0)
+            backend.output = arg + 9;
+        else if (std::sscanf(arg, "--size=%dx%d", &backend.width, &backend.height) == 2 && backend.width > 0 && backend.height > 0)
+            ;
+        else if (std::sscanf(arg, "--frames=%d", &backend.frames) == 1 && backend.frames > 0)
+            ;
+        else
+        {
+            std::cout << "usage: soft_render [--scene=first|second|third|all] [--size=<w>x<h>] [--frames=<n>] [--output=<file.ppm>]" << std::endl;
+            return 1;
+        }
+    }
+    return backend.run() ? 0 : 1;
+}